@@ -1,6 +1,7 @@
 const nodeExec = require('child_process').exec;
 const fs = require('fs');
 const path = require('path')
+const os = require('os');
 
 
 const emcc = "emcc";
@@ -11,12 +12,31 @@ const workerOutFile = 'worker.js';
 const orchestratorOutFile = 'constantq.js';
 
 const orchestratorCppFile = 'ConstantQOrchestrator.cpp';
-const workerExcludeCppFiles = ['Tests.cpp', orchestratorCppFile];
+// the C interface for native callers (see python/) and the fingerprint index it exposes are not part of 
+// the wasm builds
+const nativeCppFiles = ['ConstantQApi.cpp', 'FingerprintIndex.cpp'];
+const workerExcludeCppFiles = ['Tests.cpp', orchestratorCppFile, ...nativeCppFiles];
+
+// sources shared with the worker that the orchestrator also requires
+const orchestratorSharedCppFiles = ['Profiler.cpp', 'MemoryTracker.cpp', 'FramePyramid.cpp', 'AudioWindow.cpp', 
+    'TileRenderer.cpp', 'OnsetDetector.cpp'];
+
+// generates BakedKernels.cpp with kernels for common configurations prior to building
+const bakeKernelsCppFile = 'tools/BakeKernels.cpp';
+const bakeKernelsSharedCppFiles = ['ConstantQ.cpp', 'MathUtil.cpp', 'SparseKernel.cpp', 'KernelEntry.cpp', 
+    'Profiler.cpp', 'MemoryTracker.cpp'];
+const bakedKernelsCppFile = 'BakedKernels.cpp';
+const bakeKernelsOutFile = 'bakeKernels.js';
+
+const bakeKernelsParams = [
+    '-s ALLOW_MEMORY_GROWTH=1',
+    '-std=c++17'
+];
 
 const workerParams = [
     '-s ALLOW_MEMORY_GROWTH=1',
     '-std=c++17',
-    "-s EXPORTED_FUNCTIONS=\"['_initializeSession', '_sessionAnalyze']\"",
+    "-s EXPORTED_FUNCTIONS=\"['_initializeSession', '_sessionAnalyze', '_releaseSession', '_streamAnalyze', '_loadSession']\"",
     '-s BUILD_AS_WORKER=1'
 ];
 
@@ -44,19 +64,43 @@ function baseExec(command, cwd, callback, showError, showStd) {
   });
 }
 
-function emccBuild(emccPath, sourceFiles, outFile, params) {
+function emccBuild(emccPath, sourceFiles, outFile, params, callback) {
     const command = [emccPath, ...params, ...sourceFiles, 
         '-o', outFile].join(" ");
 
     console.log(`Executing: ${command}`);
-    baseExec(command, undefined, undefined, true, true);
+    baseExec(command, undefined, callback, true, true);
+}
+
+// builds and runs the kernel generator with node; the existing BakedKernels.cpp is kept if that fails
+function bakeKernels(callback) {
+    const outFile = path.join(os.tmpdir(), bakeKernelsOutFile);
+    const sourceFiles = [bakeKernelsCppFile, ...bakeKernelsSharedCppFiles].map(f => path.join(__dirname, cppDir, f));
+
+    emccBuild(emcc, sourceFiles, outFile, bakeKernelsParams, (error) => {
+        if (error) {
+            console.error(`Unable to build kernel generator; using existing ${bakedKernelsCppFile}`);
+            callback();
+            return;
+        }
+
+        console.log(`Executing: node ${outFile}`);
+        baseExec(`node ${outFile}`, undefined, (error, stdout) => {
+            if (!error && stdout)
+                fs.writeFileSync(path.join(__dirname, cppDir, bakedKernelsCppFile), stdout);
+
+            callback();
+        }, true, false);
+    });
 }
 
 const workerSourceFiles = fs.readdirSync(path.join(__dirname, cppDir))
     .filter(file => file.endsWith('.cpp') && workerExcludeCppFiles.indexOf(file) < 0)
     .map(f => path.join(__dirname, cppDir, f));
 
-emccBuild(emcc, workerSourceFiles, 
-     path.join(__dirname, wasmOutdir, workerOutFile), workerParams);
-emccBuild(emcc, [path.join(__dirname, cppDir, orchestratorCppFile)], 
-    path.join(__dirname, wasmOutdir, orchestratorOutFile), orchestratorParams);
\ No newline at end of file
+bakeKernels(() => {
+    emccBuild(emcc, workerSourceFiles, 
+         path.join(__dirname, wasmOutdir, workerOutFile), workerParams);
+    emccBuild(emcc, [orchestratorCppFile, ...orchestratorSharedCppFiles].map(f => path.join(__dirname, cppDir, f)), 
+        path.join(__dirname, wasmOutdir, orchestratorOutFile), orchestratorParams);
+});
\ No newline at end of file
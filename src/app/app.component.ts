@@ -30,6 +30,8 @@ export class AppComponent implements OnInit {
   loadingPercentage: number = undefined;
   loadingModal: NgbModalRef = undefined;
   graphMax: number;
+  // the pitch data currently displayed (disposed when replaced)
+  pitchData: ConstantQData = undefined;
   audioLoadSub: Subscription;
   positionSub: Subscription;
   selectedSub: Subscription;
@@ -83,17 +85,15 @@ export class AppComponent implements OnInit {
       this.noteLetters = noteLetters.slice(0, noteLetters.length - 2);
     }
     
+    if (this.pitchData && this.pitchData !== pitchData)
+      this.pitchData.dispose();
+
+    this.pitchData = pitchData;
+
     if (pitchData) {
-      // determine max value for graph
-      const maxVal = pitchData.constQData.reduce(
-        (prevVal, curArr) => {
-          return curArr.reduce((prev, curVal) => {
-            if (curVal > prev)
-              return curVal;
-            else
-              return prev;
-          }, prevVal);
-        }, 0);
+      // determine max value for graph from the whole song reduced to a single step
+      const overview = pitchData.getRange(0, pitchData.constQData.length * pitchData.secResolution, 1)[0] || [];
+      const maxVal = overview.reduce((prev, curVal) => curVal > prev ? curVal : prev, 0);
   
       // round graph max to nearest number
       var log10 = 0;
@@ -167,7 +167,8 @@ export class AppComponent implements OnInit {
       this.audioLoadSub = audioBuffer.pipe(
         mergeMap(buffer => ConstantQDataUtil.messageProcessing(
             buffer, this.minPitch, this.maxPitch, 
-            ConstantQ.DEFAULT_BINS, ConstantQ.DEFAULT_THRESH, this.fps)
+            ConstantQ.DEFAULT_BINS, ConstantQ.DEFAULT_THRESH, this.fps,
+            ConstantQDataUtil.PRIORITY_VISIBLE, true, ConstantQDataUtil.ACCURACY_FAST)
           .pipe(map(message => {return {buffer, message}; })))
         ).subscribe(data => this.onConstantQMsg(data.message, data.buffer),
         err => {
@@ -211,5 +212,10 @@ export class AppComponent implements OnInit {
       if (sub)
         sub.unsubscribe();
     }
+
+    if (this.pitchData)
+      this.pitchData.dispose();
+
+    ConstantQDataUtil.shutdown();
   }
 }
\ No newline at end of file
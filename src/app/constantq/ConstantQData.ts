@@ -4,18 +4,38 @@ import { Pitch } from './Pitch';
  * holds constant q data for an entire song
  */
 export default class ConstantQData {
+    // reductions for getRange (see FramePyramid.hpp)
+    static readonly REDUCE_MAX = 0;
+    static readonly REDUCE_MEAN = 1;
+
+    // colormaps for spectrogram tiles (see TileRenderer.hpp)
+    static readonly COLORMAP_GRAY = 0;
+    static readonly COLORMAP_HEAT = 1;
+    static readonly COLORMAP_VIRIDIS = 2;
+
+    // time steps (pixel columns) per spectrogram tile
+    static readonly TILE_COLUMNS = 256;
+
+    // default spectrogram tile scaling: pixel rows per semitone, the magnitude drawn brightest 
+    // (about that of a full scale sine) and the decibels below it drawn darkest
+    static readonly TILE_ROWS_PER_SEMITONE = 2;
+    static readonly TILE_REFERENCE = .27;
+    static readonly TILE_FLOOR_DB = -60;
+
     /**
      * the constant q data for an entire audio buffer
      * @param constQData        the buffer data.  
      *                          index 1 represents each time step
      *                          index 2 is each bin of constant q data
      * @param secResolution     the length of a time step
+     * @param pyramidId         the id of the wasm job holding this data as a pyramid (if any)
      */
     constructor(
         public readonly constQData : number[][], 
         public readonly secResolution: number,
         public readonly lowPitch: Pitch,
-        public readonly highPitch: Pitch) {}
+        public readonly highPitch: Pitch,
+        private pyramidId: number = undefined) {}
 
     /**
      * gets the constant q data for the second position provided
@@ -26,4 +46,130 @@ export default class ConstantQData {
     getData(secPos : number) {
         return this.constQData[Math.max(0, Math.floor(secPos / this.secResolution))];
     }
+
+    /**
+     * gets the constant q data for a span reduced to one time step per pixel for overviews and scrubbing
+     * (from the wasm pyramid when available so the cost is proportional to pixels rather than time steps)
+     * @param startSec      the start of the span in seconds
+     * @param endSec        the end of the span in seconds
+     * @param pixels        the number of pixels the span is drawn over
+     * @param reduction     REDUCE_MAX or REDUCE_MEAN
+     * @returns             the constant q data for each pixel
+     */
+    getRange(startSec: number, endSec: number, pixels: number, 
+        reduction: number = ConstantQData.REDUCE_MAX) : number[][] {
+
+        let startFrame = Math.max(0, Math.floor(startSec / this.secResolution));
+        let endFrame = Math.min(this.constQData.length, Math.ceil(endSec / this.secResolution));
+        let toRet: number[][] = [];
+
+        if (this.pyramidId !== undefined) {
+            let reduced = (<any> window).Module.queryPyramid(this.pyramidId, startFrame, endFrame, pixels, reduction);
+            let frameSize = reduced.size() / pixels;
+            for (let p = 0; p < pixels && frameSize > 0; p++) {
+                let frame = [];
+                for (let b = 0; b < frameSize; b++)
+                    frame.push(reduced.get(p * frameSize + b));
+
+                toRet.push(frame);
+            }
+
+            reduced.delete();
+            if (toRet.length)
+                return toRet;
+        }
+
+        // without a pyramid every time step in the span is scanned
+        for (let p = 0; p < pixels; p++) {
+            let first = startFrame + Math.floor((endFrame - startFrame) * p / pixels);
+            let last = Math.max(first + 1, startFrame + Math.floor((endFrame - startFrame) * (p + 1) / pixels));
+            let frame: number[] = undefined;
+            for (let f = first; f < last && f < this.constQData.length; f++) {
+                let data = this.constQData[f];
+                if (!frame)
+                    frame = data.map(v => reduction == ConstantQData.REDUCE_MAX ? v : v / (last - first));
+                else
+                    frame = frame.map((v, b) => reduction == ConstantQData.REDUCE_MAX ? 
+                        Math.max(v, data[b]) : v + data[b] / (last - first));
+            }
+
+            toRet.push(frame || []);
+        }
+
+        return toRet;
+    }
+
+    /**
+     * @returns the number of spectrogram tiles (each covering TILE_COLUMNS time steps; 0 without wasm tiles,
+     *          which are requested with the analysis as in ConstantQDataUtil.messageProcessing)
+     */
+    get totalTiles(): number {
+        return this.pyramidId !== undefined ? (<any> window).Module.totalTiles(this.pyramidId) : 0;
+    }
+
+    /**
+     * @param index     the tile
+     * @returns         a number that changes when the tile is rendered again (so unchanged tiles need not be
+     *                  drawn again)
+     */
+    getTileVersion(index: number): number {
+        return this.pyramidId !== undefined ? (<any> window).Module.tileVersion(this.pyramidId, index) : 0;
+    }
+
+    /**
+     * gets a spectrogram tile rendered in wasm that can be drawn to a canvas with putImageData
+     * @param index     the tile (covering time steps [index * TILE_COLUMNS, (index + 1) * TILE_COLUMNS))
+     * @returns         the tile with the highest pitch at the top (undefined if it has not been rendered)
+     */
+    getTile(index: number): ImageData {
+        if (this.pyramidId === undefined)
+            return undefined;
+
+        let module = (<any> window).Module;
+        let rows = module.tileRows(this.pyramidId);
+        let view: Uint8Array = module.tilePixels(this.pyramidId, index);
+
+        // the view is of wasm memory so it is copied before memory can grow
+        return rows > 0 && view.length > 0 ? 
+            new ImageData(new Uint8ClampedArray(view), ConstantQData.TILE_COLUMNS, rows) : undefined;
+    }
+
+    /**
+     * gets a spectrogram of a span reduced to one column per pixel (from the wasm pyramid) for overviews
+     * @param startSec      the start of the span in seconds
+     * @param endSec        the end of the span in seconds
+     * @param pixels        the number of columns
+     * @returns             the spectrogram (undefined without wasm tiles)
+     */
+    getRangeImage(startSec: number, endSec: number, pixels: number): ImageData {
+        if (this.pyramidId === undefined)
+            return undefined;
+
+        let startFrame = Math.max(0, Math.floor(startSec / this.secResolution));
+        let endFrame = Math.min(this.constQData.length, Math.ceil(endSec / this.secResolution));
+        let module = (<any> window).Module;
+        let rows = module.tileRows(this.pyramidId);
+        let view: Uint8Array = module.renderRange(this.pyramidId, startFrame, endFrame, pixels);
+        return rows > 0 && view.length > 0 ? new ImageData(new Uint8ClampedArray(view), pixels, rows) : undefined;
+    }
+
+    /**
+     * changes the log scaling of the spectrogram tiles (every tile is rendered again)
+     * @param reference     the magnitude drawn brightest (such as the largest value of getRange over the data)
+     * @param floorDb       the decibels below the reference drawn darkest
+     */
+    setTileScale(reference: number, floorDb: number = ConstantQData.TILE_FLOOR_DB) {
+        if (this.pyramidId !== undefined)
+            (<any> window).Module.setTileScale(this.pyramidId, reference, floorDb);
+    }
+
+    /**
+     * frees the wasm pyramid and tiles for this data (getRange then scans the time steps)
+     */
+    dispose() {
+        if (this.pyramidId !== undefined)
+            (<any> window).Module.releasePyramid(this.pyramidId);
+
+        this.pyramidId = undefined;
+    }
 }
\ No newline at end of file
@@ -1,7 +1,7 @@
 import ConstantQData from './ConstantQData';
 import ConstantQ from './ConstantQ';
 import Complex from './Complex';
-import { Subject, Observable } from 'rxjs';
+import { Observable, Subscriber } from 'rxjs';
 import { Pitch } from './Pitch';
 
 /**
@@ -20,6 +20,51 @@ export default class ConstantQDataUtil {
     // how often user will get updates
     static readonly PERCENTAGE_INCREMENTS = 5;
 
+    // flags for what the wasm session produces per frame (see ConstantQSession.hpp)
+    static readonly OUTPUT_BINS = 1;
+    static readonly OUTPUT_NOTES = 2;
+    static readonly OUTPUT_CHROMA = 4;
+    static readonly OUTPUT_ONSETS = 8;
+    static readonly OUTPUT_SKIP_SILENT = 16;
+    static readonly OUTPUT_SKIP_REPEATED = 32;
+
+    // accuracy tiers of the wasm session with their error bounds (see ConstantQSession.hpp)
+    static readonly ACCURACY_EXACT = 0;
+    static readonly ACCURACY_FAST = 1;
+    static readonly ACCURACY_DISPLAY = 2;
+    static readonly ACCURACY_POWER = 3;
+    static readonly ACCURACY_FIXED = 4;
+
+    // analysis priorities (see ConstantQOrchestrator.cpp); higher priorities are dispatched first
+    static readonly PRIORITY_BACKGROUND = 0;
+    static readonly PRIORITY_VISIBLE = 10;
+
+    // bytes of a file read at once when streaming (see streamProcessing)
+    static readonly STREAM_SLICE_BYTES = 1 << 20;
+
+    // bytes of audio an analysis holds in wasm memory at once (see messageProcessing)
+    static readonly DEFAULT_MEMORY_BUDGET = 64 << 20;
+
+    // the version of the wasm bindings this code calls (WASM_API_VERSION in ConstantQOrchestrator.cpp);
+    // wasm built before the bindings were versioned only has the original evaluate (see wasmApiVersion)
+    static readonly WASM_API_VERSION = 1;
+
+    /**
+     * @returns the version of the loaded wasm bindings (0 for wasm built before they were versioned, which
+     *          is analyzed with the original evaluate and has no jobs, pyramids, tiles or streaming)
+     */
+    static wasmApiVersion(): number {
+        let module = (<any> window).Module;
+        return module && module.apiVersion ? module.apiVersion() : 0;
+    }
+
+    /**
+     * @returns whether the loaded wasm has the bindings this code calls
+     */
+    private static currentWasm(): boolean {
+        return ConstantQDataUtil.wasmApiVersion() === ConstantQDataUtil.WASM_API_VERSION;
+    }
+
     /**
      * pads the processed info array so that all frames for the length of the song are covered
      * (assume last frame will be copied for the length of the song)
@@ -43,6 +88,121 @@ export default class ConstantQDataUtil {
 
         return [...retArr, ...paddedArr];
     }
+    /**
+     * runs a wasm analysis job reporting its progress and data
+     * 
+     * @param minPitch  the minimum pitch of the analysis
+     * @param maxPitch  the maximum pitch of the analysis
+     * @param fps       the number of analysis per second
+     * @param duration  the duration in seconds (if undefined, determined from the frames)
+     * @param tiles     whether to render spectrogram tiles in wasm as chunks complete (see ConstantQData.getTile)
+     * @param evaluate  starts the job given the status and data update pointers and returns the job id
+     * @param onStatus  called with statuses other than sparse kernel and constant q progress
+     * @returns         the observable of messages (unsubscribing cancels the job)
+     */
+    private static jobProcessing(
+        minPitch: Pitch, maxPitch: Pitch, fps: number, duration: number, tiles: boolean,
+        evaluate: (statusUpdatePtr: string, dataUpdatePtr: string) => number,
+        onStatus: (status: number, num: number, subscriber: Subscriber<ConstantQMessage>) => void = undefined) 
+            : Observable<ConstantQMessage> {
+
+        return new Observable<ConstantQMessage>(subscriber => {
+            let jobId: number = undefined;
+            let statUpdateFunc = undefined;
+            let dataUpdateFunc = undefined;
+
+            let removeFunctions = () => {
+                if (statUpdateFunc !== undefined)
+                    (<any> window).removeFunction(statUpdateFunc);
+                if (dataUpdateFunc !== undefined)
+                    (<any> window).removeFunction(dataUpdateFunc);
+
+                statUpdateFunc = undefined;
+                dataUpdateFunc = undefined;
+            };
+
+            try {
+                let retArr = [];
+                let count = 0;
+                let totCount = 0;
+
+                let dataUpdate = (i,b,val) => {
+                    while (retArr.length <= i)
+                        retArr[i] = [];
+
+                    while (retArr[i].length < b)
+                        retArr.push(undefined);
+                    
+                    retArr[i][b] = val;
+                }
+
+                let statusUpdate = (status, num) => {
+                    switch (status) {
+                        case 0: 
+                            subscriber.next({status:"Loading", message:"Calculating Sparse Kernel"});
+                            break;
+                        case 1: 
+                            totCount = num;
+                            subscriber.next({status:"Loading", message:"Parsing Constant Q Data", completion:0});
+                            break;
+                        case 2: 
+                            count += num;
+                            if (count >= totCount) {
+                                removeFunctions();
+                                let pyramidId = jobId;
+                                jobId = undefined;
+                                let paddedArr = ConstantQDataUtil.padAudioArray(
+                                                    retArr, 1/fps, duration !== undefined ? duration : retArr.length / fps);
+
+                                let constantqdata = new ConstantQData(paddedArr, 1/fps, minPitch, maxPitch, pyramidId);
+                                subscriber.next({status:"Complete", data: constantqdata});
+                            }
+                            else {
+                                subscriber.next({status:"Loading", message:"Parsing Constant Q Data", completion:count / totCount});
+                            }
+                                
+                            break;
+                        default:
+                            if (onStatus)
+                                onStatus(status, num, subscriber);
+                            break;
+                    }
+                };
+
+                statUpdateFunc = (<any> window).addFunction(statusUpdate, 'vii');
+                dataUpdateFunc = (<any> window).addFunction(dataUpdate, 'viid');
+                jobId = evaluate(statUpdateFunc.toString(), dataUpdateFunc.toString());
+
+                // tiles can only be enabled while the job runs so they are requested with the analysis
+                if (tiles && jobId !== undefined)
+                    (<any> window).Module.enableTiles(jobId, ConstantQData.TILE_ROWS_PER_SEMITONE, 
+                        ConstantQData.TILE_REFERENCE, ConstantQData.TILE_FLOOR_DB, ConstantQData.COLORMAP_VIRIDIS);
+            }
+            catch (e) {
+                subscriber.next({status:"Error", message:e.toString()});
+            }
+
+            // unsubscribing before completion cancels the analysis and frees its buffers
+            return () => {
+                if (jobId !== undefined)
+                    (<any> window).Module.cancelJob(jobId);
+
+                jobId = undefined;
+                removeFunctions();
+            };
+        });
+    }
+
+    /**
+     * cancels every analysis and terminates the wasm workers (including those kept idle for reuse);
+     * workers are created again by later analyses
+     */
+    static shutdown() {
+        let module = (<any> window).Module;
+        if (module && module.shutdownWorkers)
+            module.shutdownWorkers();
+    }
+
     /**
      * creates constant q data by sending and receiving data from
      * wasm worker
@@ -53,7 +213,14 @@ export default class ConstantQDataUtil {
      * @param bins      the number of bins
      * @param thresh    the threshold for constant q
      * @param sampleInterval        the number of analysis per second (default is 16)
-     * @returns         the generated ConstantQData subject which yields
+     * @param priority  the priority of the analysis relative to other analyses
+     * @param decimate  whether to analyze at the lowest sample rate adequate for maxFreq (much faster for low
+     *                  ranges; off by default as neighbouring bins differ slightly from the full rate analysis)
+     * @param accuracy  the accuracy tier (ACCURACY_EXACT by default; faster tiers suit display only)
+     * @param memoryBudget  bytes of audio held in wasm memory at once (audio is pushed as it is needed)
+     * @param tiles     whether to render spectrogram tiles in wasm for ConstantQData.getTile and getRangeImage
+     *                  (off by default as they hold a second copy of the frames as pixels)
+     * @returns         the generated ConstantQData observable (unsubscribing cancels the analysis) which yields
      *                  results like:
      *                  {
      *                      status: 'Error'|'Loading'|'Complete'
@@ -67,81 +234,140 @@ export default class ConstantQDataUtil {
         maxPitch: Pitch = ConstantQ.DEFAULT_MAX_FREQ,
         bins: number = ConstantQ.DEFAULT_BINS,
         thresh: number = ConstantQ.DEFAULT_THRESH,
-        fps: number = ConstantQ.DEFAULT_FPS) : Observable<ConstantQMessage> {
+        fps: number = ConstantQ.DEFAULT_FPS,
+        priority: number = ConstantQDataUtil.PRIORITY_VISIBLE,
+        decimate: boolean = false,
+        accuracy: number = ConstantQDataUtil.ACCURACY_EXACT,
+        memoryBudget: number = ConstantQDataUtil.DEFAULT_MEMORY_BUDGET,
+        tiles: boolean = false) : Observable<ConstantQMessage> {
 
-        const subject = new Subject<ConstantQMessage>();
+        let jobId: number = undefined;
+        let offset = 0;
 
-        try {
-                
+        // mixes down the next samples into a vector for the job (which copies them)
+        let nextAudio = (num: number) => {
+            let end = Math.min(offset + num, buffer.length);
             let amplitudeBuffer = new (<any> window).Module.VectorDouble();
             for (let c = 0; c < buffer.numberOfChannels; c++) {
                 let floatData = buffer.getChannelData(c);
-                for (let i = 0; i < buffer.length; i++) {
+                for (let i = offset; i < end; i++) {
                     if (c == 0)
                         amplitudeBuffer.push_back(floatData[i])
                     else
-                        amplitudeBuffer[i] = amplitudeBuffer[i] + floatData[i];
+                        amplitudeBuffer.set(i - offset, amplitudeBuffer.get(i - offset) + floatData[i]);
                 }
             }
 
-            let retArr = [];
-            let count = 0;
-            let totCount = 0;
-
-            let dataUpdate = (i,b,val) => {
-                while (retArr.length <= i)
-                    retArr[i] = [];
+            offset = end;
+            return amplitudeBuffer;
+        };
 
-                while (retArr[i].length < b)
-                    retArr.push(undefined);
-                
-                retArr[i][b] = val;
-            }
+        return ConstantQDataUtil.jobProcessing(minPitch, maxPitch, fps, buffer.duration, tiles,
+            (statusUpdatePtr, dataUpdatePtr) => {
+                // wasm built before jobs is given all of the audio and has no job to cancel or push audio to
+                if (!ConstantQDataUtil.currentWasm()) {
+                    let amplitudeBuffer = nextAudio(buffer.length);
+                    (<any> window).Module.evaluate(
+                        buffer.sampleRate, minPitch.frequency, maxPitch.frequency, bins, thresh, 
+                        buffer.sampleRate / fps, 20, amplitudeBuffer, statusUpdatePtr, dataUpdatePtr);
 
-            let statusUpdate = (status, num) => {
-                switch (status) {
-                    case 0: 
-                        subject.next({status:"Loading", message:"Calculating Sparse Kernel"});
-                        break;
-                    case 1: 
-                        totCount = num;
-                        subject.next({status:"Loading", message:"Parsing Constant Q Data", completion:0});
-                        break;
-                    case 2: 
-                        count += num;
-                        if (count >= totCount) {
-                            (<any> window).removeFunction(statusUpdate);
-                            (<any> window).removeFunction(dataUpdate);
-                            let paddedArr = ConstantQDataUtil.padAudioArray(
-                                                retArr, 1/fps, buffer.duration);
-
-                            let constantqdata = new ConstantQData(paddedArr, 1/fps, minPitch, maxPitch);
-                            subject.next({status:"Complete", data: constantqdata});
-                        }
-                        else {
-                            subject.next({status:"Loading", message:"Parsing Constant Q Data", completion:count / totCount});
-                        }
-                            
-                        break;
+                    amplitudeBuffer.delete();
+                    return undefined;
                 }
-            };
 
-            let statUpdateFunc = (<any> window).addFunction(statusUpdate, 'vii');
-            let dataUpdateFunc = (<any> window).addFunction(dataUpdate, 'viid');
+                // the rest of the audio is requested as the analysis advances
+                let amplitudeBuffer = nextAudio(Math.floor(memoryBudget / 2 / Float64Array.BYTES_PER_ELEMENT));
+                jobId = (<any> window).Module.evaluate(
+                    buffer.sampleRate, minPitch.frequency, maxPitch.frequency, bins, thresh, 
+                    ConstantQDataUtil.OUTPUT_BINS, decimate, accuracy, buffer.sampleRate / fps, 20, amplitudeBuffer, 
+                    buffer.length, memoryBudget, statusUpdatePtr, dataUpdatePtr, priority);
 
-            (<any> window).Module.evaluate(
-                buffer.sampleRate, minPitch.frequency, maxPitch.frequency, bins, thresh, 
-                buffer.sampleRate / fps, 20, amplitudeBuffer, 
-                statUpdateFunc.toString(), dataUpdateFunc.toString());
-        }
-        catch (e) {
-            subject.next({status:"Error", message:e.toString()});
-        }
-        
-        return subject;
+                amplitudeBuffer.delete();
+                return jobId;
+            },
+            (status, num) => {
+                if (status == 6) {
+                    let amplitudeBuffer = nextAudio(num);
+                    (<any> window).Module.pushAudio(jobId, amplitudeBuffer);
+                    amplitudeBuffer.delete();
+                }
+            });
     }
 
+    /**
+     * creates constant q data for a wav file read in slices so that neither the file nor 
+     * its decoded audio is held in memory (intended for long recordings)
+     * 
+     * @param file      the wav file to analyze
+     * @param minFreq   the minimum frequency to utilize in constant q
+     * @param maxFreq   the maximum frequency to utilize in constant q
+     * @param bins      the number of bins
+     * @param thresh    the threshold for constant q
+     * @param fps       the number of analysis per second
+     * @param decimate  whether to analyze at the lowest sample rate adequate for maxFreq
+     * @param accuracy  the accuracy tier (ACCURACY_EXACT by default; faster tiers suit display only)
+     * @param tiles     whether to render spectrogram tiles in wasm (see messageProcessing)
+     * @returns         the generated ConstantQData observable (see messageProcessing)
+     */
+    static streamProcessing(file: Blob,
+        minPitch: Pitch = ConstantQ.DEFAULT_MIN_FREQ,
+        maxPitch: Pitch = ConstantQ.DEFAULT_MAX_FREQ,
+        bins: number = ConstantQ.DEFAULT_BINS,
+        thresh: number = ConstantQ.DEFAULT_THRESH,
+        fps: number = ConstantQ.DEFAULT_FPS,
+        decimate: boolean = false,
+        accuracy: number = ConstantQDataUtil.ACCURACY_EXACT,
+        tiles: boolean = false) : Observable<ConstantQMessage> {
+
+        return new Observable<ConstantQMessage>(subscriber => {
+            if (!ConstantQDataUtil.currentWasm()) {
+                subscriber.next({status:"Error", message:"Streaming requires the wasm built from src/cppwasm"});
+                return;
+            }
 
+            if (!(fps > 0)) {
+                subscriber.next({status:"Error", message:"Frames per second must be positive"});
+                return;
+            }
+
+            let jobId: number = undefined;
+            let offset = 0;
+
+            // slices are read one at a time as the worker is ready for them
+            let pushNext = () => {
+                let end = Math.min(offset + ConstantQDataUtil.STREAM_SLICE_BYTES, file.size);
+                let reader = new FileReader();
+                reader.onerror = () => subscriber.next({status:"Error", message:"Unable to read file"});
+                reader.onload = () => {
+                    if (!subscriber.closed)
+                        (<any> window).Module.pushStream(jobId, new Uint8Array(<ArrayBuffer> reader.result), end >= file.size);
+                };
+
+                reader.readAsArrayBuffer(file.slice(offset, end));
+                offset = end;
+            };
+
+            return ConstantQDataUtil.jobProcessing(minPitch, maxPitch, fps, undefined, tiles,
+                (statusUpdatePtr, dataUpdatePtr) => {
+                    jobId = (<any> window).Module.evaluateStream(
+                        minPitch.frequency, maxPitch.frequency, bins, thresh, 
+                        ConstantQDataUtil.OUTPUT_BINS, decimate, accuracy, fps, statusUpdatePtr, dataUpdatePtr);
+
+                    pushNext();
+                    return jobId;
+                },
+                (status, num) => {
+                    switch (status) {
+                        case 4:
+                            pushNext();
+                            break;
+                        case 5:
+                            subscriber.next({status:"Error", message:"Unsupported wav file"});
+                            break;
+                    }
+                }).subscribe(subscriber);
+        });
+    }
 
 
 
@@ -0,0 +1,66 @@
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "AccuracyHarness.hpp"
+#include "ConstantQ.hpp"
+#include "ConstantQSession.hpp"
+
+using namespace std;
+
+namespace constantq {
+    // the level of the noise in the test signal
+    const double TEST_NOISE_LEVEL = .05;
+
+    vector<double> AccuracyHarness::testSignal(int size, int fs) {
+        vector<double> toRet(size);
+
+        // a linear congruential generator so the noise is the same on every platform
+        unsigned int seed = 12345;
+        for (int i = 0; i < size; i++) {
+            double t = ((double) i) / fs;
+            double glide = 200 + 300 * t;
+            seed = seed * 1664525u + 1013904223u;
+            double noise = ((double) seed / 4294967296. - .5) * 2 * TEST_NOISE_LEVEL;
+
+            toRet[i] = .3 * sin(2 * M_PI * 82.41 * t) + 
+                .2 * sin(2 * M_PI * 261.63 * t) + 
+                .2 * sin(2 * M_PI * 659.25 * t) + 
+                .1 * sin(2 * M_PI * 987.77 * t) + 
+                .1 * sin(2 * M_PI * glide * t) + noise;
+        }
+
+        return toRet;
+    }
+
+    AccuracyReport AccuracyHarness::measure(int fs, double minFreq, double maxFreq, int bins, double thresh,
+        int accuracy, bool decimate, int frames) {
+
+        ConstantQSession session(fs, minFreq, maxFreq, bins, thresh, OUTPUT_BINS, decimate, accuracy);
+        int totalBins = session.bins();
+        int frameInterval = fs / 16;
+        auto data = testSignal(session.size() + frameInterval * frames, fs);
+        auto analyzed = session.analyzeToSingle(data, 0, frameInterval, frames);
+
+        vector<double> reference(totalBins * frames);
+        for (int f = 0; f < frames; f++) {
+            ConstantQ::directConstantQ(&data[frameInterval * f], fs, minFreq, maxFreq, bins, 
+                &reference[totalBins * f]);
+        }
+
+        if (accuracy == ACCURACY_POWER) {
+            for (auto& value : reference)
+                value *= value;
+        }
+
+        double peak = *max_element(reference.begin(), reference.end());
+        double maxError = 0;
+        double squaredError = 0;
+        for (int i = 0; i < reference.size(); i++) {
+            double error = abs(analyzed[i] - reference[i]);
+            maxError = max(maxError, error);
+            squaredError += error * error;
+        }
+
+        return { maxError / peak, sqrt(squaredError / reference.size()) / peak, peak };
+    }
+}
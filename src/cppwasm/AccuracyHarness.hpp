@@ -0,0 +1,44 @@
+#pragma once
+#include <vector>
+
+namespace constantq {
+    /**
+     * the error of an analysis relative to the direct time domain constant q transform
+     */
+    struct AccuracyReport {
+        // the largest difference of any bin relative to the largest reference bin
+        double maxError;
+        // the root mean square difference of all bins relative to the largest reference bin
+        double rmsError;
+        // the largest reference bin
+        double peak;
+    };
+
+    /**
+     * measures the error of each accuracy tier against ConstantQ::directConstantQ
+     */
+    class AccuracyHarness {
+        public:
+            /**
+             * @param size      the number of samples
+             * @param fs        the frames per second
+             * @returns         a deterministic test signal of tones spanning the default range, a glide and noise
+             */
+            static std::vector<double> testSignal(int size, int fs);
+
+            /**
+             * analyzes the test signal with a session and directly, comparing the bins of each frame
+             * @param fs        the frames per second
+             * @param minFreq   minimum frequency for analysis (in Hz)
+             * @param maxFreq   maximum frequency for analysis (in Hz)
+             * @param bins      bins per octave
+             * @param thresh    the sparse kernel threshold
+             * @param accuracy  the ACCURACY_ tier (for ACCURACY_POWER, squared magnitudes are compared)
+             * @param decimate  whether the session decimates
+             * @param frames    the number of frames to compare
+             * @returns         the errors of the session's bins
+             */
+            static AccuracyReport measure(int fs, double minFreq, double maxFreq, int bins, double thresh,
+                int accuracy, bool decimate = false, int frames = 8);
+    };
+}
@@ -0,0 +1,65 @@
+#include <deque>
+#include <algorithm>
+#include <cstring>
+#include <cassert>
+#include "AudioWindow.hpp"
+
+using namespace std;
+
+namespace constantq {
+    AudioWindow::AudioWindow(int blockSamples) : _blockSamples(blockSamples), _start(0), _end(0) { }
+
+    void AudioWindow::append(const double* samples, int count) {
+        while (count > 0) {
+            if (_blocks.empty() || _blocks.back().size() == _blockSamples) {
+                _blocks.push_back(AudioVector<double>());
+                _blocks.back().reserve(_blockSamples);
+            }
+
+            auto& block = _blocks.back();
+            int toAppend = min(count, _blockSamples - (int) block.size());
+            block.insert(block.end(), samples, samples + toAppend);
+            samples += toAppend;
+            count -= toAppend;
+            _end += toAppend;
+        }
+    }
+
+    void AudioWindow::copy(int start, int count, double* toRet) const {
+        assert(start >= _start && start + count <= _end);
+
+        // every block but the last is full so a sample's block follows from its index
+        int offset = start - _start;
+        while (count > 0) {
+            auto& block = _blocks[offset / _blockSamples];
+            int blockOffset = offset % _blockSamples;
+            int toCopy = min(count, (int) block.size() - blockOffset);
+            memcpy(toRet, &block[blockOffset], sizeof(double) * toCopy);
+            toRet += toCopy;
+            offset += toCopy;
+            count -= toCopy;
+        }
+    }
+
+    void AudioWindow::releaseBefore(int sample) {
+        while (!_blocks.empty() && _blocks.front().size() == _blockSamples && 
+                _start + _blockSamples <= sample) {
+            _blocks.pop_front();
+            _start += _blockSamples;
+        }
+    }
+
+    int AudioWindow::start() const { return _start; }
+
+    int AudioWindow::end() const { return _end; }
+
+    double AudioWindow::bytes() const {
+        return sizeof(double) * (double) _blocks.size() * _blockSamples;
+    }
+
+    int AudioWindow::framesForBudget(double budgetBytes, int kernelSize, int frameInterval) {
+        // a chunk of n frames spans kernelSize + (n - 1) * frameInterval samples
+        double samples = budgetBytes / sizeof(double);
+        return max(1, (int) ((samples - kernelSize) / frameInterval) + 1);
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include <deque>
+#include "MemoryTracker.hpp"
+
+namespace constantq {
+    // samples per block of an AudioWindow
+    const int DEFAULT_AUDIO_BLOCK_SAMPLES = 1 << 16;
+
+    /**
+     * the part of a recording still needed for analysis, appended as it arrives and released from 
+     * the front in blocks as analysis advances so memory is bounded by the window rather than the recording
+     */
+    class AudioWindow {
+        private:
+            std::deque<AudioVector<double> > _blocks;
+            int _blockSamples;
+
+            // the index of the first retained sample
+            int _start;
+
+            // one past the index of the last appended sample
+            int _end;
+
+        public:
+            /**
+             * @param blockSamples  the samples per block (the granularity audio is released in)
+             */
+            AudioWindow(int blockSamples = DEFAULT_AUDIO_BLOCK_SAMPLES);
+
+            /**
+             * @param samples   the samples following those already appended
+             * @param count     the number of samples
+             */
+            void append(const double* samples, int count);
+
+            /**
+             * @param start     the index of the first sample (must be retained)
+             * @param count     the number of samples (must have been appended)
+             * @param toRet     where the samples will be copied
+             */
+            void copy(int start, int count, double* toRet) const;
+
+            /**
+             * releases the blocks entirely before the sample
+             * @param sample    the first sample still needed
+             */
+            void releaseBefore(int sample);
+
+            /**
+             * @returns the index of the first retained sample
+             */
+            int start() const;
+
+            /**
+             * @returns one past the index of the last appended sample
+             */
+            int end() const;
+
+            /**
+             * @returns the bytes held
+             */
+            double bytes() const;
+
+            /**
+             * @param budgetBytes       the bytes available for a chunk's audio
+             * @param kernelSize        the samples analyzed per frame
+             * @param frameInterval     the samples between frames
+             * @returns                 the frames a chunk can hold within the budget (at least 1)
+             */
+            static int framesForBudget(double budgetBytes, int kernelSize, int frameInterval);
+    };
+}
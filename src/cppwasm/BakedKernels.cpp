@@ -0,0 +1,10480 @@
+// generated by tools/BakeKernels.cpp; do not edit
+#include "BakedKernels.hpp"
+
+namespace constantq {
+    const int ROW_STARTS_0[] = {0,6,11,17,22,28,34,41,47,54,61,68,75,83,91,99,108,117,125,134,143,153,163,173,183,194,205,216,227,239,251,263,276,290,304,318,332,348,364,380,397,414,431,449,468,487,507,527,548,570,593,616,639,663,688,713,740,767,795,823,852,883,914,946,979,1013,1049,1086,1124,1162,1202,1243,1285,1328,1373,1418,1465,1513,1563,1614,1667,1722,1778,1835,1894,1955,2018,2082,2148,2217,2288,2360,2435,2512,2591,2672,2756};
+
+    const BakedKernelEntry ENTRIES_0[] = {
+        {46,0x1.278703c35f2fap-22,0x1.65ad589c5ce97p-23},
+        {47,-0x1.52d1839cbacaep-18,0x1.17c2444d93288p-19},
+        {48,0x1.ce26d11357599p-19,-0x1.d0ff803984987p-17},
+        {49,0x1.4b91193c81e1ep-17,0x1.8ff29dca5889ap-17},
+        {50,-0x1.e61ca6e3400a1p-18,0x1.bcc51fbc29cb7p-22},
+        {51,0x1.e378c66107867p-22,-0x1.72a055143eedep-21},
+        {48,-0x1.0f60d55dc2482p-20,0x1.5ccedc692f256p-19},
+        {49,-0x1.b27fc26b8811ap-18,-0x1.2b83a02ee591p-17},
+        {50,0x1.13face8677a93p-16,-0x1.e884e55811ddep-21},
+        {51,-0x1.7cf2a96773f98p-18,0x1.4efcf478c0ce7p-17},
+        {52,-0x1.81b2b42c6e46ep-20,-0x1.710fea5fc7958p-19},
+        {49,0x1.debf5ef17ae38p-22,0x1.d30eca040d26cp-21},
+        {50,-0x1.e123c094b5c8cp-18,-0x1.2241120c7e684p-22},
+        {51,0x1.0927c265810dcp-17,-0x1.b178460291b1p-17},
+        {52,0x1.ed59ebb932b5ap-18,0x1.b8758ec779d64p-17},
+        {53,-0x1.d6cbc6f54e218p-18,-0x1.757e425fe19a9p-28},
+        {54,0x1.e3acd087445dep-22,-0x1.ae415b2ea0212p-21},
+        {51,-0x1.31dbfc342871p-19,0x1.82e1ba70c1482p-19},
+        {52,-0x1.57114f9267d9p-18,-0x1.634c6668201e6p-17},
+        {53,0x1.1477cffad2244p-16,0x1.402076beea6ffp-25},
+        {54,-0x1.59bd3a0d1d718p-18,0x1.61f7925ce9546p-17},
+        {55,-0x1.2eeab03d1bc56p-19,-0x1.82be14e41165ep-19},
+        {52,0x1.94c086c3bfc59p-22,0x1.4236000b4af32p-20},
+        {53,-0x1.ee21f9d7fa5fep-18,-0x1.654709c79eb9dp-21},
+        {54,0x1.d42ee22ef90f6p-18,-0x1.bcaf82053f428p-17},
+        {55,0x1.4b6550db5baf8p-17,0x1.900cbc38699ecp-17},
+        {56,-0x1.094e2aa354ac4p-17,0x1.453cf9d07a8a6p-19},
+        {57,0x1.58ba59a964dfp-23,-0x1.baab249935db5p-20},
+        {54,-0x1.07d6c1226e3e4p-19,0x1.7f51f3446a722p-19},
+        {55,-0x1.b35d3b29b059ep-18,-0x1.2ad9b1b2373f4p-17},
+        {56,0x1.0709e9d52cb38p-16,-0x1.3b3c091743377p-18},
+        {57,-0x1.51e930faf94abp-21,0x1.bdd15349fa9bap-17},
+        {58,-0x1.54f9d34764fd6p-18,-0x1.14f45e1efe3e8p-19},
+        {59,0x1.c28708e8cf45fp-22,-0x1.fd564cab62527p-22},
+        {55,0x1.de842866da899p-22,0x1.d44d843df1426p-21},
+        {56,-0x1.9c50bee25bd21p-18,0x1.3a0bb2a77f12cp-20},
+        {57,0x1.631b4f5162176p-20,-0x1.ccece589b8c7ap-17},
+        {58,0x1.fb8551cd55c8cp-17,0x1.95a0d7bc8a336p-18},
+        {59,-0x1.c1e01130341ap-18,0x1.1f3e16d0c28c2p-17},
+        {60,-0x1.13f75c97cb30ep-19,-0x1.80b2e9b2766a4p-19},
+        {61,0x1.5309503949ab8p-23,-0x1.dcd63453b79bcp-25},
+        {57,-0x1.222af95ca1e2ep-21,0x1.3a8ebc2686836p-19},
+        {58,-0x1.0d9a90b6d70f7p-17,-0x1.09ce42ef3dedap-18},
+        {59,0x1.4a49bc0884b7cp-17,-0x1.90b96fe95ef3cp-17},
+        {60,0x1.3884b9c114274p-17,0x1.9b00779fc4be3p-17},
+        {61,-0x1.0d71380e44062p-17,0x1.dfb63b8483428p-19},
+        {62,-0x1.cd6980475d5cap-22,-0x1.301e42982366p-19},
+        {58,0x1.57780d5484b0dp-22,0x1.ef65f4c33dfecp-23},
+        {59,-0x1.8e70cabba1e45p-19,0x1.7f3d1b1e7f787p-19},
+        {60,-0x1.9f9dbb7ced972p-18,-0x1.3922a7ee87c2cp-17},
+        {61,0x1.f5548d5a23744p-17,-0x1.aed9b4bc2aeecp-18},
+        {62,0x1.ab69813cc3418p-19,0x1.d1266d629c807p-17},
+        {63,-0x1.e337af7af2a76p-18,0x1.61f420afd4e56p-22},
+        {64,0x1.c67d6da33651ep-23,-0x1.a476e7dd3be1ep-20},
+        {60,0x1.d5d1197ead2e1p-22,0x1.f8fde225b0e2fp-21},
+        {61,-0x1.72d54f6bdeaecp-18,0x1.d3519cfcc635cp-20},
+        {62,-0x1.2be15b9ebe607p-19,-0x1.a80091b1b967p-17},
+        {63,0x1.142507b4dda5ap-16,-0x1.8c3bb6cc2490ep-21},
+        {64,-0x1.2d5b8001bcac2p-20,0x1.b817b47e7b945p-17},
+        {65,-0x1.92db87083cbd8p-18,-0x1.60e1a60670acp-20},
+        {66,0x1.af7f0d03ee0ffp-22,-0x1.2b7077555e53cp-20},
+        {62,0x1.0d1b65d0c90e7p-24,0x1.dfba8217ebeccp-20},
+        {63,-0x1.e377d70d83e9ep-18,-0x1.69c7e21472f32p-22},
+        {64,0x1.de81dd31f5194p-20,-0x1.ceda878315d1p-17},
+        {65,0x1.0d6a87506b334p-16,0x1.cc0ee65b1ab34p-19},
+        {66,-0x1.de9d7cfee9548p-19,0x1.8df359df72518p-17},
+        {67,-0x1.596efb769fdabp-18,-0x1.0f080ea32e554p-19},
+        {68,0x1.db10c5aed26a7p-22,-0x1.e4bc26c231525p-21},
+        {64,-0x1.53c4f82151aa8p-21,0x1.427b585e23088p-19},
+        {65,-0x1.09030b36ca69cp-17,-0x1.3ef0cae91a75p-19},
+        {66,0x1.393ce82534d3ep-18,-0x1.cdd0fcffff5c7p-17},
+        {67,0x1.ffbfa55b84f1cp-17,0x1.833374ff24a8bp-18},
+        {68,-0x1.3634d507b9b34p-18,0x1.7297456473694p-17},
+        {69,-0x1.43e80448d1cd3p-18,-0x1.29f3544281946p-19},
+        {70,0x1.dd41dd3e5fb07p-22,-0x1.dab64f3a8c36fp-21},
+        {65,0x1.e961a8cee6fp-23,0x1.e6b8d56414cd8p-24},
+        {66,-0x1.600d8e523b414p-20,0x1.6bfce822b30bep-19},
+        {67,-0x1.0d995e009092p-17,-0x1.faecc0d51d01cp-19},
+        {68,0x1.9d4405a491c52p-18,-0x1.c477b32b5abe8p-17},
+        {69,0x1.f26e957f59e2ep-17,0x1.ba07d6876adeep-18},
+        {70,-0x1.3c8501f23917ap-18,0x1.6fcbf0f481d9ep-17},
+        {71,-0x1.51630eeb419c6p-18,-0x1.1992d6b90bffbp-19},
+        {72,0x1.c3180854a44a8p-22,-0x1.16dddc6b4319bp-20},
+        {67,0x1.4d328f2676c8ep-22,0x1.cee3e9876ae38p-23},
+        {68,-0x1.d1cfe073be02cp-20,0x1.7a714baf6ec17p-19},
+        {69,-0x1.0d2c37e6b9d2ep-17,-0x1.23803a3e7fe33p-18},
+        {70,0x1.a97f379c5ed39p-18,-0x1.c2e63928545d6p-17},
+        {71,0x1.fa4697b235fd8p-17,0x1.9ad529294347ep-18},
+        {72,-0x1.0a1acecdf8bb2p-18,0x1.846878a0afe7p-17},
+        {73,-0x1.7dee06e4ae4e4p-18,-0x1.ae6892a6ac0ffp-20},
+        {74,0x1.4a39a4d7d04d8p-22,-0x1.72930faa2ba64p-20},
+        {69,0x1.6c15081d1e6aep-22,0x1.1b42016d0717fp-22},
+        {70,-0x1.deccd4c2858a9p-20,0x1.7ba13526d057ep-19},
+        {71,-0x1.0d922a0b5ef2dp-17,-0x1.0ddac54a33b6p-18},
+        {72,0x1.5f4e55080ecaap-18,-0x1.caf9b4e4d9b6fp-17},
+        {73,0x1.09260c105396ep-16,0x1.220cf3361e248p-18},
+        {74,-0x1.2136bd5826d86p-19,0x1.a94e406478dd4p-17},
+        {75,-0x1.c2a8f6ee2262ap-18,-0x1.f85f326865284p-22},
+        {76,-0x1.dbee8259c241cp-25,-0x1.02d4aef36a846p-19},
+        {71,0x1.5b29fd141d334p-22,0x1.fb82adcd49daap-23},
+        {72,-0x1.8be326cad9398p-20,0x1.72737d14e6978p-19},
+        {73,-0x1.0bc1a76556389p-17,-0x1.874b22959690ep-19},
+        {74,0x1.8c37168c3a22fp-19,-0x1.d121ec71d00d7p-17},
+        {75,0x1.13b15311c99ap-16,0x1.327b91ef6886ap-20},
+        {76,0x1.05802f5f68a66p-20,0x1.cb0dcd3c1666ap-17},
+        {77,-0x1.034ff5ceaab6ap-17,0x1.bd82124a58cddp-20},
+        {78,-0x1.fa7a4233606d8p-21,-0x1.58bca2e19372ap-19},
+        {79,0x1.07d41be3f077ep-22,-0x1.1b1c2884b18eep-23},
+        {73,0x1.174ec55902daap-22,0x1.3e0ff6325e3c5p-23},
+        {74,-0x1.dd60ae87300b7p-21,0x1.5549fea623c96p-19},
+        {75,-0x1.fc47ff2ecf409p-18,-0x1.3e1687ef57586p-20},
+        {76,-0x1.7582fdee9825cp-22,-0x1.c0b6a5abc4c83p-17},
+        {77,0x1.0d9e280822adp-16,-0x1.c571d14a6b4ecp-19},
+        {78,0x1.75e7175abc979p-18,0x1.c8df9bc2a600cp-17},
+        {79,-0x1.0aadb94e5adaap-17,0x1.5592a00c55c9ep-18},
+        {80,-0x1.68b3edee8759cp-19,-0x1.828eb6a98e0fp-19},
+        {81,0x1.daacb41a72444p-22,-0x1.3f94a020b14e5p-21},
+        {76,-0x1.e19664e86c542p-23,0x1.19828af33264fp-19},
+        {77,-0x1.b4c47d1b516e2p-18,0x1.911011c5d68bcp-21},
+        {78,-0x1.0d9532124a1b8p-18,-0x1.831940e24937p-17},
+        {79,0x1.ca226f19af3fp-17,-0x1.1c9a2228505dap-17},
+        {80,0x1.705276d75455ap-17,0x1.76ce4bce42e89p-17},
+        {81,-0x1.9998c521bf57p-18,0x1.3d2fee35699p-17},
+        {82,-0x1.6160d94272ce6p-18,-0x1.04035608f7726p-19},
+        {83,0x1.bf4cb1a37fd9p-23,-0x1.a5fca5a4cd536p-20},
+        {78,0x1.23c41b62fef8ep-22,0x1.86cb5a7ab1cd8p-20},
+        {79,-0x1.3f2358398c8a9p-18,0x1.2f5b5ce39c786p-19},
+        {80,-0x1.d09c201448859p-18,-0x1.123aa00a1a388p-17},
+        {81,0x1.256c7a5b57626p-17,-0x1.a4df958a9e4aap-17},
+        {82,0x1.01309c6f63fd7p-16,0x1.77281f435cbd9p-18},
+        {83,-0x1.3f0574ee4d63ep-20,0x1.b7422ccfe393p-17},
+        {84,-0x1.fee8c8b4e9b96p-18,0x1.5be1fb3f5afbcp-20},
+        {85,-0x1.4837eb0f98a54p-20,-0x1.67f5a7af87afap-19},
+        {86,0x1.7a1c8daeba9acp-22,-0x1.361b47322f4e4p-22},
+        {80,0x1.e4c9b892c7b79p-22,0x1.895b66971fbb2p-21},
+        {81,-0x1.550da0717607ep-19,0x1.834aafe7ebb51p-19},
+        {82,-0x1.0d812a426e022p-17,-0x1.e87df6df6fcdp-19},
+        {83,0x1.e00ecb582995p-20,-0x1.ceddcf4eca58ap-17},
+        {84,0x1.0ff915f5f804cp-16,-0x1.70256b8218d8ep-19},
+        {85,0x1.c048ad7fb759fp-18,0x1.bfb82e3a73ea8p-17},
+        {86,-0x1.f28fa21964016p-18,0x1.da834359c11p-18},
+        {87,-0x1.24a11c4610c24p-18,-0x1.4a1e1836cf302p-19},
+        {88,0x1.47f5b43c9ea9p-22,-0x1.73d42533165b4p-20},
+        {82,0x1.4670949aaf025p-22,0x1.ba70d285d4822p-23},
+        {83,-0x1.5c71221d6794p-21,0x1.43cb5e3767228p-19},
+        {84,-0x1.c29c810da4feep-18,0x1.f94b801e5842ap-22},
+        {85,-0x1.3a3ee9c135006p-18,-0x1.70cd2fab6989ap-17},
+        {86,0x1.8879ff5b36146p-17,-0x1.6328d426571b3p-17},
+        {87,0x1.dad300a3f23ecp-17,0x1.04efb15b0acf4p-17},
+        {88,-0x1.23582d56df065p-19,0x1.a90a68a18e88dp-17},
+        {89,-0x1.fdd4c2207e226p-18,0x1.4f84d13148a94p-20},
+        {90,-0x1.919383edbb3p-20,-0x1.73335ebf2bb4ep-19},
+        {91,0x1.bbf7bf2f4866fp-22,-0x1.e41afc58d557cp-22},
+        {85,0x1.713d0788ad2f4p-22,0x1.5b37c50563f17p-20},
+        {86,-0x1.f31083101c336p-19,0x1.6a468bf04e4bp-19},
+        {87,-0x1.0a696b3aa9a0ap-17,-0x1.592adf3e73adcp-18},
+        {88,0x1.8644004b7f677p-19,-0x1.d11ba84b010c8p-17},
+        {89,0x1.104da272abc62p-16,-0x1.626dbc6a360ffp-19},
+        {90,0x1.ff7a946801a83p-18,0x1.b521f6e392eep-17},
+        {91,-0x1.c5730bcdf3742p-18,0x1.1c31017720226p-17},
+        {92,-0x1.72c62eefb0272p-18,-0x1.d3742f5918382p-20},
+        {93,-0x1.0e28fbee8140fp-23,-0x1.0cd3489072f84p-19},
+        {94,0x1.c39934756153bp-23,-0x1.9f16118599f6p-24},
+        {87,0x1.94ccad0691a96p-22,0x1.70d367a78b638p-22},
+        {88,-0x1.ddd432ed31844p-21,0x1.5556c927e7e2fp-19},
+        {89,-0x1.c3ec9ae50d984p-18,0x1.db5288a9e146ep-22},
+        {90,-0x1.61aa339f5ac74p-18,-0x1.5de996a15c1a7p-17},
+        {91,0x1.4f4c83c1f4178p-17,-0x1.8d9c6c79d4e51p-17},
+        {92,0x1.065e309f38288p-16,0x1.42ae3f4e7f42p-18},
+        {93,0x1.81460c83940ccp-20,0x1.cd7056f62003ap-17},
+        {94,-0x1.0cf51968808eap-17,0x1.2a438cc44db2ap-18},
+        {95,-0x1.d99316ebbc1d6p-19,-0x1.713d9221a0d15p-19},
+        {96,0x1.7153d14fa84bcp-22,-0x1.5b28de1744ea4p-20},
+        {90,0x1.9fb9871d68db3p-22,0x1.39653f85fe404p-20},
+        {91,-0x1.95a7447a8622ap-19,0x1.7e4d38a29f56ap-19},
+        {92,-0x1.0cadff49a82a6p-17,-0x1.ac98cc8f627p-19},
+        {93,-0x1.8f54abcfb3306p-21,-0x1.bc8c36b2b680ep-17},
+        {94,0x1.de0a850a2d908p-17,-0x1.fffa20895ec4p-18},
+        {95,0x1.abc83250d00a5p-17,0x1.40e7965c1ff1cp-17},
+        {96,-0x1.6046af197f49ap-19,0x1.a12f65c828084p-17},
+        {97,-0x1.0499203a1a47ap-17,0x1.e2a87278f5f02p-20},
+        {98,-0x1.2e00ac823b7f2p-19,-0x1.82ad31b320df5p-19},
+        {99,0x1.de7d856f64aaep-22,-0x1.d474322b8c505p-21},
+        {92,0x1.2a6e03494a2b2p-22,0x1.6cfff8fac66b2p-23},
+        {93,-0x1.6409e3fec218bp-23,0x1.1224b5f9f1946p-19},
+        {94,-0x1.548bbf77a4de7p-18,0x1.157a63fda3e66p-19},
+        {95,-0x1.fd9661dfd4b4bp-18,-0x1.bb675fd24e43dp-18},
+        {96,0x1.d745917526f2fp-19,-0x1.d0e854785acc6p-17},
+        {97,0x1.0cc589e21fd38p-16,-0x1.e011a43678b24p-19},
+        {98,0x1.497798480fa08p-17,0x1.91347a25fe00bp-17},
+        {99,-0x1.422d16e3308ffp-18,0x1.6d391bca95ddap-17},
+        {100,-0x1.e4e89044ee181p-18,0x1.97694ce2ee884p-22},
+        {101,-0x1.ad4a80fc9ceefp-20,-0x1.769a0d17e88d8p-19},
+        {102,0x1.e316806d30ae9p-22,-0x1.6e967f23f0a39p-21},
+        {95,0x1.ca8c0083dea2bp-22,0x1.100a0a9d59689p-21},
+        {96,-0x1.0f8cc9d4e0898p-20,0x1.5cd4058a8b335p-19},
+        {97,-0x1.b04c1d6c2f17fp-18,0x1.bd88b97570062p-21},
+        {98,-0x1.b26f31f3b3cf2p-18,-0x1.2b8812ab13ddp-17},
+        {99,0x1.ac9dca62c0a9bp-18,-0x1.c278d64f522a6p-17},
+        {100,0x1.13f81ffba1681p-16,-0x1.e87a8af06662cp-21},
+        {101,0x1.0bcf94cbe38c2p-17,0x1.b05d8cd00e154p-17},
+        {102,-0x1.7ce1124cddc1ap-18,0x1.4f0020c29cd39p-17},
+        {103,-0x1.d20a497522e8bp-18,-0x1.0698b8d6ef548p-23},
+        {104,-0x1.81e208ab0d9a4p-20,-0x1.7111a1bea5e62p-19},
+        {105,0x1.e2624dc9baa7cp-22,-0x1.6865c115fea36p-21},
+        {98,0x1.deb523432538ap-22,0x1.d34b2d438844cp-21},
+        {99,-0x1.e4c3f971f133ep-20,0x1.7c21fa64a222ep-19},
+        {100,-0x1.e125ac7b7d9dcp-18,-0x1.235c4e39518cap-22},
+        {101,-0x1.6f47c052e5964p-18,-0x1.56a9b390065a8p-17},
+        {102,0x1.092aa647f948ep-17,-0x1.b17144f1c9d6fp-17},
+        {103,0x1.146623e6ed791p-16,0x1.543427d3d087ep-22},
+        {104,0x1.ed60a48a81966p-18,0x1.b86ea58660dc2p-17},
+        {105,-0x1.8403603e40f9p-18,0x1.4aca7f1dad66ap-17},
+        {106,-0x1.d6ce91aece615p-18,-0x1.2fbe2ccfacfcp-28},
+        {107,-0x1.b777655b246dfp-20,-0x1.77bd84483c6e2p-19},
+        {108,0x1.e3a9bacd5cc64p-22,-0x1.ae7cac4deb384p-21},
+        {101,0x1.ad6d0b02e48aap-22,0x1.2d5e91d84872cp-20},
+        {102,-0x1.31f6b703ed296p-19,0x1.82dc85684d836p-19},
+        {103,-0x1.f29b45316af82p-18,-0x1.b77c70641952p-21},
+        {104,-0x1.56fe3e8d17042p-18,-0x1.634ee6a8252acp-17},
+        {105,0x1.0f32b3748f71ap-17,-0x1.aef3cbb5ce5ecp-17},
+        {106,0x1.1474f477e5478p-16,0x1.40194566d2461p-25},
+        {107,0x1.0d0ba63b88197p-17,0x1.afda3c03a505ep-17},
+        {108,-0x1.59aa2f0158518p-18,0x1.61fa219c1343cp-17},
+        {109,-0x1.f195bcb109054p-18,0x1.a45f30a628817p-21},
+        {110,-0x1.2f05669ce9449p-19,-0x1.82b90da519214p-19},
+        {111,0x1.b0099a1cb93d4p-22,-0x1.2aeb1cdf5e2eep-20},
+        {104,0x1.90f0f7d716d8fp-22,0x1.451d986861eecp-20},
+        {105,-0x1.3b63cc3084fabp-19,0x1.8331e5ee198b4p-19},
+        {106,-0x1.ef525f469b4eap-18,-0x1.7b0a1d71296e6p-21},
+        {107,-0x1.6fc04db64c793p-18,-0x1.5666d28732b25p-17},
+        {108,0x1.d93e87bf315bp-18,-0x1.bbd889048578ep-17},
+        {109,0x1.12e7e3364876ep-16,-0x1.b23282948c5a6p-20},
+        {110,0x1.4909c6d47a07p-17,0x1.9175813b14616p-17},
+        {111,-0x1.e447c08fda0a8p-19,0x1.8cf6c25cbdfacp-17},
+        {112,-0x1.08fe43344768p-17,0x1.3ecd1d50ee33bp-19},
+        {113,-0x1.c4d054f9569d2p-19,-0x1.7611a05733802p-19},
+        {114,0x1.68dad6a42c342p-23,-0x1.b7872e1290481p-20},
+        {115,0x1.03da2a86dc85ep-22,-0x1.127c34ce19ca4p-23},
+        {107,0x1.afd8bf379acafp-22,0x1.2b1929d17d392p-20},
+        {108,-0x1.0b282eb10f85fp-19,0x1.7fb3aad9e5f44p-19},
+        {109,-0x1.d4c15d97d258ep-18,0x1.de1aa978e199p-25},
+        {110,-0x1.b0ff3c6323034p-18,-0x1.2c9ccbf26c166p-17},
+        {111,0x1.3caf22f3fbea6p-18,-0x1.cd93a3ead1acap-17},
+        {112,0x1.07837c7b2dd66p-16,-0x1.35a156929197cp-18},
+        {113,0x1.a265c50f2efd5p-17,0x1.4abab5959165cp-17},
+        {114,-0x1.77bcc9f44182p-21,0x1.bd0701967fb04p-17},
+        {115,-0x1.0af6b690b4682p-17,0x1.51534d998346ap-18},
+        {116,-0x1.52eea43944248p-18,-0x1.178e0328c99ap-19},
+        {117,-0x1.1f9b6f1b93d1p-21,-0x1.3a1d4b19ae158p-19},
+        {118,0x1.c0a46ab040e32p-22,-0x1.f5bcbe6e744b2p-22},
+        {110,0x1.dd75dd4167e3p-22,0x1.d9bac43e8c98ep-21},
+        {111,-0x1.6afee44b71bcep-20,0x1.6db2043b9022p-19},
+        {112,-0x1.9e2c6a693d024p-18,0x1.31f58e871694ep-20},
+        {113,-0x1.f6aa0b7032c0ap-18,-0x1.cf7a363a3bc96p-18},
+        {114,0x1.7804f57f2eff4p-20,-0x1.cd457ccc99c5ap-17},
+        {115,0x1.ceab56cf082e8p-17,-0x1.167319edb8186p-17},
+        {116,0x1.fa319cde0a6a6p-17,0x1.9b1649321562ep-18},
+        {117,0x1.e9b823251370cp-19,0x1.d0b80052ebb32p-17},
+        {118,-0x1.c40e497252376p-18,0x1.1d5d0dffe6c8cp-17},
+        {119,-0x1.cf76ea72b7882p-18,-0x1.8a3447551bd75p-23},
+        {120,-0x1.1078ce3c6a4dp-19,-0x1.804e37f7641b7p-19},
+        {121,0x1.994ce5c75130ap-22,-0x1.3e9f88aa26dcep-20},
+        {113,0x1.d23ca2054f7eap-22,0x1.23c3621742b01p-21},
+        {114,-0x1.2285cc0debf2p-21,0x1.3a996a30c7592p-19},
+        {115,-0x1.3f6c1365893f4p-18,0x1.2f021466561ccp-19},
+        {116,-0x1.0d95dd8711f3ap-17,-0x1.09e21fb96ea18p-18},
+        {117,-0x1.65ddd4995cd76p-19,-0x1.a068ff6d59226p-17},
+        {118,0x1.4a4b10c0df792p-17,-0x1.90b14036b9a0ap-17},
+        {119,0x1.1464aaaac9e79p-16,0x1.5afa3222fe33fp-22},
+        {120,0x1.38869e27870d4p-17,0x1.9af8428cef97cp-17},
+        {121,-0x1.a1e9a5bb5b101p-19,0x1.97b4c25c0a17ap-17},
+        {122,-0x1.0d6d0d16572a1p-17,0x1.dfdeb2595ea8ap-19},
+        {123,-0x1.308dc538b5198p-18,-0x1.3ebde46c4fc1cp-19},
+        {124,-0x1.ce16ab1b52fd4p-22,-0x1.3029ffc1beb52p-19},
+        {125,0x1.c64dcf4bc278cp-22,-0x1.067cf2d004c62p-21},
+        {116,0x1.5aeb7eaff5ac2p-22,0x1.fa97d0a008c3ap-23},
+        {117,0x1.def99ccad6de3p-24,0x1.cdf7fd3cd31aap-20},
+        {118,-0x1.9292a5f8e0607p-19,0x1.7eb085dcb7ef3p-19},
+        {119,-0x1.f3d90b6fe3546p-18,-0x1.cf474c507ade8p-21},
+        {120,-0x1.9ccd77972fe64p-18,-0x1.3b0373f406286p-17},
+        {121,0x1.1a102858c706ep-18,-0x1.cf78a19aa437fp-17},
+        {122,0x1.f6c101396718ap-17,-0x1.a91970e4d432ap-18},
+        {123,0x1.e2b90ca219e6ep-17,0x1.f10ad54b7c26ep-18},
+        {124,0x1.9feb38c94862ep-19,0x1.d1235520ef01p-17},
+        {125,-0x1.be42c829eeb6fp-18,0x1.2230d9a697e36p-17},
+        {126,-0x1.e1ab19634399fp-18,0x1.337f927680e92p-22},
+        {127,-0x1.5e077a6f20212p-19,-0x1.83054be12657ap-19},
+        {128,0x1.d6a83b8cff4c3p-23,-0x1.a0f625ff5dfdp-20},
+        {129,0x1.2e4fd13b1b64ep-22,-0x1.7709c6d37e534p-23},
+        {120,0x1.d40452451dddap-22,0x1.ff1c0bbf1164ep-21},
+        {121,-0x1.415e08ec1d00ep-20,0x1.66b7be5e54af2p-19},
+        {122,-0x1.75022c2940a56p-18,0x1.cc2b54974870ap-20},
+        {123,-0x1.0b7ec2174a9f1p-17,-0x1.48fd314e1fe7ep-18},
+        {124,-0x1.221f64c8d8d6ap-19,-0x1.a92c31b2eb0dbp-17},
+        {125,0x1.46c3ad23a7fefp-17,-0x1.92d12288d3104p-17},
+        {126,0x1.14365db388c08p-16,-0x1.56d575cb315fap-21},
+        {127,0x1.68d34a79fdd79p-17,0x1.7c585b89e87fep-17},
+        {128,-0x1.4210d4be2f011p-20,0x1.b718a21abecdfp-17},
+        {129,-0x1.06fd3fd6debd6p-17,0x1.7e970e9d43d2dp-18},
+        {130,-0x1.90b7f83db8504p-18,-0x1.692b966ff02e2p-20},
+        {131,-0x1.94ba709333194p-20,-0x1.739848093ea3fp-19},
+        {132,0x1.b2e3a6f2a3ae5p-22,-0x1.282b786b02575p-20},
+        {133,0x1.77ac348bc36d4p-23,-0x1.221ab5ec26bbap-24},
+        {123,0x1.863146f02468bp-22,0x1.4f3c84589962cp-22},
+        {124,0x1.0b1136d3a1333p-24,0x1.dfddda08e5b18p-20},
+        {125,-0x1.84f7563a3832p-19,0x1.8045560d4788ep-19},
+        {126,-0x1.e379ffb312277p-18,-0x1.6b2dd72a10682p-22},
+        {127,-0x1.ceae74c29197ap-18,-0x1.13f9cd8ee7d66p-17},
+        {128,0x1.deccacadf5fa4p-20,-0x1.ced4e4864e1a8p-17},
+        {129,0x1.b5b4ec702acd8p-17,-0x1.35d1a1c7e31bfp-17},
+        {130,0x1.0d67512fba52ep-16,0x1.cc0260bf9ca98p-19},
+        {131,0x1.0218c4bb1a3fap-17,0x1.b43784cb74d0cp-17},
+        {132,-0x1.de6e1916bcdabp-19,0x1.8df3e0056f4a6p-17},
+        {133,-0x1.0d98991557eecp-17,0x1.062ec810ed44cp-18},
+        {134,-0x1.597b4317da47bp-18,-0x1.0ee8114ceaaf2p-19},
+        {135,-0x1.0f43c0efbeebdp-20,-0x1.5cc1949e5f01cp-19},
+        {136,0x1.daff8c60155a4p-22,-0x1.e508c74d86596p-21},
+        {127,0x1.e4ddb9bf0401ap-22,0x1.958b46bb8b0d4p-21},
+        {128,-0x1.5e53178eca95ap-21,0x1.441055fb4a7d3p-19},
+        {129,-0x1.2834d6d725deep-18,0x1.46ca89dfe2f13p-19},
+        {130,-0x1.095a10e2aec7ap-17,-0x1.46c5fe5fa0e0bp-19},
+        {131,-0x1.627d888145e48p-18,-0x1.5d7681ced933cp-17},
+        {132,0x1.3f8ac052b011dp-18,-0x1.cd611a2719e99p-17},
+        {133,0x1.edeb7d1be96d8p-17,-0x1.caa692fa6b282p-18},
+        {134,0x1.fe47dd6c6228ap-17,0x1.89938c9ab189ep-18},
+        {135,0x1.81485781a522cp-18,0x1.c7ac87c78a57ep-17},
+        {136,-0x1.3a40293d376bp-18,0x1.70c6bb2914c44p-17},
+        {137,-0x1.0c4126b2f2deep-17,0x1.9a5a07b17ef08p-19},
+        {138,-0x1.417565446f03ap-18,-0x1.2cb31fe053f1p-19},
+        {139,-0x1.d29eb15979109p-21,-0x1.53f3cbbecf356p-19},
+        {140,0x1.de7e95d6e55fcp-22,-0x1.d472290e2d854p-21},
+        {130,0x1.ea0d3caa85b95p-23,0x1.e7d37c714d086p-24},
+        {131,0x1.a57929e95604ap-22,0x1.347f86f69649p-20},
+        {132,-0x1.604d6cb22aaf4p-20,0x1.6c00a648ae41p-19},
+        {133,-0x1.65e8067a2a684p-18,0x1.fad2a3c7fce8cp-20},
+        {134,-0x1.0d943a057dee8p-17,-0x1.fb1b12b9c0bc8p-19},
+        {135,-0x1.18a90d8e8973bp-18,-0x1.7ecdfc11818c7p-17},
+        {136,0x1.9d4f9e59c055dp-18,-0x1.c46edf5d43142p-17},
+        {137,0x1.ff896de2b3cbap-17,-0x1.8400ce31683f4p-18},
+        {138,0x1.f2697d58cf572p-17,0x1.b9fb7c8242a4cp-18},
+        {139,0x1.67499fdda2a53p-18,0x1.ca3e154e22246p-17},
+        {140,-0x1.3c6c0b7b25da8p-18,0x1.6fce732e784c4p-17},
+        {141,-0x1.0ccd0acbf7d48p-17,0x1.b35dbf9e980d6p-19},
+        {142,-0x1.51707688383cp-18,-0x1.1971ededaf0d6p-19},
+        {143,-0x1.27c23ecf8772fp-20,-0x1.61d8d8e7ec194p-19},
+        {144,0x1.c2f2eb983d66dp-22,-0x1.17074b90e59b9p-20},
+        {145,0x1.a68900af9e2aap-23,-0x1.6c43410814a06p-24},
+        {134,0x1.513fa3419c99dp-22,0x1.db54efcd3d56bp-23},
+        {135,0x1.34a52ddc3d5c5p-22,0x1.7e2e87b585037p-20},
+        {136,-0x1.d9cf3d47e1a34p-20,0x1.7b27b9d2f51a8p-19},
+        {137,-0x1.850e95bb92c72p-18,0x1.950f98c265b68p-20},
+        {138,-0x1.0d03b0fc5c2bcp-17,-0x1.2810c6656e6dep-18},
+        {139,-0x1.f83cc7582e4dep-19,-0x1.897768b8b1a99p-17},
+        {140,0x1.b01df5492d0f2p-18,-0x1.c1fb42d1798dp-17},
+        {141,0x1.fede27c18562p-17,-0x1.86f89a3101ab2p-18},
+        {142,0x1.f8a111370380dp-17,0x1.a17d6f61a0338p-18},
+        {143,0x1.95db044d0fa5fp-18,0x1.c55744e46a6fep-17},
+        {144,-0x1.0ec1ae75cd1a5p-18,0x1.82a020e0a1b1ep-17},
+        {145,-0x1.0d72af6da5771p-17,0x1.160586f8ae22p-18},
+        {146,-0x1.7b72e6bf53f94p-18,-0x1.b6be949e334bbp-20},
+        {147,-0x1.ba62fa2affe26p-20,-0x1.780a9d4eef0cap-19},
+        {148,0x1.512b971f3a7d9p-22,-0x1.6ea2a2f0d6bcfp-20},
+        {149,0x1.417f5ead1e401p-22,-0x1.abd91932ad9dp-23},
+        {138,0x1.70042f82bb796p-22,0x1.22771343813d2p-22},
+        {139,0x1.0dd5153967864p-22,0x1.915fa362b3316p-20},
+        {140,-0x1.e71d903bf1e0fp-20,0x1.7c500e01bb0e8p-19},
+        {141,-0x1.8152f83290fa4p-18,0x1.a265a6cad8c4ep-20},
+        {142,-0x1.0d7f7afac033cp-17,-0x1.1280cdb2ec8bep-18},
+        {143,-0x1.20dca726cdda5p-18,-0x1.7b87f726d2982p-17},
+        {144,0x1.662ce7227988p-18,-0x1.ca57031e070a6p-17},
+        {145,0x1.e673fdc7f03bep-17,-0x1.e4ad7fc043a5ap-18},
+        {146,0x1.088a76fb9b25cp-16,0x1.29570bf9b22b3p-18},
+        {147,0x1.0ebdfd1b7a9dcp-17,0x1.af205dcd757f2p-17},
+        {148,-0x1.2c72cdd6bf938p-19,0x1.a7e58b57a8ab2p-17},
+        {149,-0x1.0480dac2d03cp-17,0x1.93c643f4a7ac2p-18},
+        {150,-0x1.c07c056a77748p-18,-0x1.14261e05a1bb4p-21},
+        {151,-0x1.6d877dfe3ae2ap-19,-0x1.823c500e87719p-19},
+        {152,-0x1.6553a16ddf93cp-25,-0x1.00bfa7b2ad098p-19},
+        {153,0x1.c5f9dd194971ap-22,-0x1.05c20db65e037p-21},
+        {142,0x1.5b78eb96ab2dap-22,0x1.fc5d80f9c81dbp-23},
+        {143,0x1.4f43291383bbep-22,0x1.6fb7d0ac50e14p-20},
+        {144,-0x1.8c2a6a70fd365p-20,0x1.727599c03c3d2p-19},
+        {145,-0x1.5cd4e23615f21p-18,0x1.0a516948274a4p-19},
+        {146,-0x1.0bbd987ee7a5p-17,-0x1.877f59ece2a29p-19},
+        {147,-0x1.768bf06aa166ep-18,-0x1.529937b9cb938p-17},
+        {148,0x1.8c5e0e60fa3c7p-19,-0x1.d11a5a05657f4p-17},
+        {149,0x1.aaf98a7798df8p-17,-0x1.41bd60206aa02p-17},
+        {150,0x1.13ad51d8e8a2fp-16,0x1.3271d7a60f93ep-20},
+        {151,0x1.745ac142fab0ap-17,0x1.73ad24ef0c76ap-17},
+        {152,0x1.05dbedf628002p-20,0x1.cb081e75035f6p-17},
+        {153,-0x1.b975e2b8ec8aap-18,0x1.260a6a4e8b754p-17},
+        {154,-0x1.034e5b52edc5p-17,0x1.bdec6e13165fep-20},
+        {155,-0x1.2877f16df3336p-18,-0x1.4688a0c8c6832p-19},
+        {156,-0x1.fafbf0fbf4bep-21,-0x1.58c5305e0948cp-19},
+        {157,0x1.b8c4ff83f961ap-22,-0x1.2240f73eac79ap-20},
+        {158,0x1.082fc7398f594p-22,-0x1.1bc22834afc2cp-23},
+        {146,0x1.1bf55c0fe0804p-22,0x1.48f195829a0f5p-23},
+        {147,0x1.b26f196e0f204p-22,0x1.289b9c66558bp-20},
+        {148,-0x1.eb0d285d285a6p-21,0x1.56e791f4b006bp-19},
+        {149,-0x1.1d897d6eb2c02p-18,0x1.504c254e427e8p-19},
+        {150,-0x1.fdb2ae7e86293p-18,-0x1.4e709b88f38p-20},
+        {151,-0x1.d4651f06594d4p-18,-0x1.0e99be65b52dp-17},
+        {152,-0x1.0bd12aaa17bbep-22,-0x1.c1a3296684ef3p-17},
+        {153,0x1.4458fdf85974ep-17,-0x1.943c4a959691dp-17},
+        {154,0x1.0e143cad1e7ecp-16,-0x1.b58f875790dd3p-19},
+        {155,0x1.dd08617b62e8ep-17,0x1.01819272ae77p-17},
+        {156,0x1.6e957dd5ba6e4p-18,0x1.c98e521df3045p-17},
+        {157,-0x1.fd7fe2df461bap-19,0x1.888594e4f7991p-17},
+        {158,-0x1.0b02640119cf6p-17,0x1.50740fdb72529p-18},
+        {159,-0x1.aed1a1af00344p-18,-0x1.cba562b3bbb9ap-21},
+        {160,-0x1.6397a2863e754p-19,-0x1.82c6a7c130d7bp-19},
+        {161,-0x1.9c1d02f5ba0aep-24,-0x1.08ac940123322p-19},
+        {162,0x1.d921243ccb1c8p-22,-0x1.39aac46300167p-21},
+        {151,0x1.e42dad0f7c01ap-22,0x1.7b451b9a18b75p-21},
+        {152,-0x1.e33332b944f36p-23,0x1.1994ca518678cp-19},
+        {153,-0x1.7e29ad4193c6dp-19,0x1.80ed545d041bdp-19},
+        {154,-0x1.b4cc8b95420bbp-18,0x1.9045e707ed01p-21},
+        {155,-0x1.0b117faa65967p-17,-0x1.4f8c3f0219c2dp-18},
+        {156,-0x1.0d78283b5d6b9p-18,-0x1.831abed1e93b3p-17},
+        {157,0x1.461876703265ap-18,-0x1.cceae9457a4a4p-17},
+        {158,0x1.ca1e7884691b8p-17,-0x1.1c91414abef8cp-17},
+        {159,0x1.122cc466f5785p-16,0x1.06825af88519ap-19},
+        {160,0x1.7052984882ecap-17,0x1.76c39afdc4695p-17},
+        {161,0x1.78e1375110e5ep-20,0x1.cd44dc0cf8064p-17},
+        {162,-0x1.997d973b7816fp-18,0x1.3d3603f5c0432p-17},
+        {163,-0x1.0a9202b650409p-17,0x1.6484c63eb999ep-19},
+        {164,-0x1.616f684085bf5p-18,-0x1.03db123e311ffp-19},
+        {165,-0x1.c832b196af92ap-20,-0x1.797804492fb67p-19},
+        {166,0x1.be4f0a1491564p-23,-0x1.a62adda51d43p-20},
+        {167,0x1.a0fa506b34c06p-22,-0x1.8fded161fd6d9p-22},
+        {155,0x1.90e38c35707a4p-22,0x1.6760ab592a36ep-22},
+        {156,0x1.23542489db5d9p-22,0x1.86fc01a9eba4dp-20},
+        {157,-0x1.76cbd10a51f4p-20,0x1.6f7417a2becdp-19},
+        {158,-0x1.3f34439d0986p-18,0x1.2f36f2beedbf2p-19},
+        {159,-0x1.035aaf3e47c1bp-17,-0x1.bf5ea09fd75f4p-20},
+        {160,-0x1.d08297fa0d74cp-18,-0x1.124335e8b5d2cp-17},
+        {161,-0x1.4ea35021b638ap-21,-0x1.bdd6e916f1355p-17},
+        {162,0x1.256fe40c9fd1cp-17,-0x1.a4d45500c2b46p-17},
+        {163,0x1.059d61b903d94p-16,-0x1.4abce1bd113a8p-18},
+        {164,0x1.012d2ef071285p-16,0x1.771b7efa7ce0bp-18},
+        {165,0x1.10eeccde51a82p-17,0x1.ae310689993a3p-17},
+        {166,-0x1.3e94e65faf512p-20,0x1.b73ed812f6c7ap-17},
+        {167,-0x1.df905cfc0a143p-18,0x1.035ca54fd63c4p-17},
+        {168,-0x1.fee6ef6aa3434p-18,0x1.5c55b56568604p-20},
+        {169,-0x1.2eb331b0b4dep-18,-0x1.408b44f4bd119p-19},
+        {170,-0x1.4882c63ed1b69p-20,-0x1.67fb46c83a689p-19},
+        {171,0x1.52e80795d517p-22,-0x1.6da286e527decp-20},
+        {172,0x1.7a6ad51941f3bp-22,-0x1.369dc84b329cep-22},
+        {159,0x1.8803a964e225cp-23,0x1.3ad5d198d759bp-24},
+        {160,0x1.e4d05e33076c8p-22,0x1.89ba2a63a943bp-21},
+        {161,-0x1.7858515f14163p-23,0x1.13594ae7dd941p-19},
+        {162,-0x1.55383cf54c63ep-19,0x1.833f0d02e46bap-19},
+        {163,-0x1.9440e802c08eap-18,0x1.5b0c691e49948p-20},
+        {164,-0x1.0d7b241884fb2p-17,-0x1.e8b7060445978p-19},
+        {165,-0x1.78154b62c2bc7p-18,-0x1.51b7d22a78ad4p-17},
+        {166,0x1.e06fc48b462d8p-20,-0x1.ced67e442644bp-17},
+        {167,0x1.6bd1d59d36fe4p-17,-0x1.7a2135ede431cp-17},
+        {168,0x1.0ff4c9559235ap-16,-0x1.70186013eb6b5p-19},
+        {169,0x1.e4661e4735b02p-17,0x1.eb7b871db90cp-18},
+        {170,0x1.c0557d0ea0cdcp-18,0x1.bfad22ebdd6e2p-17},
+        {171,-0x1.285fddfda4447p-19,0x1.a863d908dfd34p-17},
+        {172,-0x1.f2781b587e1dcp-18,0x1.da9872069a74p-18},
+        {173,-0x1.f5acab29b941dp-18,0x1.f35c30c182244p-21},
+        {174,-0x1.24b3c8c0768a7p-18,-0x1.49fcd7ab3a35bp-19},
+        {175,-0x1.409cf4bb0ea68p-20,-0x1.6690d066d273p-19},
+        {176,0x1.478e275a4715cp-22,-0x1.7406b553c9875p-20},
+        {177,0x1.89f4e03948deap-22,-0x1.577a8c937ee5bp-22},
+        {164,0x1.46d0555b04dbfp-22,0x1.bb5e2e4e0f37cp-23},
+        {165,0x1.b50f963a99bc5p-22,0x1.26050b3630a6p-20},
+        {166,-0x1.5cfac6a1f8fcp-21,0x1.43d96400f46eap-19},
+        {167,-0x1.c6129015a78b9p-19,0x1.75c20b251b6ccp-19},
+        {168,-0x1.c2a3bc96b8898p-18,0x1.f7864b52902b4p-22},
+        {169,-0x1.0b914f5d8a6b5p-17,-0x1.4788e0ef1ba59p-18},
+        {170,-0x1.3a1f71b6bd92ep-18,-0x1.70d044fdbdf65p-17},
+        {171,0x1.98f12dc9c8d1ep-19,-0x1.d11d9b9206a56p-17},
+        {172,0x1.8878f824e84ap-17,-0x1.631d7d4e6bd66p-17},
+        {173,0x1.1245201e2ec9cp-16,-0x1.00ccd0c4073ddp-19},
+        {174,0x1.dacdd1a3cb72ap-17,0x1.04e6af9984bap-17},
+        {175,0x1.b1cf366dffe76p-18,0x1.c1bc907568bfp-17},
+        {176,-0x1.231a7c3866f18p-19,0x1.a90880afa0634p-17},
+        {177,-0x1.ec891decc6278p-18,0x1.e9731c01d3e28p-18},
+        {178,-0x1.fdd3061eefce1p-18,0x1.4fff5be9a9f4ep-20},
+        {179,-0x1.3a8f16045c0d4p-18,-0x1.344ec7b08511ep-19},
+        {180,-0x1.91e61190a6873p-20,-0x1.733583b0fa0a3p-19},
+        {181,0x1.a5da3a96c31cp-23,-0x1.ab461639bba04p-20},
+        {182,0x1.bc2fa34bc9902p-22,-0x1.e4c11f106658cp-22},
+        {169,0x1.865da295649b7p-22,0x1.4f8ca5bada94ap-22},
+        {170,0x1.70df7dea63fa4p-22,0x1.5b6dc45422007p-20},
+        {171,-0x1.e776f8dd3eccbp-21,0x1.56784c367a7e2p-19},
+        {172,-0x1.f33b53e5c5fe8p-19,0x1.6a2b007e4e652p-19},
+        {173,-0x1.cf83592d27fb5p-18,0x1.85ee389d38a5cp-23},
+        {174,-0x1.0a601a6a12c4ep-17,-0x1.59466c44be783p-18},
+        {175,-0x1.34ef732760d95p-18,-0x1.73174df9d7c4bp-17},
+        {176,0x1.86728b18e7337p-19,-0x1.d112b258793bp-17},
+        {177,0x1.7d70364228c5p-17,-0x1.6c6d29085fb6cp-17},
+        {178,0x1.10490fa63ac1p-16,-0x1.62606c92297fep-19},
+        {179,0x1.ec7a78192fcbep-17,0x1.cfc154b38f23p-18},
+        {180,0x1.ff856b69d3a8p-18,0x1.b515ea53223a7p-17},
+        {181,-0x1.fd79523d15764p-21,0x1.ba277cd10e668p-17},
+        {182,-0x1.c55682aade74dp-18,0x1.1c39d15334c22p-17},
+        {183,-0x1.09347b8cc9644p-17,0x1.43cfecc7c978p-19},
+        {184,-0x1.72d545d222104p-18,-0x1.d314842ff47p-20},
+        {185,-0x1.2eda23190006ap-19,-0x1.82ae371629194p-19},
+        {186,-0x1.0fd8c8f3f765dp-23,-0x1.0ce91cefaf65cp-19},
+        {187,0x1.e4de12a60dc32p-22,-0x1.961389729a013p-21},
+        {188,0x1.c47b533f04134p-23,-0x1.a068d6ba631b6p-24},
+        {174,0x1.9922d9cd4554cp-22,0x1.7b6a62d037e3ap-22},
+        {175,0x1.5dd5e032ff596p-22,0x1.673b0af49b963p-20},
+        {176,-0x1.ee1c078452e36p-21,0x1.5741b38a3c98ep-19},
+        {177,-0x1.e92d50b567218p-19,0x1.6d0d60fbd0506p-19},
+        {178,-0x1.c6867a3538499p-18,0x1.9ddc39d928ad8p-22},
+        {179,-0x1.0c5aa338c6444p-17,-0x1.3899b856915p-18},
+        {180,-0x1.5c86bfa36c4d7p-18,-0x1.607ed78ee5b5ap-17},
+        {181,0x1.d18320f2c718ap-20,-0x1.cea17e42fdc1cp-17},
+        {182,0x1.532d3f0b2d34ap-17,-0x1.8b1b2229f5319p-17},
+        {183,0x1.0840efd24fa9p-16,-0x1.2cb513634f944p-18},
+        {184,0x1.058493d86b34ap-16,0x1.4bbb6c209559cp-18},
+        {185,0x1.45cfff068333ap-17,0x1.935b175744f12p-17},
+        {186,0x1.6002cc4bc8906p-20,0x1.ccd1ad2c6abd2p-17},
+        {187,-0x1.6da10836754e6p-18,0x1.578541f61ef4ep-17},
+        {188,-0x1.0d1dba67f1afp-17,0x1.2447ed8b8a985p-18},
+        {189,-0x1.bd6347d51be73p-18,-0x1.35f4a860b9dcp-21},
+        {190,-0x1.d30836db55d3ap-19,-0x1.72ca14280620ap-19},
+        {191,-0x1.b7568f19077dcp-21,-0x1.507bcd3f59e87p-19},
+        {192,0x1.78ea82943c0fp-22,-0x1.56266d1c065fp-20},
+        {193,0x1.8a59f8a886eecp-22,-0x1.585777c403c28p-22},
+        {179,0x1.785ce1697e1fp-22,0x1.327e130f7e615p-22},
+        {180,0x1.9f6e228acf9a5p-22,0x1.399e9baef8f0ap-20},
+        {181,-0x1.43c6cdeeee39ep-21,0x1.3ff65a7ccd18ap-19},
+        {182,-0x1.95d6b87973764p-19,0x1.7e3964f0b1fcap-19},
+        {183,-0x1.9c595ba6f7ecp-18,0x1.39916ead1d93ap-20},
+        {184,-0x1.0ca83d43fe41cp-17,-0x1.acda000e49bb9p-19},
+        {185,-0x1.b0b017d5016a7p-18,-0x1.2ccc0966925fcp-17},
+        {186,-0x1.8e5597ba5f2c3p-21,-0x1.bc879ed6206f6p-17},
+        {187,0x1.ee5d2c3bc643dp-18,-0x1.b8387321031bdp-17},
+        {188,0x1.de04af300733cp-17,-0x1.ffe6cd4f22a17p-18},
+        {189,0x1.1383d121ed778p-16,0x1.4f90b4cc3160ap-20},
+        {190,0x1.abc52a486c242p-17,0x1.40dc030cdcf9ep-17},
+        {191,0x1.598296e2cd624p-18,0x1.cb6a95b4366cbp-17},
+        {192,-0x1.6002a3450c0f4p-19,0x1.a12e32e803b02p-17},
+        {193,-0x1.e8b2a61f448c4p-18,0x1.f27f8ab6d8a4ep-18},
+        {194,-0x1.0496bfd7b4b9cp-17,0x1.e32e6f1fc22f9p-20},
+        {195,-0x1.660ae1a7820b4p-18,-0x1.fa527412502d4p-20},
+        {196,-0x1.2e30426d7eedcp-19,-0x1.82a453bd6f879p-19},
+        {197,-0x1.ac30adc0fb71p-23,-0x1.1668978b31eedp-19},
+        {198,0x1.de6a36c3b443fp-22,-0x1.d4e304108d4eap-21},
+        {199,0x1.1ffa76366eab4p-22,-0x1.529bff9e466e8p-23},
+        {184,0x1.30366aa80e5c4p-22,0x1.7be808b5f252ep-23},
+        {185,0x1.dc4c44d3ce38ep-22,0x1.df47ae20539d6p-21},
+        {186,-0x1.911426b85a38dp-23,0x1.14d08b5736cb8p-19},
+        {187,-0x1.20448789b0e57p-19,0x1.81bdb8e4c12c4p-19},
+        {188,-0x1.57fe8548bd1a8p-18,0x1.10d77e1e527e6p-19},
+        {189,-0x1.ffda505859ec6p-18,-0x1.67b42f7eefc85p-20},
+        {190,-0x1.fb616ffd94602p-18,-0x1.c1dbb933f9dd5p-18},
+        {191,-0x1.e141e57a56b91p-19,-0x1.8d7135ef681b2p-17},
+        {192,0x1.e9867b9446ebp-19,-0x1.d0b07144688c5p-17},
+        {193,0x1.7dc0e2b74438ap-17,-0x1.6c28efea48941p-17},
+        {194,0x1.0d62c6d8ac281p-16,-0x1.cc20f5b95343p-19},
+        {195,0x1.02159f161a46p-16,0x1.6e791665557a8p-18},
+        {196,0x1.45407d8f474dep-17,0x1.93aec8a067ed1p-17},
+        {197,0x1.d7b5bbf8be50ap-20,0x1.ceb602adb8eecp-17},
+        {198,-0x1.47e6c6a2b986ap-18,0x1.6a870606f19b2p-17},
+        {199,-0x1.09475026baf9ap-17,0x1.66cadec6bc372p-18},
+        {200,-0x1.e278a5bda8614p-18,0x1.4d4614df90794p-22},
+        {201,-0x1.26944f5268d6ep-18,-0x1.4840bd829ffb2p-19},
+        {202,-0x1.a29c858f02f3ep-20,-0x1.754d9bfb8a28ep-19},
+        {203,0x1.349164532d94p-24,-0x1.dc7160ba300b1p-20},
+        {204,0x1.e22e274718c8cp-22,-0x1.669501eeb92f9p-21},
+        {205,0x1.bfce5e03351d2p-23,-0x1.97f0bd0eca906p-24},
+        {189,0x1.5b0215bd25cd4p-23,0x1.f1cc670dfb5ap-25},
+        {190,0x1.cd8cad92b688ap-22,0x1.1736184b87d96p-21},
+        {191,0x1.fe1c4d25f35dfp-23,0x1.982d9ec288b9ep-20},
+        {192,-0x1.18d7f61ac0612p-20,0x1.5ec6cb708a7f4p-19},
+        {193,-0x1.df650567a07aep-19,0x1.6fae7328562dep-19},
+        {194,-0x1.b35721d7ca4f6p-18,0x1.9ec1608053c8ap-21},
+        {195,-0x1.0d618ee8a35b6p-17,-0x1.dd97f2ae5e5a3p-19},
+        {196,-0x1.ae2e4499879dcp-18,-0x1.2eaa1eb4fcd38p-17},
+        {197,-0x1.22020a8a95756p-20,-0x1.b88f22a753576p-17},
+        {198,0x1.b5f8793d174ep-18,-0x1.c125ef3eb7b74p-17},
+        {199,0x1.c19f1c9dde7fcp-17,-0x1.277c141c9988ep-17},
+        {200,0x1.141a76e376d3ep-16,-0x1.93c36a3833668p-21},
+        {201,0x1.de75e9a76f1dfp-17,0x1.fe80e55c0541cp-18},
+        {202,0x1.0735bb5203e3ep-17,0x1.b22f4b1c5907cp-17},
+        {203,0x1.0bbb73f9ce188p-23,0x1.c4f88abc03352p-17},
+        {204,-0x1.81ec16e29b4dfp-18,0x1.4bfc027621706p-17},
+        {205,-0x1.0cdf4a02463e9p-17,0x1.2bc425916a45ep-18},
+        {206,-0x1.cf3ccccce7c14p-18,-0x1.9341d515fd28ap-23},
+        {207,-0x1.11e4b4f82c0bp-18,-0x1.59aea3e3f5f2fp-19},
+        {208,-0x1.7754684cd67acp-20,-0x1.6f84910033858p-19},
+        {209,0x1.d7945287e81c4p-24,-0x1.ce960f6e93d8ep-20},
+        {210,0x1.e14cc3612f0a4p-22,-0x1.603b49b5b9cfep-21},
+        {211,0x1.ca023261c1248p-23,-0x1.aa6ba3193b8d4p-24},
+        {195,0x1.4163f467cc57dp-22,0x1.ab67632509b0cp-23},
+        {196,0x1.dccb41c409b84p-22,0x1.dcf8bc10b9644p-21},
+        {197,-0x1.e7c188b2ce20fp-24,0x1.0b1e8a6b0c97ap-19},
+        {198,-0x1.f0979e5c50abep-20,0x1.7d0e5eba2d63ep-19},
+        {199,-0x1.340d2d37bcba1p-18,0x1.3b219ee4cd05ap-19},
+        {200,-0x1.e3a22d92ac5dbp-18,-0x1.71649c2076eb6p-22},
+        {201,-0x1.0ab5dcc90bd6ap-17,-0x1.548d695f87118p-18},
+        {202,-0x1.69b66a2203895p-18,-0x1.599ebe582ad5fp-17},
+        {203,0x1.18588aba7e9ccp-21,-0x1.c80f2a185df9fp-17},
+        {204,0x1.0dd9c83e6326cp-17,-0x1.af790b1a8ba3fp-17},
+        {205,0x1.de120c2cc7a74p-17,-0x1.ffb65ffb7b528p-18},
+        {206,0x1.144cffa9c9d9ap-16,0x1.015f589fdd46cp-21},
+        {207,0x1.cc1fbaca26b84p-17,0x1.19d9e1d788366p-17},
+        {208,0x1.e3c941d3a04ep-18,0x1.ba0c8ddf2a0f4p-17},
+        {209,-0x1.1cd5d9b4d9936p-22,0x1.c176f4ae4df8cp-17},
+        {210,-0x1.891554f6b8002p-18,0x1.47a87bedb13c6p-17},
+        {211,-0x1.0cd5de4f4d7f8p-17,0x1.2cbfc188c2944p-18},
+        {212,-0x1.d3fd9f2bd0942p-18,-0x1.3a8b6ad723802p-24},
+        {213,-0x1.1df9bd6cddf2fp-18,-0x1.4fe2862513362p-19},
+        {214,-0x1.ac0db561baadp-20,-0x1.766a6178ba732p-19},
+        {215,0x1.338a547de0748p-29,-0x1.f3d9eac0489e5p-20},
+        {216,0x1.e453e2ee3eea4p-22,-0x1.a548edb52dcep-21},
+        {217,0x1.1e3db7bd99d22p-22,-0x1.4e59547f79381p-23},
+        {201,0x1.8d393f7be9c1ap-22,0x1.5ece3f5d46431p-22},
+        {202,0x1.ad21e9a5089aap-22,0x1.2d9edcf24d72p-20},
+        {203,-0x1.89ccfaa1b6aap-22,0x1.29a23aa3d3126p-19},
+        {204,-0x1.322c2ccd64ef3p-19,0x1.82d2159ed0892p-19},
+        {205,-0x1.5136e7a5dac7ep-18,0x1.19aa1806b3aa8p-19},
+        {206,-0x1.f29bc44df6218p-18,-0x1.b8a5ef3da4102p-21},
+        {207,-0x1.07ea51c7f7a34p-17,-0x1.756075d1b94fdp-18},
+        {208,-0x1.56d81c369c9b4p-18,-0x1.6353e635aa916p-17},
+        {209,0x1.9b98203be8f3ap-21,-0x1.c9b9022043f6ap-17},
+        {210,0x1.0f3853f4753bap-17,-0x1.aee553d36b3dep-17},
+        {211,0x1.da834ccec6edcp-17,-0x1.054fed2bd7229p-17},
+        {212,0x1.146f3d720b6eap-16,0x1.400ae2f44bc6ap-25},
+        {213,0x1.d926d7c59bcc8p-17,0x1.075bbcccd4607p-17},
+        {214,0x1.0d11641e56df3p-17,0x1.afcbc872c71a2p-17},
+        {215,0x1.7a0a04d2a5cdp-21,0x1.c95046cb8e7c3p-17},
+        {216,-0x1.5984189a7f52bp-18,0x1.61ff3f279a73cp-17},
+        {217,-0x1.0839281c436bap-17,0x1.723cf7a8c1221p-18},
+        {218,-0x1.f19674280941ap-18,0x1.a58865bf70899p-21},
+        {219,-0x1.4f83bf66f9c08p-18,-0x1.1bd0bd84191cp-19},
+        {220,-0x1.2f3ad39092edcp-19,-0x1.82aef96f078d4p-19},
+        {221,-0x1.7d23292a7ca27p-22,-0x1.2861fad01d15ep-19},
+        {222,0x1.afc0699de1405p-22,-0x1.2b2b60a60dfcap-20},
+        {223,0x1.8af037f9af50ep-22,-0x1.599ef424d5ab4p-22},
+        {207,0x1.a8799f01fffap-22,0x1.a4bb048de4b24p-22},
+        {208,0x1.909054bdbdf12p-22,0x1.455fe01934f1cp-20},
+        {209,-0x1.dcd2b5cfe94adp-22,0x1.317d0879963c2p-19},
+        {210,-0x1.3b9aeb4a9dd2bp-19,0x1.8325fab7a5821p-19},
+        {211,-0x1.51381d96585dap-18,0x1.19a71ff1974a8p-19},
+        {212,-0x1.ef539a00c6117p-18,-0x1.7c3b557139a4fp-21},
+        {213,-0x1.09b870471bad2p-17,-0x1.6176845ffe5e6p-18},
+        {214,-0x1.6f999457d04a6p-18,-0x1.566d1beab2204p-17},
+        {215,-0x1.3b17f83e004ap-26,-0x1.c3bbcca0107e4p-17},
+        {216,0x1.d94dd647cd436p-18,-0x1.bbca0629bdc1ep-17},
+        {217,0x1.bed1a64be8409p-17,-0x1.2af09742162fcp-17},
+        {218,0x1.12e21c8dafbcbp-16,-0x1.b21e78ef5b748p-20},
+        {219,0x1.f871bae15f95ep-17,0x1.a219231d03836p-18},
+        {220,0x1.490c4a1155c04p-17,0x1.91667c91e04e2p-17},
+        {221,0x1.701d645dc7a74p-19,0x1.d0f09b5bdddbfp-17},
+        {222,-0x1.e3f8084c6b356p-19,0x1.8cf7bf3288ce8p-17},
+        {223,-0x1.ec195baa83e3dp-18,0x1.ea6c59e5d0f38p-18},
+        {224,-0x1.08f9d937a6648p-17,0x1.3f1a1269466d4p-19},
+        {225,-0x1.9894a4d4e0246p-18,-0x1.494a3b903c8fap-20},
+        {226,-0x1.c5062fc92b7b4p-19,-0x1.75f52f1db805ap-19},
+        {227,-0x1.2160567e643f9p-20,-0x1.6088b8050fba5p-19},
+        {228,0x1.67629403874ap-23,-0x1.b7c5a1d7ee0b2p-20},
+        {229,0x1.e20f9af86e54cp-22,-0x1.659e149cb61b8p-21},
+        {230,0x1.046033ac43051p-22,-0x1.136a42b766dc2p-23},
+        {213,0x1.9921fbde78bd7p-22,0x1.7b5939cd92a54p-22},
+        {214,0x1.af8b0c1ea7016p-22,0x1.2b5d403e303f8p-20},
+        {215,-0x1.30fd08443df63p-22,0x1.208a0760e09dep-19},
+        {216,-0x1.0b601ed5633a7p-19,0x1.7fada58ab866cp-19},
+        {217,-0x1.2f72ffe1d5b3ep-18,0x1.3fc1a3d2a5afap-19},
+        {218,-0x1.d4c7cce9f51f1p-18,0x1.cb25fed8658bfp-25},
+        {219,-0x1.0d7c8a22479dp-17,-0x1.11839ca408df2p-18},
+        {220,-0x1.b0d9f752466d4p-18,-0x1.2ca6b1a9867cbp-17},
+        {221,-0x1.fb7dd7c2f144ap-20,-0x1.ad68b39a90557p-17},
+        {222,0x1.3cc6ee0341c3ap-18,-0x1.cd865d848b3e6p-17},
+        {223,0x1.7d478cab2316fp-17,-0x1.6c8804db10421p-17},
+        {224,0x1.077e5690f4a66p-16,-0x1.3592e0f4997a4p-18},
+        {225,0x1.0e937c5e1bc74p-16,0x1.a3d4cd8ad5af2p-19},
+        {226,0x1.a262c6267d3ecp-17,0x1.4aaca6928ef3dp-17},
+        {227,0x1.9995d3c0159cep-18,0x1.c4dafd42ce1bep-17},
+        {228,-0x1.768e1396ebbd2p-21,0x1.bd017559ca1d8p-17},
+        {229,-0x1.83a5955058f3p-18,0x1.4af14ccae9f68p-17},
+        {230,-0x1.0aeb3e8ee4f29p-17,0x1.5176544dcb3bp-18},
+        {231,-0x1.ed2aa2c553fcep-18,0x1.55f760dfcb808p-21},
+        {232,-0x1.53046af0a1c5p-18,-0x1.1757ecbc28f94p-19},
+        {233,-0x1.480f5829821b2p-19,-0x1.83547ea21cd0cp-19},
+        {234,-0x1.2046939a6532cp-21,-0x1.3a318896b7c0bp-19},
+        {235,0x1.69fb9d19dbc18p-22,-0x1.5fcae6122fd2ap-20},
+        {236,0x1.c0e93981ac214p-22,-0x1.f69725c9d3cbp-22},
+        {237,0x1.733d7d21763d4p-23,-0x1.1b49aa34bb778p-24},
+        {219,0x1.66c6b70502753p-22,0x1.1180d694708f6p-22},
+        {220,0x1.db169199407cp-22,0x1.e4a9e44c44ce2p-21},
+        {221,-0x1.03a2a630f75fp-26,0x1.f9534c60da46cp-20},
+        {222,-0x1.76f0c31a3ce93p-20,0x1.6f72ee0ab240ep-19},
+        {223,-0x1.ed794ae702b69p-19,0x1.6bcf24d1b629ep-19},
+        {224,-0x1.a1dd3a3547f1ap-18,0x1.2192eb54f04abp-20},
+        {225,-0x1.08f55b50aae01p-17,-0x1.3ece7057ff74cp-19},
+        {226,-0x1.f3be7d474736cp-18,-0x1.d7228cbbf1d56p-18},
+        {227,-0x1.187644f0d16bcp-18,-0x1.7ed69f5b09298p-17},
+        {228,0x1.a1f52d9200e94p-20,-0x1.cde9f54bb911ep-17},
+        {229,0x1.16222d5735562p-17,-0x1.abe7967ab4164p-17},
+        {230,0x1.d2216dd9a4e27p-17,-0x1.118b4d46e227cp-17},
+        {231,0x1.13b678dde83c6p-16,-0x1.27c3e07ad4653p-20},
+        {232,0x1.f77d30cb17d54p-17,0x1.a5f21d26ef565p-18},
+        {233,0x1.538dd545eb474p-17,0x1.8ad71773c55b6p-17},
+        {234,0x1.d3ebfb8ab74cp-19,0x1.d0e199cd870cep-17},
+        {235,-0x1.6e8495543a6bp-19,0x1.9f29d7f1d70b5p-17},
+        {236,-0x1.c854b6c30a658p-18,0x1.19985d80b9b94p-17},
+        {237,-0x1.0d77416f56c4bp-17,0x1.e93cbc6105cc6p-19},
+        {238,-0x1.cc2f1027b034ep-18,-0x1.155e0ee9190fp-22},
+        {239,-0x1.2931632fb9d85p-18,-0x1.45caa19548d94p-19},
+        {240,-0x1.09888e28836e8p-19,-0x1.7f741bcffe572p-19},
+        {241,-0x1.4d340815c2aa2p-22,-0x1.2381fe00b0e0ap-19},
+        {242,0x1.a0c379b84064fp-22,-0x1.387f525a811cap-20},
+        {243,0x1.aa5b2effdbd72p-22,-0x1.aa36e486f0992p-22},
+        {225,0x1.e51d880207f02p-23,0x1.ddc11df68d082p-24},
+        {226,0x1.d5450f28240ccp-22,0x1.2ca0dbe32354ap-21},
+        {227,0x1.42d63684a2ecep-22,0x1.76979e575249p-20},
+        {228,-0x1.3483181ba04ap-21,0x1.3d83b8cbd5b78p-19},
+        {229,-0x1.3ece42474e472p-19,0x1.8336abe994d6dp-19},
+        {230,-0x1.43afdd79b932ep-18,0x1.2a0ee3f0e4159p-19},
+        {231,-0x1.dc1938508bf6ep-18,-0x1.220158a9aef87p-23},
+        {232,-0x1.0d7ba6af87ef6p-17,-0x1.11779b8df4e48p-18},
+        {233,-0x1.bc413da1bb6c8p-18,-0x1.23bec1150ad34p-17},
+        {234,-0x1.53f7257a498adp-19,-0x1.a2c7a99819b6ap-17},
+        {235,0x1.db4dac5564c1ep-19,-0x1.d0d0cf081c55ep-17},
+        {236,0x1.4f5a4eb1e63e1p-17,-0x1.8d817cf019134p-17},
+        {237,0x1.f1d3373b42e6p-17,-0x1.bc068f11adff3p-18},
+        {238,0x1.14468b728de6dp-16,0x1.124e2cebf54f2p-21},
+        {239,0x1.e0eec3935bf11p-17,0x1.f6a097dd53342p-18},
+        {240,0x1.3342c76475566p-17,0x1.9dc1837e3346p-17},
+        {241,0x1.62326cd9a02eep-19,0x1.d0d23543ff39cp-17},
+        {242,-0x1.b2e7f7f9a5772p-19,0x1.9504d2d6e28afp-17},
+        {243,-0x1.d4211b6c25c09p-18,0x1.0ecb1181ccafep-17},
+        {244,-0x1.0d3b7a72c6ceap-17,0x1.d0e1c20a920a5p-19},
+        {245,-0x1.ca9c3905b4522p-18,-0x1.3bba9a4cc38eep-22},
+        {246,-0x1.2c2e4e1207619p-18,-0x1.42f088ec7b6c2p-19},
+        {247,-0x1.16bb824e96944p-19,-0x1.80e45458ef135p-19},
+        {248,-0x1.aceb951e611fap-22,-0x1.2d057fa8e1408p-19},
+        {249,0x1.7d85b53c9e176p-22,-0x1.53065a6f001f2p-20},
+        {250,0x1.c2722947c3fe4p-22,-0x1.fcad40465f214p-22},
+        {251,0x1.98e74c7b6c849p-23,-0x1.5575348036566p-24},
+        {232,0x1.5b6c8418acfa3p-22,0x1.fbfd1d514fbfp-23},
+        {233,0x1.e2c4cf27fd626p-22,0x1.b7e9ee07ec75p-21},
+        {234,0x1.db5dcb777631ep-24,0x1.ce3c50d4a1927p-20},
+        {235,-0x1.11b7b554a0971p-20,0x1.5d3f34346c801p-19},
+        {236,-0x1.92d03b63b7d98p-19,0x1.7e9737b1d1f4ep-19},
+        {237,-0x1.6c984db808665p-18,0x1.e6847c7367bbfp-20},
+        {238,-0x1.f3d94d25ec4d6p-18,-0x1.d09f61814b7dap-21},
+        {239,-0x1.0b60579a3e4fep-17,-0x1.4a51b6fb73e5ap-18},
+        {240,-0x1.9ca3b5b9067b2p-18,-0x1.3b0d0627b9063p-17},
+        {241,-0x1.ec88f992f844ap-20,-0x1.ae3e93ad1e04p-17},
+        {242,0x1.1a2be4feeb149p-18,-0x1.cf6ab4b73fd6cp-17},
+        {243,0x1.5d9ea7be14c88p-17,-0x1.842b663ae982ep-17},
+        {244,0x1.f6b79aae4ad38p-17,-0x1.a90433d65a783p-18},
+        {245,0x1.14333b5bf217ap-16,0x1.4d9a235de1ca4p-21},
+        {246,0x1.e2b122ed4b04ap-17,0x1.f0f2682e7409cp-18},
+        {247,0x1.3bf4eba4958b2p-17,0x1.99025c734d38ap-17},
+        {248,0x1.a029f69418b4ep-19,0x1.d116c32d86daap-17},
+        {249,-0x1.6f12cd73368f3p-19,0x1.9f14748d8d97ap-17},
+        {250,-0x1.be1b08542ae1fp-18,0x1.223c7c205e2e2p-17},
+        {251,-0x1.0d663fa18d71ep-17,0x1.170e581b95ccap-18},
+        {252,-0x1.e1af8b505ffcbp-18,0x1.3621b0a61ef4dp-22},
+        {253,-0x1.5083441cd9c0cp-18,-0x1.1a86a7de8a01cp-19},
+        {254,-0x1.5e45813dbd594p-19,-0x1.82f31d63c64bcp-19},
+        {255,-0x1.9858f9572656dp-21,-0x1.4c5839aa2061ep-19},
+        {256,0x1.d529e4019993ep-23,-0x1.a13db71e12b5cp-20},
+        {257,0x1.e39331f3f0907p-22,-0x1.7339b2f6e93bap-21},
+        {258,0x1.2edd966bee9e8p-22,-0x1.78406839a7f08p-23},
+        {239,0x1.89eb1a7156d42p-22,0x1.574813195436p-22},
+        {240,0x1.d3d641934497cp-22,0x1.ffb24832d72dep-21},
+        {241,0x1.c8860810c477ap-28,0x1.f26abf7b65388p-20},
+        {242,-0x1.41d0f7545a142p-20,0x1.66c0ecd67966cp-19},
+        {243,-0x1.ac5dee7fabf2dp-19,0x1.7aba9ef3e3524p-19},
+        {244,-0x1.751744141259dp-18,0x1.cba31846ba436p-20},
+        {245,-0x1.f6323de7ec134p-18,-0x1.fea71fcaf39cap-21},
+        {246,-0x1.0b7235a42741cp-17,-0x1.4924df3f160b1p-18},
+        {247,-0x1.a3511a149a8a8p-18,-0x1.3675559221738p-17},
+        {248,-0x1.21c59e9ffb7aep-19,-0x1.a92965642031dp-17},
+        {249,0x1.e75ff9037edbbp-19,-0x1.d0b090bf95672p-17},
+        {250,0x1.46c6bb5d67236p-17,-0x1.92bfc6516e642p-17},
+        {251,0x1.e5eac9c46c07cp-17,-0x1.e64d297859516p-18},
+        {252,0x1.142f96d75ae12p-16,-0x1.56c32573f3adap-21},
+        {253,0x1.f9f84addf4f6ap-17,0x1.9bc0fdd914a26p-18},
+        {254,0x1.68d404ccc52b2p-17,0x1.7c474852329ccp-17},
+        {255,0x1.401887091c7f8p-18,0x1.cd4b3526e1185p-17},
+        {256,-0x1.41632c55f04f5p-20,0x1.b713857e886adp-17},
+        {257,-0x1.7c9162a88c91ep-18,0x1.4f18f8f6e8c9ep-17},
+        {258,-0x1.06eeaf0bdab8ap-17,0x1.7ebc2fafcbd32p-18},
+        {259,-0x1.029e19e5fe39cp-17,0x1.abeb412d120c9p-20},
+        {260,-0x1.90c9d13cfd1eep-18,-0x1.68983135c4faep-20},
+        {261,-0x1.e52a3682db6bcp-19,-0x1.6e1c84b8545p-19},
+        {262,-0x1.9532c79621f64p-20,-0x1.739b286226788p-19},
+        {263,-0x1.427b18d2aa564p-23,-0x1.100e302ba3013p-19},
+        {264,0x1.b28f2e3e3aeb4p-22,-0x1.2877d8c4865b4p-20},
+        {265,0x1.ae4b9c4e28606p-22,-0x1.b6108bede0377p-22},
+        {266,0x1.78f2fdf4e5057p-23,-0x1.23aaf789c90c5p-24},
+        {246,0x1.8caa0293897cap-22,0x1.5d76c47507254p-22},
+        {247,0x1.d5d4fa2205408p-22,0x1.f8efb9e1cc966p-21},
+        {248,0x1.5c46c97032d58p-25,0x1.e73cdb182eebfp-20},
+        {249,-0x1.22acfe926d75p-20,0x1.60c89aa4bb18cp-19},
+        {250,-0x1.8dad3576960d6p-19,0x1.7f38bfd63b909p-19},
+        {251,-0x1.60d63b61985b6p-18,0x1.049c0ef97f49p-19},
+        {252,-0x1.e68c3c6b21281p-18,-0x1.ce932f557ef8cp-22},
+        {253,-0x1.0d737c910bd58p-17,-0x1.136bd806a24d5p-18},
+        {254,-0x1.c9f1a8741b765p-18,-0x1.18277d13634c4p-17},
+        {255,-0x1.c16a9366f9957p-19,-0x1.92b265f37e48ap-17},
+        {256,0x1.072682e26914fp-19,-0x1.cf5d8614925aap-17},
+        {257,0x1.0b943cb2be5b6p-17,-0x1.b063d5f51357cp-17},
+        {258,0x1.ba05a72d65c64p-17,-0x1.30b196b1363bcp-17},
+        {259,0x1.0ea3daca39986p-16,-0x1.a14b7c721399p-19},
+        {260,0x1.0c8653dcfda46p-16,0x1.e684619e9b072p-19},
+        {261,0x1.ae8cd0021c80ep-17,0x1.3dc9b5c75c944p-17},
+        {262,0x1.f82ebda9bb567p-18,0x1.b66aec95fd4d3p-17},
+        {263,0x1.931d2b1a53848p-20,0x1.cdaaae5cc250bp-17},
+        {264,-0x1.f02d67d8f54ecp-19,0x1.8ad57516a5b63p-17},
+        {265,-0x1.d5cd11063aa4cp-18,0x1.0d2a82bb3eb7p-17},
+        {266,-0x1.0d8b56e17fdc6p-17,0x1.fbc8e1c2a6c44p-19},
+        {267,-0x1.de3894b237dbcp-18,0x1.9dc4306ae6461p-23},
+        {268,-0x1.54c4f7ec5b842p-18,-0x1.1509e99fceb5fp-19},
+        {269,-0x1.76fdb4ef1d8eep-19,-0x1.817e9ac528e56p-19},
+        {270,-0x1.034ea74a8464ep-20,-0x1.5a0ff43fcd9a1p-19},
+        {271,0x1.9996ab55f72dp-24,-0x1.d3ee464146b43p-20},
+        {272,0x1.dda94581d1888p-22,-0x1.d8c665b8af37p-21},
+        {273,0x1.7be68f636445ap-22,-0x1.397bd6c8880ccp-22},
+        {253,0x1.5b75ceb4c7ec8p-22,0x1.fc0f20b324217p-23},
+        {254,0x1.e4e211a8b528ep-22,0x1.9622e938326d8p-21},
+        {255,0x1.cd779a548df32p-23,0x1.a2e4fbbc366dp-20},
+        {256,-0x1.5f27a25d19285p-21,0x1.4425e09553b82p-19},
+        {257,-0x1.2fb9215b2e488p-19,0x1.82ae876631eb6p-19},
+        {258,-0x1.28523a8edd1e1p-18,0x1.4694d2c85e8f2p-19},
+        {259,-0x1.b877b75bbe979p-18,0x1.69d7fd7ede17dp-21},
+        {260,-0x1.095474fce7d74p-17,-0x1.47241784723dp-19},
+        {261,-0x1.007a6d698d5bep-17,-0x1.b058076555f07p-18},
+        {262,-0x1.624dc2b83a65cp-18,-0x1.5d7d71cc56e22p-17},
+        {263,-0x1.e11eeba2fb88ap-21,-0x1.babd19efd1cdap-17},
+        {264,0x1.3fa6e14ee1084p-18,-0x1.cd5144d44d4bep-17},
+        {265,0x1.5e548eadc839ep-17,-0x1.83ac5ab222507p-17},
+        {266,0x1.ede1f46ec0456p-17,-0x1.ca8dc3969565ep-18},
+        {267,0x1.143ef25e29159p-16,-0x1.2678fe5135a7p-21},
+        {268,0x1.fe3cff8e4293p-17,0x1.897df9dfe1c1cp-18},
+        {269,0x1.7a9eea81e3a3dp-17,0x1.6ea9e6b7f0fcp-17},
+        {270,0x1.816095d868c52p-18,0x1.c79bba129f868p-17},
+        {271,-0x1.1903786b8692cp-26,0x1.c3bb37f3e0a86p-17},
+        {272,-0x1.3a0fa1a2901b2p-18,0x1.70cb7c54ee1dp-17},
+        {273,-0x1.f0c7bc495a8a7p-18,0x1.dec1fbf654126p-18},
+        {274,-0x1.0c39732f24ccp-17,0x1.9ab6a798500d4p-19},
+        {275,-0x1.ccb9bd5b18cfep-18,-0x1.077f1d656b17ap-22},
+        {276,-0x1.4190d76d78976p-18,-0x1.2c770b0c21619p-19},
+        {277,-0x1.5c081aafe12bp-19,-0x1.83041950865bap-19},
+        {278,-0x1.d3818314fe1acp-21,-0x1.5404a2dbd24bcp-19},
+        {279,0x1.0223c2a8869c3p-23,-0x1.ca9b18a5d7536p-20},
+        {280,0x1.de633b1863ea4p-22,-0x1.d50ee13457595p-21},
+        {281,0x1.80237ab2fa4e6p-22,-0x1.422d4122774fp-22},
+        {260,0x1.fac5670717f64p-23,0x1.049f274c76a6ap-23},
+        {261,0x1.c8dd6bc9628bdp-22,0x1.0bfea7eeaaabap-21},
+        {262,0x1.9cd93c82b6f8p-22,0x1.3bb9c7be892bp-20},
+        {263,-0x1.428c9ca1eeb43p-23,0x1.100dd5b89becep-19},
+        {264,-0x1.6e5e42b973c16p-20,0x1.6e26dac05f021p-19},
+        {265,-0x1.b1669d5c7c99cp-19,0x1.79d29cceda648p-19},
+        {266,-0x1.6ab5d1acbf507p-18,0x1.ec36423d53acep-20},
+        {267,-0x1.e768c498a82dp-18,-0x1.eabcccf626c98p-22},
+        {268,-0x1.0d8d5f4e784cp-17,-0x1.0641a9cb8156cp-18},
+        {269,-0x1.d9786e4fec63cp-18,-0x1.0989e18d7547ap-17},
+        {270,-0x1.0fabc191605bp-18,-0x1.8237436ecdf5bp-17},
+        {271,0x1.7ac78422ec46cp-21,-0x1.c94c28e0382dcp-17},
+        {272,0x1.aa30cd1faa3a6p-18,-0x1.c2b8b1fe5434ep-17},
+        {273,0x1.86ecb52c61929p-17,-0x1.6466f0af7509bp-17},
+        {274,0x1.0130f3b66ffbfp-16,-0x1.76bba9ad21259p-18},
+        {275,0x1.14285fade5836p-16,0x1.66fdefd6321d4p-21},
+        {276,0x1.eef57a1776a84p-17,0x1.c69ec612c42c2p-18},
+        {277,0x1.650b64dad886dp-17,0x1.7efc7670cb98p-17},
+        {278,0x1.5a3d5500077bep-18,0x1.cb5213e16922fp-17},
+        {279,-0x1.a6e9559efe99ep-22,0x1.c02d0ed203ec2p-17},
+        {280,-0x1.44995396e064p-18,0x1.6c057dfc6a45fp-17},
+        {281,-0x1.f23ffc0c59d15p-18,0x1.daf78b9b1ff3p-18},
+        {282,-0x1.0c6761d5d314cp-17,0x1.a25819a2cd846p-19},
+        {283,-0x1.d1ba4b7598f54p-18,-0x1.11a1e1233bb5ep-23},
+        {284,-0x1.4c6ccd1238ea2p-18,-0x1.1f9a939356e04p-19},
+        {285,-0x1.77b04eb796e1ep-19,-0x1.816e0c09408eap-19},
+        {286,-0x1.1aae8432466b2p-20,-0x1.5f2299ab9cf65p-19},
+        {287,0x1.cbb09e45e20fdp-27,-0x1.f03a9a70520d1p-20},
+        {288,0x1.c88e4f9550078p-22,-0x1.101e8767a9c5ep-20},
+        {289,0x1.a9bb249fae121p-22,-0x1.a84e55c83e648p-22},
+        {290,0x1.96f0410bb7c22p-23,-0x1.522c05a2606d6p-24},
+        {268,0x1.51d84f2e89ecp-22,0x1.dce5ec866e73ap-23},
+        {269,0x1.e393fc1cbdf3ap-22,0x1.73278c3f0a876p-21},
+        {270,0x1.33ec304342592p-22,0x1.7e83248c1f7c4p-20},
+        {271,-0x1.b841e64aaac38p-22,0x1.2e15071a36c32p-19},
+        {272,-0x1.da59effbc55bfp-20,0x1.7b25270a8cdp-19},
+        {273,-0x1.ef243c95459dp-19,0x1.6b4bd64be73e9p-19},
+        {274,-0x1.852437fef839ap-18,0x1.946f4c00602c8p-20},
+        {275,-0x1.f5c807b852b1ap-18,-0x1.f6c0b21029052p-21},
+        {276,-0x1.0cf716537945ap-17,-0x1.283ed024049e6p-18},
+        {277,-0x1.cb3a01f5986d2p-18,-0x1.16feec558cbcap-17},
+        {278,-0x1.f7d553a001094p-19,-0x1.89792ed2ee0b2p-17},
+        {279,0x1.fb37ba094cp-21,-0x1.cacc23fa9759cp-17},
+        {280,0x1.b0349471b289ap-18,-0x1.c1e8dd6e29ddep-17},
+        {281,0x1.84e903087d8ddp-17,-0x1.6620a4fa6d3a4p-17},
+        {282,0x1.fed2975b17d0fp-17,-0x1.86e1e30c92ad7p-18},
+        {283,0x1.14644597db7cbp-16,0x1.d95fed6e9b7e3p-23},
+        {284,0x1.f8960b2121506p-17,0x1.a1654ca28a707p-18},
+        {285,0x1.79f219e3f310cp-17,0x1.6f327b3fbae73p-17},
+        {286,0x1.95f35e70023cep-18,0x1.c54530f397ffep-17},
+        {287,0x1.348b3b70fc6d8p-21,0x1.c866b12b1a1f6p-17},
+        {288,-0x1.0e8df2ace7b74p-18,0x1.82a2d8875deb6p-17},
+        {289,-0x1.d5073c95def7ep-18,0x1.0de569090f0cap-17},
+        {290,-0x1.0d66ec22222e9p-17,0x1.16344cd8e6b94p-18},
+        {291,-0x1.efca85efbac86p-18,0x1.8548d632e1fbp-21},
+        {292,-0x1.7b89c773d661dp-18,-0x1.b622a84d4fa4p-20},
+        {293,-0x1.db48eeb2e153fp-19,-0x1.70b055020052p-19},
+        {294,-0x1.baec2cdda6aeap-20,-0x1.780aab95185d6p-19},
+        {295,-0x1.6ca1ba615406cp-22,-0x1.26b60afc8af2p-19},
+        {296,0x1.5082c2613568ap-22,-0x1.6ef7d74e326e5p-20},
+        {297,0x1.e0b2d83951ad4p-22,-0x1.5c34763ef0469p-21},
+        {298,0x1.421d68b9e4baap-22,-0x1.ad56feebaa1f4p-23},
+        {276,0x1.77c4ce976a99cp-22,0x1.31311a81ecd6ep-22},
+        {277,0x1.e447d709f1f9bp-22,0x1.a64e5d9d1889ep-21},
+        {278,0x1.f7c66e698e779p-23,0x1.9993faea24909p-20},
+        {279,-0x1.10cd54d8226dap-21,0x1.378d7b68babcep-19},
+        {280,-0x1.f7e5a50fbe7f4p-20,0x1.7d949b566d998p-19},
+        {281,-0x1.f974894caa0f2p-19,0x1.68379709efe2bp-19},
+        {282,-0x1.863d0721c0aa8p-18,0x1.906d1c1504256p-20},
+        {283,-0x1.f41a82f743ce7p-18,-0x1.d60837e0d2711p-21},
+        {284,-0x1.0d4b3d0bc888ap-17,-0x1.1bd4d2387429bp-18},
+        {285,-0x1.d5dba1d1f3a2dp-18,-0x1.0d164d8ad703cp-17},
+        {286,-0x1.17786f4dd19f9p-18,-0x1.7f32dc6ba7da9p-17},
+        {287,0x1.0b295777cd6d3p-22,-0x1.c5f367dea1d4cp-17},
+        {288,0x1.73e6eb158d00ep-18,-0x1.c8fbbfb4ea7dcp-17},
+        {289,0x1.66d2f58c9c759p-17,-0x1.7db4c71ab43abp-17},
+        {290,0x1.ea3c218725406p-17,-0x1.d77aff0f1d882p-18},
+        {291,0x1.1363791684e49p-16,-0x1.62001ac776aecp-20},
+        {292,0x1.0748312e4fbb5p-16,0x1.37d95d204a1bfp-18},
+        {293,0x1.a72c32a030e29p-17,0x1.45b05960fde3cp-17},
+        {294,0x1.080e105ed75e1p-17,0x1.b1ce7eeaeb34ap-17},
+        {295,0x1.4fbc1488948acp-19,0x1.d09b9b2c936f8p-17},
+        {296,-0x1.42b6f925598ap-19,0x1.a504a79ca76d8p-17},
+        {297,-0x1.91b0d3d74f75ap-18,0x1.4237b598eaa96p-17},
+        {298,-0x1.05a690819c9b8p-17,0x1.89fc57146af96p-18},
+        {299,-0x1.080c1000c63ep-17,0x1.2c9c1e6f05182p-19},
+        {300,-0x1.bc15476ab2bp-18,-0x1.4360e5ff610acp-21},
+        {301,-0x1.394fdde084debp-18,-0x1.358cde4e62c88p-19},
+        {302,-0x1.63dcfb39bf7f8p-19,-0x1.82b177731b9b3p-19},
+        {303,-0x1.14000478faa98p-20,-0x1.5db85a2cf4eaep-19},
+        {304,-0x1.f7558516a14ep-27,-0x1.f9273ca603e7ap-20},
+        {305,0x1.b76ca79e866ebp-22,-0x1.239d40661836ep-20},
+        {306,0x1.c13529e868fdp-22,-0x1.f7a3afc96166ap-22},
+        {307,0x1.fa1461dbac01cp-23,-0x1.03e14c3d0a05cp-23},
+        {284,0x1.5c169e016b1fbp-22,0x1.fe13a203cc9b3p-23},
+        {285,0x1.e34a1534ada86p-22,0x1.700f2b77dd25p-21},
+        {286,0x1.4e8f123e8b7a4p-22,0x1.70120d59ec162p-20},
+        {287,-0x1.38243815d0ae2p-22,0x1.2147aae5034f9p-19},
+        {288,-0x1.8cb8f88217f3p-20,0x1.7279c838d02ecp-19},
+        {289,-0x1.adfb9f684ce74p-19,0x1.7a6b5dce51cdbp-19},
+        {290,-0x1.5cf0df373d64p-18,0x1.0a0693c8b76b1p-19},
+        {291,-0x1.d5030f5d72677p-18,0x1.909f35a81318ap-25},
+        {292,-0x1.0bb57841984bap-17,-0x1.87e7c5dbaff5cp-19},
+        {293,-0x1.ff337ab636b4fp-18,-0x1.b5ee3ca8be1e4p-18},
+        {294,-0x1.7656fa6a51592p-18,-0x1.52a24cc76a178p-17},
+        {295,-0x1.fde9bfad1098p-20,-0x1.ad3d5236e8e4cp-17},
+        {296,0x1.8cabfa422cfcep-19,-0x1.d10b3459e964cp-17},
+        {297,0x1.11f83cff1368ep-17,-0x1.adafdb6707bep-17},
+        {298,0x1.aaf4cc0c3892cp-17,-0x1.41aaf7567b085p-17},
+        {299,0x1.07418ed80b3d1p-16,-0x1.38201e74752fap-18},
+        {300,0x1.13a54f6641178p-16,0x1.325e6388c1e78p-20},
+        {301,0x1.efe6b750789c2p-17,0x1.c31b77ab82676p-18},
+        {302,0x1.745aa9e1e5766p-17,0x1.73990a7a205e1p-17},
+        {303,0x1.9daef29c17df2p-18,0x1.c4518fbdab8b7p-17},
+        {304,0x1.0693647d1edap-20,0x1.cafcbfc7c685fp-17},
+        {305,-0x1.d5e832c45278ap-19,0x1.8f4fd8dcd545ep-17},
+        {306,-0x1.b944d00c88ff7p-18,0x1.26184794257bcp-17},
+        {307,-0x1.0a9cc0b9b3774p-17,0x1.5583385b6481ep-18},
+        {308,-0x1.034b23bffe756p-17,0x1.bec1242e2967p-20},
+        {309,-0x1.aa8c4b9ed77cp-18,-0x1.f3a05f9c687bp-21},
+        {310,-0x1.2898e946e4c9fp-18,-0x1.464c407a6bd7p-19},
+        {311,-0x1.4d25100c5cd96p-19,-0x1.83496f5816f7ep-19},
+        {312,-0x1.fbff64d8ad254p-21,-0x1.58d64182edac6p-19},
+        {313,0x1.27a0c3b549d3ap-27,-0x1.f1c38eab31ddp-20},
+        {314,0x1.b86721ab15e22p-22,-0x1.229baae445419p-20},
+        {315,0x1.c4436f81c3ceap-22,-0x1.020015857039ap-21},
+        {316,0x1.08e702a821076p-22,-0x1.1d0eaccc6a0c8p-23},
+        {292,0x1.1cad292ec68dep-22,0x1.4a613d07bd75ap-23},
+        {293,0x1.cb7d50973ac5fp-22,0x1.121013410bf55p-21},
+        {294,0x1.b2072552567d6p-22,0x1.28f91bed0b5f1p-20},
+        {295,0x1.797703f5edcf2p-28,0x1.f2c3052a007a8p-20},
+        {296,-0x1.ec164734e45a8p-21,0x1.56f9e150a66c2p-19},
+        {297,-0x1.40b868c4b12c6p-19,0x1.83370d8796888p-19},
+        {298,-0x1.1dac457f63ed8p-18,0x1.501147860081ap-19},
+        {299,-0x1.9d7cc758649aep-18,0x1.34680abba48bdp-20},
+        {300,-0x1.fdaf9e8d4f046p-18,-0x1.4f4aedfb3dfa7p-20},
+        {301,-0x1.0ccbdbd157d3fp-17,-0x1.2cf4a68cb2ff6p-18},
+        {302,-0x1.d4355fe328684p-18,-0x1.0eaa48ae9e301p-17},
+        {303,-0x1.2238313ef42c7p-18,-0x1.7ae723a18ad6fp-17},
+        {304,-0x1.08a3ddde9e2dap-22,-0x1.c19a5e40660bp-17},
+        {305,0x1.3b24988fbb98ap-18,-0x1.cd98b1f014dbcp-17},
+        {306,0x1.445cee1a6cfe8p-17,-0x1.942707ea1e48ap-17},
+        {307,0x1.cce172d13025ap-17,-0x1.18c15e1d3058p-17},
+        {308,0x1.0e0c889b6864bp-16,-0x1.b5732c90f67bap-19},
+        {309,0x1.10eec892c05f4p-16,0x1.44902c49e983ap-19},
+        {310,0x1.dcfef01a114aep-17,0x1.0171b4502b48ep-17},
+        {311,0x1.5b90dd1b61f2ap-17,0x1.85876a19214f6p-17},
+        {312,0x1.6eb2cd2d4e9ccp-18,0x1.c97b3346febbp-17},
+        {313,0x1.ed5396c8f6a36p-22,0x1.c78fd4b8fafdap-17},
+        {314,-0x1.fd0f0efb70633p-19,0x1.8887a8bdebb9ap-17},
+        {315,-0x1.c05cf667d0746p-18,0x1.2055892715dbap-17},
+        {316,-0x1.0af2ac4a08646p-17,0x1.50a43a8c3606p-18},
+        {317,-0x1.038be305f25cfp-17,0x1.c5e89470b70c4p-20},
+        {318,-0x1.aee262f44296ep-18,-0x1.ca21818c0d8bap-21},
+        {319,-0x1.317a16a6b551p-18,-0x1.3daa81191b123p-19},
+        {320,-0x1.63e5c57d90126p-19,-0x1.82aec6f45b788p-19},
+        {321,-0x1.2873fd288b508p-20,-0x1.61ecceb724eb2p-19},
+        {322,-0x1.a1d06616b20f8p-24,-0x1.08d30d1a36a9cp-19},
+        {323,0x1.90313659b9b2ap-22,-0x1.45a1ff9e77139p-20},
+        {324,0x1.d95b84cadcbcfp-22,-0x1.3a4d27ca1fc3ep-21},
+        {325,0x1.3c4a534782b88p-22,-0x1.9ca5ca5438ad6p-23},
+        {300,0x1.59ce72e0d6d0cp-23,0x1.ede86af6d9d38p-25},
+        {301,0x1.76e303e7da083p-22,0x1.2f6d15cff621bp-22},
+        {302,0x1.e4d2fb8c52762p-22,0x1.88d5e6c0fd44p-21},
+        {303,0x1.4636485e97d22p-22,0x1.74b8679a8a58bp-20},
+        {304,-0x1.188ff1e4d51dp-22,0x1.1de0cead9fa62p-19},
+        {305,-0x1.69abe34e37e64p-20,0x1.6d6a32fa534fcp-19},
+        {306,-0x1.88c7932487215p-19,0x1.7fc1aabd53f8cp-19},
+        {307,-0x1.41d48ed76c3d8p-18,0x1.2c1f00e9fe4c3p-19},
+        {308,-0x1.b98b6dca96e94p-18,0x1.5e3c26d65297bp-21},
+        {309,-0x1.056289c1f1f78p-17,-0x1.fcba2a2ef395cp-20},
+        {310,-0x1.0a47587d90bd8p-17,-0x1.59f8d8fa6940ep-18},
+        {311,-0x1.bede06d1a3408p-18,-0x1.21903c212b229p-17},
+        {312,-0x1.02e02622a5d79p-18,-0x1.86f4f39ceff1ep-17},
+        {313,0x1.01e631dcd6e74p-22,-0x1.c5defcc61c79ap-17},
+        {314,0x1.5515b0f6e48b2p-18,-0x1.cbb9137e4e3c4p-17},
+        {315,0x1.4bb9cf79977dcp-17,-0x1.8fb82f4acc659p-17},
+        {316,0x1.cef6aff7ecdeep-17,-0x1.15e68f456909dp-17},
+        {317,0x1.0dd539f7e20e8p-16,-0x1.bca3cf0e97134p-19},
+        {318,0x1.11868f60166f9p-16,0x1.27bd469d90c9ep-19},
+        {319,0x1.e3aebd3d0ae2dp-17,0x1.ed98ec804a102p-18},
+        {320,0x1.69d0119e99e75p-17,0x1.7b8708e1b05cfp-17},
+        {321,0x1.98e4d1b1f3647p-18,0x1.c4e6916426771p-17},
+        {322,0x1.3f6d942f020a8p-20,0x1.cc26e1b223396p-17},
+        {323,-0x1.a1ecb8b5431c6p-19,0x1.979dcf339a9dep-17},
+        {324,-0x1.a0af2c08d716p-18,0x1.383f3e91f130ep-17},
+        {325,-0x1.05ad7bea5e984p-17,0x1.89ae8d52076c8p-18},
+        {326,-0x1.09c4886c313c4p-17,0x1.518aff31a136cp-19},
+        {327,-0x1.ce5aae0e3b672p-18,-0x1.bc643ccdfc85ep-23},
+        {328,-0x1.5bb23c41c7644p-18,-0x1.0bb89e9859f4bp-19},
+        {329,-0x1.ba18d9bf9d9d1p-19,-0x1.7826ca45342d8p-19},
+        {330,-0x1.b66521c4c905cp-20,-0x1.77894439b46e2p-19},
+        {331,-0x1.d765f764646d6p-22,-0x1.30f6f8d7f53e4p-19},
+        {332,0x1.e800ea46c22f3p-23,-0x1.9d16d162f24eep-20},
+        {333,0x1.e080a54eb7e33p-22,-0x1.c8e9a5758d4cbp-21},
+        {334,0x1.99fa3769bb4d6p-22,-0x1.7d592de26f9p-22},
+        {335,0x1.ad0812f81e254p-23,-0x1.76bcc63d70f3cp-24},
+        {309,0x1.b57ce98bf5b48p-23,0x1.854dd07b7dd5cp-24},
+        {310,0x1.98afae0221e78p-22,0x1.7a14faace298cp-22},
+        {311,0x1.e22aeb224ecfep-22,0x1.bd1d2186ef83ep-21},
+        {312,0x1.10495be4100aap-22,0x1.902773b346575p-20},
+        {313,-0x1.7d1b99132961ap-22,0x1.28594148b61c6p-19},
+        {314,-0x1.87edc8bfa54f5p-20,0x1.71d158de63378p-19},
+        {315,-0x1.95a1d2311aebep-19,0x1.7e2cc8600f5b3p-19},
+        {316,-0x1.450fba2fc365cp-18,0x1.2862d83bf8262p-19},
+        {317,-0x1.b9374e146860cp-18,0x1.61a302bcff90ep-21},
+        {318,-0x1.0491b11e93823p-17,-0x1.e3c32089f9e0ap-20},
+        {319,-0x1.0b3dc407a7342p-17,-0x1.4c109c3aa5b8ep-18},
+        {320,-0x1.ca9733ebf4b08p-18,-0x1.17884d302b642p-17},
+        {321,-0x1.1dcb30101bc32p-18,-0x1.7cadfc190edfcp-17},
+        {322,-0x1.bf7c6d007f4a5p-22,-0x1.bfecc7fb7c699p-17},
+        {323,0x1.1b489102fb534p-18,-0x1.cf556be440b99p-17},
+        {324,0x1.2caf533c19cabp-17,-0x1.a12381411276ep-17},
+        {325,0x1.b4cbba9ab5f3p-17,-0x1.36bd488e78a44p-17},
+        {326,0x1.070afb2f8287p-16,-0x1.3a7fdc15f769fp-18},
+        {327,0x1.142fb6107a574p-16,0x1.4b0423f0cabbbp-21},
+        {328,0x1.fed389b803de7p-17,0x1.86c6bda92a8b6p-18},
+        {329,0x1.99114d16815d4p-17,0x1.53d579997ce7ep-17},
+        {330,0x1.096fadcc92decp-17,0x1.b13bf6b4ba77p-17},
+        {331,0x1.a382ab0fec7dap-19,0x1.d10dea7e49666p-17},
+        {332,-0x1.73e96d3b512b2p-20,0x1.b4974a922fc99p-17},
+        {333,-0x1.4d80609ca8d6ep-18,0x1.67d07f8dacdcap-17},
+        {334,-0x1.e47948d36d63cp-18,0x1.fbd61ee9001fap-18},
+        {335,-0x1.0d5631d698358p-17,0x1.19286c3a75e6ep-18},
+        {336,-0x1.fbb96bea67c52p-18,0x1.39824ba452b1dp-20},
+        {337,-0x1.a0bd9746aa5c4p-18,-0x1.2643e3670e6f4p-20},
+        {338,-0x1.28b17b0f405a6p-18,-0x1.462fe484068aap-19},
+        {339,-0x1.6160767e7dacap-19,-0x1.82c9133dd46a3p-19},
+        {340,-0x1.385b39d446b5ap-20,-0x1.64fc476d92804p-19},
+        {341,-0x1.74e49e7ad4735p-23,-0x1.131a360a44976p-19},
+        {342,0x1.6227e3f143504p-22,-0x1.64967688ffb04p-20},
+        {343,0x1.e407188ccc95ap-22,-0x1.78875a23c5e73p-21},
+        {344,0x1.721fe40b5ba44p-22,-0x1.2639ccfa9368ep-22},
+        {345,0x1.5acb1a27a10d4p-23,-0x1.f0913944c9e62p-25},
+        {318,0x1.89b6549e9ff5ep-23,0x1.3d02df9559997p-24},
+        {319,0x1.81f57cacfaafdp-22,0x1.45e7090525c82p-22},
+        {320,0x1.e4dd49900e0a2p-22,0x1.8a77c3c6dde48p-21},
+        {321,0x1.57bac284a0fdcp-22,0x1.6aca58388a68cp-20},
+        {322,-0x1.7ba677345b95p-23,0x1.138137f80d2cfp-19},
+        {323,-0x1.3041be30a9d9cp-20,0x1.637138a83f068p-19},
+        {324,-0x1.558d753a93cf4p-19,0x1.8327b8cea40aap-19},
+        {325,-0x1.1e886071bc67ap-18,0x1.4f4f65908219fp-19},
+        {326,-0x1.94581f036a73p-18,0x1.5a45d0a95f886p-20},
+        {327,-0x1.f1fc31fe83b7cp-18,-0x1.ae40d26a232aap-21},
+        {328,-0x1.0d6f14dd7b9acp-17,-0x1.e9291f9788ac7p-19},
+        {329,-0x1.f69f1d772f356p-18,-0x1.cf2a5bb4e703ap-18},
+        {330,-0x1.77d9e9aa747f9p-18,-0x1.51c221198f0adp-17},
+        {331,-0x1.428f7aae2762dp-19,-0x1.a504c7347354ap-17},
+        {332,0x1.e131adfad645ep-20,-0x1.cec7daed0a145p-17},
+        {333,0x1.b0251df3d2ab8p-18,-0x1.c1e52cea6cdb8p-17},
+        {334,0x1.6bd286d4b4dcp-17,-0x1.7a0a78930c89p-17},
+        {335,0x1.df9478df2795fp-17,-0x1.fac5829cf6232p-18},
+        {336,0x1.0fec300e3f622p-16,-0x1.6ffe49e43b77p-19},
+        {337,0x1.10c47be467e1ap-16,0x1.4bd81719e2438p-19},
+        {338,0x1.e45b12ccd79c9p-17,0x1.eb5a4ac4b0a5ep-18},
+        {339,0x1.72ddcba4fe422p-17,0x1.74ba6e167dcaap-17},
+        {340,0x1.c06f19c8d516p-18,0x1.bf970bec6e68p-17},
+        {341,0x1.10799c4882d3p-19,0x1.cf8a6ed3f2c1ep-17},
+        {342,-0x1.27e7de7a9e656p-19,0x1.a86044dc1ba8p-17},
+        {343,-0x1.6eb304f6bc144p-18,0x1.56db112f93fa2p-17},
+        {344,-0x1.f2490a3e8cd0ap-18,0x1.dac2cb071fa7p-18},
+        {345,-0x1.0d875b61b200dp-17,0x1.ff293f2bf35b1p-19},
+        {346,-0x1.f5ac5c79b8c1p-18,0x1.f535bccc690d4p-21},
+        {347,-0x1.9a172ae348221p-18,-0x1.42b643d42ccacp-20},
+        {348,-0x1.24d91de34db0bp-18,-0x1.49ba4a6b473f8p-19},
+        {349,-0x1.60df4166747e4p-19,-0x1.82cd36fcfe428p-19},
+        {350,-0x1.4136500671e5ep-20,-0x1.669d230dd93aep-19},
+        {351,-0x1.cda792caa5976p-23,-0x1.184e8d7721805p-19},
+        {352,0x1.46bea35dfe892p-22,-0x1.746bd109112ecp-20},
+        {353,0x1.e4d4552db4bf3p-22,-0x1.9995060468baap-21},
+        {354,0x1.8a8c234a31d08p-22,-0x1.58937510a7a4p-22},
+        {355,0x1.9dfc680996deap-23,-0x1.5d79806fad271p-24},
+        {328,0x1.50c60672ea344p-22,0x1.d9643c9cf4dbp-23},
+        {329,0x1.d8a749e76bc64p-22,0x1.37b81422cef8fp-21},
+        {330,0x1.ab9fbbe81368bp-22,0x1.2efaedaceb8e4p-20},
+        {331,0x1.cb6dc00d926f3p-25,0x1.e2c9b3e143734p-20},
+        {332,-0x1.78cb71b25bdb4p-21,0x1.47e4800fb089ap-19},
+        {333,-0x1.fec539897fc22p-20,0x1.7e0f2cbdef608p-19},
+        {334,-0x1.d2281dc27995bp-19,0x1.72e5f117df70ap-19},
+        {335,-0x1.5d82ba0f606fap-18,0x1.09316c1493206p-19},
+        {336,-0x1.c78ca2ca80738p-18,0x1.83901f7c0e93cp-22},
+        {337,-0x1.06a723ddf31d6p-17,-0x1.136470e7e265ep-19},
+        {338,-0x1.0ac88b2726ae2p-17,-0x1.52e017b7f36bap-18},
+        {339,-0x1.cdc67181806a8p-18,-0x1.14a63c0da318ap-17},
+        {340,-0x1.2f76025189706p-18,-0x1.755e682ffaf0bp-17},
+        {341,-0x1.0eb473aa90328p-20,-0x1.b95fd6f11fc4cp-17},
+        {342,0x1.b95295e3b9551p-19,-0x1.d0fe9227204c6p-17},
+        {343,0x1.05f79150d4b85p-17,-0x1.b29d06b11e98fp-17},
+        {344,0x1.8f09850c24d5cp-17,-0x1.5d2f9073ebcbap-17},
+        {345,0x1.f456aa8eec9bep-17,-0x1.b233080d65702p-18},
+        {346,0x1.12cee072c3489p-16,-0x1.b8c27eb7dfcfcp-20},
+        {347,0x1.0d6803c44dd22p-16,0x1.ca6919ef5f85ap-19},
+        {348,0x1.d5b3ba0bf3368p-17,0x1.0c57c06d6fb98p-17},
+        {349,0x1.618798d31f29p-17,0x1.816c93093581cp-17},
+        {350,0x1.a17a32686964ep-18,0x1.c3d2633a8c822p-17},
+        {351,0x1.ca83409968fc6p-20,0x1.ce77f75b9b9b8p-17},
+        {352,-0x1.3dae6874446e2p-19,0x1.a5a428b1d8121p-17},
+        {353,-0x1.713cc2a0c66dp-18,0x1.5574efd8f4a5p-17},
+        {354,-0x1.f115b68a981c6p-18,0x1.ddd5f5ebabc92p-18},
+        {355,-0x1.0d8602b92abecp-17,0x1.0881f3713d3p-18},
+        {356,-0x1.fa66bc029a6dp-18,0x1.2b4bf4fde2aaap-20},
+        {357,-0x1.a4bec4a8101a4p-18,-0x1.146914cf94f58p-20},
+        {358,-0x1.3432c8f95f41bp-18,-0x1.3ade2177caf9p-19},
+        {359,-0x1.83284f9602a01p-19,-0x1.80571c5f83d7bp-19},
+        {360,-0x1.7f6b42b9c1b06p-20,-0x1.70a092cea850cp-19},
+        {361,-0x1.9b39e08331d9ap-22,-0x1.2b4b7932f1ff6p-19},
+        {362,0x1.d473452eb916cp-23,-0x1.a15bdb4f674dcp-20},
+        {363,0x1.d972bd7eee18ap-22,-0x1.eb784885e4beep-21},
+        {364,0x1.b5d69a747e4e4p-22,-0x1.ce2f66b3cc262p-22},
+        {365,0x1.0eba99b88839ap-22,-0x1.29e2c3d830e3cp-23},
+        {337,0x1.bf329102ea598p-23,0x1.965af241e5474p-24},
+        {338,0x1.8f361c07151dep-22,0x1.633102192d05cp-22},
+        {339,0x1.e4ef46cfb03b5p-22,0x1.91bcf92029171p-21},
+        {340,0x1.61317d5b117c7p-22,0x1.652986e0a2da8p-20},
+        {341,-0x1.f385eb3845e08p-24,0x1.0b75f3352df2p-19},
+        {342,-0x1.03be901177293p-20,0x1.5a20e0fa9e952p-19},
+        {343,-0x1.2bac4617808dep-19,0x1.826dba656d436p-19},
+        {344,-0x1.ffe2ff0fff018p-19,0x1.66296fc2d14d6p-19},
+        {345,-0x1.70fec35325e58p-18,0x1.d890b311ed0dbp-20},
+        {346,-0x1.d445b600511d6p-18,0x1.13a4a6b87094p-24},
+        {347,-0x1.08e0c76dd81cbp-17,-0x1.3ddc5fbbfaaa8p-19},
+        {348,-0x1.09613f43a4698p-17,-0x1.6501f5a640623p-18},
+        {349,-0x1.c721400de74a2p-18,-0x1.1a8e54d3077d5p-17},
+        {350,-0x1.29d7ef1eb2346p-18,-0x1.77bc8bb6920efp-17},
+        {351,-0x1.0f502dea3c0d2p-20,-0x1.b957c6adb423bp-17},
+        {352,0x1.a7b9102778b4cp-19,-0x1.d109b76633f3ap-17},
+        {353,0x1.fad47b0e750d6p-18,-0x1.b5e2d9b373f21p-17},
+        {354,0x1.845d18cd30367p-17,-0x1.668d9f1198797p-17},
+        {355,0x1.eb1fae83e013p-17,-0x1.d440dfbfcf8d8p-18},
+        {356,0x1.111474020be8ap-16,-0x1.3d32ef8a87f7bp-19},
+        {357,0x1.107dc340f459dp-16,0x1.57e93002fbc04p-19},
+        {358,0x1.e7c650c961296p-17,0x1.dfdb2b0bd60c4p-18},
+        {359,0x1.7f5b13161b09p-17,0x1.6ac11151394e2p-17},
+        {360,0x1.eefcdbe360416p-18,0x1.b8097a4b9a2eap-17},
+        {361,0x1.8fbe1b0b8f88bp-19,0x1.d1074be421bf8p-17},
+        {362,-0x1.399a202bd88d9p-20,0x1.b766728cbcd6cp-17},
+        {363,-0x1.31ce12254ed7p-18,0x1.745bfb4993ee6p-17},
+        {364,-0x1.cbd4909acad14p-18,0x1.16670b025299p-17},
+        {365,-0x1.0a12360eea252p-17,0x1.5c850a1e9dbb6p-18},
+        {366,-0x1.08250c94eee8dp-17,0x1.2ee23004c2f28p-19},
+        {367,-0x1.d0ca5e71edf8ep-18,-0x1.3f902e382bf93p-23},
+        {368,-0x1.6c7d06893e5ecp-18,-0x1.e69ea6f0ee17p-20},
+        {369,-0x1.f6b349da7e07ap-19,-0x1.6903819d32c76p-19},
+        {370,-0x1.23c334b0ebc6cp-19,-0x1.81ed3dce02364p-19},
+        {371,-0x1.f050cb0366312p-21,-0x1.577579f4587bcp-19},
+        {372,-0x1.84c7cd306a7a6p-24,-0x1.07db89a3271b5p-19},
+        {373,0x1.6c8eca3d066c2p-22,-0x1.5e227339e48ccp-20},
+        {374,0x1.e4c5aded743dep-22,-0x1.86ac5088efa32p-21},
+        {375,0x1.8901a879d61f8p-22,-0x1.551d158fc3e7bp-22},
+        {376,0x1.b01ede496d2ecp-23,-0x1.7beaafca891ccp-24},
+        {347,0x1.f8d28e75b84acp-23,0x1.02751850d6212p-23},
+        {348,0x1.a18be1c268a58p-22,0x1.91197c577852fp-22},
+        {349,0x1.e3d0a66e4fe22p-22,0x1.ad1599f3bad4ap-21},
+        {350,0x1.4c46146ec9e48p-22,0x1.715653d65dff1p-20},
+        {351,-0x1.341433a470624p-23,0x1.0f22f1bc23fcep-19},
+        {352,-0x1.079e1dd0e842ep-20,0x1.5afe67c99307cp-19},
+        {353,-0x1.28c8c9334bdaep-19,0x1.824118f40a78dp-19},
+        {354,-0x1.f629061f8a489p-19,0x1.692b7eae964d1p-19},
+        {355,-0x1.6913d3d8e297bp-18,0x1.f0f4ba87bf7e8p-20},
+        {356,-0x1.cba30fb294255p-18,0x1.20e4397fa2442p-22},
+        {357,-0x1.06671ecd6cdaap-17,-0x1.0f3724e6ae61cp-19},
+        {358,-0x1.0bae15d3144c4p-17,-0x1.448e07863594cp-18},
+        {359,-0x1.db509cb4b475dp-18,-0x1.079b5ea43be1ep-17},
+        {360,-0x1.520e3c69ace3ep-18,-0x1.65995e6c6003ap-17},
+        {361,-0x1.023bf33239111p-19,-0x1.acd63169de316p-17},
+        {362,0x1.0a53bb729cbfcp-19,-0x1.cf64e9fe0d15cp-17},
+        {363,0x1.a37b85eb91b0ep-18,-0x1.c38ea961431dp-17},
+        {364,0x1.5add2d3b0a2cap-17,-0x1.85f8bbc138b2p-17},
+        {365,0x1.cb6296bac64d2p-17,-0x1.1abb64c2d55bep-17},
+        {366,0x1.09b2f5d5160bcp-16,-0x1.1a3fcc189ceaap-18},
+        {367,0x1.143b9a4ef9cebp-16,0x1.1fccd22d1df39p-21},
+        {368,0x1.03c00ff26652cp-16,0x1.5db66affb7b8cp-18},
+        {369,0x1.b553a649e2503p-17,0x1.361ade74bb7e8p-17},
+        {370,0x1.3dcdd0d07798fp-17,0x1.97e94f0ce1d82p-17},
+        {371,0x1.6364c2f794cdap-18,0x1.ca7f57d5e7152p-17},
+        {372,0x1.1dd9170fa397cp-20,0x1.cb74a8ddbad84p-17},
+        {373,-0x1.6a44422d9ec9dp-19,0x1.9fb212f84a57p-17},
+        {374,-0x1.773f2c24b6da8p-18,0x1.5215b0839cd7ap-17},
+        {375,-0x1.ef52f66fcaa85p-18,0x1.e2403685fa837p-18},
+        {376,-0x1.0d56cfc957242p-17,0x1.185f442302778p-18},
+        {377,-0x1.012841b954a7p-17,0x1.86e5e9874857ep-20},
+        {378,-0x1.b7c5beab6321p-18,-0x1.707bd7e2d6f19p-21},
+        {379,-0x1.50d26da923e8dp-18,-0x1.1a063bc950b27p-19},
+        {380,-0x1.c6031e4e63088p-19,-0x1.75a77009420cep-19},
+        {381,-0x1.ffc42b128f71p-20,-0x1.7e1f061cd41d3p-19},
+        {382,-0x1.98209d9d97786p-21,-0x1.4c46ad84136c2p-19},
+        {383,-0x1.7649789b40a6p-27,-0x1.f7f1276ce1864p-20},
+        {384,0x1.8739ad2131c7ap-22,-0x1.4c34a9633231cp-20},
+        {385,0x1.e3843bdc7ff64p-22,-0x1.72401618606fdp-21},
+        {386,0x1.817569703c2cep-22,-0x1.44cf56c369041p-22},
+        {387,0x1.a8b6b27e219a6p-23,-0x1.6f425b629b597p-24},
+        {357,0x1.b495422536008p-23,0x1.839320ef47eabp-24},
+        {358,0x1.8228963d6b6a5p-22,0x1.464536ce35f8cp-22},
+        {359,0x1.e2e63a0a7aa8p-22,0x1.6c2a0ec35ccfap-21},
+        {360,0x1.92d326c1ea96p-22,0x1.439e131f01422p-20},
+        {361,0x1.18a93ef8ec94fp-25,0x1.e9d45c076f8dap-20},
+        {362,-0x1.617010040c411p-21,0x1.4474dbf7e5f94p-19},
+        {363,-0x1.cf4010b8a85ap-20,0x1.7a121b3bd45b3p-19},
+        {364,-0x1.a2ad6750c2d42p-19,0x1.7c40cd14b72c7p-19},
+        {365,-0x1.3b470966be9b6p-18,0x1.335c907595db8p-19},
+        {366,-0x1.a262f18aeacfep-18,0x1.1ee01b58f06f8p-20},
+        {367,-0x1.f36740077792p-18,-0x1.c983d4f63d02ep-21},
+        {368,-0x1.0d04592c26cfep-17,-0x1.c42c3f639c343p-19},
+        {369,-0x1.025d0ddd2a88cp-17,-0x1.a3381a97a6e8ep-18},
+        {370,-0x1.a886f73fc0b72p-18,-0x1.32af91300e7f4p-17},
+        {371,-0x1.04320f6bcb976p-18,-0x1.8672a64d291f7p-17},
+        {372,-0x1.0ecddec149ac4p-21,-0x1.bf0204f839d6bp-17},
+        {373,0x1.d2bbc6ad1fep-19,-0x1.d0d4eeacf5efap-17},
+        {374,0x1.ffb979126c36p-18,-0x1.b4f5b38e60d24p-17},
+        {375,0x1.7f8f0090ac004p-17,-0x1.6a932ea605826p-17},
+        {376,0x1.e32ea4d8c6af8p-17,-0x1.ef23455e968a6p-18},
+        {377,0x1.0ea84599366e8p-16,-0x1.9fc515808e17p-19},
+        {378,0x1.12fb86d7e164cp-16,0x1.9f234935b59abp-20},
+        {379,0x1.fbef680e1e127p-17,0x1.933ca8419af1cp-18},
+        {380,0x1.a5066dcfbe2fcp-17,0x1.47dfc6db62a84p-17},
+        {381,0x1.2d0a26827e234p-17,0x1.a0ef170d5ffc6p-17},
+        {382,0x1.4794c8c709d1ep-18,0x1.ccb8e467020b6p-17},
+        {383,0x1.a7c0a1604c108p-21,0x1.c9cd3b147e538p-17},
+        {384,-0x1.7c0471de1fffep-19,0x1.9d31678cac4ep-17},
+        {385,-0x1.78f1ded3c3ce4p-18,0x1.511cfae09391dp-17},
+        {386,-0x1.eddce35d73078p-18,0x1.e5daba689643ep-18},
+        {387,-0x1.0d221f7e05b5ep-17,0x1.217c7863800a9p-18},
+        {388,-0x1.0310154d3b2dp-17,0x1.b8fb8e62c777ep-20},
+        {389,-0x1.c12df8551ef3cp-18,-0x1.0ae3ac96a1ac4p-21},
+        {390,-0x1.5f3d7643721a2p-18,-0x1.06c0006550017p-19},
+        {391,-0x1.e89ae737242d8p-19,-0x1.6d1638ba33e29p-19},
+        {392,-0x1.22742f7b92086p-19,-0x1.81d28e00d7006p-19},
+        {393,-0x1.062c678890fedp-20,-0x1.5aaae34f1e38dp-19},
+        {394,-0x1.545b07fda06a1p-23,-0x1.111ee82610905p-19},
+        {395,0x1.3c29f070d9904p-22,-0x1.7a246fd91e37fp-20},
+        {396,0x1.e156507343a26p-22,-0x1.c360732eeb793p-21},
+        {397,0x1.af9578579d149p-22,-0x1.b9dce06c0dbabp-22},
+        {398,0x1.152d7a6196ae4p-22,-0x1.388c35115ff8cp-23},
+        {368,0x1.3bae45bdeed7p-22,0x1.9ac531aea5423p-23},
+        {369,0x1.c4cd6648d17a2p-22,0x1.030adce8da0e5p-21},
+        {370,0x1.d7cdb0283eae4p-22,0x1.f1d1beeb3e822p-21},
+        {371,0x1.0e2455913adc2p-22,0x1.9124df1f3f5aep-20},
+        {372,-0x1.edb1d95197c43p-23,0x1.1a1dcd728f581p-19},
+        {373,-0x1.1c9941b896437p-20,0x1.5f7e76e1f8906p-19},
+        {374,-0x1.2c2ba193296b6p-19,0x1.8270f1e8ec363p-19},
+        {375,-0x1.edd78346f98e2p-19,0x1.6b9a1aba51236p-19},
+        {376,-0x1.5edcb2c467e1p-18,0x1.0744f99ea36edp-19},
+        {377,-0x1.be62e65abd1a6p-18,0x1.29c52e2b28576p-21},
+        {378,-0x1.019442ee0dd0ep-17,-0x1.91bc2be852893p-20},
+        {379,-0x1.0d72a62907decp-17,-0x1.10927b0e725a8p-18},
+        {380,-0x1.f6bc2e27a3509p-18,-0x1.cec02b5b53c1ep-18},
+        {381,-0x1.8e7aa6a88e758p-18,-0x1.443320c15749ap-17},
+        {382,-0x1.c61da4fdcaedbp-19,-0x1.91e09b417457p-17},
+        {383,0x1.7c362b5fb830dp-28,-0x1.c3dfd916aep-17},
+        {384,0x1.0709ebe68b185p-18,-0x1.d01a64a8d94f2p-17},
+        {385,0x1.0a76d5d84ddaep-17,-0x1.b0ca0180236cep-17},
+        {386,0x1.854b46cfa989p-17,-0x1.65bdd7b233607p-17},
+        {387,0x1.e4e32cce4515cp-17,-0x1.e982717568c4cp-18},
+        {388,0x1.0e888623c8edp-16,-0x1.a417ea769dc3cp-19},
+        {389,0x1.13445e640191ep-16,0x1.72e36802e1786p-20},
+        {390,0x1.000681b91eb43p-16,0x1.812d7b0a8b4cap-18},
+        {391,0x1.aea3170c086f2p-17,0x1.3d9cafdc0587ep-17},
+        {392,0x1.3cc271fc0f069p-17,0x1.987d929870958p-17},
+        {393,0x1.714f64288195ap-18,0x1.c9325b21aa43ep-17},
+        {394,0x1.90cd86db7d866p-20,0x1.cd93deb18dd06p-17},
+        {395,-0x1.1fdec72c03178p-19,0x1.a9559c37e55a4p-17},
+        {396,-0x1.5320175dc7c82p-18,0x1.6511123ccea2ep-17},
+        {397,-0x1.d6490893d4276p-18,0x1.0c9934f11f85ep-17},
+        {398,-0x1.0a43f5766d0f4p-17,0x1.59d8fea336709p-18},
+        {399,-0x1.095c8b87c3682p-17,0x1.48a2407733f56p-19},
+        {400,-0x1.dd7a8a97cc05p-18,0x1.76ab062d7d695p-23},
+        {401,-0x1.8627583cedbeap-18,-0x1.90837bc619153p-20},
+        {402,-0x1.1f718dc782786p-18,-0x1.4e7c1c793392p-19},
+        {403,-0x1.7483bf3c73fd8p-19,-0x1.819eb9baa1ebfp-19},
+        {404,-0x1.8d9129119eefep-20,-0x1.728dc76647975p-19},
+        {405,-0x1.128773c41110bp-21,-0x1.37d2103b1e69fp-19},
+        {406,0x1.b853fba70ca74p-24,-0x1.d13b317109026p-20},
+        {407,0x1.a8f8655ef789dp-22,-0x1.315deba2280f4p-20},
+        {408,0x1.dfd20ef0edc9cp-22,-0x1.56db2a78d64b3p-21},
+        {409,0x1.7928295e04951p-22,-0x1.33d11ab198a12p-22},
+        {410,0x1.a9a2a6951cb5ep-23,-0x1.70c0d4a6b33aep-24},
+        {378,0x1.72bba410a2034p-23,0x1.1a13a073baf74p-24},
+        {379,0x1.5bad91380d938p-22,0x1.fc7b4499298a7p-23},
+        {380,0x1.d312ecf6df543p-22,0x1.25d9bded80964p-21},
+        {381,0x1.cb1ee393703bp-22,0x1.0cbc39976f86p-20},
+        {382,0x1.ca80e77eb352bp-23,0x1.a37b65829d616p-20},
+        {383,-0x1.32d6844ca7fdp-22,0x1.20b0b288ee9d6p-19},
+        {384,-0x1.2bc309c825ec7p-20,0x1.628baac6a09p-19},
+        {385,-0x1.30fb83b8990d2p-19,0x1.82adb9c132af1p-19},
+        {386,-0x1.ed81b2a01e454p-19,0x1.6bb0cdbffa346p-19},
+        {387,-0x1.5bc35a28442e3p-18,0x1.0b8d5701db2a6p-19},
+        {388,-0x1.b9557f189e895p-18,0x1.5ff2f49835e1p-21},
+        {389,-0x1.feb3474e835ccp-18,-0x1.5b8a96bcc1d24p-20},
+        {390,-0x1.0d7c74208163dp-17,-0x1.f6b9fc741112p-19},
+        {391,-0x1.000523e87badfp-17,-0x1.b306e56ccba59p-18},
+        {392,-0x1.a56d93864e0abp-18,-0x1.34e2212ef186ep-17},
+        {393,-0x1.0a8ca970f7ebap-18,-0x1.8416cc1e7580fp-17},
+        {394,-0x1.bf0296a1d0dfdp-21,-0x1.bb6b2be05e6adp-17},
+        {395,0x1.829b6c06d710bp-19,-0x1.d0f82f3284302p-17},
+        {396,0x1.c89f22cfdc982p-18,-0x1.be56e7245be46p-17},
+        {397,0x1.60d55d75bb766p-17,-0x1.81e1970606f9p-17},
+        {398,0x1.c7f0b09aa9fb8p-17,-0x1.1f45b4a09da7ap-17},
+        {399,0x1.06ab9b87b1484p-16,-0x1.3e88f1dd78b8p-18},
+        {400,0x1.14487dfda14a9p-16,-0x1.d486d760717bap-22},
+        {401,0x1.0b20d78ceeb55p-16,0x1.070bfe2317413p-18},
+        {402,0x1.d8ac79cd493cdp-17,0x1.07ee18049c941p-17},
+        {403,0x1.775b2da4465eep-17,0x1.7131e3b90591ap-17},
+        {404,0x1.fbf0e3fa1ef3ap-18,0x1.b5a90bca6163cp-17},
+        {405,0x1.ea41a5a49f83ep-19,0x1.d099278ff559dp-17},
+        {406,-0x1.1eb541a68f81p-23,0x1.c29f8d03659ap-17},
+        {407,-0x1.c9c1e26abac4dp-19,0x1.914719a680d1ap-17},
+        {408,-0x1.8bc1d265f17a9p-18,0x1.45e57fe34385ep-17},
+        {409,-0x1.f34ff54c56dd2p-18,0x1.d7f4febfba8dbp-18},
+        {410,-0x1.0d31fbd2331fap-17,0x1.1ebc40e0c2a3p-18},
+        {411,-0x1.04076508faf1p-17,0x1.d4742fe1556d3p-20},
+        {412,-0x1.c9865b9a161b2p-18,-0x1.53b6859d2b92fp-22},
+        {413,-0x1.6f5e413ea52b6p-18,-0x1.dd995d76b02d2p-20},
+        {414,-0x1.0a97dea1acab4p-18,-0x1.5ef10dad6290cp-19},
+        {415,-0x1.541cf255316eap-19,-0x1.8326e2ddd1aa5p-19},
+        {416,-0x1.6290ccbded62ep-20,-0x1.6c446ab709dfp-19},
+        {417,-0x1.c6580de265b42p-22,-0x1.2f5e2388d9774p-19},
+        {418,0x1.2b7aa7372c38cp-23,-0x1.c30ce92b87088p-20},
+        {419,0x1.b239429d1c237p-22,-0x1.28c44d3938a58p-20},
+        {420,0x1.de90b71687fb9p-22,-0x1.503429cf9a9ep-21},
+        {421,0x1.7918cfdc4905cp-22,-0x1.33aeef6e6681ep-22},
+        {422,0x1.b323e1415388cp-23,-0x1.81005b40aebaap-24},
+        {390,0x1.424a01b56f064p-22,0x1.ad933003ae291p-23},
+        {391,0x1.c34331ad6f4eap-22,0x1.ffabb16ca4e0fp-22},
+        {392,0x1.dc9a4b1368a08p-22,0x1.ddeb497cee376p-21},
+        {393,0x1.381309dce073ap-22,0x1.7c4c432b45166p-20},
+        {394,-0x1.ef7a5159841ap-24,0x1.0b5156d8e00cep-19},
+        {395,-0x1.bbca67959e8aap-21,0x1.50fbfae35b7fap-19},
+        {396,-0x1.f162e2f673364p-20,0x1.7d07d75ef0fd2p-19},
+        {397,-0x1.a64176ea7ab0ap-19,0x1.7ba9a6671851bp-19},
+        {398,-0x1.343926cb2924ap-18,0x1.3aca19e4f1182p-19},
+        {399,-0x1.93f3d5be9645dp-18,0x1.5ba93f049e478p-20},
+        {400,-0x1.e3a8ecba2954cp-18,-0x1.75d55818c87ffp-22},
+        {401,-0x1.09caceb131343p-17,-0x1.52c58f5dd3b1p-19},
+        {402,-0x1.0aa09ed0e9d88p-17,-0x1.54cd6636158a5p-18},
+        {403,-0x1.de0aa74d9c1d8p-18,-0x1.04c3727b80336p-17},
+        {404,-0x1.696d0ab00b13p-18,-0x1.59aa12d2e06dap-17},
+        {405,-0x1.7519979946682p-19,-0x1.9e292dfb18301p-17},
+        {406,0x1.1a5fc5ef08fccp-21,-0x1.c800eb1030f2ep-17},
+        {407,0x1.1d6ffa524bd86p-18,-0x1.cf334c00ee9acp-17},
+        {408,0x1.0de4d9aec3812p-17,-0x1.af5cf3d136985p-17},
+        {409,0x1.81e83ffc66992p-17,-0x1.6899562382363p-17},
+        {410,0x1.de054fe21e278p-17,-0x1.ff8c3f22b0ba2p-18},
+        {411,0x1.0be45b79c1732p-16,-0x1.f84d405368c2dp-19},
+        {412,0x1.1441e99d533dap-16,0x1.0148e0de9aaf2p-21},
+        {413,0x1.07216bf29ac36p-16,0x1.3947d2085172ep-18},
+        {414,0x1.cc1533af82f48p-17,0x1.19c30975b67cbp-17},
+        {415,0x1.699c2c6b457bcp-17,0x1.7ba08842952cep-17},
+        {416,0x1.e3e51749aea5cp-18,0x1.b9f10688f4bc2p-17},
+        {417,0x1.c86eb47287fd7p-19,0x1.d0e3f43b1a35ep-17},
+        {418,-0x1.189760026933cp-22,0x1.c16b4534fa8c8p-17},
+        {419,-0x1.cc8630316184ep-19,0x1.90d175402e93p-17},
+        {420,-0x1.88cda7a564f6cp-18,0x1.47b6acac072f2p-17},
+        {421,-0x1.efac2df081d36p-18,0x1.e14bc06635a08p-18},
+        {422,-0x1.0cc3344b1bb82p-17,0x1.2d0278aeb53fp-18},
+        {423,-0x1.0634caf2f8516p-17,0x1.0c1f5df91b97dp-19},
+        {424,-0x1.d409a2d606a7p-18,-0x1.292ec5d356daep-24},
+        {425,-0x1.7f620df641d91p-18,-0x1.a89e952d39922p-20},
+        {426,-0x1.1e281de297084p-18,-0x1.4f93c10545798p-19},
+        {427,-0x1.7cf95a2781a5ap-19,-0x1.80e69c56ed646p-19},
+        {428,-0x1.acd44fc7f26ep-20,-0x1.766c317fee68ap-19},
+        {429,-0x1.5774012333b2dp-21,-0x1.42f0909bc1086p-19},
+        {430,0x1.55a7404ca144p-31,-0x1.f44690cdae7c6p-20},
+        {431,0x1.71ca35cef9d3ap-22,-0x1.5ac59e54e40ffp-20},
+        {432,0x1.e44e327527174p-22,-0x1.a63506dd10f3p-21},
+        {433,0x1.ac8071177a4fep-22,-0x1.b0575fea1fde2p-22},
+        {434,0x1.1f3237e182b1ep-22,-0x1.50481478b106ap-23},
+        {401,0x1.07707ccd4e312p-22,0x1.19a7b50c59b4ap-23},
+        {402,0x1.976ff52daff49p-22,0x1.76d4d80a57a64p-22},
+        {403,0x1.e3d9e4c158964p-22,0x1.75f0fcdf1ecp-21},
+        {404,0x1.a07873511ea8p-22,0x1.38b35f7a9f496p-20},
+        {405,0x1.f92862e221426p-24,0x1.cb883b1c64d7p-20},
+        {406,-0x1.c3de7e16499d2p-22,0x1.2f2176a98b9fcp-19},
+        {407,-0x1.51c0d9c9aca8p-20,0x1.697d02469dc42p-19},
+        {408,-0x1.3f6d2376b60c4p-19,0x1.8322da9191a6fp-19},
+        {409,-0x1.f2b12162fac84p-19,0x1.6a2ade6c10d06p-19},
+        {410,-0x1.58bcf80ee79e4p-18,0x1.0fa22b190ccfcp-19},
+        {411,-0x1.b1f345f0fbf9p-18,0x1.ab561bca6d45fp-21},
+        {412,-0x1.f6ef3a765f374p-18,-0x1.07b4b8b1150fep-20},
+        {413,-0x1.0cacc5ebf05f4p-17,-0x1.b130ed83ae206p-19},
+        {414,-0x1.065cbc92eb2d4p-17,-0x1.8369198bb68fap-18},
+        {415,-0x1.c8a36f5657f1p-18,-0x1.1930ecec83e42p-17},
+        {416,-0x1.4a8eb6cd5f168p-18,-0x1.692a07c11c77ap-17},
+        {417,-0x1.2df46daa575acp-19,-0x1.a7975182f6987p-17},
+        {418,0x1.198466f601f72p-20,-0x1.cb57a52e177fcp-17},
+        {419,0x1.3b6d8debe7eefp-18,-0x1.cd87f64a43182p-17},
+        {420,0x1.18cbe4f574262p-17,-0x1.aaa1ac5d5521bp-17},
+        {421,0x1.883ad5f25ba9p-17,-0x1.6330308209e08p-17},
+        {422,0x1.e06baef18e618p-17,-0x1.f7f7af7a6c2dfp-18},
+        {423,0x1.0bf3dcb6fd1d4p-16,-0x1.f6758f819b506p-19},
+        {424,0x1.144f1771ac90cp-16,0x1.8f568faf8263dp-22},
+        {425,0x1.085bb231381bap-16,0x1.2ace9d32a78fcp-18},
+        {426,0x1.d2d55a80c737ap-17,0x1.1068960e581cp-17},
+        {427,0x1.75b78a1116f38p-17,0x1.72787bba8a5d8p-17},
+        {428,0x1.03506c3e3a54p-17,0x1.b39e1d6515524p-17},
+        {429,0x1.0ee2c1440b68ap-18,0x1.cfcf53746ecfep-17},
+        {430,0x1.c82d14528a9aep-22,0x1.c742440dace83p-17},
+        {431,-0x1.7517b796de042p-19,0x1.9e281abc904cfp-17},
+        {432,-0x1.653a45be91adep-18,0x1.5be1c177e65dep-17},
+        {433,-0x1.d91192e1748fap-18,0x1.09d39bdbaa05ap-17},
+        {434,-0x1.096fcc9d566e8p-17,0x1.6414f30c726dp-18},
+        {435,-0x1.0b2ae7c20cc2ep-17,0x1.77a0f010f67b2p-19},
+        {436,-0x1.ecbf4a2358058p-18,0x1.509b74a39dc4ap-21},
+        {437,-0x1.a3144fdb8942ap-18,-0x1.1bac1eb188e46p-20},
+        {438,-0x1.47c5ce0412ddcp-18,-0x1.251b27e99fc64p-19},
+        {439,-0x1.d13c0e19b8d5dp-19,-0x1.7311d0a16965ep-19},
+        {440,-0x1.220dda5753424p-19,-0x1.81c591a4a3227p-19},
+        {441,-0x1.23b4fdbc317c6p-20,-0x1.60ef4dee4f814p-19},
+        {442,-0x1.4573f1790bdbfp-22,-0x1.22a6109962f9ap-19},
+        {443,0x1.8b5dc135a53e2p-23,-0x1.b09388b1db4e1p-20},
+        {444,0x1.baa6717a6ac79p-22,-0x1.203d29c2a9aa8p-20},
+        {445,0x1.de6eee3fad2f5p-22,-0x1.4f82bd2b7e569p-21},
+        {446,0x1.80a970aaa3836p-22,-0x1.431104b6d2623p-22},
+        {447,0x1.d7325dfbc493fp-23,-0x1.c250db98ae84bp-24},
+        {413,0x1.2f64ab7f02ac7p-22,0x1.79433e7063017p-23},
+        {414,0x1.b198d09b23332p-22,0x1.c0215407c9c68p-22},
+        {415,0x1.e471dc551656ap-22,0x1.a3d7ad1389104p-21},
+        {416,0x1.804a46eb4516dp-22,0x1.51120b22824fbp-20},
+        {417,0x1.ed932f375b29p-25,0x1.e16073efa3f7ep-20},
+        {418,-0x1.0dd4d2b59046p-21,0x1.36ffe1be09fbcp-19},
+        {419,-0x1.6947e7ddf338cp-20,0x1.6d4f4c1ddb082p-19},
+        {420,-0x1.4962ba9f2c1bep-19,0x1.833aa95fc2516p-19},
+        {421,-0x1.f8824347a7aap-19,0x1.686958c334d48p-19},
+        {422,-0x1.58f659e4d904ap-18,0x1.0f522044a5ffap-19},
+        {423,-0x1.afd0e87b9095fp-18,0x1.c0510b8211edcp-21},
+        {424,-0x1.f3ef5dae7f54ep-18,-0x1.d45b545399fe4p-21},
+        {425,-0x1.0c104a4a7da24p-17,-0x1.964c362883c3ap-19},
+        {426,-0x1.0860fa1a5b42p-17,-0x1.6fdaa05849db2p-18},
+        {427,-0x1.d5a644c755a1ap-18,-0x1.0d2e5da93333fp-17},
+        {428,-0x1.63b833936cfd7p-18,-0x1.5caa34f05f142p-17},
+        {429,-0x1.7c1eae28c47e2p-19,-0x1.9d271a441ca85p-17},
+        {430,0x1.1c0ed1ad8572bp-22,-0x1.c60492e722368p-17},
+        {431,0x1.f87bd0fc2ddc8p-19,-0x1.d06872a1ce25p-17},
+        {432,0x1.ed78b2545bfafp-18,-0x1.b84555c73a928p-17},
+        {433,0x1.679bdc69c6926p-17,-0x1.7d1126b335864p-17},
+        {434,0x1.c5c814a444104p-17,-0x1.220c829d4393p-17},
+        {435,0x1.03e50a16c3d8dp-16,-0x1.5c170d08c62abp-18},
+        {436,0x1.136d152d57038p-16,-0x1.561a78a98751ap-20},
+        {437,0x1.0fdefd6eeeac4p-16,0x1.7137188353cb6p-19},
+        {438,0x1.f3332f81b0248p-17,0x1.b66ec4df6b578p-18},
+        {439,0x1.a5d6ee1b77b8ep-17,0x1.46fe678b3a5f9p-17},
+        {440,0x1.3f8db8aa1289dp-17,0x1.96e1ed929e0ep-17},
+        {441,0x1.950481bb3e8fbp-18,0x1.c5514a69b74c8p-17},
+        {442,0x1.4783b8292e24bp-19,0x1.d072a884c7daap-17},
+        {443,-0x1.f811319f9f3dfp-21,0x1.ba2ad88502fb9p-17},
+        {444,-0x1.00c58856b208p-18,0x1.87aa2b0331772p-17},
+        {445,-0x1.941ba15401dd2p-18,0x1.40941704d9f06p-17},
+        {446,-0x1.f1d0db4013316p-18,0x1.dbcab79cbf705p-18},
+        {447,-0x1.0c94f5751376p-17,0x1.3188194a0754bp-18},
+        {448,-0x1.07a35c7486b92p-17,0x1.25962a6a52624p-19},
+        {449,-0x1.ddd163ac532d8p-18,0x1.8c070d30ec3a7p-23},
+        {450,-0x1.913981f4501d4p-18,-0x1.66700e24e0c3bp-20},
+        {451,-0x1.36c7baca3c367p-18,-0x1.381d1550f7546p-19},
+        {452,-0x1.b5a96b1777d2ep-19,-0x1.78f00afbe8371p-19},
+        {453,-0x1.0ec2e0d12ffb4p-19,-0x1.7ff982648ec28p-19},
+        {454,-0x1.0ce533b2a8014p-20,-0x1.5c22a817f14a5p-19},
+        {455,-0x1.1abfcfa89946cp-22,-0x1.1e15fdaf012d4p-19},
+        {456,0x1.a587d57244f52p-23,-0x1.ab3dec0829977p-20},
+        {457,0x1.bb88781c3560dp-22,-0x1.1f4c39fab9p-20},
+        {458,0x1.df50bd980bbefp-22,-0x1.54046caee7e8cp-21},
+        {459,0x1.873a31f5ae639p-22,-0x1.5116c0f67af26p-22},
+        {460,0x1.efa9432b70c0ap-23,-0x1.f20c63a895094p-24},
+        {425,0x1.1fc9ed8d24e45p-22,0x1.51a7d97672328p-23},
+        {426,0x1.a3609e7b1014ap-22,0x1.95fab1e572002p-22},
+        {427,0x1.e4830784e5875p-22,0x1.7fd73756850a4p-21},
+        {428,0x1.a2648ff9eaedfp-22,0x1.3713720ccf9ffp-20},
+        {429,0x1.34eda23d9c3dfp-23,0x1.c147a46dd2fe8p-20},
+        {430,-0x1.6b0ca51842963p-22,0x1.2681b5322096ep-19},
+        {431,-0x1.2356370488e8ep-20,0x1.60d9e9bb64a88p-19},
+        {432,-0x1.18ca555c986d4p-19,0x1.80fd9177008c6p-19},
+        {433,-0x1.bc2d8f8d0fa93p-19,0x1.77a8fa62be88p-19},
+        {434,-0x1.3786136ca142fp-18,0x1.3752261fe870ap-19},
+        {435,-0x1.8f766708b9acfp-18,0x1.6d4ce25b2fc5p-20},
+        {436,-0x1.da95e0882b4f8p-18,-0x1.a5632dd585a7cp-24},
+        {437,-0x1.065a327dd7c28p-17,-0x1.0ec1e4b198c67p-19},
+        {438,-0x1.0d26d83d6dc24p-17,-0x1.1fe87e7392686p-18},
+        {439,-0x1.fa3428f7a81a4p-18,-0x1.c4cb419e037cdp-18},
+        {440,-0x1.a71f6cdce67d7p-18,-0x1.33a60f390904ep-17},
+        {441,-0x1.20dfee80f975p-18,-0x1.7b61ab237c9dcp-17},
+        {442,-0x1.b4054dafd00ddp-20,-0x1.b13de63d1caf9p-17},
+        {443,0x1.a523c3fcaa73bp-20,-0x1.cde0568361013p-17},
+        {444,0x1.51f88b81238ep-18,-0x1.cbea3673b4726p-17},
+        {445,0x1.1cdd310be290ep-17,-0x1.a8c46980ea4e4p-17},
+        {446,0x1.85fd2fbf52b9p-17,-0x1.651ccdc93fe42p-17},
+        {447,0x1.da99e559c7643p-17,-0x1.04ff9f143ecc8p-17},
+        {448,0x1.094e1b7a0423dp-16,-0x1.1f0a9a0f53117p-18},
+        {449,0x1.1447e670ca66ep-16,-0x1.c38b92c6deabap-22},
+        {450,0x1.0d262d77e7131p-16,0x1.d1ea7ee2867p-19},
+        {451,0x1.e9390ee4c96e4p-17,0x1.dabb05961c676p-18},
+        {452,0x1.9a20ae95fe775p-17,0x1.52bd7dde2ee2dp-17},
+        {453,0x1.349c8f0015804p-17,0x1.9cefc226564f6p-17},
+        {454,0x1.845674047e8fcp-18,0x1.c73698d23c681p-17},
+        {455,0x1.344c3bd3a6ca2p-19,0x1.d02a18e5b0271p-17},
+        {456,-0x1.0642762d3cf0fp-20,0x1.b9b5a6127b24ap-17},
+        {457,-0x1.fbd8edbfeaa2cp-19,0x1.88aea3be26e94p-17},
+        {458,-0x1.8e995bec47accp-18,0x1.4416ecbf6965ep-17},
+        {459,-0x1.eccd9f6fd046p-18,0x1.e8510ece5f339p-18},
+        {460,-0x1.0bc35d09957edp-17,0x1.429c4d594d4f5p-18},
+        {461,-0x1.0985bfdf62e7ap-17,0x1.4cb25d1eded1cp-19},
+        {462,-0x1.e7d380798b79ep-18,0x1.fb8cdfb1b4ee9p-22},
+        {463,-0x1.a106cc647a294p-18,-0x1.24b09c43cbcf4p-20},
+        {464,-0x1.4ad3d6c55b4b7p-18,-0x1.2167f26267b5fp-19},
+        {465,-0x1.e1b3583c42be4p-19,-0x1.6eeaa3edaff7p-19},
+        {466,-0x1.39b776befc6f6p-19,-0x1.82fc2f58e3c3p-19},
+        {467,-0x1.5790c387e03c6p-20,-0x1.6a7511385163dp-19},
+        {468,-0x1.fe57e08f44708p-22,-0x1.346f19de46508p-19},
+        {469,0x1.0a4fff21cd322p-24,-0x1.dfcaa615bd5d1p-20},
+        {470,0x1.7cb4971997458p-22,-0x1.538677fdc8f3ep-20},
+        {471,0x1.e3b77cd506f9p-22,-0x1.ae6d1293cc3c4p-21},
+        {472,0x1.b8fd6f8cce671p-22,-0x1.d8d51a58f20cp-22},
+        {473,0x1.3e9fcc967d77p-22,-0x1.a2f6a2593faafp-23},
+        {474,0x1.5a5360606f77dp-23,-0x1.eeaa8988a9fb2p-25},
+        {437,0x1.b87b79e96b71cp-23,0x1.8a22d8cd9cbb8p-24},
+        {438,0x1.67b253048fbf4p-22,0x1.12de1e6ff03dep-22},
+        {439,0x1.cef1064845f8ep-22,0x1.1a7b96bac0a5p-21},
+        {440,0x1.dad8d98148b33p-22,0x1.e5baf1610d5b1p-21},
+        {441,0x1.4de486eb2fd82p-22,0x1.7065a7664f71bp-20},
+        {442,-0x1.235d0687368c6p-26,0x1.f9cc12d3b39f5p-20},
+        {443,-0x1.387954a87c917p-21,0x1.3e15e79e73ce6p-19},
+        {444,-0x1.77ca4ab6fc251p-20,0x1.6f7c48cbaa5cep-19},
+        {445,-0x1.491df4ae1c8bap-19,0x1.833753a2a2e0dp-19},
+        {446,-0x1.ede8b8939a7p-19,0x1.6b88fda34c9c7p-19},
+        {447,-0x1.4e73a9bee9ebep-18,0x1.1cecb7be6927bp-19},
+        {448,-0x1.a1f9c058b4d8p-18,0x1.2078c198462dp-20},
+        {449,-0x1.e6d524b5cac11p-18,-0x1.db754b8cd5a65p-22},
+        {450,-0x1.08ebfeb88ca96p-17,-0x1.3f7178d882356p-19},
+        {451,-0x1.0c5bd192bd488p-17,-0x1.36990b6511091p-18},
+        {452,-0x1.f37e3680fe2cep-18,-0x1.d75d20b5859fp-18},
+        {453,-0x1.9ddb6dd107987p-18,-0x1.3a18abe261806p-17},
+        {454,-0x1.1821cc21499e4p-18,-0x1.7edbe1a1f096p-17},
+        {455,-0x1.9f14f0e9d401ap-20,-0x1.b2562a561b545p-17},
+        {456,0x1.a3046af809fap-20,-0x1.cdd68efe856c6p-17},
+        {457,0x1.4ab1e4b0e8083p-18,-0x1.cc761502d2507p-17},
+        {458,0x1.162da18187d89p-17,-0x1.abc7ee3e4f73cp-17},
+        {459,0x1.7d6e985874a81p-17,-0x1.6c4770cf35fa4p-17},
+        {460,0x1.d214c91bcc515p-17,-0x1.117248ca390acp-17},
+        {461,0x1.0640251a03af9p-16,-0x1.431034508285ap-18},
+        {462,0x1.13aa1d320335ep-16,-0x1.27a6ec22d05a1p-20},
+        {463,0x1.1009dda736176p-16,0x1.6a2473a8aac04p-19},
+        {464,0x1.f76b5617a4e35p-17,0x1.a5ca4b9d2c784p-18},
+        {465,0x1.b11d10a5c40bcp-17,0x1.3ad1eb0757604p-17},
+        {466,0x1.5391d7f9819fcp-17,0x1.8ab762b73bf12p-17},
+        {467,0x1.ce3dbe8c30694p-18,0x1.bd72a389895a2p-17},
+        {468,0x1.d45db4c0780dep-19,0x1.d0c8ec078dc5ap-17},
+        {469,0x1.b277e497aa028p-23,0x1.c581abf2ca0dep-17},
+        {470,-0x1.6ddda88b54f3bp-19,0x1.9f276c5ce9a86p-17},
+        {471,-0x1.5646789f44afp-18,0x1.637b2e84b0238p-17},
+        {472,-0x1.c80b2880d5dbep-18,0x1.19af94aff3534p-17},
+        {473,-0x1.047cf4c5f49dp-17,0x1.930f147d76f62p-18},
+        {474,-0x1.0d66a9d5aa79dp-17,0x1.e9d9702cef73bp-19},
+        {475,-0x1.01c2829e5a0e8p-17,0x1.96e9155a63d58p-20},
+        {476,-0x1.cc3f39fb270bp-18,-0x1.108efe72bc716p-22},
+        {477,-0x1.7fd3c2e50760fp-18,-0x1.a6f4f8fa07882p-20},
+        {478,-0x1.29641f751be5ap-18,-0x1.456d2e0e405efp-19},
+        {479,-0x1.a6228dbbe8423p-19,-0x1.7ba748412b85ap-19},
+        {480,-0x1.09fb9c93848bcp-19,-0x1.7f681b9533eaap-19},
+        {481,-0x1.12d20a4c86b83p-20,-0x1.5d68c2c7b37aep-19},
+        {482,-0x1.4fad3a8c889fcp-22,-0x1.23b3f3d7f9da4p-19},
+        {483,0x1.3f363eee75a12p-23,-0x1.bf5a53d1c207dp-20},
+        {484,0x1.a00c1d9ccc5b2p-22,-0x1.390bb5753f75ep-20},
+        {485,0x1.e4dc76eb66704p-22,-0x1.891cd177ebe6dp-21},
+        {486,0x1.ab089ba4d9cbap-22,-0x1.abdcfa1e8d7cep-22},
+        {487,0x1.2e664e0026ebp-22,-0x1.76994d09d03f2p-23},
+        {450,0x1.e7707bba9178ap-23,0x1.e18bb4162b1c4p-24},
+        {451,0x1.78face58afed8p-22,0x1.335aff22b547cp-22},
+        {452,0x1.d5aa88af0e504p-22,0x1.2d97ca73fbc04p-21},
+        {453,0x1.d618b49102121p-22,0x1.f801ecc11a936p-21},
+        {454,0x1.41ac171adfd43p-22,0x1.77266ae0d9001p-20},
+        {455,-0x1.c93aecc6370e6p-26,0x1.fcc7c7af9665dp-20},
+        {456,-0x1.35f35b25c6dbap-21,0x1.3dad12dd7304fp-19},
+        {457,-0x1.6ee5843fd2274p-20,0x1.6e27fdd4d5ff6p-19},
+        {458,-0x1.3f46875928316p-19,0x1.831bb2d895d54p-19},
+        {459,-0x1.de00ebdf786d3p-19,0x1.6fdea87a6a74p-19},
+        {460,-0x1.43e0695be2e6p-18,0x1.29a2d38aa0696p-19},
+        {461,-0x1.9624f57a8713bp-18,0x1.52a5e59446628p-20},
+        {462,-0x1.dc2408ba1881p-18,-0x1.2c28e132453e8p-23},
+        {463,-0x1.05cca86e349cp-17,-0x1.05b7b03f1ca04p-19},
+        {464,-0x1.0d68396d67478p-17,-0x1.11c68d41da677p-18},
+        {465,-0x1.00f2d15880212p-17,-0x1.acc122c77aaefp-18},
+        {466,-0x1.bbf3bb387a6e1p-18,-0x1.23d51bce78a8ep-17},
+        {467,-0x1.4805b2cecef1cp-18,-0x1.6a547d5db3401p-17},
+        {468,-0x1.534c0ecfa604fp-19,-0x1.a2c42e70cfa19p-17},
+        {469,0x1.70ed2f377a8c5p-22,-0x1.c69f0065b992cp-17},
+        {470,0x1.dbc209c03c115p-19,-0x1.d0b74566f25fep-17},
+        {471,0x1.cb776831b02d4p-18,-0x1.bddf2a6264044p-17},
+        {472,0x1.4f5ef969641ap-17,-0x1.8d60cc6d2c966p-17},
+        {473,0x1.ab48ff9cd3bc6p-17,-0x1.4134c91c9195ep-17},
+        {474,0x1.f1c1a87d76582p-17,-0x1.bbdb9fa1066acp-18},
+        {475,0x1.0e5d162f3fa2cp-16,-0x1.a9642f8a51426p-19},
+        {476,0x1.1439bd4d697b8p-16,0x1.123282b62ab5ap-21},
+        {477,0x1.09f320e907897p-16,0x1.16b09cf6ea0e4p-18},
+        {478,0x1.e0dfa38d79d41p-17,0x1.f670ab0dea3a1p-18},
+        {479,0x1.93cefaa89c8bp-17,0x1.58ba56d550713p-17},
+        {480,0x1.334afe8de6e97p-17,0x1.9da0b0d53ca7fp-17},
+        {481,0x1.8ebb240fd344dp-18,0x1.c609b15115e9cp-17},
+        {482,0x1.62b1db7726606p-19,0x1.d0bb03ef22ac9p-17},
+        {483,-0x1.066fd396b642cp-21,0x1.bf210c36f4c64p-17},
+        {484,-0x1.b23ab3dd52ddep-19,0x1.9504f9c85a867p-17},
+        {485,-0x1.6c6b3ddde8b1p-18,0x1.5805690082d86p-17},
+        {486,-0x1.d3d76df17ad5ap-18,0x1.0ee48a4b2cb2fp-17},
+        {487,-0x1.068e06198448dp-17,0x1.818655ff3afe6p-18},
+        {488,-0x1.0d2b6a513abd7p-17,0x1.d18453d97034ep-19},
+        {489,-0x1.00adbba5c6428p-17,0x1.7bc85aab75c62p-20},
+        {490,-0x1.caad65b14eb79p-18,-0x1.36cad98a25caap-22},
+        {491,-0x1.80486063a872ap-18,-0x1.a554b0a45d67bp-20},
+        {492,-0x1.2c6226093c958p-18,-0x1.428ef8ef1a0fcp-19},
+        {493,-0x1.b09996aa19316p-19,-0x1.79d9be0d4c09ap-19},
+        {494,-0x1.17329378ea815p-19,-0x1.80d451fd20b0cp-19},
+        {495,-0x1.2e38e8c2a2b1fp-20,-0x1.62ffc632da4c4p-19},
+        {496,-0x1.af968c5554f8ap-22,-0x1.2d358df91bd21p-19},
+        {497,0x1.6a7f8c1d61d57p-24,-0x1.d7d5aef03ae24p-20},
+        {498,0x1.7c9a08842ad96p-22,-0x1.5396b3041d888p-20},
+        {499,0x1.e26aaa2b68de9p-22,-0x1.bb37c0a3339cp-21},
+        {500,0x1.c300a7c7fd17ap-22,-0x1.fe7e85f232e35p-22},
+        {501,0x1.565d18686ebd3p-22,-0x1.eae381ea27386p-23},
+        {502,0x1.9b4b38c32f19ap-23,-0x1.58aa34f0dafcp-24},
+        {463,0x1.b010441694c23p-23,0x1.7b6ba8f39061cp-24},
+        {464,0x1.5c6e1d3c70cp-22,0x1.fec8fe461c056p-23},
+        {465,0x1.c470ba38482p-22,0x1.02311a38360c8p-21},
+        {466,0x1.e2acb89f112d8p-22,0x1.b9059244fcd0cp-21},
+        {467,0x1.83b95517eb522p-22,0x1.4ea92e4d5a97cp-20},
+        {468,0x1.d422d299d6e11p-24,0x1.cec4e0f2593p-20},
+        {469,-0x1.72a38f6c9e41bp-22,0x1.2742734c0c382p-19},
+        {470,-0x1.128f5ed3fb0d4p-20,0x1.5d580e3978284p-19},
+        {471,-0x1.01c652394fb56p-19,0x1.7e550bb3f26f2p-19},
+        {472,-0x1.934b6080f061ep-19,0x1.7e647d4d96d1ep-19},
+        {473,-0x1.1a75370e7b4cep-18,0x1.52a3edb03cb3fp-19},
+        {474,-0x1.6cc2fd8e98d1cp-18,0x1.e5829788a0024p-20},
+        {475,-0x1.b84f3f60a5759p-18,0x1.6a246c822d0b8p-21},
+        {476,-0x1.f3d9c264a700bp-18,-0x1.d34f940d03871p-21},
+        {477,-0x1.0b06bea69d62ep-17,-0x1.73f8f61691fcfp-19},
+        {478,-0x1.0b47d95aa6658p-17,-0x1.4a9eb0218916p-18},
+        {479,-0x1.ef139c3bed4cep-18,-0x1.e2a5dcab7e08ep-18},
+        {480,-0x1.9c502e42c3a9ep-18,-0x1.3b202571c62a2p-17},
+        {481,-0x1.1eb65f8990d42p-18,-0x1.7c3be6965b7f8p-17},
+        {482,-0x1.eb2f94483e24cp-20,-0x1.ae378f1f38094p-17},
+        {483,0x1.1ba005eac873ep-20,-0x1.cb5c323ff7d4cp-17},
+        {484,0x1.1a635916d1cd4p-18,-0x1.cf4ed93b3311bp-17},
+        {485,0x1.f11b56763da0cp-18,-0x1.b799e44c97cb6p-17},
+        {486,0x1.5da190f1b2a5ap-17,-0x1.8409f8cdab55ap-17},
+        {487,0x1.b4a2dbdf75a2bp-17,-0x1.36d19451f658cp-17},
+        {488,0x1.f6a4cd03e3d4cp-17,-0x1.a8d9bb1a9eb2p-18},
+        {489,0x1.0f24a0989e29ap-16,-0x1.8d1b4aa0581bbp-19},
+        {490,0x1.14260fec305bap-16,0x1.4d7782586847ap-21},
+        {491,0x1.09ec875ded45cp-16,0x1.16fc6e7b46f7p-18},
+        {492,0x1.e2a14eb8baf6ep-17,0x1.f0c18f68ee75bp-18},
+        {493,0x1.98af2b3b9993cp-17,0x1.541ba6cf00c69p-17},
+        {494,0x1.3bfc41b32a7cep-17,0x1.98e093aefc148p-17},
+        {495,0x1.a7ae249b2702cp-18,0x1.c2f624d93285ep-17},
+        {496,0x1.a0a76802d7ae4p-19,0x1.d0fd9d235e7c4p-17},
+        {497,0x1.6fe68cea23464p-26,0x1.c3f8db021162cp-17},
+        {498,-0x1.6e61eb5f972eap-19,0x1.9f11e97668d22p-17},
+        {499,-0x1.4ea9c82a81e5cp-18,0x1.672d012fee12cp-17},
+        {500,-0x1.bdcb83a64491p-18,0x1.2253bc0ac0066p-17},
+        {501,-0x1.00be2a26623acp-17,0x1.ae1843cf43221p-18},
+        {502,-0x1.0d51cb22736f8p-17,0x1.175f3b062b2ffp-18},
+        {503,-0x1.06d6722280282p-17,0x1.1752f6efe8122p-19},
+        {504,-0x1.e1b86102c5afcp-18,0x1.3b66170e4503ap-22},
+        {505,-0x1.9f96b432d7caep-18,-0x1.2ade5c667e17p-20},
+        {506,-0x1.50b3254115234p-18,-0x1.1a11b5207062fp-19},
+        {507,-0x1.fc1b12fcf7814p-19,-0x1.6743f0f3fa47ep-19},
+        {508,-0x1.5ec18c9ecf803p-19,-0x1.82cea1e7848e6p-19},
+        {509,-0x1.aa299bb8d485p-20,-0x1.76152061d5bc8p-19},
+        {510,-0x1.99ec96e30905ep-21,-0x1.4c7b660a74551p-19},
+        {511,-0x1.6022cae9297ebp-23,-0x1.11cf4e1c4898cp-19},
+        {512,0x1.d22b7b07bec2fp-23,-0x1.a1ccc8de9725p-20},
+        {513,0x1.b5dc80809a202p-22,-0x1.2529cdc832306p-20},
+        {514,0x1.e3ba9c751a619p-22,-0x1.7449425e33337p-21},
+        {515,0x1.a66e35381709dp-22,-0x1.9e74165be511ep-22},
+        {516,0x1.2ff8c52e81bc5p-22,-0x1.7aaf0463e1f84p-23},
+        {517,0x1.54eebcb7e97fap-23,-0x1.dfcaed1369872p-25},
+        {477,0x1.108c1a85a51bep-22,0x1.2db4af7e51a28p-23},
+        {478,0x1.8acdacc266dbcp-22,0x1.58ecf436ed148p-22},
+        {479,0x1.da900a51c3aa8p-22,0x1.3e94673f35dd1p-21},
+        {480,0x1.d37938cab59ap-22,0x1.006f6a0596508p-20},
+        {481,0x1.45d0c36b11793p-22,0x1.74e153447bb56p-20},
+        {482,0x1.412de7ce6476fp-28,0x1.f2f00b6f47008p-20},
+        {483,-0x1.085fe0390fe0cp-21,0x1.3608b97677007p-19},
+        {484,-0x1.42b6eda58b1d4p-20,0x1.66d32c55b0902p-19},
+        {485,-0x1.1beef8fea5dc3p-19,0x1.813ec81bf2d7ap-19},
+        {486,-0x1.acdba923d10fap-19,0x1.7a7f6bd5fb7cap-19},
+        {487,-0x1.259e1acaf3808p-18,0x1.48e62e3ee7bd5p-19},
+        {488,-0x1.754167a121b2ap-18,0x1.ca927747d3ec2p-20},
+        {489,-0x1.bda009ff45e1p-18,0x1.315b3ce4cfb68p-21},
+        {490,-0x1.f631761016f38p-18,-0x1.00b67533d7af4p-20},
+        {491,-0x1.0b36209d52005p-17,-0x1.79ae1f81e4d0cp-19},
+        {492,-0x1.0b591707f0273p-17,-0x1.497433c9e51bep-18},
+        {493,-0x1.f13eb6766236p-18,-0x1.dd22d4bada413p-18},
+        {494,-0x1.a2fbd3276cd62p-18,-0x1.3689d538968c1p-17},
+        {495,-0x1.2c218657af95p-18,-0x1.76b47a305831fp-17},
+        {496,-0x1.2112173d853f2p-19,-0x1.a923c84d06c1ep-17},
+        {497,0x1.42ded98a2b7p-21,-0x1.c87fa561978abp-17},
+        {498,0x1.e7da0c146a9eap-19,-0x1.d095472c51bc4p-17},
+        {499,0x1.c521c2ddbe9d8p-18,-0x1.bed267488fd67p-17},
+        {500,0x1.46ccd59a9b70cp-17,-0x1.929d0dfbb9b1ap-17},
+        {501,0x1.9f6f190daa95ep-17,-0x1.4d7ca33bee8bcp-17},
+        {502,0x1.e5da011ff696p-17,-0x1.e61bd3bda0708p-18},
+        {503,0x1.0a56185772d38p-16,-0x1.1182d4664cd09p-18},
+        {504,0x1.1422091e34028p-16,-0x1.569e863a5c24fp-21},
+        {505,0x1.0f8ccef5c6dd2p-16,0x1.7d67c725e13fp-19},
+        {506,0x1.f9e46fc8c052ep-17,0x1.9b968745f193ap-18},
+        {507,0x1.bb89ed1117977p-17,0x1.2eba062efde7cp-17},
+        {508,0x1.68d5777892358p-17,0x1.7c25223b1dc1ep-17},
+        {509,0x1.0802aed2dcb9ap-17,0x1.b1baf29f9fb4ep-17},
+        {510,0x1.404d8eb700aaep-18,0x1.cd2d4c72d661dp-17},
+        {511,0x1.c44b4d3a57498p-20,0x1.ce515111ef75p-17},
+        {512,-0x1.4007e8e0c7b72p-20,0x1.b709482eb24f2p-17},
+        {513,-0x1.eea90de9bfcddp-19,0x1.8afccb5172ab3p-17},
+        {514,-0x1.7c38b82bc8516p-18,0x1.4f28eaa1f2a9bp-17},
+        {515,-0x1.d97f81d625c1ap-18,0x1.095600c2ab12dp-17},
+        {516,-0x1.06d18854c16e8p-17,0x1.7f066970fa756p-18},
+        {517,-0x1.0d49e5e469906p-17,0x1.dd5fd8983cd5ap-19},
+        {518,-0x1.0299255898524p-17,0x1.ad50e9b04d7f6p-20},
+        {519,-0x1.d48af03dda576p-18,-0x1.dbf0e91df478ap-25},
+        {520,-0x1.90ed75f63bd3cp-18,-0x1.677144953c331p-20},
+        {521,-0x1.42fccaffd73d7p-18,-0x1.2aa34e9dedcd8p-19},
+        {522,-0x1.e5a4656ec4ae4p-19,-0x1.6dd22ba08c25ap-19},
+        {523,-0x1.4e93e38cad31bp-19,-0x1.832ce9508b9c8p-19},
+        {524,-0x1.962387fb9c747p-20,-0x1.73a0ca3636b4ap-19},
+        {525,-0x1.86101f1d393a6p-21,-0x1.49bb0907d2a86p-19},
+        {526,-0x1.4758181ec079ep-23,-0x1.104af4d3b5476p-19},
+        {527,0x1.cf5bc57547366p-23,-0x1.a266aec6fed74p-20},
+        {528,0x1.b1e54fb2cb788p-22,-0x1.29109be400ffcp-20},
+        {529,0x1.e48a3fb38b76ep-22,-0x1.8026ad10d8b21p-21},
+        {530,0x1.af034622382e8p-22,-0x1.b7e1f80ac32d4p-22},
+        {531,0x1.3f8cf1207cd0ep-22,-0x1.a57e125ceabf7p-23},
+        {532,0x1.7b8045bf938dep-23,-0x1.26ce7cdf2ff28p-24},
+        {491,0x1.179d35f7fb0e4p-22,0x1.3df823fded956p-23},
+        {492,0x1.8d905cc46674ep-22,0x1.5f2b4537bf55fp-22},
+        {493,0x1.da719135c543ep-22,0x1.3e19deb37ec06p-21},
+        {494,0x1.d57bcdd208d18p-22,0x1.fa2468729e8afp-21},
+        {495,0x1.52e2050351957p-22,0x1.6d8a703b442b2p-20},
+        {496,0x1.4b81d72e65e06p-25,0x1.e7c88c07d95fap-20},
+        {497,-0x1.c6e6ec31bd272p-22,0x1.2f62ef0c4304fp-19},
+        {498,-0x1.23948802f3d93p-20,0x1.60e0437da810fp-19},
+        {499,-0x1.04e4867fb95f3p-19,0x1.7ebd3342e5056p-19},
+        {500,-0x1.8e2fd52c24d0ap-19,0x1.7f04755b53d8p-19},
+        {501,-0x1.1317881a6caa8p-18,0x1.5888210f2ff92p-19},
+        {502,-0x1.6105ddc36dd66p-18,0x1.0418ad26860b3p-19},
+        {503,-0x1.aa151c0f94547p-18,0x1.f6c8ce2cbef04p-21},
+        {504,-0x1.e6935f6012de6p-18,-0x1.d430ac82d676cp-22},
+        {505,-0x1.074a8669e4b7ep-17,-0x1.1f988430ff66dp-19},
+        {506,-0x1.0d5e21522172dp-17,-0x1.13c1cac1c2b7p-18},
+        {507,-0x1.0284ca64457bfp-17,-0x1.a1c4b7aed5a06p-18},
+        {508,-0x1.c99f6063e598p-18,-0x1.1841c753fcefcp-17},
+        {509,-0x1.6760a3aac0f48p-18,-0x1.5ab2a3ea56e42p-17},
+        {510,-0x1.c0ad65f241277p-19,-0x1.92b331ee53a09p-17},
+        {511,-0x1.ce71a2f1db05ep-21,-0x1.bb0a0b039bp-17},
+        {512,0x1.07b9f4629309cp-19,-0x1.cf4660bdc510cp-17},
+        {513,0x1.4dc4afe316b76p-18,-0x1.cc3579d73ba98p-17},
+        {514,0x1.0ba27982509fp-17,-0x1.b0407d51e65e4p-17},
+        {515,0x1.697f315e0244ep-17,-0x1.7ba79b4a74f46p-17},
+        {516,0x1.b9fb2863962fbp-17,-0x1.3092fa93c909ap-17},
+        {517,0x1.f75c1b59f84fcp-17,-0x1.a5ec4a0d8234ap-18},
+        {518,0x1.0e96ce3eacd34p-16,-0x1.a11df84cc59ap-19},
+        {519,0x1.14542f2e35007p-16,0x1.1dbdf1e2f8a42p-22},
+        {520,0x1.0c799eed2f95fp-16,0x1.e64f7b6f881dbp-19},
+        {521,0x1.ef37331afff0ep-17,0x1.c5400da1c6d9ep-18},
+        {522,0x1.ae840e473a2fap-17,0x1.3daa20689e916p-17},
+        {523,0x1.5b88e0f245d8cp-17,0x1.8571e47b0e733p-17},
+        {524,0x1.f84f362f32ad4p-18,0x1.b647f1b1d7814p-17},
+        {525,0x1.2dde5309a047bp-18,0x1.ce4fc1ccf647ap-17},
+        {526,0x1.944ee90159d48p-20,0x1.cd9518cbb8bf2p-17},
+        {527,-0x1.5689ae98f8585p-20,0x1.b5f4261be7deap-17},
+        {528,-0x1.ef6fbbc701d4ep-19,0x1.8ad856e844b9ep-17},
+        {529,-0x1.7944829b4d885p-18,0x1.50da0ba504c44p-17},
+        {530,-0x1.d57d110d003f4p-18,0x1.0d4689a1dee5ap-17},
+        {531,-0x1.056d22a4154d7p-17,0x1.8b3e8d777460cp-18},
+        {532,-0x1.0d77e103f4fbap-17,0x1.fc77a5a21c03p-19},
+        {533,-0x1.04fe1db0c850ap-17,0x1.f24899ae0e10ep-20},
+        {534,-0x1.de437492b00e6p-18,0x1.a8df9f299f7e9p-23},
+        {535,-0x1.9f4747b7204dcp-18,-0x1.2c240e648f1aep-20},
+        {536,-0x1.54f6e9d09c6fp-18,-0x1.148c098bad935p-19},
+        {537,-0x1.06ead40eaa30fp-18,-0x1.616f33359d6cap-19},
+        {538,-0x1.7780e0d3d5a95p-19,-0x1.8150cbe08c282p-19},
+        {539,-0x1.e28da934ac5b7p-20,-0x1.7bc4c9b169f15p-19},
+        {540,-0x1.043060d72c384p-20,-0x1.5a2c8a950158cp-19},
+        {541,-0x1.6b3b62721e6b6p-22,-0x1.26819ef2b81cap-19},
+        {542,0x1.91c339266c342p-24,-0x1.d47de2089a26ep-20},
+        {543,0x1.715a26863129ep-22,-0x1.5b06756f72b2p-20},
+        {544,0x1.dd6f8ac057b26p-22,-0x1.d9f7793bc38c6p-21},
+        {545,0x1.d2b7be8519864p-22,-0x1.24b126957b34dp-21},
+        {546,0x1.7cdd41fe177fcp-22,-0x1.3b1c5f9cb267ep-22},
+        {547,0x1.03c0552ef16eap-22,-0x1.118ff7d4f98f4p-23},
+        {505,0x1.e47698baf388ep-23,0x1.db827de398553p-24},
+        {506,0x1.6a39a14a6c91ep-22,0x1.17532d9ea56bdp-22},
+        {507,0x1.c69745d557ce3p-22,0x1.06b6fc0f972c3p-21},
+        {508,0x1.e3c7236f6ad03p-22,0x1.add60e0a6e52ap-21},
+        {509,0x1.9a0cabece21eep-22,0x1.3dedc275dd5b8p-20},
+        {510,0x1.83e36d1529425p-23,0x1.b2087b49b433ep-20},
+        {511,-0x1.8c932984532eap-23,0x1.147689d887402p-19},
+        {512,-0x1.8a699e206a9bap-21,0x1.4a54a934ed95ep-19},
+        {513,-0x1.8baca2ef6726cp-20,0x1.723e938e7a6c4p-19},
+        {514,-0x1.40678753c2a94p-19,0x1.8319c90947554p-19},
+        {515,-0x1.cd2957a5f09cp-19,0x1.73f3f56b3f18dp-19},
+        {516,-0x1.31ed57a5a63d3p-18,0x1.3d08595ed829cp-19},
+        {517,-0x1.7cb4a012efab6p-18,0x1.b19bb1d2e11f5p-20},
+        {518,-0x1.c04c083a2dbc9p-18,0x1.13bda511f1e8bp-21},
+        {519,-0x1.f57d0921d4ed8p-18,-0x1.f3c0e7dba2c89p-21},
+        {520,-0x1.0a8bb03e0b87bp-17,-0x1.66c3c81946212p-19},
+        {521,-0x1.0c5156268bb88p-17,-0x1.3703a1113eea9p-18},
+        {522,-0x1.fb1223196b01ap-18,-0x1.c21338c3422ecp-18},
+        {523,-0x1.b9677b4dffa9dp-18,-0x1.25d592848abf9p-17},
+        {524,-0x1.533267cc3eacap-18,-0x1.64f52d7fb1bccp-17},
+        {525,-0x1.95b913770f144p-19,-0x1.995d8bc55a91cp-17},
+        {526,-0x1.2db16eeb6a1bdp-21,-0x1.be579a83dc79p-17},
+        {527,0x1.288399d2ba788p-19,-0x1.cfeea312b90ep-17},
+        {528,0x1.58d98ecd20a9p-18,-0x1.cb54369f6622ep-17},
+        {529,0x1.0e31705819e7cp-17,-0x1.af2f010c67eb2p-17},
+        {530,0x1.694adf60712cfp-17,-0x1.7bcbc4c355e34p-17},
+        {531,0x1.b7c55c7abd86ep-17,-0x1.332a7e095b082p-17},
+        {532,0x1.f45aeaf8aece8p-17,-0x1.b1ca4c2a898d2p-18},
+        {533,0x1.0d727de6667f2p-16,-0x1.c7c59718b6df5p-19},
+        {534,0x1.145ba60e6a19cp-16,-0x1.10946319d1581p-23},
+        {535,0x1.0e6d7ca36dc24p-16,0x1.a6b5a124f01dcp-19},
+        {536,0x1.f823eb2909daap-17,0x1.a2bbff551001cp-18},
+        {537,0x1.bd1e71cd25a8ap-17,0x1.2ccd8d41e0433p-17},
+        {538,0x1.6fd6ebff71c9dp-17,0x1.76ef3e64fab16p-17},
+        {539,0x1.15811127a7bcp-17,0x1.ac0bbe257079p-17},
+        {540,0x1.680f40b74cb68p-18,0x1.ca0231204e86cp-17},
+        {541,0x1.463da7de0e818p-19,0x1.d06463baee9d8p-17},
+        {542,-0x1.80ca4f38a2a62p-22,0x1.c06c8e8e24dbp-17},
+        {543,-0x1.7e39efab3054p-19,0x1.9cceef3743382p-17},
+        {544,-0x1.49e2d57e9bce5p-18,0x1.696cf84747854p-17},
+        {545,-0x1.b2d656c0b210dp-18,0x1.2af2a93aa2868p-17},
+        {546,-0x1.f75468be7555ep-18,0x1.ccd0dc0098104p-18},
+        {547,-0x1.0bcb9dcc4aefbp-17,0x1.418914f48281ap-18},
+        {548,-0x1.0b37697b4141ep-17,0x1.7a1a2ab8bf936p-19},
+        {549,-0x1.f8c4f81f596cp-18,0x1.1b2c81e3a2109p-20},
+        {550,-0x1.c4fc66d06ee1ep-18,-0x1.bd048477a5a32p-22},
+        {551,-0x1.823db195c7a41p-18,-0x1.9e4885d7aae82p-20},
+        {552,-0x1.37c4d7f75b29p-18,-0x1.36fe26d56b89cp-19},
+        {553,-0x1.d881e457f26efp-19,-0x1.713b5591ad5d6p-19},
+        {554,-0x1.4aa7f3cef8ab9p-19,-0x1.832e42bb7447ep-19},
+        {555,-0x1.9cf055e800f7dp-20,-0x1.74794440fe2a7p-19},
+        {556,-0x1.a553fda83f5aap-21,-0x1.4e0112249a4dap-19},
+        {557,-0x1.d8db773bd27f9p-23,-0x1.18e5b402eb46cp-19},
+        {558,0x1.54dd69452a2d6p-23,-0x1.bb38d1bcb8dc8p-20},
+        {559,0x1.8efaa24a168ap-22,-0x1.467d10fcdd126p-20},
+        {560,0x1.e247d8a3d8d97p-22,-0x1.bc64ac3743951p-21},
+        {561,0x1.cb8fe44c4f04ap-22,-0x1.1202a711ce102p-21},
+        {562,0x1.72b64a2dd9031p-22,-0x1.2717158d38ddap-22},
+        {563,0x1.f776eed596974p-23,-0x1.00c81df636008p-23},
+        {520,0x1.fd6d645c68b4bp-23,0x1.06e8895b129aap-23},
+        {521,0x1.7234fe41b419fp-22,0x1.261bfd4949c98p-22},
+        {522,0x1.c9740be364dacp-22,0x1.0d10ae1e6f4f2p-21},
+        {523,0x1.e38a7d17c227cp-22,0x1.b09ae70b86d04p-21},
+        {524,0x1.9bf86ac13d8dbp-22,0x1.3c60c4d526f22p-20},
+        {525,0x1.9d1688f946ab9p-23,0x1.acef19562772p-20},
+        {526,-0x1.47da5f0b3ca83p-23,0x1.105017ec3fdc4p-19},
+        {527,-0x1.68468ef1e0476p-21,0x1.456bbe43bad24p-19},
+        {528,-0x1.6f5fcd5307198p-20,0x1.6e335fdcd5c22p-19},
+        {529,-0x1.2bbe45b6bd30bp-19,0x1.8257a7b51ecfp-19},
+        {530,-0x1.b1ef727f85629p-19,0x1.79908f4567414p-19},
+        {531,-0x1.2196a6d7f7f1ep-18,0x1.4c7c9fa4fc591p-19},
+        {532,-0x1.6ae625696d78cp-18,0x1.eb1686aad943ap-20},
+        {533,-0x1.af05f0a06c65ap-18,0x1.c7674882487dep-21},
+        {534,-0x1.e76fe4f8278bep-18,-0x1.f0b16e250e16ap-22},
+        {535,-0x1.06bd5191d4316p-17,-0x1.15e770cd4e764p-19},
+        {536,-0x1.0d77f734cb078p-17,-0x1.069dac734e29ap-18},
+        {537,-0x1.0554b4c0abf3ep-17,-0x1.8bf563416850ap-18},
+        {538,-0x1.d9248074e8d42p-18,-0x1.09a829e3df8dap-17},
+        {539,-0x1.84fe00fc33004p-18,-0x1.49f3ea73a15p-17},
+        {540,-0x1.0f473e796a7b7p-18,-0x1.823ca16dc8f46p-17},
+        {541,-0x1.eea652fae6e1ep-20,-0x1.adff633d0f985p-17},
+        {542,0x1.7d7487d37e3b2p-21,-0x1.c938631203f38p-17},
+        {543,0x1.d4c182c435045p-19,-0x1.d0bf1e40bb104p-17},
+        {544,0x1.aa5d8157a828p-18,-0x1.c295154011ebcp-17},
+        {545,0x1.324bccdac076ep-17,-0x1.9e1f15d9ebc8fp-17},
+        {546,0x1.86e9ac2084a6p-17,-0x1.6442de9b29375p-17},
+        {547,0x1.cdc0fbcfdaf11p-17,-0x1.17655a709b4b5p-17},
+        {548,0x1.01256a95d59ecp-16,-0x1.76913d121febep-18},
+        {549,0x1.108ebef6fc85cp-16,-0x1.532f9f2024778p-19},
+        {550,0x1.1419991c6cffap-16,0x1.66d41cb315452p-21},
+        {551,0x1.0b8a35b807189p-16,0x1.00ca55df8d7ep-18},
+        {552,0x1.eee1aafe85be3p-17,0x1.c66c1a0c61128p-18},
+        {553,0x1.b23bdcddc7313p-17,0x1.398208157d0b2p-17},
+        {554,0x1.650d8b08bad57p-17,0x1.7ed71f0072bacp-17},
+        {555,0x1.0c3a055111682p-17,0x1.affe8619d92acp-17},
+        {556,0x1.5a7406bef3d3p-18,0x1.cb309e188462cp-17},
+        {557,0x1.36bb8c64d882ep-19,0x1.d029a0ffc376cp-17},
+        {558,-0x1.a1357a39fff48p-22,0x1.c01e0b30fe43ep-17},
+        {559,-0x1.78e02f2f1df86p-19,0x1.9d90d73ab6514p-17},
+        {560,-0x1.4435ba9a4ee44p-18,0x1.6c10665421c4cp-17},
+        {561,-0x1.ac3d5f0d5ad2ep-18,0x1.2fe12281ceb42p-17},
+        {562,-0x1.f1f306a12cba9p-18,0x1.db3ca80f2f8cp-18},
+        {563,-0x1.0aa943067b7d2p-17,0x1.53b4558ab637fp-18},
+        {564,-0x1.0c571d7348794p-17,0x1.a3165f3930e02p-19},
+        {565,-0x1.002429b8a41cp-17,0x1.6f3abf893d7fdp-20},
+        {566,-0x1.d1cb3fded6adp-18,-0x1.06161ecb9da2ep-23},
+        {567,-0x1.93b034775689ep-18,-0x1.5c620ee8d47c2p-20},
+        {568,-0x1.4ca34ddf5004bp-18,-0x1.1f1953161024p-19},
+        {569,-0x1.02f3f1d5186bp-18,-0x1.6414fae141636p-19},
+        {570,-0x1.783b44808b03p-19,-0x1.813d4b37de6bap-19},
+        {571,-0x1.f1c7fb547c3fdp-20,-0x1.7d00adb203a84p-19},
+        {572,-0x1.1ba253faf665fp-20,-0x1.5f3cfdaa36ec9p-19},
+        {573,-0x1.d14dba1c4c612p-22,-0x1.305705f50b3ep-19},
+        {574,0x1.826b86edbb43ap-27,-0x1.f0cc7ae38b654p-20},
+        {575,0x1.368b6fb9b0595p-22,-0x1.7d0e9ff617f2ap-20},
+        {576,0x1.c80729ef9e621p-22,-0x1.10c3cc0c23f8fp-20},
+        {577,0x1.e2684922dcfdep-22,-0x1.679cfea33f034p-21},
+        {578,0x1.aa8a4270a9d26p-22,-0x1.aa437a333add6p-22},
+        {579,0x1.43d84398e993ap-22,-0x1.b1d111037fd36p-23},
+        {580,0x1.99b39501a8e84p-23,-0x1.55dc3df06da24p-24},
+        {535,0x1.c0378a87de216p-23,0x1.97891e796452ep-24},
+        {536,0x1.530915adfa88ap-22,0x1.e009a12a3e861p-23},
+        {537,0x1.b323d1202bea1p-22,0x1.c4e53d70faaf3p-22},
+        {538,0x1.e3c17f3541d4p-22,0x1.74614cd9784f4p-21},
+        {539,0x1.c420203f4f5p-22,0x1.15937f33fc5c2p-20},
+        {540,0x1.327909868b5a2p-22,0x1.7f2c4f3312796p-20},
+        {541,0x1.fbc7cb9b5b5c2p-27,0x1.efa521fb403afp-20},
+        {542,-0x1.bb7263c996ae4p-22,0x1.2e4db02c01822p-19},
+        {543,-0x1.0eed40e738446p-20,0x1.5c88b074a25ccp-19},
+        {544,-0x1.db6f6554ad068p-20,0x1.7b1fd997dca46p-19},
+        {545,-0x1.6781ea745d92ap-19,0x1.825ea788b6428p-19},
+        {546,-0x1.efac7ad0dd3a6p-19,0x1.6af57169c117cp-19},
+        {547,-0x1.3f4fd29e847ddp-18,0x1.2ec1d1cc6096dp-19},
+        {548,-0x1.854f6c4c78c23p-18,0x1.932e840b9216ep-20},
+        {549,-0x1.c42982e4a1054p-18,0x1.cf9a5ebebf0abp-22},
+        {550,-0x1.f5c763727e848p-18,-0x1.f9dd2669a2ac2p-21},
+        {551,-0x1.0a0fd490d56d8p-17,-0x1.5a70b192b99b8p-19},
+        {552,-0x1.0cddd964f36d6p-17,-0x1.289adb4f6061ep-18},
+        {553,-0x1.011f43c928a8ap-17,-0x1.ab61461c44e7ep-18},
+        {554,-0x1.cae086452a236p-18,-0x1.171bcbb4019d8p-17},
+        {555,-0x1.72d35d8e41e0dp-18,-0x1.54756a2cfe206p-17},
+        {556,-0x1.f7066d967da5ap-19,-0x1.897cb4b0205d4p-17},
+        {557,-0x1.a2b27444f709cp-20,-0x1.b21adff4ca8fap-17},
+        {558,0x1.fdedbe8c3ed31p-21,-0x1.cab6cc5d1418bp-17},
+        {559,0x1.ebbb886a3e7dp-19,-0x1.d083c4177366p-17},
+        {560,0x1.b061cbf3ed0f1p-18,-0x1.c1c41175d70f2p-17},
+        {561,0x1.3290285809f76p-17,-0x1.9df9033061268p-17},
+        {562,0x1.84e63557247cep-17,-0x1.65fb6a0918242p-17},
+        {563,0x1.ca59ee7f8f0d2p-17,-0x1.1bf997c4344ep-17},
+        {564,0x1.febb75e70c652p-17,-0x1.86b476865fc84p-18},
+        {565,0x1.0f6a8a1c5b38cp-16,-0x1.82179d2b870bbp-19},
+        {566,0x1.14550545e785p-16,0x1.d9272351d93a8p-23},
+        {567,0x1.0dcee33bcc544p-16,0x1.bbac8988990ccp-19},
+        {568,0x1.f87ffe369b998p-17,0x1.a13508f7ab932p-18},
+        {569,0x1.c17ca114a66fcp-17,0x1.27687d5eb282ep-17},
+        {570,0x1.79f109d0712d4p-17,0x1.6f0cc13a89f34p-17},
+        {571,0x1.262a3e35a63fp-17,0x1.a44a0211333e2p-17},
+        {572,0x1.96240bd5990d2p-18,0x1.c52107b1ee504p-17},
+        {573,0x1.b748447b185d3p-19,0x1.d0ea0bbdd71abp-17},
+        {574,0x1.3752451e9ee53p-21,0x1.c852e415401c6p-17},
+        {575,-0x1.fb8e35ddff314p-20,0x1.ad42f745ad7cep-17},
+        {576,-0x1.0e267b4c2236bp-18,0x1.82a8416341ce6p-17},
+        {577,-0x1.813856336d3e1p-18,0x1.4c329bc083b36p-17},
+        {578,-0x1.d4afd10e4e988p-18,0x1.0e03d9a9bd77ep-17},
+        {579,-0x1.03b9e0f9685ffp-17,0x1.98b803037e58cp-18},
+        {580,-0x1.0d4f5db6d83fcp-17,0x1.1691d0d3f058cp-18},
+        {581,-0x1.089c307a1719cp-17,0x1.397f180b96f3ep-19},
+        {582,-0x1.efcd5cd88ca8ep-18,0x1.8860e77886602p-21},
+        {583,-0x1.bbf155031c451p-18,-0x1.432d5e9d4a15ep-21},
+        {584,-0x1.7bb77913be9ep-18,-0x1.b4ea9e8da2622p-20},
+        {585,-0x1.352e39229af0ep-18,-0x1.39ad4fe68e27cp-19},
+        {586,-0x1.dbd2e7260f58ap-19,-0x1.705fc75a9198p-19},
+        {587,-0x1.554849da8e6e4p-19,-0x1.830bc5312aab2p-19},
+        {588,-0x1.bbfea572f25bfp-20,-0x1.780aa0a5f3302p-19},
+        {589,-0x1.eb1a3156f42fap-21,-0x1.56c62b3c0ba6bp-19},
+        {590,-0x1.6fb58cfbd2057p-22,-0x1.26f1e0beaab6ap-19},
+        {591,0x1.0adda2de2c76ep-24,-0x1.dfb2656f4eb08p-20},
+        {592,0x1.4f2fec2a8248dp-22,-0x1.6fa234328b4f3p-20},
+        {593,0x1.cebe3dec8eba8p-22,-0x1.07ac222f0d8e8p-20},
+        {594,0x1.e0f8d6648d9fep-22,-0x1.5d68619c4d493p-21},
+        {595,0x1.a7b9a898be65cp-22,-0x1.a208b73f244eap-22},
+        {596,0x1.4358f5e1f3f32p-22,-0x1.b0548e46637dep-23},
+        {597,0x1.9f781a2490ab6p-23,-0x1.5f4089b487accp-24},
+        {551,0x1.0d07ecedb59b3p-22,0x1.25aa6e0ea7fcbp-23},
+        {552,0x1.78ddd166ac834p-22,0x1.32ff391097abap-22},
+        {553,0x1.c9e3f99f87c08p-22,0x1.0e098eb34536p-21},
+        {554,0x1.e43e6b7b9deefp-22,0x1.a79c73b368aa2p-21},
+        {555,0x1.a9385d8c861f6p-22,0x1.311ab9a36962ap-20},
+        {556,0x1.f4573f839093ep-23,0x1.9a3f1cf724e86p-20},
+        {557,-0x1.0fff9088dc3abp-24,0x1.03e188d846d72p-19},
+        {558,-0x1.1284587a53ce4p-21,0x1.37c3345f9ec81p-19},
+        {559,-0x1.2c66d5635e64ap-20,0x1.629b4d65effccp-19},
+        {560,-0x1.f905a7c7749b4p-20,0x1.7d8a15d65d91cp-19},
+        {561,-0x1.74c6b6d1f4e7p-19,0x1.817f70fec147bp-19},
+        {562,-0x1.f9ffbbfa01c3bp-19,0x1.67db94789e37ep-19},
+        {563,-0x1.42836b1c4d2fcp-18,0x1.2b1dac33d5f9ap-19},
+        {564,-0x1.866930336926cp-18,0x1.8f21f4233d8bp-20},
+        {565,-0x1.c3789265a795ap-18,0x1.df3beca0140adp-22},
+        {566,-0x1.f41ae080e5be6p-18,-0x1.d93aba1bb41fdp-21},
+        {567,-0x1.0961e51b21d49p-17,-0x1.4a5e38b54d495p-19},
+        {568,-0x1.0d32732f38acap-17,-0x1.1c349ad041bfep-18},
+        {569,-0x1.03716e16173d5p-17,-0x1.9ad20177fe1f5p-18},
+        {570,-0x1.d581daff9f88ap-18,-0x1.0d35c535dd5cap-17},
+        {571,-0x1.853f15fb670c9p-18,-0x1.49c7fd4d83246p-17},
+        {572,-0x1.170e005dbd7d4p-18,-0x1.7f3960d688e84p-17},
+        {573,-0x1.1be402aa51e12p-19,-0x1.a9bb848be06c2p-17},
+        {574,0x1.10fe43b3d1f1bp-22,-0x1.c5e07aaf047ep-17},
+        {575,0x1.7e5147aa9d29bp-19,-0x1.d0e09c27978d1p-17},
+        {576,0x1.741d8833e7c21p-18,-0x1.c8d77e7f54532p-17},
+        {577,0x1.1363b8ea710a8p-17,-0x1.acf29d40bc603p-17},
+        {578,0x1.66d4f3433119ep-17,-0x1.7d8d450f4bd4cp-17},
+        {579,0x1.afcb417a33684p-17,-0x1.3c36c74111de2p-17},
+        {580,0x1.ea27fa9aa0cep-17,-0x1.d7438a5bfaecdp-18},
+        {581,0x1.0947d76c030dp-16,-0x1.1efaa332433f2p-18},
+        {582,0x1.1353f5c58a3bp-16,-0x1.61d4760355da9p-20},
+        {583,0x1.12a17986ca773p-16,0x1.c9e6e8bc05c9cp-20},
+        {584,0x1.073ae0788a5c6p-16,0x1.37b39b4e35069p-18},
+        {585,0x1.e396816ca4002p-17,0x1.ed7b37ca21af2p-18},
+        {586,0x1.a7239d00c39e7p-17,0x1.458c46230ef5ap-17},
+        {587,0x1.5c95706563148p-17,0x1.84b45356b856fp-17},
+        {588,0x1.081e8e5a46d81p-17,0x1.b1a6e7fdf283fp-17},
+        {589,0x1.5cbfa69c03d06p-18,0x1.cafbe657d6ba3p-17},
+        {590,0x1.505a05b6147cbp-19,0x1.d07fb03810202p-17},
+        {591,-0x1.1a82edc2cdd53p-24,0x1.c32a0c68020d9p-17},
+        {592,-0x1.41e637cd69a34p-19,0x1.a4ff9e3f557fep-17},
+        {593,-0x1.26d59429d42d8p-18,0x1.78e11e68bfab9p-17},
+        {594,-0x1.914c4f6c2e1ap-18,0x1.424cef556ad73p-17},
+        {595,-0x1.dd97ef90f243ep-18,0x1.05189f656b04ep-17},
+        {596,-0x1.0583f4f0ef51cp-17,0x1.8a50b5d253d88p-18},
+        {597,-0x1.0d6df7535f927p-17,0x1.0c54661654055p-18},
+        {598,-0x1.08014a2cc5158p-17,0x1.2d69f19cf2792p-19},
+        {599,-0x1.eebcdd5468facp-18,0x1.75575255c6afap-21},
+        {600,-0x1.bc300b05b679ap-18,-0x1.4070273b7a6bap-21},
+        {601,-0x1.7df018fec99ap-18,-0x1.ad431b76459f3p-20},
+        {602,-0x1.398d2347f9e05p-18,-0x1.350e2fd738efcp-19},
+        {603,-0x1.e859ec878d8a8p-19,-0x1.6d06adedd3f15p-19},
+        {604,-0x1.6470735738078p-19,-0x1.82843d03d3264p-19},
+        {605,-0x1.dc81305a1b316p-20,-0x1.7b368a75d0487p-19},
+        {606,-0x1.1500f199fabf3p-20,-0x1.5dd57b2251f37p-19},
+        {607,-0x1.dd8a1795ff8dep-22,-0x1.3173815018c26p-19},
+        {608,-0x1.23a1ccdd0c8b4p-26,-0x1.f9bf6a150fd14p-20},
+        {609,0x1.1837ae56c1633p-22,-0x1.8c47be6ad7a69p-20},
+        {610,0x1.b6b2dd6eabdcbp-22,-0x1.244d85ed03eb8p-20},
+        {611,0x1.e4fa722b9b612p-22,-0x1.91da66372fa82p-21},
+        {612,0x1.c1e62919cf5ecp-22,-0x1.f9db2069fa283p-22},
+        {613,0x1.6bf2c3319b06ap-22,-0x1.1a66e59b35e58p-22},
+        {614,0x1.fce4fbecbd8e4p-23,-0x1.064ca2925ab8p-23},
+        {567,0x1.e3553d822996ap-23,0x1.d916462ce4feep-24},
+        {568,0x1.5d5158030e5afp-22,0x1.00c0e741747cep-22},
+        {569,0x1.b6102f866706fp-22,0x1.ce85877de3acap-22},
+        {570,0x1.e37dc17610d4p-22,0x1.715acf47a37e2p-21},
+        {571,0x1.ca01ebf24e8a6p-22,0x1.0e329c2313a08p-20},
+        {572,0x1.4d25930f5af9fp-22,0x1.70c6792942a06p-20},
+        {573,0x1.49cc2a5c5649ep-24,0x1.da83db03c5506p-20},
+        {574,-0x1.3b5083a308d27p-22,0x1.218960329a21p-19},
+        {575,-0x1.b46daba4f633ap-21,0x1.4ff8e635c647ap-19},
+        {576,-0x1.8dd62fa1a3a7cp-20,0x1.7281f9ac7aa76p-19},
+        {577,-0x1.333fac825453dp-19,0x1.82af02b053c8ep-19},
+        {578,-0x1.ae910c993cbeep-19,0x1.7a246a50537bep-19},
+        {579,-0x1.19af543078084p-18,0x1.533318006dad4p-19},
+        {580,-0x1.5d28c93f264a7p-18,0x1.0970c8d14c43p-19},
+        {581,-0x1.9d4646e7867fep-18,0x1.3491d0831b954p-20},
+        {582,-0x1.d514097571c2ap-18,0x1.5dfc344d0d331p-25},
+        {583,-0x1.ff6a01a54a32ep-18,-0x1.6537f65892104p-20},
+        {584,-0x1.0ba52e05902afp-17,-0x1.88b892b3b44d9p-19},
+        {585,-0x1.0c236f46eb24cp-17,-0x1.3a6d8ed1db663p-18},
+        {586,-0x1.fee519db2dbfdp-18,-0x1.b63f261980bbep-18},
+        {587,-0x1.c8f8eb7188212p-18,-0x1.18c64fb8380a8p-17},
+        {588,-0x1.75ed0ab3be1d4p-18,-0x1.52b46f39edaf4p-17},
+        {589,-0x1.06f25d02c77fdp-18,-0x1.8555b0870c475p-17},
+        {590,-0x1.fc420fce4709p-20,-0x1.ad351b0aa9036p-17},
+        {591,0x1.ceb9abb6254bap-22,-0x1.c73bd33685457p-17},
+        {592,0x1.8d47c2e25ac2cp-19,-0x1.d0ece5b8aa9d6p-17},
+        {593,0x1.767d4c411a41dp-18,-0x1.c8992c20f9942p-17},
+        {594,0x1.1207b8f421952p-17,-0x1.ad86dffae68b7p-17},
+        {595,0x1.6353d798a469ap-17,-0x1.800949b5719ecp-17},
+        {596,0x1.aaeb4d35e882ap-17,-0x1.418626bae3055p-17},
+        {597,0x1.e4fea001d5ac1p-17,-0x1.e8cf9a150a3fbp-18},
+        {598,0x1.0733dac0ff536p-16,-0x1.37f937181ec86p-18},
+        {599,0x1.1270399239676p-16,-0x1.e22e571f8e04cp-20},
+        {600,0x1.13954a7d5baecp-16,0x1.32377d23b7b59p-20},
+        {601,0x1.0a92cb2ff666bp-16,0x1.0e0cc7ae275d1p-18},
+        {602,0x1.efd0f0428151ap-17,0x1.c2e4965c701f6p-18},
+        {603,0x1.b93a7f80227dp-17,0x1.31698625e7063p-17},
+        {604,0x1.745a787470fb7p-17,0x1.7370d627f0ed2p-17},
+        {605,0x1.24dfc05d4eb7ep-17,0x1.a4e7586f9ca15p-17},
+        {606,0x1.9de172960c05ap-18,0x1.c42b0a8d82658p-17},
+        {607,0x1.db959e91a4ceap-19,0x1.d0aaf1d9b47e4p-17},
+        {608,0x1.080236edd458bp-20,0x1.cae5fdf1454eep-17},
+        {609,-0x1.76a7114cd8cdap-20,0x1.b457495298c8ap-17},
+        {610,-0x1.d50d4c2e46214p-19,0x1.8f51cfae1a7bep-17},
+        {611,-0x1.5f699574f5d0dp-18,0x1.5eceef9780128p-17},
+        {612,-0x1.b8e2a37e1d776p-18,0x1.2633fa8cab766p-17},
+        {613,-0x1.f557b919d3478p-18,0x1.d22740a2ed319p-18},
+        {614,-0x1.0a7dbb8cea4a8p-17,0x1.55e040efca80ap-18},
+        {615,-0x1.0cd22f2a4305dp-17,0x1.bc0b7eddbd4bp-19},
+        {616,-0x1.0344aa2c4f431p-17,0x1.c06a8a7c5b6bcp-20},
+        {617,-0x1.dfea7549586dap-18,0x1.06c54b6273c58p-22},
+        {618,-0x1.aaae4f8ad3f6cp-18,-0x1.f0b58baa18337p-21},
+        {619,-0x1.6bfc0fd774e41p-18,-0x1.e7acc212049dep-20},
+        {620,-0x1.28dacc8bac2eep-18,-0x1.45d359aa4687ep-19},
+        {621,-0x1.cbba2f819ecep-19,-0x1.743db4d3d51b6p-19},
+        {622,-0x1.4dbcd5d6a59e2p-19,-0x1.8322889a77bedp-19},
+        {623,-0x1.bb58254be9146p-20,-0x1.77f55951e0629p-19},
+        {624,-0x1.fe06a598a3fcap-21,-0x1.58f83c74f6c42p-19},
+        {625,-0x1.aa175b00b5b15p-22,-0x1.2ca6f605a6c72p-19},
+        {626,0x1.ae992e00265e7p-28,-0x1.f2623b6a9ee57p-20},
+        {627,0x1.20c763912ec0cp-22,-0x1.8819b1159c289p-20},
+        {628,0x1.b7aa1765cc038p-22,-0x1.23511707b8ba7p-20},
+        {629,0x1.e4f5cc8d74ef8p-22,-0x1.94f9d5ac079d6p-21},
+        {630,0x1.c4f2c558c4918p-22,-0x1.0326d3110bbedp-21},
+        {631,0x1.73a45d18ea9edp-22,-0x1.28c9ac03a3a04p-22},
+        {632,0x1.0a550c20cc832p-22,-0x1.1fa9cab55a5b4p-23},
+        {583,0x1.67d4a65e24dap-23,0x1.09c24a632d3bep-24},
+        {584,0x1.1e1c402c59075p-22,0x1.4d42b8e776566p-23},
+        {585,0x1.8220b5948b91p-22,0x1.45e4f85286fdp-22},
+        {586,0x1.cc1f57bd7f7a8p-22,0x1.1346310c917aep-21},
+        {587,0x1.e46f20a74705ap-22,0x1.a4901000b8ed2p-21},
+        {588,0x1.b135d9b5eab3dp-22,0x1.29b41e78bec84p-20},
+        {589,0x1.1896cd5f1ec3bp-22,0x1.8c16d80106268p-20},
+        {590,0x1.a71b9fcbb037cp-29,0x1.f3660e775fd98p-20},
+        {591,-0x1.a078b949bd2ap-22,0x1.2bb9e8fc2f204p-19},
+        {592,-0x1.ee28e553930b2p-21,0x1.571e56b088ec9p-19},
+        {593,-0x1.abc1dbc8e0aep-20,0x1.76378113273efp-19},
+        {594,-0x1.41546d0adcc16p-19,0x1.83135c5a00234p-19},
+        {595,-0x1.ba693dd002a1fp-19,0x1.77e97fcdd5114p-19},
+        {596,-0x1.1df1c956d74b4p-18,0x1.4f9b6255969c4p-19},
+        {597,-0x1.5f7479ce138a4p-18,0x1.06383f49a58ddp-19},
+        {598,-0x1.9da44ea5ddd0dp-18,0x1.32f33be4587e8p-20},
+        {599,-0x1.d3f45702cff8ap-18,0x1.25a18be0c0079p-24},
+        {600,-0x1.fda9684ccb53dp-18,-0x1.50ff930ac60e4p-20},
+        {601,-0x1.0b15f9086143dp-17,-0x1.76d9dff199cep-19},
+        {602,-0x1.0cafdcc48deb2p-17,-0x1.2d5894717aed4p-18},
+        {603,-0x1.01fd7af2ec062p-17,-0x1.a548dc88b6714p-18},
+        {604,-0x1.d3d5d818bef62p-18,-0x1.0ecb5571d768cp-17},
+        {605,-0x1.882bad94226b2p-18,-0x1.47fc372c791e2p-17},
+        {606,-0x1.21c7899c3bcb4p-18,-0x1.7aef473a51a96p-17},
+        {607,-0x1.462f56e0dba58p-19,-0x1.a46dd5b9d00e3p-17},
+        {608,-0x1.0249a4e99dfbcp-22,-0x1.c188c26b047e2p-17},
+        {609,0x1.2329edcc051e1p-19,-0x1.cfcd4e02e3aa6p-17},
+        {610,0x1.3b6628be5fc53p-18,-0x1.cd7445729e318p-17},
+        {611,0x1.e5c83ce5f3776p-18,-0x1.b987c867dd63p-17},
+        {612,0x1.4464cb08366ep-17,-0x1.93fc82b180314p-17},
+        {613,0x1.8e43151d00feep-17,-0x1.5dbc0d488eefp-17},
+        {614,0x1.ccd187140f4bcp-17,-0x1.189f3ea92f4b2p-17},
+        {615,0x1.fce226bbbb76ap-17,-0x1.8eb0ca03b8376p-18},
+        {616,0x1.0dfd2058f42e7p-16,-0x1.b53a79abe1b7fp-19},
+        {617,0x1.143da1e3f5c17p-16,-0x1.cd95371df545bp-22},
+        {618,0x1.10ded1f689743p-16,0x1.4465ecedb5f1ep-19},
+        {619,0x1.040de15458208p-16,0x1.5a0c340df27cap-18},
+        {620,0x1.dcec0bfd5f221p-17,0x1.0151f93402c4cp-17},
+        {621,0x1.a26ab8a1ba007p-17,0x1.4a68bd67570fep-17},
+        {622,0x1.5b94df3b4a6fp-17,0x1.855d40073613p-17},
+        {623,0x1.0bf793f6bb4c6p-17,0x1.b0124736c75a4p-17},
+        {624,0x1.6eed639a34202p-18,0x1.c954f3a1c405p-17},
+        {625,0x1.883de5c004603p-19,0x1.d0e7542f015e8p-17},
+        {626,0x1.f36d87bdbc6fp-22,0x1.c77ac64a09fa1p-17},
+        {627,-0x1.e342ad9362452p-20,0x1.ae9b0116328ccp-17},
+        {628,-0x1.fc2d68b41bf3ap-19,0x1.888bc8e0d824cp-17},
+        {629,-0x1.6c1d815354988p-18,0x1.581c3775813dp-17},
+        {630,-0x1.bff9320640582p-18,0x1.2073330568eacp-17},
+        {631,-0x1.f861750815aa4p-18,0x1.c9b2176fefc44p-18},
+        {632,-0x1.0ad3346b84b55p-17,0x1.510484b12560dp-18},
+        {633,-0x1.0cc58e5349716p-17,0x1.b97ccbd3d188p-19},
+        {634,-0x1.0384ff356804p-17,0x1.c79e6d0d3376cp-20},
+        {635,-0x1.e208f54cfeba4p-18,0x1.4737a0122e648p-22},
+        {636,-0x1.af03d04d3b89ep-18,-0x1.c7196f9468c78p-21},
+        {637,-0x1.72b40332723a2p-18,-0x1.d295e8eb0612cp-20},
+        {638,-0x1.31bc68844ca18p-18,-0x1.3d28d2a8d75p-19},
+        {639,-0x1.e0bde7651e5ecp-19,-0x1.6f106ebf8540cp-19},
+        {640,-0x1.648207429bf8ep-19,-0x1.827ed4f8a20b1p-19},
+        {641,-0x1.e905f412c981dp-20,-0x1.7c459329c533cp-19},
+        {642,-0x1.29888f87ab502p-20,-0x1.6207d885940f2p-19},
+        {643,-0x1.1e1fe13083e81p-21,-0x1.39b806e6d3fd1p-19},
+        {644,-0x1.ad3c0b0c8b54ep-24,-0x1.091fe5810a04cp-19},
+        {645,0x1.a688dac91ba2ep-23,-0x1.aaf79919fef74p-20},
+        {646,0x1.8f1dfa6d6a8b5p-22,-0x1.465d718196aeep-20},
+        {647,0x1.de2ca299f30b6p-22,-0x1.d649f834a4d0ap-21},
+        {648,0x1.d9cf1d94bab86p-22,-0x1.3b923fe374a25p-21},
+        {649,0x1.9c20e52b15086p-22,-0x1.826a5fc7cd69p-22},
+        {650,0x1.3da66e3cac9b9p-22,-0x1.9fd96834bdfdep-23},
+        {651,0x1.a70007d1fa1dcp-23,-0x1.6ba2e29e2e314p-24},
+        {600,0x1.7f814cc678d25p-23,0x1.2c7dd259f4e9ep-24},
+        {601,0x1.271f88ddc297ep-22,0x1.63858fe1ffd52p-23},
+        {602,0x1.8741182d2c965p-22,0x1.50e2780528da2p-22},
+        {603,0x1.cda3c0ad2d538p-22,0x1.16fd71939ae7ep-21},
+        {604,0x1.e46eb45cde4f6p-22,0x1.a4a489e6092aap-21},
+        {605,0x1.b3dff67da4fbcp-22,0x1.271cc4afc018ap-20},
+        {606,0x1.2432a2a1520c5p-22,0x1.86652ad352e06p-20},
+        {607,0x1.fe0fd0fcfd37dp-26,0x1.eab605ef3b412p-20},
+        {608,-0x1.69e6a991b475ep-22,0x1.2657348ffbb7dp-19},
+        {609,-0x1.c1668fbb9bc1ap-21,0x1.51a121bb7f2c4p-19},
+        {610,-0x1.8ac5a474f72a5p-20,0x1.7215805688aa4p-19},
+        {611,-0x1.2afb4b33d3474p-19,0x1.82427fff8a5fap-19},
+        {612,-0x1.9e3ca059bf503p-19,0x1.7cc902f5b903ep-19},
+        {613,-0x1.0d57221faeabap-18,0x1.5cca58acc3ae9p-19},
+        {614,-0x1.4d2dd8b7853f4p-18,0x1.1e5ac980eac83p-19},
+        {615,-0x1.8b0597b894d37p-18,0x1.7de02b9d02ba6p-20},
+        {616,-0x1.c2ca28b22546fp-18,0x1.ee14522148173p-22},
+        {617,-0x1.f02948d2c0714p-18,-0x1.8fa1c2f5d547ep-21},
+        {618,-0x1.076b73e6b5206p-17,-0x1.2292571f17acbp-19},
+        {619,-0x1.0d6c0af4aae73p-17,-0x1.f87c51b094b63p-19},
+        {620,-0x1.0867c0c88e838p-17,-0x1.6ee4452e1b136p-18},
+        {621,-0x1.ee45e4c0cf4e4p-18,-0x1.e4626fc9b04a6p-18},
+        {622,-0x1.b1e8b0a3aced4p-18,-0x1.2b9726d41a708p-17},
+        {623,-0x1.5bb9a8db63db4p-18,-0x1.60aae904bba4ep-17},
+        {624,-0x1.da55eba367747p-19,-0x1.8e6aad6c55b24p-17},
+        {625,-0x1.a491c6bc36f36p-20,-0x1.b1fa73708b763p-17},
+        {626,0x1.607bfc2aaa778p-21,-0x1.c8d314f7327bcp-17},
+        {627,0x1.99def785a4df6p-19,-0x1.d0ee72c35edcp-17},
+        {628,0x1.730530dcc5bdcp-18,-0x1.c8ed87dc9a8cep-17},
+        {629,0x1.0b9d26c45290fp-17,-0x1.b0357b087bf36p-17},
+        {630,0x1.591d994f20918p-17,-0x1.870153ee5a2f8p-17},
+        {631,0x1.9e708b80b006ap-17,-0x1.4e66ba8f71c8ep-17},
+        {632,0x1.d84e4cc13d198p-17,-0x1.084d0d2920846p-17},
+        {633,0x1.01f6625c2f818p-16,-0x1.6eae21cdc7f56p-18},
+        {634,0x1.0f9541c196a34p-16,-0x1.7b01e6b674df4p-19},
+        {635,0x1.1457fedca22a4p-16,-0x1.18b4978e86ap-24},
+        {636,0x1.10024f4b8a76fp-16,0x1.69d4f344e137cp-19},
+        {637,0x1.02cb19b601e62p-16,0x1.66a2859e528a8p-18},
+        {638,0x1.dab229d781f42p-17,0x1.04b6a84ab1ecdp-17},
+        {639,0x1.a1711b4911852p-17,0x1.4b638f334a174p-17},
+        {640,0x1.5c96179351eb2p-17,0x1.84ad24dba59fcp-17},
+        {641,0x1.0f63faf54bfep-17,0x1.aea2a0d6e6834p-17},
+        {642,0x1.7ad791e4441c8p-18,0x1.c8242fa70de4cp-17},
+        {643,0x1.a95dde7339e16p-19,0x1.d0ec81a23f90ap-17},
+        {644,0x1.9b4c675f5fa1cp-21,0x1.c98cadd69fc1fp-17},
+        {645,-0x1.89e2d0943ff3cp-20,0x1.b35b1170714ccp-17},
+        {646,-0x1.ced29001140fp-19,0x1.9056bade3fc2ap-17},
+        {647,-0x1.570e00ebac2e1p-18,0x1.6301b31025854p-17},
+        {648,-0x1.ae6db8ae5e6e1p-18,0x1.2e3508609b9f9p-17},
+        {649,-0x1.ec04a21d347dep-18,0x1.e9e3a7f6134cep-18},
+        {650,-0x1.07e00e234ff5p-17,0x1.74650e1c5fc3p-18},
+        {651,-0x1.0d71d1477f3e4p-17,0x1.017f4296d9fcp-18},
+        {652,-0x1.07ed028895095p-17,0x1.2c2a2f6ccf818p-19},
+        {653,-0x1.f1f7552b98b36p-18,0x1.b10bd5c04b56dp-21},
+        {654,-0x1.c530cd33e10b4p-18,-0x1.b6edacde0aad1p-22},
+        {655,-0x1.8dd062fb3c83p-18,-0x1.733c1b44fed57p-20},
+        {656,-0x1.5029a82c5e32dp-18,-0x1.1a9e9e57f1c98p-19},
+        {657,-0x1.1055207447ea4p-18,-0x1.5a8fdeb7f770bp-19},
+        {658,-0x1.a3ecb72825acbp-19,-0x1.7be8e66356efap-19},
+        {659,-0x1.301fff87f2226p-19,-0x1.8287358fbd806p-19},
+        {660,-0x1.939e8bc781bfap-20,-0x1.7340a17e0c894p-19},
+        {661,-0x1.cfcfaad8ff8fcp-21,-0x1.5370c4f37a2acp-19},
+        {662,-0x1.7fe7354a0f988p-22,-0x1.288adc9970083p-19},
+        {663,0x1.074ead793d298p-26,-0x1.ef6fa2c46ec7p-20},
+        {664,0x1.1ab8e32c81984p-22,-0x1.8b0d07399078ep-20},
+        {665,0x1.af6e0e2c98c0ap-22,-0x1.2b64bcba3f3dcp-20},
+        {666,0x1.e3efd3db3b178p-22,-0x1.ac081d9df24fep-21},
+        {667,0x1.cff5927fcaae2p-22,-0x1.1cf75cc3cb904p-21},
+        {668,0x1.8b4d286d70abap-22,-0x1.59dead4258d3fp-22},
+        {669,0x1.2bef9dd9c6e8cp-22,-0x1.6fd69d808b9f6p-23},
+        {670,0x1.891a02fde73b4p-23,-0x1.3b3ae6965557ap-24},
+        {618,0x1.dd2213aa26fcap-23,0x1.cce820c90696cp-24},
+        {619,0x1.51e70e5bc8428p-22,0x1.dc43579dd201cp-23},
+        {620,0x1.a7716fdd59736p-22,0x1.a1172ba1b20fap-22},
+        {621,0x1.dcd2191c8c7e2p-22,0x1.47aa759760dbdp-21},
+        {622,0x1.dd234a608a7e9p-22,0x1.db72f1b53f5fdp-21},
+        {623,0x1.925eb213293cep-22,0x1.43e62545b0ba9p-20},
+        {624,0x1.ce44a43e7ec95p-23,0x1.a294d758af012p-20},
+        {625,-0x1.ba3efd19f6e13p-25,0x1.021d0e2ddff06p-19},
+        {626,-0x1.d6c40f2aca9c3p-22,0x1.30cfff81968a5p-19},
+        {627,-0x1.ff25ea769dc81p-21,0x1.5914876bfc85dp-19},
+        {628,-0x1.ab0486552d158p-20,0x1.761dd80e48674p-19},
+        {629,-0x1.3a82627cd11fdp-19,0x1.82e901c9e0d3p-19},
+        {630,-0x1.abe77e0ab10e8p-19,0x1.7a939d4910efep-19},
+        {631,-0x1.12b4d98a19136p-18,0x1.58bbfe38cf917p-19},
+        {632,-0x1.50b926781192cp-18,0x1.19e4758071bbfp-19},
+        {633,-0x1.8ca6fd4066a7bp-18,0x1.77a497bf6d31cp-20},
+        {634,-0x1.c2bcc868aab06p-18,0x1.ef064341ffc47p-22},
+        {635,-0x1.ef031f9a9234ap-18,-0x1.7afc98e4be30cp-21},
+        {636,-0x1.06c401a24df2fp-17,-0x1.16e125c6ff098p-19},
+        {637,-0x1.0d4fdd9d6e519p-17,-0x1.e556a434ad9fap-19},
+        {638,-0x1.099394a20d255p-17,-0x1.61851036f6a9ep-18},
+        {639,-0x1.f4c2f83e07dep-18,-0x1.d39ea919625e2p-18},
+        {640,-0x1.be16fcc999eedp-18,-0x1.21fa1d1235d38p-17},
+        {641,-0x1.6ef16326670eep-18,-0x1.568d9aaa30716p-17},
+        {642,-0x1.0865e5d58e248p-18,-0x1.84c5c94451e56p-17},
+        {643,-0x1.19ac729c5c387p-19,-0x1.a9f7e9b7e559cp-17},
+        {644,0x1.9f4d15c764c0cp-30,-0x1.c3bb6ca5578b8p-17},
+        {645,0x1.334b5c6af097p-19,-0x1.d01116ee3f644p-17},
+        {646,0x1.3a1ae59bec368p-18,-0x1.cd85b26505d54p-17},
+        {647,0x1.db1f92dc3c45fp-18,-0x1.bb4dd1b034048p-17},
+        {648,0x1.3b01eee1d9126p-17,-0x1.995892ad6c283p-17},
+        {649,0x1.820e3aff4c312p-17,-0x1.6857d8a05a5ecp-17},
+        {650,0x1.bf8fc1a54ad53p-17,-0x1.29bd257cea7cdp-17},
+        {651,0x1.f0bf246a2d13p-17,-0x1.bf55f683857f6p-18},
+        {652,0x1.09ad6c34a3bccp-16,-0x1.19b6eb0071549p-18},
+        {653,0x1.12e41e7b52f9ap-16,-0x1.a3ec489ef69fap-20},
+        {654,0x1.1395a99652ac2p-16,0x1.2fa80c9333a62p-20},
+        {655,0x1.0bb9c12b36b7fp-16,0x1.fb990b84e962dp-19},
+        {656,0x1.f75c8eee571f6p-17,0x1.a5a958d13a656p-18},
+        {657,0x1.c863b3abad7e7p-17,0x1.1e823a2077b7cp-17},
+        {658,0x1.8cb197171e906p-17,0x1.5f1f68f6760fp-17},
+        {659,0x1.46fa955f289ep-17,0x1.926f4b0dc5f1fp-17},
+        {660,0x1.f4aeefa398deap-18,0x1.b6e28d8f92befp-17},
+        {661,0x1.54325b8e14394p-18,0x1.cba7e545fee94p-17},
+        {662,0x1.66699535f3d81p-19,0x1.d0b11244d7c32p-17},
+        {663,0x1.823ef633e4554p-22,0x1.c6ac718cfff16p-17},
+        {664,-0x1.dcb80e413361ep-20,0x1.aef3d71cff292p-17},
+        {665,-0x1.eba3ba5c98cf7p-19,0x1.8b721cf38fcc6p-17},
+        {666,-0x1.5ff28f970512dp-18,0x1.5e81676e702fp-17},
+        {667,-0x1.b2f923a1a2749p-18,0x1.2ac48afd32a98p-17},
+        {668,-0x1.ed9c14633cb53p-18,0x1.e5fc76f4cd6dcp-18},
+        {669,-0x1.07ed0d6ea7d6p-17,0x1.73d16f26be5d4p-18},
+        {670,-0x1.0d70eaa4e2671p-17,0x1.0420f6ade8bcep-18},
+        {671,-0x1.0874782826d6dp-17,0x1.36d0c3c9b8748p-19},
+        {672,-0x1.f4f674e29d2fp-18,0x1.eab9dc2874a5ep-21},
+        {673,-0x1.caa48b35c386ep-18,-0x1.352929ef9b1e6p-22},
+        {674,-0x1.95de58ad4cc4ep-18,-0x1.5354d3ece8e3dp-20},
+        {675,-0x1.5a9e992ee6daap-18,-0x1.0ce067963b2bap-19},
+        {676,-0x1.1cb3390757ae2p-18,-0x1.50a3d419ebe1ep-19},
+        {677,-0x1.bf131d3a40c5ep-19,-0x1.76f3256c657dcp-19},
+        {678,-0x1.4c0be69a37fb8p-19,-0x1.831e2dcb00643p-19},
+        {679,-0x1.c9a1d5a9cab95p-20,-0x1.7968898376337p-19},
+        {680,-0x1.18fd235f5c74ap-20,-0x1.5ea68a510a30cp-19},
+        {681,-0x1.133473a911afcp-21,-0x1.37dc0f01352ep-19},
+        {682,-0x1.c506507b25b6cp-24,-0x1.09e3ec923668p-19},
+        {683,0x1.825d87324338p-23,-0x1.b24aa3a1785bep-20},
+        {684,0x1.7dd2272871b06p-22,-0x1.52b601191be66p-20},
+        {685,0x1.d6bd1bda9df91p-22,-0x1.f5b9f5c6d8d1cp-21},
+        {686,0x1.e107c619a7ce4p-22,-0x1.5d9e6144aa822p-21},
+        {687,0x1.b2beb8b252f84p-22,-0x1.c37877afd1542p-22},
+        {688,0x1.611134cf7f25ap-22,-0x1.070d61ede7adp-22},
+        {689,0x1.fdb31a799f8f8p-23,-0x1.0703c3ddd9eb9p-23},
+        {636,0x1.b23dcd8f09cdp-23,0x1.7ea08a9d39f74p-24},
+        {637,0x1.3a8823a0d5fe7p-22,0x1.96f9845c95644p-23},
+        {638,0x1.92aa2749908cp-22,0x1.6ae174fb7ad3bp-22},
+        {639,0x1.d16f7de080c22p-22,0x1.20eb13687b61cp-21},
+        {640,0x1.e43b2f07db117p-22,0x1.a8043977cbd3cp-21},
+        {641,0x1.b7053f3728964p-22,0x1.23f602e988289p-20},
+        {642,0x1.35cb30a5df04p-22,0x1.7d691f0bbcb6p-20},
+        {643,0x1.3904538d8798ap-24,0x1.dbdf9daf3bbd9p-20},
+        {644,-0x1.0e58214f776b4p-22,0x1.1caa30b946d9bp-19},
+        {645,-0x1.74ac59fad64b2p-21,0x1.4732695a5a396p-19},
+        {646,-0x1.513e9845960bep-20,0x1.694f7d6375865p-19},
+        {647,-0x1.035d40f5af629p-19,0x1.7e78117b257dp-19},
+        {648,-0x1.6b69049ba3744p-19,0x1.8217b2dd77d96p-19},
+        {649,-0x1.dd87187201c3p-19,0x1.6fde7a8a8257ep-19},
+        {650,-0x1.2aa1b92419f78p-18,0x1.441643672002cp-19},
+        {651,-0x1.6687a50fec4fcp-18,0x1.f7ef949120268p-20},
+        {652,-0x1.9f3af554df5dp-18,0x1.2bf318ce89adcp-20},
+        {653,-0x1.d133855809d1ap-18,0x1.21225edf28a92p-23},
+        {654,-0x1.f8c9c07516844p-18,-0x1.1c2f4fe06903ep-20},
+        {655,-0x1.0935e3694fc3cp-17,-0x1.4714441975a47p-19},
+        {656,-0x1.0d6b27dc8ed18p-17,-0x1.09d6c64e6b8e8p-18},
+        {657,-0x1.07a6dfe0dcf42p-17,-0x1.768317a1057e4p-18},
+        {658,-0x1.edd3a7ca91076p-18,-0x1.e56b1610cd614p-18},
+        {659,-0x1.b554e30da4a42p-18,-0x1.28f0a7507237dp-17},
+        {660,-0x1.65ccd22be21ecp-18,-0x1.5b7337da9b11cp-17},
+        {661,-0x1.005abc653f452p-18,-0x1.87b4d9a916db6p-17},
+        {662,-0x1.0e8e507830024p-19,-0x1.ab474221a9504p-17},
+        {663,0x1.04056873d84f2p-25,-0x1.c3f99dc5cdd49p-17},
+        {664,0x1.2e59ce7fcffb9p-19,-0x1.cffa482e2edccp-17},
+        {665,0x1.32eef9933567ap-18,-0x1.cdf4aebe9450cp-17},
+        {666,0x1.cf7f18348af1dp-18,-0x1.bd295ab352406p-17},
+        {667,0x1.335f1a8b3cf11p-17,-0x1.9d7e6f3805f7p-17},
+        {668,0x1.7945a0e90cd4p-17,-0x1.6f87586e1cd0dp-17},
+        {669,0x1.b689ced829a5p-17,-0x1.3482f171c00e1p-17},
+        {670,0x1.e8909fa10a0dp-17,-0x1.dca000a726bd3p-18},
+        {671,0x1.069875ce8be07p-16,-0x1.3eb10a43c41f4p-18},
+        {672,0x1.1168a226eef58p-16,-0x1.29d3c5b6db27ap-19},
+        {673,0x1.143f1f5d78955p-16,0x1.a6e351d39c63ep-22},
+        {674,0x1.0efbe308d398ep-16,0x1.91920a40c43ep-19},
+        {675,0x1.01da4fd3a349ep-16,0x1.6fa4f5971830ap-18},
+        {676,0x1.dadbe78f33ad2p-17,0x1.046ff4a146f8ep-17},
+        {677,0x1.a534eefaabaf3p-17,0x1.4782383c2b53p-17},
+        {678,0x1.650e804b5d78fp-17,0x1.7ec667d9c554p-17},
+        {679,0x1.1d1f156db317cp-17,0x1.a88bffbfe0cfap-17},
+        {680,0x1.a0bff4a50cd22p-18,0x1.c3c6dc2399fe6p-17},
+        {681,0x1.03cb3fc5083b9p-18,0x1.d017dc10e0fc8p-17},
+        {682,0x1.a5bc3606de758p-20,0x1.cdcbd39c0af1ap-17},
+        {683,-0x1.455dd39a83b28p-21,0x1.bdd11d5fc35b5p-17},
+        {684,-0x1.5b0c5a55665f8p-19,0x1.a1a4b085a339ap-17},
+        {685,-0x1.21032b4a546eep-18,0x1.7b382325213bp-17},
+        {686,-0x1.80103e608c61ep-18,0x1.4cd267f9e90bcp-17},
+        {687,-0x1.c8bdb334afc52p-18,0x1.18ed5bcd0c36p-17},
+        {688,-0x1.fa4541b38a8fbp-18,0x1.c424ad02c54f8p-18},
+        {689,-0x1.0a7fdb6509f9p-17,0x1.556fd8dab22f8p-18},
+        {690,-0x1.0d2592a7d47f4p-17,0x1.d48b813b08e7ap-19},
+        {691,-0x1.06320747ea1eap-17,0x1.0d2fe4602bc41p-19},
+        {692,-0x1.ee34a9e6c916cp-18,0x1.6cc07bee9a463p-21},
+        {693,-0x1.c31dea6b81862p-18,-0x1.e621f353a4c9p-22},
+        {694,-0x1.8ebe14085e126p-18,-0x1.6f8fb803ed736p-20},
+        {695,-0x1.54b89e2ee6524p-18,-0x1.14b981cbfd093p-19},
+        {696,-0x1.1882ce33dead8p-18,-0x1.541bef2609e6ap-19},
+        {697,-0x1.ba6fcf4120f0ap-19,-0x1.77dfbfd294238p-19},
+        {698,-0x1.4aee34cd5e4f4p-19,-0x1.831ca8163f8f3p-19},
+        {699,-0x1.cd3215e4402f6p-20,-0x1.79c00bddc6008p-19},
+        {700,-0x1.209722a9bf50cp-20,-0x1.6037360199d59p-19},
+        {701,-0x1.268e5cd01be51p-21,-0x1.3b1b3f171e332p-19},
+        {702,-0x1.3154079415076p-23,-0x1.0ee4122ad3c2cp-19},
+        {703,0x1.3f069e71ab6c6p-23,-0x1.bf4e08470325bp-20},
+        {704,0x1.669357abf44cep-22,-0x1.61c87214e1eb3p-20},
+        {705,0x1.cc8873b15de9p-22,-0x1.0ac96a4117bf3p-20},
+        {706,0x1.e4629cd56a287p-22,-0x1.7ca64eb2e168cp-21},
+        {707,0x1.c250fd8801e9p-22,-0x1.fb5c752a90576p-22},
+        {708,0x1.7a11bb1ee25aep-22,-0x1.354708dcc821ep-22},
+        {709,0x1.1d9907b50fde2p-22,-0x1.4beadc4d6637ap-23},
+        {710,0x1.7820b905a87dap-23,-0x1.214ff8b7bd1c6p-24},
+        {654,0x1.536180593c61ep-23,0x1.da9a8ef928c8ep-25},
+        {655,0x1.07f4c106d4b6ep-22,0x1.1a4e73dce8addp-23},
+        {656,0x1.643572d6356e8p-22,0x1.0c71579dad9e6p-22},
+        {657,0x1.b13c896f1856ep-22,0x1.be910bdc6c8dcp-22},
+        {658,0x1.df29c88a33158p-22,0x1.52cca54d9f909p-21},
+        {659,0x1.dc3bd22b3ccfp-22,0x1.dfaec0780ecacp-21},
+        {660,0x1.95e5eb4a99caep-22,0x1.412b909622f28p-20},
+        {661,0x1.f44df70de1cb2p-23,0x1.9a373404ebc08p-20},
+        {662,-0x1.bc2b74f15a878p-28,0x1.f666614d8ae8p-20},
+        {663,-0x1.79a32a8d6c32cp-22,0x1.27e78766db878p-19},
+        {664,-0x1.b277a17866395p-21,0x1.4fafe263b7dd2p-19},
+        {665,-0x1.72482bc791918p-20,0x1.6e958396cdff1p-19},
+        {666,-0x1.13d4c98b3aeb3p-19,0x1.8066b3cf4cf7p-19},
+        {667,-0x1.7aa98860b2d2ap-19,0x1.80f4fccf929fcp-19},
+        {668,-0x1.ea7e7562b28edp-19,0x1.6c5b678156582p-19},
+        {669,-0x1.2f8da8402dcb8p-18,0x1.3f48ae1bbdf8p-19},
+        {670,-0x1.69a7e2c688a9bp-18,0x1.ee915401d9f98p-20},
+        {671,-0x1.a0918720e4e5bp-18,0x1.260fd17b8bd27p-20},
+        {672,-0x1.d10ac7e417b62p-18,0x1.28c4ed7a05df5p-23},
+        {673,-0x1.f7b8e0d452cfbp-18,-0x1.1143f0585846cp-20},
+        {674,-0x1.08aa1ab067bc5p-17,-0x1.3b6347b4ccb4bp-19},
+        {675,-0x1.0d6ccc8390bbp-17,-0x1.0081077649368p-18},
+        {676,-0x1.08ddeeb52526ap-17,-0x1.69a6667aa9b9p-18},
+        {677,-0x1.f4128c350625dp-18,-0x1.d56455453ae57p-18},
+        {678,-0x1.c0c2b0a97c02cp-18,-0x1.1fbed0f6b360dp-17},
+        {679,-0x1.779ec8a9476cdp-18,-0x1.51b22748293fdp-17},
+        {680,-0x1.197b5dd5413d2p-18,-0x1.7e3831031386p-17},
+        {681,-0x1.506cc02a7f27dp-19,-0x1.a30dd8c5ba4dcp-17},
+        {682,-0x1.3580d5c087379p-21,-0x1.be1fa8a9acf6ep-17},
+        {683,0x1.9d2a1d65fec12p-20,-0x1.cda78c732ccebp-17},
+        {684,0x1.fa47967b9b02ep-19,-0x1.d047d0743160dp-17},
+        {685,0x1.95ad85f81eb5p-18,-0x1.c521aa5d13983p-17},
+        {686,0x1.15adda2635428p-17,-0x1.abe5d0cb72a9ep-17},
+        {687,0x1.5c431f33d205ap-17,-0x1.84ddf82f3ff5bp-17},
+        {688,0x1.9bd72a6753d41p-17,-0x1.50ee72b7a7f12p-17},
+        {689,0x1.d1e1c2ac7a122p-17,-0x1.118fa6f21ce46p-17},
+        {690,0x1.fc324b1d3db8dp-17,-0x1.917f1c07081fcp-18},
+        {691,0x1.0c86191d69a7p-16,-0x1.e3af9ab57e8dap-19},
+        {692,0x1.139edc0f2a884p-16,-0x1.26b1eb10a2eabp-20},
+        {693,0x1.1317d9921f22fp-16,0x1.8465a1b005bbdp-20},
+        {694,0x1.0af6b1a693451p-16,0x1.087106b61fc4cp-18},
+        {695,0x1.f723dcf95ea71p-17,0x1.a67ae24e2ad7ep-18},
+        {696,0x1.cb1913e5fb6ap-17,0x1.1ae39f606374ap-17},
+        {697,0x1.939b0efd1873ap-17,0x1.58cb26d6e1ab7p-17},
+        {698,0x1.52e8443fd25dcp-17,0x1.8b074b06e41f2p-17},
+        {699,0x1.0b92820f48783p-17,0x1.b03354dbe2d9ap-17},
+        {700,0x1.80bc33a001874p-18,0x1.c780034d3f4dep-17},
+        {701,0x1.d07cc97a8b9a8p-19,0x1.d0b8f55f4c026p-17},
+        {702,0x1.4cb9e09d5a8e2p-20,0x1.cc41edfd16ec2p-17},
+        {703,-0x1.cab8cace1126p-21,0x1.bb0c4ed7f43a8p-17},
+        {704,-0x1.71ab331097561p-19,0x1.9e859bd4c2647p-17},
+        {705,-0x1.279ed931ddc1ap-18,0x1.78803d13a3004p-17},
+        {706,-0x1.82f521f399cb6p-18,0x1.4b18040b8bc9cp-17},
+        {707,-0x1.c91ef0aa5ae24p-18,0x1.18942be809958p-17},
+        {708,-0x1.f96bfbb14256cp-18,0x1.c6914745ffed5p-18},
+        {709,-0x1.0a15f7dfa6c4ap-17,0x1.5af0d130c5d8dp-18},
+        {710,-0x1.0d4c134250743p-17,0x1.e4ea5010ec8f8p-19},
+        {711,-0x1.07592aa37a142p-17,0x1.218e0172737bcp-19},
+        {712,-0x1.f31ac447d001ap-18,0x1.c7319cb8c1439p-21},
+        {713,-0x1.cae10182e06dep-18,-0x1.2ede527cc910cp-22},
+        {714,-0x1.99522dc536fa6p-18,-0x1.4506dd56f3cb1p-20},
+        {715,-0x1.61c7f9964984cp-18,-0x1.02d93b851afc7p-19},
+        {716,-0x1.277b2b090a044p-18,-0x1.4709a2aedbf1p-19},
+        {717,-0x1.dab839b910556p-19,-0x1.709376d8d24c4p-19},
+        {718,-0x1.6be637731f6eap-19,-0x1.820d7c197ad6cp-19},
+        {719,-0x1.0693c6806b4b5p-19,-0x1.7ee1b6b48bb9dp-19},
+        {720,-0x1.5b7b3a1c8378p-20,-0x1.6b03964876d3p-19},
+        {721,-0x1.8d0d1ac98ffe4p-21,-0x1.4aa60a404e81ep-19},
+        {722,-0x1.3f940d05b3bb1p-22,-0x1.21f624ce0d97bp-19},
+        {723,0x1.178666b09d708p-25,-0x1.e9bc80cf5761p-20},
+        {724,0x1.15437d105ecbdp-22,-0x1.8da96415b2e3ap-20},
+        {725,0x1.a440306c7a49ap-22,-0x1.35700996ac82cp-20},
+        {726,0x1.e037a855ada8ep-22,-0x1.cae67cef165f2p-21},
+        {727,0x1.db54801b9255cp-22,-0x1.415a7aa001f6ep-21},
+        {728,0x1.a81a8415ec38bp-22,-0x1.a2edd42e62dedp-22},
+        {729,0x1.5817b81bde39fp-22,-0x1.f0034596b1962p-23},
+        {730,0x1.f5b13ec260ed6p-23,-0x1.fd68331b3a394p-24},
+        {674,0x1.ea757d268e3e2p-23,0x1.e6bd014b4f106p-24},
+        {675,0x1.50420064f84b5p-22,0x1.d6f96278c4814p-23},
+        {676,0x1.9ffa78fa7723p-22,0x1.8c5f8384e6824p-22},
+        {677,0x1.d65c803018f6ep-22,0x1.2f8791204fbdp-21},
+        {678,0x1.e37f05abba1eap-22,0x1.b156dd39e1e52p-21},
+        {679,0x1.b676ea4d07ba6p-22,0x1.2484765b0f14ep-20},
+        {680,0x1.3e70a62c940adp-22,0x1.78d195eb24b78p-20},
+        {681,0x1.afdae7f73076cp-24,0x1.d1d47759404aap-20},
+        {682,-0x1.9b5b0c5b1bb32p-23,0x1.154a7a55d27f6p-19},
+        {683,-0x1.3b87a16d27e7ep-21,0x1.3e7ff636d92c4p-19},
+        {684,-0x1.24d3ac85197cbp-20,0x1.610f36c52411ap-19},
+        {685,-0x1.c7be48eaa606ep-20,0x1.79322507079fep-19},
+        {686,-0x1.41e6409d2e1a9p-19,0x1.8309ae8beca08p-19},
+        {687,-0x1.aa277669fa2d2p-19,0x1.7ad78c4c8dd5ap-19},
+        {688,-0x1.0ca7278d13decp-18,0x1.5d3d323d57904p-19},
+        {689,-0x1.458c5e94af798p-18,0x1.277c4cf2afb69p-19},
+        {690,-0x1.7d3b563d7ef74p-18,0x1.af698ec38385fp-20},
+        {691,-0x1.b0dcc2507f6a3p-18,0x1.b4709a1c59fcep-21},
+        {692,-0x1.dd690a87f7668p-18,-0x1.7d5dd60f10dd6p-23},
+        {693,-0x1.ffcd2a6a82d4fp-18,-0x1.6a926fde0144ep-20},
+        {694,-0x1.0a89daf624e3ep-17,-0x1.67f8ed649cb2dp-19},
+        {695,-0x1.0d47ed4299dfap-17,-0x1.159d11f8edf44p-18},
+        {696,-0x1.0703f7bb884a6p-17,-0x1.7c8bf7b9ab156p-18},
+        {697,-0x1.eddd07a0063b1p-18,-0x1.e541d5bfcc401p-18},
+        {698,-0x1.b92cff5c2927cp-18,-0x1.25e61bd77762ap-17},
+        {699,-0x1.6fecb2f5ac182p-18,-0x1.55fbb99b1607cp-17},
+        {700,-0x1.12f86477666acp-18,-0x1.80bf6cc8d53c6p-17},
+        {701,-0x1.4831ac2e44112p-19,-0x1.a42063eb36f86p-17},
+        {702,-0x1.2fe1cfd95aa9ap-21,-0x1.be39ebb0c6162p-17},
+        {703,0x1.8f74e0e1d59c7p-20,-0x1.cd6d2004e928ap-17},
+        {704,0x1.ea80fd1ca3177p-19,-0x1.d0783d69b1c38p-17},
+        {705,0x1.8971984b113b7p-18,-0x1.c68a2fba349cep-17},
+        {706,0x1.0daefc50e9007p-17,-0x1.af5127c11c438p-17},
+        {707,0x1.52ea93d1f67ecp-17,-0x1.8b0341931645ap-17},
+        {708,0x1.91e255d3cdd5ep-17,-0x1.5a6096c185016p-17},
+        {709,0x1.c83a09863f37p-17,-0x1.1eae747681bb3p-17},
+        {710,0x1.f3def1b7caf1p-17,-0x1.b357a174d4b7cp-18},
+        {711,0x1.0990948007356p-16,-0x1.1afefac328bf6p-18},
+        {712,0x1.12643de016aecp-16,-0x1.e507a1a6f3a4bp-20},
+        {713,0x1.1411cb4bf9a2ep-16,0x1.643171313cde8p-21},
+        {714,0x1.0e8857c94205cp-16,0x1.a1a3ca7241122p-19},
+        {715,0x1.01ff96b2d0e0ep-16,0x1.6e2ac24c9e4ecp-18},
+        {716,0x1.ddea34ef9e382p-17,0x1.ff6934b6f7977p-18},
+        {717,0x1.ac4c6b6b753d4p-17,0x1.3ff7363bcd5ffp-17},
+        {718,0x1.710d9d4092552p-17,0x1.75eb80a5b130dp-17},
+        {719,0x1.2e6b4fdf80014p-17,0x1.a011e867c2a87p-17},
+        {720,0x1.cdbb16f473deep-18,0x1.bd6b86dc0506ep-17},
+        {721,0x1.39f2b6b89c6d9p-18,0x1.cd82153e03a93p-17},
+        {722,0x1.4d4a794b8b36p-19,0x1.d0690612b8972p-17},
+        {723,0x1.8bd853801bc77p-22,0x1.c6b7dcf68d43p-17},
+        {724,-0x1.ad306c522d01p-20,0x1.b17e3fc01746ap-17},
+        {725,-0x1.c33fda4035ca5p-19,0x1.923293311b892p-17},
+        {726,-0x1.472b2b5b7efd1p-18,0x1.6a9c3e30e4d8bp-17},
+        {727,-0x1.99b903b485a86p-18,0x1.3cbae4917af2cp-17},
+        {728,-0x1.d7ff67ea0f64p-18,0x1.0aac0ac65cdb9p-17},
+        {729,-0x1.00cfc33e15986p-17,0x1.ad213a8ddd7d7p-18},
+        {730,-0x1.0b8d3ded3c765p-17,0x1.44e7915f4e34p-18},
+        {731,-0x1.0cddb8c9296bcp-17,0x1.c0d1b29a1fe5dp-19},
+        {732,-0x1.05bc77141abc4p-17,0x1.05c8f7f44a2cep-19},
+        {733,-0x1.eecf8408150ecp-18,0x1.77f688c0f200ep-21},
+        {734,-0x1.c698530746956p-18,-0x1.95198a7a8fbf6p-22},
+        {735,-0x1.95ddeb82802bap-18,-0x1.53312dc561be1p-20},
+        {736,-0x1.5fb2143966604p-18,-0x1.05ca25486f734p-19},
+        {737,-0x1.2706bf68b202dp-18,-0x1.4771a10d5aba8p-19},
+        {738,-0x1.dd184b01492aap-19,-0x1.6ff4ac335a08cp-19},
+        {739,-0x1.712b16c946df9p-19,-0x1.81b1ea2f59aeep-19},
+        {740,-0x1.0e0b700d856bdp-19,-0x1.7fc58be2acdefp-19},
+        {741,-0x1.6d0e4b6dafd26p-20,-0x1.6dc972c0594d9p-19},
+        {742,-0x1.b1b6dca2ad132p-21,-0x1.4f950dfaa0212p-19},
+        {743,-0x1.84c6cc4859bb8p-22,-0x1.2900c55c85622p-19},
+        {744,-0x1.810e4d79f48acp-26,-0x1.fb607939b9557p-20},
+        {745,0x1.d1cf035f17f51p-23,-0x1.a1cc087abb565p-20},
+        {746,0x1.89194382aa7e5p-22,-0x1.4ac4f308baa67p-20},
+        {747,0x1.d6e0849645cbap-22,-0x1.f53ad88ab85c3p-21},
+        {748,0x1.e29919c3e7618p-22,-0x1.68ce47b0f3a41p-21},
+        {749,0x1.bd494e35f786cp-22,-0x1.e7df66762b465p-22},
+        {750,0x1.7771770504a18p-22,-0x1.30064e82dd33ap-22},
+        {751,0x1.201037e15f69fp-22,-0x1.51d3f3de9251ap-23},
+        {752,0x1.87cc2dec39247p-23,-0x1.38fd54baa13f7p-24},
+        {694,0x1.fc5edbf48ac2ap-23,0x1.057fa2355f908p-23},
+        {695,0x1.562d59df27c8p-22,0x1.e9b5bd89b7bdp-23},
+        {696,0x1.a2af7cae3bfefp-22,0x1.93a7779cc8e1ap-22},
+        {697,0x1.d6be1aba2f8b9p-22,0x1.30be21af6854ep-21},
+        {698,0x1.e3bb1b8db2342p-22,0x1.aebc2196c415ap-21},
+        {699,0x1.ba2488fae3bc6p-22,0x1.20b97a4b0638ap-20},
+        {700,0x1.4a87fb1f94393p-22,0x1.7232fd7daaeecp-20},
+        {701,0x1.0d37e19521e64p-23,0x1.c86e8ffbc0944p-20},
+        {702,-0x1.3b1fb556a1dacp-23,0x1.0f7bb976c817ep-19},
+        {703,-0x1.152ea210af1d9p-21,0x1.382c79decc884p-19},
+        {704,-0x1.08de88ad08ac1p-20,0x1.5b25d0eeb2888p-19},
+        {705,-0x1.a1b7e6799e47dp-20,0x1.74fb308d2efbcp-19},
+        {706,-0x1.29816b6cc3d16p-19,0x1.8220ad5a690d8p-19},
+        {707,-0x1.8c70bfc4e7efp-19,0x1.7f1bb7aff78f5p-19},
+        {708,-0x1.f6d8c8debc939p-19,0x1.68b8c512412bp-19},
+        {709,-0x1.3287ca592a83dp-18,0x1.3c4313ea4208p-19},
+        {710,-0x1.6954c7a7c5642p-18,0x1.ef76a6014ef6ap-20},
+        {711,-0x1.9d4f24476d4cp-18,0x1.341388f25fa71p-20},
+        {712,-0x1.cbbcefb514824p-18,0x1.1943b913a6fc9p-22},
+        {713,-0x1.f1cca0cee925p-18,-0x1.aef65101abddcp-21},
+        {714,-0x1.065ba8e51c39ap-17,-0x1.103b122bd878fp-19},
+        {715,-0x1.0cf2b9dbc0cb4p-17,-0x1.c69ef3ee9b967p-19},
+        {716,-0x1.0b8a09ba00a26p-17,-0x1.45020a103d311p-18},
+        {717,-0x1.013c5155f31b5p-17,-0x1.aa392ebcafbdap-18},
+        {718,-0x1.dae12e61beae3p-18,-0x1.07c4301dd6604p-17},
+        {719,-0x1.9fcf0341c94fcp-18,-0x1.389992239958cp-17},
+        {720,-0x1.5189f6cfbb03fp-18,-0x1.65a9eadadb9b4p-17},
+        {721,-0x1.e255c24389e29p-19,-0x1.8d03750179b53p-17},
+        {722,-0x1.0138828d8f366p-19,-0x1.accc4f97e89a4p-17},
+        {723,-0x1.484465c6e78b6p-25,-0x1.c3596109b6222p-17},
+        {724,0x1.0b23cc7453733p-19,-0x1.cf4411c069caap-17},
+        {725,0x1.13ce69f3e9ac8p-18,-0x1.cf7dae146c16ep-17},
+        {726,0x1.a3b85300250d5p-18,-0x1.c35f562929f96p-17},
+        {727,0x1.184ff497f7357p-17,-0x1.aab589d154daap-17},
+        {728,0x1.5ae213e2f38bep-17,-0x1.85c69528512bep-17},
+        {729,0x1.97436330b4456p-17,-0x1.5553652fe2f44p-17},
+        {730,0x1.cb4fface28449p-17,-0x1.1a9296b8ac88ep-17},
+        {731,0x1.f527969fc5943p-17,-0x1.ae4bc1b20b75ep-18},
+        {732,0x1.09a1a1bc17fa2p-16,-0x1.1a14953085f66p-18},
+        {733,0x1.12439888284ccp-16,-0x1.f41f24ba81c73p-20},
+        {734,0x1.1427dc5866b92p-16,0x1.1fa00fd35f6d4p-21},
+        {735,0x1.0f3c741b5368cp-16,0x1.879be7511850ep-19},
+        {736,0x1.03b0157fa152dp-16,0x1.5d815c88ae563p-18},
+        {737,0x1.e3dffa283fbabp-17,0x1.ec4b7ce58fd1ep-18},
+        {738,0x1.b545cec1d1524p-17,0x1.35ef0126b33f4p-17},
+        {739,0x1.7d42de569e507p-17,0x1.6c45df1a43238p-17},
+        {740,0x1.3dd86ff8cd912p-17,0x1.97b6b4dd24d62p-17},
+        {741,0x1.f281a39eedd7cp-18,0x1.b73e5dd7007cp-17},
+        {742,0x1.63ac434137d51p-18,0x1.ca524f48dbaabp-17},
+        {743,0x1.a7e0ced100a89p-19,0x1.d0e2f636246d4p-17},
+        {744,0x1.1f974b756c952p-20,0x1.cb585a59d6649p-17},
+        {745,-0x1.e19c3f3811b27p-21,0x1.ba89560d7fa38p-17},
+        {746,-0x1.693b7bb1d7d18p-19,0x1.9fadfac9ad393p-17},
+        {747,-0x1.1e3f811a380c2p-18,0x1.7c4df7935c136p-17},
+        {748,-0x1.76bd9dff86685p-18,0x1.522c06d969cfp-17},
+        {749,-0x1.bc8a7072c2954p-18,0x1.232f897388c0ap-17},
+        {750,-0x1.eeeaf4a47fae7p-18,0x1.e29b064a22dd7p-18},
+        {751,-0x1.06f8d432a92f6p-17,0x1.7ce453acc4ddbp-18},
+        {752,-0x1.0d37fe674489fp-17,0x1.18d848bd74854p-18},
+        {753,-0x1.0aefc91542e34p-17,0x1.7369c7d839454p-19},
+        {754,-0x1.01226dcd915cap-17,0x1.88ee16f829a56p-20},
+        {755,-0x1.e20d0fb5c7114p-18,0x1.49ba1cbaa23e2p-22},
+        {756,-0x1.b7e973f986d79p-18,-0x1.6ccf93d02c2d8p-21},
+        {757,-0x1.86aa1974d7686p-18,-0x1.8ddbdd76cee38p-20},
+        {758,-0x1.511a0a0285812p-18,-0x1.1956c4c1974p-19},
+        {759,-0x1.19deb2013ebfp-18,-0x1.52f2f0ccb4d66p-19},
+        {760,-0x1.c6b80d87b1352p-19,-0x1.7547282bc0b9cp-19},
+        {761,-0x1.5f3d17f870302p-19,-0x1.82aa22c068b4dp-19},
+        {762,-0x1.0097e18087972p-19,-0x1.7e1007cb51ac2p-19},
+        {763,-0x1.5a6a3a7dc132ep-20,-0x1.6ad2ddd0dc586p-19},
+        {764,-0x1.9a7d4d1c339d4p-21,-0x1.4c7b55e808f97p-19},
+        {765,-0x1.6c3ed98eca4f2p-22,-0x1.268d03521327cp-19},
+        {766,-0x1.daa27ea7a5912p-27,-0x1.f8b13b94183fbp-20},
+        {767,0x1.d25711f5b7b7dp-23,-0x1.a1acb2cd78973p-20},
+        {768,0x1.85e0438905386p-22,-0x1.4d136b4abcc97p-20},
+        {769,0x1.d46bacba8832bp-22,-0x1.fdbdca02e4c5p-21},
+        {770,0x1.e3c03332b68dep-22,-0x1.73d6aa052477p-21},
+        {771,0x1.c377fa19b8a44p-22,-0x1.ffeb75f938e48p-22},
+        {772,0x1.82cac7b2958fep-22,-0x1.4725bc36ad4cdp-22},
+        {773,0x1.2faf4bbd967f8p-22,-0x1.7971131087e43p-23},
+        {774,0x1.ac61b10596226p-23,-0x1.7464b501e013cp-24},
+        {714,0x1.e26019d4517bp-23,0x1.d6b6cad4758c7p-24},
+        {715,0x1.4775cb400c9fap-22,0x1.bc0d393ac8c0ap-23},
+        {716,0x1.94d1a0894dca4p-22,0x1.6ff1e92726bbap-22},
+        {717,0x1.cdb4dbdfed69cp-22,0x1.170898d1423c8p-21},
+        {718,0x1.e4faa4a66986cp-22,0x1.8c23a3b52c584p-21},
+        {719,0x1.cc868ae4f4308p-22,0x1.0aca51d4415a5p-20},
+        {720,0x1.760df6f25fb56p-22,0x1.57e4d1b36befdp-20},
+        {721,0x1.a8089ce37f4e6p-23,0x1.aa9b2610ba416p-20},
+        {722,-0x1.2b0cbd7f87a03p-25,0x1.ff296ca7307b8p-20},
+        {723,-0x1.7f20d772d988p-22,0x1.286edf87e0c6ap-19},
+        {724,-0x1.9f3177c07a156p-21,0x1.4d1c863a51613p-19},
+        {725,-0x1.58e4259c42bebp-20,0x1.6a9081b9a64dap-19},
+        {726,-0x1.fa639b260b602p-20,0x1.7d90ee1c43d1ep-19},
+        {727,-0x1.58a68004d55a4p-19,0x1.82dedb48b8785p-19},
+        {728,-0x1.bca16ed9f6f8ap-19,0x1.776319472b98bp-19},
+        {729,-0x1.13164fc92012cp-18,0x1.585dff698c4dcp-19},
+        {730,-0x1.48cc4f53643fep-18,0x1.2397af8854b3dp-19},
+        {731,-0x1.7d4af11fbb076p-18,0x1.af1c365001cdfp-20},
+        {732,-0x1.ae2cb19bad36ap-18,0x1.ce77ee54b97ecp-21},
+        {733,-0x1.d8e5ab5ad654cp-18,-0x1.f6ff233923517p-25},
+        {734,-0x1.fadf244b15becp-18,-0x1.32d85e2d7504p-20},
+        {735,-0x1.08cb0f4266f9cp-17,-0x1.3e7d6e0dcb7fep-19},
+        {736,-0x1.0d5dc01e9a2b2p-17,-0x1.f35c240828c0ep-19},
+        {737,-0x1.0a2a1c39720d6p-17,-0x1.59a40cf5c7343p-18},
+        {738,-0x1.fcd7ad5d914cdp-18,-0x1.bc4a7384f84a8p-18},
+        {739,-0x1.d34ac0ebcb378p-18,-0x1.0f36128c11d2bp-17},
+        {740,-0x1.9755cfc3196fep-18,-0x1.3e493734e2e29p-17},
+        {741,-0x1.49543fe30794ap-18,-0x1.6993b453ddf23p-17},
+        {742,-0x1.d4b8f6acca64fp-19,-0x1.8f4df17c2a48ap-17},
+        {743,-0x1.f0fe37d320efep-20,-0x1.adc78cbe6fb1p-17},
+        {744,-0x1.80068324900fbp-26,-0x1.c37b28b72c382p-17},
+        {745,0x1.057fa42ac37d5p-19,-0x1.cf212ffef9912p-17},
+        {746,0x1.0cd7e38cc49fcp-18,-0x1.cfc095849eebcp-17},
+        {747,0x1.98bb59ad3d539p-18,-0x1.c4bcabd6cfc08p-17},
+        {748,0x1.110fc011157eap-17,-0x1.addf4cfb34ce4p-17},
+        {749,0x1.525357ebc66aap-17,-0x1.8b5eb7a7131fap-17},
+        {750,0x1.8e06ab2ef1daep-17,-0x1.5ddebb528ac5ep-17},
+        {751,0x1.c22b7c6dfa266p-17,-0x1.266d07e966132p-17},
+        {752,0x1.ecfc84d3018b6p-17,-0x1.ccf1692874c34p-18},
+        {753,0x1.06805ea794e38p-16,-0x1.3f8a9f8728814p-18},
+        {754,0x1.108dc997e7c2dp-16,-0x1.5168172f420a9p-19},
+        {755,0x1.144c9d215f2cap-16,-0x1.9b67e92ef747fp-23},
+        {756,0x1.119b3f9249f76p-16,0x1.1ebee8d0056eap-19},
+        {757,0x1.0891dab7e3069p-16,0x1.2757dd1e5f1d5p-18},
+        {758,0x1.f3029c275dc9ap-17,0x1.b694f38f4f4f3p-18},
+        {759,0x1.c9df5371eab74p-17,0x1.1c7aefd8e72b4p-17},
+        {760,0x1.9724bdf34b5d2p-17,0x1.556d6c8560f4ep-17},
+        {761,0x1.5c8ce2513ff28p-17,0x1.84a3ffb686417p-17},
+        {762,0x1.1c0e137d85a86p-17,0x1.a9004ccfb3c4cp-17},
+        {763,0x1.af8b9b14ee102p-18,0x1.c1ccc68548252p-17},
+        {764,0x1.23c49e06584a6p-18,0x1.cec12b061626bp-17},
+        {765,0x1.32300abaa5763p-19,0x1.d002229cd0bccp-17},
+        {766,0x1.39f95a8def33ep-22,0x1.c61c21e31981ap-17},
+        {767,-0x1.a3a690c6603ap-20,0x1.b1f9ecb4813fap-17},
+        {768,-0x1.b292e79875c0bp-19,0x1.94d74cffb75ccp-17},
+        {769,-0x1.3ae1a87d4dfa4p-18,0x1.7030bd818db4p-17},
+        {770,-0x1.8bc33fe53ba33p-18,0x1.45b0ea141256p-17},
+        {771,-0x1.cab8f4d8bfc54p-18,0x1.171cfbf18a212p-17},
+        {772,-0x1.f7490cbcde446p-18,0x1.cc815e88db329p-18},
+        {773,-0x1.08d7585d33e4ap-17,0x1.69b6512e9d8e8p-18},
+        {774,-0x1.0d65c5b1005bep-17,0x1.091ad9f3cc8eep-18},
+        {775,-0x1.0a096059110c3p-17,0x1.5b2d01f9c5e72p-19},
+        {776,-0x1.ff6ea128b98fdp-18,0x1.66783171737e1p-20},
+        {777,-0x1.df22ad170044cp-18,0x1.e443565e1c78ap-23},
+        {778,-0x1.b5ab99ad73f68p-18,-0x1.83d7add21828ep-21},
+        {779,-0x1.859f0c83fbdbcp-18,-0x1.919f25084b43p-20},
+        {780,-0x1.518cad9871574p-18,-0x1.18bf96a5c7f93p-19},
+        {781,-0x1.1be20518a0da8p-18,-0x1.51414e7886a5fp-19},
+        {782,-0x1.cda4ba7aff892p-19,-0x1.73b4e3e4ce432p-19},
+        {783,-0x1.68872ad18d0f7p-19,-0x1.823773c0f26b1p-19},
+        {784,-0x1.0b80ff4ed63bap-19,-0x1.7f75ab70d72dcp-19},
+        {785,-0x1.71c428388a303p-20,-0x1.6e7bb2e3291cfp-19},
+        {786,-0x1.c8c0fb6ac2ac4p-21,-0x1.52852345805c5p-19},
+        {787,-0x1.c16db90cda24ap-22,-0x1.2ecf955db6842p-19},
+        {788,-0x1.5d1abda58117fp-24,-0x1.0671fb12d3b82p-19},
+        {789,0x1.62c8fe13ffa98p-23,-0x1.b8750b13a5e3ap-20},
+        {790,0x1.6101cf4359f1p-22,-0x1.6528a99a9e937p-20},
+        {791,0x1.c2f91d598cec4p-22,-0x1.16eb40d5ab801p-20},
+        {792,0x1.e49f8952655e4p-22,-0x1.a159ebf37641ap-21},
+        {793,0x1.d4317a1c83884p-22,-0x1.28bf37b76d9a8p-21},
+        {794,0x1.9fe1c9a776688p-22,-0x1.8c0db4094ca22p-22},
+        {795,0x1.5509fe10a5d3p-22,-0x1.e600f7c6d0656p-23},
+        {796,0x1.ff088f26ee844p-23,-0x1.083affa07d28cp-23},
+        {797,0x1.52690d3180179p-23,-0x1.d7b09369dad79p-25},
+    };
+
+    const int ROW_STARTS_1[] = {0,5,10,15,21,26,32,38,44,50,57,63,70,77,84,91,98,106,115,124,132,140,149,158,168,178,189,199,210,221,232,244,256,268,281,294,308,322,337,352,367,383,400,417,434,451,469,487,507,527,548,569,591,613,636,660,684,709,735,761,789,817,846,876,906,938,971,1005,1039,1074,1110,1147,1186,1225,1266,1308,1352,1397,1443,1490,1539,1588,1639,1692,1746,1802,1859,1918,1979,2042,2107,2173,2242,2312,2385,2460,2537};
+
+    const BakedKernelEntry ENTRIES_1[] = {
+        {43,-0x1.64a2935902d48p-19,0x1.82c889192689ep-19},
+        {44,0x1.eb516e98443ddp-25,-0x1.c47612095d596p-17},
+        {45,0x1.5f10441a5d263p-17,0x1.83484ad9daccp-17},
+        {46,-0x1.bb464f30d5218p-18,-0x1.4d9196d3e379cp-21},
+        {47,0x1.6406ac3c4a2a8p-22,-0x1.0ce14dcd24aa3p-22},
+        {44,-0x1.4346e7f2797cap-22,0x1.228555e63aac8p-19},
+        {45,-0x1.c4708475b2eccp-18,-0x1.1d15a1da1a0f4p-17},
+        {46,0x1.13246347f8e9ep-16,0x1.91e1843f6d445p-20},
+        {47,-0x1.fd2f78331b026p-18,0x1.bcbe40e0e599cp-18},
+        {48,0x1.4d3a361431156p-24,-0x1.da769b231f9a3p-20},
+        {45,0x1.e424d4d588f07p-22,0x1.a7e3920c82364p-21},
+        {46,-0x1.0036b8088d5d2p-17,-0x1.6d90a733fd5d8p-20},
+        {47,0x1.96f229d28165fp-17,-0x1.5605a0d96aa54p-17},
+        {48,0x1.9bf1cb84f2b12p-25,0x1.c461732d3fb98p-17},
+        {49,-0x1.c3da62641576p-19,-0x1.764fda6df0512p-19},
+        {46,0x1.66a5d7d3b285ap-23,0x1.098d98c6787bp-24},
+        {47,-0x1.098548acaa69dp-18,0x1.5ff1dc5f7ab8ap-19},
+        {48,0x1.4dfdfa0323c12p-21,-0x1.c8d31afc21303p-17},
+        {49,0x1.9f821e714caccp-17,0x1.4dae5f6f697c8p-17},
+        {50,-0x1.0736559f8ddbap-17,0x1.1bbd2ccf43839p-19},
+        {51,0x1.bb408c18703dcp-22,-0x1.1fa8cd00394bap-20},
+        {48,-0x1.b1358ff046986p-22,0x1.2d7b120cfdd2ep-19},
+        {49,-0x1.f66b1a99b3bf2p-18,-0x1.d047a215be646p-18},
+        {50,0x1.0a01b8326de82p-16,-0x1.172b0487b43f4p-18},
+        {51,-0x1.fa8dcddbdf20ap-19,0x1.89189d0eee19bp-17},
+        {52,-0x1.40430ddf0c1fp-19,-0x1.8354fddb5a88ap-19},
+        {49,0x1.d44bffc8b606ap-22,0x1.29dc07018f65cp-21},
+        {50,-0x1.a636d8d696b84p-18,0x1.0e8c138776332p-20},
+        {51,0x1.4e87fd01d5b22p-18,-0x1.cc57b01a72e8p-17},
+        {52,0x1.55a8bcda5f835p-17,0x1.8991293d83657p-17},
+        {53,-0x1.02fbf1f27a0e6p-17,0x1.b44caf559affep-20},
+        {54,0x1.9181366931fbep-22,-0x1.44b3cab36f8e2p-20},
+        {51,-0x1.78cb625972d5ap-20,0x1.6fc9ae06b8665p-19},
+        {52,-0x1.bbb24507569d4p-18,-0x1.2451420b5d5f8p-17},
+        {53,0x1.0e0691d10fc67p-16,-0x1.b81a40180425ap-19},
+        {54,-0x1.9c78b4233b968p-19,0x1.988fef958cd52p-17},
+        {55,-0x1.c1339e7b204e2p-19,-0x1.76de4199cb3e4p-19},
+        {56,0x1.befe478b6174fp-23,-0x1.96eb2bb82dee4p-24},
+        {52,0x1.e268765ef9dfep-22,0x1.bae040f4590cep-21},
+        {53,-0x1.b6c6aa46d29b8p-18,0x1.7cad16c35a5d4p-21},
+        {54,0x1.0d87c5abd397bp-18,-0x1.d00282711e392p-17},
+        {55,0x1.a0bdc9dcb3082p-17,0x1.4c70b8dae48a4p-17},
+        {56,-0x1.0cf5099c9ae82p-17,0x1.2a9b54ebbe916p-18},
+        {57,-0x1.09285c47877aep-22,-0x1.1c4038a970a66p-19},
+        {54,-0x1.37519e005c8fcp-20,0x1.64e321d3dcfebp-19},
+        {55,-0x1.f65cf0fc28e92p-18,-0x1.d06b67ae0fbd8p-18},
+        {56,0x1.de9ce5f6df5f2p-17,-0x1.fe403651fbd3dp-18},
+        {57,0x1.21b8d24f72d93p-19,0x1.cfffb89d74e18p-17},
+        {58,-0x1.9f1518b1ee8e3p-18,-0x1.2e311371336bap-20},
+        {59,0x1.e3e305dea74cep-22,-0x1.ab950f59fa3fcp-21},
+        {55,0x1.d3fc592b732fap-22,0x1.28eaf5bafad02p-21},
+        {56,-0x1.549694770e95p-18,0x1.1575714e731bdp-19},
+        {57,-0x1.745657691c91bp-20,-0x1.b4ae739ec6fa2p-17},
+        {58,0x1.0f9b5ce3a8c54p-16,0x1.7eede0164ab9ep-19},
+        {59,-0x1.5a2efc4e3382p-18,0x1.61bde1c95185ep-17},
+        {60,-0x1.a409333f78d23p-19,-0x1.7c38b7f7dca91p-19},
+        {61,0x1.2dc993e0517c2p-22,-0x1.75ca81d793252p-23},
+        {57,-0x1.f0a726b08003ap-25,0x1.0330e53951e18p-19},
+        {58,-0x1.06d74ccf52b04p-17,-0x1.153c7e480fbbdp-19},
+        {59,0x1.d54df3e9ebb7ap-18,-0x1.bc8106e621d8fp-17},
+        {60,0x1.913474a1b26a4p-17,0x1.5b5f13074fbd6p-17},
+        {61,-0x1.06f9e4efbe22cp-17,0x1.7ee9e3a79c3dcp-18},
+        {62,-0x1.2d5667bfe438ep-20,-0x1.62f9470e1d788p-19},
+        {58,0x1.c2c11004c5566p-23,0x1.9da5a1420545fp-24},
+        {59,-0x1.0a57f26ee32bap-19,0x1.7fa06dc8b52d9p-19},
+        {60,-0x1.ec36f9b8f5ad6p-18,-0x1.ea6b47ab7a861p-18},
+        {61,0x1.b7a433934ffe8p-17,-0x1.339ee956e42b4p-17},
+        {62,0x1.a29be9086d30ap-18,0x1.c3cc2d7ac6588p-17},
+        {63,-0x1.06cb1b0a9627p-17,0x1.146ada8c198c4p-19},
+        {64,-0x1.616bb400801a8p-23,-0x1.11fe5fa75ff56p-19},
+        {60,0x1.dc38c2e957d82p-22,0x1.45e9093d8451ap-21},
+        {61,-0x1.284147ab5e224p-18,0x1.46ccc5c4936b2p-19},
+        {62,-0x1.29c2a7335c0ep-18,-0x1.77e98c8ed453fp-17},
+        {63,0x1.0a84508b91c34p-16,-0x1.1064b0993790fp-18},
+        {64,0x1.ca533b74693d4p-20,0x1.ce9439f112aebp-17},
+        {65,-0x1.d5f8e9020985cp-18,-0x1.bed4cdb4cd07cp-26},
+        {66,0x1.bc452c5f4f1cdp-23,-0x1.a6a23bd9e7bbbp-20},
+        {62,0x1.56680a9b9e6c7p-22,0x1.6ba484bb08a46p-20},
+        {63,-0x1.a84b0822372fcp-18,0x1.04f95557d215ap-20},
+        {64,-0x1.05ecb520e1ed4p-20,-0x1.b9e1e48c8f772p-17},
+        {65,0x1.14767bfbdf0b9p-16,0x1.49afb835a04bdp-24},
+        {66,-0x1.2617878b229bp-20,0x1.b86d6425d1178p-17},
+        {67,-0x1.a530b5f591eecp-18,-0x1.1327f97b1fe54p-20},
+        {68,0x1.5f7ae3d499d92p-22,-0x1.6647bf10218f8p-20},
+        {64,-0x1.0732b429f1b44p-23,0x1.0c6378fc1d157p-19},
+        {65,-0x1.eec30947092b8p-18,-0x1.7094c200b6161p-21},
+        {66,0x1.cf285cb22e57ap-20,-0x1.cea515f91429dp-17},
+        {67,0x1.10918ddf3e36ep-16,0x1.573df9c8eb7cdp-19},
+        {68,-0x1.404b64ab5b149p-19,0x1.a56d0b47f97dcp-17},
+        {69,-0x1.9185e3a3432d2p-18,-0x1.66270f03288b6p-20},
+        {70,0x1.6956320cd9692p-22,-0x1.603dd8b6049acp-20},
+        {66,-0x1.4e6f3469fd85dp-21,0x1.41a90d810a68p-19},
+        {67,-0x1.059576b19f80ep-17,-0x1.00645d07573dep-19},
+        {68,0x1.ac65f62c8813cp-19,-0x1.d12522f8aadb3p-17},
+        {69,0x1.0d47d640a446fp-16,0x1.d05c94864787ep-19},
+        {70,-0x1.50fe694581cep-19,0x1.a33f49ee6b7d2p-17},
+        {71,-0x1.9d9f5a0d34c72p-18,-0x1.3471ce9d0ae74p-20},
+        {72,0x1.129645de8ffbp-22,-0x1.8f26e8483c8fap-20},
+        {67,0x1.af6825298f12cp-23,0x1.7b8a380e9936p-24},
+        {68,-0x1.012317dcdcc92p-20,0x1.59a20931a7779p-19},
+        {69,-0x1.09532f117da38p-17,-0x1.45c695e9c30edp-19},
+        {70,0x1.c64d29f0c81ap-19,-0x1.d10a51ef09cfep-17},
+        {71,0x1.0f382c483d1abp-16,0x1.8d9fd0dc4da3bp-19},
+        {72,-0x1.acd8cbb4c47b4p-20,0x1.b1c77afe3a4bcp-17},
+        {73,-0x1.c43b5b7b6be22p-18,-0x1.d48b144ce5b9p-22},
+        {74,0x1.95472880dd77ap-27,-0x1.f0d555510156ep-20},
+        {69,0x1.f32224a132997p-23,0x1.fa46765a7e16bp-24},
+        {70,-0x1.0c7f8577941c8p-20,0x1.5c2c0f8cf4891p-19},
+        {71,-0x1.076ee0ee07bbp-17,-0x1.1fdcfb3d37ab1p-19},
+        {72,0x1.35ec54e0c3fa6p-19,-0x1.d0571d4ce3ba8p-17},
+        {73,0x1.13cecd7ea7004p-16,0x1.1ad07b2f322e9p-20},
+        {74,0x1.108d707d0140cp-21,0x1.c802181713ad8p-17},
+        {75,-0x1.f8e7c47d98566p-18,0x1.19e26560b04d4p-20},
+        {76,-0x1.3750c05441774p-21,-0x1.3e03db3cfab22p-19},
+        {77,0x1.56f40512b1bfp-23,-0x1.e75a1a965c6acp-25},
+        {71,0x1.c7422ba55e116p-23,0x1.a5c6b01cea454p-24},
+        {72,-0x1.8b74f14ddfddbp-21,0x1.4a9ebf1bd981fp-19},
+        {73,-0x1.fab145f5dd396p-18,-0x1.2cc788bff42ccp-20},
+        {74,0x1.da04b6c01dccep-25,-0x1.c46e7e70884c8p-17},
+        {75,0x1.115dd4a1b4a4ap-16,-0x1.32466d701f066p-19},
+        {76,0x1.0d3fa1e6a52eap-18,0x1.d0031051e42f8p-17},
+        {77,-0x1.0d8237f9bfd12p-17,0x1.e8b29ec70dc36p-19},
+        {78,-0x1.e63f7e3fcc1c6p-20,-0x1.7c450e2e9fb74p-19},
+        {79,0x1.875265ab173ddp-22,-0x1.51c5fbed327a2p-22},
+        {74,-0x1.5534b495dce8p-22,0x1.24608395b47cp-19},
+        {75,-0x1.cbe4e14fd38adp-18,0x1.1ea5cc8e2d8a2p-22},
+        {76,-0x1.7714a7abb7ba5p-19,-0x1.9e06c3c9b29aap-17},
+        {77,0x1.f528a9e89b9acp-17,-0x1.af7e42b88024cp-18},
+        {78,0x1.1cbe67fecd31bp-17,0x1.a8fdc0474d1p-17},
+        {79,-0x1.eee5a94f0e6c8p-18,0x1.e3d5ca1256b62p-18},
+        {80,-0x1.fe4726183d1ccp-19,-0x1.66db8df342a12p-19},
+        {81,0x1.d3f1c43a1491cp-22,-0x1.ff5a0d9c120bcp-21},
+        {76,0x1.2bea56544ce3cp-23,0x1.c318f733aef8ap-20},
+        {77,-0x1.7275748e23e5ap-18,0x1.d47b71c1aaa38p-20},
+        {78,-0x1.838907293e274p-18,-0x1.4b17187082b64p-17},
+        {79,0x1.817cd857a1158p-17,-0x1.69217ce98d3e8p-17},
+        {80,0x1.bd20c9c5d0d1dp-17,0x1.2d1717f276107p-17},
+        {81,-0x1.2609f424af48p-18,0x1.7972db34023dp-17},
+        {82,-0x1.a9c101d7f531bp-18,-0x1.fc4a67ba0164ap-21},
+        {83,-0x1.4837662537d3ep-23,-0x1.107362a20f3d7p-19},
+        {78,0x1.c0a928d8965a4p-22,0x1.19b06b8cc80f4p-20},
+        {79,-0x1.e9a062ccac67ap-19,0x1.6cfdfc139d48cp-19},
+        {80,-0x1.03af2e6cdcadap-17,-0x1.9a448bc2570c1p-18},
+        {81,0x1.8827e33b1751fp-18,-0x1.c6f2458417884p-17},
+        {82,0x1.1116046b3838ap-16,0x1.3fad248bcbd38p-19},
+        {83,0x1.b023cca14a08ep-20,0x1.ce30d9183f19ap-17},
+        {84,-0x1.0ca4ca7cfd096p-17,0x1.aab0850968634p-19},
+        {85,-0x1.1eef854839bc6p-19,-0x1.81afe471baaa9p-19},
+        {86,0x1.d372625d6e6f4p-22,-0x1.274b47011e76dp-21},
+        {80,0x1.bb468b3c3e509p-22,0x1.e197b01dcb014p-22},
+        {81,-0x1.b5f9bb055d751p-20,0x1.779594c4b0f2p-19},
+        {82,-0x1.04b684ac1b043p-17,-0x1.e602f14db2bbfp-20},
+        {83,-0x1.f06289ede8bfap-21,-0x1.ba7b0bb3fd15ap-17},
+        {84,0x1.fe1aac6fb593dp-17,-0x1.8a7352956b216p-18},
+        {85,0x1.409a40cbdffc7p-17,0x1.9672c4702cb1ap-17},
+        {86,-0x1.a800fa24fbebcp-18,0x1.333e0577f6a62p-17},
+        {87,-0x1.72e0435360375p-18,-0x1.d3233c095c143p-20},
+        {88,0x1.8598bf99a283ep-27,-0x1.f0f9ad506fb1bp-20},
+        {82,0x1.9cab9ab1d050cp-23,0x1.5c08e79f004dp-24},
+        {83,-0x1.1381c739374e4p-23,0x1.0d2a11647fa8ep-19},
+        {84,-0x1.7f1e8813937fp-18,0x1.aa40ca46aa461p-20},
+        {85,-0x1.a9205c9267856p-18,-0x1.326ef7a210b3ap-17},
+        {86,0x1.2ede63c00af1ap-17,-0x1.a020d7b4cb023p-17},
+        {87,0x1.06c4b52efb8f4p-16,0x1.3e37dfda9a1d5p-18},
+        {88,0x1.2cf52ace771e6p-21,0x1.c8616476a295ap-17},
+        {89,-0x1.0c9918028389cp-17,0x1.a89b2ed7a93a9p-19},
+        {90,-0x1.4e026ef7930acp-19,-0x1.8362ecf1d3004p-19},
+        {91,0x1.e46df26ca9561p-22,-0x1.a30ffc825a004p-21},
+        {85,0x1.db039cebea6b2p-22,0x1.e4f5bbb3628d7p-21},
+        {86,-0x1.64b9308b2dd92p-19,0x1.82c194da8d0c6p-19},
+        {87,-0x1.0c8cb8869e666p-17,-0x1.a66ad3596a54ap-19},
+        {88,0x1.f28d517675c88p-25,-0x1.c4734e00a114cp-17},
+        {89,0x1.fec12e60329a8p-17,-0x1.8794060e0ac6dp-18},
+        {90,0x1.5f10c37ca5359p-17,0x1.834233ecd234bp-17},
+        {91,-0x1.5f676902da8bdp-18,0x1.5f13ec05beed8p-17},
+        {92,-0x1.bb4a796441a9bp-18,-0x1.4d1e65d56d12cp-21},
+        {93,-0x1.73ba31332cea6p-21,-0x1.473d6a923bc88p-19},
+        {94,0x1.643494c1bab04p-22,-0x1.0d2435bffcffep-22},
+        {87,0x1.295b86f3815e3p-22,0x1.6a42054a9519ap-23},
+        {88,-0x1.4f20b39ca70e7p-22,0x1.23be9b20df1a4p-19},
+        {89,-0x1.827e43483b498p-18,0x1.9e5f8eea62c62p-20},
+        {90,-0x1.c2ab43fe1aecep-18,-0x1.1e8d88917a03p-17},
+        {91,0x1.e317af2aa96d4p-18,-0x1.ba375172ac6c9p-17},
+        {92,0x1.130041d05f1eap-16,0x1.a53b304ac898bp-20},
+        {93,0x1.278b0520f3d5ep-18,0x1.ced454168b3cp-17},
+        {94,-0x1.fe28efda5f0f8p-18,0x1.b9a596e51d67dp-18},
+        {95,-0x1.3bb0e303ae374p-18,-0x1.3325e9b214e64p-19},
+        {96,0x1.6cb2503ad5061p-24,-0x1.d7cf84a12b024p-20},
+        {97,0x1.68ca7fd424f82p-23,-0x1.0c7e9a5971422p-24},
+        {90,0x1.e42322bb62b8p-22,0x1.a819e06068cfcp-21},
+        {91,-0x1.0f00f19bc91c6p-19,0x1.80273c6c7a192p-19},
+        {92,-0x1.003618d480fd9p-17,-0x1.6dd3af058bb1fp-20},
+        {93,-0x1.b14afcc5031acp-19,-0x1.9556075df71f4p-17},
+        {94,0x1.96f1368baee99p-17,-0x1.55ff92c7ebd4ep-17},
+        {95,0x1.ee13f1eb2e346p-17,0x1.ca254486c0d2bp-18},
+        {96,0x1.a39cda3b58856p-25,0x1.c45e86ce3519cp-17},
+        {97,-0x1.0d990e8c50865p-17,0x1.fd8252669a56ap-19},
+        {98,-0x1.c3f1bff695c94p-19,-0x1.764392c8b767ep-19},
+        {99,0x1.6bec69d51f1cp-22,-0x1.5e9bfd9f17986p-20},
+        {92,0x1.67247b7d84c28p-23,0x1.0a215895f3e2ep-24},
+        {93,0x1.8f93e3fe5e898p-23,0x1.afd9e1637b93p-20},
+        {94,-0x1.0990b17d5b97cp-18,0x1.5fe13ac50f032p-19},
+        {95,-0x1.0cb8aad5b8503p-17,-0x1.30a8fadebdc72p-18},
+        {96,0x1.4e77fba66f292p-21,-0x1.c8cfaa3c3dc2ap-17},
+        {97,0x1.f0a88a832f54p-17,-0x1.c0a76416a3dfep-18},
+        {98,0x1.9f80e6d87bfdcp-17,0x1.4da83d8cc60dep-17},
+        {99,-0x1.5e04a1f8e71a6p-19,0x1.a17d8e7a3dda6p-17},
+        {100,-0x1.0734b2c217ceep-17,0x1.1bdfa59e131f4p-19},
+        {101,-0x1.5cbd41c5d2e04p-19,-0x1.831416811efb2p-19},
+        {102,0x1.bb230ef85edd4p-22,-0x1.1fc63dc940c02p-20},
+        {95,0x1.7602b80e4ec72p-22,0x1.2dfbe7f846129p-22},
+        {96,-0x1.b1c5a39de7104p-22,0x1.2d852bea60dcep-19},
+        {97,-0x1.6c24c37abb074p-18,0x1.e8318d41512dep-20},
+        {98,-0x1.f65d56e7d176ep-18,-0x1.d054845afa22p-18},
+        {99,0x1.d081e0eef1c48p-19,-0x1.d0f5cd2ca6407p-17},
+        {100,0x1.09ff5845aff1dp-16,-0x1.17252d67fe61ep-18},
+        {101,0x1.6855162ce51b9p-17,0x1.7cb748077045ep-17},
+        {102,-0x1.fa69276fc7478p-19,0x1.8919434d0bf4cp-17},
+        {103,-0x1.016a845caaad8p-17,0x1.8b8460bd9b336p-20},
+        {104,-0x1.405c653e54b8ep-19,-0x1.834f3e347dee3p-19},
+        {105,0x1.c067f3df9f9a6p-22,-0x1.19fa0e1060852p-20},
+        {98,0x1.d592414144b28p-22,0x1.2dbabe58564fep-21},
+        {99,-0x1.15fb31775a82ep-20,0x1.5e34c74a24b86p-19},
+        {100,-0x1.a7d54da250429p-18,0x1.06fdecb2fed4cp-20},
+        {101,-0x1.ca2c9115ad0cep-18,-0x1.180f55da574b8p-17},
+        {102,0x1.5366b662f1b5ep-18,-0x1.cbf1cd6855b2fp-17},
+        {103,0x1.0f62429b449b6p-16,-0x1.87265b042a31p-19},
+        {104,0x1.5375e54d4581ap-17,0x1.8af699e9bf1b6p-17},
+        {105,-0x1.09762e410151p-18,0x1.84a1f597b4796p-17},
+        {106,-0x1.028beb42b6c78p-17,0x1.a8e4006444d69p-20},
+        {107,-0x1.5d67428f671c8p-19,-0x1.830d7ea823184p-19},
+        {108,0x1.9514edbad9ae2p-22,-0x1.41f19b0012c28p-20},
+        {101,0x1.e4d167fa0bcb8p-22,0x1.9839355c9a51ap-21},
+        {102,-0x1.78fd65966ec38p-20,0x1.6fcbc8c7e7106p-19},
+        {103,-0x1.bd209d4c4e73p-18,0x1.3943de9ab2f51p-21},
+        {104,-0x1.bba0f423818e2p-18,-0x1.24563b2cea70cp-17},
+        {105,0x1.5a38584f1c77ap-18,-0x1.cb643c31d1712p-17},
+        {106,0x1.0e03ebbe76682p-16,-0x1.b8106fcb43d26p-19},
+        {107,0x1.6a37bfa8fc8f2p-17,0x1.7b57061adc3dbp-17},
+        {108,-0x1.9c521f6ad191ap-19,0x1.988fc62978026p-17},
+        {109,-0x1.0a2d299df0a9bp-17,0x1.59fd7f0e374cap-19},
+        {110,-0x1.c14de0a54352cp-19,-0x1.76d09f46b509fp-19},
+        {111,0x1.c5661afd076a3p-23,-0x1.a4ae4525eca2bp-20},
+        {112,0x1.bf8539c18bc11p-23,-0x1.97b2f1f4ecda2p-24},
+        {104,0x1.e262954e9296cp-22,0x1.bb1fa2db98aeep-21},
+        {105,-0x1.8276d593cb1a3p-20,0x1.71258d896fc8p-19},
+        {106,-0x1.b6cc133bc51dap-18,0x1.7c215e18dd356p-21},
+        {107,-0x1.ced01f26feb55p-18,-0x1.13deab55933b8p-17},
+        {108,0x1.0d946fb4a8556p-18,-0x1.cffc63aaf1618p-17},
+        {109,0x1.05813fa327212p-16,-0x1.4c0ce26a963c8p-18},
+        {110,0x1.a0bc6226776d6p-17,0x1.4c69db178af64p-17},
+        {111,-0x1.25dabc1c766fap-20,0x1.b86b82d51b132p-17},
+        {112,-0x1.0cf01ff32b78ap-17,0x1.2aad13b870dbp-18},
+        {113,-0x1.33b5b1c71df48p-18,-0x1.3b8f2133ede4cp-19},
+        {114,-0x1.09b87c5df943ap-22,-0x1.1c4c96ad4b85dp-19},
+        {115,0x1.846c771793f4ep-22,-0x1.4b713f4697abp-22},
+        {107,0x1.e4e1e5b6e306p-22,0x1.9344f3fa4bfb5p-21},
+        {108,-0x1.37848ff25de6p-20,0x1.64e793ad1a392p-19},
+        {109,-0x1.95fbfb50b1b02p-18,0x1.543232d63a9f1p-20},
+        {110,-0x1.f64d7cc93698p-18,-0x1.d079dcbb2f45cp-18},
+        {111,0x1.dd9fcdfe7c3c8p-20,-0x1.ced2a9a835bbap-17},
+        {112,0x1.de9967379d6b4p-17,-0x1.fe34bbb0b1664p-18},
+        {113,0x1.e63763f119636p-17,0x1.e586f113fe857p-18},
+        {114,0x1.21d845789e53fp-19,0x1.cffa905ca5d1p-17},
+        {115,-0x1.ef34b6bf70c5cp-18,0x1.e300e73bc4acp-18},
+        {116,-0x1.9f1c38d02d866p-18,-0x1.2dece108a724p-20},
+        {117,-0x1.53068664099fcp-20,-0x1.69d18b963973fp-19},
+        {118,0x1.e3e0379d6afep-22,-0x1.abd5c5cc7d638p-21},
+        {110,0x1.d415f04a77268p-22,0x1.2926c76823f31p-21},
+        {111,-0x1.5555ace75d5e6p-21,0x1.42b4d689e2595p-19},
+        {112,-0x1.54a1be4fc901ap-18,0x1.155962fcfa98ep-19},
+        {113,-0x1.0bfa5d8b572b2p-17,-0x1.4091d2e2c3ff6p-18},
+        {114,-0x1.7405f733d49e8p-20,-0x1.b4ac4d7cfa9cp-17},
+        {115,0x1.821cb28223b82p-17,-0x1.689677057b68cp-17},
+        {116,0x1.0f986acc13f5p-16,0x1.7ee48aae9bdap-19},
+        {117,0x1.c6aa03ab05b1ap-18,0x1.bec1db6fcc554p-17},
+        {118,-0x1.5a1a2f0485504p-18,0x1.61c0b06d5600fp-17},
+        {119,-0x1.01731604b3b9cp-17,0x1.8c79ac820d62ep-20},
+        {120,-0x1.a4262c28eee34p-19,-0x1.7c2ba91bb503bp-19},
+        {121,0x1.43b835aed352dp-23,-0x1.bea435f20004ap-20},
+        {122,0x1.2e0cafdb739f1p-22,-0x1.765d1ccccb1b8p-23},
+        {113,0x1.81f8989bd7bap-22,0x1.4635a3f1a8c06p-22},
+        {114,-0x1.f4e95f50e51dep-25,0x1.034019ff1541cp-19},
+        {115,-0x1.e90e3c27db7ep-19,0x1.6d2092c544e4ap-19},
+        {116,-0x1.06d55f9b0862p-17,-0x1.1566b5a57193dp-19},
+        {117,-0x1.41001810919f3p-18,-0x1.6dbfaa57ff3c6p-17},
+        {118,0x1.d5566df8952c2p-18,-0x1.bc791d60cda3fp-17},
+        {119,0x1.0ef2bc7ddcd2dp-16,-0x1.9745e2aa89e3cp-19},
+        {120,0x1.9133740a02102p-17,0x1.5b575f18a0d76p-17},
+        {121,-0x1.2cbd3f9c32c75p-21,0x1.be87b543e9c8cp-17},
+        {122,-0x1.06f30097afe0cp-17,0x1.7efb70dcca5p-18},
+        {123,-0x1.7f9d9af068004p-18,-0x1.a873cef7e50d5p-20},
+        {124,-0x1.2d8c005f9c862p-20,-0x1.62fe5878f4d76p-19},
+        {125,0x1.e24b997c3796p-22,-0x1.bbe1c7e8ac97ep-21},
+        {116,0x1.c35cc120bdb9ep-23,0x1.9e8e59dbd4c3ep-24},
+        {117,0x1.7719a916b8838p-22,0x1.575fef5b53748p-20},
+        {118,-0x1.0a767eba229c9p-19,0x1.7f9d33ff09ffcp-19},
+        {119,-0x1.bc6aae0a90731p-18,0x1.40d6c6da24834p-21},
+        {120,-0x1.ec255b9d6b978p-18,-0x1.ea7a35e4aa3e3p-18},
+        {121,0x1.3fa7f929f2d28p-20,-0x1.cc3bf7c9334c8p-17},
+        {122,0x1.b7a1cef73be0cp-17,-0x1.33979f2821f7ap-17},
+        {123,0x1.0973771141484p-16,0x1.1e1b04ffaaafp-18},
+        {124,0x1.a2a61be595d3p-18,0x1.c3c445238f8f6p-17},
+        {125,-0x1.51162b5db18b5p-18,0x1.66318017167cp-17},
+        {126,-0x1.06c921ebdfa7cp-17,0x1.14964f2511e92p-19},
+        {127,-0x1.fba2e811bd892p-19,-0x1.67a79286d3127p-19},
+        {128,-0x1.629dbc85e5309p-23,-0x1.120d09891558bp-19},
+        {129,0x1.a6fde8da5d714p-22,-0x1.a09bfb941ee59p-22},
+        {120,0x1.dd5dd81274e3p-22,0x1.4ae158f018c34p-21},
+        {121,-0x1.1dec23f44b15ep-21,0x1.39d3f365b3a6bp-19},
+        {122,-0x1.2a8734cdcca87p-18,0x1.449bf904f2854p-19},
+        {123,-0x1.0bc369eee4eeep-17,-0x1.880a8a702d724p-19},
+        {124,-0x1.25c5882f016ap-18,-0x1.798951a27ddb4p-17},
+        {125,0x1.cd99a05cfdea9p-18,-0x1.bdb0fc70acb1dp-17},
+        {126,0x1.0af9bd209509bp-16,-0x1.09fc703ffc7cap-18},
+        {127,0x1.b9a2fc0ac7148p-17,0x1.313c794e8b4acp-17},
+        {128,0x1.b3421f31c9bdp-20,0x1.ce38467f5b501p-17},
+        {129,-0x1.dac37dce077aep-18,0x1.0859f29285e5cp-17},
+        {130,-0x1.d43e026bbbd93p-18,-0x1.24b6a43548c9dp-24},
+        {131,-0x1.4e68d15386ee7p-19,-0x1.835d23800434p-19},
+        {132,0x1.cd211246958e9p-23,-0x1.a304be607b49dp-20},
+        {133,0x1.40590c4193b34p-22,-0x1.a890a73b89eb2p-23},
+        {123,0x1.198dec1a64fecp-22,0x1.434274c07d1eap-23},
+        {124,0x1.5022f171d4aacp-22,0x1.6f3a4d28c4f52p-20},
+        {125,-0x1.05e8ef64afb74p-19,0x1.7f0a9ccc8403fp-19},
+        {126,-0x1.aa51f83eeaa06p-18,0x1.f6b58827cf2f6p-21},
+        {127,-0x1.02bf0242db13cp-17,-0x1.a113857aa0a9ap-18},
+        {128,-0x1.e093f732403b2p-21,-0x1.bace868c02002p-17},
+        {129,0x1.67ee09db5a736p-17,-0x1.7cfdef178b15p-17},
+        {130,0x1.146f0067d8937p-16,0x1.814eb148f356p-23},
+        {131,0x1.5e8674c67c2efp-17,0x1.839bd37b5dc28p-17},
+        {132,-0x1.3b7a11650cb04p-20,0x1.b767d5d44ea03p-17},
+        {133,-0x1.04bef2520315ap-17,0x1.91e2bee180d67p-18},
+        {134,-0x1.a311612396df4p-18,-0x1.1c80f93c8c2b5p-20},
+        {135,-0x1.f134dc665ce14p-20,-0x1.7d23018d6f112p-19},
+        {136,0x1.6559466cc70cap-22,-0x1.62b1cf492820ep-20},
+        {137,0x1.0c2b02b3cd4dap-22,-0x1.248cd4e4372f2p-23},
+        {127,0x1.bf3388892a3fep-22,0x1.f01e10aebb873p-22},
+        {128,-0x1.24dd7676230b5p-23,0x1.0e3eacadcea6ap-19},
+        {129,-0x1.bc67c30ecdefbp-19,0x1.77cd4a44abfap-19},
+        {130,-0x1.f03588df290abp-18,-0x1.8b5ade678ce3fp-21},
+        {131,-0x1.c4373cd860f5ep-18,-0x1.1d370ab195f1p-17},
+        {132,0x1.e79a36882f538p-20,-0x1.cef1eee7c6537p-17},
+        {133,0x1.ad9088847cc6ap-17,-0x1.3ef1fcbf2fd3ap-17},
+        {134,0x1.103aaa9513668p-16,0x1.6524903cc8962p-19},
+        {135,0x1.2492dae697d69p-17,0x1.a5434628dd364p-17},
+        {136,-0x1.4a7388f220233p-19,0x1.a41493cd9775ap-17},
+        {137,-0x1.0a5ea370d68eap-17,0x1.598a41cf5dedcp-18},
+        {138,-0x1.8f3f31005427ep-18,-0x1.6ee3a9a89bbcp-20},
+        {139,-0x1.c870a13d8d634p-20,-0x1.7980d7f3edebcp-19},
+        {140,0x1.6f1dab2007144p-22,-0x1.5c91cce6b0911p-20},
+        {141,0x1.1407d88c2b4d6p-22,-0x1.3656d658d3316p-23},
+        {131,0x1.e41227fbf2ffdp-22,0x1.a93027c8787aep-21},
+        {132,-0x1.59445763ecbfcp-21,0x1.434c648359f19p-19},
+        {133,-0x1.1dd02526b8dfep-18,0x1.501301b90088ep-19},
+        {134,-0x1.060c12d74e13cp-17,-0x1.0831724ccb37cp-19},
+        {135,-0x1.8bc35254ea9d8p-18,-0x1.460ac35341f8p-17},
+        {136,0x1.b949cfa53b166p-19,-0x1.d1140581ce5cap-17},
+        {137,0x1.c8ef01ca3d268p-17,-0x1.1e26543c3233p-17},
+        {138,0x1.0cd0dd4964146p-16,0x1.de7010127b6bep-19},
+        {139,0x1.14caa5f4ed784p-17,0x1.ac8951041e968p-17},
+        {140,-0x1.5b59fece1ca2bp-19,0x1.a1d560d88aa1fp-17},
+        {141,-0x1.09b627398247p-17,0x1.61e288ce23c17p-18},
+        {142,-0x1.9b55a2121a66cp-18,-0x1.3dfdcf484a6cp-20},
+        {143,-0x1.06fab6a6fc3c6p-19,-0x1.7f2cf14af4e1cp-19},
+        {144,0x1.1aa8ff4adbd8p-22,-0x1.8b3fd4ea39759p-20},
+        {145,0x1.522bc4acee221p-22,-0x1.de3f18302d40ap-23},
+        {134,0x1.b7ffacd1c3d78p-23,0x1.8a41b45ed4044p-24},
+        {135,0x1.c6fe2ca6a17d4p-22,0x1.121e0dbc4061ep-20},
+        {136,-0x1.079545c519224p-20,0x1.5b0ff1e7a6eb9p-19},
+        {137,-0x1.3c19f0a48ea24p-18,0x1.32a8dfe1a3dcfp-19},
+        {138,-0x1.09ac23fe0a38bp-17,-0x1.4e1eb9cf357b8p-19},
+        {139,-0x1.791ae96c15a2ap-18,-0x1.51267abd248a5p-17},
+        {140,0x1.d398825ad2b6p-19,-0x1.d0eb74a59ab1ep-17},
+        {141,0x1.c60f04db7e9bap-17,-0x1.21e48d3313db6p-17},
+        {142,0x1.0ece60103000ep-16,0x1.9c40976a74bbep-19},
+        {143,0x1.2da06116150f3p-17,0x1.a0be1c6fb4018p-17},
+        {144,-0x1.c383cba57b49p-20,0x1.b08aaeae2b1d6p-17},
+        {145,-0x1.021caf4cdba99p-17,0x1.a58f36226efe7p-18},
+        {146,-0x1.c220895b6ef1bp-18,-0x1.01c34bfa95a9bp-21},
+        {147,-0x1.635ee15788c38p-19,-0x1.82cae6b5f0f42p-19},
+        {148,0x1.9f4693e6f2f96p-26,-0x1.ecc112e6ca3ebp-20},
+        {149,0x1.b12af1ad34241p-22,-0x1.bf3c78ec46f64p-22},
+        {138,0x1.f3d7650db11fep-23,0x1.fb785fc6d4e0ep-24},
+        {139,0x1.ba945b8333652p-22,0x1.205bc2862c57cp-20},
+        {140,-0x1.0cbf792cb236p-20,0x1.5c33b63865574p-19},
+        {141,-0x1.35f6ee06cd8a2p-18,0x1.39338fe2bc9adp-19},
+        {142,-0x1.076c5e097d9cap-17,-0x1.20109cd9a562cp-19},
+        {143,-0x1.979753172049p-18,-0x1.3e797ed119d2ep-17},
+        {144,0x1.3614972804934p-19,-0x1.d0504a853db97p-17},
+        {145,0x1.a1b70fd1c0981p-17,-0x1.4b6705a7b5c86p-17},
+        {146,0x1.13cae637708fbp-16,0x1.1ac7be01c59adp-20},
+        {147,0x1.6e60634add5a5p-17,0x1.783cf58959624p-17},
+        {148,0x1.11458f61a5f1ap-21,0x1.c7fd108e82d2bp-17},
+        {149,-0x1.ce86a56b0b29ap-18,0x1.141b52d221f31p-17},
+        {150,-0x1.f8e722adae131p-18,0x1.1a4950cb7b3a5p-20},
+        {151,-0x1.05879e9fd56cap-18,-0x1.62a270cdd2c32p-19},
+        {152,-0x1.37c1dac47c748p-21,-0x1.3e107d19f55acp-19},
+        {153,0x1.e1e7ac548a3bcp-22,-0x1.bf0532596d194p-21},
+        {154,0x1.57b22d13cf138p-23,-0x1.e902011e6fabap-25},
+        {142,0x1.d063498553b62p-23,0x1.b661dc04cbb9p-24},
+        {143,0x1.cfa7f0702e632p-22,0x1.065d5c77be4bp-20},
+        {144,-0x1.97ef8bd627788p-21,0x1.4c517e876f88cp-19},
+        {145,-0x1.134dafb433762p-18,0x1.58a1622bb4e66p-19},
+        {146,-0x1.fc1a9fa67465bp-18,-0x1.3c96457c1221fp-20},
+        {147,-0x1.d074c9eea3a42p-18,-0x1.125283008d693p-17},
+        {148,0x1.4789f4f7208b8p-23,-0x1.c5392211fccdfp-17},
+        {149,0x1.5a18dd2f13382p-17,-0x1.8697c390b32bfp-17},
+        {150,0x1.11a98c5c6d91cp-16,-0x1.228d7e3885262p-19},
+        {151,0x1.c17eb3544e373p-17,0x1.27ad1845c5b68p-17},
+        {152,0x1.0624931f8118p-18,0x1.d03a946a36572p-17},
+        {153,-0x1.505b195780d3p-18,0x1.668865ec05056p-17},
+        {154,-0x1.0d6922fc1471bp-17,0x1.df32bf0824369p-19},
+        {155,-0x1.76610fcc0b01bp-18,-0x1.c7a48e05bf858p-20},
+        {156,-0x1.dd96db336f202p-20,-0x1.7b7d871f891c4p-19},
+        {157,0x1.f6b5ccc52a65ap-23,-0x1.99de2b3e39204p-20},
+        {158,0x1.83aca60d129c1p-22,-0x1.49c8ef199d2dcp-22},
+        {147,0x1.e4de224a41838p-22,0x1.8cf20963dab46p-21},
+        {148,-0x1.56093bfc1277dp-22,0x1.2471242fd1621p-19},
+        {149,-0x1.a682ffec9040cp-19,0x1.7bc4bc698c917p-19},
+        {150,-0x1.cbea559197cffp-18,0x1.1d0a6c30e2aeep-22},
+        {151,-0x1.04e6184ebab6ep-17,-0x1.9096c1590f634p-18},
+        {152,-0x1.76dcc39bc0d14p-19,-0x1.9e060fe5065a6p-17},
+        {153,0x1.c6cc09a77d59ep-18,-0x1.beb87d7e77542p-17},
+        {154,0x1.f522ce6a0738ep-17,-0x1.af70abebb6571p-18},
+        {155,0x1.076488ac1dbdep-16,0x1.36ec1be11f644p-18},
+        {156,0x1.1cc1fa7a8154p-17,0x1.a8f3233f8d157p-17},
+        {157,-0x1.69ca2c8de24d2p-20,0x1.b52a0d1541744p-17},
+        {158,-0x1.eecfb4133feb6p-18,0x1.e3e8df1af519cp-18},
+        {159,-0x1.ebdc6e6a7609ap-18,0x1.3ea6c3ade505cp-21},
+        {160,-0x1.fe6bfa218c6ecp-19,-0x1.66c2c7e178085p-19},
+        {161,-0x1.5f8ac1db5913cp-21,-0x1.443d88ac59cc4p-19},
+        {162,0x1.d3d57d459cee9p-22,-0x1.ffb62f466cdebp-21},
+        {163,0x1.d9bfea020fb04p-23,-0x1.c8083a8fc8b18p-24},
+        {151,0x1.b688673a204cdp-22,0x1.d0d82b4388847p-22},
+        {152,0x1.2acabfdd6cd7ap-23,0x1.c345f171ccbap-20},
+        {153,-0x1.009b146875336p-19,0x1.7e50184a8920ap-19},
+        {154,-0x1.7282f215029f1p-18,0x1.d4262397b93f6p-20},
+        {155,-0x1.0c52fa7a0156ap-17,-0x1.9d823fcc739aap-19},
+        {156,-0x1.836d33db9269cp-18,-0x1.4b1c607bd63f4p-17},
+        {157,0x1.0d8ad0d130e67p-19,-0x1.cf8c5273ce177p-17},
+        {158,0x1.817c36c35d873p-17,-0x1.6916f910777c1p-17},
+        {159,0x1.1372049995271p-16,-0x1.5d037a58609aep-20},
+        {160,0x1.bd1d6db1b043p-17,0x1.2d0dcb24e3a08p-17},
+        {161,0x1.20faefb6ab8a8p-18,0x1.cf2259baa1b4ep-17},
+        {162,-0x1.25ecec4ec0928p-18,0x1.7975122e148a7p-17},
+        {163,-0x1.0c695b1520f1fp-17,0x1.378333bdc2ebap-18},
+        {164,-0x1.a9ca20d78cf45p-18,-0x1.fb84a69b72e9cp-21},
+        {165,-0x1.678c049458f1ep-19,-0x1.8293dd3c008a2p-19},
+        {166,-0x1.49c0deade611ap-23,-0x1.10868afc08314p-19},
+        {167,0x1.e16e3b277a93ep-22,-0x1.613256d9fc4f6p-21},
+        {155,0x1.23bc1997c4058p-22,0x1.5bec79b909892p-23},
+        {156,0x1.c07b32cde9264p-22,0x1.19e1d625e82bap-20},
+        {157,-0x1.7270c337304fcp-21,0x1.4707ada5af974p-19},
+        {158,-0x1.e9c7f93c69114p-19,0x1.6ce57a8cdc048p-19},
+        {159,-0x1.dad800bd967p-18,-0x1.b050998236a4ap-24},
+        {160,-0x1.03a515ec9101ep-17,-0x1.9a5bb37a9ad34p-18},
+        {161,-0x1.9cdaa3b4c45edp-19,-0x1.98749ce111b04p-17},
+        {162,0x1.88367fc6d0acap-18,-0x1.c6e7e9c2bc0c7p-17},
+        {163,0x1.d8c319663e2dep-17,-0x1.07f9dc72553ddp-17},
+        {164,0x1.1111c689fe65ep-16,0x1.3fa219702a81ep-19},
+        {165,0x1.6de39ece06148p-17,0x1.789801ca2806ap-17},
+        {166,0x1.b083841dfe455p-20,0x1.ce29eb43ab054p-17},
+        {167,-0x1.87f5279245d9bp-18,0x1.485ef62a781f8p-17},
+        {168,-0x1.0c9fd397e2e2dp-17,0x1.aae916b042befp-19},
+        {169,-0x1.7d43284005b68p-18,-0x1.b080e7044dc0fp-20},
+        {170,-0x1.1f189d5e3662ep-19,-0x1.81a9a0546aa9p-19},
+        {171,0x1.cbe7e50a03409p-26,-0x1.ebe2cb5678e9ap-20},
+        {172,0x1.d3970db624efcp-22,-0x1.279fb7a7df714p-21},
+        {160,0x1.be5e5d86342bap-22,0x1.ece2f4ad7c63ap-22},
+        {161,0x1.61cfd99c2cb5cp-23,0x1.b8df6d9519e5bp-20},
+        {162,-0x1.bf4c04d3bf862p-20,0x1.788d69f37565p-19},
+        {163,-0x1.4ffe109367943p-18,0x1.1b4092722f19fp-19},
+        {164,-0x1.054eaa8af34acp-17,-0x1.f8f6209b6a149p-20},
+        {165,-0x1.cebd88d1add0cp-18,-0x1.13e4d588bc4cp-17},
+        {166,-0x1.b81a080afc568p-21,-0x1.bba91f325fb74p-17},
+        {167,0x1.150861753126p-17,-0x1.ac6abd7c11609p-17},
+        {168,0x1.ffe410a8403d4p-17,-0x1.825a4da25e256p-18},
+        {169,0x1.087006684352p-16,0x1.2a87e023b08aap-18},
+        {170,0x1.3ce8a64642e62p-17,0x1.9882c6cc8156p-17},
+        {171,0x1.5b1dae1d9f1bp-22,0x1.c69666ad78529p-17},
+        {172,-0x1.ab9f39c70454dp-18,0x1.3091e40e840bap-17},
+        {173,-0x1.0a92b26d209b9p-17,0x1.64aa3dc8d8417p-19},
+        {174,-0x1.6fe15845862f5p-18,-0x1.dc777beb377d2p-20},
+        {175,-0x1.139485ebeef4fp-19,-0x1.809c2236094bp-19},
+        {176,0x1.bf696c0999b83p-26,-0x1.ec1fdec8406e6p-20},
+        {177,0x1.d83fd9246c1dcp-22,-0x1.368506c6f22bep-21},
+        {164,0x1.a726d96d81af4p-23,0x1.6d31b3615bb94p-24},
+        {165,0x1.e4e4dac780304p-22,0x1.8f5dde3a11544p-21},
+        {166,-0x1.3a45d6110e945p-23,0x1.0f9159fcf6b7bp-19},
+        {167,-0x1.3fa1081709c04p-19,0x1.8342c382448e4p-19},
+        {168,-0x1.820ff6229f2fap-18,0x1.9fb8dc024c994p-20},
+        {169,-0x1.0be45bea82528p-17,-0x1.8d0a004947241p-19},
+        {170,-0x1.a548ea9d66d3cp-18,-0x1.351f6d5d73613p-17},
+        {171,0x1.1dcc555c1c662p-22,-0x1.c622f9fd4d89fp-17},
+        {172,0x1.32afad46cac55p-17,-0x1.9e1738898c4b8p-17},
+        {173,0x1.04b3c41cfcc74p-16,-0x1.5463653165a3p-18},
+        {174,0x1.05f9c5d1e466cp-16,0x1.46cbf31a5e3e4p-18},
+        {175,0x1.38c0819e9e6bp-17,0x1.9ad1eb38ba171p-17},
+        {176,0x1.df61851fd0318p-22,0x1.c7852e971a47bp-17},
+        {177,-0x1.9f1cd5e0e1f4cp-18,0x1.3969b0ad279e8p-17},
+        {178,-0x1.0c544474e19b8p-17,0x1.9de4d190be0d4p-19},
+        {179,-0x1.86c6afa714f74p-18,-0x1.8eba5eef46076p-20},
+        {180,-0x1.48681c18038a4p-19,-0x1.835b2d2547b46p-19},
+        {181,-0x1.794aa0c227063p-23,-0x1.136778b1e885bp-19},
+        {182,0x1.e4c06f211b996p-22,-0x1.9b67c3d552562p-21},
+        {183,0x1.b75a07d99bf3ep-23,-0x1.89068247075e8p-24},
+        {169,0x1.1640e8e04552cp-22,0x1.3b69957733e02p-23},
+        {170,0x1.daebcda22098bp-22,0x1.e55f3af0f794bp-21},
+        {171,-0x1.5608a1d728b19p-22,0x1.246f703c31866p-19},
+        {172,-0x1.64e66a94d0e5ep-19,0x1.82b3a850355e2p-19},
+        {173,-0x1.8f698a213918p-18,0x1.6e23f82268f42p-20},
+        {174,-0x1.0c87602f6730bp-17,-0x1.a6a895c32f2eep-19},
+        {175,-0x1.a42b93aa979e2p-18,-0x1.35e7a398e30d8p-17},
+        {176,0x1.008269b713698p-24,-0x1.c46dc57ca2ecp-17},
+        {177,0x1.236c9ad285da4p-17,-0x1.a5cc2d403f1c6p-17},
+        {178,0x1.feb9e3a408221p-17,-0x1.8785aa43e7cc6p-18},
+        {179,0x1.0bb77860d86fep-16,0x1.fed767001e057p-19},
+        {180,0x1.5f11c1ff6f29ep-17,0x1.8336061bb0da3p-17},
+        {181,0x1.fc424a2174c72p-20,0x1.cf2f789df8ecep-17},
+        {182,-0x1.5f47692bfde8cp-18,0x1.5f1872174fc24p-17},
+        {183,-0x1.0ceb99f9bcde6p-17,0x1.2a91aa12429b2p-18},
+        {184,-0x1.bb52cbfb8d94ep-18,-0x1.4c37fe05f4498p-21},
+        {185,-0x1.c27e9abe0e63cp-19,-0x1.76857885a7c32p-19},
+        {186,-0x1.744a39484ddfep-21,-0x1.474b3fcb75504p-19},
+        {187,0x1.a19d413387beep-22,-0x1.37cb0cb34b5c4p-20},
+        {188,0x1.649056181cd61p-22,-0x1.0daa1b20f2332p-22},
+        {174,0x1.29c6d482876cep-22,0x1.6b27559b75394p-23},
+        {175,0x1.d7259812ce217p-22,0x1.f43d22a4168p-21},
+        {176,-0x1.501ca83335126p-22,0x1.23d275d6cf90ep-19},
+        {177,-0x1.57c7abf936a0bp-19,0x1.832e33dea0138p-19},
+        {178,-0x1.828c8adab791fp-18,0x1.9df82da421114p-20},
+        {179,-0x1.0a82004773572p-17,-0x1.630dc44a31e01p-19},
+        {180,-0x1.c28dad0277be2p-18,-0x1.1e967b9184a22p-17},
+        {181,-0x1.25654f3152326p-20,-0x1.b8690bf198343p-17},
+        {182,0x1.e324246cdbd21p-18,-0x1.ba2b0929ee3fcp-17},
+        {183,0x1.df2ba0b3c2a5ep-17,-0x1.fc4d4c1c1ccacp-18},
+        {184,0x1.12fb62acbf8eap-16,0x1.a52acf083ea3ap-20},
+        {185,0x1.9ebb2e4e320fcp-17,0x1.4e606a3618e6dp-17},
+        {186,0x1.279f52755f843p-18,0x1.cec9b5e5ebc48p-17},
+        {187,-0x1.c4317270834bp-19,0x1.924810e04ab5ap-17},
+        {188,-0x1.fe10bd96e739cp-18,0x1.b9be3eadcccc2p-18},
+        {189,-0x1.f723d862f3c5ep-18,0x1.086ab87ded20ep-20},
+        {190,-0x1.3bc41b909bb5fp-18,-0x1.32fd8c76bafeap-19},
+        {191,-0x1.be714f3bccdf7p-20,-0x1.7874d1ffe9d22p-19},
+        {192,0x1.69e31a95cf21ep-24,-0x1.d802273a1c568p-20},
+        {193,0x1.dc440eb53490ep-22,-0x1.45ee04fa77e6p-21},
+        {194,0x1.69b9760064ac5p-23,-0x1.0d972dea0018fp-24},
+        {179,0x1.0963afff8fa1cp-22,0x1.1e5126950690ep-23},
+        {180,0x1.e37de914651c4p-22,0x1.b09a44ae568ccp-21},
+        {181,-0x1.e7211bebae055p-24,0x1.0b1a69891734p-19},
+        {182,-0x1.14a7dcf49ae86p-19,0x1.80b5ae9280ebp-19},
+        {183,-0x1.56c538cb0278cp-18,0x1.127919bbbc924p-19},
+        {184,-0x1.010587caa147p-17,-0x1.824232b4db8dep-20},
+        {185,-0x1.f4bddda768672p-18,-0x1.d48edb3bf56fep-18},
+        {186,-0x1.a3b3e3dccad22p-19,-0x1.9766b515dcd56p-17},
+        {187,0x1.2cd8f0b6b90cfp-18,-0x1.ce80b48500924p-17},
+        {188,0x1.9a6a249a7fedap-17,-0x1.529ceef16c298p-17},
+        {189,0x1.120186fb73a14p-16,-0x1.0faf40eb99a02p-19},
+        {190,0x1.eba0f4fd4cad4p-17,0x1.d2c16533bf96bp-18},
+        {191,0x1.0ee35438f5e0dp-17,0x1.af0bb40b2d994p-17},
+        {192,-0x1.3a96e0c511e17p-24,0x1.c3419a22a8016p-17},
+        {193,-0x1.98e48fbe543bfp-18,0x1.3d96f5f440e1p-17},
+        {194,-0x1.0d86c38baac94p-17,0x1.f176bd967f3cap-19},
+        {195,-0x1.ae4573a0a5cb9p-18,-0x1.d0bfe54c1433fp-21},
+        {196,-0x1.bd44b2b52e8f2p-19,-0x1.77985aad8ee5fp-19},
+        {197,-0x1.a214ba392b987p-21,-0x1.4dade71db3782p-19},
+        {198,0x1.73f3d31132bc7p-22,-0x1.596d7323f7e2ap-20},
+        {199,0x1.960c9f5387546p-22,-0x1.73bd4afdbde5cp-22},
+        {184,0x1.72ba411a68db8p-23,0x1.1a9d3d503dcf8p-24},
+        {185,0x1.d6d753ceca34ep-22,0x1.31b67dd806414p-21},
+        {186,0x1.73a1b771d1acbp-23,0x1.b562947a2bec8p-20},
+        {187,-0x1.59cce2c76e8fcp-20,0x1.6aebe923880b8p-19},
+        {188,-0x1.0d0c667860482p-18,0x1.5d4fb97f75f85p-19},
+        {189,-0x1.cfc3f9189b6dep-18,0x1.78a33bdaf1b62p-23},
+        {190,-0x1.0c6cac94811aap-17,-0x1.36fb1bcce2f6ap-18},
+        {191,-0x1.711eaca2638f2p-18,-0x1.559a5d5c3e19cp-17},
+        {192,0x1.9398fb774417cp-21,-0x1.c9a215f293924p-17},
+        {193,0x1.23d48d7286382p-17,-0x1.a598300937a46p-17},
+        {194,0x1.f3021411b6b18p-17,-0x1.b79b2753c5948p-18},
+        {195,0x1.11804785f2318p-16,0x1.2a4f168cfbc96p-19},
+        {196,0x1.9bea4d70ff612p-17,0x1.5126060b79b6ap-17},
+        {197,0x1.409ddfd6857fap-18,0x1.cd4835ef9d844p-17},
+        {198,-0x1.6c89dde346dc6p-19,0x1.9f747a2ae8899p-17},
+        {199,-0x1.e5ee3125ce74p-18,0x1.f8cd59103f9bep-18},
+        {200,-0x1.068978003cfa6p-17,0x1.10a99405df5dbp-19},
+        {201,-0x1.75fd541d7b306p-18,-0x1.c8d3486ee0e75p-20},
+        {202,-0x1.565cbe395d1bcp-19,-0x1.833565f258786p-19},
+        {203,-0x1.a54a6ee9e785dp-22,-0x1.2c4e14b8da2d3p-19},
+        {204,0x1.bfa8c3d8b1a3dp-22,-0x1.1acef3eaba834p-20},
+        {205,0x1.625b526543b4dp-22,-0x1.09cdf3e884cc2p-22},
+        {190,0x1.76641d2def7adp-22,0x1.2e9a1dc078112p-22},
+        {191,0x1.b55a481f4a6ecp-22,0x1.25b93cd77c309p-20},
+        {192,-0x1.b2e5e73641ecap-22,0x1.2d995c1ed8697p-19},
+        {193,-0x1.4ef43ac2abf44p-19,0x1.83528bd81f985p-19},
+        {194,-0x1.6c3648f19cb53p-18,0x1.e7c831aa320f2p-20},
+        {195,-0x1.034782045281ep-17,-0x1.bd941a4aca296p-20},
+        {196,-0x1.f641ce3320571p-18,-0x1.d06e475f8de5ep-18},
+        {197,-0x1.db4c67819c416p-19,-0x1.8e7364fa7ef5p-17},
+        {198,0x1.d0b356fd75d46p-19,-0x1.d0eb207639552p-17},
+        {199,0x1.71809e3d5888ap-17,-0x1.75d84580a2e8ap-17},
+        {200,0x1.09fa9866de03p-16,-0x1.17197f54db86ep-18},
+        {201,0x1.082a63c6c919ep-16,0x1.2db7971010f37p-18},
+        {202,0x1.6855b17798d53p-17,0x1.7ca9b2687413ap-17},
+        {203,0x1.a6712d8121ef3p-19,0x1.d11a24238fb9cp-17},
+        {204,-0x1.fa1fdac270a9ep-19,0x1.891a8efd5fa45p-17},
+        {205,-0x1.fb893bdad6d3cp-18,0x1.c16270f4d9a92p-18},
+        {206,-0x1.0168e2cf8d856p-17,0x1.8c1286bf1cdb6p-20},
+        {207,-0x1.643d69e386ea2p-18,-0x1.ff90b5497d2a4p-20},
+        {208,-0x1.408f13f681a12p-19,-0x1.8343b9c7f4974p-19},
+        {209,-0x1.75cfb0dbc71eap-22,-0x1.27a7ccea3edddp-19},
+        {210,0x1.c02f747d24ec6p-22,-0x1.1a368d343a24p-20},
+        {211,0x1.6a8d4a0c0064p-22,-0x1.1850a0a4025cep-22},
+        {195,0x1.9e1ac4a887138p-23,0x1.5e0b9f33269d8p-24},
+        {196,0x1.d7fb82dade463p-22,0x1.358c09ab69a03p-21},
+        {197,0x1.bf8cf81e0e63p-23,0x1.a5e30f9ccee24p-20},
+        {198,-0x1.1fa5b284800dep-20,0x1.602f616eebfd8p-19},
+        {199,-0x1.d88814a4b549cp-19,0x1.716e1616c5b2cp-19},
+        {200,-0x1.ab0c89b6b240cp-18,0x1.ef6d349fa911p-21},
+        {201,-0x1.0c89d8725c4eap-17,-0x1.a778f16d0675bp-19},
+        {202,-0x1.c64f3fd8fcee4p-18,-0x1.1b5eceefbfd0ap-17},
+        {203,-0x1.0d58a4907651bp-19,-0x1.ab9e0c3725cd1p-17},
+        {204,0x1.5d232653b94c4p-18,-0x1.cb1b11002d61cp-17},
+        {205,0x1.9b263c63530c8p-17,-0x1.51e3a6bd85f6cp-17},
+        {206,0x1.0fe858d479a56p-16,-0x1.71bb953edf694p-19},
+        {207,0x1.0100cc82a108cp-16,0x1.78a04e67ddda7p-18},
+        {208,0x1.4f0b48a9c343ap-17,0x1.8db6fcca78316p-17},
+        {209,0x1.53443d3140e05p-19,0x1.d0aeb48e49372p-17},
+        {210,-0x1.103d68d9ff8d4p-18,0x1.8207fbd79cac1p-17},
+        {211,-0x1.fe62e268db0c2p-18,0x1.b8b24b087fc5ap-18},
+        {212,-0x1.01a64089230fcp-17,0x1.9236cb2a83d61p-20},
+        {213,-0x1.6ad5556d2566p-18,-0x1.ebf9c0d85c1bcp-20},
+        {214,-0x1.56a50401030e4p-19,-0x1.833245fb1865p-19},
+        {215,-0x1.00a764c783aecp-21,-0x1.34c3e7b9d9ff4p-19},
+        {216,0x1.9bf93aaa5cabcp-22,-0x1.3c73f9f17603cp-20},
+        {217,0x1.93c486ea0862cp-22,-0x1.6e2bdd8733051p-22},
+        {201,0x1.1f92199332f65p-22,0x1.5191d3957d96ap-23},
+        {202,0x1.e4d3d0b66f8bcp-22,0x1.98b1fea529c44p-21},
+        {203,0x1.d9a3836a6f58p-25,0x1.e24671a13a78cp-20},
+        {204,-0x1.79616fc00aaep-20,0x1.6fcff8e33ec62p-19},
+        {205,-0x1.06e4e97f50828p-18,0x1.61a8d6175ce1ap-19},
+        {206,-0x1.bd2a418672532p-18,0x1.3830df675a618p-21},
+        {207,-0x1.0d60b33fac153p-17,-0x1.dda05425232bcp-19},
+        {208,-0x1.bb7e516fc8b6bp-18,-0x1.24602c7d31a06p-17},
+        {209,-0x1.f35a703b509e8p-20,-0x1.addff5e35a061p-17},
+        {210,0x1.5a4d7b4f38576p-18,-0x1.cb574f7bbab4ap-17},
+        {211,0x1.94489fa64d0bp-17,-0x1.586f3e4c2e178p-17},
+        {212,0x1.0dfe9f958be28p-16,-0x1.b7fccf82b9c88p-19},
+        {213,0x1.05d52feb52a98p-16,0x1.484267e17c51p-18},
+        {214,0x1.6a3847eb5766ap-17,0x1.7b48a7229bdd8p-17},
+        {215,0x1.e9e6efdaf55c6p-19,0x1.d0ad819ea3228p-17},
+        {216,-0x1.9c04f67dff6bep-19,0x1.988f7276cfe6ep-17},
+        {217,-0x1.e14ddd4582efap-18,0x1.01782c39f06bfp-17},
+        {218,-0x1.0a28502c6b938p-17,0x1.5a481dc185acdp-19},
+        {219,-0x1.9b89585b6341cp-18,-0x1.3cf302ad3d74ep-20},
+        {220,-0x1.c182635a97302p-19,-0x1.76b5551c61cfcp-19},
+        {221,-0x1.0f8c5f552fd47p-20,-0x1.5cca1ba4a8b74p-19},
+        {222,0x1.c414d4c3d10bap-23,-0x1.a4ec253b5d56ep-20},
+        {223,0x1.dadce7dd23bb6p-22,-0x1.4023d861f11e4p-21},
+        {224,0x1.c0930a4877aacp-23,-0x1.99430677add14p-24},
+        {207,0x1.3ee0fc72e7048p-22,0x1.a42abe81796d3p-23},
+        {208,0x1.e256a9341a873p-22,0x1.bb9e6c82bf846p-21},
+        {209,0x1.e5a50cb7d5af9p-27,0x1.f0022025695dcp-20},
+        {210,-0x1.82de4d1289a58p-20,0x1.71293e3a72737p-19},
+        {211,-0x1.04bd403aeff85p-18,0x1.631e266192fcep-19},
+        {212,-0x1.b6d6e273e9944p-18,0x1.7b09e39190997p-21},
+        {213,-0x1.0cba1184b5fa8p-17,-0x1.b0c301b70be32p-19},
+        {214,-0x1.ceadd47fbd14ap-18,-0x1.13ea0a8a265c4p-17},
+        {215,-0x1.5f4cc9e5ec95ap-19,-0x1.a1439ec780104p-17},
+        {216,0x1.0dadc2bd96979p-18,-0x1.cff025c3ceb3cp-17},
+        {217,0x1.6eca5f137f844p-17,-0x1.77e3bbed1fb69p-17},
+        {218,0x1.057c5f8a0fp-16,-0x1.4bfdd63ef806bp-18},
+        {219,0x1.0f172272f9257p-16,0x1.914009cec8734p-19},
+        {220,0x1.a0b9927160a69p-17,0x1.4c5c1faffb1b4p-17},
+        {221,0x1.886c410914464p-18,0x1.c6dc15625dc6p-17},
+        {222,-0x1.2544c8b8e1776p-20,0x1.b866dedff28a2p-17},
+        {223,-0x1.998cbb5141f16p-18,0x1.3d22ef15c91cap-17},
+        {224,-0x1.0ce64b7e9c59ep-17,0x1.2ad09011665ebp-18},
+        {225,-0x1.db85d30e5c6a8p-18,0x1.0078c9579b7dcp-23},
+        {226,-0x1.33cd10808dac8p-18,-0x1.3b60c352c48d6p-19},
+        {227,-0x1.0a669a357cb25p-19,-0x1.7f907adb18ce2p-19},
+        {228,-0x1.0ad8e0faf8a44p-22,-0x1.1c654ef4ccb79p-19},
+        {229,0x1.be19ed6972ea4p-22,-0x1.1c8aab52f1c04p-20},
+        {230,0x1.84d115a2b5d46p-22,-0x1.4c24ede5638fbp-22},
+        {213,0x1.33b477275e37cp-22,0x1.852cbf68d8358p-23},
+        {214,0x1.e4b488fcf373ep-22,0x1.9d25d313cc036p-21},
+        {215,0x1.95d0d8d241684p-24,0x1.d444897640d62p-20},
+        {216,-0x1.42824bf50d7c2p-20,0x1.66e3754aa0f9ap-19},
+        {217,-0x1.d234e68379cecp-19,0x1.72f60bfad94f6p-19},
+        {218,-0x1.99a4ed0438e52p-18,0x1.44db3489a588ep-20},
+        {219,-0x1.0846ece55eb06p-17,-0x1.30c10c881f3eap-19},
+        {220,-0x1.f372939f6583cp-18,-0x1.d7ede5ab8d0e6p-18},
+        {221,-0x1.0f15e53b0817dp-18,-0x1.8276316ba93f2p-17},
+        {222,0x1.036707d40e5ecp-19,-0x1.cf4adde5f34d8p-17},
+        {223,0x1.287c2712109c5p-17,-0x1.a34d02ce2f8fep-17},
+        {224,0x1.e1afa8ff08b8cp-17,-0x1.f43b0f759e91p-18},
+        {225,0x1.146e7c41f3715p-16,-0x1.664b6a553a7e4p-25},
+        {226,0x1.e32259bd5ce5ap-17,0x1.ef8a151587115p-18},
+        {227,0x1.2ad6ad43dacbp-17,0x1.a21f569f559ccp-17},
+        {228,0x1.0d1a7c3bbdf8p-19,0x1.cf8322413f14ep-17},
+        {229,-0x1.0b9ae2fafcf5ep-18,0x1.83c674b08e5a4p-17},
+        {230,-0x1.f219433d9be65p-18,0x1.db7385a20fffp-18},
+        {231,-0x1.089536d849606p-17,0x1.36eb4404ffcecp-19},
+        {232,-0x1.9b610915e0cb2p-18,-0x1.3d94f2cbf8a24p-20},
+        {233,-0x1.d5effc1a5b03cp-19,-0x1.720f3d167dc5bp-19},
+        {234,-0x1.47bcd404ff5eap-20,-0x1.67d297e5d793ep-19},
+        {235,0x1.7228870d39b4p-24,-0x1.d74b7494cc3e5p-20},
+        {236,0x1.e4837176f60bap-22,-0x1.a1d13051fabfap-21},
+        {237,0x1.36c04b53e07edp-22,-0x1.8d7261bf38ba6p-23},
+        {219,0x1.d130d8fe1397fp-23,0x1.b79fdc242cbc4p-24},
+        {220,0x1.d448f5c9afdeep-22,0x1.299e76ddfb51ap-21},
+        {221,0x1.39b927b2913a8p-22,0x1.7b7c3b69e4fa8p-20},
+        {222,-0x1.560cecc5c39b2p-21,0x1.42c7d61be891cp-19},
+        {223,-0x1.54d3b045685a2p-19,0x1.8338f2f62f016p-19},
+        {224,-0x1.54b80fb301d72p-18,0x1.1521416a6cdd6p-19},
+        {225,-0x1.eac97a7dd611cp-18,-0x1.2d0ef5f4c383dp-21},
+        {226,-0x1.0bef24114113ap-17,-0x1.40b69c9dbf74dp-18},
+        {227,-0x1.974a10abedcb3p-18,-0x1.3e9f73b439888p-17},
+        {228,-0x1.73653978f7785p-20,-0x1.b4a80058313e2p-17},
+        {229,0x1.56b88e3b1a694p-18,-0x1.cba070433f8e6p-17},
+        {230,0x1.821bbca43edfcp-17,-0x1.68872bb5752ecp-17},
+        {231,0x1.07403e678a91ep-16,-0x1.385befe7d4acp-18},
+        {232,0x1.0f92869991bc5p-16,0x1.7ed1e03412ae3p-19},
+        {233,0x1.ae11466d73acfp-17,0x1.3e55afffb240dp-17},
+        {234,0x1.c6bb4bb5a6642p-18,0x1.beb2999cbce3ep-17},
+        {235,0x1.d19c3757071b2p-24,0x1.c4d24a0dbd26fp-17},
+        {236,-0x1.59f09411cd8dap-18,0x1.61c64c9379716p-17},
+        {237,-0x1.05010292c301cp-17,0x1.8f87104410463p-18},
+        {238,-0x1.01713082cf564p-17,0x1.8d1de82d8163p-20},
+        {239,-0x1.7eaf829daeb1bp-18,-0x1.ab7107ccdcb9bp-20},
+        {240,-0x1.a4601c75afb0ap-19,-0x1.7c1184b864158p-19},
+        {241,-0x1.1130dd2218714p-20,-0x1.5d23541e6b35ap-19},
+        {242,0x1.421ce73a4dd1dp-23,-0x1.bee6014626ac9p-20},
+        {243,0x1.e4cfad6138ffcp-22,-0x1.890b3af280be5p-21},
+        {244,0x1.2e92d369ea718p-22,-0x1.77829ffcf608p-23},
+        {226,0x1.880244700a602p-22,0x1.53110236a4572p-22},
+        {227,0x1.ccc963139f2d8p-22,0x1.0a78a948e2a38p-20},
+        {228,-0x1.5dd29018eedd4p-24,0x1.06974b1d952dp-19},
+        {229,-0x1.8c6343572296cp-20,0x1.72746c24f06c6p-19},
+        {230,-0x1.f17c726cbafbp-19,0x1.6aa497e69e0fep-19},
+        {231,-0x1.9eeb0fdf70369p-18,0x1.2e6e077aa54e6p-20},
+        {232,-0x1.078fac2ba7238p-17,-0x1.2317f7ed49a7cp-19},
+        {233,-0x1.fcd416552745fp-18,-0x1.bd6c7e66678b2p-18},
+        {234,-0x1.39c9a88378cd7p-18,-0x1.70ee1fa08252ep-17},
+        {235,0x1.5be68942deddep-21,-0x1.c8ecfc88b956ap-17},
+        {236,0x1.e0622498ba9d2p-18,-0x1.ba9c1341f737cp-17},
+        {237,0x1.b2d4ded58905fp-17,-0x1.39079a443a5f4p-17},
+        {238,0x1.0f93c9820392cp-16,-0x1.7e92315f23968p-19},
+        {239,0x1.08666cf92b276p-16,0x1.2acc14ac0ec6ap-18},
+        {240,0x1.8ca4021b7dfb6p-17,0x1.5f66e1a722dd8p-17},
+        {241,0x1.7d7c198fb0c4ep-18,0x1.c8082466c2a78p-17},
+        {242,-0x1.7d22b2273431p-21,0x1.bcdd6dfc89308p-17},
+        {243,-0x1.75637966b114ap-18,0x1.5333ee4fad7acp-17},
+        {244,-0x1.07bea96e00bedp-17,0x1.76fe2ab2be94ap-18},
+        {245,-0x1.fec438da67ccbp-18,0x1.5b4023e8a6a62p-20},
+        {246,-0x1.7b70d697b00a4p-18,-0x1.b6900274ed4a6p-20},
+        {247,-0x1.a75a4dacde631p-19,-0x1.7b95344c9b43ap-19},
+        {248,-0x1.221c50e1b8285p-20,-0x1.60ad2355ec449p-19},
+        {249,0x1.bad34c526f45bp-24,-0x1.d113ab6eaf038p-20},
+        {250,0x1.e3749ebe05e6cp-22,-0x1.b11415f11731ep-21},
+        {251,0x1.504eb1c21494ap-22,-0x1.d82b4786c8e71p-23},
+        {232,0x1.c49408513eeb2p-23,0x1.a060808ecaafcp-24},
+        {233,0x1.c9d19d5e82e31p-22,0x1.0e33fa801ac79p-21},
+        {234,0x1.769c570d7113dp-22,0x1.57aa5295ab524p-20},
+        {235,-0x1.9d26d8bfda0adp-22,0x1.2b822d21802b2p-19},
+        {236,-0x1.0ab398425ff1p-19,0x1.7f96b8d242756p-19},
+        {237,-0x1.1fb00ca4a8b2p-18,0x1.4e61325985b44p-19},
+        {238,-0x1.bc75ee2692ad7p-18,0x1.3f997defd2124p-21},
+        {239,-0x1.0b96461c08f82p-17,-0x1.83437d1278056p-19},
+        {240,-0x1.ec021d9546c3ep-18,-0x1.ea980ffc14428p-18},
+        {241,-0x1.17bae68b1be03p-18,-0x1.7f1e5e9a708fep-17},
+        {242,0x1.403be823867dap-20,-0x1.cc32498d3d3cp-17},
+        {243,0x1.f9da87f244414p-18,-0x1.b61d9b4d89d8fp-17},
+        {244,0x1.b79d0570cedd2p-17,-0x1.33890af68d734p-17},
+        {245,0x1.0f9cef1f0795ap-16,-0x1.7d1db03822b44p-19},
+        {246,0x1.096db1577f4cep-16,0x1.1e0c60c804dc8p-18},
+        {247,0x1.967a2bd9bec68p-17,0x1.565a420b8bafcp-17},
+        {248,0x1.a2ba8056728a6p-18,0x1.c3b474372ab9ep-17},
+        {249,-0x1.41435319a16fp-25,0x1.c38dcbd39b0bcp-17},
+        {250,-0x1.50e9ea5be3f4bp-18,0x1.6636fd138d0b6p-17},
+        {251,-0x1.011b0691da4ecp-17,0x1.ac3a511ab6b7p-18},
+        {252,-0x1.06c52df69e97p-17,0x1.14ed37640f0fp-19},
+        {253,-0x1.9f45ff8b0bc36p-18,-0x1.2cdf930f7beeep-20},
+        {254,-0x1.fbdd7ac6bac87p-19,-0x1.6780914686389p-19},
+        {255,-0x1.aa8e9f1dbee3p-20,-0x1.7639e3b6751b8p-19},
+        {256,-0x1.65022d1ba8e69p-23,-0x1.122a58e9a44cep-19},
+        {257,0x1.b4f007c05379cp-22,-0x1.262135869d524p-20},
+        {258,0x1.a75c3409ca29cp-22,-0x1.a179eb753e7e6p-22},
+        {259,0x1.57e9065084cbcp-23,-0x1.e91794029803dp-25},
+        {239,0x1.215649c91c686p-22,0x1.55d227f3f8c38p-23},
+        {240,0x1.df6e2efa2a1afp-22,0x1.54ef1ec2eb945p-21},
+        {241,0x1.283fd77cf4901p-22,0x1.847e9d545fdf8p-20},
+        {242,-0x1.30efdde396ff8p-21,0x1.3cee605d2be3bp-19},
+        {243,-0x1.2c465b7214088p-19,0x1.8282ae7201a96p-19},
+        {244,-0x1.2f12a38830a9ep-18,0x1.401b4100747dap-19},
+        {245,-0x1.c51afd032c81ep-18,0x1.bdff289422132p-22},
+        {246,-0x1.0c2530263f65p-17,-0x1.9763c258ac0c6p-19},
+        {247,-0x1.eaffbb3a4e3cap-18,-0x1.ecfe326e53499p-18},
+        {248,-0x1.1db52a88f3ce8p-18,-0x1.7cbfd20cf5512p-17},
+        {249,0x1.e12d92d8ad6cep-21,-0x1.ca84b2e1b479ap-17},
+        {250,0x1.d952a79e969afp-18,-0x1.bbc574a24f746p-17},
+        {251,0x1.a7017e7acf988p-17,-0x1.45e317f4245eep-17},
+        {252,0x1.0bdbf2611f134p-16,-0x1.fa440af9dbb3bp-19},
+        {253,0x1.0e849f36ad003p-16,0x1.a5aafc1db806ep-19},
+        {254,0x1.b557f5e23007p-17,0x1.36288a84c37dcp-17},
+        {255,0x1.ff8e734345675p-18,0x1.b50bdfc9444fp-17},
+        {256,0x1.85487a511d6dcp-20,0x1.cd71244f05d3ep-17},
+        {257,-0x1.02a538e7c3db8p-18,0x1.87120e1e220ap-17},
+        {258,-0x1.debd200b8d08dp-18,0x1.0428ecd2cc10fp-17},
+        {259,-0x1.0d24e5424d2cp-17,0x1.ca6c370bb3b74p-19},
+        {260,-0x1.d0bcc66228aa6p-18,-0x1.455404ec227d7p-23},
+        {261,-0x1.3e128a9bd2bd4p-18,-0x1.30664c2627effp-19},
+        {262,-0x1.46432f4bf69ecp-19,-0x1.834eab8825002p-19},
+        {263,-0x1.71d5cdad14ebdp-21,-0x1.46ea20cb1be1ap-19},
+        {264,0x1.ede4d81eed6cap-23,-0x1.9bce0ac9d7b72p-20},
+        {265,0x1.e3e058672cf9dp-22,-0x1.76c6d86eebfe1p-21},
+        {266,0x1.394a1916efddbp-22,-0x1.9461a4566cf0bp-23},
+        {246,0x1.215f0905d706ap-22,0x1.55e417990958ap-23},
+        {247,0x1.dd6d974067a9cp-22,0x1.4af77d4c617bfp-21},
+        {248,0x1.432365520295p-22,0x1.766bd13c0a68ap-20},
+        {249,-0x1.f2208a575963bp-22,0x1.3366957d0dfa8p-19},
+        {250,-0x1.0d977328a349dp-19,0x1.7febafffc6ec4p-19},
+        {251,-0x1.182facb2f095ap-18,0x1.54ac57204dc21p-19},
+        {252,-0x1.ae569f341b688p-18,0x1.cfb3022a58298p-21},
+        {253,-0x1.0821548e5baacp-17,-0x1.2e0e6356d763ap-19},
+        {254,-0x1.0178bfbb5212ep-17,-0x1.a9b69bbd962f7p-18},
+        {255,-0x1.616e00d617132p-18,-0x1.5df243f2bd07fp-17},
+        {256,-0x1.898e2f8becp-21,-0x1.bc998c54d9bb2p-17},
+        {257,0x1.56eeb233f8e05p-18,-0x1.cb9914927995p-17},
+        {258,0x1.6d34cec9c0feep-17,-0x1.790db8b26d176p-17},
+        {259,0x1.f95afccd9d878p-17,-0x1.9e484212b6ce2p-18},
+        {260,0x1.14567a35c7958p-16,0x1.9d01d34eef9e6p-22},
+        {261,0x1.ed99ff3aa31f6p-17,0x1.cb95288c06324p-18},
+        {262,0x1.590b85410c106p-17,0x1.873d13e5e4222p-17},
+        {263,0x1.28d2b361351dep-18,0x1.ceb185a6d7b92p-17},
+        {264,-0x1.65f687c3e1f8ap-20,0x1.b54f16e38eabbp-17},
+        {265,-0x1.7b6da1f4c5c07p-18,0x1.4fc09d66f3989p-17},
+        {266,-0x1.05c259e67d118p-17,0x1.8926383356bd9p-18},
+        {267,-0x1.04e1360c1f6a7p-17,0x1.ec916a88ba602p-20},
+        {268,-0x1.9ecafd98583d9p-18,-0x1.2eea61b7a67e9p-20},
+        {269,-0x1.069237831a875p-18,-0x1.61d933a39f424p-19},
+        {270,-0x1.e221ef1c1557fp-20,-0x1.7bd7679ed525cp-19},
+        {271,-0x1.6bda5c7cd2474p-22,-0x1.26a382d3a9ae2p-19},
+        {272,0x1.70a34027e3386p-22,-0x1.5b8ec288f1e16p-20},
+        {273,0x1.d2ffd9bc963fap-22,-0x1.25ca73b88bda2p-21},
+        {274,0x1.04b1baa691321p-22,-0x1.140639531eb8ep-23},
+        {253,0x1.cc3b4dbf34db6p-23,0x1.ae4d431af1c4fp-24},
+        {254,0x1.bf86e10248896p-22,0x1.f121315fc9362p-22},
+        {255,0x1.a77c024da724bp-22,0x1.32b5d9382ee5ap-20},
+        {256,-0x1.276b175642992p-23,0x1.0e5f38ed40787p-19},
+        {257,-0x1.73a26a59df02ep-20,0x1.6ef252fba851cp-19},
+        {258,-0x1.bcaa107a69d2dp-19,0x1.77ab998954f46p-19},
+        {259,-0x1.744c2cb928131p-18,0x1.ce2dc25284065p-20},
+        {260,-0x1.f036cd36b101fp-18,-0x1.8cd18564b5d0cp-21},
+        {261,-0x1.0d09887c9856p-17,-0x1.2615c77ad6184p-18},
+        {262,-0x1.c40c4c45cea48p-18,-0x1.1d442e13998c5p-17},
+        {263,-0x1.bd94aa6315a5p-19,-0x1.934f6887a3269p-17},
+        {264,0x1.e83414db036ffp-20,-0x1.cee63f69aecb4p-17},
+        {265,0x1.00cd8ec2dfbbcp-17,-0x1.b4a6b15cc8becp-17},
+        {266,0x1.ad8c1933b9614p-17,-0x1.3ee1a88f39ec8p-17},
+        {267,0x1.0b6882c38699p-16,-0x1.03885d0bc347dp-18},
+        {268,0x1.1033ce82589d1p-16,0x1.65106e05d503p-19},
+        {269,0x1.c7b51f0fd317p-17,0x1.1faae377fe0a4p-17},
+        {270,0x1.24987fc681784p-17,0x1.a530dbaffbb7p-17},
+        {271,0x1.85d963d039326p-19,0x1.d108fea02e482p-17},
+        {272,-0x1.4a137c1d2ef16p-19,0x1.a4126ccdba208p-17},
+        {273,-0x1.a39253824f2b6p-18,0x1.3645491dbc99cp-17},
+        {274,-0x1.0a50a34c2e33bp-17,0x1.59b3978509ab7p-18},
+        {275,-0x1.00054b6b07a01p-17,0x1.6a6fdde757ff8p-20},
+        {276,-0x1.8f525514593dcp-18,-0x1.6e47ce3fab0b8p-20},
+        {277,-0x1.f4633948097bcp-19,-0x1.69c42ac212838p-19},
+        {278,-0x1.c8f30975c9ea8p-20,-0x1.797fc8c6a38e2p-19},
+        {279,-0x1.520037ed8a832p-22,-0x1.23fecd8630d4cp-19},
+        {280,0x1.6e8fda5753075p-22,-0x1.5ce2d3b4c4fb4p-20},
+        {281,0x1.d6960bb9d28e6p-22,-0x1.30ca0e68cf332p-21},
+        {282,0x1.14a8fe76b0e6bp-22,-0x1.378ccb93904cbp-23},
+        {261,0x1.6e4e2163dc0f9p-22,0x1.1f1d39e3a47e7p-22},
+        {262,0x1.e40c6af94a4ffp-22,0x1.a9ce60858f613p-21},
+        {263,0x1.b3dd4348a3b9cp-23,0x1.a852a07a5d138p-20},
+        {264,-0x1.5a1ed27cb700bp-21,0x1.4362d14a226e6p-19},
+        {265,-0x1.25e3e677d351cp-19,0x1.821c5fa814473p-19},
+        {266,-0x1.1def2caa9f8cp-18,0x1.4fde6432b97d4p-19},
+        {267,-0x1.abb5b51602c75p-18,0x1.e8c9e27708f69p-21},
+        {268,-0x1.0607f9855a9a6p-17,-0x1.089310b9027eep-19},
+        {269,-0x1.065ecae2b668cp-17,-0x1.83c63f1b824b8p-18},
+        {270,-0x1.8b93822a70368p-18,-0x1.46146c2390f08p-17},
+        {271,-0x1.0d27a3ecfe4ecp-19,-0x1.ab9c4d402c0b9p-17},
+        {272,0x1.b98f04919baf8p-19,-0x1.d1059abfc32fap-17},
+        {273,0x1.2b9c4b6dfb1bp-17,-0x1.a1b575c2ea136p-17},
+        {274,0x1.c8e83ad790a03p-17,-0x1.1e16dd2881c52p-17},
+        {275,0x1.0fca610c78df2p-16,-0x1.75d71cb2b3942p-19},
+        {276,0x1.0cca18d632508p-16,0x1.de5470f7c03ecp-19},
+        {277,0x1.b8713711c3922p-17,0x1.328be3a4e0e11p-17},
+        {278,0x1.14d191a8e9e02p-17,0x1.ac7677665db7ap-17},
+        {279,0x1.5ad735bf19ccep-19,0x1.d0bc5c99a321ap-17},
+        {280,-0x1.5af6d70110586p-19,0x1.a1d385fc114d4p-17},
+        {281,-0x1.a33fd9005d7dp-18,0x1.367dc6b062e67p-17},
+        {282,-0x1.09a76553a7f46p-17,0x1.620ca7bd8abbep-18},
+        {283,-0x1.0226d5d14bcb3p-17,0x1.9fbbaf97097f6p-20},
+        {284,-0x1.9b679ea2ea42cp-18,-0x1.3d585a58587bfp-20},
+        {285,-0x1.0b8ff0af33168p-18,-0x1.5e5558a38c1fcp-19},
+        {286,-0x1.073f2f79bacf4p-19,-0x1.7f26396a5cfdp-19},
+        {287,-0x1.0cb6cd92162bbp-21,-0x1.36da558f1c7b6p-19},
+        {288,0x1.19e7c2c804fcdp-22,-0x1.8b919568ef0acp-20},
+        {289,0x1.e459dc64439d9p-22,-0x1.7d9fee163727cp-21},
+        {290,0x1.52c00e309d388p-22,-0x1.dfc681b51df8ap-23},
+        {268,0x1.c933b4b0e9c88p-23,0x1.a8ae6a31bb8dbp-24},
+        {269,0x1.b5fbe99fc6a7ep-22,0x1.cec7ca45cad2ap-22},
+        {270,0x1.c104919950d32p-22,0x1.1940993df1ca8p-20},
+        {271,0x1.9f7d43478060dp-29,0x1.f390b2f070f07p-20},
+        {272,-0x1.14a482de60964p-20,0x1.5ddc19dfe9d14p-19},
+        {273,-0x1.6b3c13e84693p-19,0x1.824e2b19c7072p-19},
+        {274,-0x1.412fccf550ac2p-18,0x1.2ce1ba66d67d6p-19},
+        {275,-0x1.c58c56fb24e46p-18,0x1.b350c23b213cbp-22},
+        {276,-0x1.0a51d778a995fp-17,-0x1.5ee8642285c8ep-19},
+        {277,-0x1.00e5170cc04fep-17,-0x1.ad8d3b78282a7p-18},
+        {278,-0x1.71a1ec3cdb9abp-18,-0x1.5545aebdfb6e1p-17},
+        {279,-0x1.9cd694d21ab84p-20,-0x1.b28716ee3b832p-17},
+        {280,0x1.ee3692efeb4fp-19,-0x1.d0996f43b6248p-17},
+        {281,0x1.32ec0286248bep-17,-0x1.9dea1e25c03d2p-17},
+        {282,0x1.ca780b0209bep-17,-0x1.1c03e15d00706p-17},
+        {283,0x1.0f72046b3615ap-16,-0x1.834ea1635f752p-19},
+        {284,0x1.0defd58177edep-16,0x1.b969a5f1e4b47p-19},
+        {285,0x1.c226923356c36p-17,0x1.26c43706b0396p-17},
+        {286,0x1.2747f56604818p-17,0x1.a3debb61b1d4ep-17},
+        {287,0x1.bceb0d88c25a8p-19,0x1.d101153ab1453p-17},
+        {288,-0x1.f07d8d437d78fp-20,0x1.ae0194e489d4ep-17},
+        {289,-0x1.7f3a70b7617cep-18,0x1.4d87495638356p-17},
+        {290,-0x1.0362448aa53bp-17,0x1.9c041c69639bep-18},
+        {291,-0x1.08fe37bdb11d6p-17,0x1.3fde6ce5362d6p-19},
+        {292,-0x1.bdde8924a4619p-18,-0x1.30163dde3035cp-21},
+        {293,-0x1.37abc3373e277p-18,-0x1.374cde4a7991bp-19},
+        {294,-0x1.5a0b9acf9dc45p-19,-0x1.8311ae392066ep-19},
+        {295,-0x1.f92d727d79004p-21,-0x1.58844b698e8f4p-19},
+        {296,0x1.9ef934b83432ep-25,-0x1.e496fda6ab687p-20},
+        {297,0x1.cb983cae13693p-22,-0x1.0c1af21f33219p-20},
+        {298,0x1.ab823c2c51d5ap-22,-0x1.ad8eeebd501f2p-22},
+        {299,0x1.aa57c2e9fdafcp-23,-0x1.724333ad0b72p-24},
+        {276,0x1.f541b73e854e8p-23,0x1.fddd30f9967d7p-24},
+        {277,0x1.bf84060c1aa3dp-22,0x1.f10b2a9e50dep-22},
+        {278,0x1.ba3b10fdcc708p-22,0x1.20b4002382df8p-20},
+        {279,-0x1.9415143fe44fap-29,0x1.f5769b339c6bdp-20},
+        {280,-0x1.0d3f6ab291604p-20,0x1.5c42fa1c5721ep-19},
+        {281,-0x1.5e92712a336a5p-19,0x1.82ea2ba176337p-19},
+        {282,-0x1.3615ee61674dep-18,0x1.38f50a90b166ep-19},
+        {283,-0x1.b92c36a68b14fp-18,0x1.624e5d57c3514p-21},
+        {284,-0x1.076755d4f7013p-17,-0x1.2077de98963b9p-19},
+        {285,-0x1.0683027cebe25p-17,-0x1.82759737050c2p-18},
+        {286,-0x1.9765460afc23ap-18,-0x1.3e84895c0b876p-17},
+        {287,-0x1.5639f32371c97p-19,-0x1.a2748314726e6p-17},
+        {288,0x1.3665183bbc38cp-19,-0x1.d042a41703517p-17},
+        {289,0x1.01682790a2c5fp-17,-0x1.b468fcb802cebp-17},
+        {290,0x1.a1b339be9507ap-17,-0x1.4b54badaaf29cp-17},
+        {291,0x1.05db5992daa78p-16,-0x1.47cdd0341a637p-18},
+        {292,0x1.13c317a84a702p-16,0x1.1ab6440da5e1ep-20},
+        {293,0x1.eec0db4f0ba52p-17,0x1.c757baaf56286p-18},
+        {294,0x1.6e60c864d02aap-17,0x1.78294849da45ep-17},
+        {295,0x1.861d5db78b39ap-18,0x1.c7159ec5ff51fp-17},
+        {296,0x1.12b5c12e6cef4p-21,0x1.c7f3005c300f4p-17},
+        {297,-0x1.09c9f5cbdf54ap-18,0x1.846c5709176dcp-17},
+        {298,-0x1.ce58d7f471dd4p-18,0x1.142a7ac5b61ffp-17},
+        {299,-0x1.0ce4431ede069p-17,0x1.2a634246c5614p-18},
+        {300,-0x1.f8e5da08c326ap-18,0x1.1b17286291db4p-20},
+        {301,-0x1.8e64f2b01cf2ap-18,-0x1.71cfd4f2fe998p-20},
+        {302,-0x1.05aa07d8e60c8p-18,-0x1.6271c1a6b86d4p-19},
+        {303,-0x1.0b14287e6d406p-19,-0x1.7f9d08056e008p-19},
+        {304,-0x1.38a42aaadf00cp-21,-0x1.3e29b8a15344cp-19},
+        {305,0x1.b0292af0047efp-23,-0x1.a9172ed509ebep-20},
+        {306,0x1.e1d58eecda272p-22,-0x1.bfaec4b085c05p-21},
+        {307,0x1.865df20147c18p-22,-0x1.4f6709a0d3f1p-22},
+        {308,0x1.592e69c9d19ep-23,-0x1.ec53d186fd388p-25},
+        {284,0x1.d1de524b47adp-23,0x1.b8aca0190a9b3p-24},
+        {285,0x1.b023557253034p-22,0x1.bbb935535e44ep-22},
+        {286,0x1.cf6951c89d446p-22,0x1.06b737c25cc9p-20},
+        {287,0x1.b439084734c5ap-24,0x1.d19f72442e3b2p-20},
+        {288,-0x1.98e6f36c5e4c8p-21,0x1.4c67199e6ab29p-19},
+        {289,-0x1.28d6c5896a0bcp-19,0x1.8249db89f9776p-19},
+        {290,-0x1.1370406967cf4p-18,0x1.586b1e2857d6cp-19},
+        {291,-0x1.9779638619a9dp-18,0x1.4da548ffd7d9bp-20},
+        {292,-0x1.fc1835522bd4cp-18,-0x1.3d6a9810f3a9ap-20},
+        {293,-0x1.0cc3727443afdp-17,-0x1.2debca1c5d9eap-18},
+        {294,-0x1.d045dbdc1b1bcp-18,-0x1.1262465c6d498p-17},
+        {295,-0x1.148942c7ddc9p-18,-0x1.80561feae8fb4p-17},
+        {296,0x1.4d9695ff55331p-23,-0x1.c52f9a1516875p-17},
+        {297,0x1.620913e7c05c5p-18,-0x1.caa50218aa672p-17},
+        {298,0x1.5a1af0b0a2589p-17,-0x1.868339c77594ep-17},
+        {299,0x1.dece584b56bfcp-17,-0x1.fd43ddc36c1dap-18},
+        {300,0x1.11a1b6a1a75f1p-16,-0x1.227b116bebbb2p-19},
+        {301,0x1.0c5c62cc08ed4p-16,0x1.eb2e105381fc8p-19},
+        {302,0x1.c177f83d6cbeap-17,0x1.279bc8db0d67p-17},
+        {303,0x1.30385eb75c8f5p-17,0x1.9f53c7c1321eep-17},
+        {304,0x1.0647d2aac22dbp-18,0x1.d029eb2d7f38p-17},
+        {305,-0x1.1fe11d5ea5ab3p-20,0x1.b89d7ea0e8972p-17},
+        {306,-0x1.5024ea6cb9a65p-18,0x1.668f12197ac6ep-17},
+        {307,-0x1.ee5a92c11d441p-18,0x1.e4c83d7c45c51p-18},
+        {308,-0x1.0d5e9f9d53eaap-17,0x1.df98e8a9dce55p-19},
+        {309,-0x1.e72b5a3784b6p-18,0x1.e368e36a66daap-22},
+        {310,-0x1.767a038d69cf4p-18,-0x1.c701897284187p-20},
+        {311,-0x1.e1348a1f33cd4p-19,-0x1.6f245a2f01f34p-19},
+        {312,-0x1.de2a42c8ecbb3p-20,-0x1.7b7a759ae2df6p-19},
+        {313,-0x1.01586003e41f4p-21,-0x1.34dc449e854efp-19},
+        {314,0x1.f4f046a56898fp-23,-0x1.9a366d1939ad6p-20},
+        {315,0x1.e36589da51cdep-22,-0x1.b1cf161db6d5cp-21},
+        {316,0x1.8437490f5de42p-22,-0x1.4abf4d3631946p-22},
+        {317,0x1.60b24b8cddd94p-23,-0x1.00861d85ecd38p-24},
+        {293,0x1.74c7a1d8a1217p-22,0x1.2b56333cfc2f7p-22},
+        {294,0x1.e4e8257ea1588p-22,0x1.8da098eef1d1p-21},
+        {295,0x1.3677841f42b4ap-22,0x1.7d2ce46d0dc4ep-20},
+        {296,-0x1.57b2911151476p-22,0x1.24925d77afe09p-19},
+        {297,-0x1.8db7b1e27a613p-20,0x1.729ad1cc6f02dp-19},
+        {298,-0x1.a6d04552b6369p-19,0x1.7ba16fa27a4b4p-19},
+        {299,-0x1.552c2abbccefcp-18,0x1.147763acd171cp-19},
+        {300,-0x1.cbf53889d3f17p-18,0x1.19d38ff7bebe4p-22},
+        {301,-0x1.09d1e5ffb1b48p-17,-0x1.52ba05641b9cap-19},
+        {302,-0x1.04d3720cd983ep-17,-0x1.90c31da2637b1p-18},
+        {303,-0x1.976b48b5aea25p-18,-0x1.3e7dfb5131d88p-17},
+        {304,-0x1.766cfcd34bdc6p-19,-0x1.9e04a65632521p-17},
+        {305,0x1.ce6d64ba3ac7dp-20,-0x1.ce89bdc0c19bp-17},
+        {306,0x1.c6e317cec5b5cp-18,-0x1.bea41f7fcfb6p-17},
+        {307,0x1.8148f46558d88p-17,-0x1.692d04ffdd9b6p-17},
+        {308,0x1.f51717300a23p-17,-0x1.af557edfd7432p-18},
+        {309,0x1.13d7a8bec7fdcp-16,-0x1.08077a0d45b3cp-20},
+        {310,0x1.075d753bb4b1dp-16,0x1.36d81feb2ddd6p-18},
+        {311,0x1.af572a38a2d66p-17,0x1.3ce2d3aec1c18p-17},
+        {312,0x1.1cc91e860c569p-17,0x1.a8dde916fdf4cp-17},
+        {313,0x1.ce9ef5c16e506p-19,0x1.d0e3dbcdd26c6p-17},
+        {314,-0x1.68f3ef62f84aap-20,0x1.b524332e49c58p-17},
+        {315,-0x1.56d4da1e7c94cp-18,0x1.6348c5dbd5198p-17},
+        {316,-0x1.eea3c6a97d208p-18,0x1.e40f05762595fp-18},
+        {317,-0x1.0d7535fdba672p-17,0x1.eb96cece060e4p-19},
+        {318,-0x1.ebdf31c58efe3p-18,0x1.4055a57b543a2p-21},
+        {319,-0x1.811bcfc1a1e3cp-18,-0x1.a2cb58747941p-20},
+        {320,-0x1.feb59d582d65fp-19,-0x1.6691309770d15p-19},
+        {321,-0x1.0d7015a74afc4p-19,-0x1.7fe19c6a4da0ep-19},
+        {322,-0x1.6080fecbaf787p-21,-0x1.445668bd9fc4bp-19},
+        {323,0x1.26dbf84ca1fa8p-23,-0x1.c3f014697cdc6p-20},
+        {324,0x1.d39c985bc16f4p-22,-0x1.00373cddddc4p-20},
+        {325,0x1.af11136158cap-22,-0x1.b85c5295f4e4p-22},
+        {326,0x1.db44823387bb2p-23,-0x1.ca702598039aap-24},
+        {301,0x1.ff36043fb5d05p-23,0x1.09294232985f8p-23},
+        {302,0x1.b6f4a595f7df4p-22,0x1.d204c644d320ap-22},
+        {303,0x1.d0920a54a5458p-22,0x1.04fce961d35b7p-20},
+        {304,0x1.288adce21b767p-23,0x1.c39fdcdd75295p-20},
+        {305,-0x1.4f57549da4757p-21,0x1.41b9a8ef5a064p-19},
+        {306,-0x1.00e9f2f3152e2p-19,0x1.7e49833df73e4p-19},
+        {307,-0x1.e83883f4c7346p-19,0x1.6d3b3d6c5054cp-19},
+        {308,-0x1.729de8487e8c6p-18,0x1.d37b76f6a7078p-20},
+        {309,-0x1.df52d6d6a8968p-18,-0x1.e0c49cfe74cfp-23},
+        {310,-0x1.0c49b58753092p-17,-0x1.9df086c58cfb7p-19},
+        {311,-0x1.ffefb6a080888p-18,-0x1.b38aca588c796p-18},
+        {312,-0x1.83358c08fd92p-18,-0x1.4b26ee6930c29p-17},
+        {313,-0x1.47538f4115104p-19,-0x1.a468b0394b488p-17},
+        {314,0x1.0de4e3e598074p-19,-0x1.cf7e088bde559p-17},
+        {315,0x1.d0f973334c74cp-18,-0x1.bd14d11addfb5p-17},
+        {316,0x1.817af2e52600dp-17,-0x1.6901f190d92a7p-17},
+        {317,0x1.f2bab596c2b14p-17,-0x1.b872a69173e3cp-18},
+        {318,0x1.136989fcd9c78p-16,-0x1.5cebf7c82f806p-20},
+        {319,0x1.09dad810f8d42p-16,0x1.1860009450564p-18},
+        {320,0x1.bd16b50b5f18ap-17,0x1.2cfb31d50b43ep-17},
+        {321,0x1.33894e9251083p-17,0x1.9d926837f2ed5p-17},
+        {322,0x1.211e8414d7554p-18,0x1.cf101b76495c2p-17},
+        {323,-0x1.ea1bb803e6ef1p-22,0x1.bf868f8e2901cp-17},
+        {324,-0x1.25b2dc7b1839p-18,0x1.79797e0f33eb4p-17},
+        {325,-0x1.d250253df39bap-18,0x1.1075e626f81dap-17},
+        {326,-0x1.0c5a635933e6p-17,0x1.37b636cdcf5c4p-18},
+        {327,-0x1.0150e76908d0dp-17,0x1.8a8bc43081166p-20},
+        {328,-0x1.a9dc5941f784p-18,-0x1.f9f90e178c7f2p-21},
+        {329,-0x1.2faacc04ec056p-18,-0x1.3f776c89d01fap-19},
+        {330,-0x1.67dc95a23ba01p-19,-0x1.827a88a44ff4bp-19},
+        {331,-0x1.38e9358b20dp-20,-0x1.6517a2cd7643ap-19},
+        {332,-0x1.4cd4714b9341bp-23,-0x1.10acd46557666p-19},
+        {333,0x1.71eb7089ece04p-22,-0x1.5ab6bee7a5482p-20},
+        {334,0x1.e192c846be92cp-22,-0x1.61e0324a4a083p-21},
+        {335,0x1.5e818e5c071b1p-22,-0x1.0313e4b6af1f2p-22},
+        {310,0x1.247cf690f028fp-22,0x1.5d7d6a0a6ff12p-23},
+        {311,0x1.c929e3e91d515p-22,0x1.0c9f1547c317p-21},
+        {312,0x1.c01ee35217508p-22,0x1.1a44ad6e4c195p-20},
+        {313,0x1.7d277a9fc4f88p-24,0x1.d652a290a0ce8p-20},
+        {314,-0x1.7378bc5a310c6p-21,0x1.47211862e09bap-19},
+        {315,-0x1.085dc1142fa66p-19,0x1.7f44660318945p-19},
+        {316,-0x1.ea17212df7635p-19,0x1.6cb46ac18d344p-19},
+        {317,-0x1.70073e0b9eba2p-18,0x1.dbacfd779c8bdp-20},
+        {318,-0x1.dadfccc5c01fbp-18,-0x1.be448646b1d9ep-24},
+        {319,-0x1.0b5b2191476e5p-17,-0x1.7c951426de3c2p-19},
+        {320,-0x1.0390e2e4093d8p-17,-0x1.9a89ff2e10332p-18},
+        {321,-0x1.9a0b470c88932p-18,-0x1.3cbe4237c68c8p-17},
+        {322,-0x1.9c63a3a45d434p-19,-0x1.98741f29be60fp-17},
+        {323,0x1.26b50268b7931p-20,-0x1.cba77e1a41207p-17},
+        {324,0x1.8853b68e2a0f2p-18,-0x1.c6d331c1cf6ffp-17},
+        {325,0x1.5e1fdbb27e5e4p-17,-0x1.83c89dfdf657cp-17},
+        {326,0x1.d8b97e961b7f6p-17,-0x1.07e8a83a0a05bp-17},
+        {327,0x1.0f201b1a98ca6p-16,-0x1.8f12de3a04642p-19},
+        {328,0x1.11094ac2e13acp-16,0x1.3f8c03c82ff5ep-19},
+        {329,0x1.e37d5a204a2a7p-17,0x1.ee369bf364f2p-18},
+        {330,0x1.6de41b69436dap-17,0x1.7881e97297e92p-17},
+        {331,0x1.ac5e0e40d9ee7p-18,0x1.c268c93ab4943p-17},
+        {332,0x1.b142eab52d5aap-20,0x1.ce1c0e61564ecp-17},
+        {333,-0x1.641c3cb703e34p-19,0x1.a08f8f7c33eecp-17},
+        {334,-0x1.87bc1842a9e3cp-18,0x1.486a299a45001p-17},
+        {335,-0x1.ffbe3dccfbe11p-18,0x1.b42457df5db15p-18},
+        {336,-0x1.0c95e2f2793d1p-17,0x1.ab5a36433bacp-19},
+        {337,-0x1.e47fb20d27d1bp-18,0x1.8e9a915536ca4p-22},
+        {338,-0x1.7d5d5ee91c05ap-18,-0x1.afcb6e7f1941cp-20},
+        {339,-0x1.02bf5014e6518p-18,-0x1.645dea3bb3624p-19},
+        {340,-0x1.1f6ace8a393b4p-19,-0x1.819d0a7b4935cp-19},
+        {341,-0x1.b34e4a74991ddp-21,-0x1.4fe9d73961da5p-19},
+        {342,0x1.b668acd8d8d3p-26,-0x1.ec3a5af4acf96p-20},
+        {343,0x1.acc3e7f017686p-22,-0x1.2defe206229ep-20},
+        {344,0x1.d3e01318601afp-22,-0x1.2848b1499382ap-21},
+        {345,0x1.3aa7af2acd76cp-22,-0x1.9806a8d006ce3p-23},
+        {319,0x1.17d1e8512a978p-22,0x1.3ec96a8416896p-23},
+        {320,0x1.bec854396fb73p-22,0x1.ee28a638ff4fap-22},
+        {321,0x1.d00ca54a9f5ep-22,0x1.05c4cde796a5bp-20},
+        {322,0x1.5f86fc14211d5p-23,0x1.b93fc63ffe6d5p-20},
+        {323,-0x1.15a6c26fd7c4fp-21,0x1.385e51dc60093p-19},
+        {324,-0x1.bfefc82bab573p-20,0x1.788cfb78ebfcap-19},
+        {325,-0x1.b1de6ece17304p-19,0x1.79b37a50d027ep-19},
+        {326,-0x1.501f16f69b41ap-18,0x1.1af041e061e38p-19},
+        {327,-0x1.bf41b87a1a656p-18,0x1.20877e21638cfp-21},
+        {328,-0x1.054a0ab0d2aa5p-17,-0x1.f9e537d7a5924p-20},
+        {329,-0x1.0b431ffefabbep-17,-0x1.4baebc384275cp-18},
+        {330,-0x1.ce88a5bbc3664p-18,-0x1.13f65d20586p-17},
+        {331,-0x1.2b4f08f8fa406p-18,-0x1.7721b335446cap-17},
+        {332,-0x1.b6511f92c4fcap-21,-0x1.bba124c85a7fap-17},
+        {333,0x1.e6f8974eff78dp-19,-0x1.d0a8edc22367p-17},
+        {334,0x1.1510d477b0cbdp-17,-0x1.ac53aa419765ep-17},
+        {335,0x1.9e9d20c8d1e5cp-17,-0x1.4e673bda84137p-17},
+        {336,0x1.ffd62e22e0a14p-17,-0x1.823f8966c6db6p-18},
+        {337,0x1.141d348dc8266p-16,-0x1.7b1f5ceef86cbp-21},
+        {338,0x1.0868332001afep-16,0x1.2a72eb2f501aep-18},
+        {339,0x1.bda51f80a7dfep-17,0x1.2c4b3de3a0692p-17},
+        {340,0x1.3ced9de62fae6p-17,0x1.986b86814b4dfp-17},
+        {341,0x1.48058a6aacc36p-18,0x1.ccb5077ab6bfap-17},
+        {342,0x1.5e7a15fd1d656p-22,0x1.c68b40f85723cp-17},
+        {343,-0x1.e1033e77f2a6ap-19,0x1.8d6b53c2602acp-17},
+        {344,-0x1.ab66d65732fccp-18,0x1.30a04a5b0ec8ap-17},
+        {345,-0x1.05faaddb4acc6p-17,0x1.8708e3ca067c6p-18},
+        {346,-0x1.0a8aa7bfe868cp-17,0x1.6520779f00068p-19},
+        {347,-0x1.d84f74c1bcda6p-18,0x1.40626de60f3e8p-25},
+        {348,-0x1.6ffe477325efap-18,-0x1.dbc4272e5e4b6p-20},
+        {349,-0x1.f0f1c2215ad4ap-19,-0x1.6abcbdf61315cp-19},
+        {350,-0x1.13e8c77e8b75bp-19,-0x1.80916d9a88b8p-19},
+        {351,-0x1.a38b91bd4179p-21,-0x1.4dd41c07e3cf2p-19},
+        {352,0x1.a9448a7374a37p-26,-0x1.ec79f4b8256b4p-20},
+        {353,0x1.a6dffd9e17cd6p-22,-0x1.333b798215822p-20},
+        {354,0x1.d88198aec436ap-22,-0x1.3735dba1cdd78p-21},
+        {355,0x1.4b7530f176d5ap-22,-0x1.c8fd76089a16cp-23},
+        {328,0x1.bc28c2e765becp-23,0x1.90f9e018f2539p-24},
+        {329,0x1.9214d6b0d5952p-22,0x1.69f1c0c6d56bcp-22},
+        {330,0x1.e4ac8c8cdf6f4p-22,0x1.9e92d6e81896cp-21},
+        {331,0x1.4b149156f7d7p-22,0x1.7202ff4715e5ep-20},
+        {332,-0x1.89d015fae8bdap-23,0x1.14588f89cd242p-19},
+        {333,-0x1.298fd1f23146ep-20,0x1.6221928d92514p-19},
+        {334,-0x1.4a9e411278014p-19,0x1.8345d1264a33ap-19},
+        {335,-0x1.14bf7cb81b3b9p-18,0x1.575c4c8345396p-19},
+        {336,-0x1.87e7d116d9315p-18,0x1.8a2d6c9daec68p-20},
+        {337,-0x1.e74c2dc4e6f5ep-18,-0x1.e86d7079b6ba2p-22},
+        {338,-0x1.0c61168676ea4p-17,-0x1.a23141d944475p-19},
+        {339,-0x1.027db393d6336p-17,-0x1.a2621bc2303b2p-18},
+        {340,-0x1.9d6afdc3c7242p-18,-0x1.3a769ed4dde83p-17},
+        {341,-0x1.c22761e41307p-19,-0x1.9289e154d4646p-17},
+        {342,0x1.08cba598c2225p-21,-0x1.c7cb1e9b6c6c2p-17},
+        {343,0x1.4b2b89c1ed8d4p-18,-0x1.cc7930367535p-17},
+        {344,0x1.3a455c993a6cfp-17,-0x1.99e66eeaba06cp-17},
+        {345,0x1.b881181009452p-17,-0x1.326d7636c5cfdp-17},
+        {346,0x1.06430decd3beep-16,-0x1.4339087c7535p-18},
+        {347,0x1.14640bd1b2a7ap-16,0x1.62a71631e8e17p-23},
+        {348,0x1.045464704935fp-16,0x1.57d871e1d2482p-18},
+        {349,0x1.b1678a919fe1ap-17,0x1.3a9116dbabefp-17},
+        {350,0x1.31113881de42p-17,0x1.9edcd87dce21dp-17},
+        {351,0x1.375f5b68d8ec9p-18,0x1.cdd1a665dfdcap-17},
+        {352,0x1.d7bda18758ce2p-23,0x1.c5b1a2a475884p-17},
+        {353,-0x1.df544f4940374p-19,0x1.8db392f26265cp-17},
+        {354,-0x1.a6c852e58db17p-18,0x1.33f43a3f6a2a4p-17},
+        {355,-0x1.045b5b6a7d13cp-17,0x1.94666326a9884p-18},
+        {356,-0x1.0bb7434a3677ap-17,0x1.889ea49c87b26p-19},
+        {357,-0x1.e2386683404ep-18,0x1.4838374d8751ep-22},
+        {358,-0x1.80c0f487259dep-18,-0x1.a3f5fc47f4bd3p-20},
+        {359,-0x1.0d2e2c95f846p-18,-0x1.5d1bd7933dfe8p-19},
+        {360,-0x1.3d4d0cff2918ap-19,-0x1.8320dfa2be512p-19},
+        {361,-0x1.15c729a595158p-20,-0x1.5e14480050286p-19},
+        {362,-0x1.2a3231b77f2d4p-23,-0x1.0e86b0b32167ep-19},
+        {363,0x1.5f0f36c86e96ap-22,-0x1.66733767365cdp-20},
+        {364,0x1.e4e5e54c5496ap-22,-0x1.8c4f3432c016p-21},
+        {365,0x1.87fdf2b8354d8p-22,-0x1.52e2a5147bb44p-22},
+        {366,0x1.a397903f310a6p-23,-0x1.66b9504213ef8p-24},
+        {338,0x1.21005f319b13bp-22,0x1.54cc4b5b9b254p-23},
+        {339,0x1.bdbb4c9eebb18p-22,0x1.ea2863822ba2bp-22},
+        {340,0x1.d6863c5229fbp-22,0x1.f67d85f666688p-21},
+        {341,0x1.d00f4b82c28c4p-23,0x1.a24db3bd27bp-20},
+        {342,-0x1.8535e5a42a889p-22,0x1.292477a13d0bfp-19},
+        {343,-0x1.6cb44bbec2a88p-20,0x1.6dddf3016bf26p-19},
+        {344,-0x1.709c39fed8301p-19,0x1.81eb9e23bd55ap-19},
+        {345,-0x1.268b698c55094p-18,0x1.48291ba317da7p-19},
+        {346,-0x1.954912b0743b4p-18,0x1.566d37bf40d0ap-20},
+        {347,-0x1.ee5f839ad1546p-18,-0x1.6c910d8ff8cdap-21},
+        {348,-0x1.0ce7205391bbfp-17,-0x1.bca84f9268226p-19},
+        {349,-0x1.0150b10019a77p-17,-0x1.aa8dc3382f731p-18},
+        {350,-0x1.9c081105ac54p-18,-0x1.3b64e9a6a667cp-17},
+        {351,-0x1.cad5d6ecd0974p-19,-0x1.911eccaba99fcp-17},
+        {352,0x1.39476d7ab7ep-22,-0x1.c643db34cfb9ep-17},
+        {353,0x1.33e5a3706d28cp-18,-0x1.ce06d97bb5ed7p-17},
+        {354,0x1.2b5b23f24233p-17,-0x1.a1ccca5ff0ef3p-17},
+        {355,0x1.a9b7e4d53cab4p-17,-0x1.42f5139788f01p-17},
+        {356,0x1.01381b74063c6p-16,-0x1.764c0ff8970dcp-18},
+        {357,0x1.1405c39664068p-16,-0x1.af964d6146f21p-21},
+        {358,0x1.0a5eb1265af11p-16,0x1.117e6a8e46b6cp-18},
+        {359,0x1.cb81689e77165p-17,0x1.1a93c53341c19p-17},
+        {360,0x1.57890026bc4a4p-17,0x1.88302b1c75d58p-17},
+        {361,0x1.9435e56ad5e2ap-18,0x1.c57256bf7c0a7p-17},
+        {362,0x1.badf5ed136ffep-20,0x1.ce3d7d7b5b49fp-17},
+        {363,-0x1.353c494a84ceap-19,0x1.a6b564a4c8af9p-17},
+        {364,-0x1.690640858406ap-18,0x1.59e85a7b710d5p-17},
+        {365,-0x1.ea44c4ce5be79p-18,0x1.ee8a7162af07dp-18},
+        {366,-0x1.0d3418ec51368p-17,0x1.1ef0516768b02p-18},
+        {367,-0x1.01527ba1fe09dp-17,0x1.8afab8740e396p-20},
+        {368,-0x1.b5d1f9c8e72bdp-18,-0x1.84aec1443bc4ap-21},
+        {369,-0x1.4b83a0a409f7ap-18,-0x1.20a61c3079d26p-19},
+        {370,-0x1.b5eceafad3932p-19,-0x1.78ef2bb0246e9p-19},
+        {371,-0x1.db87029f90a4dp-20,-0x1.7b384e0abded8p-19},
+        {372,-0x1.5796c61f4a8bep-21,-0x1.42fa193201077p-19},
+        {373,0x1.3249c1f35c638p-24,-0x1.dc8fd27b31214p-20},
+        {374,0x1.ac3ad7de64759p-22,-0x1.2e6c7108bae4cp-20},
+        {375,0x1.da78aa4fdc2bp-22,-0x1.3e6bd4c611f15p-21},
+        {376,0x1.5b0d6e8fae33ap-22,-0x1.fa8045133c774p-23},
+        {348,0x1.34b09c38b2cd6p-22,0x1.878c86f3b88e6p-23},
+        {349,0x1.c6384bd6017ap-22,0x1.06127ba83f2aap-21},
+        {350,0x1.d1d5fe554d94ep-22,0x1.030b8e92994ap-20},
+        {351,0x1.bcffbb62ba096p-23,0x1.a65e13866aebcp-20},
+        {352,-0x1.807f4a66f4b1p-22,0x1.28ac7f50aa4ebp-19},
+        {353,-0x1.61c02e742aacap-20,0x1.6c26352dd500cp-19},
+        {354,-0x1.63b2b0051457p-19,0x1.82a9676c21822p-19},
+        {355,-0x1.1c33432823caap-18,0x1.5145dc03b195p-19},
+        {356,-0x1.88bba6889a116p-18,0x1.8710cb0e9b46ap-20},
+        {357,-0x1.e381debbe44fap-18,-0x1.704e7999e39e8p-22},
+        {358,-0x1.0b3b27fd2dd6cp-17,-0x1.7910e1e1694eep-19},
+        {359,-0x1.06c8f90087efap-17,-0x1.7fbf0eff5b8d8p-18},
+        {360,-0x1.bb4bb0334d0ap-18,-0x1.246eb24995404p-17},
+        {361,-0x1.1c63b8c60cedp-18,-0x1.7d388d6ad1393p-17},
+        {362,-0x1.d0b76c576f852p-21,-0x1.bb0d67f35a2fap-17},
+        {363,0x1.abddc37b092ddp-19,-0x1.d106c49b774cap-17},
+        {364,0x1.f4189f7ad5e5ep-18,-0x1.b71db737d0726p-17},
+        {365,0x1.7dc9f53d5c2c8p-17,-0x1.6c09acaea4206p-17},
+        {366,0x1.e429c31d4383p-17,-0x1.ebeffcea0285ap-18},
+        {367,0x1.0f50ab91255afp-16,-0x1.8799c6a5e53f6p-19},
+        {368,0x1.125b256fe2116p-16,0x1.f2668d1e79a38p-20},
+        {369,0x1.f585289bb05c3p-17,0x1.ad893f304ec38p-18},
+        {370,0x1.97eaa0d117f8p-17,0x1.54e9e2bb0d356p-17},
+        {371,0x1.19466dff148d2p-17,0x1.aa71035751abep-17},
+        {372,0x1.16335984ec4c5p-18,0x1.cf8a20e2f7291p-17},
+        {373,-0x1.1eff6e1d96dc8p-32,0x1.c3d50a48ef6cep-17},
+        {374,-0x1.ddc056aafc049p-19,0x1.8df5c82451396p-17},
+        {375,-0x1.9e2c5d4e2f346p-18,0x1.39f01209406a2p-17},
+        {376,-0x1.00e5026c0f6d2p-17,0x1.ad5cb5d2c26fcp-18},
+        {377,-0x1.0d24f6f930f3ep-17,0x1.ccfa57c3e3cedp-19},
+        {378,-0x1.f32f9ba41faacp-18,0x1.c5423b5abd2ecp-21},
+        {379,-0x1.9f6e600ec6c95p-18,-0x1.2bdf0bef977dep-20},
+        {380,-0x1.3503fee1ed646p-18,-0x1.3a01f7d5ce7d8p-19},
+        {381,-0x1.915751ca3c8ccp-19,-0x1.7eb5eb3ece6bep-19},
+        {382,-0x1.aa07f7940e9ecp-20,-0x1.761db20473592p-19},
+        {383,-0x1.2120a6b8b0d2ep-21,-0x1.3a4b460e02846p-19},
+        {384,0x1.e440c02e2c7fap-24,-0x1.cd676d84245ddp-20},
+        {385,0x1.b5b58a4eea218p-22,-0x1.255659af316e3p-20},
+        {386,0x1.d8ae877a2aa87p-22,-0x1.37caebc6a12d5p-21},
+        {387,0x1.5b348dc9a6e5ep-22,-0x1.fafbfe311c6c6p-23},
+        {388,0x1.556508c393224p-23,-0x1.e1a6ec2aaab63p-25},
+        {358,0x1.0a4aa073fed6ap-22,0x1.1ff6d11ca6e34p-23},
+        {359,0x1.a7ae6b8ef3ba4p-22,0x1.a231db1e4caf8p-22},
+        {360,0x1.e370a186e9e61p-22,0x1.b1748e26a0001p-21},
+        {361,0x1.50a1a5b5797fap-22,0x1.6eded08443136p-20},
+        {362,-0x1.ee390544f5863p-24,0x1.0b491783e261cp-19},
+        {363,-0x1.e5999fc073544p-21,0x1.562e4d1cdbecp-19},
+        {364,-0x1.15067acf048f7p-19,0x1.80a96c09d2028p-19},
+        {365,-0x1.d881951b6a56fp-19,0x1.71543e35b85aep-19},
+        {366,-0x1.56e9629975ed4p-18,0x1.121ca68b4665ep-19},
+        {367,-0x1.ba14614e06184p-18,0x1.583639add0a14p-21},
+        {368,-0x1.0102a08be88c8p-17,-0x1.834e74acc7056p-20},
+        {369,-0x1.0d712e731c895p-17,-0x1.11541b8f45abcp-18},
+        {370,-0x1.f4897d6e33aeep-18,-0x1.d4bf10c813c15p-18},
+        {371,-0x1.864522d5c0c7cp-18,-0x1.4946d0e2bdd9fp-17},
+        {372,-0x1.a32a4dc68668p-19,-0x1.97665a3a52356p-17},
+        {373,0x1.ca57d366d17d4p-22,-0x1.c74ace10c1bb4p-17},
+        {374,0x1.2d024da95227p-18,-0x1.ce6ab71090365p-17},
+        {375,0x1.203a093e83d32p-17,-0x1.a73ae8f98effp-17},
+        {376,0x1.9a65f5c336655p-17,-0x1.5284deb7d04dp-17},
+        {377,0x1.f50bbe912ab2fp-17,-0x1.af6136eaf5e84p-18},
+        {378,0x1.11f79d498e7fp-16,-0x1.0f99892d9fafp-19},
+        {379,0x1.1050210d2b8e7p-16,0x1.5f63063f7a8eep-19},
+        {380,0x1.eb93b55cf75c2p-17,0x1.d29daf9e8f684p-18},
+        {381,0x1.8c0f7b2ae7306p-17,0x1.5fd75277781bap-17},
+        {382,0x1.0eed66698f6abp-17,0x1.aef1e128482b8p-17},
+        {383,0x1.08e62ed168cd8p-18,0x1.d00b5de04bd2cp-17},
+        {384,-0x1.2b26d81189d15p-24,0x1.c3364613d419ap-17},
+        {385,-0x1.d9272c4006174p-19,0x1.8ebb5c9c254c4p-17},
+        {386,-0x1.98a3c001c93dfp-18,0x1.3da56545b38e6p-17},
+        {387,-0x1.fd741a1c6ced3p-18,0x1.bb37a77eb614ap-18},
+        {388,-0x1.0d78e9e1c9a5ap-17,0x1.f1f6aa5d2cdabp-19},
+        {389,-0x1.faf75a822e31ep-18,0x1.319218100a763p-20},
+        {390,-0x1.ae5a1d8841d3p-18,-0x1.cee4bdd910ed4p-21},
+        {391,-0x1.492590875d5ap-18,-0x1.2380574909a5ap-19},
+        {392,-0x1.bda26baf760cdp-19,-0x1.7768842b41ca4p-19},
+        {393,-0x1.fca65ca993ca5p-20,-0x1.7de49cde46e16p-19},
+        {394,-0x1.a34e336c5cc41p-21,-0x1.4dc888751115bp-19},
+        {395,-0x1.5a43346cefd76p-25,-0x1.008028955c31cp-19},
+        {396,0x1.732f8a1cc2bafp-22,-0x1.59e01d0465dfap-20},
+        {397,0x1.e4ef95b383c48p-22,-0x1.8fa63f405a37ep-21},
+        {398,0x1.96ad3729f2021p-22,-0x1.7503f2e9b846dp-22},
+        {399,0x1.e7699fa0fb96ep-23,-0x1.e1d0034195a8cp-24},
+        {368,0x1.74b39a0040b31p-23,0x1.1cffe3cd850f1p-24},
+        {369,0x1.60c4321a3ef62p-22,0x1.06d79dc736855p-22},
+        {370,0x1.d726c0ac758b6p-22,0x1.3281bdfca9c1cp-21},
+        {371,0x1.c12f2bad9682bp-22,0x1.190bf25b7c072p-20},
+        {372,0x1.7107ad533b0bfp-23,0x1.b5d2490d57d09p-20},
+        {373,-0x1.9b7b901d7dd75p-22,0x1.2b4ec9ecee4eap-19},
+        {374,-0x1.5a8138091f423p-20,0x1.6af73607d722p-19},
+        {375,-0x1.53e8e3288206ap-19,0x1.83293241fa09ap-19},
+        {376,-0x1.0d39bd4ecd80ep-18,0x1.5d0bc625b7c9ep-19},
+        {377,-0x1.74964c1fc481fp-18,0x1.ccfc592e41831p-20},
+        {378,-0x1.cfd0944c7b05ap-18,0x1.707c27b410faep-23},
+        {379,-0x1.0637896c2d676p-17,-0x1.0c31f66fffac9p-19},
+        {380,-0x1.0c5a628bf1969p-17,-0x1.3739934f63468p-18},
+        {381,-0x1.e6fda1d2cb2dep-18,-0x1.f614174ab874ep-18},
+        {382,-0x1.70d99c53968f2p-18,-0x1.55a5b39f5ee63p-17},
+        {383,-0x1.727f431635842p-19,-0x1.9e898c8c420e8p-17},
+        {384,0x1.957cdb911582ap-21,-0x1.c993f25776f2ep-17},
+        {385,0x1.3ca12e53bb1b6p-18,-0x1.cd779c9a48148p-17},
+        {386,0x1.23dcd70e6b285p-17,-0x1.a57d62f22f04cp-17},
+        {387,0x1.9a496c7fc9453p-17,-0x1.529ee2532c31fp-17},
+        {388,0x1.f2f391a48c26fp-17,-0x1.b77853c7fdb6cp-18},
+        {389,0x1.1146f181503f2p-16,-0x1.335ea123354c2p-19},
+        {390,0x1.1176235002d09p-16,0x1.2a368ffe2bd4bp-19},
+        {391,0x1.f4026e1dc8e6bp-17,0x1.b36595fcf79ccp-18},
+        {392,0x1.9be5d44ded235p-17,0x1.510d53818995fp-17},
+        {393,0x1.25d2d79a5a272p-17,0x1.a4897fdc4522ep-17},
+        {394,0x1.40c6cd8408e2cp-18,0x1.cd3117d1f1572p-17},
+        {395,0x1.b4b1096d99df8p-21,0x1.c9f33602e7d48p-17},
+        {396,-0x1.6bfd435b694a4p-19,0x1.9f7260c38b262p-17},
+        {397,-0x1.6e84e1b29bd7dp-18,0x1.56ed03a03eab2p-17},
+        {398,-0x1.e5b4f805dca82p-18,0x1.f8fb31609944ap-18},
+        {399,-0x1.0c385351361d7p-17,0x1.3a16a40619fp-18},
+        {400,-0x1.0683574313626p-17,0x1.11338d965f3e6p-19},
+        {401,-0x1.d1048a6b5a6c3p-18,-0x1.32e9f4940182bp-23},
+        {402,-0x1.761dbe2e3db7ap-18,-0x1.c8001d4972297p-20},
+        {403,-0x1.0ecf18508d3a2p-18,-0x1.5be08b0b7a042p-19},
+        {404,-0x1.56bf61a0eb324p-19,-0x1.831a22ff8686ep-19},
+        {405,-0x1.5ef4d0e4c0829p-20,-0x1.6bb117bfc0c4ap-19},
+        {406,-0x1.a77773bb031a8p-22,-0x1.2c75a560e6faap-19},
+        {407,0x1.64308dcd61bcap-23,-0x1.b853908c2e2dap-20},
+        {408,0x1.bf39934c0a046p-22,-0x1.1b44869ff95d6p-20},
+        {409,0x1.d820fc46e9172p-22,-0x1.35d3bcbd6e4ebp-21},
+        {410,0x1.6324646a77024p-22,-0x1.0af071128627ep-22},
+        {411,0x1.79c329c3c5a71p-23,-0x1.24831fdff01fp-24},
+        {379,0x1.af694d55349fep-23,0x1.7a909aadd26e2p-24},
+        {380,0x1.7726921ae986ep-22,0x1.2fd6f230d2ad5p-22},
+        {381,0x1.ddda60063d2bcp-22,0x1.4cbd4ae044144p-21},
+        {382,0x1.b4d76c84af872p-22,0x1.2632a63792efcp-20},
+        {383,0x1.3ca74c9012a95p-23,0x1.bfdb532cbf99p-20},
+        {384,-0x1.b526df48d6acfp-22,0x1.2dc1ae6b6f767p-19},
+        {385,-0x1.5ba9638bafd97p-20,0x1.6b26bf8715a9p-19},
+        {386,-0x1.4f59bc5cb18c3p-19,0x1.8338284d0256p-19},
+        {387,-0x1.07b749582c92p-18,0x1.60f6c59cd289bp-19},
+        {388,-0x1.6c594c539376fp-18,0x1.e6f55fc9a2fa4p-20},
+        {389,-0x1.c6e83bfc6380cp-18,0x1.91f7d340eede4p-22},
+        {390,-0x1.0343357d3e604p-17,-0x1.beb0938f936a2p-20},
+        {391,-0x1.0d55b05e15598p-17,-0x1.180a9404ce76ap-18},
+        {392,-0x1.f60ab7869b7e3p-18,-0x1.d0a1c750a803cp-18},
+        {393,-0x1.9157dc04868c2p-18,-0x1.42605a7f1ac5p-17},
+        {394,-0x1.dab9faba9d96dp-19,-0x1.8e74e55e2744ap-17},
+        {395,-0x1.3eef5383a6feep-22,-0x1.c1143f13ff67fp-17},
+        {396,0x1.d1163c39da386p-19,-0x1.d0d5c5b30c03p-17},
+        {397,0x1.ef06e3b9e11c9p-18,-0x1.b802bf041df8bp-17},
+        {398,0x1.7180cfa5039f6p-17,-0x1.75bd50036d66ep-17},
+        {399,0x1.d4371e95bf094p-17,-0x1.0e737259aa1b8p-17},
+        {400,0x1.09f11893e2a25p-16,-0x1.170223dfba3e6p-18},
+        {401,0x1.14607af710b9cp-16,0x1.7dbe7f23ddee1p-23},
+        {402,0x1.08211dae1872cp-16,0x1.2d9e68db9b7cbp-18},
+        {403,0x1.cd690708602ccp-17,0x1.17f8577a5cb84p-17},
+        {404,0x1.6856e6cc889aap-17,0x1.7c8e8761cd74ap-17},
+        {405,0x1.da21bd9def0f2p-18,0x1.bb93483f814f2p-17},
+        {406,0x1.a6d761d64102ap-19,0x1.d105744e70c82p-17},
+        {407,-0x1.38ad31407ea32p-21,0x1.be2e095d68739p-17},
+        {408,-0x1.f98d421418e9dp-19,0x1.891d232e6c4f8p-17},
+        {409,-0x1.9be3bc5c89aa4p-18,0x1.3b76b7810a18fp-17},
+        {410,-0x1.fb53a77a324b2p-18,0x1.c19772b9d62b4p-18},
+        {411,-0x1.0d8079c9a81a2p-17,0x1.0999c2935db94p-18},
+        {412,-0x1.01659b0422668p-17,0x1.8d2ed1552cc3cp-20},
+        {413,-0x1.c05d51a24d1a2p-18,-0x1.13d8090b045f8p-21},
+        {414,-0x1.6461b3f133bdep-18,-0x1.fec359948236dp-20},
+        {415,-0x1.ff3d28b481baap-19,-0x1.6656976d82317p-19},
+        {416,-0x1.40f47149e36d6p-19,-0x1.832c9c7335f4ep-19},
+        {417,-0x1.451865f489123p-20,-0x1.674a0bce25098p-19},
+        {418,-0x1.780048433ab72p-22,-0x1.27d1f03e9c53cp-19},
+        {419,0x1.7f641a0025226p-23,-0x1.b2fae52386dc4p-20},
+        {420,0x1.bfbde0bee7bfdp-22,-0x1.1aaf8e9277bc2p-20},
+        {421,0x1.d9a383c9b1d8cp-22,-0x1.3b37cfca7e08ep-21},
+        {422,0x1.6b575f3034188p-22,-0x1.1982e362327aap-22},
+        {423,0x1.950e1b054f81ap-23,-0x1.4ec7eb438b588p-24},
+        {390,0x1.a02ca71f3e14ap-23,0x1.60dc5368690fp-24},
+        {391,0x1.6c3193a92ea91p-22,0x1.1b0e0c9fe5058p-22},
+        {392,0x1.d84cab61345f6p-22,0x1.36644494b9c0bp-21},
+        {393,0x1.c5d900651884ap-22,0x1.1381b3de85216p-20},
+        {394,0x1.bcf99881243dap-23,0x1.a65b20435297ap-20},
+        {395,-0x1.2a1ba769b2ee2p-22,0x1.1fc0e2243c559p-19},
+        {396,-0x1.205d6146b1209p-20,0x1.6042969e387d5p-19},
+        {397,-0x1.24505e31ebeaap-19,0x1.81f090cfbf192p-19},
+        {398,-0x1.d8ecdb044404ap-19,0x1.7133f92b9a59p-19},
+        {399,-0x1.4e4e3307fb7cep-18,0x1.1d26ca0395d39p-19},
+        {400,-0x1.ab23d98801c16p-18,0x1.ed6ac0b0d5438p-21},
+        {401,-0x1.f3e47a4e58e88p-18,-0x1.d347bdf4b61fep-21},
+        {402,-0x1.0c7d72e395106p-17,-0x1.a8079331fa131p-19},
+        {403,-0x1.0661dfaac1386p-17,-0x1.8343aa98272e4p-18},
+        {404,-0x1.c60d508df1872p-18,-0x1.1b734d91f6f32p-17},
+        {405,-0x1.4231fbc2e301dp-18,-0x1.6d0ec7d326abdp-17},
+        {406,-0x1.0cc65caf25e63p-19,-0x1.ab98d495397e4p-17},
+        {407,0x1.80a5b5efaa812p-20,-0x1.cd4cd1be57126p-17},
+        {408,0x1.5d4bf11d5d9aap-18,-0x1.cb01e30e9d761p-17},
+        {409,0x1.2c135db8af332p-17,-0x1.a168c7b4b9452p-17},
+        {410,0x1.9b219645c413fp-17,-0x1.51c972eb3017cp-17},
+        {411,0x1.ef8cc14b487p-17,-0x1.c434dce0ba8bbp-18},
+        {412,0x1.0fddcef69a974p-16,-0x1.719b746398c19p-19},
+        {413,0x1.130e0f0710c21p-16,0x1.93527f4363f46p-20},
+        {414,0x1.00f82a9b36e5cp-16,0x1.7880509f794dbp-18},
+        {415,0x1.b769e57f2849ap-17,0x1.33a92bbf3e826p-17},
+        {416,0x1.4f0f5dd13f6eep-17,0x1.8d9aa327e03cep-17},
+        {417,0x1.a90a45e2acdd2p-18,0x1.c2d0be006ee0ap-17},
+        {418,0x1.53b3e19296f1fp-19,0x1.d09add1c5dd8cp-17},
+        {419,-0x1.1704349fcfcf1p-20,0x1.b8f8e6afe4b19p-17},
+        {420,-0x1.0ff1f89707a21p-18,0x1.820c0e6fcfc56p-17},
+        {421,-0x1.a54976da711a2p-18,0x1.34f9b5f95d6e2p-17},
+        {422,-0x1.fe2ca907b8cadp-18,0x1.b8e9b70ad9ef1p-18},
+        {423,-0x1.0d82b219bf7eep-17,0x1.065c84708bfb5p-18},
+        {424,-0x1.01a2bea9e9513p-17,0x1.935b68fcf7034p-20},
+        {425,-0x1.c37f9eb201808p-18,-0x1.e0d688305b17ep-22},
+        {426,-0x1.6af99914a0b6p-18,-0x1.eb21bfc44cffap-20},
+        {427,-0x1.092976b4d389ep-18,-0x1.5ff25bd328be8p-19},
+        {428,-0x1.570d839c2985ap-19,-0x1.8315528cba70bp-19},
+        {429,-0x1.6ffe3edc1eccp-20,-0x1.6e5892565930ep-19},
+        {430,-0x1.01da6976dcdcp-21,-0x1.34eafc56780a7p-19},
+        {431,0x1.94f86c59d809bp-24,-0x1.d4431422ca73ap-20},
+        {432,0x1.9b4f8993c208dp-22,-0x1.3cf150fcc770cp-20},
+        {433,0x1.e3e75c871c96cp-22,-0x1.76a1de12cd81ap-21},
+        {434,0x1.9475a97c83f1ap-22,-0x1.6f8dd3d2d3987p-22},
+        {435,0x1.feccd2d8fc7p-23,-0x1.089244e2205ccp-23},
+        {402,0x1.2c448e6d945aep-22,0x1.711c61eba075ap-23},
+        {403,0x1.b23d12b8a21f4p-22,0x1.c2352d3c0a56dp-22},
+        {404,0x1.e3f161931b5f6p-22,0x1.ab8cffcf378f8p-21},
+        {405,0x1.73a6d4c76b09ep-22,0x1.598f21fe78b1cp-20},
+        {406,0x1.46a9dc8408b0ap-26,0x1.ee532244b1fb3p-20},
+        {407,-0x1.3a658d5f97a6dp-21,0x1.3e678ee73d3a2p-19},
+        {408,-0x1.8fbfeb8c0c0c5p-20,0x1.72d435f92a556p-19},
+        {409,-0x1.65b729552077cp-19,0x1.8288fe14d31dp-19},
+        {410,-0x1.0e7c6883ed76p-18,0x1.5c17a46a10b14p-19},
+        {411,-0x1.6d74f7aae54dcp-18,0x1.e37f38734f6fap-20},
+        {412,-0x1.c34dd527a034p-18,0x1.e51ed9fc5eec8p-22},
+        {413,-0x1.00e95437eaf64p-17,-0x1.812cb8afc46cdp-20},
+        {414,-0x1.0d7c025fa8e62p-17,-0x1.f84fc965e2ef2p-19},
+        {415,-0x1.01844a97ee162p-17,-0x1.a90577c718ffap-18},
+        {416,-0x1.b2c3712c40282p-18,-0x1.2b12efa8529f5p-17},
+        {417,-0x1.290eaa3d1bfedp-18,-0x1.78082c60923bap-17},
+        {418,-0x1.afaae8abfdbc1p-20,-0x1.b17b8a5199cafp-17},
+        {419,0x1.de4c9ed1ee8f6p-20,-0x1.ceb50f69259aap-17},
+        {420,0x1.6e54366d5f265p-18,-0x1.c977eebf94ddap-17},
+        {421,0x1.30a4d3ca32746p-17,-0x1.9f0c54ec21064p-17},
+        {422,0x1.9c15a5ab245cep-17,-0x1.50d94098cfa66p-17},
+        {423,0x1.ee448bc0292acp-17,-0x1.c8e1b3685c0c4p-18},
+        {424,0x1.0f2ef946c6ab3p-16,-0x1.8c1d7835a60ap-19},
+        {425,0x1.1390c63a16ae6p-16,0x1.3cdc9c5ac8312p-20},
+        {426,0x1.03cc6618bb24dp-16,0x1.5d17c8115a9c4p-18},
+        {427,0x1.c33887e11ff6ap-17,0x1.2552ed89801a7p-17},
+        {428,0x1.61687eb8c6244p-17,0x1.81781a552a5e1p-17},
+        {429,0x1.d907391da977dp-18,0x1.bbbec937ec92ep-17},
+        {430,0x1.c1e2dd1821fc3p-19,0x1.d0ec51c4db24p-17},
+        {431,-0x1.af9ae83a27e0dp-23,0x1.c1fc8bc5b76cep-17},
+        {432,-0x1.ba54196cfa3cp-19,0x1.93c28dc03d533p-17},
+        {433,-0x1.7e3884831002cp-18,0x1.4e0a5b5d8780bp-17},
+        {434,-0x1.e78951a66f1b8p-18,0x1.f4c60e7db6548p-18},
+        {435,-0x1.0b9b19885d0b7p-17,0x1.4588964fc7aep-18},
+        {436,-0x1.09023be006c6cp-17,0x1.41148da05e952p-19},
+        {437,-0x1.e1fbd0889f5f6p-18,0x1.4251d8630ca7fp-22},
+        {438,-0x1.946b41180984ep-18,-0x1.59c1a11eb9bbp-20},
+        {439,-0x1.37b707fc20957p-18,-0x1.372389646fdbap-19},
+        {440,-0x1.b294fc5ec7f1cp-19,-0x1.7984e9731eed8p-19},
+        {441,-0x1.07f394e2da4fap-19,-0x1.7f2c3bbac9bf9p-19},
+        {442,-0x1.f825aa2e25601p-21,-0x1.5859a758ba56cp-19},
+        {443,-0x1.b973b3ce3418cp-23,-0x1.171eba05cc664p-19},
+        {444,0x1.fb0658363fbf9p-23,-0x1.98cc2d81105fap-20},
+        {445,0x1.cc120485be5dep-22,-0x1.0b71a820e7c17p-20},
+        {446,0x1.d6667b1f4af48p-22,-0x1.2fff8f759c956p-21},
+        {447,0x1.6bce84543d018p-22,-0x1.1a55126f5c016p-22},
+        {448,0x1.a85ab171eba21p-23,-0x1.6e7b79c40d128p-24},
+        {413,0x1.6ca966aeb0c13p-23,0x1.1126224396479p-24},
+        {414,0x1.4b8ee63b7db16p-22,0x1.c9147e89471eep-23},
+        {415,0x1.c37d0e2a3e484p-22,0x1.00463c00e6ddap-21},
+        {416,0x1.df5dccfe05fcp-22,0x1.cfc909a0cd581p-21},
+        {417,0x1.56fcb68bd8e2ap-22,0x1.6b31715b3c58p-20},
+        {418,-0x1.b0d958df58868p-26,0x1.fc5c68316b227p-20},
+        {419,-0x1.551c47f51c123p-21,0x1.42932edcb38f7p-19},
+        {420,-0x1.9a1c2e093233ap-20,0x1.74288dcc12d0ep-19},
+        {421,-0x1.671f07b39c6c9p-19,0x1.8274e50511ddfp-19},
+        {422,-0x1.0c8becb49b5ecp-18,0x1.5d82295bac7d5p-19},
+        {423,-0x1.68e9f84754a0cp-18,0x1.f14e908e12fd1p-20},
+        {424,-0x1.bd4ddbc3c4d0fp-18,0x1.354530af4379cp-21},
+        {425,-0x1.fcbbe1bc179b8p-18,-0x1.455fd6b70d897p-20},
+        {426,-0x1.0d1bbdacb3116p-17,-0x1.cbd00a11dd41cp-19},
+        {427,-0x1.0551c7af4c15cp-17,-0x1.8c5d8bcf7e80cp-18},
+        {428,-0x1.c69e94029451p-18,-0x1.1af16828b04e2p-17},
+        {429,-0x1.4c0e4c5172d48p-18,-0x1.6872960dd73d2p-17},
+        {430,-0x1.3e29afc628594p-19,-0x1.a58a6d3da3c98p-17},
+        {431,0x1.ae27ac7e40e82p-21,-0x1.c9da93062dd5cp-17},
+        {432,0x1.2247a34daa23bp-18,-0x1.cef52e01146f8p-17},
+        {433,0x1.090e8978b7dfap-17,-0x1.b156bef744036p-17},
+        {434,0x1.7785caea47718p-17,-0x1.710b32b873424p-17},
+        {435,0x1.d1c938a762e09p-17,-0x1.11e18ffa4be55p-17},
+        {436,0x1.0763022e64fd1p-16,-0x1.364385ab5ac16p-18},
+        {437,0x1.141d74b7e6102p-16,-0x1.6cab4cc263774p-21},
+        {438,0x1.0dc253c01f73cp-16,0x1.be3bb1cd9b47bp-19},
+        {439,0x1.e9f4ec146948p-17,0x1.d83444daee583p-18},
+        {440,0x1.98a6cfb5684f3p-17,0x1.542b7542aaca6p-17},
+        {441,0x1.2fd757d9716aap-17,0x1.9f7609dc4fa21p-17},
+        {442,0x1.73b55e6f0c90bp-18,0x1.c8f12b032e012p-17},
+        {443,0x1.07540dcea3a7bp-19,0x1.cf4c68c9c2eaap-17},
+        {444,-0x1.6cd08d779654bp-20,0x1.b4e5c9ed72434p-17},
+        {445,-0x1.171456c9b46b2p-18,0x1.7f48688112f07p-17},
+        {446,-0x1.a364620fb050cp-18,0x1.364b1f50fbc8p-17},
+        {447,-0x1.f9d4547a09ad1p-18,0x1.c5e7cfa65854cp-18},
+        {448,-0x1.0d3ba95d97543p-17,0x1.1c967ff3cbd66p-18},
+        {449,-0x1.0587164360ca9p-17,0x1.012a4873891a2p-19},
+        {450,-0x1.d5a724ac51b72p-18,-0x1.ece09d90a38bap-26},
+        {451,-0x1.86d46789a42c8p-18,-0x1.8dee124319bc4p-20},
+        {452,-0x1.2bc4d193415e3p-18,-0x1.432e62cff753cp-19},
+        {453,-0x1.a1101599f624ep-19,-0x1.7c783a0c4b595p-19},
+        {454,-0x1.fae3e59bf06d5p-20,-0x1.7dbd53a5fccadp-19},
+        {455,-0x1.e59afda0760d2p-21,-0x1.56297e9b23871p-19},
+        {456,-0x1.abf105048b808p-23,-0x1.1654debe50ffcp-19},
+        {457,0x1.ef4351ce84dfcp-23,-0x1.9b6f0ff86a071p-20},
+        {458,0x1.c77502890621bp-22,-0x1.11801a85fd3fdp-20},
+        {459,0x1.daa4cf168e52ep-22,-0x1.3efbb2461019ap-21},
+        {460,0x1.7a0196e77b2c5p-22,-0x1.3572dc3ca8d6ep-22},
+        {461,0x1.d1304d9c17352p-23,-0x1.b6f897a264881p-24},
+        {426,0x1.34b672d0fec0ep-22,0x1.8771e7329056ep-23},
+        {427,0x1.b2267d541c3d8p-22,0x1.c1e1f8a6e2f86p-22},
+        {428,0x1.e4b5303c2951cp-22,0x1.9e268c1a5b08ap-21},
+        {429,0x1.8b1086119981dp-22,0x1.496796587097bp-20},
+        {430,0x1.8f05a89b68358p-24,0x1.d4c107f398b89p-20},
+        {431,-0x1.c61ef626b2d6ap-22,0x1.2f554402e2d03p-19},
+        {432,-0x1.434fa3656f9e4p-20,0x1.66f3a9174b13ep-19},
+        {433,-0x1.2cb9b48d6c9e8p-19,0x1.82715993ad39cp-19},
+        {434,-0x1.d2a32fda4687bp-19,0x1.72b828aeabc14p-19},
+        {435,-0x1.42f361cb4ac1p-18,0x1.2ab9ea5e1628p-19},
+        {436,-0x1.99c2b19d7ed86p-18,0x1.43cdf6a121d17p-20},
+        {437,-0x1.e2502131a76c2p-18,-0x1.4cd8df5b4deb1p-22},
+        {438,-0x1.083e6ceaf7588p-17,-0x1.31600373666eap-19},
+        {439,-0x1.0c83dde2c821ep-17,-0x1.330f3dca8487ep-18},
+        {440,-0x1.f333ebdac0ca4p-18,-0x1.d826d3f43a63cp-18},
+        {441,-0x1.9a4be238a04aep-18,-0x1.3c80a78eaf428p-17},
+        {442,-0x1.0ec39f7e66db4p-18,-0x1.827a8a1a2f2e4p-17},
+        {443,-0x1.5b186b5dff306p-20,-0x1.b5c2e0d973ea5p-17},
+        {444,0x1.03e730c1c75ap-19,-0x1.cf36e035ac3fcp-17},
+        {445,0x1.6b09f9989dc9ep-18,-0x1.c9c4a34b869fap-17},
+        {446,0x1.28852f5cd79e4p-17,-0x1.a32e0375b9e44p-17},
+        {447,0x1.8fc020902fb24p-17,-0x1.5c7ad77b2b862p-17},
+        {448,0x1.e1a14161843b7p-17,-0x1.f40ded414603fp-18},
+        {449,0x1.0b2bd4f9e158cp-16,-0x1.064c106e79529p-18},
+        {450,0x1.14625aa73aa2ap-16,-0x1.66293c4802a5bp-25},
+        {451,0x1.0b8d36e8a931fp-16,0x1.00ef1475db77bp-18},
+        {452,0x1.e313bfde24ca6p-17,0x1.ef5d514210148p-18},
+        {453,0x1.91be971bad822p-17,0x1.5aa79bac0237bp-17},
+        {454,0x1.2adf6f44334acp-17,0x1.a20053db22b9p-17},
+        {455,0x1.70083a18770eep-18,0x1.c94b7f1b66b4cp-17},
+        {456,0x1.0d99e2b7daf52p-19,0x1.cf6eef924bd8ep-17},
+        {457,-0x1.49d3f80ebbeecp-20,0x1.b697d7f5dae7fp-17},
+        {458,-0x1.0b489b40a5c68p-18,0x1.83ca84b2e651bp-17},
+        {459,-0x1.97d873309b14ep-18,0x1.3e20f29744cbcp-17},
+        {460,-0x1.f1da3976caac6p-18,0x1.dbac0a8b01e54p-18},
+        {461,-0x1.0c5dd997b4c7ap-17,0x1.36816286c6738p-18},
+        {462,-0x1.088c71e6e0f5bp-17,0x1.378a1eef0c906p-19},
+        {463,-0x1.e39c842c544e6p-18,0x1.74fe69c7549a2p-22},
+        {464,-0x1.9b7e63a13deb8p-18,-0x1.3c868c5fcf26cp-20},
+        {465,-0x1.44dcf481606f2p-18,-0x1.28831485e489p-19},
+        {466,-0x1.d65e0b1527b2cp-19,-0x1.71d077fa0220cp-19},
+        {467,-0x1.30028603c40dcp-19,-0x1.829c0f948e3fp-19},
+        {468,-0x1.488ade5d8bbfp-20,-0x1.67e2161871462p-19},
+        {469,-0x1.d4f4e442e612fp-22,-0x1.30b4258358c5ep-19},
+        {470,0x1.6b49d8ca68873p-24,-0x1.d7c771d4b4b74p-20},
+        {471,0x1.8725593e0673cp-22,-0x1.4c3dd318c09e6p-20},
+        {472,0x1.e48021357c1f8p-22,-0x1.a2d2a03b1657bp-21},
+        {473,0x1.b4392a4d4b262p-22,-0x1.c8a25d725e968p-22},
+        {474,0x1.37c0dace2f505p-22,-0x1.8fbd551008368p-23},
+        {438,0x1.d379222049085p-23,0x1.bb2a931ff13cfp-24},
+        {439,0x1.738bc5c8df946p-22,0x1.28c58a2a8145cp-22},
+        {440,0x1.d4ae5da9ea265p-22,0x1.2a8e0623f33c6p-21},
+        {441,0x1.d572543fb54c2p-22,0x1.fa454eff942a8p-21},
+        {442,0x1.388ea1ed1a648p-22,0x1.7c06ecf5a2c78p-20},
+        {443,-0x1.d8e145e8e0a75p-25,0x1.02b0019b07a88p-19},
+        {444,-0x1.577bae45d9a2p-21,0x1.42edc0138f84ep-19},
+        {445,-0x1.8c437fbd5b2b7p-20,0x1.7259d39b09719p-19},
+        {446,-0x1.5548fe44c613ep-19,0x1.8318e997890c2p-19},
+        {447,-0x1.fb10dd18e9748p-19,0x1.679b42730fc02p-19},
+        {448,-0x1.54e4a93ebe796p-18,0x1.14b0ea898ca3fp-19},
+        {449,-0x1.a78d56b25ac04p-18,0x1.074dd7e966f3ep-20},
+        {450,-0x1.eace0ea5c4eeep-18,-0x1.2f93d198a1d2bp-21},
+        {451,-0x1.09c743081678ep-17,-0x1.52cb550f9f359p-19},
+        {452,-0x1.0bd8ac38205dcp-17,-0x1.41002a08d0f4fp-18},
+        {453,-0x1.ef81467a2f36p-18,-0x1.e19fb84151225p-18},
+        {454,-0x1.96fa96a397776p-18,-0x1.3eb0f1ee719c9p-17},
+        {455,-0x1.0ebec892a2e9ap-18,-0x1.827acb6289964p-17},
+        {456,-0x1.7223c8c42928cp-20,-0x1.b49f6289fa29cp-17},
+        {457,0x1.d3df83b2ab3fep-20,-0x1.ce8d31828607fp-17},
+        {458,0x1.56e700847716fp-18,-0x1.cb8456c148af5p-17},
+        {459,0x1.1bc8d814f0c1ep-17,-0x1.a941e4a5aa204p-17},
+        {460,0x1.8219cf68971cap-17,-0x1.6868958150c88p-17},
+        {461,0x1.d5799499ddc71p-17,-0x1.0c961a54f9f5ap-17},
+        {462,0x1.0735a8da718c9p-16,-0x1.383ddc3cee254p-18},
+        {463,0x1.13dcb6b580d6p-16,-0x1.f767edea193d5p-21},
+        {464,0x1.0f86be272b4d8p-16,0x1.7eac8c9253917p-19},
+        {465,0x1.f534f2b55f16p-17,0x1.ae976e8f5cc5bp-18},
+        {466,0x1.ae0986430b12fp-17,0x1.3e3975336cdddp-17},
+        {467,0x1.50005dff42146p-17,0x1.8cfcdd26174p-17},
+        {468,0x1.c6ddd747a6f13p-18,0x1.be941543c82bcp-17},
+        {469,0x1.c677734d9d04cp-19,0x1.d0e1c1af8331cp-17},
+        {470,0x1.e450df5047c6p-24,0x1.c4c3bf98da6bcp-17},
+        {471,-0x1.7759077e03e5fp-19,0x1.9dd2081afb0ccp-17},
+        {472,-0x1.599d5cafc59e8p-18,0x1.61d180581b68cp-17},
+        {473,-0x1.ca06f897a8ac4p-18,0x1.17eff9a1b8e0ep-17},
+        {474,-0x1.04e5213e1f56dp-17,0x1.8fc9a0668375fp-18},
+        {475,-0x1.0d5c555b971fcp-17,0x1.e44eb2842814cp-19},
+        {476,-0x1.016d5f3bce00ep-17,0x1.8e665d943eac7p-20},
+        {477,-0x1.cb4b13c337472p-18,-0x1.27f446555f87ap-22},
+        {478,-0x1.7ed444f010282p-18,-0x1.aa6f466608e6p-20},
+        {479,-0x1.288501f6d1b81p-18,-0x1.463eb3ad2536p-19},
+        {480,-0x1.a4d3f6f17d762p-19,-0x1.7bdd214640ef6p-19},
+        {481,-0x1.09273bd92acf4p-19,-0x1.7f4e14f8da2fep-19},
+        {482,-0x1.11fcbb3c095b6p-20,-0x1.5d3ae8e8ad0a4p-19},
+        {483,-0x1.4ea68ec02eecdp-22,-0x1.2398a8905e339p-19},
+        {484,0x1.3ee4c725e9a9ep-23,-0x1.bf6985484f8a2p-20},
+        {485,0x1.9faa2048053f5p-22,-0x1.395d4300d4928p-20},
+        {486,0x1.e4e1ea0c6c876p-22,-0x1.8a10202cd14b8p-21},
+        {487,0x1.abb359d40b1a3p-22,-0x1.adda08ecaaf8bp-22},
+        {488,0x1.2f9ec8b4546c8p-22,-0x1.79cedb581f081p-23},
+        {451,0x1.13f2c3e68bce8p-22,0x1.3586c06945031p-23},
+        {452,0x1.93b2a1a89d92ep-22,0x1.6da0842eff145p-22},
+        {453,0x1.dfee040a2c96p-22,0x1.5752a4f9addeap-21},
+        {454,0x1.c37738564c24p-22,0x1.165f9408d452cp-20},
+        {455,0x1.05fe28a37495ep-22,0x1.94e86a1491b52p-20},
+        {456,-0x1.16063f84e4297p-23,0x1.0d3a8f9eb3e6cp-19},
+        {457,-0x1.890dda77892c6p-21,0x1.4a28a6735a38ap-19},
+        {458,-0x1.a5faaac010f78p-20,0x1.7598579522158p-19},
+        {459,-0x1.60603ad08ff3dp-19,0x1.82c01d85c19dap-19},
+        {460,-0x1.01341a7877fb7p-18,0x1.6545d90934a3ap-19},
+        {461,-0x1.561fb8763a046p-18,0x1.13102397ddc5p-19},
+        {462,-0x1.a67991943f53p-18,0x1.0c353abe3b576p-20},
+        {463,-0x1.e86c90c100d5bp-18,-0x1.07daaa93778c5p-21},
+        {464,-0x1.08e2fb701034dp-17,-0x1.3ec7572230f21p-19},
+        {465,-0x1.0c92763f5f68fp-17,-0x1.3176c24bdbe7p-18},
+        {466,-0x1.f7380a93e42eep-18,-0x1.cd3cb979ba6dcp-18},
+        {467,-0x1.a7dfb74804b2p-18,-0x1.33181c61421e6p-17},
+        {468,-0x1.2b0c2e6e8cc75p-18,-0x1.772c9408190aep-17},
+        {469,-0x1.0a67ea20ef24fp-19,-0x1.abd8a867eb034p-17},
+        {470,0x1.02d4c48c8f864p-20,-0x1.cad5b3cbad944p-17},
+        {471,0x1.19cf438a7366ep-18,-0x1.cf56cfb0acd44p-17},
+        {472,0x1.f65df378e5e6bp-18,-0x1.b6a7d24d6e46bp-17},
+        {473,0x1.629ea668036cp-17,-0x1.809898377c802p-17},
+        {474,0x1.bac94628737b4p-17,-0x1.2fa4e868e0ab4p-17},
+        {475,0x1.fc439a02027e8p-17,-0x1.91a2a24cd3f9cp-18},
+        {476,0x1.10b65e6bcac22p-16,-0x1.4cfada0a5b1fbp-19},
+        {477,0x1.13844e9befba8p-16,0x1.4402bd5d94124p-20},
+        {478,0x1.064cd11c2869ap-16,0x1.427ab15fde0f6p-18},
+        {479,0x1.d46e5157787e4p-17,0x1.0e15dbfde4a82p-17},
+        {480,0x1.836140ffe26dep-17,0x1.675296701363fp-17},
+        {481,0x1.205354e7691d4p-17,0x1.a723865a46f5ep-17},
+        {482,0x1.66e1b46e36528p-18,0x1.ca23b6536956ep-17},
+        {483,0x1.1561b63adb464p-19,0x1.cf968599f080cp-17},
+        {484,-0x1.0e118ea6a8e95p-20,0x1.b9596bbc59406p-17},
+        {485,-0x1.eb760b7f3e993p-19,0x1.8b8eaee79b5ep-17},
+        {486,-0x1.818b38865320ap-18,0x1.4c0e29aeb8616p-17},
+        {487,-0x1.e0e75e723fa24p-18,0x1.01afde019caafp-17},
+        {488,-0x1.092a1dfc08fcdp-17,0x1.670fb13d222bap-18},
+        {489,-0x1.0c4e66e314d28p-17,0x1.a0adaac4105b7p-19},
+        {490,-0x1.fa14b45d11534p-18,0x1.28a88b43ee456p-20},
+        {491,-0x1.bf8915cd7b9fap-18,-0x1.1c8f4522e2918p-21},
+        {492,-0x1.7307bb4aa1856p-18,-0x1.d1d40a7ecd271p-20},
+        {493,-0x1.1ea639afbf9f9p-18,-0x1.4f1b149d6ba66p-19},
+        {494,-0x1.96de733e7f1b8p-19,-0x1.7deca89117bf2p-19},
+        {495,-0x1.0126c2b8ddc0ap-19,-0x1.7e406df1d20e2p-19},
+        {496,-0x1.0bbe254f2a237p-20,-0x1.5bde793704e29p-19},
+        {497,-0x1.4ecb58a335ceep-22,-0x1.239b8f55dd43ep-19},
+        {498,0x1.29c6c7f037a74p-23,-0x1.c35580e56dddep-20},
+        {499,0x1.96b2c0685c4a4p-22,-0x1.4098705951413p-20},
+        {500,0x1.e4ca6bfc307b2p-22,-0x1.9be0040a30c4bp-21},
+        {501,0x1.b691cf581f9eap-22,-0x1.d07091e975e8ap-22},
+        {502,0x1.432fa9f7d4aacp-22,-0x1.b00c418eebe66p-23},
+        {503,0x1.7410983464126p-23,-0x1.1bd443ae722d2p-24},
+        {464,0x1.e262aa6efe696p-23,0x1.d79855488ccf3p-24},
+        {465,0x1.7313c6a26a29ap-22,0x1.27d731d735707p-22},
+        {466,0x1.d0fde9e11190ap-22,0x1.1fe5fe9ed7e4p-21},
+        {467,0x1.dc430af85ecaap-22,0x1.df827d28b55f2p-21},
+        {468,0x1.6155046c0c55ap-22,0x1.650a0a356868bp-20},
+        {469,0x1.7773497a7575ap-25,0x1.e611110621c7ep-20},
+        {470,-0x1.e15d221869562p-22,0x1.31d322eea12c3p-19},
+        {471,-0x1.38904f118f8fcp-20,0x1.64f740dcd7c96p-19},
+        {472,-0x1.195b48baad824p-19,0x1.810605c2af09dp-19},
+        {473,-0x1.ae2596460dee2p-19,0x1.7a479b8bb7dp-19},
+        {474,-0x1.288369108e42cp-18,0x1.463acb0da3e64p-19},
+        {475,-0x1.7a26b99121046p-18,0x1.ba611ec7125dp-20},
+        {476,-0x1.c38ecd80c9e6cp-18,0x1.de7496c52fec8p-22},
+        {477,-0x1.fb72b358387e4p-18,-0x1.377f0b3221c28p-20},
+        {478,-0x1.0c4fe6c2bfc48p-17,-0x1.a11b5787acb52p-19},
+        {479,-0x1.0984cb0648bc6p-17,-0x1.62d92a0104ffap-18},
+        {480,-0x1.e4d86e213fa72p-18,-0x1.fabda46554424p-18},
+        {481,-0x1.8b55412fff178p-18,-0x1.461bc11b101d8p-17},
+        {482,-0x1.079161b17ba2cp-18,-0x1.8527d82a90b04p-17},
+        {483,-0x1.7ac0b360237f6p-20,-0x1.b42e4e98316e7p-17},
+        {484,0x1.98f78e64ac93ep-20,-0x1.cdab1e064e352p-17},
+        {485,0x1.3ad2306e5cd66p-18,-0x1.cd8afb308499fp-17},
+        {486,0x1.082731384fe24p-17,-0x1.b1add4517bed8p-17},
+        {487,0x1.6b7531d97908p-17,-0x1.7a3b081fd8d2p-17},
+        {488,0x1.bfa793ec9d88dp-17,-0x1.29bb742e8085p-17},
+        {489,0x1.fe0a6131ebfaep-17,-0x1.89e831b027d87p-18},
+        {490,0x1.10c62655858a9p-16,-0x1.4a0e3c2ab582fp-19},
+        {491,0x1.13a10f7bac5a2p-16,0x1.2da077e5acbf9p-20},
+        {492,0x1.07598e546294ap-16,0x1.368dae76a6552p-18},
+        {493,0x1.d9e569e1fec48p-17,0x1.060801eaabc6fp-17},
+        {494,0x1.8d28f51a8a3b2p-17,0x1.5ecbdd431a6f8p-17},
+        {495,0x1.2ea72a09c7f41p-17,0x1.a00d62c52013p-17},
+        {496,0x1.8b892a40fb05p-18,0x1.c66591b9e1352p-17},
+        {497,0x1.699b50c436f22p-19,0x1.d0c862e5ebed8p-17},
+        {498,-0x1.797ea55719be5p-22,0x1.c08243463e2ccp-17},
+        {499,-0x1.987b0d8e680f6p-19,0x1.98f896428c2cap-17},
+        {500,-0x1.5ebb1522d01b1p-18,0x1.5f36ce1c77c8cp-17},
+        {501,-0x1.c86a245a9bd76p-18,0x1.19574dcce434ep-17},
+        {502,-0x1.035af453cf702p-17,0x1.9bb5a5837abacp-18},
+        {503,-0x1.0d7cdfdbd4dfap-17,0x1.06046a8f4b532p-18},
+        {504,-0x1.04fcff6a7da3cp-17,0x1.f1e6d7305e329p-20},
+        {505,-0x1.db0e1e7295fap-18,0x1.dd465e2ef6cf7p-24},
+        {506,-0x1.971b124a6e222p-18,-0x1.4eaf1e0355f34p-20},
+        {507,-0x1.477ff5801fd6ap-18,-0x1.255f74cb1b4p-19},
+        {508,-0x1.ea2bf4ed7847cp-19,-0x1.6c93c2388b06ap-19},
+        {509,-0x1.4ebe777b27a5bp-19,-0x1.832e3f45d6746p-19},
+        {510,-0x1.8fde7572531e4p-20,-0x1.72d1a875e5cdep-19},
+        {511,-0x1.7286017a4adaap-21,-0x1.46f0f6dd53026p-19},
+        {512,-0x1.ede7b3423c20ep-24,-0x1.0b3f92a367985p-19},
+        {513,0x1.066cb8f2db1abp-22,-0x1.94b428d296844p-20},
+        {514,0x1.c0b4cb96ed5d6p-22,-0x1.19946892b9964p-20},
+        {515,0x1.e19f3c29dcbbap-22,-0x1.61e0e47dcce52p-21},
+        {516,0x1.9cce5f4f7de3ap-22,-0x1.845a066577e86p-22},
+        {517,0x1.237a16b073cfbp-22,-0x1.5aa8aaf5db59ap-23},
+        {478,0x1.2280b536c0b5bp-22,0x1.58377c4627252p-23},
+        {479,0x1.9915f2079e69cp-22,0x1.7ad4a9ed87994p-22},
+        {480,0x1.dfb3a345bfa94p-22,0x1.560027ce5b945p-21},
+        {481,0x1.c9763dd8860a4p-22,0x1.0eec14cea303ep-20},
+        {482,0x1.26e99cd3cd9eep-22,0x1.85151c97f0524p-20},
+        {483,-0x1.9a89d7297629p-25,0x1.0198c3311b308p-19},
+        {484,-0x1.3275c4fc49876p-21,0x1.3d1a89367dec2p-19},
+        {485,-0x1.5e94561e21a9p-20,0x1.6b9680a4b3d28p-19},
+        {486,-0x1.2cc58ff4f3a6ap-19,0x1.826b668f7cb8bp-19},
+        {487,-0x1.bfa38c6fc9108p-19,0x1.76ec160639035p-19},
+        {488,-0x1.2f4943d676a6fp-18,0x1.3fb24c0fbe086p-19},
+        {489,-0x1.7e582429c03bap-18,0x1.ac0676608ea51p-20},
+        {490,-0x1.c52f2a21cf63cp-18,0x1.b8cef6275f2cep-22},
+        {491,-0x1.fb45f2bb119ap-18,-0x1.35ad8cccd2eefp-20},
+        {492,-0x1.0c16c01ec45c6p-17,-0x1.9813086171f99p-19},
+        {493,-0x1.0a3dea3132114p-17,-0x1.59ab666941efcp-18},
+        {494,-0x1.eab6e1cb972d2p-18,-0x1.ed3b45fd2d622p-18},
+        {495,-0x1.9822d66794477p-18,-0x1.3de7949bbd34cp-17},
+        {496,-0x1.1d58eae016bbep-18,-0x1.7cc60e9e3b936p-17},
+        {497,-0x1.fa4241dcbd834p-20,-0x1.ad5c6286c3189p-17},
+        {498,0x1.e39b083296e38p-21,-0x1.ca71d42a6813p-17},
+        {499,0x1.08d7d06f511cfp-18,-0x1.cffec672f8188p-17},
+        {500,0x1.d97610447aba8p-18,-0x1.bba3dc99da9d4p-17},
+        {501,0x1.4ff83b90fa59ep-17,-0x1.8cfcbfc7d5ae6p-17},
+        {502,0x1.a6fa1388747fep-17,-0x1.45c3cbc7ea604p-17},
+        {503,0x1.eb43874ddd228p-17,-0x1.d381cd6c111a8p-18},
+        {504,0x1.0bcfaef98e5a8p-16,-0x1.fa0e8465593ep-19},
+        {505,0x1.144f94edc80c6p-16,-0x1.5dd6f9a86dbc4p-22},
+        {506,0x1.0e77f0ac02eeap-16,0x1.a57e39c499729p-19},
+        {507,0x1.f57ab3471cf46p-17,0x1.ad712bccf6f0cp-18},
+        {508,0x1.b54e6fe5c6e54p-17,0x1.360a5835659e6p-17},
+        {509,0x1.615409fb939b5p-17,0x1.817bf3e0bc844p-17},
+        {510,0x1.ffad23160e978p-18,0x1.b4e9bb7da335p-17},
+        {511,0x1.2fd7bf8d01df2p-18,0x1.ce3469c537ec3p-17},
+        {512,0x1.86733a4d723abp-20,0x1.cd5c4f201e841p-17},
+        {513,-0x1.76311e140d9d4p-20,0x1.b4673a766d094p-17},
+        {514,-0x1.0248df2257471p-18,0x1.8715cd60f73bcp-17},
+        {515,-0x1.8436d35357f3ap-18,0x1.4a72220a9cf28p-17},
+        {516,-0x1.de712ecd65556p-18,0x1.0445896f072e6p-17},
+        {517,-0x1.07da79c8d8878p-17,0x1.750a8a334eap-18},
+        {518,-0x1.0d14223292d22p-17,0x1.cb191b30feabp-19},
+        {519,-0x1.0168496aed835p-17,0x1.8e3215e42962p-20},
+        {520,-0x1.d0ccbc2dc2184p-18,-0x1.3abd0d558559p-23},
+        {521,-0x1.8c6d4ca87cc71p-18,-0x1.78d9ed4758dc5p-20},
+        {522,-0x1.3e46f4a8d7aebp-18,-0x1.2ff635fda43b2p-19},
+        {523,-0x1.dcb324e2003a1p-19,-0x1.703017f864befp-19},
+        {524,-0x1.46c2f58e2ec04p-19,-0x1.832fe452bf2cep-19},
+        {525,-0x1.8986c7a261458p-20,-0x1.71f75050dbc76p-19},
+        {526,-0x1.736cc53fbe13ep-21,-0x1.471156e72e712p-19},
+        {527,-0x1.160a5773027f7p-23,-0x1.0d390e3ffbb62p-19},
+        {528,0x1.eae2764725249p-23,-0x1.9c62354dbb7d5p-20},
+        {529,0x1.b731f2c7a40a2p-22,-0x1.23cfd2f8cba37p-20},
+        {530,0x1.e4059680a703p-22,-0x1.77dfa0d881fbdp-21},
+        {531,0x1.ab28a4ff225bp-22,-0x1.ac2b35d5c1222p-22},
+        {532,0x1.3a68ae8da621ep-22,-0x1.96f9e9ce365cep-23},
+        {533,0x1.719667033c6cfp-23,-0x1.181ef0e1f4644p-24},
+        {492,0x1.22922c83c622p-22,0x1.585b79015a6eep-23},
+        {493,0x1.9639a7e2a2421p-22,0x1.73b4c373a3748p-22},
+        {494,0x1.ddbecf249176dp-22,0x1.4c0dedf62c3bp-21},
+        {495,0x1.d026ae0e4d4a8p-22,0x1.059b2e6c9aef9p-20},
+        {496,0x1.41ddf3308b80ep-22,0x1.7707d5e4af861p-20},
+        {497,0x1.4cc2391773c02p-27,0x1.f151338d4330bp-20},
+        {498,-0x1.f52175d69211ep-22,0x1.3398654d18f0ap-19},
+        {499,-0x1.32d6333f4acdp-20,0x1.63df65424e607p-19},
+        {500,-0x1.0e1911858feep-19,0x1.7fdcf3066d37ap-19},
+        {501,-0x1.9877d6922f666p-19,0x1.7dae2e77ad3fp-19},
+        {502,-0x1.186ae9e99fdbfp-18,0x1.544bda1290e99p-19},
+        {503,-0x1.661a93adab0dcp-18,0x1.f97e0c645427cp-20},
+        {504,-0x1.ae72f7442bcc6p-18,0x1.cd2613f9876b3p-21},
+        {505,-0x1.e9c3ba0a787d3p-18,-0x1.1e8dd1371198fp-21},
+        {506,-0x1.0817a4da39f36p-17,-0x1.2ec615b8e3b18p-19},
+        {507,-0x1.0d38d736e8e95p-17,-0x1.1bee80bfdd56p-18},
+        {508,-0x1.01579b6e82768p-17,-0x1.a9fe42f8ae6ecp-18},
+        {509,-0x1.c5347992c02eep-18,-0x1.1c1af6b4f1e0ap-17},
+        {510,-0x1.6110f5dad0249p-18,-0x1.5dffa69c4d842p-17},
+        {511,-0x1.b0f0520d5ac6cp-19,-0x1.9533d81233a66p-17},
+        {512,-0x1.86d0709e623a6p-21,-0x1.bc8cd9a39a406p-17},
+        {513,0x1.1aa99312e067ep-19,-0x1.cfad793c6026dp-17},
+        {514,0x1.5722cb7c60292p-18,-0x1.cb7989c04df44p-17},
+        {515,0x1.0ff787e0f756ap-17,-0x1.ae7160ceee1bbp-17},
+        {516,0x1.6d35ac31be846p-17,-0x1.78eaa22d5ad1p-17},
+        {517,0x1.bcdd1ab162f04p-17,-0x1.2d1f074fb3ba4p-17},
+        {518,0x1.f9469c4129e21p-17,-0x1.9e1c398c5be1cp-18},
+        {519,0x1.0f0994e31bc46p-16,-0x1.90cec4fd53e0ap-19},
+        {520,0x1.144879fdc6206p-16,0x1.9cd4503d6e4e9p-22},
+        {521,0x1.0bfd1f92da216p-16,0x1.f4c9aa8bf13ep-19},
+        {522,0x1.ed877b0e844fdp-17,0x1.cb64c62e87d64p-18},
+        {523,0x1.ac52afeccb812p-17,0x1.400ecfb2a25dep-17},
+        {524,0x1.590f4191b1878p-17,0x1.871982e51f0bdp-17},
+        {525,0x1.f33b339bb546bp-18,0x1.b734c2f247955p-17},
+        {526,0x1.290bf5ed1d21ap-18,0x1.ce9372610b715p-17},
+        {527,0x1.834107a8e04e4p-20,0x1.cd4d19aeda43ap-17},
+        {528,-0x1.648e7e0d944aap-20,0x1.b5452da629565p-17},
+        {529,-0x1.f4bd4ccd1a61cp-19,0x1.89e9a0c4ee5f2p-17},
+        {530,-0x1.7b121ffaf9f44p-18,0x1.4fd0ec6d639acp-17},
+        {531,-0x1.d687bf10e2aedp-18,0x1.0c42d29e3e3c3p-17},
+        {532,-0x1.05a3860942446p-17,0x1.8971a039ab671p-18},
+        {533,-0x1.0d75be2af45ap-17,0x1.f98dac8d45a4fp-19},
+        {534,-0x1.04da652bc513ep-17,0x1.ee022b4d89d08p-20},
+        {535,-0x1.dde1f71270e8p-18,0x1.92941fdfdeb7cp-23},
+        {536,-0x1.9eebef9e144f8p-18,-0x1.2daf5d58a6d5p-20},
+        {537,-0x1.54b6bee1bd5c4p-18,-0x1.14dfacb1be238p-19},
+        {538,-0x1.06cf669b2da16p-18,-0x1.6181defeb64f6p-19},
+        {539,-0x1.779270c8964b8p-19,-0x1.814f3bb0d359p-19},
+        {540,-0x1.e3216e39460f6p-20,-0x1.7bd159f66eb88p-19},
+        {541,-0x1.050360de8ecacp-20,-0x1.5a5bf447ed8bp-19},
+        {542,-0x1.6eadc2fb43dfap-22,-0x1.26da839904a94p-19},
+        {543,0x1.864c150f164fdp-24,-0x1.d577a0a7ce5a6p-20},
+        {544,0x1.6f9148853799ap-22,-0x1.5c2c33a1b94cep-20},
+        {545,0x1.dcf27e7395466p-22,-0x1.dc52f818f363bp-21},
+        {546,0x1.d37550411d61bp-22,-0x1.26d6209d08b4cp-21},
+        {547,0x1.7e8abc35e2849p-22,-0x1.3e8b8f236424cp-22},
+        {548,0x1.05f0adf82a2c4p-22,-0x1.163f7d82246b3p-23},
+        {506,0x1.ecbe41d53ff5ap-23,0x1.ebdf85bdee504p-24},
+        {507,0x1.6dbb73b665878p-22,0x1.1dbd3a05fbf3p-22},
+        {508,0x1.c88df18cc5a1cp-22,0x1.0b0ad760a4091p-21},
+        {509,0x1.e34efd52fc365p-22,0x1.b3106a9d46017p-21},
+        {510,0x1.966c7609ff427p-22,0x1.40cbf66cb3a12p-20},
+        {511,0x1.757ad9b86e767p-23,0x1.b4e3fdb030e67p-20},
+        {512,-0x1.a22c626ecbc8cp-23,0x1.15bc5ae788574p-19},
+        {513,-0x1.9163dce24c408p-21,0x1.4b4c797e59a7ep-19},
+        {514,-0x1.8fbb89e3b0536p-20,0x1.72c8a22aa40bep-19},
+        {515,-0x1.4290986f1ab62p-19,0x1.8322117dafcb2p-19},
+        {516,-0x1.cf4689e280d24p-19,0x1.737654ea578aep-19},
+        {517,-0x1.32df68960181cp-18,0x1.3c129e11b8e5cp-19},
+        {518,-0x1.7d774be2e8cc3p-18,0x1.aefe59ab63b94p-20},
+        {519,-0x1.c0d391aea4046p-18,0x1.0dd39a939c0cbp-21},
+        {520,-0x1.f5c77697e2468p-18,-0x1.f986430a54e14p-21},
+        {521,-0x1.0a96f0de8109ep-17,-0x1.67f7060420917p-19},
+        {522,-0x1.0c4cb447a0d1ep-17,-0x1.37683f3ff7358p-18},
+        {523,-0x1.fb064a474d27p-18,-0x1.c235b3ae4dfddp-18},
+        {524,-0x1.b97bb477cb5eep-18,-0x1.25c554eed81aap-17},
+        {525,-0x1.5389f6c1153p-18,-0x1.64ca3bcd15d3dp-17},
+        {526,-0x1.972b7ba67f446p-19,-0x1.9925f54de03bfp-17},
+        {527,-0x1.37269a16aff9fp-21,-0x1.be27c1f368a6ap-17},
+        {528,0x1.253260c50d084p-19,-0x1.cfdf4314a4901p-17},
+        {529,0x1.56c4f5c9225e3p-18,-0x1.cb7f8c6f1caccp-17},
+        {530,0x1.0d01f06055098p-17,-0x1.afad6ab2c671p-17},
+        {531,0x1.681015692ac58p-17,-0x1.7cb039e692cb4p-17},
+        {532,0x1.b6a060d3e8104p-17,-0x1.347f56d4a3361p-17},
+        {533,0x1.f370f914692b5p-17,-0x1.b55342f0bec3fp-18},
+        {534,0x1.0d2dcbae93bbep-16,-0x1.d0613ae299668p-19},
+        {535,0x1.1458019b71ccep-16,-0x1.ac80f2a8d1bp-23},
+        {536,0x1.0eb7a13ffe266p-16,0x1.9c66131492c3p-19},
+        {537,0x1.f961a1b2fa0fbp-17,0x1.9da5368cd3d69p-18},
+        {538,0x1.bf0563f84fbc2p-17,0x1.2a7b7949aece5p-17},
+        {539,0x1.7257d3835c00ep-17,0x1.7506c33cf42e8p-17},
+        {540,0x1.187e237ee22a5p-17,0x1.aab7c29ff1f5cp-17},
+        {541,0x1.6ead6ae5053aep-18,0x1.c963c03dde726p-17},
+        {542,0x1.53f619eb0abe6p-19,0x1.d08f16692c12ap-17},
+        {543,-0x1.160dad1134772p-22,0x1.c16446794798ap-17},
+        {544,-0x1.721ce918b3998p-19,0x1.9e87295f87fe4p-17},
+        {545,-0x1.44d2b06f34d44p-18,0x1.6bc9ce91fe2dp-17},
+        {546,-0x1.af10fc76a54p-18,0x1.2dcb67a95b84ep-17},
+        {547,-0x1.f50adb881d9eap-18,0x1.d316e20e48786p-18},
+        {548,-0x1.0b6d9b501f8ecp-17,0x1.47f7ec2bb80fap-18},
+        {549,-0x1.0b99178b29942p-17,0x1.86754860ee742p-19},
+        {550,-0x1.fadc4ee09e0c7p-18,0x1.3161fa7abc6a2p-20},
+        {551,-0x1.c8248f8f5af1ep-18,-0x1.72ec40dc160bdp-22},
+        {552,-0x1.862362cc6155ap-18,-0x1.903cae724ea0dp-20},
+        {553,-0x1.3c0d7d4f661afp-18,-0x1.326326f553daap-19},
+        {554,-0x1.e1275b98682c8p-19,-0x1.6f01d61fd2d98p-19},
+        {555,-0x1.52c39dbcb8455p-19,-0x1.831ba73c69f21p-19},
+        {556,-0x1.ab198055501c6p-20,-0x1.762c6730ec85p-19},
+        {557,-0x1.bc390690cd7b1p-21,-0x1.510003a08ae9p-19},
+        {558,-0x1.0e1cc511196afp-22,-0x1.1cacc16d7b9c1p-19},
+        {559,0x1.2992805c8174ap-23,-0x1.c359301a433dp-20},
+        {560,0x1.842e4fabaa0bfp-22,-0x1.4e53c9bb65c4ep-20},
+        {561,0x1.e051ea6242bccp-22,-0x1.ca2ea33b5dc8p-21},
+        {562,0x1.cff5fb312359p-22,-0x1.1d13a9a1032a3p-21},
+        {563,0x1.7ae26fa3bc9d2p-22,-0x1.3715d91ba6d08p-22},
+        {564,0x1.054df89e96dabp-22,-0x1.14db00ad2bad7p-23},
+        {521,0x1.f787e072151a2p-23,0x1.00d23695ffa94p-23},
+        {522,0x1.6f6078e37346ep-22,0x1.20c6a4f91208cp-22},
+        {523,0x1.c7a5a58816f71p-22,0x1.0901b584168b6p-21},
+        {524,0x1.e3ffe97ebdce2p-22,0x1.ab0afac86027ep-21},
+        {525,0x1.a033f525f6d5p-22,0x1.38e581d4087edp-20},
+        {526,0x1.b062d1e873eacp-23,0x1.a8f28c78703dcp-20},
+        {527,-0x1.2691a35f1e093p-23,0x1.0e3ff70b35cf2p-19},
+        {528,-0x1.5bd4253af726cp-21,0x1.438f8ccdf1beap-19},
+        {529,-0x1.66ec4c60db1d6p-20,0x1.6ce63be8ccd08p-19},
+        {530,-0x1.266e67e9aa482p-19,0x1.8204fee60aba4p-19},
+        {531,-0x1.abb44266392bp-19,0x1.7aaba7a8a2ccep-19},
+        {532,-0x1.1e2d31e3ede92p-18,0x1.4f750801533b8p-19},
+        {533,-0x1.676fa9182d79p-18,0x1.f57dfcc3a447p-20},
+        {534,-0x1.abd4978245e12p-18,0x1.e61a026ededc6p-21},
+        {535,-0x1.e4e4e7e5bec6fp-18,-0x1.9f0c4880b8874p-22},
+        {536,-0x1.05ffbe2fb8396p-17,-0x1.095649494aeb8p-19},
+        {537,-0x1.0d76b1a593f95p-17,-0x1.febb479619e1ep-19},
+        {538,-0x1.063e8b53c9c68p-17,-0x1.8416c4869ff2ap-18},
+        {539,-0x1.dd15d89e8f6cep-18,-0x1.05a5d72ce21bcp-17},
+        {540,-0x1.8b33dddb2835ep-18,-0x1.4627b7496b0f5p-17},
+        {541,-0x1.17bf351de251ap-18,-0x1.7ef7d8127da04p-17},
+        {542,-0x1.0c645f11650fp-19,-0x1.ab955391aff3cp-17},
+        {543,0x1.1bbe1eb256976p-21,-0x1.c7f74c12bd0d4p-17},
+        {544,0x1.ba19617efb0dp-19,-0x1.d0e8c29f943e2p-17},
+        {545,0x1.9ca4796aea093p-18,-0x1.c457b3090fcf4p-17},
+        {546,0x1.2ba6e6ebfc878p-17,-0x1.a18f7e5ae2cd6p-17},
+        {547,0x1.80ecedc019763p-17,-0x1.69585c6e29ad6p-17},
+        {548,0x1.c8daab9d3f604p-17,-0x1.1df7efe9aefcap-17},
+        {549,0x1.feddd8541a68cp-17,-0x1.8623e37ce5decp-18},
+        {550,0x1.0fbc53fb0c538p-16,-0x1.75abc01736deep-19},
+        {551,0x1.1444eedfd7c6ap-16,0x1.adc00a5248d9cp-22},
+        {552,0x1.0cbc8fd23d828p-16,0x1.de1d350ccec28p-19},
+        {553,0x1.f34364b8f72acp-17,0x1.b5fb38aaf05a3p-18},
+        {554,0x1.b86653d9fd632p-17,0x1.326b3e8e7d35ep-17},
+        {555,0x1.6cac81f32aa53p-17,0x1.794c97a375606p-17},
+        {556,0x1.14df661869edp-17,0x1.ac50c3c4ef19ep-17},
+        {557,0x1.6ccc81d97fc02p-18,0x1.c98fb830fc309p-17},
+        {558,0x1.5b6b790927adp-19,0x1.d0a1b03267fb8p-17},
+        {559,-0x1.18897a052d8d2p-23,0x1.c296ac1924984p-17},
+        {560,-0x1.5a308c38b3da8p-19,0x1.a1cfcaba71234p-17},
+        {561,-0x1.3797bce1f4229p-18,0x1.71bf088372618p-17},
+        {562,-0x1.a2e2aa54e316p-18,0x1.369429f91a6bp-17},
+        {563,-0x1.ec23d6657d701p-18,0x1.e9be2758bb13p-18},
+        {564,-0x1.0989db0771c9p-17,0x1.6260dc3cbc8cap-18},
+        {565,-0x1.0ce28686df1f1p-17,0x1.bf04a2e2af92cp-19},
+        {566,-0x1.0221c35fcfdd4p-17,0x1.a1426795fd14ep-20},
+        {567,-0x1.d8105b2736a99p-18,0x1.24c195206acccp-25},
+        {568,-0x1.9b8b8786ca96bp-18,-0x1.3c0d4abe3c93p-20},
+        {569,-0x1.5558f7e39adc1p-18,-0x1.14041f2a77b08p-19},
+        {570,-0x1.0bd03857854d4p-18,-0x1.5df6075b3a0aap-19},
+        {571,-0x1.89061f462a894p-19,-0x1.7f9a16563b654p-19},
+        {572,-0x1.07c8262caa05bp-19,-0x1.7f18a3678622ep-19},
+        {573,-0x1.344911520b4e7p-20,-0x1.64233f17955dep-19},
+        {574,-0x1.0e54b0ed8dcap-21,-0x1.370d7d104c51bp-19},
+        {575,-0x1.3e2354a384dd9p-25,-0x1.ffee382222d6ep-20},
+        {576,0x1.18642f4995d16p-22,-0x1.8c3505a7a39bp-20},
+        {577,0x1.bc2ae62b9d83ap-22,-0x1.1e995a3521aep-20},
+        {578,0x1.e47b4d05e5342p-22,-0x1.7ed3b961cf56ep-21},
+        {579,0x1.b5d95752b9a4ap-22,-0x1.cde19bce5846ep-22},
+        {580,0x1.53e816ec72d52p-22,-0x1.e2d6f828f7b44p-23},
+        {581,0x1.bbb1a608d60acp-23,-0x1.8f87b12a30e6cp-24},
+        {536,0x1.eba2702287ecep-23,0x1.e98ebf9a55e7cp-24},
+        {537,0x1.66fc9be1b012p-22,0x1.117b33c967498p-22},
+        {538,0x1.c087500d10484p-22,0x1.f479e78365704p-22},
+        {539,0x1.e4f87c3bc46f5p-22,0x1.93044d2a745bp-21},
+        {540,0x1.b343678e5e024p-22,0x1.27b97bb1d5afbp-20},
+        {541,0x1.09fdef196f0dep-22,0x1.93062016a8beep-20},
+        {542,-0x1.a56a86860ae5ep-25,0x1.01c5972962038p-19},
+        {543,-0x1.0f5516785773ep-21,0x1.37387871ad7fap-19},
+        {544,-0x1.2f6d35d49adcfp-20,0x1.6333528099bb5p-19},
+        {545,-0x1.017433293dde2p-19,0x1.7e412d71f4aaep-19},
+        {546,-0x1.7df638e0f72e4p-19,0x1.80ba23688e04ap-19},
+        {547,-0x1.03d670cd225d6p-18,0x1.637c10acc941ep-19},
+        {548,-0x1.4b52994de159cp-18,0x1.20b2e740eea9bp-19},
+        {549,-0x1.906ec92d37586p-18,0x1.693b9cc3daffep-20},
+        {550,-0x1.cd6cb17c9103ep-18,0x1.e3c8216b32e0ep-23},
+        {551,-0x1.fc36189cfc714p-18,-0x1.405e728efcbe4p-20},
+        {552,-0x1.0b6ba2aeb61a6p-17,-0x1.80dda9496615dp-19},
+        {553,-0x1.0c0241f335362p-17,-0x1.3d43d48e505cbp-18},
+        {554,-0x1.fb9f156b822e4p-18,-0x1.c05f225e0b3c2p-18},
+        {555,-0x1.bf2cf7d24e3dp-18,-0x1.21249d9f312f5p-17},
+        {556,-0x1.62374934b99c9p-18,-0x1.5d610ae9b109cp-17},
+        {557,-0x1.cd094ab8079dp-19,-0x1.90aa0add49dbep-17},
+        {558,-0x1.409e7e402a0aap-20,-0x1.b6fb89a188772p-17},
+        {559,0x1.6a8b450de21c6p-20,-0x1.ccdaf2c25808p-17},
+        {560,0x1.11c4d19cecfbcp-18,-0x1.cfa3f1b052c8ap-17},
+        {561,0x1.cbcc6e0ddc0bdp-18,-0x1.bdc81c2f611aap-17},
+        {562,0x1.3f4570725421bp-17,-0x1.96fb5bd282b9p-17},
+        {563,0x1.8fe4fc55b0db4p-17,-0x1.5c4873840b50ep-17},
+        {564,0x1.d3046b7c21466p-17,-0x1.100b04b5d0f41p-17},
+        {565,0x1.024c09e3f6972p-16,-0x1.6b9d9958aeed2p-18},
+        {566,0x1.10cb952f283efp-16,-0x1.4858ef2cbe8cp-19},
+        {567,0x1.141b870319f3fp-16,0x1.5f335f184a36p-21},
+        {568,0x1.0c07452a0727ap-16,0x1.f352d26357305p-19},
+        {569,0x1.f21df4df10b31p-17,0x1.ba5457747d488p-18},
+        {570,0x1.b8bb6c40115b2p-17,0x1.3204a775c3445p-17},
+        {571,0x1.6f64f91ee5178p-17,0x1.7740fa4b46e0ep-17},
+        {572,0x1.1a7c9e51dc6b6p-17,0x1.a9cd8f3c10d36p-17},
+        {573,0x1.7de899b9c7978p-18,0x1.c7d9dfc9d9dafp-17},
+        {574,0x1.87c41336a52ccp-19,0x1.d0ec148687a7p-17},
+        {575,0x1.0da1a785e2fc8p-22,0x1.c5dbb068004cfp-17},
+        {576,-0x1.247bc2e57d314p-19,0x1.a8b28f3b6579dp-17},
+        {577,-0x1.1e09ef1c2ad43p-18,0x1.7c77ba28a531ap-17},
+        {578,-0x1.8d2edc8652ca3p-18,0x1.44e96bc2e2957p-17},
+        {579,-0x1.dc8fea680ba89p-18,0x1.062ce482cb5a6p-17},
+        {580,-0x1.05adf84266261p-17,0x1.88f69a6da8d4p-18},
+        {581,-0x1.0d75da6dd18p-17,0x1.07a59b0c82d98p-18},
+        {582,-0x1.073ba30be30cep-17,0x1.1ec8e90e4a762p-19},
+        {583,-0x1.eaab81cee57a2p-18,0x1.2e46c39ee4d88p-21},
+        {584,-0x1.b52b3b6654828p-18,-0x1.8a16b9eeadb72p-21},
+        {585,-0x1.74088bd50d506p-18,-0x1.ce6887eebab69p-20},
+        {586,-0x1.2d42a1f785a92p-18,-0x1.41a2fc678780cp-19},
+        {587,-0x1.cca61b97c435dp-19,-0x1.740cf5fadf432p-19},
+        {588,-0x1.47a657613c5e8p-19,-0x1.83293f998b124p-19},
+        {589,-0x1.a4fd4e51fe719p-20,-0x1.7570f6c7812a2p-19},
+        {590,-0x1.c6d0e42921c9fp-21,-0x1.52565c79d8c41p-19},
+        {591,-0x1.3aebc15b5a21ap-22,-0x1.2180f2698c9cp-19},
+        {592,0x1.9457d774d3df4p-24,-0x1.d4406a2ae27dcp-20},
+        {593,0x1.61bdc7d7c7678p-22,-0x1.64c4f6d3f6574p-20},
+        {594,0x1.d4d3bcd926cep-22,-0x1.fc61e0032039dp-21},
+        {595,0x1.de323d8c3d62fp-22,-0x1.4e219c8d911bep-21},
+        {596,0x1.9f8e1b6bfae2ep-22,-0x1.8b75ebeaa6d88p-22},
+        {597,0x1.38ca21901dc3ep-22,-0x1.925b8b4198c1dp-23},
+        {598,0x1.8a455c1d88fa2p-23,-0x1.3d3de8ab0027dp-24},
+        {552,0x1.f815a02c8d924p-23,0x1.015566495d59fp-23},
+        {553,0x1.69916f03ae0fcp-22,0x1.161438e9e6df9p-22},
+        {554,0x1.c038f236791a2p-22,0x1.f340fc47da8f4p-22},
+        {555,0x1.e4f560132f52ep-22,0x1.8d483f25d2ce2p-21},
+        {556,0x1.b9873f3ab8e7cp-22,0x1.2164806610dc6p-20},
+        {557,0x1.1f3ebc905eaeap-22,0x1.88dc437064edp-20},
+        {558,-0x1.685435dac93e5p-28,0x1.f610174c8bf5p-20},
+        {559,-0x1.ca2802d19043dp-22,0x1.2fab9bfbe5ffep-19},
+        {560,-0x1.0e3f761a42478p-20,0x1.5c615c11b302ap-19},
+        {561,-0x1.d3c57eacdbcdcp-20,0x1.7a6a271faa2e6p-19},
+        {562,-0x1.5f263df797f16p-19,0x1.82be93e066412p-19},
+        {563,-0x1.e252d93479c3ep-19,0x1.6eaa5b7b562e8p-19},
+        {564,-0x1.3653e262d67bep-18,0x1.3877dd1a211ccp-19},
+        {565,-0x1.7abaeb71f2f0ap-18,0x1.b839c6ae8e896p-20},
+        {566,-0x1.b948202d82c75p-18,0x1.5f606ceebcebcp-21},
+        {567,-0x1.ec77306709bc5p-18,-0x1.4d45f0b08d756p-21},
+        {568,-0x1.075d3bbe48147p-17,-0x1.21465c287015cp-19},
+        {569,-0x1.0d75ff7dbec9cp-17,-0x1.0562c070823f3p-18},
+        {570,-0x1.0660f343f778cp-17,-0x1.82cb0f5643cap-18},
+        {571,-0x1.e13c1b82184fep-18,-0x1.013ef0611aa41p-17},
+        {572,-0x1.970126eabbfe6p-18,-0x1.3e9a972d41841p-17},
+        {573,-0x1.2ea0ad55d8516p-18,-0x1.759be81201f4ep-17},
+        {574,-0x1.556807434715fp-19,-0x1.a27057bfeeb2p-17},
+        {575,-0x1.fafa638a994c6p-23,-0x1.c1971fa802817p-17},
+        {576,0x1.37060c76f067ap-19,-0x1.d02753bf241b2p-17},
+        {577,0x1.4f6da93a6826cp-18,-0x1.cc0e638eb253ap-17},
+        {578,0x1.0179a58c336a3p-17,-0x1.b4417d27aee1p-17},
+        {579,0x1.565568bf0ae12p-17,-0x1.88dd3340fedccp-17},
+        {580,0x1.a1ab8b95d2594p-17,-0x1.4b302620026e5p-17},
+        {581,0x1.df44b0f7fa4c6p-17,-0x1.fb5e45fc63a6p-18},
+        {582,0x1.05ce43982d0a6p-16,-0x1.47a620ed4db7p-18},
+        {583,0x1.1211062d79d24p-16,-0x1.078b8f640db28p-19},
+        {584,0x1.13b37a871953p-16,0x1.1a9351c04c59ep-20},
+        {585,0x1.0a9d22377e7cfp-16,0x1.0d8d1ae73bc63p-18},
+        {586,0x1.eeabdce663cf8p-17,0x1.c721dc01d4958p-18},
+        {587,0x1.b5f8bd13582dcp-17,0x1.35395b016ba62p-17},
+        {588,0x1.6e61900165424p-17,0x1.7801ee4dac9b2p-17},
+        {589,0x1.1bef0423dc00ep-17,0x1.a9226e9387405p-17},
+        {590,0x1.8651afd25ca64p-18,0x1.c6f0c23c1c963p-17},
+        {591,0x1.a3164b043a9ebp-19,0x1.d0f3aa8a8899fp-17},
+        {592,0x1.1595f4cfb5c95p-21,0x1.c7dedb7311a34p-17},
+        {593,-0x1.f7acd20e6e29ap-20,0x1.ad796d12a6042p-17},
+        {594,-0x1.095f3e262c1cp-18,0x1.84716a600918p-17},
+        {595,-0x1.7a77f05cb698ep-18,0x1.5020bca7ca48ep-17},
+        {596,-0x1.cdfd34e83e4a3p-18,0x1.1448c3a38ca23p-17},
+        {597,-0x1.01617dd7a4a5cp-17,0x1.a994f142e7617p-18},
+        {598,-0x1.0cca07a3f3c77p-17,0x1.2ac1feb2f4128p-18},
+        {599,-0x1.0a7c9517bea82p-17,0x1.659015a154a62p-19},
+        {600,-0x1.f8e334aa3960ap-18,0x1.1cb2da890edbap-20},
+        {601,-0x1.ca419e1433017p-18,-0x1.3f8395b5f0435p-22},
+        {602,-0x1.8e8ee4f1e3d23p-18,-0x1.707c8abca2879p-20},
+        {603,-0x1.4b5d87f4a959dp-18,-0x1.20a1bfc91c97ap-19},
+        {604,-0x1.05eed11e2ea19p-18,-0x1.62103c1801532p-19},
+        {605,-0x1.85b6a7af26518p-19,-0x1.7ff21d4704979p-19},
+        {606,-0x1.0ba584fa634a4p-19,-0x1.7f8d530650d64p-19},
+        {607,-0x1.45d8bdd6be3aep-20,-0x1.675b6e339781ap-19},
+        {608,-0x1.3a69366f7adc4p-21,-0x1.3e5c0edcf0ccap-19},
+        {609,-0x1.f4e4c117593eap-24,-0x1.0b73317d56f5p-19},
+        {610,0x1.ac76611b002e4p-23,-0x1.a9c07fb73fd4ep-20},
+        {611,0x1.97d47b5d38d48p-22,-0x1.3fae4eef47e2p-20},
+        {612,0x1.e1b028096357p-22,-0x1.c10211ea057d8p-21},
+        {613,0x1.d1fa7e924ba9ep-22,-0x1.2286915013c46p-21},
+        {614,0x1.876832caf91c7p-22,-0x1.514980d9cd06ep-22},
+        {615,0x1.1e3ca6f87578cp-22,-0x1.4da143b9a1794p-23},
+        {616,0x1.5c269531ddaeep-23,-0x1.f2ff80087afc9p-25},
+        {568,0x1.f65bc39f0fef6p-23,0x1.ff136f09804c8p-24},
+        {569,0x1.65e2f2d04dc1p-22,0x1.0f7ea13178558p-22},
+        {570,0x1.bbdb102f7cdeep-22,0x1.e2ce7fcb61098p-22},
+        {571,0x1.e4745959a468ap-22,0x1.7e207998ead88p-21},
+        {572,0x1.c40dbc85d17abp-22,0x1.15a85f4466d7ep-20},
+        {573,0x1.3e5f6cbb83f85p-22,0x1.78e3e7ab91c7ap-20},
+        {574,0x1.caf6d38a23856p-25,0x1.e2b284263fe93p-20},
+        {575,-0x1.5f8a60b57c1a2p-22,0x1.254c26cde5e74p-19},
+        {576,-0x1.cc1ec8d1f6ed2p-21,0x1.52fdf77be296p-19},
+        {577,-0x1.9c3bd59c80c3p-20,0x1.745c1d8fc1a24p-19},
+        {578,-0x1.3b79f3670963cp-19,0x1.82f635deb7a8ap-19},
+        {579,-0x1.b774345626e06p-19,0x1.787fb2c94d9c6p-19},
+        {580,-0x1.1e38618f0a285p-18,0x1.4f62002334b29p-19},
+        {581,-0x1.61822b4c7692bp-18,0x1.035390c8f9b98p-19},
+        {582,-0x1.a1236153437bep-18,0x1.23cd1d4cb9f7ep-20},
+        {583,-0x1.d8285b86e564ep-18,-0x1.3fa9046aafea3p-25},
+        {584,-0x1.00b790b44f101p-17,-0x1.7d985a0382c5ap-20},
+        {585,-0x1.0c02ea8d06e2cp-17,-0x1.9621c170fcb27p-19},
+        {586,-0x1.0bc7b64b66a77p-17,-0x1.416edf6d7200ep-18},
+        {587,-0x1.fca6c0e592312p-18,-0x1.bd32f5821a4a2p-18},
+        {588,-0x1.c53786554903ap-18,-0x1.1c0a28a578125p-17},
+        {589,-0x1.70c5095987c9ep-18,-0x1.55940edd0b4e7p-17},
+        {590,-0x1.009794afbabd4p-18,-0x1.87a7686e892fp-17},
+        {591,-0x1.df2c80ccab932p-20,-0x1.aed6cbf863524p-17},
+        {592,0x1.261e631c63841p-21,-0x1.c81577029ac81p-17},
+        {593,0x1.9d5ad48dc2764p-19,-0x1.d0f2578e2bec4p-17},
+        {594,0x1.7e53cb22a6755p-18,-0x1.c7cb07a687f84p-17},
+        {595,0x1.15a947e4fa5bep-17,-0x1.abf264b429fd9p-17},
+        {596,0x1.6680da4e4578ep-17,-0x1.7dc7465f0f7cfp-17},
+        {597,0x1.ad810d7444681p-17,-0x1.3eb9065e5006bp-17},
+        {598,0x1.e6e4b3688d9ffp-17,-0x1.e271e5cc1d2c4p-18},
+        {599,0x1.07c8a5654621ep-16,-0x1.313293a46daacp-18},
+        {600,0x1.12a6584ec3098p-16,-0x1.c6decb0712da8p-20},
+        {601,0x1.1372042956f7cp-16,0x1.4c622c355c4cp-20},
+        {602,0x1.0a20657b3e8cfp-16,0x1.1402ad09d0f3ep-18},
+        {603,0x1.ee6a53c4641d4p-17,0x1.c80996479d4dep-18},
+        {604,0x1.b773cac2e69fcp-17,0x1.337ec3a0e8316p-17},
+        {605,0x1.7257db24c4beap-17,0x1.74fdf5b98efd4p-17},
+        {606,0x1.22c51070fcfdbp-17,0x1.a5eb51e2f6075p-17},
+        {607,0x1.99bdc695aee02p-18,0x1.c4adc2f8be3c8p-17},
+        {608,0x1.d3e14db0de9d8p-19,0x1.d0bbb286767c8p-17},
+        {609,0x1.f4d56913695ccp-21,0x1.ca997686fc5d7p-17},
+        {610,-0x1.81fd1f54fee0dp-20,0x1.b3c5534155c04p-17},
+        {611,-0x1.d97d497d55f0ep-19,0x1.8e932ac504b77p-17},
+        {612,-0x1.6104c97b2c4f4p-18,0x1.5dfb2c137457cp-17},
+        {613,-0x1.b9ed8bb94c84cp-18,0x1.255fbc704320ep-17},
+        {614,-0x1.f5e7b7250224cp-18,0x1.d09eb74c91608p-18},
+        {615,-0x1.0a95c13d7778cp-17,0x1.548ebf56e1e3ep-18},
+        {616,-0x1.0cc8d42151a8dp-17,0x1.b9f058f77b11fp-19},
+        {617,-0x1.0328183e51401p-17,0x1.bd517563fe721p-20},
+        {618,-0x1.dfa3cc883dddbp-18,0x1.fd15828bc3a4ap-23},
+        {619,-0x1.aa6dcccdb12ccp-18,-0x1.f313a397d3fd8p-21},
+        {620,-0x1.6bcf1e891b2ecp-18,-0x1.e835d8fb3f934p-20},
+        {621,-0x1.28c867ff4a3dcp-18,-0x1.45e46f67c711ep-19},
+        {622,-0x1.cbcca92d788c6p-19,-0x1.74395981c530cp-19},
+        {623,-0x1.4dff241673282p-19,-0x1.8321eb1b0af42p-19},
+        {624,-0x1.bc204307044b4p-20,-0x1.780a9bb0c10ccp-19},
+        {625,-0x1.ffd7f122d186p-21,-0x1.592d73a551198p-19},
+        {626,-0x1.adadd1c96ffcfp-22,-0x1.2cfe524d334c4p-19},
+        {627,0x1.d5cb42c133a16p-29,-0x1.f34c19a38821fp-20},
+        {628,0x1.1e99d9318c656p-22,-0x1.892bb568f0824p-20},
+        {629,0x1.b68d3d75b3005p-22,-0x1.2472cedd4b07ep-20},
+        {630,0x1.e4edaa8a7ea72p-22,-0x1.9729d77ab3b0bp-21},
+        {631,0x1.c5dd04e17b943p-22,-0x1.05168de7fe6a9p-21},
+        {632,0x1.75420df37c88p-22,-0x1.2be6c49eb2f61p-22},
+        {633,0x1.0c5733a1c1549p-22,-0x1.2419322722f59p-23},
+        {584,0x1.6eba657ba2f9ep-23,0x1.13a8eb0a7ae9cp-24},
+        {585,0x1.21729b757e5e8p-22,0x1.55665d7693542p-23},
+        {586,0x1.84d27af1a9158p-22,0x1.4ba1d4cf0ee46p-22},
+        {587,0x1.cd9b2d0d02c3bp-22,0x1.16ec6a827921fp-21},
+        {588,0x1.e42ace03792acp-22,0x1.a8d78c531670ap-21},
+        {589,0x1.aebfba3b15b01p-22,0x1.2c097b07e35f2p-20},
+        {590,0x1.13a623be9e96ap-22,0x1.8e7545e331d52p-20},
+        {591,-0x1.0bf2b052e15fdp-28,0x1.f59f18aa1796ep-20},
+        {592,-0x1.aa59328492f65p-22,0x1.2cabed5fa75f4p-19},
+        {593,-0x1.f415989488f14p-21,0x1.57d027a576bf2p-19},
+        {594,-0x1.af0e0a576a8cfp-20,0x1.76983c14ea76cp-19},
+        {595,-0x1.430bfd1d395e4p-19,0x1.831951d0d05cap-19},
+        {596,-0x1.bc162adb00c84p-19,0x1.7793f1ba94f72p-19},
+        {597,-0x1.1eb5202b30e0ap-18,0x1.4ef35885260efp-19},
+        {598,-0x1.6018d88ad8fcfp-18,0x1.05504054844c8p-19},
+        {599,-0x1.9e2178de35e36p-18,0x1.30d872fb7cb5ap-20},
+        {600,-0x1.d4470efee241bp-18,0x1.03489c633ad23p-24},
+        {601,-0x1.fdd45def4edecp-18,-0x1.52ec08c40722cp-20},
+        {602,-0x1.0b1c0b4b64202p-17,-0x1.7793d56f46c76p-19},
+        {603,-0x1.0cadef870e3d3p-17,-0x1.2d8ad7cd4e77cp-18},
+        {604,-0x1.01fd59db8d75p-17,-0x1.a549254ae304cp-18},
+        {605,-0x1.d3efc124147bcp-18,-0x1.0eb25866d505ep-17},
+        {606,-0x1.8876fa80f7cb2p-18,-0x1.47cdfa61acaa4p-17},
+        {607,-0x1.22596a27a3f1ep-18,-0x1.7ab3d7c18542ep-17},
+        {608,-0x1.480100b34a8fap-19,-0x1.a431217706e22p-17},
+        {609,-0x1.16d60c41490b5p-22,-0x1.c159dab6ebef7p-17},
+        {610,0x1.1fd97e078639dp-19,-0x1.cfbd40bde8b06p-17},
+        {611,0x1.3969d9b85cab6p-18,-0x1.cd94a16422b7p-17},
+        {612,0x1.e38e77b869762p-18,-0x1.b9e8ebf057754p-17},
+        {613,0x1.4339cffbe7d55p-17,-0x1.94abdb6826283p-17},
+        {614,0x1.8d1f1ad59899ap-17,-0x1.5ec2732b426e8p-17},
+        {615,0x1.cbccc24c3ab4ep-17,-0x1.19ff957a53a7ap-17},
+        {616,0x1.fc1624c878d2cp-17,-0x1.921d543c88282p-18},
+        {617,0x1.0dbff000114cdp-16,-0x1.bd3e043340884p-19},
+        {618,0x1.143449ab0b00bp-16,-0x1.0a5bff2c054b2p-21},
+        {619,0x1.1111ecedafdcfp-16,0x1.3b0379c89ccc6p-19},
+        {620,0x1.0482bcff2b83p-16,0x1.5556f48658c28p-18},
+        {621,0x1.de5bf522600a4p-17,0x1.fe2b8d064adcbp-18},
+        {622,0x1.a45adf1d43cedp-17,0x1.486c12346243fp-17},
+        {623,0x1.5df69acb5dd96p-17,0x1.83bf75c507ebap-17},
+        {624,0x1.0eb42c311197p-17,0x1.aeee95bc25acfp-17},
+        {625,0x1.74e15724212eep-18,0x1.c8c04f7f07938p-17},
+        {626,0x1.9491d850c047p-19,0x1.d0eebbbf59d9dp-17},
+        {627,0x1.2a674ec2aa825p-21,0x1.c822243819a67p-17},
+        {628,-0x1.cc623f799ee7p-20,0x1.afdcbe4ed2962p-17},
+        {629,-0x1.f2033c3070c11p-19,0x1.8a5918afd9cfep-17},
+        {630,-0x1.67e6c0512e55fp-18,0x1.5a5e1838f46d2p-17},
+        {631,-0x1.bcce57d05af08p-18,0x1.230c0e1213756p-17},
+        {632,-0x1.f65f6a9af3073p-18,0x1.cf4da26dc881p-18},
+        {633,-0x1.0a6be9ad7cc4cp-17,0x1.56c1a6c1571d9p-18},
+        {634,-0x1.0cf416910cep-17,0x1.c4ab979b0f6ccp-19},
+        {635,-0x1.043cd435fe1bep-17,0x1.dc5ebb1c054afp-20},
+        {636,-0x1.e46369576228ap-18,0x1.9049a720e7b8cp-22},
+        {637,-0x1.b215fb811f88p-18,-0x1.a8db08ede7b5dp-21},
+        {638,-0x1.7643c0aa11a8ep-18,-0x1.c708041472bb9p-20},
+        {639,-0x1.358d042944ab8p-18,-0x1.39401aefd72b6p-19},
+        {640,-0x1.e86b35a658e64p-19,-0x1.6cfc0648b1a8p-19},
+        {641,-0x1.6bd18accda0aap-19,-0x1.8218a16cbe87dp-19},
+        {642,-0x1.f63a2cf29773ep-20,-0x1.7d50931cbf83ep-19},
+        {643,-0x1.34d066e4490eep-20,-0x1.6436d11a18688p-19},
+        {644,-0x1.3038507bebd5bp-21,-0x1.3cb4ed21c092ep-19},
+        {645,-0x1.0c3cf8056a6a2p-23,-0x1.0c9352389ef18p-19},
+        {646,0x1.831e34d63de47p-23,-0x1.b227a81ae1cd6p-20},
+        {647,0x1.859f38cf1ab22p-22,-0x1.4d49319640628p-20},
+        {648,0x1.db8c5a513fe47p-22,-0x1.e2bae9facf5f7p-21},
+        {649,0x1.dc6e026f32938p-22,-0x1.46050f60ffb77p-21},
+        {650,0x1.a2468fffde3aep-22,-0x1.92b527270ecacp-22},
+        {651,0x1.45abdd16aacb1p-22,-0x1.b709e88b30cd4p-23},
+        {652,0x1.b7e5ae32bc2a7p-23,-0x1.88a306de8338p-24},
+        {602,0x1.0123a407d7335p-22,0x1.0bd4dfc21a5d7p-23},
+        {603,0x1.65a75a18e4f3ep-22,0x1.0f0aca736148ap-22},
+        {604,0x1.b7cc0fd8261ffp-22,0x1.d45ed7c5de36cp-22},
+        {605,0x1.e2f659d308687p-22,0x1.6c1ef1baecd36p-21},
+        {606,0x1.d0100ece2937p-22,0x1.05bb2f5a3fadp-20},
+        {607,0x1.673f4e2f3341cp-22,0x1.6160d22a6762fp-20},
+        {608,0x1.24083eeefb93ep-23,0x1.c4538f52d51acp-20},
+        {609,-0x1.84ce836eead36p-23,0x1.13f9e8a7339b2p-19},
+        {610,-0x1.514d19bf90793p-21,0x1.41ee5cc817f35p-19},
+        {611,-0x1.44aafadcf656p-20,0x1.6720b3aa35e9ap-19},
+        {612,-0x1.0187b793928cp-19,0x1.7e3c26338cfecp-19},
+        {613,-0x1.6fa328e31f45p-19,0x1.81d73df4b0544p-19},
+        {614,-0x1.e8d2700a75434p-19,0x1.6cdc566ffa50cp-19},
+        {615,-0x1.33dd98bedd009p-18,0x1.3afa005c47924p-19},
+        {616,-0x1.72d3c14275e0fp-18,0x1.d225dc8f53e5bp-20},
+        {617,-0x1.ad67a5741da08p-18,0x1.d69136df24246p-21},
+        {618,-0x1.df5f8f5c8cd26p-18,-0x1.ee69b48435546p-23},
+        {619,-0x1.0235db8ed7e9ap-17,-0x1.a3f7f11e43cd7p-20},
+        {620,-0x1.0c3720c4ff526p-17,-0x1.9ecd073d188fap-19},
+        {621,-0x1.0be3741dab6acp-17,-0x1.3f2f44747b6ap-18},
+        {622,-0x1.ff9ce8d0ebfe1p-18,-0x1.b3e108ac29e9ap-18},
+        {623,-0x1.ce219a0934a6ap-18,-0x1.141dc9bf2f832p-17},
+        {624,-0x1.82c6378920d9p-18,-0x1.4b3c019e67ebep-17},
+        {625,-0x1.1e6019dbbb2bp-18,-0x1.7c4cb68eedbdbp-17},
+        {626,-0x1.466f3eb97d40cp-19,-0x1.a463688baafbcp-17},
+        {627,-0x1.4ff72c2f3ea0ap-22,-0x1.c0d446004ad7dp-17},
+        {628,0x1.0e98f9c98a8fap-19,-0x1.cf61706362a9ep-17},
+        {629,0x1.2b9f38bccf802p-18,-0x1.ce638f0286616p-17},
+        {630,0x1.d1275749f0c63p-18,-0x1.bceaa8d5d44bep-17},
+        {631,0x1.3855bac21f0c9p-17,-0x1.9ad4b1f9dac6bp-17},
+        {632,0x1.817868520259cp-17,-0x1.68d7e35bf65fep-17},
+        {633,0x1.c092ab3829c56p-17,-0x1.287fc716ce0b4p-17},
+        {634,0x1.f2a30b51a23f9p-17,-0x1.b839a4363bf56p-18},
+        {635,0x1.0a9ec6e5ed54fp-16,-0x1.0d4eb38743c86p-18},
+        {636,0x1.135894be24d4cp-16,-0x1.5cbcf5015413ap-20},
+        {637,0x1.1311136ab0daap-16,0x1.8a546b9bdc368p-20},
+        {638,0x1.09cbc8e3e439ap-16,0x1.183ac2916e89fp-18},
+        {639,0x1.effacb3627aafp-17,0x1.c238dc484ebbep-18},
+        {640,0x1.bd0941c68a56ap-17,0x1.2cd60062a0dffp-17},
+        {641,0x1.7d395365ec45p-17,0x1.6c5b0afb5c1fcp-17},
+        {642,0x1.33943e66308e4p-17,0x1.9d6681665b704p-17},
+        {643,0x1.c70f9213e7392p-18,0x1.be79a53f2cd94p-17},
+        {644,0x1.2165a405073ep-18,0x1.ceeb9c1c6e774p-17},
+        {645,0x1.f5824ccd083a7p-20,0x1.ceeb8e0167bebp-17},
+        {646,-0x1.e37c649bbf327p-22,0x1.bf7582e306cecp-17},
+        {647,-0x1.56ca7632d7936p-19,0x1.a23b22be2d32ap-17},
+        {648,-0x1.253ebc369e47p-18,0x1.79824d855c6ep-17},
+        {649,-0x1.8827385e441cfp-18,0x1.47fc271229f3fp-17},
+        {650,-0x1.d1ed28676cf36p-18,0x1.1097a36f3e05ep-17},
+        {651,-0x1.00e8e555f6ee8p-17,0x1.aca5a4204d46fp-18},
+        {652,-0x1.0c3c6a7ef3a76p-17,0x1.381c31d6a5976p-18},
+        {653,-0x1.0be1845f823fap-17,0x1.919118a09f784p-19},
+        {654,-0x1.014bbbf19e435p-17,0x1.8c4f01fc98e96p-20},
+        {655,-0x1.dca052ad3f25ep-18,0x1.4d5d461c016cep-23},
+        {656,-0x1.aa00b3c103ccp-18,-0x1.f6e18417e9b8ap-21},
+        {657,-0x1.6f090b2a876a9p-18,-0x1.de286dfad9419p-20},
+        {658,-0x1.2fef83518dafp-18,-0x1.3ef2c5dcadf53p-19},
+        {659,-0x1.e1221fb94cd2ep-19,-0x1.6ef2ccdb76da8p-19},
+        {660,-0x1.687db2dc4d554p-19,-0x1.8247ac0920626p-19},
+        {661,-0x1.f66a0c0398408p-20,-0x1.7d522fa70f3acp-19},
+        {662,-0x1.3a09cc1c85e28p-20,-0x1.653059f507814p-19},
+        {663,-0x1.406fc5bec1b1ep-21,-0x1.3f4d415b5a842p-19},
+        {664,-0x1.52fe1c43fabd6p-23,-0x1.10f949ff5a56dp-19},
+        {665,0x1.454e6574b33bep-23,-0x1.be233164eae6ap-20},
+        {666,0x1.709dcd3876199p-22,-0x1.5b7785751e111p-20},
+        {667,0x1.d37779e670eb4p-22,-0x1.00714488cb4a6p-20},
+        {668,0x1.e1da9836989p-22,-0x1.633c3439de986p-21},
+        {669,0x1.b3a3bc49d9ab8p-22,-0x1.c669149d8337fp-22},
+        {670,0x1.5fcd76cae09b2p-22,-0x1.04e957935f9cep-22},
+        {671,0x1.f581075f9c1acp-23,-0x1.fd3610b38d2a6p-24},
+        {619,0x1.83872b651432ep-23,0x1.3291b6b6c6d16p-24},
+        {620,0x1.25fe15c7be3a4p-22,0x1.60a1ba382e525p-23},
+        {621,0x1.839cfdc62ccap-22,0x1.48fed6788241p-22},
+        {622,0x1.c9dc77171499ap-22,0x1.0de5eb4eaf971p-21},
+        {623,0x1.e4f9776bc93ep-22,0x1.94a095712c02p-21},
+        {624,0x1.bf64b69c03c82p-22,0x1.1b0a64342868ep-20},
+        {625,0x1.435ad1f871e3dp-22,0x1.762de89c52d9ep-20},
+        {626,0x1.732eb7beb04f9p-24,0x1.d70751fe4bd2ap-20},
+        {627,-0x1.048ec6313a705p-22,0x1.1b95c5f1ee28cp-19},
+        {628,-0x1.75892d9eea692p-21,0x1.4753c29335e02p-19},
+        {629,-0x1.564f112221dd2p-20,0x1.6a2bff687aa2dp-19},
+        {630,-0x1.0900b7e453d1cp-19,0x1.7f33c8ff4bda4p-19},
+        {631,-0x1.74b85d2f44eb4p-19,0x1.8176b9cf9e421p-19},
+        {632,-0x1.eab55d4c024d7p-19,0x1.6c521837325dcp-19},
+        {633,-0x1.33026a4bf7b9ap-18,0x1.3bd66088a77b4p-19},
+        {634,-0x1.703f60c7041fap-18,0x1.da5035336c8f6p-20},
+        {635,-0x1.a982ca06d01e8p-18,0x1.fb62101e4b223p-21},
+        {636,-0x1.daef4b9bb54b2p-18,-0x1.da2dcb07a4964p-24},
+        {637,-0x1.0047c49eb7bf1p-17,-0x1.734d450f34d88p-20},
+        {638,-0x1.0b4a04a841602p-17,-0x1.7d79bf5849032p-19},
+        {639,-0x1.0cca4e09ed361p-17,-0x1.2a14ba03c301ap-18},
+        {640,-0x1.036874b45e517p-17,-0x1.9ae6879e1cd8cp-18},
+        {641,-0x1.dc6b8c0fd8b4ap-18,-0x1.0640bad643b48p-17},
+        {642,-0x1.999b3aaf27fd8p-18,-0x1.3cd76ce517d54p-17},
+        {643,-0x1.3ecdf1495414fp-18,-0x1.6e7ac65b23736p-17},
+        {644,-0x1.9b75a86b034dep-19,-0x1.98731b9bf8e62p-17},
+        {645,-0x1.2582517f9abc8p-20,-0x1.b835fa2bb8134p-17},
+        {646,0x1.28427936cbec4p-20,-0x1.cb8e11a64c368p-17},
+        {647,0x1.cec245e263eb2p-19,-0x1.d0c00b1b3ac5ep-17},
+        {648,0x1.888e1adc3584ep-18,-0x1.c6a9bfc7806a8p-17},
+        {649,0x1.138a49632ad88p-17,-0x1.acd98b3e64de2p-17},
+        {650,0x1.5e23a7b3b5323p-17,-0x1.839bec901959p-17},
+        {651,0x1.a0d50778e36f4p-17,-0x1.4bfe460de885ap-17},
+        {652,0x1.d8a6475be923p-17,-0x1.07c641180e297p-17},
+        {653,0x1.0187e1da3e7e8p-16,-0x1.72bc3bb9cf382p-18},
+        {654,0x1.0f0f87ab954f6p-16,-0x1.8edbdf737be8cp-19},
+        {655,0x1.1449bf9a83872p-16,-0x1.445721b44e342p-22},
+        {656,0x1.10f8532201939p-16,0x1.3f5fdab55cbc8p-19},
+        {657,0x1.0542c3d2cf67ap-16,0x1.4d5a18f35f94fp-18},
+        {658,0x1.e368047985a1cp-17,0x1.edf59753e8758p-18},
+        {659,0x1.ae64d33d859p-17,0x1.3db6d2c039536p-17},
+        {660,0x1.6de5115a73dc6p-17,0x1.7855b966f735p-17},
+        {661,0x1.24cb2e46f7dabp-17,0x1.a4ead5b34b017p-17},
+        {662,0x1.ac92fb9fe15abp-18,0x1.c23e4ab3f5244p-17},
+        {663,0x1.0b6a44f4f741p-18,0x1.cfd82de562e42p-17},
+        {664,0x1.b2c1965717068p-20,0x1.ce004fb869edcp-17},
+        {665,-0x1.4ba066ea35f29p-21,0x1.bdb2f6bde89fcp-17},
+        {666,-0x1.633012f1b2fd8p-19,0x1.a08b96dfd21a2p-17},
+        {667,-0x1.274bf453c2778p-18,0x1.78a730ef994b5p-17},
+        {668,-0x1.8749f43c6281cp-18,0x1.48808750128dap-17},
+        {669,-0x1.cf9093768cc88p-18,0x1.12c8aa0e35d83p-17},
+        {670,-0x1.ff68e86f6fdbep-18,0x1.b47d0483a067p-18},
+        {671,-0x1.0bac75b58b1a2p-17,0x1.430ff1842887ap-18},
+        {672,-0x1.0c81f63b61846p-17,0x1.ac3c66761bce2p-19},
+        {673,-0x1.037e1ccc892fap-17,0x1.c72992f5491b3p-20},
+        {674,-0x1.e489dd193d992p-18,0x1.95acbd70394a9p-22},
+        {675,-0x1.b56ae191d4634p-18,-0x1.870672b64e2bbp-21},
+        {676,-0x1.7d91b6f643ac3p-18,-0x1.ae603c51919dep-20},
+        {677,-0x1.40e6297739642p-18,-0x1.2ce4f4c017337p-19},
+        {678,-0x1.030ce0cc6d2b2p-18,-0x1.63f25f9fcd9p-19},
+        {679,-0x1.8e71429786adbp-19,-0x1.7ee95215247aap-19},
+        {680,-0x1.200f34d387296p-19,-0x1.8183a84bf23b4p-19},
+        {681,-0x1.7db81311f59ecp-20,-0x1.70447def420d5p-19},
+        {682,-0x1.b572165e30abep-21,-0x1.50162bffbe424p-19},
+        {683,-0x1.65db7d62ded9ep-22,-0x1.25ecfbafeba06p-19},
+        {684,0x1.8b531d8e05fb6p-26,-0x1.ece9494a0c3d1p-20},
+        {685,0x1.1991090e8a688p-22,-0x1.8b9aa34c5d5c9p-20},
+        {686,0x1.abd9833ace312p-22,-0x1.2eb69402ae644p-20},
+        {687,0x1.e2f4a537a8562p-22,-0x1.b6aa95abde17fp-21},
+        {688,0x1.d470d83cc6102p-22,-0x1.299b05a5e9978p-21},
+        {689,0x1.960fcfcffe5p-22,-0x1.731d65f9cfba9p-22},
+        {690,0x1.3c1a5907e1dcap-22,-0x1.9b68308048096p-23},
+        {691,0x1.b02ab0d099b95p-23,-0x1.7b1aa40048266p-24},
+        {637,0x1.952483a89fed8p-23,0x1.4e250651c2ad3p-24},
+        {638,0x1.2c02018a0499ap-22,0x1.6ff2a37f80c6cp-23},
+        {639,0x1.865bcd5c83eb2p-22,0x1.4ee141adc101cp-22},
+        {640,0x1.ca15988fb4359p-22,0x1.0e651a5f898f4p-21},
+        {641,0x1.e4ff46b35da4ap-22,0x1.910ef1a9ae9a6p-21},
+        {642,0x1.c34e9b8b0d5a4p-22,0x1.168923c7591ep-20},
+        {643,0x1.51007df115294p-22,0x1.6e91cc7f3a5d7p-20},
+        {644,0x1.edf6ac5315ab6p-24,0x1.cc6c17d04b40cp-20},
+        {645,-0x1.992df2a779149p-23,0x1.152c2d5df243ep-19},
+        {646,-0x1.48c46ac665866p-21,0x1.4099460f4f0f9p-19},
+        {647,-0x1.35b567ba1a0a6p-20,0x1.645d15a61ec54p-19},
+        {648,-0x1.e5ece73add51fp-20,0x1.7bfd65ea92c4cp-19},
+        {649,-0x1.58bff5723894ap-19,0x1.82e89baac0cfcp-19},
+        {650,-0x1.c93686734b052p-19,0x1.74c335cf91fb8p-19},
+        {651,-0x1.2010300a8da7ep-18,0x1.4dbbaf89a173ep-19},
+        {652,-0x1.5c121e745ea57p-18,0x1.0adf4e9363644p-19},
+        {653,-0x1.957ce2c14b448p-18,0x1.54d3a8f483b92p-20},
+        {654,-0x1.c8d7d617d113ep-18,0x1.604f1b596f78ap-22},
+        {655,-0x1.f2824ee94aaeep-18,-0x1.bbaf2723c505ep-21},
+        {656,-0x1.0773a58d358e1p-17,-0x1.235f6e939603p-19},
+        {657,-0x1.0d5ab1cd17fdp-17,-0x1.ec73779860ad3p-19},
+        {658,-0x1.098bcea74851dp-17,-0x1.61cf1e0ef63cdp-18},
+        {659,-0x1.f5eb5f79ce25ep-18,-0x1.d07058c722337p-18},
+        {660,-0x1.c1efcca12ab4p-18,-0x1.1ec62651f661ap-17},
+        {661,-0x1.76eaf4965c5b2p-18,-0x1.521aab594afeep-17},
+        {662,-0x1.15c1d3816d651p-18,-0x1.7fafdeb7776c3p-17},
+        {663,-0x1.410198d1b1b5bp-19,-0x1.a51302b127b61p-17},
+        {664,-0x1.a533a97786d3ep-22,-0x1.c0079660262fp-17},
+        {665,0x1.e258ebafab21ep-20,-0x1.cea93ebdbc4fcp-17},
+        {666,0x1.132fc048cfc3p-18,-0x1.cf8a4f7b2d645p-17},
+        {667,0x1.afcafdef7b4c2p-18,-0x1.c1cceb5029e0fp-17},
+        {668,0x1.242dafa1c7f4ap-17,-0x1.a534fb6253eb8p-17},
+        {669,0x1.6b61189e0b71ep-17,-0x1.7a31a62ad7e6fp-17},
+        {670,0x1.aa8f1b2a1679ap-17,-0x1.41dd71269a54p-17},
+        {671,0x1.df0cfc3d75371p-17,-0x1.fbe999f652f22p-18},
+        {672,0x1.034d072f8dd36p-16,-0x1.6186cedf2fa4p-18},
+        {673,0x1.0fbf52372fd97p-16,-0x1.7424db4efef34p-19},
+        {674,0x1.1451f120e6bcdp-16,-0x1.762f1f397a2bap-23},
+        {675,0x1.10d177371f2p-16,0x1.463e47bf3c7a5p-19},
+        {676,0x1.05654899549ddp-16,0x1.4bdcf176b344ap-18},
+        {677,0x1.e51ae60e9befcp-17,0x1.e8529c91d9894p-18},
+        {678,0x1.b23765573ea6ep-17,0x1.39730cce23426p-17},
+        {679,0x1.7450261f2ad03p-17,0x1.736ed3c9f93ecp-17},
+        {680,0x1.2e03c44166127p-17,0x1.a04bdc982b02fp-17},
+        {681,0x1.c477918f096ecp-18,0x1.bed953b67b22p-17},
+        {682,0x1.280b89029ada5p-18,0x1.ce910fb60772dp-17},
+        {683,0x1.19ade0ba54c8dp-19,0x1.cf98b5c6069acp-17},
+        {684,-0x1.d9cbb74eb9d3ep-24,0x1.c2b977a51aeb6p-17},
+        {685,-0x1.1f13a1c291a56p-19,0x1.a94f2cb99b95cp-17},
+        {686,-0x1.07405cf2cef9bp-18,0x1.85300dd5c3559p-17},
+        {687,-0x1.6b3ad5ec22643p-18,0x1.588ec7d8546p-17},
+        {688,-0x1.b945c944f5e69p-18,0x1.25d8e5fe1026ap-17},
+        {689,-0x1.f0550a7ece6eep-18,0x1.df2779b6672c8p-18},
+        {690,-0x1.083eb4f412cbep-17,0x1.707401b5450f8p-18},
+        {691,-0x1.0d6f5466221acp-17,0x1.04381fbc0e73ep-18},
+        {692,-0x1.08bfefd289fdap-17,0x1.3d12c3ab31171p-19},
+        {693,-0x1.f7214cf2ba801p-18,0x1.0b1d65f11f09ap-20},
+        {694,-0x1.cf07093dd4c3ap-18,-0x1.90345f4e528cdp-23},
+        {695,-0x1.9cc05f8f4ece8p-18,-0x1.369d128430bedp-20},
+        {696,-0x1.63ef87938a0fep-18,-0x1.ff86ea4e8f5b9p-20},
+        {697,-0x1.28153b0deebf2p-18,-0x1.467dbd07ad729p-19},
+        {698,-0x1.d8c6468adf7fdp-19,-0x1.7113e2d0d94e4p-19},
+        {699,-0x1.672ee13af0b46p-19,-0x1.8254c7bf12143p-19},
+        {700,-0x1.ff8c959d3d628p-20,-0x1.7df9213a38c82p-19},
+        {701,-0x1.4b6f15db30808p-20,-0x1.684efdac5de7ep-19},
+        {702,-0x1.6bc2360e8a592p-21,-0x1.45e56e019a61bp-19},
+        {703,-0x1.0185bd7d6f90ap-22,-0x1.1b3de3e808987p-19},
+        {704,0x1.5adcd6b439b52p-24,-0x1.d90fe75f0c1e1p-20},
+        {705,0x1.3aae90eef5991p-22,-0x1.7ad6037502dc3p-20},
+        {706,0x1.b92bb3c799bb1p-22,-0x1.21c0236c1d5dep-20},
+        {707,0x1.e4732470776cbp-22,-0x1.a472378189cbcp-21},
+        {708,0x1.d071078c22994p-22,-0x1.1e3629b22eef7p-21},
+        {709,0x1.910d3c95112d4p-22,-0x1.670eeceb958e3p-22},
+        {710,0x1.38bfea02eee13p-22,-0x1.92074d65fffd8p-23},
+        {711,0x1.aef2f08b550b7p-23,-0x1.78f4fba20fdbdp-24},
+        {656,0x1.e6428939ee124p-23,0x1.de82741a1e7d8p-24},
+        {657,0x1.50ade8303f2a2p-22,0x1.d85562c494adep-23},
+        {658,0x1.a236138fbf33ap-22,0x1.926b6a018bd1ap-22},
+        {659,0x1.d877cc14caeap-22,0x1.36a162408ef2cp-21},
+        {660,0x1.e2204d9c1e0e2p-22,0x1.bdc5d085d33c8p-21},
+        {661,0x1.accefd51d5ebp-22,0x1.2dd36743b501cp-20},
+        {662,0x1.265c120b73a86p-22,0x1.854c04b39845cp-20},
+        {663,0x1.f291572c1d857p-25,0x1.e110b7bf7a7a7p-20},
+        {664,-0x1.187bfe6aa0c8p-22,0x1.1dc5a273a976cp-19},
+        {665,-0x1.732eb3e3c11dep-21,0x1.46f9714eeee58p-19},
+        {666,-0x1.4b52b4341228p-20,0x1.684836a039c58p-19},
+        {667,-0x1.f9eb29d4f8e9ep-20,0x1.7d8ed21a4537p-19},
+        {668,-0x1.60efa3b1bf5a2p-19,0x1.829ddcfe2b92p-19},
+        {669,-0x1.cebc1c61fb7fp-19,0x1.737db46c83abep-19},
+        {670,-0x1.2134adc5e485dp-18,0x1.4cb774069f95ep-19},
+        {671,-0x1.5b8371765e8b1p-18,0x1.0b9e59be7b5e4p-19},
+        {672,-0x1.9367f955f309dp-18,0x1.5d293ae8c4ba4p-20},
+        {673,-0x1.c5b42f40a2e0ap-18,0x1.aa3564c7d7824p-22},
+        {674,-0x1.ef14a41736528p-18,-0x1.7ca014f001166p-21},
+        {675,-0x1.061e88ec33719p-17,-0x1.0c02cb20b5b14p-19},
+        {676,-0x1.0d0c540c285f2p-17,-0x1.ccff68d5b57a5p-19},
+        {677,-0x1.0afdae684aa76p-17,-0x1.4e28ceddb17e8p-18},
+        {678,-0x1.fdd13aa2284dep-18,-0x1.b96b9109403ep-18},
+        {679,-0x1.d048962f0b814p-18,-0x1.1216c594b7074p-17},
+        {680,-0x1.8cf439aa08562p-18,-0x1.44fb93aa3aaa2p-17},
+        {681,-0x1.3462efe93d943p-18,-0x1.731419bf4bdap-17},
+        {682,-0x1.9054c65b5709dp-19,-0x1.9a1910797a127p-17},
+        {683,-0x1.2b8fdf2cea1a2p-20,-0x1.b7ea65df86c4bp-17},
+        {684,0x1.ff27174684082p-21,-0x1.caad272bcffap-17},
+        {685,0x1.a7a51ba51979dp-19,-0x1.d0e7278a3aaf4p-17},
+        {686,0x1.6be1feb1ff2dcp-18,-0x1.c996acb1f61b6p-17},
+        {687,0x1.015129d66bf68p-17,-0x1.b444998c624fcp-17},
+        {688,0x1.493a2feebdd8cp-17,-0x1.910fd918c9613p-17},
+        {689,0x1.8ae764a70afe4p-17,-0x1.60b12c2b833bep-17},
+        {690,0x1.c3c179b3db354p-17,-0x1.2476ed93dd72cp-17},
+        {691,0x1.f17f678d47214p-17,-0x1.bc71b4d72ec12p-18},
+        {692,0x1.0921f1c8adce4p-16,-0x1.2088cfbf16a22p-18},
+        {693,0x1.125ad672c052cp-16,-0x1.ea1523cc91f9ap-20},
+        {694,0x1.1408a14a91ca4p-16,0x1.7e6f6f2afd5fep-21},
+        {695,0x1.0e197b7818a97p-16,0x1.b0e447e47ae55p-19},
+        {696,0x1.00cc63942385ap-16,0x1.797ce0eee4bb7p-18},
+        {697,0x1.d95bdb28533bap-17,0x1.06af5e2020dfcp-17},
+        {698,0x1.a522107498e2p-17,0x1.4792912f1aebap-17},
+        {699,0x1.67086b3c9ceecp-17,0x1.7d59b45ab23cp-17},
+        {700,0x1.2187b2d5871fdp-17,0x1.a6780d6ad479p-17},
+        {701,0x1.aea9a774ec09p-18,0x1.c1f2134d8587cp-17},
+        {702,0x1.167db7277e16fp-18,0x1.cf6535b5035bbp-17},
+        {703,0x1.0032008134adfp-19,0x1.cf0791d72e3a2p-17},
+        {704,-0x1.e938516b1063cp-23,0x1.c19fcbb4cf2bap-17},
+        {705,-0x1.25fbfee5c7568p-19,0x1.a875b943b5373p-17},
+        {706,-0x1.07172119a7d5p-18,0x1.853cf5571de6ep-17},
+        {707,-0x1.688e4c3954b92p-18,0x1.59fac4a0bd90ep-17},
+        {708,-0x1.b55a6341dcefp-18,0x1.28e8f291100f2p-17},
+        {709,-0x1.ec798cef0ff1fp-18,0x1.e8aed5ee8c0edp-18},
+        {710,-0x1.06f63062a4828p-17,0x1.7d1cad93ccb56p-18},
+        {711,-0x1.0d51dbeae962fp-17,0x1.1364ce8f62424p-18},
+        {712,-0x1.0a317179348bp-17,0x1.5eb31592d3be2p-19},
+        {713,-0x1.fd98a5910ab9ap-18,0x1.50be85683942p-20},
+        {714,-0x1.d931c4f28b24ep-18,0x1.18bf1b477a8dcp-24},
+        {715,-0x1.aa6838040d938p-18,-0x1.f2c3b6ddec646p-21},
+        {716,-0x1.74920c0dd9b1ap-18,-0x1.cc67203d0bd0bp-20},
+        {717,-0x1.3af2e675fcd67p-18,-0x1.33751b8bbfddp-19},
+        {718,-0x1.0092b210726aep-18,-0x1.6588b23a92f04p-19},
+        {719,-0x1.90370e154381p-19,-0x1.7eabf6587b87p-19},
+        {720,-0x1.278084346140ep-19,-0x1.8205ce28acb75p-19},
+        {721,-0x1.94b25910031dp-20,-0x1.735e602573b1ep-19},
+        {722,-0x1.ebf5c6a262c08p-21,-0x1.56d553035eefp-19},
+        {723,-0x1.d4a250a0483b4p-22,-0x1.309b12cfd3522p-19},
+        {724,-0x1.2899d00cdf546p-24,-0x1.04b144811b01ep-19},
+        {725,0x1.9a72295e8f65fp-23,-0x1.ad6b7781fb7ffp-20},
+        {726,0x1.7cb687bbf04d8p-22,-0x1.53748d57df304p-20},
+        {727,0x1.d3888d459c069p-22,-0x1.00551ba37ae26p-20},
+        {728,0x1.e348ad82e02ccp-22,-0x1.6f00c5ab365f1p-21},
+        {729,0x1.be6a3cd7d1d82p-22,-0x1.ec225c656ff88p-22},
+        {730,0x1.76dadc14ffbc2p-22,-0x1.2ee51c4c7e875p-22},
+        {731,0x1.1ce01ad9ba72dp-22,-0x1.4a235f7dc3b11p-23},
+        {732,0x1.7c7e938eb8053p-23,-0x1.27c8f9682d082p-24},
+    };
+
+    const int ROW_STARTS_2[] = {0,5,10,15,21,26,32,38,44,50,57,64,71,78,85,93,101,109,117,125,134,143,153,162,172,182,192,202,213,224,236,248,260,273,286,300,313,327,342,358,374,390,406,423,441,459,478,497,516,537,558,579,601,624,648,672,696,721,748,775,803,832,862,893,924,956,990,1024,1059,1095,1132,1170,1209,1250,1292,1335,1380,1426,1473,1521,1571,1622,1675,1729,1785,1842,1902,1963,2026,2091,2158,2226,2297,2370,2445,2522,2601};
+
+    const BakedKernelEntry ENTRIES_2[] = {
+        {44,-0x1.1d765cbdb60b2p-14,0x1.4fefb08bc3a04p-15},
+        {45,0x1.d87b78cc5bb8p-15,-0x1.d0a4b16fb4556p-13},
+        {46,0x1.0538458a92622p-13,0x1.b2bd37f8e9d37p-13},
+        {47,-0x1.8a0e2a7fb4a9dp-14,-0x1.814b4bd504e78p-16},
+        {48,0x1.2c305f9dc2148p-18,-0x1.704f317457b64p-19},
+        {45,-0x1.4461973da412ep-16,0x1.670912c93f8c9p-15},
+        {46,-0x1.4bf6b1d4bf73ep-14,-0x1.685575eed12f2p-13},
+        {47,0x1.079c7a70325a4p-12,0x1.32d62c3db98acp-14},
+        {48,-0x1.0a53180040b3p-13,0x1.5782910355954p-14},
+        {49,0x1.db8f0b10c519ap-19,-0x1.9faaeb68673bap-16},
+        {46,0x1.a0e6f21e7923cp-18,0x1.3843704df14cdp-16},
+        {47,-0x1.0a922ceceedb4p-13,-0x1.69554369de692p-15},
+        {48,0x1.bcb9296af8f74p-13,-0x1.2d201c73534fep-13},
+        {49,-0x1.7e3b0a806f4aap-17,0x1.bc9fc473017c2p-13},
+        {50,-0x1.bb9aef8e4d461p-15,-0x1.77952d0284ep-15},
+        {47,0x1.168043ea683aep-18,0x1.3adc215669bf4p-19},
+        {48,-0x1.34c297bd9fb59p-14,0x1.39ed86b77166p-15},
+        {49,0x1.ad455c787d756p-16,-0x1.cddce5128e842p-13},
+        {50,0x1.95a7268c3b4ddp-13,0x1.56d10749309d4p-13},
+        {51,-0x1.08416b503170cp-13,0x1.33965ed807a2cp-15},
+        {52,0x1.93923bc489fa6p-18,-0x1.42f22fa506ea5p-16},
+        {49,-0x1.4bd5efc5446f3p-17,0x1.41085c89400a6p-15},
+        {50,-0x1.ed8e957a61a3p-14,-0x1.e5d2d70187194p-14},
+        {51,0x1.08da40d24f886p-12,-0x1.23afe98da2e21p-14},
+        {52,-0x1.a942bc4033656p-15,0x1.9644436d0741fp-13},
+        {53,-0x1.83c0290b29831p-15,-0x1.8006403c80d7dp-15},
+        {50,0x1.da99e36e4008fp-18,0x1.3e47b606883fp-17},
+        {51,-0x1.a01760464c4b2p-14,0x1.27c223f0624cap-16},
+        {52,0x1.138696e28a70ep-14,-0x1.cf7565d9d7fa8p-13},
+        {53,0x1.80dedeebe20d4p-13,0x1.693bb74393b63p-13},
+        {54,-0x1.0b98b37b5e82p-13,0x1.897ae8c612b48p-15},
+        {55,0x1.879814160f2aep-19,-0x1.b12ccedb43bdep-16},
+        {52,-0x1.2d6680d0a7174p-16,0x1.62b3891d7d42ap-15},
+        {53,-0x1.e46987095cbf6p-14,-0x1.fb15ba5c3bb78p-14},
+        {54,0x1.005790f64cc6ap-12,-0x1.7d4fa7d5d9ab9p-14},
+        {55,-0x1.67b91366bbf9cp-17,0x1.bd0bc19ec043ap-13},
+        {56,-0x1.39c8eb5261197p-14,-0x1.34924768e2c5dp-15},
+        {57,0x1.85a8215aff924p-18,-0x1.4d1a9de4deb91p-18},
+        {53,0x1.e509b72378635p-18,0x1.8fae208371d78p-17},
+        {54,-0x1.99db5e26caf4cp-14,0x1.42499f4b0352p-16},
+        {55,0x1.25f94b39cae02p-15,-0x1.cfbe6ec52e544p-13},
+        {56,0x1.d8bc22240ea5ep-13,0x1.07781659d59dbp-13},
+        {57,-0x1.fe4818c7d4d2ep-14,0x1.b78b68a68dd77p-14},
+        {58,-0x1.045ce549c427p-16,-0x1.5a16657152b2ep-15},
+        {55,-0x1.5e1bfdd01c026p-17,0x1.43caf318b82eap-15},
+        {56,-0x1.0ae28a13d619ap-13,-0x1.4eb2671bbd85p-14},
+        {57,0x1.9083a22e9a0dap-13,-0x1.5b84ec12fbbd8p-13},
+        {58,0x1.935d885398148p-14,0x1.c54fe22d0969p-13},
+        {59,-0x1.f4f6329916f54p-14,0x1.eda2037bfd846p-17},
+        {60,0x1.165d20d84b2f4p-18,-0x1.8d0ecda38dcc8p-16},
+        {56,0x1.80b7b92f9fb68p-18,0x1.4282362a1c072p-18},
+        {57,-0x1.f06302dd10908p-15,0x1.6a814f0633914p-15},
+        {58,-0x1.30d5444d24726p-14,-0x1.747dbdf3c751cp-13},
+        {59,0x1.10df4159aa2fap-12,-0x1.410f524022a7p-15},
+        {60,-0x1.529a89793f02dp-16,0x1.b5f79925a911p-13},
+        {61,-0x1.661cb76bcb76bp-14,-0x1.f8a1f0f2ccc62p-16},
+        {62,0x1.e3750cb7ee096p-18,-0x1.7016caea2240ap-17},
+        {58,0x1.1e83a4fb95bbep-18,0x1.8916abe5693e1p-16},
+        {59,-0x1.d9a4eec613cd5p-14,-0x1.5cc6ec61cb598p-20},
+        {60,0x1.7f1e02c89016ap-15,-0x1.d0b9a65231a36p-13},
+        {61,0x1.f7a30dbafd2eap-13,0x1.a3f1e6f5873fp-14},
+        {62,-0x1.9fa2b404c0ac6p-14,0x1.38935a6be6f2p-13},
+        {63,-0x1.8521bb4efe554p-15,-0x1.7fcbe9be23c31p-15},
+        {64,0x1.4a86396eb0d5cp-18,-0x1.c4c8dd8ca21fap-19},
+        {60,-0x1.ada79528e610cp-17,0x1.4ef53d2f4fce3p-15},
+        {61,-0x1.0d55eba28ede6p-13,-0x1.052afef1981dp-14},
+        {62,0x1.1d97e9c4d5458p-13,-0x1.a82de5326a214p-13},
+        {63,0x1.88ed34cf427c9p-13,0x1.6242e57076ef4p-13},
+        {64,-0x1.00bca8693c2ccp-13,0x1.acf883b9c6f5ep-14},
+        {65,-0x1.d501b24affbc4p-16,-0x1.7a5b458d22404p-15},
+        {66,0x1.b1dc7a54cd0eep-19,-0x1.7cfbfbb3edbe1p-20},
+        {61,0x1.4b2d4db08b624p-18,0x1.c6a30b6fa919cp-19},
+        {62,-0x1.41a38c77ee27ep-15,0x1.82e14ee56b12fp-15},
+        {63,-0x1.eb20574b69f7ap-14,-0x1.eb56d2f2b8f81p-14},
+        {64,0x1.98de2453bc11p-13,-0x1.539e813d2ab0fp-13},
+        {65,0x1.2196699d47b36p-13,0x1.a649b5c7263d2p-13},
+        {66,-0x1.0c9d169e928ep-13,0x1.2bd7f7701831p-14},
+        {67,-0x1.3cce2b18f8c52p-16,-0x1.658f4c07a5fb6p-15},
+        {63,0x1.db87a4d92e28ep-18,0x1.41a7e3c9e28dep-17},
+        {64,-0x1.06a153f90aa73p-14,0x1.6142f6707d17bp-15},
+        {65,-0x1.8c74e30e810e5p-14,-0x1.45158e780bbe6p-13},
+        {66,0x1.da493eff8c275p-13,-0x1.0502a2cf459bep-13},
+        {67,0x1.ba818e4f77754p-14,0x1.c0241e7258abfp-13},
+        {68,-0x1.0d14b8fe46ccbp-13,0x1.d915d91f0d642p-15},
+        {69,-0x1.0dbe60c322c06p-16,-0x1.5c1b9dda87a15p-15},
+        {65,0x1.c7527d1e9da4ep-18,0x1.119912c6419dp-16},
+        {66,-0x1.50c5176e9205p-14,0x1.19707a2c95a36p-15},
+        {67,-0x1.36822b9699abcp-14,-0x1.71f5270434fd2p-13},
+        {68,0x1.f6a67c8d50d31p-13,-0x1.a7b18434b330dp-14},
+        {69,0x1.81655a6b1ac68p-14,0x1.c7436915b90d6p-13},
+        {70,-0x1.0ce0f03b9f3a8p-13,0x1.c92d32dd1122bp-15},
+        {71,-0x1.2f0a57e7bcbd6p-16,-0x1.62f0b294fc9ep-15},
+        {72,0x1.a78b42773cf47p-19,-0x1.6b2669f3fb6bap-20},
+        {67,0x1.58368415c6ec8p-18,0x1.6a46120220375p-16},
+        {68,-0x1.7bc359bf00ecep-14,0x1.b38cda99e6724p-16},
+        {69,-0x1.0687c897240b7p-14,-0x1.853ee0bef3fep-13},
+        {70,0x1.fd29b2f99b23ap-13,-0x1.8c7674e28c047p-14},
+        {71,0x1.91ffac9669c2ap-14,0x1.c563108c0183p-13},
+        {72,-0x1.0d42a2e2b59cp-13,0x1.0d08b95fc5016p-14},
+        {73,-0x1.a03b23cdb594ap-16,-0x1.74a5593bf1d01p-15},
+        {74,0x1.2fd435a256ecp-18,-0x1.790bd856251ap-19},
+        {69,0x1.e13a016748814p-19,0x1.9e48180a0241p-16},
+        {70,-0x1.8c29d057531fp-14,0x1.78536de130ad4p-16},
+        {71,-0x1.045a2eaba6db9p-14,-0x1.8607e71b77843p-13},
+        {72,0x1.f398b5eaa1442p-13,-0x1.b397bb5a955dap-14},
+        {73,0x1.e2cde0e193c7fp-14,0x1.b9ce0b7f31e8p-13},
+        {74,-0x1.0954192aab45ep-13,0x1.629251cbb1e5bp-14},
+        {75,-0x1.3757375387812p-15,-0x1.8292b2ca63c8ep-15},
+        {76,0x1.a2fb4bb412bp-18,-0x1.93d4dc099448fp-18},
+        {71,0x1.51cb4f0cc1c0cp-18,0x1.6df61cb4182aep-16},
+        {72,-0x1.5e96337231ebdp-14,0x1.06e45a80c70d2p-15},
+        {73,-0x1.6e24eecbfa933p-14,-0x1.56b3d23641adep-13},
+        {74,0x1.b300ea20a2b68p-13,-0x1.383bf01422feap-13},
+        {75,0x1.668d938af8e5bp-13,0x1.7d70fb2e17c82p-13},
+        {76,-0x1.c932f4efb46eep-14,0x1.1829230e7b4ccp-13},
+        {77,-0x1.157f4b68c4cfcp-14,-0x1.56297cb313ad2p-15},
+        {78,0x1.d12c79370608ap-18,-0x1.0407279c51317p-16},
+        {73,0x1.6ec50c12f209fp-18,0x1.5c7caccaa1605p-16},
+        {74,-0x1.442ee8fc76483p-14,0x1.28a40c9916738p-15},
+        {75,-0x1.a61a47e894b47p-14,-0x1.33e687cff31fap-13},
+        {76,0x1.78f266f1c2988p-13,-0x1.6f7ea61a10b83p-13},
+        {77,0x1.b1a8ec424dc12p-13,0x1.39bab5e296098p-13},
+        {78,-0x1.5972855b74ccp-14,0x1.6182a26d78e9ep-13},
+        {79,-0x1.7a78ed57221fp-14,-0x1.b7b76d82211c2p-16},
+        {80,0x1.828fa6a366bfdp-19,-0x1.b2091c112b006p-16},
+        {75,0x1.d905c282e8aa8p-18,0x1.ed3b8c9c684f4p-17},
+        {76,-0x1.db63e59e5ef5p-15,0x1.700ca6f59282p-15},
+        {77,-0x1.00360f05a87dp-13,-0x1.afdd6740d35ccp-14},
+        {78,0x1.d7a4e492987ccp-14,-0x1.bb9c5084ab952p-13},
+        {79,0x1.080ea8bfddfb8p-12,0x1.2c32da15eeee4p-14},
+        {80,-0x1.ceb1d834e96bdp-17,0x1.babac2bd92a1p-13},
+        {81,-0x1.f9cefa2bcfb5ep-14,0x1.2a779d86bc87ep-16},
+        {82,-0x1.02b46edf7e02dp-16,-0x1.5996c94f908fdp-15},
+        {83,0x1.38b8845eed49dp-18,-0x1.90bfc86c2c396p-19},
+        {77,0x1.a67d2856a39e2p-18,0x1.9d6289169b65ep-18},
+        {78,-0x1.afa4a953b1faep-16,0x1.76636e42a7e41p-15},
+        {79,-0x1.075d974cc38fap-13,-0x1.25194a7c1adb4p-15},
+        {80,0x1.1f54b2c6e2689p-18,-0x1.c5b1d17fe795ap-13},
+        {81,0x1.0ba92354af5d6p-12,-0x1.f9665cb4d9edap-15},
+        {82,0x1.d2888127f77d7p-14,0x1.bc6a0df8fdc1ep-13},
+        {83,-0x1.f880ab09e8764p-14,0x1.c7fcc1f47ba66p-14},
+        {84,-0x1.0977eac475c7p-14,-0x1.5f1eca69973bap-15},
+        {85,0x1.a790dcb8fcc5p-18,-0x1.326d841355ccp-16},
+        {79,0x1.136adb959d6bdp-18,0x1.32bd4c33762fbp-19},
+        {80,-0x1.16f7247d12a72p-17,0x1.384d76bb58d52p-15},
+        {81,-0x1.c25170752a608p-14,0x1.ef9fc71552d52p-18},
+        {82,-0x1.1c2961fed2479p-14,-0x1.7cda62f4d0272p-13},
+        {83,0x1.aab0107ee6401p-13,-0x1.41524cc2f85cfp-13},
+        {84,0x1.adc8c074c14fap-13,0x1.3df60cc4459dbp-13},
+        {85,-0x1.16718cbef12acp-14,0x1.7f1bac308a7adp-13},
+        {86,-0x1.c4e3c0f8b90c6p-14,-0x1.b490d4efecaaep-18},
+        {87,-0x1.24346929a238bp-17,-0x1.3a85eecf6b777p-15},
+        {88,0x1.189e04eea44a4p-18,-0x1.3ed075e58776p-19},
+        {82,0x1.558c8e7e5b306p-18,0x1.6bbf6c2b47178p-16},
+        {83,-0x1.142fc2e22b7f9p-14,0x1.5710c7c3303p-15},
+        {84,-0x1.0144a4f0ba218p-13,-0x1.a8827b9ca65f5p-14},
+        {85,0x1.5e0a0cdad65c7p-14,-0x1.ca8c515201fb8p-13},
+        {86,0x1.13f0fc6bfb70cp-12,0x1.5c31ca6b33186p-17},
+        {87,0x1.104f427e45e5p-14,0x1.cf5eec131cbf8p-13},
+        {88,-0x1.07e693d875f57p-13,0x1.71ac52a9c3c33p-14},
+        {89,-0x1.ed437b20845ep-15,-0x1.6b2155013c5c8p-15},
+        {90,0x1.982ca1a938b4p-18,-0x1.3f3a2ecfef4bep-16},
+        {84,0x1.cba26f2a00186p-18,0x1.114b7525e083dp-17},
+        {85,-0x1.a21a717787ac8p-16,0x1.74c1fe3e64ba9p-15},
+        {86,-0x1.fa905bef93beep-14,-0x1.338b760c23d6bp-16},
+        {87,-0x1.62a9a0ad8420cp-15,-0x1.a049b34f46e49p-13},
+        {88,0x1.c4e6b6e7dd40cp-13,-0x1.228364656eafdp-13},
+        {89,0x1.aca976f301d7cp-13,0x1.3f233e03c06dep-13},
+        {90,-0x1.cbc28697e319cp-15,0x1.907e2709c689p-13},
+        {91,-0x1.eb2b729191ep-14,0x1.3efac2fb1098bp-17},
+        {92,-0x1.56030f5699206p-16,-0x1.69d7b6a08b966p-15},
+        {93,0x1.b25e788b840ebp-18,-0x1.c102e2ee5677bp-18},
+        {87,0x1.c455671978952p-19,0x1.a469c85f5eabep-16},
+        {88,-0x1.1e1a7ba213ca3p-14,0x1.4ed8f3571586ap-15},
+        {89,-0x1.054de19e93292p-13,-0x1.89a6bfaa63806p-14},
+        {90,0x1.d9e09c2fd3234p-15,-0x1.d05690cb65f3ap-13},
+        {91,0x1.10c4b57cf4888p-12,-0x1.40c9d897832a2p-15},
+        {92,0x1.056285bc99e39p-13,0x1.b25a482d25c7ap-13},
+        {93,-0x1.b45e8000a4302p-14,0x1.292dff33a66eap-13},
+        {94,-0x1.8a79b6c88cb44p-14,-0x1.7e04bf60d1bccp-16},
+        {95,-0x1.79711e1060a36p-18,-0x1.27ad96995773p-15},
+        {96,0x1.2f7e0b71dab63p-18,-0x1.777e66ea58f13p-19},
+        {89,0x1.d997c48e9e5cep-18,0x1.39a1457d0a3bcp-17},
+        {90,-0x1.912eab26a1d79p-16,0x1.729931b27e71ep-15},
+        {91,-0x1.e8005f83f4d8ap-14,-0x1.0a6458d558adap-17},
+        {92,-0x1.1df99a3aae696p-14,-0x1.7c0d06fd64885p-13},
+        {93,0x1.728d7f23324ecp-13,-0x1.745c45b6088d9p-13},
+        {94,0x1.00550f47866ep-12,0x1.7c138d0886044p-14},
+        {95,0x1.0c4dd9168a248p-16,0x1.caa1949442868p-13},
+        {96,-0x1.0ca7bf61ec094p-13,0x1.263751a4b1e9ep-14},
+        {97,-0x1.e7ceba4de77b9p-15,-0x1.6c9710ef58408p-15},
+        {98,0x1.445a9b606a234p-18,-0x1.755f1d9634eccp-16},
+        {92,0x1.9e7ecca5e9e9cp-18,0x1.3a186cdabad03p-16},
+        {93,-0x1.83835fd5db7eep-15,0x1.7fa7ea3cf016p-15},
+        {94,-0x1.0a6c7de398bb7p-13,-0x1.6b723c1920f2ap-15},
+        {95,-0x1.cdec5f7a6355cp-16,-0x1.af63e866b8f44p-13},
+        {96,0x1.bc98996b80246p-13,-0x1.2cc5cd2c78994p-13},
+        {97,0x1.d6b9a75cdef5bp-13,0x1.09f532a89592ep-13},
+        {98,-0x1.7618ada7c213cp-17,0x1.bc79b47387f66p-13},
+        {99,-0x1.0cdcf452338dcp-13,0x1.d25e40357708ap-15},
+        {100,-0x1.bd1973c093809p-15,-0x1.76d27f809b1e4p-15},
+        {101,0x1.5cf6fdb6be4d3p-18,-0x1.6759bb4dd887cp-16},
+        {94,0x1.457adb2ce098ep-18,0x1.b4686be607e4bp-19},
+        {95,-0x1.b735aab503ba4p-19,0x1.16b25d5476bdcp-15},
+        {96,-0x1.5125d796b9922p-14,0x1.1882da7193f75p-15},
+        {97,-0x1.01c6f9a11eaabp-13,-0x1.a477ecc9d639p-14},
+        {98,0x1.68949846e75bp-15,-0x1.d055facb38b68p-13},
+        {99,0x1.05d89c7a6dd9p-12,-0x1.44bf0b4ccdf67p-14},
+        {100,0x1.76bf5d4eae062p-13,0x1.710bd3ba91cb4p-13},
+        {101,-0x1.d42d100e2575ep-15,0x1.8f050eae9245p-13},
+        {102,-0x1.027b198650e69p-13,0x1.b271622e6432cp-16},
+        {103,-0x1.45556b3d8d5fep-15,-0x1.82a64469d2068p-15},
+        {104,0x1.c085921b22352p-18,-0x1.19a388a6e542p-16},
+        {97,0x1.c6289850333c6p-18,0x1.04bc563f2a088p-17},
+        {98,-0x1.d2f8873804ef6p-17,0x1.53814b76f6e78p-15},
+        {99,-0x1.9a3d05c44df0cp-14,0x1.3ecede9ff17bep-16},
+        {100,-0x1.d43d070c18764p-14,-0x1.0da7317de1ebcp-13},
+        {101,0x1.3e824d863745cp-14,-0x1.ccd5e641b0e2ap-13},
+        {102,0x1.0e5bb788e7fecp-12,-0x1.a0c3b1f160272p-15},
+        {103,0x1.5493f1a3cc6e7p-13,0x1.897cc9693b1acp-13},
+        {104,-0x1.0c9f9e5de329bp-14,0x1.82bc638bbac5cp-13},
+        {105,-0x1.00def40fc173cp-13,0x1.88b477e72c96cp-16},
+        {106,-0x1.4d9a06476889ap-15,-0x1.829fd6fdd936p-15},
+        {107,0x1.a96985cc07fcdp-18,-0x1.30b9095f78cd2p-16},
+        {100,0x1.dbc4bdb1a7b86p-18,0x1.41c3780340202p-17},
+        {101,-0x1.17fbb3572d9cdp-16,0x1.5e15a4a27c94cp-15},
+        {102,-0x1.a0805770cafbcp-14,0x1.23c1567172146p-16},
+        {103,-0x1.d872147b61f31p-14,-0x1.097d28b6cb3a7p-13},
+        {104,0x1.14476b17df0b4p-14,-0x1.cf165545e49dfp-13},
+        {105,0x1.09140edfaa776p-12,-0x1.1e76c8c8babacp-14},
+        {106,0x1.80d85499417e4p-13,0x1.68cc60c0c00f4p-13},
+        {107,-0x1.52310b73be712p-15,0x1.a26487e7a3ae2p-13},
+        {108,-0x1.0b6a8b5affc24p-13,0x1.8bc4eb8f0f6ccp-15},
+        {109,-0x1.d84c88084837ep-15,-0x1.70911dd350ad5p-15},
+        {110,0x1.7c7e32044cf98p-19,-0x1.b31126e5be0b2p-16},
+        {111,0x1.da6651d9f281cp-19,-0x1.c45844980d2a8p-20},
+        {103,0x1.e3882c7e47b56p-18,0x1.6ec8534c9c468p-17},
+        {104,-0x1.3072ccdbf1748p-16,0x1.62fc33b154817p-15},
+        {105,-0x1.9ef97e9a13397p-14,0x1.2a4cf2770453cp-16},
+        {106,-0x1.e369a64b4432ap-14,-0x1.fbe042d253a98p-14},
+        {107,0x1.ad73734d9a199p-15,-0x1.d079bb0b3ce34p-13},
+        {108,0x1.00339300a07e9p-12,-0x1.7cc7a4445016fp-14},
+        {109,0x1.af641caed1f2bp-13,0x1.3bf161fdad502p-13},
+        {110,-0x1.5e9c636bbc02fp-17,0x1.bce064f322b9ap-13},
+        {111,-0x1.0bb0e34f0cdd1p-13,0x1.3c5a60a6763f3p-14},
+        {112,-0x1.3a7eb6c4edd1ap-14,-0x1.33179ad7f0e6ep-15},
+        {113,-0x1.298e9b3e7dfddp-18,-0x1.1f5966870794cp-15},
+        {114,0x1.88bf61024fbf2p-18,-0x1.52b2972eb47dep-18},
+        {106,0x1.e533bd8a1ab34p-18,0x1.939fec665132ep-17},
+        {107,-0x1.3e9daf8bd55ccp-16,0x1.659f23fe0f52ep-15},
+        {108,-0x1.9a507aca0750dp-14,0x1.3e1c8bdd220a8p-16},
+        {109,-0x1.ef78e2e6fff37p-14,-0x1.df507e8bc85dep-14},
+        {110,0x1.27ea1cc03df9p-15,-0x1.cf6c3d0897ee5p-13},
+        {111,0x1.e895219d43266p-13,-0x1.dab569759f967p-14},
+        {112,0x1.d887af8092918p-13,0x1.071a895a6bd9p-13},
+        {113,0x1.7afb2d5819622p-16,0x1.cca7f064ae49bp-13},
+        {114,-0x1.fd5dec927046ap-14,0x1.b87b0d9024e4dp-14},
+        {115,-0x1.86e009dca5304p-14,-0x1.8aaf412bda416p-16},
+        {116,-0x1.07661e3d8825ap-16,-0x1.5a774cc60e287p-15},
+        {117,0x1.e2168d68cd0d1p-18,-0x1.6298f0e62d54bp-17},
+        {109,0x1.d5758c12fd0bcp-18,0x1.2b589298cdc33p-17},
+        {110,-0x1.63d355967b402p-17,0x1.445e39ecb4e4p-15},
+        {111,-0x1.59ec82e2c31ep-14,0x1.0cb7be20f930ep-15},
+        {112,-0x1.0a8547f052db6p-13,-0x1.4fd14165b786cp-14},
+        {113,-0x1.0c607f64695fcp-16,-0x1.b8dda1a986978p-13},
+        {114,0x1.90745d9618cb2p-13,-0x1.5b0e33c7414a2p-13},
+        {115,0x1.0c7d63b6c2532p-12,0x1.dd1b9b2940e3fp-15},
+        {116,0x1.93fc5bbcc2d47p-14,0x1.c4dab9ca15bc9p-13},
+        {117,-0x1.7a2f672cde125p-14,0x1.4f9af63c658e8p-13},
+        {118,-0x1.f4f4a1713a03p-14,0x1.f7b8fdb658825p-17},
+        {119,-0x1.706832010b9fcp-15,-0x1.8128db91ca4f9p-15},
+        {120,0x1.11400caee89eep-18,-0x1.8f2e8fc30297dp-16},
+        {121,0x1.f8108f87dfb0ap-19,-0x1.fe613f78a496bp-20},
+        {112,0x1.acec77dd85e96p-18,0x1.af47a9f62d92fp-18},
+        {113,-0x1.1cf215b77b3fep-18,0x1.1df2a1f56d3dp-15},
+        {114,-0x1.19d9bd3a9e32ep-14,0x1.521f153eed34cp-15},
+        {115,-0x1.0bc0e1b489c6cp-13,-0x1.9ad86618b01fap-15},
+        {116,-0x1.e62c6e1daf1c2p-15,-0x1.8bd461cc8f914p-13},
+        {117,0x1.24ea17b51a0bcp-13,-0x1.a44b1af7758c2p-13},
+        {118,0x1.13967c1f96b71p-12,-0x1.ea687f8f89636p-17},
+        {119,0x1.574a09a400fbbp-13,0x1.8797294b459b7p-13},
+        {120,-0x1.3e3e056fd37a6p-15,0x1.a4e8a18750894p-13},
+        {121,-0x1.0ce9e48540144p-13,0x1.1638bb1ed49cp-14},
+        {122,-0x1.43dfbefad344ep-14,-0x1.286eca8c1bab2p-15},
+        {123,-0x1.2ec2889c8b01ep-17,-0x1.3c1858585a751p-15},
+        {124,0x1.d3cd9c98fa1b8p-18,-0x1.264b5903c3ffep-17},
+        {115,0x1.182643edd700ep-18,0x1.3c958baa980fcp-19},
+        {116,0x1.1934bb97c0f28p-18,0x1.8b57fe3dda27ap-16},
+        {117,-0x1.488888d79d653p-15,0x1.827d269262905p-15},
+        {118,-0x1.d9d3e78a14876p-14,-0x1.af896532c4b9bp-20},
+        {119,-0x1.c5a2419120088p-14,-0x1.1ac12f49c66fap-13},
+        {120,0x1.811bee00460f6p-15,-0x1.d0585f94e9c63p-13},
+        {121,0x1.df0bd9f387b3bp-13,-0x1.f9efe594e141ap-14},
+        {122,0x1.f757aacc8645p-13,0x1.a34b1035f6e9ap-14},
+        {123,0x1.19dd80bfdfd0cp-14,0x1.cebe072a0c124p-13},
+        {124,-0x1.9e58470e9e039p-14,0x1.38e0aa8c34b2ap-13},
+        {125,-0x1.f08c1951d84c8p-14,0x1.a454a0d4973d7p-17},
+        {126,-0x1.870be41ac178p-15,-0x1.7f0fd38bd604fp-15},
+        {127,0x1.31867116316ep-19,-0x1.c15229bff5deap-16},
+        {128,0x1.4ead20e5a075ap-18,-0x1.cf5a3e4a7e7d5p-19},
+        {119,0x1.d9b9807604e9ep-18,0x1.ea8d8d4cba28cp-17},
+        {120,-0x1.31633a1dc48a9p-16,0x1.6312334e7d268p-15},
+        {121,-0x1.70a7a226c82eep-14,0x1.d641dd34d167ap-16},
+        {122,-0x1.0b1cc889c828ep-13,-0x1.4585b5571fa68p-14},
+        {123,-0x1.1f627a73effc9p-15,-0x1.a8b561cab956p-13},
+        {124,0x1.4957e8bc1e503p-13,-0x1.905bfc24dd4bap-13},
+        {125,0x1.13f2516f6489p-12,-0x1.d3491ead25891p-18},
+        {126,0x1.60a3dbee826e9p-13,0x1.81352b8ba464cp-13},
+        {127,-0x1.9052630a547dep-16,0x1.b2754c66d5ec2p-13},
+        {128,-0x1.086bbb468c29ap-13,0x1.69ecfd3844be3p-14},
+        {129,-0x1.83bd8a15f6ee8p-14,-0x1.959ef318403d9p-16},
+        {130,-0x1.6864502978cc8p-16,-0x1.6c95f97c4cbb6p-15},
+        {131,0x1.c85e1bd9818a8p-18,-0x1.102ec5247bb08p-16},
+        {122,0x1.832df18e55a27p-18,0x1.463a9599d349p-18},
+        {123,0x1.2b0c0f7bba7f7p-20,0x1.dc7029427a75cp-16},
+        {124,-0x1.8486f6d4124f6p-15,0x1.7f456bdc0f6e4p-15},
+        {125,-0x1.e3dd04d922bd7p-14,-0x1.99605fb39b44p-18},
+        {126,-0x1.c99ca6742969ap-14,-0x1.172f357c93aa4p-13},
+        {127,0x1.0e12a88d0c927p-15,-0x1.cecd2435cbda2p-13},
+        {128,0x1.bc82db7b2d436p-13,-0x1.2c899d75b2d9cp-13},
+        {129,0x1.0b20517bce61bp-12,0x1.01fb2187b69cdp-14},
+        {130,0x1.e4c31a8f8663ap-14,0x1.b914b641dd82ep-13},
+        {131,-0x1.08da41807c78ep-14,0x1.83f38fd234112p-13},
+        {132,-0x1.0cb9f96a7804p-13,0x1.d3bda4f7e38f2p-15},
+        {133,-0x1.46e4d829e5a6p-14,-0x1.24bc7e6147fb7p-15},
+        {134,-0x1.bb8cde3344f3p-17,-0x1.506c332c03647p-15},
+        {135,0x1.e40516f73f87cp-18,-0x1.ad9a20192c5b9p-17},
+        {126,0x1.dcf09d9ba66e8p-18,0x1.460fca20e21f6p-17},
+        {127,-0x1.a99cdaeea983ep-18,0x1.2c2ffc708d09ep-15},
+        {128,-0x1.079a9cc512fcap-14,0x1.5fdcea942619ap-15},
+        {129,-0x1.034138f5d9afap-13,-0x1.cc387db850e8dp-16},
+        {130,-0x1.8b04cfb79d996p-14,-0x1.4560458dc6f89p-13},
+        {131,0x1.f029e89fe6c6cp-15,-0x1.cfd5fd5f4b1cp-13},
+        {132,0x1.da09d078e8514p-13,-0x1.049435a7148fcp-13},
+        {133,0x1.05660da23b572p-12,0x1.48540b0b35209p-14},
+        {134,0x1.bb25a1c711052p-14,0x1.bf993cee8585p-13},
+        {135,-0x1.155252c3112eap-14,0x1.7f2cf776ec31p-13},
+        {136,-0x1.0ccb42ff08418p-13,0x1.dbe8563f984cp-15},
+        {137,-0x1.52714c06c1762p-14,-0x1.165dda9ba9688p-15},
+        {138,-0x1.1162a1b8f848ep-16,-0x1.5c889e0c251p-15},
+        {139,0x1.d5244efc39c56p-18,-0x1.fb4b1816095f6p-17},
+        {140,0x1.526fd3114c6bcp-19,-0x1.d0e9cbd0d096ep-21},
+        {129,0x1.a28f630f7b778p-19,0x1.5f9ebc114b642p-20},
+        {130,0x1.c5237c3825bbep-18,0x1.142a330021dadp-16},
+        {131,-0x1.25c7da3e6f074p-16,0x1.60bc8f1030032p-15},
+        {132,-0x1.5199a79f9c502p-14,0x1.176512d506bc8p-15},
+        {133,-0x1.0c569db27d26p-13,-0x1.bb1e4056f6f04p-15},
+        {134,-0x1.34f4f6c097b71p-14,-0x1.721a5732275cp-13},
+        {135,0x1.75493922e314cp-14,-0x1.c80fef27cfa1ep-13},
+        {136,0x1.f65272b26dba4p-13,-0x1.a6f49ba66c5b8p-14},
+        {137,0x1.f977386afeba4p-13,0x1.9a1b3278b7484p-14},
+        {138,0x1.822b2f368e542p-14,0x1.c6b9e6b969866p-13},
+        {139,-0x1.2c8bf8a244638p-14,0x1.75b7e8ab9e4acp-13},
+        {140,-0x1.0c9862615ebe6p-13,0x1.cc187f92cd54cp-15},
+        {141,-0x1.567f356cbef86p-14,-0x1.10fffa7f5c37bp-15},
+        {142,-0x1.32e2bfa52cbbp-16,-0x1.634accb2808e6p-15},
+        {143,0x1.bf330cad4dc3ep-18,-0x1.1b0af7eacb19ep-16},
+        {144,0x1.b273da1200c1fp-19,-0x1.7a6d9bb8d6343p-20},
+        {133,0x1.7a348bb7355f8p-18,0x1.338d0f2c0e84bp-18},
+        {134,0x1.ad7e6d23589ep-19,0x1.a8ec65dc79e76p-16},
+        {135,-0x1.1c4e3f393beaap-15,0x1.807c9113341eep-15},
+        {136,-0x1.a0c5df9ee1e28p-14,0x1.211529133f10bp-16},
+        {137,-0x1.08eb6c78da774p-13,-0x1.634974b2b26c4p-14},
+        {138,-0x1.6e97ad4a60d42p-15,-0x1.9e4712eba0756p-13},
+        {139,0x1.069f4221c2a74p-13,-0x1.b183dd67cc703p-13},
+        {140,0x1.08f9aa944840dp-12,-0x1.1e33a40dd4f7fp-14},
+        {141,0x1.db2c64c4141cap-13,0x1.02c1d08a4c6a4p-13},
+        {142,0x1.27b348a0f1f1dp-14,0x1.cdf267e74c249p-13},
+        {143,-0x1.5803c2f52b128p-14,0x1.61b3c21d1857ep-13},
+        {144,-0x1.0b4b8cfe62a58p-13,0x1.8d4b569c2f346p-15},
+        {145,-0x1.4c38a835fd69cp-14,-0x1.1e1d9ae2b61b6p-15},
+        {146,-0x1.2cf1e3c78ac8dp-16,-0x1.622089cf874f4p-15},
+        {147,0x1.b766205304206p-18,-0x1.235104681f586p-16},
+        {148,0x1.dfe8554e17745p-19,-0x1.cd0f25980983fp-20},
+        {137,0x1.b0b706388aff8p-18,0x1.ba490a3218d8cp-18},
+        {138,0x1.01971123457b5p-20,0x1.dfb4d8582ea52p-16},
+        {139,-0x1.4a46deeaf8936p-15,0x1.824ef71348732p-15},
+        {140,-0x1.b0eebe69b5286p-14,0x1.aa79fcbb7758p-17},
+        {141,-0x1.0720b6db73342p-13,-0x1.766c7b96099c6p-14},
+        {142,-0x1.64e953de1959ep-15,-0x1.9f97807651d36p-13},
+        {143,0x1.fe9e942ab9f1ap-14,-0x1.b4523982c4ba2p-13},
+        {144,0x1.05b81f22be9c4p-12,-0x1.445da57252184p-14},
+        {145,0x1.eb8f2b29eef46p-13,0x1.cf602f42dd793p-14},
+        {146,0x1.763578d310768p-14,0x1.c7eae64631532p-13},
+        {147,-0x1.18266fb8f6641p-14,0x1.7dfaf45c77738p-13},
+        {148,-0x1.0cc6bb71157b2p-13,0x1.16c3ea262b3ecp-14},
+        {149,-0x1.8132a31def1f6p-14,-0x1.9e0707e8cc867p-16},
+        {150,-0x1.e321ef2096933p-16,-0x1.7b108b4abaafp-15},
+        {151,0x1.1628d72dc43bdp-18,-0x1.8caf6ade95455p-16},
+        {152,0x1.6bf8581987c36p-18,-0x1.185a653dd81b1p-18},
+        {141,0x1.96b5294bb6c5ap-18,0x1.723f856e408ep-18},
+        {142,0x1.882073704f191p-19,0x1.b07d0d3e6582ap-16},
+        {143,-0x1.09642c19d0afcp-15,0x1.7e7e2c76b6948p-15},
+        {144,-0x1.8777ad2773d2bp-14,0x1.87210be6665a9p-16},
+        {145,-0x1.0ccbc417dff84p-13,-0x1.143d16ceed354p-14},
+        {146,-0x1.28d64c1a1dec4p-14,-0x1.772f2562a8bdcp-13},
+        {147,0x1.482d4851a25acp-14,-0x1.cbdc5897c45bcp-13},
+        {148,0x1.d82369eb5c74cp-13,-0x1.073d6ae928342p-13},
+        {149,0x1.0ce7a47f23877p-12,0x1.cc5bad72be8dap-15},
+        {150,0x1.338c5436ea1b4p-13,0x1.9c9a19048ba4bp-13},
+        {151,-0x1.1668372cf99c1p-16,0x1.b830a28a579bfp-13},
+        {152,-0x1.ee28bc765ef07p-14,0x1.e18a09cc634b2p-14},
+        {153,-0x1.e3ba5ae8c1ebp-14,0x1.9accec8209166p-18},
+        {154,-0x1.d51d7b37f0d2ap-15,-0x1.70ecac9935968p-15},
+        {155,-0x1.c50c0d534d3b4p-18,-0x1.2eb24453cdaaap-15},
+        {156,0x1.e53273d5d067cp-18,-0x1.99d28324eea4ap-17},
+        {145,0x1.93373085419bcp-18,0x1.69b59df50558ap-18},
+        {146,0x1.d5bb5cced4637p-19,0x1.a052eb0ca1f84p-16},
+        {147,-0x1.d9895b7be6972p-16,0x1.7a2b3aa7d0cf6p-15},
+        {148,-0x1.6f4670a1882a7p-14,0x1.d9b375f5c2994p-16},
+        {149,-0x1.0c2b2c90c5998p-13,-0x1.b5e4e23d7138ap-15},
+        {150,-0x1.69d4ab74cbafep-14,-0x1.585e9d6d31982p-13},
+        {151,0x1.96fbf9b2685b7p-15,-0x1.d03412f4bb29p-13},
+        {152,0x1.a69c90be4241cp-13,-0x1.44f9496bef74ep-13},
+        {153,0x1.13a7b244c2d6ap-12,0x1.84130d75070ecp-17},
+        {154,0x1.848c3edebb3cep-13,0x1.6540c81d0467cp-13},
+        {155,0x1.daeff7fe47a92p-16,0x1.cddaf3219b482p-13},
+        {156,-0x1.97d209a25a963p-14,0x1.3cf8d27e1026bp-13},
+        {157,-0x1.08b3bdab654aap-13,0x1.471dd8f185958p-15},
+        {158,-0x1.4eaca3dbb51dcp-14,-0x1.1ae0a93267fb6p-15},
+        {159,-0x1.7595dcd03d5d4p-16,-0x1.6e68abfe50cb4p-15},
+        {160,0x1.52d4e5af1d21ep-18,-0x1.6cfe2e34e215cp-16},
+        {161,0x1.64dc0ff9ab566p-18,-0x1.0b823baf1aa78p-18},
+        {149,0x1.376b94c648a46p-18,0x1.8a9894335c0ccp-19},
+        {150,0x1.a381c49675a7cp-18,0x1.35b1cc8584fp-16},
+        {151,-0x1.faf9a58a269a2p-17,0x1.57fa3bbdd9deap-15},
+        {152,-0x1.1a686c5db1ecp-14,0x1.513276035818ap-15},
+        {153,-0x1.f800e03694b0ep-14,-0x1.1edb3411949f3p-16},
+        {154,-0x1.df97f0a4b89d7p-14,-0x1.01744d2cd253ap-13},
+        {155,-0x1.f1b6c51af043cp-17,-0x1.b97393c277ccep-13},
+        {156,0x1.2504633b2010ap-13,-0x1.a3f46b1170c3ap-13},
+        {157,0x1.075aac68f2368p-12,-0x1.313db2579604p-14},
+        {158,0x1.f66d44abdaeffp-13,0x1.a5e7a280dfc74p-14},
+        {159,0x1.dc1e661d70d6cp-14,0x1.ba561c92e73b9p-13},
+        {160,-0x1.3c7b10ea1d14ap-15,0x1.a4dd532591751p-13},
+        {161,-0x1.fea384b7ccc8cp-14,0x1.b2db0b1a1e47p-14},
+        {162,-0x1.dc9d53b1ac81ep-14,0x1.8a8ded462862ep-19},
+        {163,-0x1.de67b19aa312ep-15,-0x1.6e7a8df585623p-15},
+        {164,-0x1.328df145b7acp-17,-0x1.3c866fa8895dap-15},
+        {165,0x1.d7af8d45f64b8p-18,-0x1.f25f4171dea22p-17},
+        {166,0x1.e2951d681e836p-19,-0x1.d15393658aadp-20},
+        {154,0x1.d40622ef861ep-18,0x1.26215a3b75484p-17},
+        {155,0x1.87f97d419ae2fp-22,0x1.ec20682dcb421p-16},
+        {156,-0x1.22d5b9c5c5a0ep-15,0x1.80d51cbc37518p-15},
+        {157,-0x1.8085c04745c78p-14,0x1.9fc9dce5edea3p-16},
+        {158,-0x1.0c4cfbd84181p-13,-0x1.c02e0d98abce8p-15},
+        {159,-0x1.7b3b8530e62e6p-14,-0x1.4e95b273490bcp-13},
+        {160,0x1.0c537a23afd86p-15,-0x1.ce8caa7c977bp-13},
+        {161,0x1.7ad35e508c176p-13,-0x1.6d417a0e63fe8p-13},
+        {162,0x1.121575ad7f96p-12,-0x1.d979f2fb67394p-16},
+        {163,0x1.ca795d1979f82p-13,0x1.1a64eb7344068p-13},
+        {164,0x1.584483207991p-14,0x1.ca87c6ebaf5cdp-13},
+        {165,-0x1.e9829dfee5beap-15,0x1.8aee6681346f4p-13},
+        {166,-0x1.07928b8abd4bep-13,0x1.70fa8c3605e96p-14},
+        {167,-0x1.c78de35ff888ep-14,-0x1.64d140b06da4dp-18},
+        {168,-0x1.b63d28507f594p-15,-0x1.778eb5022204ap-15},
+        {169,-0x1.f9460bf4e017ap-18,-0x1.336026bba7011p-15},
+        {170,0x1.db747827584acp-18,-0x1.e38512bddcc3ap-17},
+        {171,0x1.e8f052493e2c2p-19,-0x1.dd7b643b5195cp-20},
+        {158,0x1.60fca1b936ae4p-18,0x1.049005c48ad0cp-18},
+        {159,0x1.8c8c95c07aea9p-18,0x1.47c6267546ee6p-16},
+        {160,-0x1.f0839564697b3p-17,0x1.56b6cb061a97p-15},
+        {161,-0x1.09d3e6ca9b182p-14,0x1.5deb697e7d6b1p-15},
+        {162,-0x1.e5162245791dp-14,-0x1.cb494df5c3be3p-18},
+        {163,-0x1.ffa6d45c30c46p-14,-0x1.af3af0ffe7f9ep-14},
+        {164,-0x1.803bc14a9ddecp-15,-0x1.9b96250c5024ap-13},
+        {165,0x1.8c353b7d32a4p-14,-0x1.c569540cb07bcp-13},
+        {166,0x1.d54759113f046p-13,-0x1.0b3db59139cb6p-13},
+        {167,0x1.117a9ff62f1d4p-12,0x1.0fa7b7c9ede2cp-15},
+        {168,0x1.7bcd634886a12p-13,0x1.6c6c9ffcdb55bp-13},
+        {169,0x1.344a9cb8dc01fp-15,0x1.cf473673cbbe4p-13},
+        {170,-0x1.65964831d320cp-14,0x1.5a8335dfe9656p-13},
+        {171,-0x1.0cd513ed50602p-13,0x1.05e0151b316dep-14},
+        {172,-0x1.9b0d6b518a5e3p-14,-0x1.38bd4ca6d582dp-16},
+        {173,-0x1.613cecd2857b6p-15,-0x1.81986193e7ddbp-15},
+        {174,-0x1.c1e2f0a4c083ap-19,-0x1.170a966b82747p-15},
+        {175,0x1.e55eed293fc3cp-18,-0x1.9425f1e804b94p-17},
+        {176,0x1.99a46ede44baep-19,-0x1.4fa318c0e3454p-20},
+        {163,0x1.c50ca6e864303p-18,0x1.0154d6ecef42ap-17},
+        {164,0x1.5e274e1c50084p-19,0x1.b89587c24abc3p-16},
+        {165,-0x1.afd6df5fc7db6p-16,0x1.75d45a4a04f66p-15},
+        {166,-0x1.4563d18ba427ep-14,0x1.25ec3307f6fcp-15},
+        {167,-0x1.016674009fa66p-13,-0x1.9e5d21b90a19fp-16},
+        {168,-0x1.df53890b4c83p-14,-0x1.018e83189ad1p-13},
+        {169,-0x1.b80e4ef4146c7p-16,-0x1.b010e4baa84c8p-13},
+        {170,0x1.de637f3d2512ap-14,-0x1.b9dc4af886726p-13},
+        {171,0x1.e85309d30850fp-13,-0x1.d9fc8bf7df64ep-14},
+        {172,0x1.0f3d6f4da239cp-12,0x1.76a179bb143bap-15},
+        {173,0x1.6fb1606c2dacap-13,0x1.75e485ebe153ap-13},
+        {174,0x1.1fdfebf87df34p-15,0x1.cee3cb7a08f5p-13},
+        {175,-0x1.611b02efb469cp-14,0x1.5cd0f1bd29f2ap-13},
+        {176,-0x1.0ca22c868decap-13,0x1.1754286b646p-14},
+        {177,-0x1.a9ee3558fabeep-14,-0x1.ebd4e86726e12p-17},
+        {178,-0x1.8cf0697bba385p-15,-0x1.7df146ed60b4p-15},
+        {179,-0x1.bbe250857d742p-18,-0x1.2dbd6cc7e64d5p-15},
+        {180,0x1.d765dcf320adep-18,-0x1.f36effe49d024p-17},
+        {181,0x1.14f9c283d12f6p-18,-0x1.33b8941f9ff06p-19},
+        {168,0x1.ce80b9e8fca57p-18,0x1.16dc637bfb772p-17},
+        {169,0x1.3b692ee72f1b7p-19,0x1.bf22ae9fe8e77p-16},
+        {170,-0x1.a76aed097a4c6p-16,0x1.74d41e0ee1edep-15},
+        {171,-0x1.3ba6550cefb7ap-14,0x1.30ed52f8890c7p-15},
+        {172,-0x1.fa7b199568766p-14,-0x1.3b5b13386eda7p-16},
+        {173,-0x1.f19fb9351a37ep-14,-0x1.d7d74bde80eaap-14},
+        {174,-0x1.5ead852854bb7p-15,-0x1.a038040c41179p-13},
+        {175,0x1.7d488309c855fp-14,-0x1.c6f9e8a94f408p-13},
+        {176,0x1.c4a3faeb2ba8ap-13,-0x1.21e269a7b0601p-13},
+        {177,0x1.13b0ae14b3d5cp-12,0x1.32df3a8999ba2p-17},
+        {178,0x1.ac7ad777f6192p-13,0x1.3e7653facbbf5p-13},
+        {179,0x1.38c9106169a2bp-14,0x1.ccb7ec9a10383p-13},
+        {180,-0x1.c7b9d12740564p-15,0x1.9084c8197a44ep-13},
+        {181,-0x1.00eccc9611978p-13,0x1.a777a4489d908p-14},
+        {182,-0x1.eb438a91091f1p-14,0x1.4e64281f58b0ap-17},
+        {183,-0x1.215c4f90259b8p-14,-0x1.4af9dc6dfaac1p-15},
+        {184,-0x1.5b205fc69fc6cp-16,-0x1.6a2a7b33db838p-15},
+        {185,0x1.01e18fc85b4b3p-18,-0x1.95f944a6fa761p-16},
+        {186,0x1.b63d1fe3f01a4p-18,-0x1.cb5ad10e2364dp-18},
+        {172,0x1.a9d8d135dcd0ap-19,0x1.6998304145cc9p-20},
+        {173,0x1.e3f3c0173d406p-18,0x1.6fe67afd4f27p-17},
+        {174,-0x1.70c0f0d282c6ep-23,0x1.f6c009c0293b2p-16},
+        {175,-0x1.01041cf39732fp-15,0x1.7d2deb879ac78p-15},
+        {176,-0x1.5226c677f9fc3p-14,0x1.1606dac6b27b5p-15},
+        {177,-0x1.01414215e3bc6p-13,-0x1.9bc8ac241596ap-16},
+        {178,-0x1.ea57354cf7045p-14,-0x1.e9f163c6812ep-14},
+        {179,-0x1.501225b5b4dd7p-15,-0x1.a22522eb9e66cp-13},
+        {180,0x1.75d1103574db1p-14,-0x1.c7b522f21744p-13},
+        {181,0x1.bc5ec9c161394p-13,-0x1.2c25f77ba7fc7p-13},
+        {182,0x1.13dc1cbdd61c6p-12,-0x1.cdfa8d293d442p-20},
+        {183,0x1.c0d11b6e17082p-13,0x1.26acd79f42b62p-13},
+        {184,0x1.82aec60092d0fp-14,0x1.c65e29c8a5d0cp-13},
+        {185,-0x1.3b614b2a309a4p-15,0x1.a4d62ee38c246p-13},
+        {186,-0x1.e67d23f3310fcp-14,0x1.f2fb9eace067p-14},
+        {187,-0x1.025fb2a97512ep-13,0x1.b9c6aa22eaee7p-16},
+        {188,-0x1.5709c8f335bcp-14,-0x1.0f9b687732d0cp-15},
+        {189,-0x1.090e573a5c48p-15,-0x1.7e37ee1836b07p-15},
+        {190,-0x1.335b6d72800d6p-21,-0x1.fe7904efeecf4p-16},
+        {191,0x1.e4d6869374f33p-18,-0x1.7b4a7056ff122p-17},
+        {192,0x1.b9b411700ed6cp-19,-0x1.84c6d35c2689cp-20},
+        {177,0x1.791bef535ce92p-19,0x1.1c71bcdf713eep-20},
+        {178,0x1.dbbd361e4dd62p-18,0x1.3fcf3818e4202p-17},
+        {179,0x1.f9f38e350f4d4p-20,0x1.ca6c03acd13fap-16},
+        {180,-0x1.96c4e1b3ae4d2p-16,0x1.72bb589465e5p-15},
+        {181,-0x1.2948b3379aab1p-14,0x1.439195941b91ep-15},
+        {182,-0x1.e8228bd45d567p-14,-0x1.1aa79c9d1aef6p-17},
+        {183,-0x1.0516c40732b26p-13,-0x1.8723d8b1861a6p-14},
+        {184,-0x1.1bd61ead3606fp-14,-0x1.7c31ffc8346d6p-13},
+        {185,0x1.922330737c2a8p-15,-0x1.cff9d318b84d9p-13},
+        {186,0x1.728d9ccd1bc59p-13,-0x1.7392fda313989p-13},
+        {187,0x1.0c6b373ab0b9ep-12,-0x1.d77a5a391b90cp-15},
+        {188,0x1.0016b514fd39ep-12,0x1.7b29006aa9267p-14},
+        {189,0x1.35bbf18d2cdc8p-13,0x1.9b23235a470c9p-13},
+        {190,0x1.1373c9d33a348p-16,0x1.ca2f185164a5ap-13},
+        {191,-0x1.7042671182e56p-14,0x1.5492aa419e9c4p-13},
+        {192,-0x1.0c227001edaefp-13,0x1.281f0e8b59aaap-14},
+        {193,-0x1.c22e61de75932p-14,-0x1.dcf2450575fb4p-18},
+        {194,-0x1.eaa27b175d217p-15,-0x1.6ad591fc3034ap-15},
+        {195,-0x1.07289a1a44113p-16,-0x1.5a00abd3c9b1bp-15},
+        {196,0x1.3cfafe78b876cp-18,-0x1.78e1ffa2897b2p-16},
+        {197,0x1.afd134a777b72p-18,-0x1.b65a92e512546p-18},
+        {183,0x1.86e4b9c48e2d2p-18,0x1.4cd0d47653dcp-18},
+        {184,0x1.998b807d9d8e8p-18,0x1.3dc24aeeeea66p-16},
+        {185,-0x1.398a2413f76ep-17,0x1.3d7a6cc14924ep-15},
+        {186,-0x1.868dce82a148dp-15,0x1.7e7e587616a8cp-15},
+        {187,-0x1.8f63ec207b762p-14,0x1.674460555657ap-16},
+        {188,-0x1.0a20190788454p-13,-0x1.6fab2890f79cep-15},
+        {189,-0x1.c8565d4a30e6ep-14,-0x1.1797a6b023ecep-13},
+        {190,-0x1.c5734595e6be3p-16,-0x1.af33fabba5724p-13},
+        {191,0x1.9700dc68d2f4ep-14,-0x1.c3f7e339534e6p-13},
+        {192,0x1.bc574af4e0fc6p-13,-0x1.2c114a5ff1144p-13},
+        {193,0x1.13921c73b1917p-12,-0x1.62a40cb1c4956p-17},
+        {194,0x1.d66069fb9859bp-13,0x1.0951d3796e889p-13},
+        {195,0x1.e54d4486378eep-14,0x1.b88af0b5f8552p-13},
+        {196,-0x1.65d853f37c09ap-17,0x1.bc2d0280161bbp-13},
+        {197,-0x1.a6c28a1c09be5p-14,0x1.3249431ecd0cep-13},
+        {198,-0x1.0c7395551aa3ep-13,0x1.d67bc6b7ab0f4p-15},
+        {199,-0x1.aa94e8b84bdbep-14,-0x1.e3c0ef40818fp-17},
+        {200,-0x1.c0152b94a1333p-15,-0x1.7548924abd24p-15},
+        {201,-0x1.c2504ced4fbcep-17,-0x1.50f3cde65b379p-15},
+        {202,0x1.55fcc1a4b37eap-18,-0x1.6afd1da40040cp-16},
+        {203,0x1.acd7398d44689p-18,-0x1.ad1ba21dcb93ap-18},
+        {188,0x1.4c531fe4a7aa8p-18,0x1.c56de2728dabbp-19},
+        {189,0x1.d55019388e3a6p-18,0x1.fab8bc73f5598p-17},
+        {190,-0x1.d732638ca8619p-19,0x1.1822042d1c2bdp-15},
+        {191,-0x1.2012eca0d6ebdp-15,0x1.805cfd73ae414p-15},
+        {192,-0x1.5259f982e66d4p-14,0x1.15873f97c3daep-15},
+        {193,-0x1.f93a83374585cp-14,-0x1.2fd64da09bedfp-16},
+        {194,-0x1.00fe12d6e18b7p-13,-0x1.a63050ec45f04p-14},
+        {195,-0x1.1359c50a71e42p-14,-0x1.7f71dc61d3358p-13},
+        {196,0x1.6be2749a8e314p-15,-0x1.cfba01cc91c18p-13},
+        {197,0x1.5c573631ff04ap-13,-0x1.8391ebbeeca7p-13},
+        {198,0x1.05911fbd1ca5dp-12,-0x1.43e8d6a84f43cp-14},
+        {199,0x1.0acd04492ac56p-12,0x1.03207bd6932c2p-14},
+        {200,0x1.76bbbf27fad3ap-13,0x1.70376fcd0666ap-13},
+        {201,0x1.e4cdb7884ea54p-15,0x1.cf8a6f3754ae2p-13},
+        {202,-0x1.cfa59712c3edep-15,0x1.8f0ebf23de327p-13},
+        {203,-0x1.f3d1ba5e77d9p-14,0x1.d155c0ca096e3p-14},
+        {204,-0x1.025a171450f2ap-13,0x1.bb3e0d814197ep-16},
+        {205,-0x1.695a4a3756fdp-14,-0x1.ea861afee3a6ep-16},
+        {206,-0x1.48789fc10d93cp-15,-0x1.81e2aa1cc455ep-15},
+        {207,-0x1.90a147573e431p-18,-0x1.297eaa4ff2432p-15},
+        {208,0x1.bcef98f2a7944p-18,-0x1.1d6253a4585e5p-16},
+        {209,0x1.6f5dc8fe03ca5p-18,-0x1.1d88ed2d48ad2p-18},
+        {193,0x1.60b59cdd436fep-19,0x1.f1b51fc6b14a8p-21},
+        {194,0x1.c9c26c76fb8c1p-18,0x1.0b0f4aa02e2c4p-17},
+        {195,0x1.244fd37346d2ep-18,0x1.8578b18c7b6ep-16},
+        {196,-0x1.ddd877184f324p-17,0x1.544bffd91e6e8p-15},
+        {197,-0x1.b4b901160ed84p-15,0x1.7773512baf278p-15},
+        {198,-0x1.9b11b1ae0cf8ap-14,0x1.37222a07776a5p-16},
+        {199,-0x1.0a388e37092a4p-13,-0x1.73fe7f420d89p-15},
+        {200,-0x1.d2434a518ee4fp-14,-0x1.0e5672294df48p-13},
+        {201,-0x1.409379aee1445p-15,-0x1.a4044b4b13e12p-13},
+        {202,0x1.3fda9a2162d48p-14,-0x1.cc14087db2171p-13},
+        {203,0x1.905c4c42c6184p-13,-0x1.5a54e992c3446p-13},
+        {204,0x1.0e097c02465bdp-12,-0x1.9fa514d6237e3p-15},
+        {205,0x1.0252311d7722ap-12,0x1.6567054c750dep-14},
+        {206,0x1.54aee39bcac2fp-13,0x1.889cac6683a1fp-13},
+        {207,0x1.67c8ffbc3a669p-15,0x1.cfa8498a596bap-13},
+        {208,-0x1.0a49dcd2fbf14p-14,0x1.82da414100dfep-13},
+        {209,-0x1.fbd65909562fap-14,0x1.ba091b704ad06p-14},
+        {210,-0x1.00c3f92b84d76p-13,0x1.91c19ae15b2c9p-16},
+        {211,-0x1.684af249987e6p-14,-0x1.ed8a83e91fbaap-16},
+        {212,-0x1.50d539df13258p-15,-0x1.81c70c47b684cp-15},
+        {213,-0x1.e127852198c04p-18,-0x1.31065e73c5be5p-15},
+        {214,0x1.a49ce417a2f02p-18,-0x1.3498fdc2c8665p-16},
+        {215,0x1.8e2388adeb2ccp-18,-0x1.5cb422ef8e80bp-18},
+        {199,0x1.d3819f4ec2cbap-19,0x1.b1e86dbd84316p-20},
+        {200,0x1.ddf7915fda207p-18,0x1.48c430a55f08cp-17},
+        {201,0x1.9f29021dbe996p-19,0x1.ab766661f64ep-16},
+        {202,-0x1.1dd0fa2a0293cp-16,0x1.5eb6b6a2ff623p-15},
+        {203,-0x1.cd67612fb7158p-15,0x1.72297571ed2fcp-15},
+        {204,-0x1.a14fdde729205p-14,0x1.1bba7ae7a6234p-16},
+        {205,-0x1.0a541f728c512p-13,-0x1.7819fded01742p-15},
+        {206,-0x1.d66ee3f0372abp-14,-0x1.0a35d30080ac2p-13},
+        {207,-0x1.6b6cfc9ae7125p-15,-0x1.9e3b477515d52p-13},
+        {208,0x1.15c81d4ba3617p-14,-0x1.ce57e1caf75cp-13},
+        {209,0x1.78eaec8b1244ep-13,-0x1.6e60b5df553e8p-13},
+        {210,0x1.08c4df3a19e58p-12,-0x1.1dad70d0fda54p-14},
+        {211,0x1.0a4cdc8026c1ep-12,0x1.098158d983bb3p-14},
+        {212,0x1.80caf047777f6p-13,0x1.67edc9db60d7dp-13},
+        {213,0x1.28aab7964c27fp-14,0x1.cd70890dd5845p-13},
+        {214,-0x1.4d76cc390761dp-15,0x1.a24b1b2282f76p-13},
+        {215,-0x1.cfa468537417p-14,0x1.10be6ac946cdap-13},
+        {216,-0x1.0b0d07b4b1d74p-13,0x1.90578de3a651dp-15},
+        {217,-0x1.a7b0f60661ca3p-14,-0x1.fd65d49d55829p-17},
+        {218,-0x1.db814c4671d2ap-15,-0x1.6eb2c97f2ab58p-15},
+        {219,-0x1.30e46f4db852dp-16,-0x1.627e398330935p-15},
+        {220,0x1.65f9bd3fe29f4p-19,-0x1.b6d645622dd36p-16},
+        {221,0x1.e10689f487369p-18,-0x1.589688c9ddc16p-17},
+        {222,0x1.eae290cd6467p-19,-0x1.deb81a042b51fp-20},
+        {205,0x1.6f2f3167f244bp-18,0x1.1cd7f99d50f74p-18},
+        {206,0x1.cfefd9f91e306p-18,0x1.05c645d4f10e8p-16},
+        {207,-0x1.4f3f8ff8ddec2p-19,0x1.100d89435797cp-15},
+        {208,-0x1.e68be3a44ee35p-16,0x1.7add9bb5f37bap-15},
+        {209,-0x1.263684a7aa7e9p-14,0x1.4617ef61f9c2ep-15},
+        {210,-0x1.d1b3474474d0cp-14,0x1.68c9dcc45bfbap-20},
+        {211,-0x1.0c63facc63b38p-13,-0x1.18b57625bc3bcp-14},
+        {212,-0x1.a273396f9d102p-14,-0x1.351e0ddc92b54p-13},
+        {213,-0x1.61e7116e63e55p-16,-0x1.b42e2c157da03p-13},
+        {214,0x1.79396caceb39cp-14,-0x1.c7226fde0a726p-13},
+        {215,0x1.9b96f7e28e254p-13,-0x1.4f8f71b11bc78p-13},
+        {216,0x1.0dffcf166370ep-12,-0x1.9f8362fa5af32p-15},
+        {217,0x1.052a063a9b6c2p-12,0x1.479d523a52eb2p-14},
+        {218,0x1.6dc344d41294ap-13,0x1.76fa3cfeafb76p-13},
+        {219,0x1.092b88285eb99p-14,0x1.ceca553142952p-13},
+        {220,-0x1.69db1c7f73dbdp-15,0x1.9e68b799635ecp-13},
+        {221,-0x1.d12ea5e6b201dp-14,0x1.0f3971cb5dee7p-13},
+        {222,-0x1.0b53fa2333952p-13,0x1.9c4609da88bfp-15},
+        {223,-0x1.af3695f1419cap-14,-0x1.b4d0e65e63845p-17},
+        {224,-0x1.f6de383bb817p-15,-0x1.66ec3cdb2afb2p-15},
+        {225,-0x1.658906907b022p-16,-0x1.6b98558b73e1ep-15},
+        {226,0x1.1a804933d778fp-20,-0x1.dd33485d9c583p-16},
+        {227,0x1.e5479ca7167fdp-18,-0x1.9d3e45b55fe8cp-17},
+        {228,0x1.2d8ab5a429fa1p-18,-0x1.6e627d1f02341p-19},
+        {211,0x1.8ebb1ff3dc288p-18,0x1.5da75c8086792p-18},
+        {212,0x1.bc74f01db2eeep-18,0x1.1dd860b2c26f4p-16},
+        {213,-0x1.ee669754df484p-19,0x1.19592238fd601p-15},
+        {214,-0x1.fd14daa8efb79p-16,0x1.7c8dbe245fe5bp-15},
+        {215,-0x1.28081621da5dp-14,0x1.4451709456efp-15},
+        {216,-0x1.cf2064c3179b4p-14,0x1.373dd7bd67abp-19},
+        {217,-0x1.0c8c7848ad6bp-13,-0x1.098715433822bp-14},
+        {218,-0x1.b2ad40fc13892p-14,-0x1.2922441617e26p-13},
+        {219,-0x1.04b01d91ceb68p-15,-0x1.ab34d8578b66p-13},
+        {220,0x1.3a11b87586619p-14,-0x1.cc56d50908c6cp-13},
+        {221,0x1.7cb1a2fa51d35p-13,-0x1.6b37e2f463048p-13},
+        {222,0x1.072aa7d72395ap-12,-0x1.30b90d5c8dcdap-14},
+        {223,0x1.0d77a9c097955p-12,0x1.b1500cd311f7p-15},
+        {224,0x1.9da4faf9c2d0cp-13,0x1.4d78a3002e61ap-13},
+        {225,0x1.8c25f7fd43e22p-14,0x1.c50bb1f11fd22p-13},
+        {226,-0x1.e0c87ad8c839cp-17,0x1.b964b7a26f948p-13},
+        {227,-0x1.8bbcf03223f91p-14,0x1.441b502fd0abep-13},
+        {228,-0x1.0ad62ae4cbd4fp-13,0x1.41c0e46328e3ap-14},
+        {229,-0x1.e563fa98d4b5ep-14,0x1.e55dee9f740abp-18},
+        {230,-0x1.477f6c889e6ebp-14,-0x1.22b6ba0f3c46p-15},
+        {231,-0x1.33162843846dp-15,-0x1.8147493a90783p-15},
+        {232,-0x1.db76fec9b6ac6p-18,-0x1.306d5d2bfcc77p-15},
+        {233,0x1.878152652c97ap-18,-0x1.4b3651b98b6fap-16},
+        {234,0x1.b48a1518d5822p-18,-0x1.c47b4615db6e8p-18},
+        {217,0x1.5656020ba978dp-18,0x1.e39558e0fa9dap-19},
+        {218,0x1.e19a516bfb664p-18,0x1.c3f9242c0415cp-17},
+        {219,0x1.6844b855105dp-21,0x1.e54c553d5f1a2p-16},
+        {220,-0x1.56d09f8146af4p-16,0x1.69263e210bcf6p-15},
+        {221,-0x1.d8130bc6614afp-15,0x1.6f630cf9a8fdbp-15},
+        {222,-0x1.9824bb980b5c3p-14,0x1.42734bfb8526ap-16},
+        {223,-0x1.06a4d8882d186p-13,-0x1.24427d5523ddfp-15},
+        {224,-0x1.f6934aca538c2p-14,-0x1.c8be7ebc1f83ap-14},
+        {225,-0x1.21fc828a6c163p-14,-0x1.796562b7d481ap-13},
+        {226,0x1.6f3898f7aaefbp-16,-0x1.cbb304c579a7ep-13},
+        {227,0x1.10625033d51edp-13,-0x1.acdc4353450cap-13},
+        {228,0x1.ce644c582dc6ep-13,-0x1.144cc21ec0ba4p-13},
+        {229,0x1.12df44fdef9dep-12,-0x1.3e72c52f57fafp-16},
+        {230,0x1.f6d2150b5fbacp-13,0x1.a223f3fe2c6a6p-14},
+        {231,0x1.52b0203f23d2p-13,0x1.89b4c01026b02p-13},
+        {232,0x1.cdcb18ff1f9fap-15,0x1.cf8c340a0eea1p-13},
+        {233,-0x1.7514af5672e3p-15,0x1.9cbeeee1a5915p-13},
+        {234,-0x1.c99f51614f80ap-14,0x1.160aa2c64e35ep-13},
+        {235,-0x1.0c510d1dfe0eep-13,0x1.da03dbf88ab65p-15},
+        {236,-0x1.c6824afcbf892p-14,-0x1.6f176ea887b94p-18},
+        {237,-0x1.22164e2de773ap-14,-0x1.49b3008b3214cp-15},
+        {238,-0x1.facb31ea5ab1dp-16,-0x1.7c584a23ba3e2p-15},
+        {239,-0x1.15ceea08ff648p-18,-0x1.1cb642b4937c3p-15},
+        {240,0x1.ae9e2df208428p-18,-0x1.2b997059d11dp-16},
+        {241,0x1.a1bb616710ee3p-18,-0x1.8ca4173f2a9aep-18},
+        {223,0x1.6976d1002cafep-19,0x1.03ba515fe0862p-20},
+        {224,0x1.b24d53f279ec6p-18,0x1.bce2a850a9c16p-18},
+        {225,0x1.9fa32a845855dp-18,0x1.38ae1be553ed6p-16},
+        {226,-0x1.30bb7555ab3a5p-18,0x1.1f953b81252b2p-15},
+        {227,-0x1.f67e10c9deb5ap-16,0x1.7bfb7d04a0a94p-15},
+        {228,-0x1.1b8500b7d9e88p-14,0x1.4f567d4ea9cbap-15},
+        {229,-0x1.bd0cbd589e343p-14,0x1.22f1e66f6bcdep-17},
+        {230,-0x1.0b52a21e0b2b4p-13,-0x1.9ff48580591ap-15},
+        {231,-0x1.de1f576c57f92p-14,-0x1.020430198b916p-13},
+        {232,-0x1.e0c859732ff4ap-15,-0x1.8be5b4c5f8a92p-13},
+        {233,0x1.265fde034134bp-15,-0x1.ce9957dd0ac6ep-13},
+        {234,0x1.2538be217e52ep-13,-0x1.a34706c2e85p-13},
+        {235,0x1.d7d12de661b76p-13,-0x1.06aaaad660072p-13},
+        {236,0x1.13313990de7c3p-12,-0x1.e8dfbf7bda122p-17},
+        {237,0x1.f60c1b19fa42ep-13,0x1.a50e69352f6cap-14},
+        {238,0x1.5766498610d48p-13,0x1.86948e3d2def6p-13},
+        {239,0x1.fde9bf097cc0bp-15,0x1.cefc85b359e85p-13},
+        {240,-0x1.38f598df53b2cp-15,0x1.a4c64491bf689p-13},
+        {241,-0x1.b4a60bcc61e62p-14,0x1.277793b2d087p-13},
+        {242,-0x1.0c4b9dc4b4463p-13,0x1.18a7c61373f5ap-14},
+        {243,-0x1.dcd1fdf960a26p-14,0x1.c06c59cb3c54ap-19},
+        {244,-0x1.455e9e9b34cbcp-14,-0x1.250f401b96e35p-15},
+        {245,-0x1.418bb1f8273acp-15,-0x1.818c92873cd3cp-15},
+        {246,-0x1.3a2ca924c41dap-17,-0x1.3d603c30fecp-15},
+        {247,0x1.3fbbdde3861f8p-18,-0x1.772b7c8f6388p-16},
+        {248,0x1.d7050feeb5bfep-18,-0x1.2dec96e34c44cp-17},
+        {249,0x1.eee09a7f7f6ap-19,-0x1.e53d47bea719ep-20},
+        {230,0x1.850bbe720d5p-18,0x1.47c467dec4524p-18},
+        {231,0x1.d452cb81c28f2p-18,0x1.fe011bfdd1191p-17},
+        {232,-0x1.3d6ef154ce40ap-22,0x1.f8bb04ef584bbp-16},
+        {233,-0x1.5e0b59e2833a3p-16,0x1.6a4018701badap-15},
+        {234,-0x1.c9eaa703b4492p-15,0x1.72a6d3cf99fa4p-15},
+        {235,-0x1.88575efa4e733p-14,0x1.8067332ae5294p-16},
+        {236,-0x1.012f7a0b127bcp-13,-0x1.a1289529c7b98p-16},
+        {237,-0x1.050c45f366b48p-13,-0x1.84f5f544b8acp-14},
+        {238,-0x1.6cf63f0133143p-14,-0x1.55e8e411ac494p-13},
+        {239,-0x1.636873639079bp-17,-0x1.bbe6a023615c9p-13},
+        {240,0x1.7685cf8d1672cp-14,-0x1.c73bfcb1faef3p-13},
+        {241,0x1.85621fef924fcp-13,-0x1.63bfbf1b4f18cp-13},
+        {242,0x1.05715708cf2eep-12,-0x1.4389b7cf62cp-14},
+        {243,0x1.1086574e0c69fp-12,0x1.33b726bedfa9ep-15},
+        {244,0x1.c0a56996d450ep-13,0x1.263d12f27e9a8p-13},
+        {245,0x1.08d83af7c5aadp-13,0x1.afe6017a8d28ep-13},
+        {246,0x1.96051f2a06397p-16,0x1.cc442ee4a4c9ep-13},
+        {247,-0x1.0969b767e7054p-14,0x1.82e52a7a71ec4p-13},
+        {248,-0x1.e561c3640c1f4p-14,0x1.f3e21dd4d07b6p-14},
+        {249,-0x1.0af02322b50dap-13,0x1.91bcdfcc68f84p-15},
+        {250,-0x1.bd5854eec53bfp-14,-0x1.1f070bd2c92c1p-17},
+        {251,-0x1.208b3c6d28efbp-14,-0x1.4ae9201b4028p-15},
+        {252,-0x1.0af14b5e84436p-15,-0x1.7e042f2a53208p-15},
+        {253,-0x1.9873de8d863f8p-18,-0x1.2a0f9abf4b06cp-15},
+        {254,0x1.79dedb6776e51p-18,-0x1.5489852775851p-16},
+        {255,0x1.c96462b8b9b1ap-18,-0x1.099c81210c9f7p-17},
+        {256,0x1.c357ef29dd5fep-19,-0x1.92c7106dd9eap-20},
+        {236,0x1.eff42810c527ap-19,0x1.e6a59e50caf56p-20},
+        {237,0x1.d0c4d6247098dp-18,0x1.1b7658fda832fp-17},
+        {238,0x1.6f92bb91f1cd2p-18,0x1.5b38af11f3db8p-16},
+        {239,-0x1.974d25bc4bc01p-18,0x1.29eb6d0d7c3bap-15},
+        {240,-0x1.031c48db8d174p-15,0x1.7cfe49edb998cp-15},
+        {241,-0x1.1719edc833b54p-14,0x1.52d932ab240cp-15},
+        {242,-0x1.b19d5a742a59ap-14,0x1.99d1e8a1f307fp-17},
+        {243,-0x1.08cceb97ef786p-13,-0x1.53bdc7eb0704cp-15},
+        {244,-0x1.f63a5c1a1dcc6p-14,-0x1.c91387aebca8ep-14},
+        {245,-0x1.3a212e99a7752p-14,-0x1.6eeea9099d956p-13},
+        {246,0x1.552ac61f88dd6p-18,-0x1.c500f808fafdp-13},
+        {247,0x1.b282bf87d9107p-14,-0x1.c005cf863421ep-13},
+        {248,0x1.989e49c5adbc6p-13,-0x1.5224f9d82b966p-13},
+        {249,0x1.08a773a5d41dp-12,-0x1.1d62b8e54dab4p-14},
+        {250,0x1.0f51377dd444fp-12,0x1.68a8d2a4a9c9p-15},
+        {251,0x1.bc7abb69d5446p-13,0x1.2b4dfce533256p-13},
+        {252,0x1.08de6e988b6f8p-13,0x1.afd6e8e6be3dap-13},
+        {253,0x1.c4dabb0366bd3p-16,0x1.cceeb0dd098e2p-13},
+        {254,-0x1.f05f940e3b03cp-15,0x1.8917ddb2da47p-13},
+        {255,-0x1.d99021311297ap-14,0x1.0696d04e1e952p-13},
+        {256,-0x1.0c1eb9082f01cp-13,0x1.d0ecc2cd1b6bep-15},
+        {257,-0x1.cf78cba660d56p-14,-0x1.18c49fe5299c2p-19},
+        {258,-0x1.3c55d9d1ee3d9p-14,-0x1.2f34f0924bdbp-15},
+        {259,-0x1.41f8bec393accp-15,-0x1.81731e9cf773cp-15},
+        {260,-0x1.63667320c5dcfp-17,-0x1.43a6146890bfep-15},
+        {261,0x1.04fb7171f2256p-18,-0x1.94285a0db4227p-16},
+        {262,0x1.e3b8c44b59cfep-18,-0x1.6ac3ed1edc1dap-17},
+        {263,0x1.33990893da451p-18,-0x1.7d3cd26201475p-19},
+        {243,0x1.0768f69aec5bep-18,0x1.130f3dcf07a5p-19},
+        {244,0x1.d44f005da3f74p-18,0x1.2531af6a84e5ap-17},
+        {245,0x1.6f1676babfe93p-18,0x1.5b7fc24411aedp-16},
+        {246,-0x1.7666b7c6c6596p-18,0x1.26a962b6086ebp-15},
+        {247,-0x1.e90a8fa5eb7fdp-16,0x1.7acbc31c466cdp-15},
+        {248,-0x1.096c460fe192p-14,0x1.5d3653cc5acdap-15},
+        {249,-0x1.a1aa66340bf94p-14,0x1.182db7b81790cp-16},
+        {250,-0x1.05081f0f17ca8p-13,-0x1.0a1bdea575677p-15},
+        {251,-0x1.02de2d12fda4cp-13,-0x1.9632a06d9ec67p-14},
+        {252,-0x1.6ca521a519d88p-14,-0x1.55f5e7ee1ce47p-13},
+        {253,-0x1.058581a885dfbp-16,-0x1.b83c70e7dc1b6p-13},
+        {254,0x1.46902e45cde38p-14,-0x1.cb44b3617a388p-13},
+        {255,0x1.66ebfa64e9ed8p-13,-0x1.7baeb5ff61d7cp-13},
+        {256,0x1.f5bdffd49a374p-13,-0x1.a5a796bcc2b57p-14},
+        {257,0x1.13900fc7e819ap-12,0x1.3c0cff7298d49p-18},
+        {258,0x1.ecadce93e102fp-13,0x1.c83d4a9c1e448p-14},
+        {259,0x1.576b356851f6p-13,0x1.8666ed224bb9cp-13},
+        {260,0x1.234aa8c04b53p-14,0x1.cd6ac3fc016cap-13},
+        {261,-0x1.7fb22de3eb94dp-16,0x1.b26d37985f709p-13},
+        {262,-0x1.7ffc81642e854p-14,0x1.4af5ac0854ab1p-13},
+        {263,-0x1.05d1d23a52702p-13,0x1.7d5435ebf368p-14},
+        {264,-0x1.0245f56f686bep-13,0x1.c06ac3140cee4p-16},
+        {265,-0x1.95857556db7dcp-14,-0x1.4c2f9b361f744p-16},
+        {266,-0x1.f8142da84fafbp-15,-0x1.661f7f8e47589p-15},
+        {267,-0x1.bec839903c12cp-16,-0x1.76e50d00ae48ep-15},
+        {268,-0x1.16782b7da6679p-18,-0x1.1cab711da895p-15},
+        {269,0x1.8c93e12b5aa7p-18,-0x1.4769597b22308p-16},
+        {270,0x1.c9e31d10b5bcep-18,-0x1.0a7f516bddcap-17},
+        {271,0x1.e3434d3d4221cp-19,-0x1.cd58bbd68199bp-20},
+        {250,0x1.5fc1bfdfda19ep-19,0x1.ea038cd637886p-21},
+        {251,0x1.98776a3097728p-18,0x1.73e41e5a2cc8p-18},
+        {252,0x1.d3d0983a2517cp-18,0x1.ffa5975d7da6bp-17},
+        {253,0x1.88ae57e09a54cp-21,0x1.e3c782abde218p-16},
+        {254,-0x1.14e1d25330096p-16,0x1.5c8e5496e11eap-15},
+        {255,-0x1.7bfbdedd81e9cp-15,0x1.7ef283f2893f3p-15},
+        {256,-0x1.5326251bc1238p-14,0x1.138779373d387p-15},
+        {257,-0x1.d96c854db43p-14,-0x1.0a87bf591ee45p-19},
+        {258,-0x1.0c34bee5334ep-13,-0x1.e06af0850725cp-15},
+        {259,-0x1.dd962bd19abf2p-14,-0x1.0238585e3d237p-13},
+        {260,-0x1.11d6bcea75435p-14,-0x1.7f881936cef04p-13},
+        {261,0x1.bab9e316b78bep-17,-0x1.c87a9f6eaa22cp-13},
+        {262,0x1.be92dcedecac6p-14,-0x1.be33f7aa77fa2p-13},
+        {263,0x1.93e03d24c8fa6p-13,-0x1.56851946bbe3ep-13},
+        {264,0x1.056171fb0e77cp-12,-0x1.435a2d3b71eadp-14},
+        {265,0x1.11e07199cc30ap-12,0x1.c72431ce94a97p-16},
+        {266,0x1.d7f722e214134p-13,0x1.06198853fe6f4p-13},
+        {267,0x1.3c287d45ce7e2p-13,0x1.9701630832104p-13},
+        {268,0x1.e6cecd206ffc2p-15,0x1.cf17dbfc95538p-13},
+        {269,-0x1.f8e3966ad270cp-16,0x1.abdde77a21d9ap-13},
+        {270,-0x1.8c5d3460641e6p-14,0x1.435402a081d92p-13},
+        {271,-0x1.06a4b5b3bd54p-13,0x1.75026e152c6cp-14},
+        {272,-0x1.02433c0d75af4p-13,0x1.c11b5df3ad70cp-16},
+        {273,-0x1.99c3d2ee50c52p-14,-0x1.3a330ce9626cp-16},
+        {274,-0x1.05468d403c632p-14,-0x1.6006b3465029ep-15},
+        {275,-0x1.ea87df002b155p-16,-0x1.7add0ba377561p-15},
+        {276,-0x1.9c5ff0b8504b4p-18,-0x1.2a57bc940c318p-15},
+        {277,0x1.56cd94e9598b2p-18,-0x1.6a2f121039fb4p-16},
+        {278,0x1.dcfc8823dba9ap-18,-0x1.4327cf7ac7d12p-17},
+        {279,0x1.2613267802dbdp-18,-0x1.59d9ef7db0f38p-19},
+        {258,0x1.b85f0527e2a9p-19,0x1.7def6d05b8512p-20},
+        {259,0x1.b3f18d857ead9p-18,0x1.c12ba41d78e7dp-18},
+        {260,0x1.c080841ba856cp-18,0x1.194e22df1dd23p-16},
+        {261,-0x1.805a238f2c2eap-22,0x1.f9b79c3412428p-16},
+        {262,-0x1.2d6e10dae72dp-16,0x1.61799350cdf35p-15},
+        {263,-0x1.84c7d7fc7462fp-15,0x1.7dfe146234456p-15},
+        {264,-0x1.533f9871c21afp-14,0x1.1347599b8ea9fp-15},
+        {265,-0x1.d622ff2d177c5p-14,-0x1.5958b60a3d34ap-21},
+        {266,-0x1.0bca2ae1ee402p-13,-0x1.c0f977df0f9a6p-15},
+        {267,-0x1.e8b3fadb161cp-14,-0x1.eb520a92bcc9p-14},
+        {268,-0x1.31da533e4ce32p-14,-0x1.72632be19dfdcp-13},
+        {269,-0x1.6e2fc33b7601p-24,-0x1.c22b83826acb8p-13},
+        {270,0x1.76e0064f10347p-14,-0x1.c6ff602dfb1d1p-13},
+        {271,0x1.7145dc6d3c07p-13,-0x1.73d74a275cb4cp-13},
+        {272,0x1.f5aa31314f289p-13,-0x1.a57b384b76535p-14},
+        {273,0x1.138d9ca443c2bp-12,-0x1.ccdcdc30d57fp-20},
+        {274,0x1.f8cac4fbe2c74p-13,0x1.98ac59df7c118p-14},
+        {275,0x1.76b8c7b392df4p-13,0x1.6f98341c703a3p-13},
+        {276,0x1.83b53c15fb1d1p-14,0x1.c5a687fe07f6cp-13},
+        {277,0x1.6e3dfdd915e43p-19,0x1.c3ab9e42c261ep-13},
+        {278,-0x1.296ff80ecbc06p-14,0x1.75f9a78abb236p-13},
+        {279,-0x1.e4d3dc2deb158p-14,0x1.f455129ee0848p-14},
+        {280,-0x1.0c05544585becp-13,0x1.d1ec34b011b04p-15},
+        {281,-0x1.d9ac6c042662ep-14,0x1.1d121bb47107bp-19},
+        {282,-0x1.581d7cfd34e5p-14,-0x1.0ccf427312d92p-15},
+        {283,-0x1.8df6e56c3dbbep-15,-0x1.7cecd57a715fep-15},
+        {284,-0x1.3a9b60358394p-16,-0x1.63f6703062359p-15},
+        {285,-0x1.99d4fd64b48fep-21,-0x1.00b2ec4f8540ap-15},
+        {286,0x1.ba1f0cb134963p-18,-0x1.20320284767bcp-16},
+        {287,0x1.b922a742b76ccp-18,-0x1.d290cfbdcf05fp-18},
+        {288,0x1.c826c082bce1ep-19,-0x1.99dd71227270dp-20},
+        {266,0x1.82878da837f54p-18,0x1.419f8dde923e7p-18},
+        {267,0x1.e29d678099bbap-18,0x1.bd8ba0394e29cp-17},
+        {268,0x1.90a37a49716a1p-19,0x1.adfe68e4435fdp-16},
+        {269,-0x1.5d7edc48ffc06p-17,0x1.429e2e95fe2fap-15},
+        {270,-0x1.20b4121268532p-15,0x1.7fcf4d0cc2012p-15},
+        {271,-0x1.16f7c5216231dp-14,0x1.5298c2c89b222p-15},
+        {272,-0x1.a1d86dcc9fa12p-14,0x1.165cb88d3f3cp-16},
+        {273,-0x1.024c09194399ep-13,-0x1.c41a30ffa5bap-16},
+        {274,-0x1.07f862c9a8494p-13,-0x1.65f4981a6158fp-14},
+        {275,-0x1.a1cc655eea78ap-14,-0x1.34f30f1d221bbp-13},
+        {276,-0x1.6842af15b37e5p-15,-0x1.9e2effcc0186bp-13},
+        {277,0x1.3698e42d421e8p-15,-0x1.ce963ceaf2a8dp-13},
+        {278,0x1.071f255d8de82p-13,-0x1.b052b42d780e5p-13},
+        {279,0x1.aa4b7edb4d139p-13,-0x1.3fcf2f98a055p-13},
+        {280,0x1.089010316d887p-12,-0x1.1d275b36c169p-14},
+        {281,0x1.11571fbc89ed6p-12,0x1.0182ada945c94p-15},
+        {282,0x1.daa44568b466ap-13,0x1.01d9b61b5e8c8p-13},
+        {283,0x1.4a9e4a2eae9c6p-13,0x1.8e5f9a037a024p-13},
+        {284,0x1.29a194058465p-14,0x1.ccee7ca213aaep-13},
+        {285,-0x1.e17dfd7e5d096p-17,0x1.b8feffd12893ep-13},
+        {286,-0x1.54dc5fd284672p-14,0x1.621e37420eaa2p-13},
+        {287,-0x1.f51ce68ca5b31p-14,0x1.cb39a9ee91bf4p-14},
+        {288,-0x1.0acdcc7c42028p-13,0x1.9362eee6ea362p-15},
+        {289,-0x1.cf289b24c5416p-14,-0x1.1a52091b04579p-19},
+        {290,-0x1.4df2bc1a811e4p-14,-0x1.19f7b7eb79a9fp-15},
+        {291,-0x1.826757644eceep-15,-0x1.7e2dace44943cp-15},
+        {292,-0x1.34d9c30b8f1dbp-16,-0x1.62d8e5ed68d3ap-15},
+        {293,-0x1.f0819c916655bp-21,-0x1.022a5c7d7bda4p-15},
+        {294,0x1.b1a06bd5544cp-18,-0x1.28a0305530adep-16},
+        {295,0x1.c30e5d2f2d384p-18,-0x1.f7320ed9cba4dp-18},
+        {296,0x1.f5cf62d82ff68p-19,-0x1.f0afeb88b1bd5p-20},
+        {273,0x1.dc1e1b3c81f84p-19,0x1.bdf9e960debp-20},
+        {274,0x1.b715185f0f7a3p-18,0x1.cb1ce349b8328p-18},
+        {275,0x1.c6c572b864b8p-18,0x1.11ed2b5ea201p-16},
+        {276,0x1.6fedbfee0c0cdp-21,0x1.e497076dbd294p-16},
+        {277,-0x1.ec8aea701976p-17,0x1.559a38db26d7ap-15},
+        {278,-0x1.4ed74f9267e8cp-15,0x1.81229202511afp-15},
+        {279,-0x1.2d8cbbadc7612p-14,0x1.3e2b95e2e194cp-15},
+        {280,-0x1.b1dd8e47f2cefp-14,0x1.939a4e098ba2cp-17},
+        {281,-0x1.052fabe34116ep-13,-0x1.0f24a0dc9b058p-15},
+        {282,-0x1.06199e3fb2232p-13,-0x1.7919f72892574p-14},
+        {283,-0x1.99bb67c624666p-14,-0x1.3a694a58a9044p-13},
+        {284,-0x1.5e67fec461527p-15,-0x1.9f7b2e6b6645cp-13},
+        {285,0x1.2e1268c1ff709p-15,-0x1.ce65909b7512bp-13},
+        {286,0x1.ffb67f5eb889ap-14,-0x1.b319c5ed4f936p-13},
+        {287,0x1.a0adab343fd8cp-13,-0x1.49cb9e15304ap-13},
+        {288,0x1.05501a7ad2b04p-12,-0x1.432653ec48af4p-14},
+        {289,0x1.12ba134edb35ap-12,0x1.3389821f51aadp-16},
+        {290,0x1.eaec3b87d008ap-13,0x1.cdae948ac716ep-14},
+        {291,0x1.68987258066a2p-13,0x1.7a34899758644p-13},
+        {292,0x1.77e2be540e36p-14,0x1.c6ca54e9f674ep-13},
+        {293,0x1.416a9573d53f4p-18,0x1.c49b600608fep-13},
+        {294,-0x1.14da34981b82ap-14,0x1.7e2ebe031b247p-13},
+        {295,-0x1.d392ed1eb37fbp-14,0x1.0c121d3b660ap-13},
+        {296,-0x1.0c04652b939aap-13,0x1.19bd3c5df2638p-14},
+        {297,-0x1.f0f0920c020b9p-14,0x1.c8190878bb7b6p-17},
+        {298,-0x1.82972a726b272p-14,-0x1.93dc60e11ebd7p-16},
+        {299,-0x1.f237b8bfa64a8p-15,-0x1.679232d4f5ee4p-15},
+        {300,-0x1.ec031294af17ep-16,-0x1.7ad1957f6cde6p-15},
+        {301,-0x1.01806041666a7p-17,-0x1.33a8f07acf6e6p-15},
+        {302,0x1.0929b1ec0685ep-18,-0x1.92054012b6923p-16},
+        {303,0x1.e591cf2b1ba8bp-18,-0x1.9b6cffc3d4cebp-17},
+        {304,0x1.74f514d38b8cp-18,-0x1.2642e9ab11304p-18},
+        {281,0x1.a4658bb51d8b5p-19,0x1.5af776cb04ddep-20},
+        {282,0x1.9e7ba1041e573p-18,0x1.8262ac2b654bp-18},
+        {283,0x1.dc95d2156f47cp-18,0x1.df22c2ef78b7ap-17},
+        {284,0x1.6880f96f5fc65p-19,0x1.b5d2065c65cb7p-16},
+        {285,-0x1.50179ea502d6ap-17,0x1.4081dbfd74ebdp-15},
+        {286,-0x1.0e04bf20a8933p-15,0x1.7dfa7369d4138p-15},
+        {287,-0x1.03ba8de7ed459p-14,0x1.60b8dbfdd293fp-15},
+        {288,-0x1.88d889e8e4814p-14,0x1.7c794d7471e0bp-16},
+        {289,-0x1.f26edfb649dc9p-14,-0x1.e674f5eaa2606p-17},
+        {290,-0x1.0c0596d87e68p-13,-0x1.174eb17cd7f96p-14},
+        {291,-0x1.d86cd07a0a49p-14,-0x1.0727c199e4d93p-13},
+        {292,-0x1.2572a09f48384p-14,-0x1.777359f101132p-13},
+        {293,-0x1.8623732b43342p-19,-0x1.c0690ce601e0ep-13},
+        {294,0x1.4a17cfe59d9ccp-14,-0x1.cabf4427d22eap-13},
+        {295,0x1.4fb14487b348p-13,-0x1.8b148563f9fa5p-13},
+        {296,0x1.d7976e17c7d2ap-13,-0x1.0643d9022f32ep-13},
+        {297,0x1.0ff53a8db1bf6p-12,-0x1.45ab3a4cea6bap-15},
+        {298,0x1.0c71e456bc3eap-12,0x1.ca8fac72e3642p-15},
+        {299,0x1.c40ec03ab0ap-13,0x1.2152131154e0dp-13},
+        {300,0x1.33dd063a92dp-13,0x1.9b51d569c052ap-13},
+        {301,0x1.0d58f172ec116p-14,0x1.ce1dc9e83e078p-13},
+        {302,-0x1.09b348aa931d3p-16,0x1.b7c86cfe8af8p-13},
+        {303,-0x1.4c47a30fdb3fep-14,0x1.6628f4a32ed1bp-13},
+        {304,-0x1.eb849bd11dd5fp-14,0x1.e3d480336a3d2p-14},
+        {305,-0x1.0c050aa2ca45cp-13,0x1.dcea96b4b8ca4p-15},
+        {306,-0x1.e3ff79b834d22p-14,0x1.ce307c611281fp-18},
+        {307,-0x1.72c7ab5def562p-14,-0x1.c9b535f4293ddp-16},
+        {308,-0x1.d9a5e502b825ep-15,-0x1.6e4deedbd2134p-15},
+        {309,-0x1.d14db43e21dd2p-16,-0x1.787470caf3f8ap-15},
+        {310,-0x1.e028c0f1b943p-18,-0x1.3084b7674f87cp-15},
+        {311,0x1.0a4ee3f4235c6p-18,-0x1.91719fc2d6d55p-16},
+        {312,0x1.e523a828c8c5ep-18,-0x1.a46ef0f9109e4p-17},
+        {313,0x1.7ffc0a654f98fp-18,-0x1.3bfa711628ed6p-18},
+        {314,0x1.5b5989fb17a1p-19,-0x1.db45e82511838p-21},
+        {289,0x1.57ef9ee8752c7p-18,0x1.e5eccb6dfe461p-19},
+        {290,0x1.e201020b6fc3ap-18,0x1.5bc118c3bb99ep-17},
+        {291,0x1.6d3ed6ded776dp-18,0x1.5c758fd8c929bp-16},
+        {292,-0x1.9e9e8ecc9364p-19,0x1.1471619d9bec5p-15},
+        {293,-0x1.5665190830692p-16,0x1.68a228a06596ap-15},
+        {294,-0x1.83a79f42dad56p-15,0x1.7dd59c70559b5p-15},
+        {295,-0x1.430e5c284b38cp-14,0x1.26d365dcdff03p-15},
+        {296,-0x1.bd6d96329e95p-14,0x1.17ba656a21b82p-17},
+        {297,-0x1.064772894cae1p-13,-0x1.23f164bca47ap-15},
+        {298,-0x1.06338416701bep-13,-0x1.774aa97502fb5p-14},
+        {299,-0x1.a416ed9f23dd6p-14,-0x1.3317a52d5fe4ap-13},
+        {300,-0x1.9ef98ee1dec4p-15,-0x1.960c3456d3f8cp-13},
+        {301,0x1.6f1fbb49f3be8p-16,-0x1.cb360fd33defep-13},
+        {302,0x1.b014bcbaca72ep-14,-0x1.bffb14ec229p-13},
+        {303,0x1.7843bb0a98a04p-13,-0x1.6e180679475ep-13},
+        {304,0x1.ef69a256c09b2p-13,-0x1.bccbba701e2b2p-14},
+        {305,0x1.129e4d8c15324p-12,-0x1.3dce472537576p-16},
+        {306,0x1.0744ecc7e7p-12,0x1.2c04dfa3a5066p-14},
+        {307,0x1.b00eb0cfc1998p-13,0x1.393b1ef85feap-13},
+        {308,0x1.1d3ebebd3acf3p-13,0x1.a69434a49ee82p-13},
+        {309,0x1.cd27dab3e50a4p-15,0x1.cf103a7f36c02p-13},
+        {310,-0x1.7134cb85ef0e8p-16,0x1.b2d559b6000fdp-13},
+        {311,-0x1.58cc7d21d1506p-14,0x1.5ff36927fd3a7p-13},
+        {312,-0x1.eebefb299844ep-14,0x1.db7f836647071p-14},
+        {313,-0x1.0bf2955b0f7d2p-13,0x1.d943189ed6ccp-15},
+        {314,-0x1.e585af0f85e8ap-14,0x1.00fdbc350cabcp-17},
+        {315,-0x1.7860b8c7cc026p-14,-0x1.b6ebec66239cap-16},
+        {316,-0x1.ebea695ba6b2ep-15,-0x1.69408b5e97426p-15},
+        {317,-0x1.f9eda4065f223p-16,-0x1.7bc2a3d0139adp-15},
+        {318,-0x1.3243a9a96806cp-17,-0x1.3bc8a2a8a6611p-15},
+        {319,0x1.8481dc18b545cp-19,-0x1.b0469f5c01207p-16},
+        {320,0x1.dc9d85b056272p-18,-0x1.df09e34f888fap-17},
+        {321,0x1.a2c3ec072051fp-18,-0x1.8d8f30cca1b04p-18},
+        {322,0x1.bad4034ef0da7p-19,-0x1.80988eeaa99f1p-20},
+        {298,0x1.428e0398b8f16p-18,0x1.a47898820b0edp-19},
+        {299,0x1.d989e7526d2a8p-18,0x1.34c7d618ff6e4p-17},
+        {300,0x1.9ba58468af498p-18,0x1.3baa5c8b2c6d8p-16},
+        {301,-0x1.87583bf6b2ce9p-21,0x1.0039c5d47c07cp-15},
+        {302,-0x1.0607f19405414p-16,0x1.5910c71dc67f6p-15},
+        {303,-0x1.457eb7b1ba701p-15,0x1.80f8651e7ff4ap-15},
+        {304,-0x1.1ca0853ef0843p-14,0x1.4d76e3e4725acp-15},
+        {305,-0x1.98d8b829955b6p-14,0x1.3c09f14a6025p-16},
+        {306,-0x1.f7e4440c87ae4p-14,-0x1.2cbbb6dad689ap-16},
+        {307,-0x1.0bd8f5e6076e3p-13,-0x1.1bc19e580b654p-14},
+        {308,-0x1.dca5d5bae9e7p-14,-0x1.0293688621b42p-13},
+        {309,-0x1.3a9113b507de6p-14,-0x1.6e390e1b4d7bap-13},
+        {310,-0x1.d6f17cd60c3fep-17,-0x1.b9004ad7054c8p-13},
+        {311,0x1.024a79ca69cf9p-14,-0x1.ce613526dda76p-13},
+        {312,0x1.256cc8d5ccd64p-13,-0x1.a2999c8ef9ddp-13},
+        {313,0x1.b273ad85b0c9fp-13,-0x1.366de0fcf06fp-13},
+        {314,0x1.06e6aaf23d0bep-12,-0x1.2ffd7d2fccc2ap-14},
+        {315,0x1.12e37dea51376p-12,0x1.fb4dfadfd4b4ap-17},
+        {316,0x1.f5aadd54d3aadp-13,0x1.a435608b32042p-14},
+        {317,0x1.86e5c81549cdp-13,0x1.61cd75e8c7abbp-13},
+        {318,0x1.dd79e9c480628p-14,0x1.b906539ed327p-13},
+        {319,0x1.24ded77ddca36p-15,0x1.ce11a08b30f04p-13},
+        {320,-0x1.3570b8f808204p-15,0x1.a4ae9e5a58e02p-13},
+        {321,-0x1.7d1cb59b8b1b8p-14,0x1.4c24834c7555cp-13},
+        {322,-0x1.fc11fdda7cd72p-14,0x1.b582e73f5e0acp-14},
+        {323,-0x1.0af79ccac97b7p-13,0x1.a088055306aa8p-15},
+        {324,-0x1.dd04b4a8019ccp-14,0x1.f6576cb1d77d8p-19},
+        {325,-0x1.7030f0c1b06d7p-14,-0x1.d1765963cc49dp-16},
+        {326,-0x1.e32cf0271927ep-15,-0x1.6b9b707eaae38p-15},
+        {327,-0x1.f8abdc5df2f31p-16,-0x1.7b9a76877e4e4p-15},
+        {328,-0x1.41d5d692c4426p-17,-0x1.3e36d5faf09f4p-15},
+        {329,0x1.45aa49cb7796bp-19,-0x1.bc5c9fbfc22c4p-16},
+        {330,0x1.d44e6752b9adfp-18,-0x1.fe1148647c34dp-17},
+        {331,0x1.b4e4bb018b0fap-18,-0x1.c31fa75ae1983p-18},
+        {332,0x1.fb1b066bc45e2p-19,-0x1.f98a28c8ef794p-20},
+        {306,0x1.0c805e7771377p-18,0x1.1c2e328b717e1p-19},
+        {307,0x1.baee86a296f23p-18,0x1.d769bfcad2c68p-18},
+        {308,0x1.d269cef79aa1cp-18,0x1.0203e7c36ab9p-16},
+        {309,0x1.4ff41aca8c226p-19,0x1.ba5def6cff488p-16},
+        {310,-0x1.2ddfa786943bbp-17,0x1.3afcd7a8702a3p-15},
+        {311,-0x1.de8c0bc6fe94bp-16,0x1.7978599385966p-15},
+        {312,-0x1.cc65c56523624p-15,0x1.714a04e0d456cp-15},
+        {313,-0x1.6170707a91d92p-14,0x1.fe037c32fa33dp-16},
+        {314,-0x1.cf848ad020c56p-14,0x1.e6f7c6be54a5ep-20},
+        {315,-0x1.0897a9c97158cp-13,-0x1.56fcc8da4dfc5p-15},
+        {316,-0x1.0473996d1f282p-13,-0x1.866e32d39f676p-14},
+        {317,-0x1.a300dc6cb472p-14,-0x1.33aed10a44fb8p-13},
+        {318,-0x1.b95282f1dcb99p-15,-0x1.91cc570802f22p-13},
+        {319,0x1.c3d0046ae1142p-17,-0x1.c8352ccd49e8bp-13},
+        {320,0x1.777624ee4026cp-14,-0x1.c69a4d72aca06p-13},
+        {321,0x1.571c908f52d1p-13,-0x1.8613651301d4fp-13},
+        {322,0x1.d3c89149573bp-13,-0x1.0b8fc1e9ded32p-13},
+        {323,0x1.0da986ae8ae02p-12,-0x1.9e572b743c4b2p-15},
+        {324,0x1.10431bfef7f2fp-12,0x1.330ea07135a4ep-15},
+        {325,0x1.e26a0a12ea41ap-13,0x1.e9ed6e193065p-14},
+        {326,0x1.6c7d89487c771p-13,0x1.770a7b749673ap-13},
+        {327,0x1.a825381d69efp-14,0x1.c0ec8759730d6p-13},
+        {328,0x1.9bf78894b3f2p-16,0x1.cbd81d170a84bp-13},
+        {329,-0x1.6e76bf9f15bd2p-15,0x1.9d05422394c5p-13},
+        {330,-0x1.8b17276c7537ep-14,0x1.4396d3bded6ddp-13},
+        {331,-0x1.ffd36acac9959p-14,0x1.a8ede808dc996p-14},
+        {332,-0x1.0aa6ced007b82p-13,0x1.953ecda503d86p-15},
+        {333,-0x1.dd0a384e69ab1p-14,0x1.fc55ddd434be7p-19},
+        {334,-0x1.739b1bcefd6f8p-14,-0x1.c623cf655d94p-16},
+        {335,-0x1.f0fe1dd8dc79cp-15,-0x1.6792eb82bd00ap-15},
+        {336,-0x1.0d75b1767729p-15,-0x1.7dbb52dc73996p-15},
+        {337,-0x1.7f6aa8e5c6816p-17,-0x1.4757f582f333cp-15},
+        {338,0x1.538329f8eae98p-20,-0x1.d7cd43d665b78p-16},
+        {339,0x1.be49c0804ef96p-18,-0x1.1ba74cd490835p-16},
+        {340,0x1.cc281742774d6p-18,-0x1.0ea5575825ca5p-17},
+        {341,0x1.2a645078b008cp-18,-0x1.62d7c11d061d4p-19},
+        {315,0x1.3e73e362cd26ep-18,0x1.982f442c3cfefp-19},
+        {316,0x1.d343429b9b4d6p-18,0x1.20c33135cabdbp-17},
+        {317,0x1.b69d234890db2p-18,0x1.23a10a7a56c58p-16},
+        {318,0x1.290fd2a2a6b92p-20,0x1.db3c2a90bd52ep-16},
+        {319,-0x1.79bc086f6a816p-17,0x1.467dcf1d22637p-15},
+        {320,-0x1.05b0c66ec6fbdp-15,0x1.7cbf70fedefcep-15},
+        {321,-0x1.e0d8e464e19a5p-15,0x1.6c0e538d7c811p-15},
+        {322,-0x1.6846e8b1456bcp-14,0x1.e97da938deaeep-16},
+        {323,-0x1.d21f595fb6582p-14,0x1.97c3f855e333ap-21},
+        {324,-0x1.0890f2eca4887p-13,-0x1.57649bfa8d86p-15},
+        {325,-0x1.051a388407e0fp-13,-0x1.8040dc740c87ep-14},
+        {326,-0x1.ab10a4a6a80d6p-14,-0x1.2dc27b4ddccf2p-13},
+        {327,-0x1.e0bd1d082a22ep-15,-0x1.8b33b78f7dae2p-13},
+        {328,0x1.6fb368fefc1e7p-18,-0x1.c4a8d90d3db09p-13},
+        {329,0x1.4a8c39ad0428cp-14,-0x1.ca7b4922c16ebp-13},
+        {330,0x1.3eaa8aaf04c3ap-13,-0x1.95101ad222632p-13},
+        {331,0x1.bf14b123b0732p-13,-0x1.2739e6169c3b1p-13},
+        {332,0x1.0868d319d727p-12,-0x1.1cc3d3620289p-14},
+        {333,0x1.12d4119386bc9p-12,0x1.fb0fdea902e1fp-17},
+        {334,0x1.f9ec6a8e3565ep-13,0x1.9207384beb9bcp-14},
+        {335,0x1.954d90749d9f8p-13,0x1.548c9beba14a3p-13},
+        {336,0x1.0928a6d8ca9f2p-13,0x1.af21b91cb62p-13},
+        {337,0x1.b334ccd276b7dp-15,0x1.cf05058d7f594p-13},
+        {338,-0x1.3b033384751a1p-16,0x1.b547db74b5538p-13},
+        {339,-0x1.3d7277d8da27bp-14,0x1.6cc8a16ab2b08p-13},
+        {340,-0x1.d7fbb90174e26p-14,0x1.072aa05e63b19p-13},
+        {341,-0x1.0b148ce2d54e9p-13,0x1.3142e86ea59c8p-14},
+        {342,-0x1.009fbf0601378p-13,0x1.9d21c8dbb58b9p-16},
+        {343,-0x1.af7cd561c8d7ap-14,-0x1.a74de0efc4d28p-17},
+        {344,-0x1.3d696fee96739p-14,-0x1.2ce60dabeaf75p-15},
+        {345,-0x1.8db07d6f6d6b5p-15,-0x1.7c6eb3d6234afp-15},
+        {346,-0x1.8534d0d14fa26p-16,-0x1.6f85454ca56b3p-15},
+        {347,-0x1.8e98be011acbp-18,-0x1.28b727015fa94p-15},
+        {348,0x1.fa795dbf7e8b4p-19,-0x1.97375b609722cp-16},
+        {349,0x1.df555b6cc70bp-18,-0x1.d238237298ddcp-17},
+        {350,0x1.aa37158a008acp-18,-0x1.a1bdf2bf75b97p-18},
+        {351,0x1.f2cf1af55de87p-19,-0x1.e7c5463ad8b91p-20},
+        {324,0x1.0df37b8ebb862p-18,0x1.1ecfcc519f69ep-19},
+        {325,0x1.b48c465943afep-18,0x1.c13b20839c0f6p-18},
+        {326,0x1.dc3603aec060ap-18,0x1.e0f82187f67bcp-17},
+        {327,0x1.eac264ba4ef23p-19,0x1.9aa9348f29fc7p-16},
+        {328,-0x1.856c3b91e5e81p-18,0x1.27c7142927879p-15},
+        {329,-0x1.77861a46fec18p-16,0x1.6d8a7ed4edfcep-15},
+        {330,-0x1.7e6ff51b41cfcp-15,0x1.7e0bd11b00c14p-15},
+        {331,-0x1.31ba1c47218d9p-14,0x1.394930f5ffa38p-15},
+        {332,-0x1.a24fbb99283aap-14,0x1.119e0b8cf35fcp-16},
+        {333,-0x1.f7de68182d839p-14,-0x1.2f2eb72b8ee9ep-16},
+        {334,-0x1.0bf74daeaa746p-13,-0x1.09ff8c6ca952cp-14},
+        {335,-0x1.eca65b31d8a3bp-14,-0x1.dfb8e310ef6a3p-14},
+        {336,-0x1.6abe3b33227aap-14,-0x1.564382792f2ecp-13},
+        {337,-0x1.2bcd0d844c395p-15,-0x1.a5b39e1b98a94p-13},
+        {338,0x1.f6d0902b0f48dp-16,-0x1.cd0085e8f4f9cp-13},
+        {339,0x1.ad79d7a1941b3p-14,-0x1.c01522281eae4p-13},
+        {340,0x1.66f45faf3d016p-13,-0x1.7af4f4c229ba3p-13},
+        {341,0x1.d94061dac3b1ap-13,-0x1.0336ff8f7e6a8p-13},
+        {342,0x1.0d9a33f7aeaaep-12,-0x1.9e21e730575b2p-15},
+        {343,0x1.10f6816c03519p-12,0x1.0b116b7a43aaep-15},
+        {344,0x1.ec4bb52f185d5p-13,0x1.c73f3a71ee32ap-14},
+        {345,0x1.83321c81b944ep-13,0x1.64bf477571327p-13},
+        {346,0x1.ef5ccb9be505ep-14,0x1.b5bd9bd3032p-13},
+        {347,0x1.7e1e433953a12p-15,0x1.ceea9f6cf0e88p-13},
+        {348,-0x1.78419b579f1bp-16,0x1.b23b4f6085e7p-13},
+        {349,-0x1.42e457a1f3d3ap-14,0x1.6a36e4df9151ap-13},
+        {350,-0x1.d7cc14cca16f6p-14,0x1.073bf77ca719cp-13},
+        {351,-0x1.0ac03875ae91ep-13,0x1.37aa47e63fdc4p-14},
+        {352,-0x1.022779d7fa6b7p-13,0x1.c8011b98e9e8p-16},
+        {353,-0x1.b83cd7e4ed539p-14,-0x1.4c566a20d2038p-17},
+        {354,-0x1.4b4809ac490f2p-14,-0x1.1c6b410a8240fp-15},
+        {355,-0x1.ae99f7d45323bp-15,-0x1.774bf965f027ap-15},
+        {356,-0x1.c3fb9f81e05d2p-16,-0x1.76de13a82a50ep-15},
+        {357,-0x1.276c41d5e3899p-17,-0x1.39d8a9db94aaep-15},
+        {358,0x1.221e5b1c13cfp-19,-0x1.c2c409d06401cp-16},
+        {359,0x1.c5fcf8163988cp-18,-0x1.12cce317bb5c2p-16},
+        {360,0x1.cccaeb9d338b2p-18,-0x1.0fd5d8e8b4bb8p-17},
+        {361,0x1.36a76af130442p-18,-0x1.825a92dddd4dap-19},
+        {334,0x1.2fab8ec5141e6p-18,0x1.6f792e167c917p-19},
+        {335,0x1.c5ff86ece50fdp-18,0x1.007dc5099128p-17},
+        {336,0x1.d1b01631c9172p-18,0x1.031cb547c7626p-16},
+        {337,0x1.9c62c150f97f6p-19,0x1.ab316d14acd05p-16},
+        {338,-0x1.bb40dd088851cp-18,0x1.2ce1b6749daccp-15},
+        {339,-0x1.821fa0f81022cp-16,0x1.6ef9663f8089p-15},
+        {340,-0x1.7ec3a8066ec55p-15,0x1.7decbf72080bbp-15},
+        {341,-0x1.2e6a27b4f78bfp-14,0x1.3c806906c26eap-15},
+        {342,-0x1.9c41af8eb1aa8p-14,0x1.2bec2871778f5p-16},
+        {343,-0x1.f21937e4b7628p-14,-0x1.e9b65ccee1e65p-17},
+        {344,-0x1.0bd0b5b60f05ap-13,-0x1.e428c2a42c799p-15},
+        {345,-0x1.f8277e5ffe3e2p-14,-0x1.c029a9f037b2ep-14},
+        {346,-0x1.87c9e3b9763f8p-14,-0x1.455fdd86e77e2p-13},
+        {347,-0x1.8f085ee76e836p-15,-0x1.981cb4964b7a4p-13},
+        {348,0x1.c85a115b89756p-17,-0x1.c8125ce1115a6p-13},
+        {349,0x1.5cd064641516p-14,-0x1.c8e513ed75502p-13},
+        {350,0x1.3eb389320aa89p-13,-0x1.94e399309ab2ep-13},
+        {351,0x1.b8c508ea9483ep-13,-0x1.2eaf4e30322f6p-13},
+        {352,0x1.0521d91780c0ap-12,-0x1.429c233b870f3p-14},
+        {353,0x1.134a15fa3f9b6p-12,0x1.72f28cb311b2cp-21},
+        {354,0x1.04a3192b69d9dp-12,0x1.4804e35033f3ap-14},
+        {355,0x1.b6f1a40aa1297p-13,0x1.30d7e56e6a9d5p-13},
+        {356,0x1.3c51c59d02727p-13,0x1.963e9ee456d72p-13},
+        {357,0x1.57a3b3e8f61a8p-14,0x1.c953d5cce9678p-13},
+        {358,0x1.a16238dab118ep-17,0x1.c79cb1c2b52d2p-13},
+        {359,-0x1.96f6a4e8a31edp-15,0x1.96ecdc909530ep-13},
+        {360,-0x1.8a740934113a5p-14,0x1.43b81651d5b3p-13},
+        {361,-0x1.f9607e3a2b09p-14,0x1.bc8275b710f5p-14},
+        {362,-0x1.0bc230a04c506p-13,0x1.dd48a29df26e5p-15},
+        {363,-0x1.f0f2be9e2cdc5p-14,0x1.d35a62d5e917p-17},
+        {364,-0x1.9a7a476c4904p-14,-0x1.3390ae5e00b6bp-16},
+        {365,-0x1.2c6e4d69a1726p-14,-0x1.3e771dbf8c0bep-15},
+        {366,-0x1.7b1a651a24605p-15,-0x1.7e465cc2c26e9p-15},
+        {367,-0x1.7c5eade25d2p-16,-0x1.6e2ba7802363bp-15},
+        {368,-0x1.ac22a57f58206p-18,-0x1.2b76005e161f2p-15},
+        {369,0x1.ab85aa03630e1p-19,-0x1.a8179f120d896p-16},
+        {370,0x1.d36a8b4ce00d4p-18,-0x1.007452f7aef3ap-16},
+        {371,0x1.c4322c450289p-18,-0x1.f98f2baf00c4ep-18},
+        {372,0x1.2c8a68c3b994ep-18,-0x1.6760c02708bdcp-19},
+        {344,0x1.c6d392c60475bp-19,0x1.92cc6921533cbp-20},
+        {345,0x1.8bfb2d6280102p-18,0x1.544005161413cp-18},
+        {346,0x1.e5a2491a1314p-18,0x1.7c888ba194d4cp-17},
+        {347,0x1.7d34d2d104252p-18,0x1.51cedf22a35a6p-16},
+        {348,-0x1.25553980cc16p-21,0x1.fca9bd4064546p-16},
+        {349,-0x1.ac825dace690ap-17,0x1.4d45adfa85b08p-15},
+        {350,-0x1.06a89e98e4d88p-15,0x1.7ca6ab88552b4p-15},
+        {351,-0x1.cda2d05653192p-15,0x1.709a0609f01e7p-15},
+        {352,-0x1.5456822a1018cp-14,0x1.1083c6abd10ccp-15},
+        {353,-0x1.b9febe38d91bep-14,0x1.37593fadad59ap-17},
+        {354,-0x1.010a31de5cb0ap-13,-0x1.abe7a9f1d1d13p-16},
+        {355,-0x1.0b6cf4fe2be8p-13,-0x1.22e91dee1d81ap-14},
+        {356,-0x1.e70f6d694dda3p-14,-0x1.ecb0f43dbd598p-14},
+        {357,-0x1.6a44732a3d2fep-14,-0x1.5656c7b78ed16p-13},
+        {358,-0x1.47e6cdffec48cp-15,-0x1.a1f7be0dc5a59p-13},
+        {359,0x1.6dc1ae098290ep-16,-0x1.cacf91d18597fp-13},
+        {360,0x1.77ee06d44e104p-14,-0x1.c649653542176p-13},
+        {361,0x1.46f39cb056ff2p-13,-0x1.8ff510e95408p-13},
+        {362,0x1.bbe30d7e3e474p-13,-0x1.2ad1fdc235fe8p-13},
+        {363,0x1.0519e57484cc2p-12,-0x1.4284659e45748p-14},
+        {364,0x1.133f1c89af99bp-12,-0x1.cbbf83178a82cp-20},
+        {365,0x1.064b01a7b561dp-12,0x1.350d666d8895p-14},
+        {366,0x1.c04dbf4400265p-13,0x1.255db62a2862cp-13},
+        {367,0x1.4cc3af65605e7p-13,0x1.8c65c09c6fe36p-13},
+        {368,0x1.84babd56a7d37p-14,0x1.c4eeb13d4a411p-13},
+        {369,0x1.9eefb7fb511f7p-16,0x1.cba1ed66d22e4p-13},
+        {370,-0x1.333dfb11e732ep-15,0x1.a49f8986494a2p-13},
+        {371,-0x1.62ec8cfc3fb14p-14,0x1.5a416839213fcp-13},
+        {372,-0x1.e3294bb4419b4p-14,0x1.f5acc52fa2df8p-14},
+        {373,-0x1.0b2410aa616e3p-13,0x1.2bb35091e9c76p-14},
+        {374,-0x1.021fad70e00e3p-13,0x1.c9e695cc533c6p-16},
+        {375,-0x1.be008e1c2c0f4p-14,-0x1.0b4d4ae492858p-17},
+        {376,-0x1.592f3f1cce046p-14,-0x1.09ff1ee9172e7p-15},
+        {377,-0x1.d73085fb5f7eap-15,-0x1.6e43b2f9083f6p-15},
+        {378,-0x1.0eb814b81c6f4p-15,-0x1.7d953bf21de03p-15},
+        {379,-0x1.c3cbca2f66152p-17,-0x1.50420fd787215p-15},
+        {380,-0x1.00bb556c1480ap-20,-0x1.0226844219638p-15},
+        {381,0x1.721705d52c02p-18,-0x1.592115ff6b415p-16},
+        {382,0x1.e606ead8499d1p-18,-0x1.8807bc312837cp-17},
+        {383,0x1.926def1bb23ecp-18,-0x1.6305feb3f39fp-18},
+        {384,0x1.d68654e680adbp-19,-0x1.af7992f1891afp-20},
+        {353,0x1.8520d1a74b778p-19,0x1.26061924dce5bp-20},
+        {354,0x1.6ae7393ec6eaap-18,0x1.11e7d92353096p-18},
+        {355,0x1.dd1f8d602a24ep-18,0x1.4120962bfd5f9p-17},
+        {356,0x1.b3476dfe95a72p-18,0x1.26cd30f332656p-16},
+        {357,0x1.f4e1ab22c093ap-20,0x1.c9ae45393c186p-16},
+        {358,-0x1.1172339d338e3p-17,0x1.36077f0a2be3cp-15},
+        {359,-0x1.95edf6c513d24p-16,0x1.7175cf49787bp-15},
+        {360,-0x1.7f6b055e06822p-15,0x1.7dae64429bb9cp-15},
+        {361,-0x1.285ee2ed705cap-14,0x1.422178c4db673p-15},
+        {362,-0x1.90f8313d88ba4p-14,0x1.5a06f3acd0c5cp-16},
+        {363,-0x1.e688a9fb52788p-14,-0x1.1bfd236470bdap-17},
+        {364,-0x1.0a3df1e6b4cabp-13,-0x1.8e9d1359809fep-15},
+        {365,-0x1.043413b95a4c4p-13,-0x1.86487b312af3ep-14},
+        {366,-0x1.b60ab5f32bcd4p-14,-0x1.24f11d24ea106p-13},
+        {367,-0x1.1aa3712272f94p-14,-0x1.7b426d6378f34p-13},
+        {368,-0x1.f721ce8f19fb6p-17,-0x1.b7e8bc326df98p-13},
+        {369,0x1.923904a639d56p-15,-0x1.cec829c156749p-13},
+        {370,0x1.e01d512df7b4cp-14,-0x1.b82ccc9ef68eap-13},
+        {371,0x1.71e9b325de188p-13,-0x1.7280efe882922p-13},
+        {372,0x1.d9226e848414cp-13,-0x1.0303433abda1dp-13},
+        {373,0x1.0bd84c3d45cd1p-12,-0x1.d52c0c5e02ef2p-15},
+        {374,0x1.127176fe9f64cp-12,0x1.32d7ee4c5c01ep-16},
+        {375,0x1.fedfcb3b1773p-13,0x1.7addee48101dep-14},
+        {376,0x1.aaf79a488c512p-13,0x1.3e2a558822992p-13},
+        {377,0x1.34b894009bf52p-13,0x1.9a491a322f958p-13},
+        {378,0x1.57e5fbb4b328ap-14,0x1.c92b70d5a95bep-13},
+        {379,0x1.1092bc628ba5p-16,0x1.c8edac5bf8d78p-13},
+        {380,-0x1.62c2e84299b07p-15,0x1.9e4be465cf1acp-13},
+        {381,-0x1.6f7de9cfbd2a6p-14,0x1.5364e4c179b98p-13},
+        {382,-0x1.e787a809f9b86p-14,0x1.eb5061c15e49ep-14},
+        {383,-0x1.0b42f61e9a17p-13,0x1.26c11920c619cp-14},
+        {384,-0x1.021c1bf7df36cp-13,0x1.cac33de62dc5p-16},
+        {385,-0x1.c05e0196adefep-14,-0x1.df304aa815cb8p-18},
+        {386,-0x1.5ef135a49cbbep-14,-0x1.01d05b83c04c6p-15},
+        {387,-0x1.e85576e54cdf5p-15,-0x1.6991c8845c498p-15},
+        {388,-0x1.2236a0b1e45e4p-15,-0x1.7f3c7cce68d54p-15},
+        {389,-0x1.05b120e4e2abdp-16,-0x1.58ac7111c0bd8p-15},
+        {390,-0x1.5169941d8f5a2p-19,-0x1.0f92956fa21fep-15},
+        {391,0x1.3d136fb1ed8c1p-18,-0x1.77ead6b571fc8p-16},
+        {392,0x1.e25b54dcae9f5p-18,-0x1.c0c2776f874ep-17},
+        {393,0x1.b1edb84d10f56p-18,-0x1.b7fcff094914fp-18},
+        {394,0x1.19ffbb6bf5c1cp-18,-0x1.39449b51e1304p-19},
+        {365,0x1.e9869f1aef8ebp-19,0x1.d27f5ca459d09p-20},
+        {366,0x1.91be16e5247c5p-18,0x1.60e75ccd8b25cp-18},
+        {367,0x1.e56ce47a9ab32p-18,0x1.776d5d441742ap-17},
+        {368,0x1.8f189cf9155aap-18,0x1.4515241cbefd8p-16},
+        {369,0x1.5091dd5b69e9p-21,0x1.e527cd9eb6448p-16},
+        {370,-0x1.4c654ebf58158p-17,0x1.3f8417db1000ep-15},
+        {371,-0x1.b5c6f4fd32ddcp-16,0x1.751b29e276836p-15},
+        {372,-0x1.8c9f7ec2bdca8p-15,0x1.7c186a9509e68p-15},
+        {373,-0x1.2bfcc6628e871p-14,0x1.3e7bffe9e13e6p-15},
+        {374,-0x1.911393ef93489p-14,0x1.591daf9720fd5p-16},
+        {375,-0x1.e4509bf2df2cbp-14,-0x1.f2622dd2b0deep-18},
+        {376,-0x1.09833595f26d2p-13,-0x1.7818d1db08548p-15},
+        {377,-0x1.0628f3504afefp-13,-0x1.73859574c08e9p-14},
+        {378,-0x1.c48077965470ap-14,-0x1.18ce376964f32p-13},
+        {379,-0x1.37fd7361d9278p-14,-0x1.6ecf6b76bb6fcp-13},
+        {380,-0x1.b487efed0a8cdp-16,-0x1.aed1998dbb598p-13},
+        {381,0x1.1726311692b6p-15,-0x1.cd591fd578d2bp-13},
+        {382,0x1.990fa31daac1ap-14,-0x1.c26c3005abdb4p-13},
+        {383,0x1.4e72855090642p-13,-0x1.8b2bbed88a274p-13},
+        {384,0x1.bbd3f45b1627ap-13,-0x1.2aa8b414ba61ep-13},
+        {385,0x1.036eec795180fp-12,-0x1.5385e3e61ef3ap-14},
+        {386,0x1.12ec0eb3929a8p-12,-0x1.60d32e9450662p-17},
+        {387,0x1.0a592c3ae6b97p-12,0x1.003e875ecc7edp-14},
+        {388,0x1.d5ad5e528ebdp-13,0x1.080b89a471ceep-13},
+        {389,0x1.70fd2037f9594p-13,0x1.731c7c07e704ep-13},
+        {390,0x1.e6e904257fe12p-14,0x1.b6ed47b34df78p-13},
+        {391,0x1.b1ea588aba214p-15,0x1.ceae6fa17d6e9p-13},
+        {392,-0x1.45694406b2b8ep-17,0x1.bb91580635a84p-13},
+        {393,-0x1.02f86814d8a5ap-14,0x1.843739428d121p-13},
+        {394,-0x1.a2b2c25bac93cp-14,0x1.33498d4ec73eep-13},
+        {395,-0x1.fe828ad30267p-14,0x1.ab0fc99a7745ap-14},
+        {396,-0x1.0b9cf890cbbc7p-13,0x1.deb0da3066735p-15},
+        {397,-0x1.f673b08b52064p-14,0x1.243d18c47ba36p-16},
+        {398,-0x1.abe8cb2058f43p-14,-0x1.c58c2c0d365fcp-17},
+        {399,-0x1.4a1b6746c9b3fp-14,-0x1.1d413b9d95b32p-15},
+        {400,-0x1.c6072b1e77ac2p-15,-0x1.722276aec626ep-15},
+        {401,-0x1.0aaedcff71939p-15,-0x1.7cfa1d2b7ffb8p-15},
+        {402,-0x1.d6bde11b795cp-17,-0x1.527c7907a3472p-15},
+        {403,-0x1.f285be2c2a1f9p-20,-0x1.0a0a442989109p-15},
+        {404,0x1.477bf99994e04p-18,-0x1.723e8cc96d7ap-16},
+        {405,0x1.e276208ec3a97p-18,-0x1.c036db266070bp-17},
+        {406,0x1.b593d87b3aebap-18,-0x1.c364a727fa7bep-18},
+        {407,0x1.24f7efc5b44a4p-18,-0x1.533f31e1eef87p-19},
+        {375,0x1.75357f135b0d4p-19,0x1.0d7372e06a139p-20},
+        {376,0x1.59be58cc50e7cp-18,0x1.e85569f6d7dbcp-19},
+        {377,0x1.d1d9527b288b6p-18,0x1.1bad4892f2136p-17},
+        {378,0x1.d0919449b6612p-18,0x1.04c23644ae489p-16},
+        {379,0x1.f08aafdf2720ap-19,0x1.9914d2be3b93bp-16},
+        {380,-0x1.0c0fada34dd2ep-18,0x1.1af52458a6f11p-15},
+        {381,-0x1.1c340be75634p-16,0x1.5d5a782245814p-15},
+        {382,-0x1.264d670d731eep-15,0x1.7f54ec4c6ab62p-15},
+        {383,-0x1.e08b8ac67728p-15,0x1.6b7c429c669aep-15},
+        {384,-0x1.54bb749953d3cp-14,0x1.0f8178da05ebfp-15},
+        {385,-0x1.b28c8e5bd3826p-14,0x1.82640521fb422p-17},
+        {386,-0x1.f9098950b4ee9p-14,-0x1.415b4f0737815p-16},
+        {387,-0x1.0b9e4a511cd77p-13,-0x1.e607064365fdep-15},
+        {388,-0x1.fed2c1edd357p-14,-0x1.a99b74145efa7p-14},
+        {389,-0x1.a7002a8f4fee3p-14,-0x1.3018a4df91f6ep-13},
+        {390,-0x1.0ed0b0ec33d37p-14,-0x1.7fb3277028294p-13},
+        {391,-0x1.f327570385528p-17,-0x1.b7d7db35ca0ep-13},
+        {392,0x1.72779513a3a48p-15,-0x1.ce808dd9cbc08p-13},
+        {393,0x1.bfd4c1f9b413cp-14,-0x1.bd1dd2f1e0cacp-13},
+        {394,0x1.5c7d10a545e4dp-13,-0x1.81e0447ebd86bp-13},
+        {395,0x1.c3fd14c1b7efbp-13,-0x1.20525568b33efp-13},
+        {396,0x1.050209d848769p-12,-0x1.423d319fb3351p-14},
+        {397,0x1.12fd30ea7098p-12,-0x1.1038de0974c43p-17},
+        {398,0x1.0a339f19571a1p-12,0x1.01c7a35dfec9ep-14},
+        {399,0x1.d779ec6ebf222p-13,0x1.053be1f46ab03p-13},
+        {400,0x1.76b35a8185a64p-13,0x1.6e8eede8434dbp-13},
+        {401,0x1.fb7f4c48bd926p-14,0x1.b322f698938ebp-13},
+        {402,0x1.eacdf28294ca3p-15,0x1.ce32250c5f032p-13},
+        {403,-0x1.0109dedd96ed6p-19,0x1.c0568786c8474p-13},
+        {404,-0x1.c697d7d6c2124p-15,0x1.8f1f0d79f3e58p-13},
+        {405,-0x1.897f3e617fcadp-14,0x1.43e9caaf5d352p-13},
+        {406,-0x1.f06260d6cc062p-14,0x1.d47df629bf421p-14},
+        {407,-0x1.0b70dd570d7c8p-13,0x1.1bf66b4551cdp-14},
+        {408,-0x1.02137c4a8c9eep-13,0x1.ccd4c77e1970bp-16},
+        {409,-0x1.c57d8db32b64ep-14,-0x1.62aac2c222bfbp-18},
+        {410,-0x1.6b83ee20512e6p-14,-0x1.dd7ce5cae2c36p-16},
+        {411,-0x1.07373f9e0c284p-14,-0x1.5d3b7eef76e96p-15},
+        {412,-0x1.4ebe70d64c9ep-15,-0x1.8047530bab8fcp-15},
+        {413,-0x1.5afcd966c2164p-16,-0x1.68d87169f0ed8p-15},
+        {414,-0x1.b40f00de43392p-18,-0x1.2c03c45e9d90dp-15},
+        {415,0x1.3d07354fdcd3fp-19,-0x1.bd7905e94fc31p-16},
+        {416,0x1.b530e1bd9fda5p-18,-0x1.24e26c793983bp-16},
+        {417,0x1.dfa943fd5f325p-18,-0x1.4bfae67608ab2p-17},
+        {418,0x1.7b8ccf5844bd8p-18,-0x1.30e191a704148p-18},
+        {419,0x1.be7367dcd9c8cp-19,-0x1.82437d71e3c0ep-20},
+        {386,0x1.81cd217ebf55cp-19,0x1.1f6bae197ee6p-20},
+        {387,0x1.5b6049ad122d6p-18,0x1.ed37d548e3b6ep-19},
+        {388,0x1.d07ca27bb20d8p-18,0x1.17de5d5151606p-17},
+        {389,0x1.d4c9f81b1367bp-18,0x1.fc8bbaac73c5fp-17},
+        {390,0x1.1271c5cbaa312p-18,0x1.8d0bea5b69403p-16},
+        {391,-0x1.8b7253a44d5b6p-19,0x1.12e8b6085a0f4p-15},
+        {392,-0x1.f3c33a985e7f5p-17,0x1.55cf50f89051bp-15},
+        {393,-0x1.0adda8fa4d40ap-15,0x1.7cd6d964b80abp-15},
+        {394,-0x1.bb0c1e4e565dap-15,0x1.7444a43240448p-15},
+        {395,-0x1.3ea55a0e3a1afp-14,0x1.2a7d5279da239p-15},
+        {396,-0x1.9cb20a5f43d7ap-14,0x1.27b434ea0955dp-16},
+        {397,-0x1.e8c4e8e3ad37ep-14,-0x1.475d7114296d8p-17},
+        {398,-0x1.098fa3a81f562p-13,-0x1.7ce8122901e3p-15},
+        {399,-0x1.06cf43f18381ap-13,-0x1.6b8788d474a3ep-14},
+        {400,-0x1.ce4ba883af26ap-14,-0x1.0fb1837a2a3fdp-13},
+        {401,-0x1.519356d1d2bbp-14,-0x1.62b05ee485fbp-13},
+        {402,-0x1.376e2fef8fe01p-15,-0x1.a3c95fccb15fdp-13},
+        {403,0x1.1b77ba9bea3bap-16,-0x1.c8ef60f2f3c82p-13},
+        {404,0x1.42878db3ed8dap-14,-0x1.ca8f42d9a2bb4p-13},
+        {405,0x1.1f4811f44b427p-13,-0x1.a4deea62c10bbp-13},
+        {406,0x1.90245c92f91cdp-13,-0x1.58aea6ab31bdp-13},
+        {407,0x1.e74e815f14b0cp-13,-0x1.d7268a9b5f2cbp-14},
+        {408,0x1.0d64f89640503p-12,-0x1.9d68f8d606b9ep-15},
+        {409,0x1.124aca55d5d1ep-12,0x1.393ef600aac96p-16},
+        {410,0x1.01c56e5d9f75ap-12,0x1.6383c17ee5504p-14},
+        {411,0x1.bb88be2e8eec2p-13,0x1.2ac7437509f12p-13},
+        {412,0x1.54e362e903c8ap-13,0x1.86dc95feb9a34p-13},
+        {413,0x1.b66178ae3043dp-14,0x1.be66f03c572dep-13},
+        {414,0x1.6e943e1836d96p-15,0x1.ce66c897d0966p-13},
+        {415,-0x1.cbbdfab4a8c44p-17,0x1.b8a063ddbbcbep-13},
+        {416,-0x1.059e825580466p-14,0x1.8312a0ae6909bp-13},
+        {417,-0x1.9d46f7a51a236p-14,0x1.36da539731602p-13},
+        {418,-0x1.f8733ee3b9a9cp-14,0x1.bd6ed7220323ep-14},
+        {419,-0x1.0ba3d4b4427d5p-13,0x1.0aeb6068c75f4p-14},
+        {420,-0x1.008921464d8dep-13,0x1.a3da245dd8446p-16},
+        {421,-0x1.c26034b4e835cp-14,-0x1.a9872929b72d6p-18},
+        {422,-0x1.6a8751f5f8789p-14,-0x1.e02a9747cd94bp-16},
+        {423,-0x1.09182cd26ed84p-14,-0x1.5bc5186f9c97ep-15},
+        {424,-0x1.574a96da7585ep-15,-0x1.800025601e05cp-15},
+        {425,-0x1.70c53fbe660bcp-16,-0x1.6c2753bab3328p-15},
+        {426,-0x1.0378c82084bf5p-17,-0x1.33764c25865bcp-15},
+        {427,0x1.8ae8e39f9b91ep-20,-0x1.d29b03f3ed113p-16},
+        {428,0x1.9a66c1d8342dp-18,-0x1.3c58ec19f7c46p-16},
+        {429,0x1.e57f939c1e51bp-18,-0x1.77142fb6f08cfp-17},
+        {430,0x1.993e697af6936p-18,-0x1.7266c404bab2cp-18},
+        {431,0x1.078e19523d642p-18,-0x1.0ef906de661ffp-19},
+        {398,0x1.f4794c373a2bp-19,0x1.e62e7add45dbap-20},
+        {399,0x1.8aa0d7ccc97d8p-18,0x1.4ff598022725cp-18},
+        {400,0x1.e1d02c89b8fb6p-18,0x1.56e978c5c473p-17},
+        {401,0x1.b64fad04a7653p-18,0x1.23b9250a468aap-16},
+        {402,0x1.730858fe457b1p-19,0x1.b30840d89353dp-16},
+        {403,-0x1.5862f2ca3defp-18,0x1.22f07ca4bc1cbp-15},
+        {404,-0x1.298f5b2066effp-16,0x1.5fe4c8575d4b6p-15},
+        {405,-0x1.251ac5b92f1d2p-15,0x1.7f14a776844e6p-15},
+        {406,-0x1.d3d6c13f72ffp-15,0x1.6e895a01dca03p-15},
+        {407,-0x1.4883b4b0cd637p-14,0x1.1eb731f2ef262p-15},
+        {408,-0x1.a2e53dea40c4cp-14,0x1.0b9812eb1c235p-16},
+        {409,-0x1.eb47764990dcap-14,-0x1.7579eaf7db053p-17},
+        {410,-0x1.09a36b7b49856p-13,-0x1.8146251dabc9ap-15},
+        {411,-0x1.07031d388315p-13,-0x1.689c6f0a5bee4p-14},
+        {412,-0x1.d263f2b84ded9p-14,-0x1.0ba3876e33f04p-13},
+        {413,-0x1.5ce46d78deb92p-14,-0x1.5ce906cd231a4p-13},
+        {414,-0x1.61ef42c87b5eap-15,-0x1.9e14fc3898c6p-13},
+        {415,0x1.3569df3ebfefp-17,-0x1.c5d1d24756cbcp-13},
+        {416,0x1.18c5a6d2d0f8bp-14,-0x1.ccd9b3581d72ap-13},
+        {417,0x1.079dfa62e8b2p-13,-0x1.af215a8847534p-13},
+        {418,0x1.78ddc437336ccp-13,-0x1.6c9fb950f5b4p-13},
+        {419,0x1.d45e76e5ee3e3p-13,-0x1.098db2eb4688ep-13},
+        {420,0x1.082667181c44fp-12,-0x1.1c1b88f084dbep-14},
+        {421,0x1.130beca172528p-12,-0x1.50e2b5e87d371p-19},
+        {422,0x1.09ab306a40f16p-12,0x1.080af4bdfbb4bp-14},
+        {423,0x1.da1bc54d9fcd8p-13,0x1.00f1edddbb8bbp-13},
+        {424,0x1.80aee93003108p-13,0x1.6630f53f536a8p-13},
+        {425,0x1.10aeb71bbf70fp-13,0x1.ab5c243902c34p-13},
+        {426,0x1.2b8d94b23009fp-14,0x1.cbe9dbaf23456p-13},
+        {427,0x1.c27badb9386c9p-17,0x1.c7911d73b056p-13},
+        {428,-0x1.4405482a13438p-15,0x1.a2150a53ebd21p-13},
+        {429,-0x1.51b44c67c4827p-14,0x1.628673ad55491p-13},
+        {430,-0x1.cb8780c148358p-14,0x1.121ee5ed5bbc8p-13},
+        {431,-0x1.05bfb44d0734ep-13,0x1.75cda291c539p-14},
+        {432,-0x1.0a4d34ffbcdap-13,0x1.997722224c3bep-15},
+        {433,-0x1.ef9c7392ea594p-14,0x1.c57b2f675ef96p-17},
+        {434,-0x1.a92dd1d1a82e3p-14,-0x1.dca810b934c33p-17},
+        {435,-0x1.4fa85ffcbb87ap-14,-0x1.15c7f4675657ep-15},
+        {436,-0x1.e1e322dcf0deap-15,-0x1.6ae0d6ea9f332p-15},
+        {437,-0x1.31682e1ec1ffap-15,-0x1.7fb728fb072bcp-15},
+        {438,-0x1.3ccc9bacc67ccp-16,-0x1.63852847bce1ep-15},
+        {439,-0x1.8d13051e19556p-18,-0x1.282fe5c5459bcp-15},
+        {440,0x1.37aef7ad8df5cp-19,-0x1.be51a6b29a27p-16},
+        {441,0x1.ab787702aaadp-18,-0x1.2df04f0747688p-16},
+        {442,0x1.e41486373212cp-18,-0x1.66efd7ab149ecp-17},
+        {443,0x1.941013d626b66p-18,-0x1.658d09611522p-18},
+        {444,0x1.05bf8c4514072p-18,-0x1.0ac5e579ce9f4p-19},
+        {408,0x1.14af9b643529cp-18,0x1.2b3d3cfbabcc7p-19},
+        {409,0x1.9ce86d5cab3f2p-18,0x1.7b102c91a3c72p-18},
+        {410,0x1.e52abb54b2d4dp-18,0x1.71585bf6bbda6p-17},
+        {411,0x1.a7cab713f118ap-18,0x1.312999cd97836p-16},
+        {412,0x1.38088047ba43p-19,0x1.be30c2dc87712p-16},
+        {413,-0x1.7b93dee8117d6p-18,0x1.266da407ad09p-15},
+        {414,-0x1.303a6060052f9p-16,0x1.611f11e8446fbp-15},
+        {415,-0x1.256e43147a124p-15,0x1.7f064b948eaap-15},
+        {416,-0x1.cfb270aca5abap-15,0x1.6f7257c67252ep-15},
+        {417,-0x1.44148b1a2655cp-14,0x1.23e4641fb3c7dp-15},
+        {418,-0x1.9cdf8e9602f8cp-14,0x1.25fba7410a2a1p-16},
+        {419,-0x1.e580be34c903p-14,-0x1.1378c0478aadbp-17},
+        {420,-0x1.08488a22a1cd8p-13,-0x1.5bb75c1947219p-15},
+        {421,-0x1.08ed178c8def2p-13,-0x1.4fb494d813e34p-14},
+        {422,-0x1.e04cf7ee82c6ap-14,-0x1.fa460a2f576fcp-14},
+        {423,-0x1.77c1dba5ed39fp-14,-0x1.4e3a36578080fp-13},
+        {424,-0x1.b469787ad6ec9p-15,-0x1.91cf702f1bf07p-13},
+        {425,-0x1.03d8452d49c2ep-18,-0x1.bef81fbff0cc3p-13},
+        {426,0x1.aebdeefca20e4p-15,-0x1.ce664e46b906bp-13},
+        {427,0x1.c90752a43d067p-14,-0x1.bb7f72b661ac2p-13},
+        {428,0x1.5735c4172fb84p-13,-0x1.8527332e9019p-13},
+        {429,0x1.b891cb0ae858p-13,-0x1.2e1b819cb4138p-13},
+        {430,0x1.feb947a22de14p-13,-0x1.799e5bbb0e0adp-14},
+        {431,0x1.11322a55663e2p-12,-0x1.d61b27b370097p-16},
+        {432,0x1.0fe975616bb97p-12,0x1.322e33baba1d6p-15},
+        {433,0x1.f74a6c0947bcp-13,0x1.9a01b4884566bp-14},
+        {434,0x1.ad0c8a7bcc225p-13,0x1.3b5089c7968ap-13},
+        {435,0x1.48c8e8633723dp-13,0x1.8e53403907a05p-13},
+        {436,0x1.a93db778a753ap-14,0x1.c00cebab7855p-13},
+        {437,0x1.6f54ea7e0d32cp-15,0x1.ce42ede63bedap-13},
+        {438,-0x1.687a946eb629fp-17,0x1.ba8ff9e9a74a2p-13},
+        {439,-0x1.e3bd14d3c74c1p-15,0x1.89f7d7754a443p-13},
+        {440,-0x1.88c0c12daa9f6p-14,0x1.44104bfcbfe7bp-13},
+        {441,-0x1.e9fce3ccfda79p-14,0x1.e3c6cc57995c2p-14},
+        {442,-0x1.0a396506e60d2p-13,0x1.397009600d7b4p-14},
+        {443,-0x1.0683001e481acp-13,0x1.33ba10c82b96bp-15},
+        {444,-0x1.dd4c3e6d6ae9fp-14,0x1.23277f9eedab4p-18},
+        {445,-0x1.91c15866e1647p-14,-0x1.549dca9a8e074p-16},
+        {446,-0x1.37cf6f00207eap-14,-0x1.31be618c54e2dp-15},
+        {447,-0x1.b7f2eb1bd0474p-15,-0x1.74add54db5df5p-15},
+        {448,-0x1.10d1a8a8a28d4p-15,-0x1.7d534a3f85bbp-15},
+        {449,-0x1.10214d74763cep-16,-0x1.5aa337ba86258p-15},
+        {450,-0x1.23b2e3dd1ae1dp-18,-0x1.1d621a5db17d4p-15},
+        {451,0x1.9b751d45d07e4p-19,-0x1.aaed178b30e62p-16},
+        {452,0x1.ba3dd56ab2ac5p-18,-0x1.1fb9168074b27p-16},
+        {453,0x1.e1ad9a987e2dap-18,-0x1.55c9fd1f14774p-17},
+        {454,0x1.8d289b9075e4cp-18,-0x1.555cd6154051ap-18},
+        {455,0x1.010c792854268p-18,-0x1.00a52f74d470fp-19},
+        {421,0x1.16a2bddb98a35p-18,0x1.2f45e12c07fa2p-19},
+        {422,0x1.9ac68c9fb7629p-18,0x1.75565dcbe7734p-18},
+        {423,0x1.e427a572379dcp-18,0x1.6696c872c066cp-17},
+        {424,0x1.b3aa4e233d56ep-18,0x1.264128db5503ap-16},
+        {425,0x1.8db6438095889p-19,0x1.ad9db74b1b252p-16},
+        {426,-0x1.1be333345d383p-18,0x1.1c7c5ed154122p-15},
+        {427,-0x1.05e43a5f8357dp-16,0x1.5855ae900bc0ap-15},
+        {428,-0x1.056f0d5319eeap-15,0x1.7beed46739efap-15},
+        {429,-0x1.a52a412f4676p-15,0x1.77ff26335c6fep-15},
+        {430,-0x1.2b10742e73d8ap-14,0x1.3ea5cf771f466p-15},
+        {431,-0x1.833d6665e90d2p-14,0x1.8bd6188e61c83p-16},
+        {432,-0x1.cff8e66a73764p-14,0x1.4381c279621dep-20},
+        {433,-0x1.028a7e1ed595ep-13,-0x1.e0cf892144f06p-16},
+        {434,-0x1.0b6f3f38d45ecp-13,-0x1.0e279abcb9fe8p-14},
+        {435,-0x1.fbcb3be4e87d6p-14,-0x1.b1d4416673b5bp-14},
+        {436,-0x1.ae1353ac37b1ep-14,-0x1.2a5f3057553c8p-13},
+        {437,-0x1.2cf57bc171db4p-14,-0x1.7327208df0ef9p-13},
+        {438,-0x1.f5b53c7206631p-16,-0x1.aad4a42cf60c9p-13},
+        {439,0x1.57306a986d9afp-16,-0x1.c9e1e5d1c76d4p-13},
+        {440,0x1.3d04499877b55p-14,-0x1.cab1d2e2a579dp-13},
+        {441,0x1.128541639b40cp-13,-0x1.aa64ac15782e4p-13},
+        {442,0x1.7c9c09307ad55p-13,-0x1.695f3d8493e62p-13},
+        {443,0x1.d2e27b068407ep-13,-0x1.0b6de9aeb16d7p-13},
+        {444,0x1.06868cbdb43cep-12,-0x1.2ef4d03638196p-14},
+        {445,0x1.12b434854653fp-12,-0x1.6daa89d45f5fp-17},
+        {446,0x1.0cc59be1a7528p-12,0x1.aec6d87845081p-15},
+        {447,0x1.eaa295a75f9cdp-13,0x1.ca67ca2670526p-14},
+        {448,0x1.9d4cbb775ea3fp-13,0x1.4bb7bbe54b976p-13},
+        {449,0x1.390822119a7cep-13,0x1.976332c9d10e8p-13},
+        {450,0x1.8e967d6f63ddcp-14,0x1.c346ea5f6c3a8p-13},
+        {451,0x1.49956ef41f93cp-15,0x1.cdcdb1e02b0dap-13},
+        {452,-0x1.baffb64d88fb1p-17,0x1.b8bf3446f89bcp-13},
+        {453,-0x1.e99a1d91e863bp-15,0x1.88d99a7760116p-13},
+        {454,-0x1.86e8e55422952p-14,0x1.45148d931da9cp-13},
+        {455,-0x1.e6af604e44dc2p-14,0x1.eb56ba689cfdcp-14},
+        {456,-0x1.0977b81f01ac4p-13,0x1.4624f8d40f918p-14},
+        {457,-0x1.07e842e74492bp-13,0x1.53f509f264fdcp-15},
+        {458,-0x1.e5b9da9dcd9ddp-14,0x1.1940a14a258d4p-17},
+        {459,-0x1.9fcf86e4159b2p-14,-0x1.187448548f468p-16},
+        {460,-0x1.4a4444b55265fp-14,-0x1.1c39b71dd5d84p-15},
+        {461,-0x1.e17e9fef9775ep-15,-0x1.6abd6eace7ae2p-15},
+        {462,-0x1.3a19587f084b5p-15,-0x1.7fceca055c516p-15},
+        {463,-0x1.58f5c71a5c39cp-16,-0x1.683bc8f579d74p-15},
+        {464,-0x1.02470b178019p-17,-0x1.3316d4a37deccp-15},
+        {465,0x1.eb2ec6a25831dp-21,-0x1.dea63f714ce4p-16},
+        {466,0x1.79fc425a58494p-18,-0x1.53a517af16c3ep-16},
+        {467,0x1.e48b638c5bf2ep-18,-0x1.b0749f31fc902p-17},
+        {468,0x1.bdf5bfcf18e89p-18,-0x1.debe41b610ec3p-18},
+        {469,0x1.47b47648187dap-18,-0x1.aed7de350fb97p-19},
+        {470,0x1.734c29a2f9084p-19,-0x1.088d211ed8b99p-20},
+        {432,0x1.1699d551748b6p-18,0x1.2ed5b1eaad802p-19},
+        {433,0x1.97c9eba263ac8p-18,0x1.6dabbfad22bb1p-18},
+        {434,0x1.e2c897a94fda1p-18,0x1.5bde065e341c4p-17},
+        {435,0x1.bd83612551b74p-18,0x1.1c3b211376c5p-16},
+        {436,0x1.d4b285e45f35ep-19,0x1.9ed510db95312p-16},
+        {437,-0x1.9aafc48f71e38p-19,0x1.139d385f335eap-15},
+        {438,-0x1.c69171fc02258p-17,0x1.5020af8a31d9ep-15},
+        {439,-0x1.d67578c5c2e6ep-16,0x1.77deff9a04f94p-15},
+        {440,-0x1.820806f4568d2p-15,0x1.7cb20eb6d37b3p-15},
+        {441,-0x1.1607e0a567d4cp-14,0x1.5151a001fcd3cp-15},
+        {442,-0x1.6cf5ed2fa4157p-14,0x1.d7064c1f2ef3ap-16},
+        {443,-0x1.bbeb195f6d89p-14,0x1.18f0d4ad2002ap-17},
+        {444,-0x1.f7c3c3637f0a1p-14,-0x1.39409961e6a35p-16},
+        {445,-0x1.0ab04b0b72ea3p-13,-0x1.b33d2d2ae15ecp-15},
+        {446,-0x1.058dc25fe611p-13,-0x1.75e304a1ba124p-14},
+        {447,-0x1.d23bfc17dbb2ap-14,-0x1.0b5cc51b2497cp-13},
+        {448,-0x1.6834793e132f1p-14,-0x1.56a9aeadc4fa2p-13},
+        {449,-0x1.9eedaaf87ac02p-15,-0x1.94fb2635d8ac6p-13},
+        {450,-0x1.f6f9a877c13dcp-19,-0x1.bee0f343bbf6ep-13},
+        {451,0x1.94e74f9f80a5cp-15,-0x1.ce40ea59fd447p-13},
+        {452,0x1.ae9e21cfe6838p-14,-0x1.bf278ce70d8dbp-13},
+        {453,0x1.450b09ba828bep-13,-0x1.906290ff7c28ep-13},
+        {454,0x1.a4ec6ae33377p-13,-0x1.43cdd5ad0be3dp-13},
+        {455,0x1.ee53b58f62a0dp-13,-0x1.bc8a214c17b54p-14},
+        {456,0x1.0d3e40aec9b38p-12,-0x1.9ce2932114ce2p-15},
+        {457,0x1.12a27fe762198p-12,0x1.80f37f6ffb988p-17},
+        {458,0x1.06d49d5a78bb1p-12,0x1.2ad4f77670044p-14},
+        {459,0x1.d5e18455f40aep-13,0x1.06e58ab6d5992p-13},
+        {460,0x1.831fffb24d7f5p-13,0x1.63ced79f8d178p-13},
+        {461,0x1.1cf632da7f476p-13,0x1.a59bef6015772p-13},
+        {462,0x1.58ee9a3e7a26fp-14,0x1.c889bb9dedac6p-13},
+        {463,0x1.d9a3aece7ce9p-16,0x1.cbe5722652daap-13},
+        {464,-0x1.6e59383518022p-16,0x1.b1f7c33ae1f16p-13},
+        {465,-0x1.0deaa88ea78fp-14,0x1.7f989133a90fcp-13},
+        {466,-0x1.95bd8342070efp-14,0x1.3b7ced2fd5376p-13},
+        {467,-0x1.ed5173f6b44p-14,0x1.dab33146857dbp-14},
+        {468,-0x1.0a12b1ac89923p-13,0x1.39f17760a5144p-14},
+        {469,-0x1.073b8757c9b78p-13,0x1.45857fa48d1d6p-15},
+        {470,-0x1.e441cc94f605cp-14,0x1.02aca352e8974p-17},
+        {471,-0x1.9fe62a709cde5p-14,-0x1.1790b6c4269e2p-16},
+        {472,-0x1.4caf39054acf4p-14,-0x1.190ba0d69dd7ep-15},
+        {473,-0x1.ead4ca0cc3d16p-15,-0x1.67ffc2fcf0882p-15},
+        {474,-0x1.467e2bb6726aep-15,-0x1.7fdd6f8166631p-15},
+        {475,-0x1.7396eaf3f84fdp-16,-0x1.6c4762d8e0718p-15},
+        {476,-0x1.3267c10475812p-17,-0x1.3b18d2d3e8b44p-15},
+        {477,-0x1.5463d3b18dd02p-23,-0x1.f48bc7473fd22p-16},
+        {478,0x1.51c859de0096cp-18,-0x1.6c2dffc361e0cp-16},
+        {479,0x1.dc9db7864661cp-18,-0x1.dfc442862bbeep-17},
+        {480,0x1.d07e2565e5102p-18,-0x1.1702c4b78225cp-17},
+        {481,0x1.6ad00aefbe802p-18,-0x1.10146f024e12ep-18},
+        {482,0x1.c448d3540695dp-19,-0x1.897581112835p-20},
+        {446,0x1.8f9d974dd99fcp-19,0x1.3170e9244ca14p-20},
+        {447,0x1.4d7a16a8bd5d8p-18,0x1.bf149661d3be8p-19},
+        {448,0x1.bc7ac96bfbe9p-18,0x1.d8949e73b3764p-18},
+        {449,0x1.e5f5b1680efe2p-18,0x1.9f6516e14d6aap-17},
+        {450,0x1.934ce649cfc76p-18,0x1.41a267aa167acp-16},
+        {451,0x1.1b271d3be92cep-19,0x1.c339721b26a6ap-16},
+        {452,-0x1.58f4dadbebcf3p-18,0x1.22c84180485d1p-15},
+        {453,-0x1.0ea306c32a836p-16,0x1.5a18ae8642b41p-15},
+        {454,-0x1.028bfcc7dd7ccp-15,0x1.7b603248ca55ap-15},
+        {455,-0x1.97ed0aa2eb8f7p-15,0x1.79d0b19a4fe9bp-15},
+        {456,-0x1.1ed4526407356p-14,0x1.49acda0c7d1ap-15},
+        {457,-0x1.72a4502d33f16p-14,0x1.c44add25e644p-16},
+        {458,-0x1.be51b76ba82cp-14,0x1.f912a34beb98bp-18},
+        {459,-0x1.f7bfd8edbd081p-14,-0x1.3a9cfbd9f6949p-16},
+        {460,-0x1.0a7027bc92561p-13,-0x1.aa252f613b718p-15},
+        {461,-0x1.0677b9448d4a6p-13,-0x1.6bac7ebf53f5ap-14},
+        {462,-0x1.d9b01e224de1cp-14,-0x1.03afd81f2fe9fp-13},
+        {463,-0x1.787c1ff5cb5ddp-14,-0x1.4d731e7d4da77p-13},
+        {464,-0x1.d60194322f7d6p-15,-0x1.8c03f87559cbcp-13},
+        {465,-0x1.bc3b2bfb4d088p-17,-0x1.b88af0887ace2p-13},
+        {466,0x1.2e92aa84270b6p-15,-0x1.cd3ba0220d402p-13},
+        {467,0x1.7334a7e40a896p-14,-0x1.c60b25ec87d91p-13},
+        {468,0x1.25d3eda9c971ap-13,-0x1.a13eb7072b5ap-13},
+        {469,0x1.87a8f1a5165dap-13,-0x1.5fbe5d6cfe402p-13},
+        {470,0x1.d6f24af3deb26p-13,-0x1.051ee5471e108p-13},
+        {471,0x1.0672946977ee2p-12,-0x1.2ebde51f21225p-14},
+        {472,0x1.1266b305f1006p-12,-0x1.e5d013c768f66p-17},
+        {473,0x1.0e48358fcad5p-12,0x1.73aac3fba66e1p-15},
+        {474,0x1.f4e825447be42p-13,0x1.a283e13a227b3p-14},
+        {475,0x1.b14ea445fd6d5p-13,0x1.36233d1d8bcc6p-13},
+        {476,0x1.579cf174ac7ccp-13,0x1.848f8c70e7bd4p-13},
+        {477,0x1.ded2acfdd235p-14,0x1.b7b62d29e44b8p-13},
+        {478,0x1.02727c82b6c4cp-14,0x1.cd5bdbd4e43f9p-13},
+        {479,0x1.5a005e94c6475p-17,0x1.c5f69abba3b1dp-13},
+        {480,-0x1.2e68c89fc2e54p-15,0x1.a47d8b8e8318ep-13},
+        {481,-0x1.3861165caa1a8p-14,0x1.6df59308eead8p-13},
+        {482,-0x1.afc87fc349709p-14,0x1.28cb9fa8eb0eap-13},
+        {483,-0x1.f97bce2f27d8p-14,0x1.b825e8d5c916cp-14},
+        {484,-0x1.0b09a187e4f35p-13,0x1.1d80562e27421p-14},
+        {485,-0x1.05139fee3775cp-13,0x1.1be23c4c83732p-15},
+        {486,-0x1.dd64446a01387p-14,0x1.312920065c552p-18},
+        {487,-0x1.995f0ffcd5fcdp-14,-0x1.33656c4556ea2p-16},
+        {488,-0x1.485347a998196p-14,-0x1.1e3a923dc16e3p-15},
+        {489,-0x1.e7ec3479206b8p-15,-0x1.68ac8842f5646p-15},
+        {490,-0x1.48ffbc8209a41p-15,-0x1.7fbd3b16de3dcp-15},
+        {491,-0x1.8013b59f7ba84p-16,-0x1.6df64b015e4fcp-15},
+        {492,-0x1.514734f7b50bep-17,-0x1.3fda581253d44p-15},
+        {493,-0x1.0a86ddac04b8p-20,-0x1.0216e697d0239p-15},
+        {494,0x1.2c8c8f6f3d03cp-18,-0x1.7ffccbeb8713ap-16},
+        {495,0x1.d074b17a03e7ep-18,-0x1.04e6a10636e0ap-16},
+        {496,0x1.dcc89207d2864p-18,-0x1.3d606e2d2a832p-17},
+        {497,0x1.89617586dd4bp-18,-0x1.4c10729208156p-18},
+        {498,0x1.09ad22edb166ep-18,-0x1.11a67562c3b2cp-19},
+        {459,0x1.18c00cf865d3fp-18,0x1.32e74bf6a230fp-19},
+        {460,0x1.92bdfd19cdf6fp-18,0x1.60ed3aa0fac1ap-18},
+        {461,0x1.df2da39658a78p-18,0x1.4751695a4539bp-17},
+        {462,0x1.ce37f98d3efe6p-18,0x1.080e40c4dedc4p-16},
+        {463,0x1.2c69b3ac22337p-18,0x1.7ffdc47777fbp-16},
+        {464,-0x1.ae04d3ea93f1ap-21,0x1.00474d486addep-15},
+        {465,-0x1.3d87a33f0c902p-17,0x1.3cbb7cf2dca1cp-15},
+        {466,-0x1.6c2bedeafe915p-16,0x1.6b01c01f03502p-15},
+        {467,-0x1.38d3d598d02a2p-15,0x1.7f7857897500cp-15},
+        {468,-0x1.d157d4ae480f2p-15,0x1.6e83ae4d09c58p-15},
+        {469,-0x1.3a7c8a7429d0dp-14,0x1.2e1d5ec1b9362p-15},
+        {470,-0x1.8a8dcd6562041p-14,0x1.6eea1c6a6cd23p-16},
+        {471,-0x1.d01e56d75f966p-14,0x1.0d69dc9fb645ep-20},
+        {472,-0x1.00e29ee738e9ap-13,-0x1.b6a5a50962c21p-16},
+        {473,-0x1.0b38a63d5ccd6p-13,-0x1.e9c23f2750ff6p-15},
+        {474,-0x1.03402d9f8adfp-13,-0x1.895b22a28ca98p-14},
+        {475,-0x1.cccd61aafcd18p-14,-0x1.10327a5f23d5fp-13},
+        {476,-0x1.6791efaa776ebp-14,-0x1.56c2fe5102595p-13},
+        {477,-0x1.b1f52b65d2b53p-15,-0x1.91d089ce508afp-13},
+        {478,-0x1.3aa9edf1bdd25p-17,-0x1.bb223a841a5b6p-13},
+        {479,0x1.46685986a686dp-15,-0x1.cd816ad9f247p-13},
+        {480,0x1.795489210f07cp-14,-0x1.c5566a597e9aap-13},
+        {481,0x1.25dc77962b2dp-13,-0x1.a121cd903c7b2p-13},
+        {482,0x1.85374be9d9fe6p-13,-0x1.61c22fe9fccb4p-13},
+        {483,0x1.d33572a26b95ap-13,-0x1.0a7bf1b72551dp-13},
+        {484,0x1.04c265c0576d2p-12,-0x1.417f75333cdcp-14},
+        {485,0x1.11d547338e6ebp-12,-0x1.5da33585c45f5p-16},
+        {486,0x1.0fbca12129084p-12,0x1.31be1b874f01p-15},
+        {487,0x1.fd4a83b07e4ap-13,0x1.7e558e6901c12p-14},
+        {488,0x1.bff5b6d880561p-13,0x1.247e94eecef43p-13},
+        {489,0x1.6c84c1116cac8p-13,0x1.75ad51e099ad2p-13},
+        {490,0x1.09afc2b19efe7p-13,0x1.add562271e713p-13},
+        {491,0x1.3e5eeeb971fcdp-14,0x1.ca578e6807dfcp-13},
+        {492,0x1.a7d42df459795p-16,0x1.cafec38f372d4p-13},
+        {493,-0x1.6bdfab80fb9ccp-16,0x1.b1e6b252a567p-13},
+        {494,-0x1.03de51635ae37p-14,0x1.83269cf3e59f1p-13},
+        {495,-0x1.87953f642f35cp-14,0x1.444c884b9d9b1p-13},
+        {496,-0x1.e0ee8f364e1acp-14,0x1.f7744b11550dp-14},
+        {497,-0x1.076df6a71ff5cp-13,0x1.5fef0f6a43e55p-14},
+        {498,-0x1.0a11525d3ff88p-13,0x1.9c3f3b475d47ap-15},
+        {499,-0x1.f6af38a814c15p-14,0x1.304be91379aecp-16},
+        {500,-0x1.bea443f11faeap-14,-0x1.ef0c5ca51a1fdp-18},
+        {501,-0x1.754659002785ap-14,-0x1.bb288ab06b9bp-16},
+        {502,-0x1.23e81f4d13011p-14,-0x1.44f07efdcdf7bp-15},
+        {503,-0x1.a5ed93e8402e1p-15,-0x1.777fe0d41d5b3p-15},
+        {504,-0x1.127ff2e7ae5fap-15,-0x1.7d1c510f2969dp-15},
+        {505,-0x1.2e0198bb8751ap-16,-0x1.6064e16da7569p-15},
+        {506,-0x1.c3fd94f8bf0b8p-18,-0x1.2d1c8a65fefadp-15},
+        {507,0x1.02db3aa8a18fcp-20,-0x1.dd518237bd426p-16},
+        {508,0x1.6a050e497113ap-18,-0x1.5db6ca236cd5bp-16},
+        {509,0x1.df19839da7a88p-18,-0x1.d490aaf3705e2p-17},
+        {510,0x1.d162ef924ef59p-18,-0x1.18d09f3e46036p-17},
+        {511,0x1.7404320ba5dbdp-18,-0x1.20699aa2c298cp-18},
+        {512,0x1.e9911ce91e8b8p-19,-0x1.cd19468b2ce3cp-20},
+        {472,0x1.0b3ce7c4c34edp-18,0x1.1437e24d37deap-19},
+        {473,0x1.845749535503dp-18,0x1.40a82b014a13ep-18},
+        {474,0x1.d7ecab7ade2b5p-18,0x1.2b7688abce4cdp-17},
+        {475,0x1.db045bfd5cd72p-18,0x1.e68ad9bcce617p-17},
+        {476,0x1.5e796d6d385fep-18,0x1.64a4db2d3c4d5p-16},
+        {477,0x1.aa10a2fa6e3f7p-21,0x1.e0e1146a2c375p-16},
+        {478,-0x1.c4128422ca374p-18,0x1.2d0ee3a76fa46p-15},
+        {479,-0x1.27e40866df8c9p-16,0x1.5f219bce45128p-15},
+        {480,-0x1.0adb90e8538eap-15,0x1.7c33b9de280dp-15},
+        {481,-0x1.98c50541f3942p-15,0x1.797342d9823ccp-15},
+        {482,-0x1.1aa19f8f0e868p-14,0x1.4cfdeb578b32cp-15},
+        {483,-0x1.6a1783e31cccp-14,0x1.de964aa550eaep-16},
+        {484,-0x1.b32e5121e676dp-14,0x1.721e532e0e834p-17},
+        {485,-0x1.ed6813f05011p-14,-0x1.a93607a42cc8ap-17},
+        {486,-0x1.0815ebb10fe5cp-13,-0x1.5eaf7b8a296bp-15},
+        {487,-0x1.09d91280d2a38p-13,-0x1.3a37e4969d4e8p-14},
+        {488,-0x1.f1f768d21139fp-14,-0x1.cd1a269b897bfp-14},
+        {489,-0x1.a7978217b68f5p-14,-0x1.2ea6a1ef7c83ep-13},
+        {490,-0x1.347621cd2df18p-14,-0x1.6f7b395c0225p-13},
+        {491,-0x1.38374e2ce5595p-15,-0x1.a310f6b677277p-13},
+        {492,0x1.a4a5f5f59b9b6p-18,-0x1.c3f71989b526bp-13},
+        {493,0x1.c897a84a82501p-15,-0x1.cdd8dc3b2bd96p-13},
+        {494,0x1.b4f7181e00084p-14,-0x1.bdfcbf6e8ff52p-13},
+        {495,0x1.3ef42a6965e69p-13,-0x1.93a0f0666df3cp-13},
+        {496,0x1.98466dfdf14ccp-13,-0x1.5028d6c5d1981p-13},
+        {497,0x1.dfbca8ce0fdd2p-13,-0x1.ee29a899243cap-14},
+        {498,0x1.07eb8282954ap-12,-0x1.1b868568588ecp-14},
+        {499,0x1.12698531c52a2p-12,-0x1.b000423893faep-17},
+        {500,0x1.0e84b35296b3bp-12,0x1.6649003411729p-15},
+        {501,0x1.f91770511543cp-13,0x1.904f28a6a4fedp-14},
+        {502,0x1.bbcfb468b5106p-13,0x1.297c8d5c20ff1p-13},
+        {503,0x1.69f34dba21d92p-13,0x1.7779abf2025bep-13},
+        {504,0x1.09bbfb422346p-13,0x1.adb729098d084p-13},
+        {505,0x1.448849459601ap-14,0x1.c9d3ca61c06dbp-13},
+        {506,0x1.d6eca40a18386p-16,0x1.cb96a5d55b19ep-13},
+        {507,-0x1.2cb61e3b7d934p-16,0x1.b4d9de3be2c45p-13},
+        {508,-0x1.e4f9524655285p-15,0x1.89429fc07f0f4p-13},
+        {509,-0x1.7771aa6b95b1cp-14,0x1.4dd02ce52c62p-13},
+        {510,-0x1.d4cffe49bf6cap-14,0x1.084ffe2640bc4p-13},
+        {511,-0x1.048612dfe1b4cp-13,0x1.7d8ea57f5cddcp-14},
+        {512,-0x1.0b0bf04200c7ap-13,0x1.db8b7ff37519dp-15},
+        {513,-0x1.006cfd8b76f7p-13,0x1.abdcd1785aa4dp-16},
+        {514,-0x1.d066fbb256ebp-14,-0x1.c3d2c02096627p-21},
+        {515,-0x1.8d15a24aa8a8ap-14,-0x1.648ece8b0e442p-16},
+        {516,-0x1.3f8c403b4e7bap-14,-0x1.283d4340d5659p-15},
+        {517,-0x1.dfc49feef7cd9p-15,-0x1.6aa8f0bd4c7dap-15},
+        {518,-0x1.49d9bc31b5dacp-15,-0x1.7f85db00c0ecep-15},
+        {519,-0x1.8f146df9ecap-16,-0x1.6fce0b02d8431p-15},
+        {520,-0x1.7c7f7987a94d4p-17,-0x1.461105ca4b62fp-15},
+        {521,-0x1.309949e9bc8eep-19,-0x1.0d148e418b1ap-15},
+        {522,0x1.dab0e07bc9dabp-19,-0x1.9d4e38ed50548p-16},
+        {523,0x1.b44e843fd55f3p-18,-0x1.2581e8a8c267ep-16},
+        {524,0x1.e62ba9882452cp-18,-0x1.7c0d2221a4f44p-17},
+        {525,0x1.b1fb52bfc8d58p-18,-0x1.b4b6958c71a67p-18},
+        {526,0x1.454f47b62b07ep-18,-0x1.a5eb51ea00d87p-19},
+        {527,0x1.8dcc9ce4614c6p-19,-0x1.2d5d3bd412868p-20},
+        {486,0x1.1ae4e4353a5d5p-18,0x1.36ff56f136cd9p-19},
+        {487,0x1.8e5caba1f1c34p-18,0x1.562e3caddeff1p-18},
+        {488,0x1.db10dc83a4beap-18,0x1.35dbdd0877779p-17},
+        {489,0x1.d92c83007fcbcp-18,0x1.ed9e647e967b2p-17},
+        {490,0x1.5d6e2b8203828p-18,0x1.653271647a86cp-16},
+        {491,0x1.f530cbcc68d39p-21,0x1.ddcac660d0199p-16},
+        {492,-0x1.a3cb83a86fe77p-18,0x1.29f858ba415cap-15},
+        {493,-0x1.16cdb71030e28p-16,0x1.5b98dd3bbb2c6p-15},
+        {494,-0x1.f8e036116ff8ap-16,0x1.7a411dee7c828p-15},
+        {495,-0x1.83d3894c0f66p-15,0x1.7c01e0b94637ap-15},
+        {496,-0x1.0d273a839f116p-14,0x1.579e11e7af169p-15},
+        {497,-0x1.5a9e8fec74124p-14,0x1.05c2caff8153ap-15},
+        {498,-0x1.a393f54e0c169p-14,0x1.0471373571a24p-16},
+        {499,-0x1.e05da3377fef9p-14,-0x1.98c457eefd2cep-18},
+        {500,-0x1.04868d5b4fe12p-13,-0x1.15781468152d1p-15},
+        {501,-0x1.0b1b880fa6618p-13,-0x1.0d8e9bb38cf1ep-14},
+        {502,-0x1.00e31391a1274p-13,-0x1.9abaa512fa362p-14},
+        {503,-0x1.c7c17aa8dd056p-14,-0x1.147d7b4196b7ep-13},
+        {504,-0x1.66ef5c2c4033p-14,-0x1.56dc362da581fp-13},
+        {505,-0x1.c27e09045c89p-15,-0x1.8ef3c2c17a25p-13},
+        {506,-0x1.df47e89fba526p-17,-0x1.b782c652fa481p-13},
+        {507,0x1.01854a5596c45p-15,-0x1.cc0e1d96251ecp-13},
+        {508,0x1.49e04fb5248acp-14,-0x1.c9583be2fefa4p-13},
+        {509,0x1.0963111931952p-13,-0x1.adc0d6829520ep-13},
+        {510,0x1.67043f57a9cbap-13,-0x1.79819b0d07894p-13},
+        {511,0x1.b74eac79bd558p-13,-0x1.2ec014e264baap-13},
+        {512,0x1.f480b07169b0ep-13,-0x1.a2e2a310c7092p-14},
+        {513,0x1.0d10451d3b394p-12,-0x1.9c4315cd7a9p-15},
+        {514,0x1.12b2874813841p-12,0x1.39e53b6bd084p-18},
+        {515,0x1.0abbb8d5be38ap-12,0x1.e84146db15088p-15},
+        {516,0x1.eb872e1b32cd5p-13,0x1.c543cd360cdf1p-14},
+        {517,0x1.aaade95d8fa6p-13,0x1.3d1849c1c1c09p-13},
+        {518,0x1.57a65558fc576p-13,0x1.8434574c85a5ap-13},
+        {519,0x1.f0bba43f1f07fp-14,0x1.b44ce66888294p-13},
+        {520,0x1.26d8ddd939ad8p-14,0x1.cb90808f5f169p-13},
+        {521,0x1.7c0b550b8cb62p-16,0x1.ca19bb19cfb64p-13},
+        {522,-0x1.69665720b6c12p-16,0x1.b1d58f15a6f76p-13},
+        {523,-0x1.f57b7b7f4ea26p-15,0x1.863ff035abbb8p-13},
+        {524,-0x1.7a5ad62b7476ep-14,0x1.4bff2a86d0467p-13},
+        {525,-0x1.d4882f4b10e9cp-14,0x1.0869bba7ca634p-13},
+        {526,-0x1.03f34602b9c57p-13,0x1.820832ed5cde8p-14},
+        {527,-0x1.0b191ca0ff2b6p-13,0x1.ec0ffb734248p-15},
+        {528,-0x1.01e7190782f7ap-13,0x1.d72b9ee585318p-16},
+        {529,-0x1.d71996746e17cp-14,0x1.06c5126e372cap-19},
+        {530,-0x1.97a5550b6a98bp-14,-0x1.390427a9fd38cp-16},
+        {531,-0x1.4d61b6a06e92ap-14,-0x1.17595aba30652p-15},
+        {532,-0x1.ffb4e42aa1defp-15,-0x1.60f6ee56d2384p-15},
+        {533,-0x1.6b28b681f026dp-15,-0x1.7e2fb3af82c36p-15},
+        {534,-0x1.ce68effff215p-16,-0x1.76c18918c5092p-15},
+        {535,-0x1.e9fe106f4cb8ap-17,-0x1.541e1c10a894p-15},
+        {536,-0x1.41a8c885ec1e1p-18,-0x1.203571070d56ap-15},
+        {537,0x1.f536472806f58p-20,-0x1.c8c4a18ad2be4p-16},
+        {538,0x1.7d522634b3649p-18,-0x1.5125dd51f8d64p-16},
+        {539,0x1.e0fae7a9861acp-18,-0x1.caf747b9963d1p-17},
+        {540,0x1.d2447fb31effap-18,-0x1.1a9f83bec15f2p-17},
+        {541,0x1.7c34164c6bfcep-18,-0x1.2faf19ea2d8a7p-18},
+        {542,0x1.05946517b70d1p-18,-0x1.07b3491a482aep-19},
+        {500,0x1.8a925f2edc582p-19,0x1.2700c1d289897p-20},
+        {501,0x1.3c5afa84306b4p-18,0x1.8b86dc3dd838p-19},
+        {502,0x1.a60ca4a82259ap-18,0x1.90da22217860fp-18},
+        {503,0x1.e2c0cf0bc79a2p-18,0x1.5935ba003a278p-17},
+        {504,0x1.ccfcd8718c68p-18,0x1.09b4c3e8164dap-16},
+        {505,0x1.3d27890ff929dp-18,0x1.77214c77b801ap-16},
+        {506,0x1.cf32fa26b86a4p-23,0x1.ec9f0df5ff445p-16},
+        {507,-0x1.db54e7000697p-18,0x1.2f0ccf67f5c2ap-15},
+        {508,-0x1.2390d281be6dep-16,0x1.5e1c087610af4p-15},
+        {509,-0x1.009c0a42d48f4p-15,0x1.7ab9548d4b422p-15},
+        {510,-0x1.8450cb475a421p-15,0x1.7bd1727401af9p-15},
+        {511,-0x1.0b1abadf7f5d4p-14,0x1.58f7b3b3b61c3p-15},
+        {512,-0x1.564cafb3d3ccp-14,0x1.0b72edd43b464p-15},
+        {513,-0x1.9da2633c1d9f4p-14,0x1.1e897affbc04p-16},
+        {514,-0x1.da25569859fc4p-14,-0x1.bf43bebfbff3ap-19},
+        {515,-0x1.0249e1df60352p-13,-0x1.e4bb13565cf4ep-16},
+        {516,-0x1.0b056daf5a2f7p-13,-0x1.eb9f3308aa357p-15},
+        {517,-0x1.045e1558dff08p-13,-0x1.7d884e414504p-14},
+        {518,-0x1.d89bb25627f41p-14,-0x1.04169c5172ddfp-13},
+        {519,-0x1.83f374e2258cdp-14,-0x1.4621dcc7ecde6p-13},
+        {520,-0x1.0bcaaeeea332fp-14,-0x1.7fdc5130f232ep-13},
+        {521,-0x1.d049e56b420ffp-16,-0x1.ac5ab29caf3ep-13},
+        {522,0x1.e3881cf34eb58p-17,-0x1.c7404191b0716p-13},
+        {523,0x1.f909e66af007p-15,-0x1.cd29a27f1f488p-13},
+        {524,0x1.c114ac1ba6eafp-14,-0x1.bc075d8b2e201p-13},
+        {525,0x1.3f016916e7bd2p-13,-0x1.935e2f4ae2014p-13},
+        {526,0x1.938e4cb5a658ap-13,-0x1.5465a87d63b3cp-13},
+        {527,0x1.d88c6579e806dp-13,-0x1.0200d26b1b49p-13},
+        {528,0x1.04a290e82d25fp-12,-0x1.4120aa63c6f56p-14},
+        {529,0x1.112b937a4c786p-12,-0x1.ad0c5a47c399bp-16},
+        {530,0x1.11009c089b87ep-12,0x1.c3f373b9e0507p-16},
+        {531,0x1.0424aeae4e938p-12,0x1.468358f3c58e8p-14},
+        {532,0x1.d6fc5d380a03ep-13,0x1.045e84d4afa44p-13},
+        {533,0x1.918594e02d3ap-13,0x1.564e2fbc59071p-13},
+        {534,0x1.3ca338484ac55p-13,0x1.94b919ead232ap-13},
+        {535,0x1.bbfd1135d4b8dp-14,0x1.bcc6f9c1a7416p-13},
+        {536,0x1.eec90df3d3e23p-15,0x1.cd4bae5adf29ap-13},
+        {537,0x1.bcb20b4fced2bp-17,0x1.c6cd9711c289cp-13},
+        {538,-0x1.e18bfec44f2dfp-16,0x1.ab66007baf6e2p-13},
+        {539,-0x1.0f5b259814fe2p-14,0x1.7e8008f7f6b9ap-13},
+        {540,-0x1.86a00bad1e354p-14,0x1.447d917a67d8bp-13},
+        {541,-0x1.da54195fa494cp-14,0x1.024c18ccb6ab5p-13},
+        {542,-0x1.04c19e8c28b75p-13,0x1.79e90e1c4310ep-14},
+        {543,-0x1.0afa4f3606beep-13,0x1.e4c37a7df50d2p-15},
+        {544,-0x1.01e105056cb3dp-13,0x1.d88c6c198e056p-16},
+        {545,-0x1.d8c374eda2926p-14,0x1.6e79b7f853f82p-19},
+        {546,-0x1.9be075a96d01p-14,-0x1.263ca869bc52fp-16},
+        {547,-0x1.545aef203724dp-14,-0x1.0e0ebee3c34dep-15},
+        {548,-0x1.09255746327a3p-14,-0x1.5a658e10c772cp-15},
+        {549,-0x1.80a882431dd5p-15,-0x1.7c36823f8d376p-15},
+        {550,-0x1.fada2ee7b5874p-16,-0x1.7a499796d1104p-15},
+        {551,-0x1.1e69a18bb7866p-16,-0x1.5d1337c341314p-15},
+        {552,-0x1.cbffbee77c072p-18,-0x1.2da789f4918b8p-15},
+        {553,0x1.8aa98656d59e5p-22,-0x1.e98ad97d84b57p-16},
+        {554,0x1.42c94a7ffbba4p-18,-0x1.741fc851d740cp-16},
+        {555,0x1.cef0360b306a9p-18,-0x1.0709ee15e84ep-16},
+        {556,0x1.e20b7c23d308ap-18,-0x1.54e0dbef7532ap-17},
+        {557,0x1.a3b51e311f784p-18,-0x1.8a750d46717fcp-18},
+        {558,0x1.394b318f2fc4dp-18,-0x1.83237709bdb5p-19},
+        {559,0x1.8474935fd549ep-19,-0x1.1dca44096d4f6p-20},
+        {516,0x1.e38401c8ddf0ep-19,0x1.be176312e57a8p-20},
+        {517,0x1.638fe0f7f87b8p-18,0x1.01a1365a2fbb5p-18},
+        {518,0x1.bf7fac1b92526p-18,0x1.e15d7e0e18acp-18},
+        {519,0x1.e6bc89ae393dep-18,0x1.89481c614fbcap-17},
+        {520,0x1.b6255df15da6ep-18,0x1.239b744ad96ep-16},
+        {521,0x1.09d694177abebp-18,0x1.90570b0dcebdap-16},
+        {522,-0x1.f32259d992e6dp-21,0x1.013ea200b200fp-15},
+        {523,-0x1.1d0fdd1a4b94ep-17,0x1.3732133521f99p-15},
+        {524,-0x1.3cda1ff778c28p-16,0x1.62d15ef8c4bbcp-15},
+        {525,-0x1.0c500170d1c9ep-15,0x1.7c090e0c6837ep-15},
+        {526,-0x1.8d5b1fc15ed9cp-15,0x1.7a988c89cc0cfp-15},
+        {527,-0x1.0d9de0f8ff1f8p-14,0x1.56e838d5a6417p-15},
+        {528,-0x1.567e8d0e04addp-14,0x1.0af083a2d6d0bp-15},
+        {529,-0x1.9bb9919dd08b8p-14,0x1.263581dee0a0ep-16},
+        {530,-0x1.d6f7e410e3a5ep-14,-0x1.0fda52f8a5b9p-19},
+        {531,-0x1.00cdf961af8f6p-13,-0x1.bc042df1d0b92p-16},
+        {532,-0x1.0aa96cce3582ep-13,-0x1.cca49c5b53b68p-15},
+        {533,-0x1.0657dc0d37d14p-13,-0x1.68df7d8b9a3f1p-14},
+        {534,-0x1.e3c2617f9cb96p-14,-0x1.ef698a2d1d45dp-14},
+        {535,-0x1.9899e1e42bb98p-14,-0x1.38ba2a0e0c552p-13},
+        {536,-0x1.2ba439ca8821p-14,-0x1.72eea63aab12p-13},
+        {537,-0x1.3fbe78ccc8a72p-15,-0x1.a1c7250ef20fap-13},
+        {538,0x1.4b619347b7b57p-20,-0x1.c11eb0589443ep-13},
+        {539,0x1.7761a2b6ccf2ap-15,-0x1.cd9426f871a4cp-13},
+        {540,0x1.7a072640244c9p-14,-0x1.c4dcc7e2e9345p-13},
+        {541,0x1.1ab0a6fd7da0ep-13,-0x1.a6034606301dep-13},
+        {542,0x1.7146613dd8558p-13,-0x1.718ca86721468p-13},
+        {543,0x1.bb667582814d2p-13,-0x1.297e885739892p-13},
+        {544,0x1.f458f75bf9568p-13,-0x1.a28a2924b78bap-14},
+        {545,0x1.0c3665ee98e0dp-12,-0x1.b5e94658fa604p-15},
+        {546,0x1.12a21c51832f6p-12,-0x1.c985d8824d09p-20},
+        {547,0x1.0d033392c0b1bp-12,0x1.9a1deb7ad46e9p-15},
+        {548,0x1.f7713249946ep-13,0x1.95d0595156d59p-14},
+        {549,0x1.bfc98f627dcd6p-13,0x1.240f1ab250204p-13},
+        {550,0x1.76ac0befaefafp-13,0x1.6d50ca65fcecfp-13},
+        {551,0x1.20c1da2f5efe5p-13,0x1.a32acbab8da33p-13},
+        {552,0x1.86c2e08a472c2p-14,0x1.c37e6611b993dp-13},
+        {553,0x1.908e36c1ad376p-15,0x1.cdacb846d265ap-13},
+        {554,0x1.0ecc675c165e8p-18,0x1.c2929ceb13b4ap-13},
+        {555,-0x1.2b1de7ddbea8dp-15,0x1.a465ba74e201p-13},
+        {556,-0x1.233763a580bc4p-14,0x1.7676ff47400e1p-13},
+        {557,-0x1.925b350418f66p-14,0x1.3ce124a9802d1p-13},
+        {558,-0x1.dfd058a77e7a5p-14,0x1.f856e0645c44dp-14},
+        {559,-0x1.057ef8294cf05p-13,0x1.71d34d22756bap-14},
+        {560,-0x1.0ad7748d1d775p-13,0x1.dd87c4751ba07p-15},
+        {561,-0x1.01da8537a4121p-13,0x1.da033e91dcf86p-16},
+        {562,-0x1.da68545bcb635p-14,0x1.d78a757f26a44p-19},
+        {563,-0x1.a0112cab52ca3p-14,-0x1.1302c11f23a7ep-16},
+        {564,-0x1.5b4cde2a4b50cp-14,-0x1.0452f7e8de081p-15},
+        {565,-0x1.127b4a6fa913fp-14,-0x1.53246a0d6ab28p-15},
+        {566,-0x1.9685207636f5ep-15,-0x1.795b4273b5d6ep-15},
+        {567,-0x1.1464410e2951ap-15,-0x1.7cdc1c9b9690ep-15},
+        {568,-0x1.4a2ae62e80acap-16,-0x1.652b243c7fb2bp-15},
+        {569,-0x1.3163ee9512eb9p-17,-0x1.3a849d9f42caep-15},
+        {570,-0x1.6a167bb436814p-20,-0x1.05050b742361p-15},
+        {571,0x1.f22dc28ab4bap-19,-0x1.97e8cfbb2b73ep-16},
+        {572,0x1.aee0e4dea8691p-18,-0x1.2a8420c9fd8aap-16},
+        {573,0x1.e6a17e9e03559p-18,-0x1.94e113cc2d12p-17},
+        {574,0x1.c422c53ec1b9ep-18,-0x1.f33a488702e3dp-18},
+        {575,0x1.6ab210c075ee3p-18,-0x1.0e10f0b45cf15p-18},
+        {576,0x1.f30874f5b08e3p-19,-0x1.dc41fc25e23bap-20},
+        {528,0x1.8f57f941b5a04p-19,0x1.2ce0f05b09184p-20},
+        {529,0x1.38434bfe0e3c8p-18,0x1.7f51d88643dcp-19},
+        {530,0x1.9de94a677e462p-18,0x1.7a789e5a2cd17p-18},
+        {531,0x1.de3db71dfcc88p-18,0x1.413e66ee7ed0cp-17},
+        {532,0x1.d9ed10a842f0cp-18,0x1.eaf7c6f8a1316p-17},
+        {533,0x1.6f685a064179ep-18,0x1.5a0a7c58a2107p-16},
+        {534,0x1.fa0caa51a548p-20,0x1.c80f3baf2f32p-16},
+        {535,-0x1.1351895860b96p-18,0x1.1b17bba311e0fp-15},
+        {536,-0x1.ab4be040b527bp-17,0x1.4c204ab12ae54p-15},
+        {537,-0x1.93673777aa704p-16,0x1.6ffc6faa3634ap-15},
+        {538,-0x1.3d23fcef85e9bp-15,0x1.7efeb9cbb343ep-15},
+        {539,-0x1.c0c8a075a1aabp-15,0x1.719e9b3fddddep-15},
+        {540,-0x1.26e3fd877c83ep-14,0x1.413eedbe3dd5fp-15},
+        {541,-0x1.6d7fa344b3d22p-14,0x1.d1f7512a782aep-16},
+        {542,-0x1.aebcca8ec00aap-14,0x1.99a865dc58a62p-17},
+        {543,-0x1.e492804478b46p-14,-0x1.172763036c4fbp-17},
+        {544,-0x1.046eb3e51d5afp-13,-0x1.177759603b32p-15},
+        {545,-0x1.0af2414126c12p-13,-0x1.036cb4d5ddc4ep-14},
+        {546,-0x1.0371aff673a26p-13,-0x1.8460870615c9cp-14},
+        {547,-0x1.d88ce624e1f61p-14,-0x1.03c6f426fe5dp-13},
+        {548,-0x1.89799a84916dap-14,-0x1.4272524e822abp-13},
+        {549,-0x1.1a7561b4cf0b9p-14,-0x1.79ec87af11483p-13},
+        {550,-0x1.1d461783fab78p-15,-0x1.a602e646eb3f5p-13},
+        {551,0x1.4908281c255bcp-18,-0x1.c2eb4d4b5d1a4p-13},
+        {552,0x1.8f5ad6f8cab3p-15,-0x1.cd969953a98b4p-13},
+        {553,0x1.819f6b186b3p-14,-0x1.c3f88e83eadb8p-13},
+        {554,0x1.1c2638b9b9d6bp-13,-0x1.a53e4ee1a25cap-13},
+        {555,0x1.70a3e35c2fef2p-13,-0x1.71edc804d27bap-13},
+        {556,0x1.b9499249095eap-13,-0x1.2bea748c26e94p-13},
+        {557,0x1.f1aeb8e6c0f4dp-13,-0x1.acbc51742ceaep-14},
+        {558,0x1.0b2ba5cd5acb8p-12,-0x1.d61caf4776b68p-15},
+        {559,0x1.127c51b97c668p-12,-0x1.cdeb0ebb85a64p-18},
+        {560,0x1.0e539b1651a27p-12,0x1.65b76a0fbcca7p-15},
+        {561,0x1.fde9073c7fe22p-13,0x1.790dd3b8dd186p-14},
+        {562,0x1.caab283991281p-13,0x1.15a9062d3bc4cp-13},
+        {563,0x1.861b3b113804cp-13,0x1.60557f8489936p-13},
+        {564,0x1.34686c5aa477p-13,0x1.9910098dfc9b4p-13},
+        {565,0x1.b4e3103803c58p-14,0x1.bd9774a970b5p-13},
+        {566,0x1.f59da399532bap-15,0x1.cd047e95f2b66p-13},
+        {567,0x1.135f47be94456p-16,0x1.c7ccc5ae1675ap-13},
+        {568,-0x1.8e5328e4cb8cp-16,0x1.afaa759d3b06p-13},
+        {569,-0x1.ed007041ef326p-15,0x1.876bb2be265f4p-13},
+        {570,-0x1.6de498fa608cdp-14,0x1.52aedd073181ap-13},
+        {571,-0x1.c5f9afcd0cdd3p-14,0x1.15924a3ca969fp-13},
+        {572,-0x1.fd4f9f4529eb4p-14,0x1.a8bddd2c770c2p-14},
+        {573,-0x1.0a5c257a0dc36p-13,0x1.266b075960d3ap-14},
+        {574,-0x1.078235a6708dp-13,0x1.571470b372411p-15},
+        {575,-0x1.f09d22e708652p-14,0x1.f10cf5742ad3p-17},
+        {576,-0x1.bf059685b7cfap-14,-0x1.d6f2ce2b8c5d3p-18},
+        {577,-0x1.805177ae84b24p-14,-0x1.924fafec17277p-16},
+        {578,-0x1.3a9d8767f9b8fp-14,-0x1.2cfdfc5cc9021p-15},
+        {579,-0x1.e72bca810d5cdp-15,-0x1.67fead4067dc2p-15},
+        {580,-0x1.602771b8f636ap-15,-0x1.7e7103da1787ep-15},
+        {581,-0x1.cf62dd4ced43ap-16,-0x1.768c9d0d30946p-15},
+        {582,-0x1.05ae3ea91858cp-16,-0x1.57ad797564ed8p-15},
+        {583,-0x1.a14ce58beebcfp-18,-0x1.29898b54bea26p-15},
+        {584,0x1.03ad9cd732f7ap-21,-0x1.e6f587134a46ap-16},
+        {585,0x1.3b87ad37a28ddp-18,-0x1.77d8d0bd423f2p-16},
+        {586,0x1.c821c74b57ec2p-18,-0x1.0feaa642b9506p-16},
+        {587,0x1.e553c500311fdp-18,-0x1.6c8c0da575aacp-17},
+        {588,0x1.b4af88b20593ap-18,-0x1.bb9f8f57eebcap-18},
+        {589,0x1.5676ed716bcfcp-18,-0x1.d7ac80b70666ep-19},
+        {590,0x1.cd3ded6b63e81p-19,-0x1.9412580560b52p-20},
+        {546,0x1.0488a82a3cad7p-18,0x1.03a165e4bd24fp-19},
+        {547,0x1.6eb8ae8078fccp-18,0x1.14ab73df6aca5p-18},
+        {548,0x1.c2ef89022e83dp-18,0x1.ed7aa5e18453ep-18},
+        {549,0x1.e6d79d154b4ddp-18,0x1.87787a393333ap-17},
+        {550,0x1.bcc5535d4002bp-18,0x1.1ccc61488dbf7p-16},
+        {551,0x1.2664717c9cc56p-18,0x1.828b54a9f759cp-16},
+        {552,0x1.017e51a5c3c9ep-23,0x1.ee35facac3bcfp-16},
+        {553,-0x1.b38cf86fd7d8bp-18,0x1.2b2e01a330628p-15},
+        {554,-0x1.05e4bf1936f89p-16,0x1.57a03399870d2p-15},
+        {555,-0x1.c86ec502475c7p-16,0x1.75c50e2f3fc42p-15},
+        {556,-0x1.57f6311e0f264p-15,0x1.7e9f27e0966cep-15},
+        {557,-0x1.d9b6a7cbc530ap-15,0x1.6b7a5c1e1382p-15},
+        {558,-0x1.316acfd09d11ap-14,0x1.36974a9157093p-15},
+        {559,-0x1.755e61eacfb02p-14,0x1.b7b2a353bdb78p-16},
+        {560,-0x1.b3a85b3791536p-14,0x1.6599271ba650cp-17},
+        {561,-0x1.e6c8a80cd0356p-14,-0x1.3f641e047af6p-17},
+        {562,-0x1.049899bcfd74dp-13,-0x1.1be76096059fp-15},
+        {563,-0x1.0adbabc42997cp-13,-0x1.01ce6b07fbab4p-14},
+        {564,-0x1.04049ff2e518dp-13,-0x1.7e69f149da87ep-14},
+        {565,-0x1.dd1d045604095p-14,-0x1.fd6de8e1aabecp-14},
+        {566,-0x1.938f0d4b129f2p-14,-0x1.3bcb123aad92bp-13},
+        {567,-0x1.2be622679c954p-14,-0x1.7293d53e57817p-13},
+        {568,-0x1.516a93e563p-15,-0x1.9f3c6b3bc9d26p-13},
+        {569,-0x1.d2c8206cb2e04p-19,-0x1.be4117000bdcap-13},
+        {570,0x1.380ad3563f1c6p-15,-0x1.ccb611e867e1bp-13},
+        {571,0x1.4f2af55f5369ep-14,-0x1.c886d6ed83644p-13},
+        {572,0x1.00efc68e5cb4dp-13,-0x1.b0a82dfda3e22p-13},
+        {573,0x1.5559b306c1aa7p-13,-0x1.85383cd2d913fp-13},
+        {574,0x1.a031e5d4ad6bcp-13,-0x1.4789488ad9ad4p-13},
+        {575,0x1.dd3fb062288f8p-13,-0x1.f42b24732d91fp-14},
+        {576,0x1.047fd522116fcp-12,-0x1.40b95042c23d7p-14},
+        {577,0x1.10723cb443a69p-12,-0x1.f563b9cd26e69p-16},
+        {578,0x1.11c331732cd6p-12,0x1.312e8e089e2aep-16},
+        {579,0x1.085ed2e419308p-12,0x1.121f1d30786a4p-14},
+        {580,0x1.e9a566641c85ap-13,0x1.ca4d5e3f5741cp-14},
+        {581,0x1.b086eb0fd735cp-13,0x1.35f52b1d2bc22p-13},
+        {582,0x1.68aeeb207a5p-13,0x1.77c348b6ac046p-13},
+        {583,0x1.163087746703ep-13,0x1.a7d2ee7c8ca3p-13},
+        {584,0x1.7b36097fe37a3p-14,0x1.c4878cdef33b8p-13},
+        {585,0x1.8ea1a1cf43106p-15,0x1.cd77dec4cd5ep-13},
+        {586,0x1.9d72488dac084p-18,0x1.c368ac6576c9dp-13},
+        {587,-0x1.09eecb63e73dep-15,0x1.a831aff31b7d4p-13},
+        {588,-0x1.0e41be2fd48d8p-14,0x1.7e8f8a71dceadp-13},
+        {589,-0x1.7cf50593751e8p-14,0x1.49e73628b8094p-13},
+        {590,-0x1.cdfd7062b261dp-14,0x1.0e0071f19e53cp-13},
+        {591,-0x1.002aee8f61d4ep-13,0x1.9d7a4f3b20575p-14},
+        {592,-0x1.0a779b64f09p-13,0x1.1fa78f494e88ap-14},
+        {593,-0x1.073a0e54862fbp-13,0x1.52480e2b824aap-15},
+        {594,-0x1.f0f01637a45fap-14,0x1.fac49f126d6c2p-17},
+        {595,-0x1.c1639a9a75836p-14,-0x1.9c5edb9079daap-18},
+        {596,-0x1.854f3ee2ecf06p-14,-0x1.7f569d045b20ap-16},
+        {597,-0x1.4240694323ddcp-14,-0x1.2409498426ea6p-15},
+        {598,-0x1.fad1fc008e6bap-15,-0x1.61dd9bbd95d54p-15},
+        {599,-0x1.7693840e73bap-15,-0x1.7cc572d5e7812p-15},
+        {600,-0x1.fdd377144b0efp-16,-0x1.7a29b75bc0c59p-15},
+        {601,-0x1.31ad12aa030e3p-16,-0x1.6092f79372812p-15},
+        {602,-0x1.1ca89423c3cbap-17,-0x1.36fbd5933dc08p-15},
+        {603,-0x1.549d1c9636a5cp-20,-0x1.04316a01df422p-15},
+        {604,0x1.dbeab0185ff82p-19,-0x1.9c9c5d75886b2p-16},
+        {605,0x1.a32bc20e95588p-18,-0x1.34b060aece3fbp-16},
+        {606,0x1.e4efd9acfbf24p-18,-0x1.b01bc70d8208bp-17},
+        {607,0x1.d142abfcc6c9cp-18,-0x1.16c4539e5c262p-17},
+        {608,0x1.863f8f507cb8ep-18,-0x1.42ef8dee7314cp-18},
+        {609,0x1.1f4111205c142p-18,-0x1.3f427e9c849cdp-19},
+        {610,0x1.659f9bbf2bd45p-19,-0x1.df09ccdba3092p-21},
+        {559,0x1.5252c06e94a1ep-19,0x1.aa82b80d13f5cp-21},
+        {560,0x1.1253928886302p-18,0x1.20fb26a98f4eap-19},
+        {561,0x1.788c8bc589e96p-18,0x1.26d26663a24ecp-18},
+        {562,0x1.c7a7de53f46dcp-18,0x1.001782904dc1ep-17},
+        {563,0x1.e6e793f87b62ep-18,0x1.8f3e62450b026p-17},
+        {564,0x1.baaf3f1bbb272p-18,0x1.1ef220fb0327ep-16},
+        {565,0x1.26e9d193c7c59p-18,0x1.8236ac246868ap-16},
+        {566,0x1.1fc7298d3424ap-22,0x1.eb22c68a58324p-16},
+        {567,-0x1.97f473497ad2p-18,0x1.28805a64d9972p-15},
+        {568,-0x1.f0dcd93fdfdeep-17,0x1.54816cf89c93ep-15},
+        {569,-0x1.b28779d4217eap-16,0x1.736e46d87ae9dp-15},
+        {570,-0x1.48326784fc883p-15,0x1.7ecd592dadc3p-15},
+        {571,-0x1.c51ba4ff9b9d2p-15,0x1.7057cb3e6e874p-15},
+        {572,-0x1.250f949a21659p-14,0x1.428f87fd08115p-15},
+        {573,-0x1.67c72815c0e9ep-14,0x1.e2b26bfb1416fp-16},
+        {574,-0x1.a622acf9d77a8p-14,0x1.ea30df8171918p-17},
+        {575,-0x1.db185e5e780ccp-14,-0x1.0cad14c1e0ee8p-18},
+        {576,-0x1.00bdd7727e4fp-13,-0x1.c01c55b477265p-16},
+        {577,-0x1.0a2f9a913a8acp-13,-0x1.bb01c9c737484p-15},
+        {578,-0x1.07be0d2a2806ap-13,-0x1.54e7803ffcd46p-14},
+        {579,-0x1.ef96a544280f8p-14,-0x1.d0b0caba772f8p-14},
+        {580,-0x1.b2d718ce846a8p-14,-0x1.252fdd068ea6ap-13},
+        {581,-0x1.590e852d44721p-14,-0x1.5d720124786a6p-13},
+        {582,-0x1.c7c0bc3e3dcbp-15,-0x1.8d86760f3462cp-13},
+        {583,-0x1.5b2e4e77f91dcp-16,-0x1.b2039cfeadcaap-13},
+        {584,0x1.23be598c7d442p-16,-0x1.c7ee4b4dbf9b4p-13},
+        {585,0x1.e919afe4d8bdap-15,-0x1.ccf533580e55ap-13},
+        {586,0x1.a42148f8d249ap-14,-0x1.bfa30b868968ep-13},
+        {587,0x1.278978f43f1e8p-13,-0x1.9f83110a2278cp-13},
+        {588,0x1.76511d03b2daap-13,-0x1.6d347c6553efap-13},
+        {589,0x1.ba3d91254db1ap-13,-0x1.2a6aca9eba93p-13},
+        {590,0x1.efa1a6b25b3eep-13,-0x1.b3b4858a951c2p-14},
+        {591,0x1.09c6754621b81p-12,-0x1.fc46e9c5e5593p-15},
+        {592,0x1.11ffb7a55ec03p-12,-0x1.e442894deacc8p-17},
+        {593,0x1.1006ac6819cdp-12,0x1.0fe83e51473c8p-15},
+        {594,0x1.03f7a862bb6bep-12,0x1.45fa519754e6cp-14},
+        {595,0x1.dcfe917b6f1e8p-13,0x1.f49b93a2570e7p-14},
+        {596,0x1.a19cd8ae22016p-13,0x1.45f0df4c8d45ep-13},
+        {597,0x1.590a3067682dap-13,0x1.82a61f97d0148p-13},
+        {598,0x1.072bed4016104p-13,0x1.ae18a05c9c67ap-13},
+        {599,0x1.6092cc37d4baap-14,0x1.c6fe1192a9a45p-13},
+        {600,0x1.630ea435cc535p-15,0x1.cd22a349832e3p-13},
+        {601,0x1.336eed5d0081cp-19,0x1.c1613231cf71ep-13},
+        {602,-0x1.1f54e6092eccep-15,0x1.a588ed918f712p-13},
+        {603,-0x1.14122fe3e617cp-14,0x1.7c331c44dcafcp-13},
+        {604,-0x1.7f032b6e03322p-14,0x1.488cd5aa45208p-13},
+        {605,-0x1.cdb474cad318cp-14,0x1.0e1955d5724c6p-13},
+        {606,-0x1.ff392bd3d70fcp-14,0x1.a0e3f477da055p-14},
+        {607,-0x1.0a3535b7badacp-13,0x1.2611cfb4fcf18p-14},
+        {608,-0x1.07d93c3431106p-13,0x1.63cb8b50769c7p-15},
+        {609,-0x1.f4bf48439cc16p-14,0x1.25e047709f5b8p-16},
+        {610,-0x1.c8241b8832d54p-14,-0x1.ed7f29e9179d6p-19},
+        {611,-0x1.8ef2ccb8444d5p-14,-0x1.599811a659d61p-16},
+        {612,-0x1.4e558dd7b57eep-14,-0x1.15027d312284ep-15},
+        {613,-0x1.0b312279c1b72p-14,-0x1.5833bc256bdcap-15},
+        {614,-0x1.93ac9d589571ep-15,-0x1.79584af162653p-15},
+        {615,-0x1.1b8eba476e808p-15,-0x1.7d260db71dcb2p-15},
+        {616,-0x1.6651f0979ff32p-16,-0x1.697abc81d76fcp-15},
+        {617,-0x1.767bc578a3f75p-17,-0x1.44c1d9d1d9022p-15},
+        {618,-0x1.c2a9160d6b6a2p-19,-0x1.15638895f9c86p-15},
+        {619,0x1.1abdffadcd2c5p-19,-0x1.c28f0daac99cap-16},
+        {620,0x1.6dd035f51614ap-18,-0x1.5ae93cda3994dp-16},
+        {621,0x1.d676b28c76208p-18,-0x1.f7459e5fd4904p-17},
+        {622,0x1.e241b6461a736p-18,-0x1.541e8607bc134p-17},
+        {623,0x1.ad6a9b547f584p-18,-0x1.a4404324894fap-18},
+        {624,0x1.52b26e238f106p-18,-0x1.ca9be56af5eb1p-19},
+        {625,0x1.d27b63be84ab2p-19,-0x1.9bc9f7a8fb77ep-20},
+        {574,0x1.a8ec66e296226p-19,0x1.531463ff7fdfp-20},
+        {575,0x1.3bbdb263e9fa6p-18,0x1.8717cc3483f0cp-19},
+        {576,0x1.9961aca89c30ep-18,0x1.6de85360af54ep-18},
+        {577,0x1.d900f0fffeb17p-18,0x1.2ca6165fe6104p-17},
+        {578,0x1.e2956f2730568p-18,0x1.c290e0e610906p-17},
+        {579,0x1.9c2b841dd92a9p-18,0x1.3a503ad9799e8p-16},
+        {580,0x1.d853711a601cp-19,0x1.9d388a0df201ep-16},
+        {581,-0x1.0ff1cb3df33ecp-20,0x1.01c8271ab9384p-15},
+        {582,-0x1.026f2df8148fcp-17,0x1.3262a2322a5c8p-15},
+        {583,-0x1.1790bebccdd3ep-16,0x1.5b3e4475f194bp-15},
+        {584,-0x1.d326fb31fe1b4p-16,0x1.7692e53300072p-15},
+        {585,-0x1.57e4179356b4p-15,0x1.7e61b1dc527e3p-15},
+        {586,-0x1.d2d9b2ca723b8p-15,0x1.6cedec3a98ed2p-15},
+        {587,-0x1.2a67a88d42e0bp-14,0x1.3d41f90512826p-15},
+        {588,-0x1.6b42c04c1b324p-14,0x1.d76c9ddf202d6p-16},
+        {589,-0x1.a7ba3d0a770d8p-14,0x1.d9ba55c722411p-17},
+        {590,-0x1.db21d519281d4p-14,-0x1.11f806ca2bb7ap-18},
+        {591,-0x1.00581a4256a6dp-13,-0x1.b70682692924ap-16},
+        {592,-0x1.09ea958c43b46p-13,-0x1.aff9a0c48b4bcp-15},
+        {593,-0x1.084a47b0d01efp-13,-0x1.4bde2a791862cp-14},
+        {594,-0x1.f3ded5797d239p-14,-0x1.c455c29a08f9cp-14},
+        {595,-0x1.bbe00476bf5ffp-14,-0x1.1db98658a5dbp-13},
+        {596,-0x1.683e016be3c9ap-14,-0x1.555b9817092eep-13},
+        {597,-0x1.f480291d34f9ap-15,-0x1.85bc30d8c0a9ep-13},
+        {598,-0x1.d36c3cb9382abp-16,-0x1.aba7d4d427508p-13},
+        {599,0x1.1b04604a231fbp-17,-0x1.c444a2b1f7428p-13},
+        {600,0x1.90ed624964b3ap-15,-0x1.cd479988d2a8p-13},
+        {601,0x1.734c29aa71b86p-14,-0x1.c522c5c4f3862p-13},
+        {602,0x1.0e055c69caa7ep-13,-0x1.ab288a12b305cp-13},
+        {603,0x1.5d4b4316c011ap-13,-0x1.7fa0f19337491p-13},
+        {604,0x1.a3865d9b44fb6p-13,-0x1.43cef7f1bd386p-13},
+        {605,0x1.dd2125d9288d7p-13,-0x1.f3c9cc63167c8p-14},
+        {606,0x1.038e68f44ffe8p-12,-0x1.49d05e3309e89p-14},
+        {607,0x1.0fa19ee681b78p-12,-0x1.221a0042ccbc6p-15},
+        {608,0x1.12261305f9a9ap-12,0x1.721191ab13376p-17},
+        {609,0x1.0af97001d0889p-12,0x1.d6f47e0927a32p-15},
+        {610,0x1.f4fae80eda795p-13,0x1.9e186a9d88809p-14},
+        {611,0x1.c322ec5f51f5p-13,0x1.1f1e8203441a4p-13},
+        {612,0x1.830751d1c6799p-13,0x1.6291440ec5e48p-13},
+        {613,0x1.37f67107d4832p-13,0x1.96c058d0a0eb5p-13},
+        {614,0x1.cb73b5c28ea58p-14,0x1.b9ea54013c7aep-13},
+        {615,0x1.20b17ae99c3edp-14,0x1.cb44d1011ee68p-13},
+        {616,0x1.debfad9b4d12ep-16,0x1.caffe63e2f538p-13},
+        {617,-0x1.403927c9b5e2ep-17,0x1.ba38f1629df1cp-13},
+        {618,-0x1.6faf96a109771p-15,0x1.9ade35fce9211p-13},
+        {619,-0x1.326d652b0edfep-14,0x1.6f85e4e2bd5c8p-13},
+        {620,-0x1.93f9c6e3ef774p-14,0x1.3b3c01b876498p-13},
+        {621,-0x1.da56e2b2b1559p-14,0x1.014b2ca6794b6p-13},
+        {622,-0x1.0284fd493671ep-13,0x1.8a091d17e22dcp-14},
+        {623,-0x1.0a94e92746204p-13,0x1.1316083ef42b8p-14},
+        {624,-0x1.0695c0b5857c7p-13,0x1.4694ba57e3d64p-15},
+        {625,-0x1.f09b497d6e36cp-14,0x1.f9953eff937bap-17},
+        {626,-0x1.c3c812a7f82dp-14,-0x1.5d5ede3b4fbcdp-18},
+        {627,-0x1.8b68d065f0042p-14,-0x1.66f367a02e5e6p-16},
+        {628,-0x1.4c430ea3979a6p-14,-0x1.176c8da50aa2fp-15},
+        {629,-0x1.0ad94ae9bd1b1p-14,-0x1.584884e8fd9bp-15},
+        {630,-0x1.964d3a8a5c0b7p-15,-0x1.78d5df09291a2p-15},
+        {631,-0x1.20d762af87e72p-15,-0x1.7d6dbab89b624p-15},
+        {632,-0x1.743d46d70ffc4p-16,-0x1.6b76b59da5e25p-15},
+        {633,-0x1.9497cc365902ap-17,-0x1.48dd7d9d5a776p-15},
+        {634,-0x1.19a2c784bf767p-18,-0x1.1b948105dd2cap-15},
+        {635,0x1.7f87da7b33327p-20,-0x1.d2488b1076b62p-16},
+        {636,0x1.4fbd273778cfcp-18,-0x1.6ca7221d98826p-16},
+        {637,0x1.c9c34555bee0ep-18,-0x1.0dd78b01776p-16},
+        {638,0x1.e65467d6f73dp-18,-0x1.766b8e134f978p-17},
+        {639,0x1.bf8637f4a4beap-18,-0x1.df8f0476181f4p-18},
+        {640,0x1.6e9eff8b42e04p-18,-0x1.13dccb7035788p-18},
+        {641,0x1.0a0ffe6666104p-18,-0x1.0e6dd4e37ae68p-19},
+        {595,0x1.eb2ef4e8010a8p-19,0x1.c82460d0c0ccep-20},
+        {596,0x1.582d80d746864p-18,0x1.da6b0b1c1512bp-19},
+        {597,0x1.ace6c2c697bf1p-18,0x1.a1b6409b7f822p-18},
+        {598,0x1.e07d524c5adfap-18,0x1.49967156280c2p-17},
+        {599,0x1.dcd1bb47d8e1cp-18,0x1.dfd3526e3dcc9p-17},
+        {600,0x1.8a779506a9c84p-18,0x1.4799590e00732p-16},
+        {601,0x1.a5638ef11b867p-19,0x1.a7c5ceb73a974p-16},
+        {602,-0x1.7904b693bd7bbp-20,0x1.05343c1e9a12ap-15},
+        {603,-0x1.0b5b40a124f9bp-17,0x1.33d3b3491766ap-15},
+        {604,-0x1.174da626b0ad4p-16,0x1.5b11ca1cc9d2cp-15},
+        {605,-0x1.cb998a89049f6p-16,0x1.75bb32218bd3p-15},
+        {606,-0x1.4f6e535193e17p-15,0x1.7e6cd5891f27ep-15},
+        {607,-0x1.c526bbf70ca66p-15,0x1.6ff89ba14bc2ep-15},
+        {608,-0x1.2103baf97aefep-14,0x1.45d46f1c1b0dp-15},
+        {609,-0x1.5fdc28308a254p-14,0x1.f916eb25d1103p-16},
+        {610,-0x1.9b5c00595daa8p-14,0x1.2450d1dd97f61p-16},
+        {611,-0x1.cf5db585e7177p-14,0x1.a3ee92f4af58cp-21},
+        {612,-0x1.f7939d3ab8499p-14,-0x1.487eb3fd8fc88p-16},
+        {613,-0x1.07e7348faebe8p-13,-0x1.6a0a53d56d1a5p-15},
+        {614,-0x1.0a245f3d861f7p-13,-0x1.22308bafd6c5ap-14},
+        {615,-0x1.00f94d6b2733dp-13,-0x1.95664c51c7b32p-14},
+        {616,-0x1.d6b6d4542f278p-14,-0x1.04c99882174bfp-13},
+        {617,-0x1.91b516688f609p-14,-0x1.3c85651832a46p-13},
+        {618,-0x1.336b43f5462c6p-14,-0x1.6eeab7348bdaep-13},
+        {619,-0x1.7b9441e462442p-15,-0x1.9904856447c5p-13},
+        {620,-0x1.a194002b62798p-17,-0x1.b81386621392dp-13},
+        {621,0x1.9298b2a336833p-16,-0x1.c9bc7d5908a8cp-13},
+        {622,0x1.06e9342039de8p-14,-0x1.cc328dcee592ap-13},
+        {623,0x1.abe77cb803bd7p-14,-0x1.be5a6eaf6021bp-13},
+        {624,0x1.2639d1bbcb96p-13,-0x1.9fe3bb9bd7f5ap-13},
+        {625,0x1.70a3e69ed005ep-13,-0x1.71564559faa3cp-13},
+        {626,0x1.b1b8456741778p-13,-0x1.3412128bf50d8p-13},
+        {627,0x1.e65ad27e7b149p-13,-0x1.d48362590f8bap-14},
+        {628,0x1.05fe68d9e76c4p-12,-0x1.2d7eea3bb7256p-14},
+        {629,0x1.10625a5aa99bep-12,-0x1.e779a4f4ee416p-16},
+        {630,0x1.11d59442c65c6p-12,0x1.f7112d519f67fp-17},
+        {631,0x1.0a45a9c49417ep-12,0x1.e9fa5d682e54fp-15},
+        {632,0x1.f4251ca2b4606p-13,0x1.a0d324c981a5ep-14},
+        {633,0x1.c41151d8f5a6cp-13,0x1.1dabcb693b5b2p-13},
+        {634,0x1.86a8864d69f4cp-13,0x1.5f3a3bd2adb48p-13},
+        {635,0x1.3ede6fa3f49e1p-13,0x1.92ae88b52de5p-13},
+        {636,0x1.e028af4ec962ap-14,0x1.b665aa99cdaf4p-13},
+        {637,0x1.3bcba05a72d77p-14,0x1.c991e907d17b8p-13},
+        {638,0x1.2fccc622e807p-15,0x1.cc3f3d6ade9aep-13},
+        {639,-0x1.293f7b759cb3ap-20,0x1.bf4a2ca06648ep-13},
+        {640,-0x1.27634df6f48a1p-15,0x1.a44a1be4a2bdp-13},
+        {641,-0x1.1026d2397929ep-14,0x1.7d7101f26f612p-13},
+        {642,-0x1.76326aa9c4317p-14,0x1.4d630744b0925p-13},
+        {643,-0x1.c36c4fb01adb6p-14,0x1.1709239dbecap-13},
+        {644,-0x1.f6e0ff9a098efp-14,0x1.bac40658099fep-14},
+        {645,-0x1.08821caf48edp-13,0x1.46a8f023782e9p-14},
+        {646,-0x1.09c6ecc4debf2p-13,0x1.ae19e1d522a51p-15},
+        {647,-0x1.00a2556d7e584p-13,0x1.c1d96ad32438fp-16},
+        {648,-0x1.ddbbfd7bf206ap-14,0x1.673ded4f93454p-18},
+        {649,-0x1.ad09854be5911p-14,-0x1.a40b44df92a0cp-17},
+        {650,-0x1.737937b141e5p-14,-0x1.bc3d1f4dc0874p-16},
+        {651,-0x1.3544a4ff3cf4p-14,-0x1.31e02406edd9ep-15},
+        {652,-0x1.eca5475b25a4p-15,-0x1.65ade334d19b3p-15},
+        {653,-0x1.74064f38dba33p-15,-0x1.7c8cc9961e5d2p-15},
+        {654,-0x1.0613cdd62ec1p-15,-0x1.7aba5099dc752p-15},
+        {655,-0x1.4d645753b56f8p-16,-0x1.653c666eac478p-15},
+        {656,-0x1.60e14fb7e1a97p-17,-0x1.4170c3b33edabp-15},
+        {657,-0x1.b82b01ea751c4p-19,-0x1.14a4134698cf2p-15},
+        {658,0x1.fc22685a8d02ap-20,-0x1.c76ff1ab38f5cp-16},
+        {659,0x1.5bad40de08056p-18,-0x1.65ba4a1454fffp-16},
+        {660,0x1.cc21a7e37ddd5p-18,-0x1.0ac90760249dp-16},
+        {661,0x1.e67117bd485d4p-18,-0x1.76a17388cf79ep-17},
+        {662,0x1.c20bbd3f2fe9ap-18,-0x1.e86183a2b996ep-18},
+        {663,0x1.75acb3b20891ep-18,-0x1.20826f90a1bfap-18},
+        {664,0x1.15a70789587b4p-18,-0x1.274d543a4dc96p-19},
+        {665,0x1.65609be1d7e42p-19,-0x1.d9be5b6c36d3ap-21},
+        {611,0x1.8855f38df3166p-19,0x1.1e085e35e9b5ep-20},
+        {612,0x1.24d386e9e929dp-18,0x1.4a6f37c1911e1p-19},
+        {613,0x1.809c4437672dcp-18,0x1.35a3e90426dffp-18},
+        {614,0x1.c7a8547284d64p-18,0x1.fe5bf8c11c747p-18},
+        {615,0x1.e6f8b42fb7428p-18,0x1.8057d1adff371p-17},
+        {616,0x1.c985a8bda0414p-18,0x1.0e1cf3a0e4b23p-16},
+        {617,0x1.59c16a41bdba5p-18,0x1.66c55b75b40d9p-16},
+        {618,0x1.06e1120094885p-19,0x1.c5c5c2a162496p-16},
+        {619,-0x1.948bd765cbb24p-19,0x1.1282a11e442f3p-15},
+        {620,-0x1.4d5ba67f89c6ap-17,0x1.3e6c864299ef8p-15},
+        {621,-0x1.3c6c17eaa49bdp-16,0x1.622a54b5bfbp-15},
+        {622,-0x1.f26f15bc41ae6p-16,0x1.78e0c2d70f74p-15},
+        {623,-0x1.625cd4016ab0cp-15,0x1.7d9c82a6ce06p-15},
+        {624,-0x1.d6441eecb4123p-15,0x1.6bac6bd5ea2a1p-15},
+        {625,-0x1.2816df4721402p-14,0x1.3f031ed5fa59ep-15},
+        {626,-0x1.650e3581a1cbap-14,0x1.e93294647e64dp-16},
+        {627,-0x1.9e887d39b4decp-14,0x1.15920ac16f451p-16},
+        {628,-0x1.d0afed3fbce7fp-14,0x1.9a8f1ccaabcdp-23},
+        {629,-0x1.f78e377c32962p-14,-0x1.4a09933b13066p-16},
+        {630,-0x1.07a51d0a3251fp-13,-0x1.6527b35a3404ep-15},
+        {631,-0x1.0a34f411fbb7p-13,-0x1.1c732b9a6a49cp-14},
+        {632,-0x1.020a025a42b1p-13,-0x1.8c434eb38bf4cp-14},
+        {633,-0x1.dc4cfde14b048p-14,-0x1.fd638fcaf2abap-14},
+        {634,-0x1.9c2a423336cc6p-14,-0x1.3552865057f55p-13},
+        {635,-0x1.43f7d2d02192ep-14,-0x1.6746c81406b34p-13},
+        {636,-0x1.aa992c786718fp-15,-0x1.91d20b3454b0fp-13},
+        {637,-0x1.4c2bf79ef887ap-16,-0x1.b2612a22e3edcp-13},
+        {638,0x1.f5992af980054p-17,-0x1.c6b3037ca2fecp-13},
+        {639,0x1.b58aac4ec3336p-15,-0x1.ccfe4a29fbea8p-13},
+        {640,0x1.7b2fe38f94821p-14,-0x1.c411d7e71fe1fp-13},
+        {641,0x1.0cb78295fe7ecp-13,-0x1.ab6d24989df84p-13},
+        {642,0x1.5766a127303dep-13,-0x1.834efc0cfd12dp-13},
+        {643,0x1.9a5ff113fe07cp-13,-0x1.4cb92a11157ecp-13},
+        {644,0x1.d2a1c97b917e8p-13,-0x1.09688ef2e48e4p-13},
+        {645,0x1.fd99a7f6d73c7p-13,-0x1.7783ae652103ap-14},
+        {646,0x1.0ca4f5224f31ap-12,-0x1.9acf654a05d0fp-15},
+        {647,0x1.1233a7417c9b2p-12,-0x1.b22aacb41f225p-18},
+        {648,0x1.0f36209be7259p-12,0x1.306e4b8f0ead7p-15},
+        {649,0x1.03d0568e6583ap-12,0x1.4582c676f90d5p-14},
+        {650,0x1.e115c5f3c6351p-13,0x1.e5ef85875a54ep-14},
+        {651,0x1.ac9616fc54848p-13,0x1.39ad60b79bbap-13},
+        {652,0x1.6c8ae791b38b4p-13,0x1.74505e7e19af2p-13},
+        {653,0x1.23d8be0749404p-13,0x1.a0eec14b87d84p-13},
+        {654,0x1.ab6ab95e7f0f8p-14,0x1.be4cfd3e531cp-13},
+        {655,0x1.0af3f8cb1daa1p-14,0x1.cbf15d0d599c6p-13},
+        {656,0x1.b3a5dec197c38p-16,0x1.ca23ce73e97aap-13},
+        {657,-0x1.443c809e5b372p-17,0x1.b9e265a19c923p-13},
+        {658,-0x1.5fdfd9abe96fap-15,0x1.9ccbaa0572594p-13},
+        {659,-0x1.24df088d9368bp-14,0x1.750066c86df4p-13},
+        {660,-0x1.84118453c791cp-14,0x1.44ff3d48f358cp-13},
+        {661,-0x1.cb8bacd61246ep-14,0x1.0f7c8f01d737cp-13},
+        {662,-0x1.fa9f0c7d29b92p-14,0x1.ae72f292efcc9p-14},
+        {663,-0x1.08ede9c3b35d2p-13,0x1.3db91e1960f88p-14},
+        {664,-0x1.097812db83a6p-13,0x1.a33af7a0a906ap-15},
+        {665,-0x1.003c3fe061549p-13,0x1.b8f31a381eaep-16},
+        {666,-0x1.ddc5409d36d0fp-14,0x1.6d41a065bee36p-18},
+        {667,-0x1.ae99e6e132a2ep-14,-0x1.92c3cdac8db2ap-17},
+        {668,-0x1.76eaba3078a78p-14,-0x1.b0176a5cbad33p-16},
+        {669,-0x1.3a9d661cebd11p-14,-0x1.2bd23bdf9769ep-15},
+        {670,-0x1.faa10d9652676p-15,-0x1.613001193ee6cp-15},
+        {671,-0x1.845abe40326d6p-15,-0x1.7acaead10d4c6p-15},
+        {672,-0x1.178beea308729p-15,-0x1.7c6b8aea4866bp-15},
+        {673,-0x1.70033e8c37b7ep-16,-0x1.6a9c1f57e044ep-15},
+        {674,-0x1.a091e7e5110ffp-17,-0x1.4a45fae84d84dp-15},
+        {675,-0x1.48281f4383728p-18,-0x1.20547257e04e2p-15},
+        {676,0x1.6092f01d3090fp-21,-0x1.e2c6b75fb613cp-16},
+        {677,0x1.24cf9f574cc12p-18,-0x1.82fb7b6c5098ep-16},
+        {678,0x1.b1782582820b2p-18,-0x1.27df3de3b18cp-16},
+        {679,0x1.e57b694b26b54p-18,-0x1.acb07c2afac0ep-17},
+        {680,0x1.d6362b392052fp-18,-0x1.231d435f7337p-17},
+        {681,0x1.9905a693a0b19p-18,-0x1.6c0e50a9adeb4p-18},
+        {682,0x1.41a882fd75778p-18,-0x1.962ab823b8471p-19},
+        {683,0x1.c208929f8383dp-19,-0x1.7b828bc9ec471p-20},
+        {629,0x1.f0cd27c11417cp-19,0x1.d108b7ac6db9ap-20},
+        {630,0x1.557d62f57728ep-18,0x1.d087254c64e9cp-19},
+        {631,0x1.a6c3e6e2cfcc6p-18,0x1.8f42bff2998bdp-18},
+        {632,0x1.dc253d9b7d509p-18,0x1.364b31cdb588bp-17},
+        {633,0x1.e32c61cb64096p-18,0x1.bf9d97c0dd13ap-17},
+        {634,0x1.a82434e778d23p-18,0x1.30381e5472797p-16},
+        {635,0x1.178a159f3cfebp-18,0x1.894fdce0e03e5p-16},
+        {636,0x1.fbf2b1b6faac5p-22,0x1.e675c22957c3bp-16},
+        {637,-0x1.4d235a8e2eb1ep-18,0x1.20c41c9c244fep-15},
+        {638,-0x1.9bbb8f76da744p-17,0x1.49898c731e739p-15},
+        {639,-0x1.68162ca6f9821p-16,0x1.69504c2c9c2e2p-15},
+        {640,-0x1.100888eef949p-15,0x1.7b95413959f9p-15},
+        {641,-0x1.78c48ecf66428p-15,0x1.7bd36ddbae9aep-15},
+        {642,-0x1.eade6d2c4cf9cp-15,0x1.65d43f3401a37p-15},
+        {643,-0x1.30e06858066e3p-14,0x1.3604ef6104188p-15},
+        {644,-0x1.6be11e13e75cfp-14,0x1.d3966d593f89cp-16},
+        {645,-0x1.a32e40b46e1dcp-14,0x1.ff4c2bff97cdep-17},
+        {646,-0x1.d33ccdd145345p-14,-0x1.ec36f89ab5929p-21},
+        {647,-0x1.f869441b3b34cp-14,-0x1.55b3246f24b8p-16},
+        {648,-0x1.0796c8daf6181p-13,-0x1.65f68225adecap-15},
+        {649,-0x1.0a2d2eb5d8e6cp-13,-0x1.19c9bfce29694p-14},
+        {650,-0x1.02a805992aa1ep-13,-0x1.864e1ea45b88ep-14},
+        {651,-0x1.e033a144fcabep-14,-0x1.f44e826f4b1a3p-14},
+        {652,-0x1.a41bbce710cecp-14,-0x1.2f87a13def341p-13},
+        {653,-0x1.513217666ba26p-14,-0x1.60c6209092e08p-13},
+        {654,-0x1.d18d64ce8a09ep-15,-0x1.8b5d59feef072p-13},
+        {655,-0x1.b54a56e71de46p-16,-0x1.ace7ce739ef67p-13},
+        {656,0x1.d96f438d39b56p-18,-0x1.c34359ae854e8p-13},
+        {657,0x1.66d12a6d2f67ap-15,-0x1.ccb2a2581da3ep-13},
+        {658,0x1.4ecb5ba2a72fcp-14,-0x1.c7fa52dc8d6f3p-13},
+        {659,0x1.e9dd0aec6d2cep-14,-0x1.b4781a8718b4ep-13},
+        {660,0x1.3f3c7967f5f07p-13,-0x1.9231cda12885p-13},
+        {661,0x1.834394455fc27p-13,-0x1.61db72967b738p-13},
+        {662,0x1.be26baa3066c4p-13,-0x1.24d399846fb6ep-13},
+        {663,0x1.ed5e8a0584b3ep-13,-0x1.ba2bf2c4ef4e1p-14},
+        {664,0x1.076e1d4b7b856p-12,-0x1.1a49de3c7deb6p-14},
+        {665,0x1.10932b241328p-12,-0x1.bf58a16307fbcp-16},
+        {666,0x1.11b6bb276607dp-12,0x1.f6957c961664p-17},
+        {667,0x1.0acbdb392efdep-12,0x1.d63c33d49ed9ep-15},
+        {668,0x1.f84223a69dca4p-13,0x1.8e97eddab3ddep-14},
+        {669,0x1.ccb80e9835a57p-13,0x1.119e879f1bcacp-13},
+        {670,0x1.94e0cf98e4d9ep-13,0x1.51e3ab3dd549cp-13},
+        {671,0x1.5325243371d0cp-13,0x1.85f720a52251ep-13},
+        {672,0x1.0a4dd4c8a55eep-13,0x1.ac4c598e8feb2p-13},
+        {673,0x1.7abb7155468eep-14,0x1.c3fe84f9e2d9p-13},
+        {674,0x1.bda5c8df2444ep-15,0x1.ccd6fb06230d1p-13},
+        {675,0x1.1b7ab1cc8c4a5p-16,0x1.c749e18ab0f1ap-13},
+        {676,-0x1.1e70f75abbc31p-16,0x1.b46980a18b76p-13},
+        {677,-0x1.8fa473c2eb0d8p-15,0x1.95d152d307d42p-13},
+        {678,-0x1.35e5a01facee4p-14,0x1.6d8a5b8024c0dp-13},
+        {679,-0x1.8f0bb656ef64ep-14,0x1.3deaaf185134ep-13},
+        {680,-0x1.d1a06aced3614p-14,0x1.0972558d837fap-13},
+        {681,-0x1.fd2874048832ap-14,0x1.a54f8a212affep-14},
+        {682,-0x1.09214c5920d84p-13,0x1.37ec4232b7d8cp-14},
+        {683,-0x1.0944f89b2cb19p-13,0x1.9e3ccad50c9dap-15},
+        {684,-0x1.0035eac3d177p-13,0x1.ba95c25cd6d35p-16},
+        {685,-0x1.def4d37ffa898p-14,0x1.97877c3ca2ac2p-18},
+        {686,-0x1.b1986eb46fed9p-14,-0x1.727dfa09dfcc9p-17},
+        {687,-0x1.7bf78905198cep-14,-0x1.9dff6f0efde0dp-16},
+        {688,-0x1.41a92ab4c5e48p-14,-0x1.2385e3dc88a92p-15},
+        {689,-0x1.0608f894b40b6p-14,-0x1.5b1de16586a02p-15},
+        {690,-0x1.981c130ceb75p-15,-0x1.780d8e3c0162ep-15},
+        {691,-0x1.2c58114c1a15ep-15,-0x1.7daa226bdd65ap-15},
+        {692,-0x1.98feddc1f1141p-16,-0x1.7004ce9e2cdafp-15},
+        {693,-0x1.ec3824dcaedf2p-17,-0x1.5394ef155fd0cp-15},
+        {694,-0x1.ca419ec265766p-18,-0x1.2ce5c5a243a7fp-15},
+        {695,-0x1.d50610c3ea4a9p-21,-0x1.004ce8c10400cp-15},
+        {696,0x1.b9d6fe6b5d901p-19,-0x1.a35aff2884848p-16},
+        {697,0x1.88e88a453d6bap-18,-0x1.4896299b5dec9p-16},
+        {698,0x1.da1956f2fdfacp-18,-0x1.eab58d0178ep-17},
+        {699,0x1.e3a644a1436bp-18,-0x1.5a546e0d38bbcp-17},
+        {700,0x1.b95edafc3e28ap-18,-0x1.c802f0e51466ep-18},
+        {701,0x1.6e332efe6a884p-18,-0x1.11e4c1c5d8939p-18},
+        {702,0x1.12fb1b3f0bfe3p-18,-0x1.202ab08f8899p-19},
+        {703,0x1.6b31d0111e482p-19,-0x1.e67466c4ada2ap-21},
+        {647,0x1.98ff339596cbp-19,0x1.35b350d3df9a6p-20},
+        {648,0x1.27a43a456f441p-18,0x1.5016903faf3f4p-19},
+        {649,0x1.7e31f9c4fc7ep-18,0x1.2fea1b62d991ep-18},
+        {650,0x1.c2dd230b7fc45p-18,0x1.e9c2ffced7769p-18},
+        {651,0x1.e5d5d4e0db858p-18,0x1.6b7b9bc7bd152p-17},
+        {652,0x1.d594fb2dd3166p-18,0x1.fa52303dc045p-17},
+        {653,0x1.7ff4c7fa12a78p-18,0x1.4eba918b613a5p-16},
+        {654,0x1.a7112bcb47d5fp-19,0x1.a71e263bcde56p-16},
+        {655,-0x1.f6f4df8097baep-21,0x1.00cf08a2e62cfp-15},
+        {656,-0x1.c299c181cc0ccp-18,0x1.2c1be23e8f8b2p-15},
+        {657,-0x1.dece45b40545ep-17,0x1.51e6ad208c11bp-15},
+        {658,-0x1.8bc3c2ee049cap-16,0x1.6e39c2d74217ep-15},
+        {659,-0x1.21c60505748dp-15,0x1.7cece116d567ap-15},
+        {660,-0x1.8933d3b8eb377p-15,0x1.79e424c420dedp-15},
+        {661,-0x1.f8e43635b6c5ep-15,0x1.6156a1e603874p-15},
+        {662,-0x1.36403b4ff101ap-14,0x1.3018713beb2c2p-15},
+        {663,-0x1.6f6079d6dc49ap-14,0x1.c7c6d15db97ebp-16},
+        {664,-0x1.a4cf8acda4c92p-14,0x1.ee65798207f5bp-17},
+        {665,-0x1.d34c826f35cf9p-14,-0x1.10a4b1c67e915p-20},
+        {666,-0x1.f78222b6d6d58p-14,-0x1.4d6501a5f8a52p-16},
+        {667,-0x1.071ac632ee893p-13,-0x1.5b91cf747dccep-15},
+        {668,-0x1.0a3bdf86f25e5p-13,-0x1.1119f2cca6bbp-14},
+        {669,-0x1.03eb7a341db44p-13,-0x1.7a1a77bed94afp-14},
+        {670,-0x1.e68cb2fbf8998p-14,-0x1.e4f95838e6369p-14},
+        {671,-0x1.afa578c103882p-14,-0x1.26b66df066aa6p-13},
+        {672,-0x1.631f1a4b1cf2dp-14,-0x1.577191c7a624ap-13},
+        {673,-0x1.01fb645db56e9p-14,-0x1.825d0bc21866ep-13},
+        {674,-0x1.1c8a5dd490598p-15,-0x1.a53debb136719p-13},
+        {675,-0x1.60db01b2616dap-19,-0x1.be0e21c5e48bap-13},
+        {676,0x1.079c019a1c57ap-15,-0x1.cb19fef9efabep-13},
+        {677,0x1.1986ba9cc7726p-14,-0x1.cb1aa147dc68cp-13},
+        {678,0x1.b0e24006050e4p-14,-0x1.bd4b9b767a508p-13},
+        {679,0x1.2226b0c2d9b66p-13,-0x1.a17a655985493p-13},
+        {680,0x1.6712e5fdf9da4p-13,-0x1.780e788d92a97p-13},
+        {681,0x1.a47ff5ea3b1d2p-13,-0x1.42096999f8f31p-13},
+        {682,0x1.d7f5e3fe2c943p-13,-0x1.00fec72cd9d49p-13},
+        {683,0x1.ff5a6d5ee7e76p-13,-0x1.6e0811c1734fap-14},
+        {684,0x1.0c864ab743d9bp-12,-0x1.9a6550aabc9a7p-15},
+        {685,0x1.11fd1872f87ccp-12,-0x1.28c504720bf73p-17},
+        {686,0x1.0fd7133ea585ep-12,0x1.08a57a21f1bbep-15},
+        {687,0x1.062b4536cde3ap-12,0x1.290c2bc20daacp-14},
+        {688,0x1.eac236d5295e2p-13,0x1.c3494f18354cdp-14},
+        {689,0x1.bc56060203552p-13,0x1.26df3131ced8ap-13},
+        {690,0x1.82fa542b79dc6p-13,0x1.61ee656c2655bp-13},
+        {691,0x1.4101e3b21d88cp-13,0x1.91038bcd9e275p-13},
+        {692,0x1.f21743b6e6b01p-14,0x1.b2dbd29735d84p-13},
+        {693,0x1.5bc2278724d24p-14,0x1.c6cbf7c7ed97ep-13},
+        {694,0x1.894d7d27f22c2p-15,0x1.ccc3c8974776bp-13},
+        {695,0x1.918ef8551b95p-17,0x1.c5497618fb27p-13},
+        {696,-0x1.5a930402fcee1p-16,0x1.b16d3b30265fp-13},
+        {697,-0x1.a32375a931475p-15,0x1.92b642d9bdb92p-13},
+        {698,-0x1.3b21d85799da4p-14,0x1.6b0a1ecb7079dp-13},
+        {699,-0x1.90d89a47d640ap-14,0x1.3c906767f0f76p-13},
+        {700,-0x1.d1403769ce0b6p-14,0x1.09944add2b8d7p-13},
+        {701,-0x1.fbead58a06aecp-14,0x1.a8cbbf62e5cadp-14},
+        {702,-0x1.08b2d2caee2c2p-13,0x1.3e79fe0ea1851p-14},
+        {703,-0x1.098fb056d1e71p-13,0x1.b07cfa1675c5dp-15},
+        {704,-0x1.01a22bab80f49p-13,0x1.e652e89f68105p-16},
+        {705,-0x1.e492cb18df3e2p-14,0x1.2a41e050f17d8p-17},
+        {706,-0x1.ba2a9e74c5b82p-14,-0x1.14fd57b38681ep-17},
+        {707,-0x1.875b83ed43ap-14,-0x1.739ebc76953d6p-16},
+        {708,-0x1.4f74bb1dd8c7p-14,-0x1.1238c1daf5a27p-15},
+        {709,-0x1.15991f2eede3cp-14,-0x1.4f065c65b091dp-15},
+        {710,-0x1.b933a7b4e1745p-15,-0x1.7204a41fd3c5cp-15},
+        {711,-0x1.4db290415c193p-15,-0x1.7e03d71cff206p-15},
+        {712,-0x1.d8de6f84d0eeap-16,-0x1.769171a81f99dp-15},
+        {713,-0x1.3023131117e68p-16,-0x1.5fae17cb1a56p-15},
+        {714,-0x1.48a120715110cp-17,-0x1.3d84ec7fbe1bdp-15},
+        {715,-0x1.b394b917d68b8p-19,-0x1.1428cddaeae86p-15},
+        {716,0x1.a3ff04dcc49a7p-20,-0x1.ceb64a3096846p-16},
+        {717,0x1.40492f51e3791p-18,-0x1.74bdfd831a218p-16},
+        {718,0x1.b9c665b219678p-18,-0x1.1fb40f91fa9ep-16},
+        {719,0x1.e61b115bc4b49p-18,-0x1.a70fbac5fdc4p-17},
+        {720,0x1.d7498edbf83fcp-18,-0x1.258e64d60db5ep-17},
+        {721,0x1.9f44dd65c601cp-18,-0x1.7ac591c26b3a4p-18},
+        {722,0x1.4eba8e1004906p-18,-0x1.baf583fe8a8fp-19},
+        {723,0x1.e8478e4ffcea7p-19,-0x1.bf66923c14c65p-20},
+        {667,0x1.e19712971d0b4p-19,0x1.b184ad34b1ebdp-20},
+        {668,0x1.48c994f2ac6acp-18,0x1.a883d032814bdp-19},
+        {669,0x1.98364bc7d6048p-18,0x1.68a15adc9e9dap-18},
+        {670,0x1.d210c61b3845bp-18,0x1.166d2c5002a56p-17},
+        {671,0x1.e7519b735f272p-18,0x1.90841266dd92cp-17},
+        {672,0x1.c7b072a3aa09ap-18,0x1.1051cccc7fe0bp-16},
+        {673,0x1.62a632b2585dbp-18,0x1.61492fe57303fp-16},
+        {674,0x1.5140e10dac78p-19,0x1.b7d3cd5d7c94cp-16},
+        {675,-0x1.cea9c7b6f2dfcp-20,0x1.07b2cfd02de6dp-15},
+        {676,-0x1.fbdb62753fa4ep-18,0x1.3128def5edab2p-15},
+        {677,-0x1.fa4b8d4370c4ep-17,0x1.54fc873ed5f8dp-15},
+        {678,-0x1.9716340b2f547p-16,0x1.6f884d0e646acp-15},
+        {679,-0x1.25509c2fe39b8p-15,0x1.7cfeb7a42c248p-15},
+        {680,-0x1.89da6987f8d9ap-15,0x1.79a122624798cp-15},
+        {681,-0x1.f624bd82f0a1p-15,0x1.61fcb6a1a07a4p-15},
+        {682,-0x1.331d8e52ccccp-14,0x1.332a28941d696p-15},
+        {683,-0x1.6aa9496bb753cp-14,0x1.d618a5bc511a2p-16},
+        {684,-0x1.9efa05a427aap-14,0x1.11131321d297ep-16},
+        {685,-0x1.cd1acb1a2f6b6p-14,0x1.776fd57128adp-20},
+        {686,-0x1.f2002ec4ed712p-14,-0x1.13dc471e8a89bp-16},
+        {687,-0x1.0558029ea7532p-13,-0x1.359bb423b719cp-15},
+        {688,-0x1.0a35e18bd6bp-13,-0x1.f30e8ea1c33d4p-15},
+        {689,-0x1.066d98099d9d8p-13,-0x1.5e5b459df79a2p-14},
+        {690,-0x1.f234e58f19e5ap-14,-0x1.c5ee123740edap-14},
+        {691,-0x1.c3620babd6da1p-14,-0x1.16378ef39a31ep-13},
+        {692,-0x1.801aed7e1db54p-14,-0x1.46e04a2a7ba51p-13},
+        {693,-0x1.28fa4b286bdaep-14,-0x1.72d2e294520b4p-13},
+        {694,-0x1.7f0b8a44a926ep-15,-0x1.97fb149505326p-13},
+        {695,-0x1.18a940e2dbb9p-16,-0x1.b4692cf1459e4p-13},
+        {696,0x1.fe9d950332d1cp-17,-0x1.c66c0ac499efcp-13},
+        {697,0x1.9ce8ce40d5eefp-15,-0x1.cca92c377f06ep-13},
+        {698,0x1.612361d426e94p-14,-0x1.c63159a15cf73p-13},
+        {699,0x1.f2e7d33720144p-14,-0x1.b290a8e59cbe4p-13},
+        {700,0x1.3f4dce3960356p-13,-0x1.91d8ce3e7b033p-13},
+        {701,0x1.7f934016c1e8ep-13,-0x1.64a4fd03a3342p-13},
+        {702,0x1.b7dd294344f0ap-13,-0x1.2c16f5c40423cp-13},
+        {703,0x1.e6067573b2fa4p-13,-0x1.d39a837d49765p-14},
+        {704,0x1.04232ae76c25ep-12,-0x1.3fa6008b78fc6p-14},
+        {705,0x1.0ea32d753bd73p-12,-0x1.42282a36b944p-15},
+        {706,0x1.1219943df5124p-12,0x1.6f7844fd2f38fp-21},
+        {707,0x1.0e63690598228p-12,0x1.4d72bf27646b8p-15},
+        {708,0x1.03a6255cbf4aep-12,0x1.4502a02a06f4p-14},
+        {709,0x1.e49bb6489a231p-13,0x1.d881a000ea73ap-14},
+        {710,0x1.b60fd0c9683bcp-13,0x1.2e3befe511a9fp-13},
+        {711,0x1.7d75063b32034p-13,0x1.666b026c820fdp-13},
+        {712,0x1.3cf32db8d8f1p-13,0x1.93339a8b69ad2p-13},
+        {713,0x1.ede64e0006d6ep-14,0x1.b378878bd3ffbp-13},
+        {714,0x1.5c03a12afd5f7p-14,0x1.c6a35dd8f2f34p-13},
+        {715,0x1.92c7b51b5366cp-15,0x1.cca72b76fd965p-13},
+        {716,0x1.d7e978d82f8fap-17,0x1.c5fc5b9cbcb77p-13},
+        {717,-0x1.2a817dd3e0475p-16,0x1.b3962f6bc8155p-13},
+        {718,-0x1.86f5c90dd7b7dp-15,0x1.96d28c2c9e99ap-13},
+        {719,-0x1.2c5519581129cp-14,0x1.71652c40cd95ap-13},
+        {720,-0x1.82c9e5f7398d8p-14,0x1.453f7aaf3ce7p-13},
+        {721,-0x1.c55bdb8a16a66p-14,0x1.1476868a121b4p-13},
+        {722,-0x1.f37852d92ed9bp-14,0x1.c251135a1f6c8p-14},
+        {723,-0x1.06b74d25d4016p-13,0x1.5ac6ea7c24804p-14},
+        {724,-0x1.0a2e24b219794p-13,0x1.ec375cf767074p-15},
+        {725,-0x1.0508318d793ep-13,0x1.2f4ce82d29114p-15},
+        {726,-0x1.f0e763a4d3be8p-14,0x1.08a6e7182e42fp-16},
+        {727,-0x1.cba2a342c30bdp-14,-0x1.082a06178ed37p-19},
+        {728,-0x1.9d3d9b38b1638p-14,-0x1.18d49ca48436p-16},
+        {729,-0x1.68c39392a1b6bp-14,-0x1.dc007be51ad5ap-16},
+        {730,-0x1.312812389cdaep-14,-0x1.35361d9ac0121p-15},
+        {731,-0x1.f24825c2a4e74p-15,-0x1.632f8243b30f4p-15},
+        {732,-0x1.86334568acd94p-15,-0x1.7a119dab0fb58p-15},
+        {733,-0x1.21fdf4d7d8b73p-15,-0x1.7cc9aa29f07fp-15},
+        {734,-0x1.91469fd2e9527p-16,-0x1.6ece335ac2d2p-15},
+        {735,-0x1.f08e746a3865ap-17,-0x1.53df61ac85feep-15},
+        {736,-0x1.ec5036b038ba8p-18,-0x1.2fca29c0734f2p-15},
+        {737,-0x1.9ff7401a2ef1cp-20,-0x1.0631bfb6f4c6ap-15},
+        {738,0x1.6161ac9c8e67bp-19,-0x1.b4c3fd97ef993p-16},
+        {739,0x1.6783258ed85f2p-18,-0x1.5e594b98fe586p-16},
+        {740,0x1.c9dd04cfef864p-18,-0x1.0da4d2c43f1cep-16},
+        {741,0x1.e75efa8bd1798p-18,-0x1.8bdff9a024cd2p-17},
+        {742,0x1.d092dcbb9c71cp-18,-0x1.1299bf8c0109bp-17},
+        {743,0x1.95b9da45ad737p-18,-0x1.62ab18a7ec64ap-18},
+        {744,0x1.45cc3dc92807dp-18,-0x1.9fd62cf6dc3ep-19},
+        {745,0x1.db6c3b46647f4p-19,-0x1.a5fe0bb0ba812p-20},
+    };
+
+    const int ROW_STARTS_3[] = {0,5,10,15,21,26,32,38,44,50,57,63,70,77,84,91,98,106,115,124,133,141,150,159,169,179,189,199,210,221,232,243,255,267,280,293,307,321,336,351,367,383,400,417,434,451,469,487,507,527,547,568,590,612,635,659,683,708,734,760,787,815,844,874,905,936,969,1002,1037,1073,1109,1146,1185,1225,1266,1308,1352,1396,1442,1490,1539,1590,1642,1696,1751,1808,1866,1926,1988,2052,2118,2185,2254,2326,2399,2474,2553};
+
+    const BakedKernelEntry ENTRIES_3[] = {
+        {43,-0x1.8858148ec1956p-15,0x1.7f96b7eef6903p-15},
+        {44,0x1.98a310024536ap-17,-0x1.c97c5be3626d8p-13},
+        {45,0x1.483b990955243p-13,0x1.91a725bf6a143p-13},
+        {46,-0x1.aa8ad63903e2p-14,-0x1.f160cffc95bffp-17},
+        {47,0x1.479c9ed3bbad6p-18,-0x1.bc975c40eedbep-19},
+        {44,-0x1.8489126c34cc5p-18,0x1.28f91e834a2f2p-15},
+        {45,-0x1.bad3bc14496aep-14,-0x1.24910cd18b6ddp-13},
+        {46,0x1.1247cc55cbd72p-12,0x1.f219193dad9f4p-16},
+        {47,-0x1.00b5c62edd26ap-13,0x1.adc164d2ea837p-14},
+        {48,0x1.d96d09cdcbb77p-20,-0x1.ce348e05b8c14p-16},
+        {45,0x1.de93f8b36c377p-18,0x1.d43b81fdeb2d4p-17},
+        {46,-0x1.03ff412e797fap-13,-0x1.d6784f99b6e25p-16},
+        {47,0x1.a7f0c1733f8fp-13,-0x1.44997819d0b3p-13},
+        {48,-0x1.281aa36d80bcbp-17,0x1.be5c75dece716p-13},
+        {49,-0x1.a3330cb6ddb82p-15,-0x1.7bf4867ea5acfp-15},
+        {46,0x1.a360632349376p-19,0x1.651a8293a78e5p-20},
+        {47,-0x1.1b2f63bf1524p-14,0x1.51d2acbae746cp-15},
+        {48,0x1.5636f187d31a2p-16,-0x1.cc66ad5503d96p-13},
+        {49,0x1.8d383ae564c5cp-13,0x1.5e94f0b9b9248p-13},
+        {50,-0x1.039166357b0d4p-13,0x1.ca4b202b34bf9p-16},
+        {51,0x1.cea94fd98faeap-18,-0x1.07c6a85b348ep-16},
+        {48,-0x1.13cf2c01606dfp-17,0x1.37eb884937709p-15},
+        {49,-0x1.eb623b5aed12ap-14,-0x1.eb1f3cb8cbec4p-14},
+        {50,0x1.0cbc67de98d66p-12,-0x1.dc7355be5c6f8p-15},
+        {51,-0x1.1734dce462c39p-14,0x1.7f0fc380a2ea2p-13},
+        {52,-0x1.27b6cc2e26f5cp-15,-0x1.81fc73cc87fcep-15},
+        {49,0x1.d8eced362f0ccp-18,0x1.38154da789a8fp-17},
+        {50,-0x1.ab525383e14c3p-14,0x1.e965451ecfd36p-17},
+        {51,0x1.5d9d77e21267p-14,-0x1.cacf8362d2ab1p-13},
+        {52,0x1.4f178257f0658p-13,0x1.8d61f05206503p-13},
+        {53,-0x1.019ba70de9dap-13,0x1.95a49dd070053p-16},
+        {54,0x1.99f9a7f5770b6p-18,-0x1.3debfc2dbb062p-16},
+        {51,-0x1.bdddee1ee0024p-16,0x1.781ffe14dd1bep-15},
+        {52,-0x1.a0325df5e0438p-14,-0x1.3843786ea24ap-13},
+        {53,0x1.112bc89d1b07cp-12,-0x1.33c34a44acae3p-15},
+        {54,-0x1.f50542270a1dap-15,0x1.89b65af816a0cp-13},
+        {55,-0x1.95252cf1d96d2p-15,-0x1.7df2f3cd7e0f2p-15},
+        {56,0x1.78876e211f3fap-19,-0x1.216f0c0113512p-20},
+        {52,0x1.df0a8914829f4p-18,0x1.d1c92f9223982p-17},
+        {53,-0x1.bd754192417d8p-14,0x1.30d83aefca7f3p-17},
+        {54,0x1.22a91d7cc737p-14,-0x1.cec2f81dd4fdfp-13},
+        {55,0x1.989d8fed31163p-13,0x1.53f3b11dd8769p-13},
+        {56,-0x1.0d1651b492397p-13,0x1.1d262acb31e2dp-14},
+        {57,-0x1.b4ae847983863p-19,-0x1.16badfe685192p-15},
+        {54,-0x1.70a7c6775d14ep-16,0x1.6e43099f4f834p-15},
+        {55,-0x1.e6ba5277ead8cp-14,-0x1.f5d26e7107d18p-14},
+        {56,0x1.ed5a2505a0486p-13,-0x1.cb601d8e3476p-14},
+        {57,0x1.76e1e8d378dd9p-16,0x1.ccf0473f35f68p-13},
+        {58,-0x1.8c507aee4b27cp-14,-0x1.785a7c1f11d18p-16},
+        {59,0x1.e4653939ebf16p-18,-0x1.7bf2e0b0cbd57p-17},
+        {55,0x1.d5769fda15264p-18,0x1.2c6de57a5a16cp-17},
+        {56,-0x1.553db75d3decep-14,0x1.13cfedee31c4ap-15},
+        {57,-0x1.6fa1126f439fdp-16,-0x1.b48e18dbeca0cp-13},
+        {58,0x1.0f6f2d0cd99ap-12,0x1.7e61ea9c299bbp-15},
+        {59,-0x1.58f6e7fffd25ap-14,0x1.61e7d5c255faep-13},
+        {60,-0x1.a5bb934a1412fp-15,-0x1.7b73efb82ab11p-15},
+        {61,0x1.31b56a64aaa96p-18,-0x1.7e6c25174701ep-19},
+        {57,-0x1.1f15336b95b96p-19,0x1.0daee10f5f1e6p-15},
+        {58,-0x1.08cfa36629662p-13,-0x1.4017810d2ce28p-15},
+        {59,0x1.f699fd90e7acep-14,-0x1.b667990a4e8bp-13},
+        {60,0x1.835ceb916258p-13,0x1.6713c0509acfp-13},
+        {61,-0x1.08f640a9288c4p-13,0x1.67a0767878e5cp-14},
+        {62,-0x1.0d5ff4bd80382p-16,-0x1.5c1069aa29d32p-15},
+        {58,0x1.0eebfb37e5aa2p-18,0x1.292e794751763p-19},
+        {59,-0x1.3771f558b1dd6p-15,0x1.82a8f6f762cd4p-15},
+        {60,-0x1.d506ee4b365d4p-14,-0x1.0d60c5c2a8ec8p-13},
+        {61,0x1.cef2cfbe88105p-13,-0x1.1572cb6756612p-13},
+        {62,0x1.5d0e794f6e604p-14,0x1.cacb465da627bp-13},
+        {63,-0x1.00e94a2801823p-13,0x1.85157a5117cb4p-16},
+        {64,-0x1.5a78fce165771p-22,-0x1.fa8f4eee780dep-16},
+        {60,0x1.e03b56548cffap-18,0x1.5822ff8751ceep-17},
+        {61,-0x1.2fb65fc0a226dp-14,0x1.3edff7c5f3388p-15},
+        {62,-0x1.1ca06acde86fp-14,-0x1.7cd272f9c8681p-13},
+        {63,0x1.0bb727bb0da8ep-12,-0x1.f9a37f541b97ap-15},
+        {64,0x1.88c86b763b088p-16,0x1.cd3298da12538p-13},
+        {65,-0x1.d0ec6c40f488ep-14,-0x1.258d0646b69bep-19},
+        {66,0x1.e4d655ecd34e3p-19,-0x1.9d8a4724e2e41p-16},
+        {62,0x1.07695f92055c2p-18,0x1.940e8fd7c6037p-16},
+        {63,-0x1.bdfd7dee22e65p-14,0x1.29fd6c90e074bp-17},
+        {64,-0x1.25f84e922b18fp-20,-0x1.c2f498b3db3eep-13},
+        {65,0x1.13676d83c63p-12,0x1.42dda19ab4f18p-16},
+        {66,-0x1.0545ded249e8bp-15,0x1.ac341ef75eca2p-13},
+        {67,-0x1.8d786c075135ap-14,-0x1.739998a287a06p-16},
+        {68,0x1.97219a211e1c2p-18,-0x1.4020180db2fcep-16},
+        {64,-0x1.acd741491fb5cp-19,0x1.163987a886104p-15},
+        {65,-0x1.f5c6003e28218p-14,-0x1.ff6866410660ap-17},
+        {66,0x1.265cb61eb04cap-15,-0x1.cfae01f5c2992p-13},
+        {67,0x1.0e9caccc189a6p-12,0x1.9c09485a8fb9fp-15},
+        {68,-0x1.709a52bdb043cp-15,0x1.9e81d7c47d8bep-13},
+        {69,-0x1.86747083da07ap-14,-0x1.8ddc11c03d90ap-16},
+        {70,0x1.822d153d2d7dcp-18,-0x1.4f988c0c555d8p-16},
+        {66,-0x1.5f403c0ccd82ap-17,0x1.43e88b75bc7ep-15},
+        {67,-0x1.05ef24be40e6cp-13,-0x1.0adca91dd39e2p-15},
+        {68,0x1.bb2de7a675da2p-15,-0x1.d0af07f0e2b42p-13},
+        {69,0x1.0ca17d5416e08p-12,0x1.ddaec661177a8p-15},
+        {70,-0x1.58a409ffd9ffap-15,0x1.a1c83e159bc3ep-13},
+        {71,-0x1.9bd31847b6be8p-14,-0x1.397694fa9e346p-16},
+        {72,0x1.15589e9ca7248p-18,-0x1.8d7ba280163dep-16},
+        {67,0x1.18162ffa6777cp-18,0x1.3df1bfa0fed42p-19},
+        {68,-0x1.679b81bfc9f22p-16,0x1.6cc9d9d757d2cp-15},
+        {69,-0x1.0cd2f1dc26e5ap-13,-0x1.c632206d2ae1p-15},
+        {70,0x1.472b4fd48214fp-14,-0x1.cc7163bfaf1dap-13},
+        {71,0x1.078addec141a8p-12,0x1.32a5445dd9fc5p-14},
+        {72,-0x1.79e1f2dc4a24p-15,0x1.9d2b0c4046574p-13},
+        {73,-0x1.a318695e4ec9cp-14,-0x1.19b721347ffb3p-16},
+        {74,0x1.7a96f48d68bd6p-19,-0x1.b3a73f41e1105p-16},
+        {69,0x1.fdba7da1a35dcp-19,0x1.062af372bd003p-19},
+        {70,-0x1.10402dc46705ap-16,0x1.5c9d887c1e946p-15},
+        {71,-0x1.0748e0dba5856p-13,-0x1.22e33f5d196c4p-15},
+        {72,0x1.3847bd33c6d58p-15,-0x1.cff0a52436952p-13},
+        {73,0x1.13944039247fdp-12,0x1.1a4d73913269ap-16},
+        {74,0x1.1b559bff5cba3p-17,0x1.c7b67f914d068p-13},
+        {75,-0x1.f8dd99978bcaep-14,0x1.1fea4a49a7a56p-16},
+        {76,-0x1.3df4fcd89c9e8p-17,-0x1.3ec037c1bd77cp-15},
+        {77,0x1.6215ad57d4d42p-19,-0x1.003b8b19411a8p-20},
+        {71,0x1.fc2bcf73681fcp-19,0x1.047eee6bf0edcp-19},
+        {72,-0x1.d0185f7a027b4p-17,0x1.534a8312f264dp-15},
+        {73,-0x1.00ae8e87bdc41p-13,-0x1.80eb967c255b4p-16},
+        {74,0x1.2c05ca0ab2defp-17,-0x1.c7eba7a7190f8p-13},
+        {75,0x1.12869b3d941c1p-12,-0x1.c66b3d278d1fp-16},
+        {76,0x1.d508abc3c1a4ep-15,0x1.d07b8d574df1p-13},
+        {77,-0x1.0ca2a981a1b12p-13,0x1.bb8d54a8f78c4p-15},
+        {78,-0x1.be672aaf911bep-16,-0x1.7809c83722abep-15},
+        {79,0x1.7789f1a22987ep-18,-0x1.2f99a65aeec52p-18},
+        {73,0x1.b8c91af3ef34p-19,0x1.8851370cf11bcp-20},
+        {74,-0x1.2e57fc51cbc86p-17,0x1.3c382cae3dd1p-15},
+        {75,-0x1.e3c363bcee456p-14,-0x1.8799b8f3eb06cp-18},
+        {76,-0x1.cf9e7705a504ep-16,-0x1.af6d64768238ap-13},
+        {77,0x1.044883bced6c6p-12,-0x1.564180efcd581p-14},
+        {78,0x1.e4543e5a84ad2p-14,0x1.b982e32ec1f42p-13},
+        {79,-0x1.01b712af792cfp-13,0x1.a5be1f38b61c6p-14},
+        {80,-0x1.bc807f610d20ep-15,-0x1.77208d5696c0ep-15},
+        {81,0x1.e42fc87434c2cp-18,-0x1.a9e6a019265d2p-17},
+        {76,0x1.32097cbef1b89p-21,0x1.e873c00d1df62p-16},
+        {77,-0x1.887250e2d8934p-14,0x1.860b7d9f67ed8p-16},
+        {78,-0x1.61025e68c716bp-14,-0x1.5da2cbc55c462p-13},
+        {79,0x1.99700591c52cbp-13,-0x1.52ee23301f168p-13},
+        {80,0x1.a70f3d6e6f2e8p-13,0x1.4536d84fbdb4cp-13},
+        {81,-0x1.4ba4f757e8b7p-14,0x1.6838f43f4b8d2p-13},
+        {82,-0x1.9512790a49b5ep-14,-0x1.5509eea680702p-16},
+        {83,-0x1.0d6298b27877ap-21,-0x1.fddf78ef2c45cp-16},
+        {78,0x1.9b19215a9f42ep-18,0x1.3ce97209b0cdap-16},
+        {79,-0x1.0c9e5d7678e0ap-14,0x1.5cd92b04cf992p-15},
+        {80,-0x1.f91165ba2bdfap-14,-0x1.c657c384477a3p-14},
+        {81,0x1.c5ca1e362426ep-14,-0x1.be6131b2e8d93p-13},
+        {82,0x1.0d5098d12c993p-12,0x1.c69d5f9ca9278p-15},
+        {83,0x1.8df1dc106d9adp-17,0x1.c91e173a633dfp-13},
+        {84,-0x1.09eea4dd9703ep-13,0x1.5c93ddc8ac9a1p-15},
+        {85,-0x1.f1b25d51aaa93p-16,-0x1.7cac12c111cf4p-15},
+        {86,0x1.c170e5f1a9b4p-18,-0x1.f6b655bfe0652p-18},
+        {80,0x1.db4e96fb60788p-18,0x1.405e64e5ffb0ap-17},
+        {81,-0x1.1a8c337ccaacfp-15,0x1.80be224f0967p-15},
+        {82,-0x1.0abb0977f13a8p-13,-0x1.7295cc262d225p-15},
+        {83,0x1.0059e109cb8f4p-17,-0x1.c746d4d5d0b65p-13},
+        {84,0x1.0923e4353f522p-12,-0x1.1e9f1593c912ep-14},
+        {85,0x1.0f95484463b73p-13,0x1.ae3c74a8da046p-13},
+        {86,-0x1.d21961fe25623p-14,0x1.0fe8960652d39p-13},
+        {87,-0x1.4b8698b3f69a2p-14,-0x1.1fc3934c3164ap-15},
+        {88,0x1.80f22ddc658dcp-19,-0x1.b24f8e1d23d76p-16},
+        {82,0x1.ed06be97e8aefp-19,0x1.e99af3d976df3p-20},
+        {83,-0x1.1fb50515fe797p-18,0x1.1e60a0576d1acp-15},
+        {84,-0x1.93c7e34e31edbp-14,0x1.59f756d6599e7p-16},
+        {85,-0x1.8c03aa7da9ec2p-14,-0x1.452c99647140dp-13},
+        {86,0x1.494a00f8b4e24p-13,-0x1.90b05cf20b37ap-13},
+        {87,0x1.00af685826adap-12,0x1.79110fefa9718p-14},
+        {88,-0x1.ccb0f8aeff7c8p-19,0x1.c177f5905fbbp-13},
+        {89,-0x1.0a110154388e6p-13,0x1.6099f330866cbp-15},
+        {90,-0x1.28dd7e90cf0d7p-15,-0x1.81c923fc0e2f6p-15},
+        {91,0x1.e3c0647ac3842p-18,-0x1.71fffe9c62ecbp-17},
+        {85,0x1.c9cab9f115be8p-18,0x1.0e66b04c9d134p-16},
+        {86,-0x1.89bfdf2502383p-15,0x1.7f0a66d412057p-15},
+        {87,-0x1.0d1ee334349e8p-13,-0x1.eb0ac75caeceep-15},
+        {88,0x1.9f8f97fe9408dp-17,-0x1.c9485de3783c8p-13},
+        {89,0x1.048d3b491b749p-12,-0x1.5302c61206f95p-14},
+        {90,0x1.484c416d05e95p-13,0x1.9144d53f9d964p-13},
+        {91,-0x1.7abf10aba9bb8p-14,0x1.4f816b13b3114p-13},
+        {92,-0x1.aadb80ebcda36p-14,-0x1.ea6cb5e16816ap-17},
+        {93,-0x1.24c14f091f75bp-17,-0x1.3a9664fe5fe54p-15},
+        {94,0x1.4aaecaa245097p-18,-0x1.c446fcdf35d72p-19},
+        {87,0x1.606e8c9595e94p-18,0x1.0504c4de84fa9p-18},
+        {88,-0x1.2ae769fb240d8p-17,0x1.3b96aae723e28p-15},
+        {89,-0x1.a0e9d2999404ep-14,0x1.2281a1160d23cp-16},
+        {90,-0x1.9b01dee6a6702p-14,-0x1.3b6c5e605e12ep-13},
+        {91,0x1.1b84722c9d5ap-13,-0x1.a8eca40ceecccp-13},
+        {92,0x1.0ecde774861fcp-12,0x1.91deb5d1104e4p-15},
+        {93,0x1.a29ca64be7b8ap-15,0x1.d098e8806df4ap-13},
+        {94,-0x1.06c85614b5e54p-13,0x1.7c68e4ec90e19p-14},
+        {95,-0x1.1a6083ddd4ba9p-14,-0x1.51fdac8eed378p-15},
+        {96,0x1.c61ad5ea77f28p-19,-0x1.a408319e6595p-16},
+        {90,0x1.ddf49afc3718p-18,0x1.d7b3d25090662p-17},
+        {91,-0x1.2d83bc44a0207p-15,0x1.81fcc70f14976p-15},
+        {92,-0x1.03ecf93d22494p-13,-0x1.daa9a5e2179e4p-16},
+        {93,-0x1.6989b080919bcp-15,-0x1.9f4c9607d9cccp-13},
+        {94,0x1.a7da07a7c9d12p-13,-0x1.443bf21a3c9e2p-13},
+        {95,0x1.e12aa48c7bbfp-13,0x1.f3db575127939p-14},
+        {96,-0x1.20322d9f3ec76p-17,0x1.be35180864422p-13},
+        {97,-0x1.0caf1f5d6cc07p-13,0x1.c454d87321b35p-15},
+        {98,-0x1.a4ad6be1bb768p-15,-0x1.7b49a71eb79e3p-15},
+        {99,0x1.8db10e99ee20ap-18,-0x1.4735868a151c5p-16},
+        {92,0x1.ab2b5d65ce96ap-19,0x1.6fe1dc96eaf9ap-20},
+        {93,0x1.dbca7f6c90466p-20,0x1.cda9a1df8b87dp-16},
+        {94,-0x1.1bdf89ab716ffp-14,0x1.50ac537f2f84ap-15},
+        {95,-0x1.0a7d3f6171684p-13,-0x1.519503bb905e1p-14},
+        {96,0x1.59dbc2c5d1875p-16,-0x1.cc2841c4d4606p-13},
+        {97,0x1.fb9d662474805p-13,-0x1.9244d53102e3p-14},
+        {98,0x1.8d2cc3778dbccp-13,0x1.5e2fb6ac531eep-13},
+        {99,-0x1.a2929deaa3b7ep-15,0x1.96f80c5e6922p-13},
+        {100,-0x1.037f8a000f056p-13,0x1.ce9be667ddaf2p-16},
+        {101,-0x1.3f2f4be02beb6p-15,-0x1.8295c18cbd9dap-15},
+        {102,0x1.cd56f12deadc4p-18,-0x1.09990f260a476p-16},
+        {95,0x1.affeb0cd534bcp-18,0x1.b92ddbf1c044p-18},
+        {96,-0x1.913e990978f68p-17,0x1.4af18ea1fae7ap-15},
+        {97,-0x1.94f4cba865283p-14,0x1.54b2476d49c4p-16},
+        {98,-0x1.d217f4dfebe79p-14,-0x1.0fba115131662p-13},
+        {99,0x1.59ae7f550c6a8p-14,-0x1.cad25156282e3p-13},
+        {100,0x1.10f317ace4d9ep-12,-0x1.36b71697a65aep-15},
+        {101,0x1.34d9eb8e67c83p-13,0x1.9c449a3e91c87p-13},
+        {102,-0x1.4860876f8f884p-14,0x1.699976f8ac5c1p-13},
+        {103,-0x1.e9b5a91af0f99p-14,0x1.27e524a6785b6p-17},
+        {104,-0x1.ef1f6963e822fp-16,-0x1.7c589557abaa4p-15},
+        {105,0x1.e1c44d4b2a9b4p-18,-0x1.c13d83763ad6p-17},
+        {98,0x1.e47a1dc6574b2p-18,0x1.7a6d57b214906p-17},
+        {99,-0x1.73674c695c76p-16,0x1.6e63939a1c3a4p-15},
+        {100,-0x1.c3cf699330576p-14,0x1.c95d66dd53b8p-18},
+        {101,-0x1.a36d479afea36p-14,-0x1.35888193f9492p-13},
+        {102,0x1.ab0ffc5020534p-14,-0x1.c20692c4cf128p-13},
+        {103,0x1.12db672fe9f42p-12,-0x1.8998063679b7ep-16},
+        {104,0x1.2af73a3fd53dfp-13,0x1.a16683351c7fap-13},
+        {105,-0x1.42a74456d671ep-14,0x1.6c3bb37fc5a69p-13},
+        {106,-0x1.f2f1b61633d99p-14,0x1.ce6fb188beffbp-17},
+        {107,-0x1.237a680c963f4p-15,-0x1.814fe7deb863ap-15},
+        {108,0x1.c5dc0eb3af4e4p-18,-0x1.13594441d0797p-16},
+        {101,0x1.c6c5764f41d24p-18,0x1.12384c618cd5p-16},
+        {102,-0x1.0fac9d3b66dcp-15,0x1.7f841c9d983d4p-15},
+        {103,-0x1.e497ec9ed6d64p-14,-0x1.aa039f77a065ap-18},
+        {104,-0x1.76b3d34415588p-14,-0x1.51aba1a824d2ep-13},
+        {105,0x1.e53c83cc1bdaap-14,-0x1.b928177c8785dp-13},
+        {106,0x1.139270ff72cp-12,-0x1.02c87493fb7efp-16},
+        {107,0x1.2a433a7b43308p-13,0x1.a1bbb754b3294p-13},
+        {108,-0x1.3130f62e93256p-14,0x1.73f8e8d16b92cp-13},
+        {109,-0x1.fe9d8694afea1p-14,0x1.631a524408b79p-16},
+        {110,-0x1.5c30da2a791f1p-15,-0x1.8249698a1b80cp-15},
+        {111,0x1.7e8b4437188fap-18,-0x1.51f1918dc8abep-16},
+        {104,0x1.c605d71a7a584p-18,0x1.132346ec86624p-16},
+        {105,-0x1.fd8665e6e8bc1p-16,0x1.7d5dc7c87e52ep-15},
+        {106,-0x1.d598059386ad5p-14,0x1.8a3f59ff77e9p-23},
+        {107,-0x1.a1e0155ec9733p-14,-0x1.368f20cc9cc5cp-13},
+        {108,0x1.74f79aa969bfbp-14,-0x1.c84662e24a0c8p-13},
+        {109,0x1.0d92bf2adc625p-12,-0x1.bafb84b64bc1ap-15},
+        {110,0x1.76bf0523cd0bp-13,0x1.70f6957e840a5p-13},
+        {111,-0x1.3ea3819cdd1c2p-15,0x1.a4eb27889feedp-13},
+        {112,-0x1.0cb57be0c2c42p-13,0x1.caedb17333a7ep-15},
+        {113,-0x1.0c2e8525684dep-14,-0x1.5cdca975fd065p-15},
+        {114,-0x1.c46d525f429b2p-22,-0x1.fc1df6d0d7c4p-16},
+        {115,0x1.4dd5edcfc6d1ep-18,-0x1.cd327cd340a62p-19},
+        {107,0x1.c9b5b3f6f5e75p-18,0x1.0e794a6515ce6p-16},
+        {108,-0x1.d19f0a99e371p-16,0x1.79b58da70c8d3p-15},
+        {109,-0x1.c2ee7472fc347p-14,0x1.db9446e1222aap-18},
+        {110,-0x1.c8c4fb124cb38p-14,-0x1.181d83dd9c484p-13},
+        {111,0x1.fe97a58ee9a8bp-15,-0x1.cfc652da09212p-13},
+        {112,0x1.00dbd99fdb0bp-12,-0x1.76960bc7a939p-14},
+        {113,0x1.b9ac465fa8b06p-13,0x1.301c43b1aadc4p-13},
+        {114,0x1.b8b19a807c2d6p-19,0x1.c4fdda48145ep-13},
+        {115,-0x1.062c889fd9efap-13,0x1.810accd696fb6p-14},
+        {116,-0x1.6ce7bac30e0cp-14,-0x1.e26ba5f1fb7e6p-16},
+        {117,-0x1.994e2587527d6p-17,-0x1.4bfc2ccb9274cp-15},
+        {118,0x1.d82d549d41ecap-18,-0x1.343d4a54d2d97p-17},
+        {110,0x1.e43430d93caf6p-18,0x1.75f122d11cc48p-17},
+        {111,-0x1.f6785c8c935f8p-17,0x1.57ae038cc989p-15},
+        {112,-0x1.759338871b6fap-14,0x1.c6b16a75805fp-16},
+        {113,-0x1.0672169bd8aa2p-13,-0x1.7e63e8bc3d5ap-14},
+        {114,-0x1.d1cb988b2c775p-19,-0x1.c142095413889p-13},
+        {115,0x1.a467b2386409cp-13,-0x1.47a1854f487c6p-13},
+        {116,0x1.091e12cbc20ddp-12,0x1.1d803c59fb639p-14},
+        {117,0x1.6fd74f2514b6ep-14,0x1.c8bbdae38e429p-13},
+        {118,-0x1.8965b8c4a80a6p-14,0x1.4688b0b53a4eap-13},
+        {119,-0x1.f03265a504ecap-14,0x1.9cde5fee57912p-17},
+        {120,-0x1.66f2d4d368ad6p-15,-0x1.81bc87da8b7f7p-15},
+        {121,0x1.18b18914f9728p-18,-0x1.8b9f4ce1d78aep-16},
+        {122,0x1.fa1727d6285fp-19,-0x1.013d892dacbc3p-19},
+        {113,0x1.bd8d843eb9d5dp-18,0x1.e6c156c04be44p-18},
+        {114,-0x1.77bb5f27e128dp-18,0x1.27631c4f7c1dep-15},
+        {115,-0x1.23b5e2baad4b4p-14,0x1.4991b2222c8fep-15},
+        {116,-0x1.0c4395d5ecf4ap-13,-0x1.b2766325d9351p-15},
+        {117,-0x1.d6b67937fc028p-15,-0x1.8e73bfc9898ap-13},
+        {118,0x1.26580da161f07p-13,-0x1.a39632b91bb8dp-13},
+        {119,0x1.137fd6876a3ccp-12,-0x1.0970c88c5c43cp-16},
+        {120,0x1.5ca5b8bb6efd7p-13,0x1.83ffb871efde6p-13},
+        {121,-0x1.1e4948e5b0d25p-15,0x1.a8e1cde429f17p-13},
+        {122,-0x1.0c72c6cee427p-13,0x1.28cd99d8afc02p-14},
+        {123,-0x1.5121811dfd03cp-14,-0x1.183f68aae9becp-15},
+        {124,-0x1.751cce7deedbdp-17,-0x1.46e1690c94eb4p-15},
+        {125,0x1.deb85235150e2p-18,-0x1.4e9d21988d06bp-17},
+        {116,0x1.138f0d67a91aep-18,0x1.31eac98d72cbap-19},
+        {117,0x1.2b3b31ebb9fcap-18,0x1.826db1aacfff8p-16},
+        {118,-0x1.39612098aa2cep-15,0x1.8240be3425c22p-15},
+        {119,-0x1.d1592b29112e4p-14,0x1.e6f0d8938e032p-20},
+        {120,-0x1.d3d7fde5bca3p-14,-0x1.0dca55d43ccaep-13},
+        {121,0x1.284d652939bc7p-15,-0x1.cf5bc7623e403p-13},
+        {122,0x1.cebed3e396415p-13,-0x1.150756dd1b13p-13},
+        {123,0x1.028a7152645f4p-12,0x1.6628a6e2846e6p-14},
+        {124,0x1.5dd03177ce69ap-14,0x1.ca538122d6f71p-13},
+        {125,-0x1.7789d3a3f527ep-14,0x1.510d32a0187fcp-13},
+        {126,-0x1.00d9b00424f01p-13,0x1.8a83ef93be713p-16},
+        {127,-0x1.c914f0b6692dep-15,-0x1.7402623c044e4p-15},
+        {128,-0x1.e235c7ed7bb3ep-22,-0x1.fc8d513c3f2f2p-16},
+        {129,0x1.898e20dd2e4dap-18,-0x1.542d1122d1b18p-18},
+        {120,0x1.e3f988de8c872p-18,0x1.ae0f740f9289ap-17},
+        {121,-0x1.db2376fadc951p-17,0x1.546118ae5dd36p-15},
+        {122,-0x1.53c498408a86ap-14,0x1.14bddcc387d37p-15},
+        {123,-0x1.0d004fc17188cp-13,-0x1.0b978911516d8p-14},
+        {124,-0x1.b03c08e08fe54p-15,-0x1.94a581ab23344p-13},
+        {125,0x1.1ae5c08f6ff0ep-13,-0x1.a8f59f5d49e1fp-13},
+        {126,0x1.11228cd270d4dp-12,-0x1.292a96f30dcd7p-15},
+        {127,0x1.90c6454386118p-13,0x1.5aa8bb9e8b857p-13},
+        {128,0x1.0f91c361f436cp-19,0x1.c4407ddcf4fbap-13},
+        {129,-0x1.f8db110004eaap-14,0x1.c585e166310b1p-14},
+        {130,-0x1.b30d144058fc8p-14,-0x1.96f94fae605bbp-17},
+        {131,-0x1.093655f48f796p-15,-0x1.7ea1272395e64p-15},
+        {132,0x1.60bb9c135704fp-18,-0x1.64f5ab8eda167p-16},
+        {133,0x1.037bb39e9938ap-18,-0x1.0e630eb8f1807p-19},
+        {123,0x1.45cd824a7b884p-18,0x1.b44efd584069p-19},
+        {124,0x1.0168e901b6988p-18,0x1.967305a31e556p-16},
+        {125,-0x1.2f9eab414e0d2p-15,0x1.81d38ecc5ae9ap-15},
+        {126,-0x1.be5963651f592p-14,0x1.1f72146132c5p-17},
+        {127,-0x1.f5fcf67c6b2f2p-14,-0x1.cd8511eb1bcd6p-14},
+        {128,-0x1.a27999f3f7c54p-21,-0x1.c2b62c014848fp-13},
+        {129,0x1.81bc753a567dp-13,-0x1.67d662bd5c4aap-13},
+        {130,0x1.132ff3e3f4aa8p-12,0x1.424f7eb7490a4p-16},
+        {131,0x1.42d914d57ca7dp-13,0x1.94316adbe063fp-13},
+        {132,-0x1.02669208c86c4p-15,0x1.ac187e49a1875p-13},
+        {133,-0x1.08936c9d57017p-13,0x1.67e6b27fdeb1cp-14},
+        {134,-0x1.8e0dee3cb695cp-14,-0x1.6ee24501f6b2bp-16},
+        {135,-0x1.ac881cc9d278cp-16,-0x1.75b8bcc30eadcp-15},
+        {136,0x1.93a44b16e583bp-18,-0x1.4297513898aep-16},
+        {137,0x1.da8595ab5bb86p-19,-0x1.c34c11d20fd12p-20},
+        {127,0x1.e18db6a47aa29p-18,0x1.5e36233362b3dp-17},
+        {128,-0x1.ece688b58e8f8p-18,0x1.3266b614d9802p-15},
+        {129,-0x1.0df28dd217f6cp-14,0x1.5b4a811f2166p-15},
+        {130,-0x1.041b03b182762p-13,-0x1.e547ad2a1a202p-16},
+        {131,-0x1.88a81c9035f46p-14,-0x1.46d3eb761f651p-13},
+        {132,0x1.ed30a37eefdcap-15,-0x1.cfdd73b341418p-13},
+        {133,0x1.d7bb00b2c78d6p-13,-0x1.080735838219cp-13},
+        {134,0x1.06ace3cd0d664p-12,0x1.3a16b5aa59cb8p-14},
+        {135,0x1.ce8a6e8af3b63p-14,0x1.bcaef16c3e23dp-13},
+        {136,-0x1.036dccca4b0bp-14,0x1.85ea41aafde68p-13},
+        {137,-0x1.0cfeacafb1fe8p-13,0x1.032675fddb994p-14},
+        {138,-0x1.60b7fcf3e1fccp-14,-0x1.02f94758a1cf6p-15},
+        {139,-0x1.3d9b69f24b103p-16,-0x1.654f66ea60927p-15},
+        {140,0x1.c224f5514f32bp-18,-0x1.17b578292e39cp-16},
+        {141,0x1.962809e378e5ep-19,-0x1.4b92eb2377cffp-20},
+        {130,0x1.93ecbb6a22099p-19,0x1.47d4674c6c538p-20},
+        {131,0x1.cc87e60c78d46p-18,0x1.0aab9c2e66474p-16},
+        {132,-0x1.0de38e99b31f2p-16,0x1.5bc05a420663bp-15},
+        {133,-0x1.461c7e53c7203p-14,0x1.258aac03a2d0ep-15},
+        {134,-0x1.0b465b23705a2p-13,-0x1.8c1a7ae5729c6p-15},
+        {135,-0x1.4f78b5815dc21p-14,-0x1.65eb858639376p-13},
+        {136,0x1.45038cc785f3cp-14,-0x1.cc28c220065b4p-13},
+        {137,0x1.e80d67bc6b7cbp-13,-0x1.dbd666327ba8p-14},
+        {138,0x1.037025da8788ap-12,0x1.5cad4768cadaap-14},
+        {139,0x1.c42655e0f098ep-14,0x1.be3ec26e2cd59p-13},
+        {140,-0x1.f57de2963207ap-15,0x1.89028920aaf32p-13},
+        {141,-0x1.0cbc0a24533fp-13,0x1.1abbaa94d874ep-14},
+        {142,-0x1.761ba7ef3b484p-14,-0x1.c433ddb6f9669p-16},
+        {143,-0x1.94bdfd54bc248p-16,-0x1.72c8f613cc35fp-15},
+        {144,0x1.806037113d237p-18,-0x1.508e03946003ap-16},
+        {145,0x1.18eea948928d4p-18,-0x1.3df1366d7f795p-19},
+        {134,0x1.5a1dac5a19e15p-18,0x1.f310355e3e2bap-19},
+        {135,0x1.29a55fb4ac1adp-18,0x1.83219f8fe350cp-16},
+        {136,-0x1.e1f1dae5c5763p-16,0x1.7afbaab039643p-15},
+        {137,-0x1.8650deacb2a2cp-14,0x1.8ba4c564aeb03p-16},
+        {138,-0x1.0c4596ece36afp-13,-0x1.2ac234545675ep-14},
+        {139,-0x1.f22d31da586aap-15,-0x1.8991265b2062ap-13},
+        {140,0x1.b1705a539f5c6p-14,-0x1.c0e728501eb56p-13},
+        {141,0x1.fe309ae8064e2p-13,-0x1.85a41caf568c2p-14},
+        {142,0x1.f7fb9bdd25a7ap-13,0x1.a013a6170ca1ep-14},
+        {143,0x1.97475b9c759aep-14,0x1.c447e9c43f463p-13},
+        {144,-0x1.0bb9b507b155p-14,0x1.82c802229b746p-13},
+        {145,-0x1.0cc12c3b4539ap-13,0x1.18c20e0802344p-14},
+        {146,-0x1.7cc7e7956ea98p-14,-0x1.ad950a124a9adp-16},
+        {147,-0x1.c26f8961239bp-16,-0x1.78060bd451126p-15},
+        {148,0x1.471e026048978p-18,-0x1.739f0b315a7p-16},
+        {149,0x1.4aaf5748a060bp-18,-0x1.c2773aa5dde9ep-19},
+        {138,0x1.047c19117564p-18,0x1.0ff5cd0965b66p-19},
+        {139,0x1.b52da57f66573p-18,0x1.258802fd5057cp-16},
+        {140,-0x1.14441bd7b0883p-16,0x1.5d13819fbcabap-15},
+        {141,-0x1.37c634e52e015p-14,0x1.3584ff74a9e65p-15},
+        {142,-0x1.071f904b9df9p-13,-0x1.261ca482f9c56p-15},
+        {143,-0x1.94a7e01f0cea1p-14,-0x1.3f1e1e6eb2a92p-13},
+        {144,0x1.3aca3f821d91p-15,-0x1.cf83105582ab9p-13},
+        {145,0x1.a17d3e62a60aep-13,-0x1.4a54c238909dap-13},
+        {146,0x1.1355cb6ef7724p-12,0x1.19c1d0e16ec6ep-16},
+        {147,0x1.6e65f524480c3p-13,0x1.7715e0c2dd7dap-13},
+        {148,0x1.26d1e884b150cp-17,0x1.c7657fa296c72p-13},
+        {149,-0x1.cbd6801413a6dp-14,0x1.14fdb393aab7ep-13},
+        {150,-0x1.f8d12205fc6b6p-14,0x1.2659542bff978p-16},
+        {151,-0x1.078a85b246234p-14,-0x1.5fc2d121e3a3fp-15},
+        {152,-0x1.45133d25b05d4p-17,-0x1.3f867912fa4d2p-15},
+        {153,0x1.e0aed7c24443dp-18,-0x1.c8fa3a3f22cdep-17},
+        {154,0x1.6deeae11eec73p-19,-0x1.0df39ca159d0ep-20},
+        {142,0x1.45657a52c45b8p-18,0x1.b26c8ce8c3d5ep-19},
+        {143,0x1.78abe6460a61cp-18,0x1.55b8cf02fce82p-16},
+        {144,-0x1.58ad509c69febp-16,0x1.69ec49992c528p-15},
+        {145,-0x1.49b9152614e73p-14,0x1.210a7afe66bbep-15},
+        {146,-0x1.08bf5c9b12264p-13,-0x1.47d47b5f0dc2fp-15},
+        {147,-0x1.90cae1fbac63cp-14,-0x1.41932b2c6c0ap-13},
+        {148,0x1.235f311aa7746p-15,-0x1.cf182695395b2p-13},
+        {149,0x1.9533dcca4e845p-13,-0x1.56527538aa347p-13},
+        {150,0x1.13f3c32fc2eaep-12,0x1.a1a6d303bb466p-19},
+        {151,0x1.8be94757f693dp-13,0x1.5ed8d128a2964p-13},
+        {152,0x1.ec39cc13a7c45p-16,0x1.ce1994494bd59p-13},
+        {153,-0x1.9c49fddb69889p-14,0x1.3a01798552df4p-13},
+        {154,-0x1.075c70e1a3b0ep-13,0x1.2b021f9bffdfap-15},
+        {155,-0x1.40d138d1d29bap-14,-0x1.2b83c556d39e7p-15},
+        {156,-0x1.401a82b9a4838p-16,-0x1.65abc99ee44b2p-15},
+        {157,0x1.8bb45b139724ep-18,-0x1.487548eb7cb4ep-16},
+        {158,0x1.37648eb54e984p-18,-0x1.8ac40e1c8aacdp-19},
+        {146,0x1.26a835826b7ep-18,0x1.5ec86d6748a8bp-19},
+        {147,0x1.ac27296aa4afep-18,0x1.2e1681831acp-16},
+        {148,-0x1.faa312010470ep-17,0x1.57f48d57abbf7p-15},
+        {149,-0x1.1f9185ecf2c68p-14,0x1.4cd377db01437p-15},
+        {150,-0x1.fd81b06108fa1p-14,-0x1.5b3b6e95f1dd5p-16},
+        {151,-0x1.d1979fe9c5874p-14,-0x1.0f90c71ef798ap-13},
+        {152,-0x1.b86dd18743b07p-19,-0x1.c11e809254801p-13},
+        {153,0x1.44939b2b4a3f5p-13,-0x1.92fd66c66c08p-13},
+        {154,0x1.0da0ab65ea55p-12,-0x1.b3e692b26b2a6p-15},
+        {155,0x1.dc7a8d7c941efp-13,0x1.0093b708982a4p-13},
+        {156,0x1.704c02ca1102p-14,0x1.c86f3edc8616ap-13},
+        {157,-0x1.f6e3aeaf19b02p-15,0x1.88a3b6180e64p-13},
+        {158,-0x1.0a15794dc3dd6p-13,0x1.534505b130571p-14},
+        {159,-0x1.afca0dde86634p-14,-0x1.b4e05c97a201p-17},
+        {160,-0x1.682b178fc7163p-15,-0x1.8159de2136ca9p-15},
+        {161,-0x1.f249e837f6876p-20,-0x1.0aea1f8312ecfp-15},
+        {162,0x1.dc64244842088p-18,-0x1.43399dfde7de8p-17},
+        {151,0x1.e49870df88bbep-18,0x1.78f057ae2e23ep-17},
+        {152,-0x1.ca5d1b34e60dcp-19,0x1.178f6fdef3bb9p-15},
+        {153,-0x1.78a4bb8c5f77p-15,0x1.8025b2b50de66p-15},
+        {154,-0x1.b106e7ea331a3p-14,0x1.a8316d3f6ee24p-17},
+        {155,-0x1.0ac76131d2709p-13,-0x1.4848a2384df24p-14},
+        {156,-0x1.1441fd6c5e38ap-14,-0x1.7f644a861de32p-13},
+        {157,0x1.393893bd0d2b2p-14,-0x1.cccf15a4f601p-13},
+        {158,0x1.c4b1a550bbceap-13,-0x1.2203548979e86p-13},
+        {159,0x1.1239f7e6d66bp-12,0x1.c86baf31bd46cp-16},
+        {160,0x1.76bd3d79d2c9dp-13,0x1.708c61ca59002p-13},
+        {161,0x1.be4212e8fb87ep-16,0x1.cd6ade1b83bfap-13},
+        {162,-0x1.8ea77774b1002p-14,0x1.42dabe68fadb2p-13},
+        {163,-0x1.0ac6cd1e20482p-13,0x1.7e9c2d71b3bf8p-15},
+        {164,-0x1.68ea606bd63bfp-14,-0x1.ed1d558320ff7p-16},
+        {165,-0x1.e4050534e6ccep-16,-0x1.7b0adff2cfbacp-15},
+        {166,0x1.7114ff24beff6p-19,-0x1.b4fd163df8b3p-16},
+        {167,0x1.af28b4a20cf9bp-18,-0x1.b50ef996756edp-18},
+        {155,0x1.51ee68c2bb038p-18,0x1.d7fc1ec6a36d4p-19},
+        {156,0x1.96ced3a709247p-18,0x1.4004aaf80e878p-16},
+        {157,-0x1.ed52d05dcb032p-17,0x1.565b2f66277bdp-15},
+        {158,-0x1.0dceaff4b23c2p-14,0x1.5b0ee8a0f2b52p-15},
+        {159,-0x1.eaaf814ff8698p-14,-0x1.4250a6abd4e45p-17},
+        {160,-0x1.f7af5fb88fbd3p-14,-0x1.c7add16b49e42p-14},
+        {161,-0x1.363b5b83446fap-15,-0x1.a59dc2722b5d7p-13},
+        {162,0x1.c68d7830c63fep-14,-0x1.bdb4ac75d8e59p-13},
+        {163,0x1.ea049ea73e6b2p-13,-0x1.d44d7c11f5978p-14},
+        {164,0x1.0d0fa47204506p-12,0x1.c5a36a3582899p-15},
+        {165,0x1.529dd69c2a1dcp-13,0x1.8a4476913d6f8p-13},
+        {166,0x1.9aa731273e1e5p-17,0x1.c8bf07aaee566p-13},
+        {167,-0x1.a3e10ba95bdc6p-14,0x1.349ff246325bcp-13},
+        {168,-0x1.09b1a97f62f75p-13,0x1.602acea1fba1ep-15},
+        {169,-0x1.674783d1e46bep-14,-0x1.f1df00c7d3a26p-16},
+        {170,-0x1.f6bf94a1b9db4p-16,-0x1.7c7f527c81138p-15},
+        {171,0x1.ff593edf66ebap-20,-0x1.ca1868343b122p-16},
+        {172,0x1.c48463332104ap-18,-0x1.00596a7aff5bbp-17},
+        {160,0x1.dd1c097e6b2e5p-18,0x1.45f5a4107adc2p-17},
+        {161,-0x1.a54430b6237acp-24,0x1.f5666005b628ep-16},
+        {162,-0x1.1d2f55566b5c5p-15,0x1.805afb7e697a9p-15},
+        {163,-0x1.7474b06cc0087p-14,0x1.c89485ed78636p-16},
+        {164,-0x1.0a76afd283a3cp-13,-0x1.764387cd11b89p-15},
+        {165,-0x1.a42ae569253e8p-14,-0x1.345ff45c5c476p-13},
+        {166,0x1.0da5e4894a84ep-17,-0x1.c6ea5525bef4fp-13},
+        {167,0x1.41d6e146c22cp-13,-0x1.947c89d983d0ap-13},
+        {168,0x1.08e48ce15d5d7p-12,-0x1.1dfdf267348bep-14},
+        {169,0x1.fc8265bdd275ep-13,0x1.8c2590dfb00e7p-14},
+        {170,0x1.0fdc339a358dep-13,0x1.ad8475dd2f65p-13},
+        {171,-0x1.f498d292182dep-17,0x1.b950d63740acep-13},
+        {172,-0x1.d0764c524e39p-14,0x1.107755b8dd38ep-13},
+        {173,-0x1.03ff1de18fd9cp-13,0x1.e6c15df1ff46ap-16},
+        {174,-0x1.4c916cc1bf693p-14,-0x1.1d4a059a6e86cp-15},
+        {175,-0x1.b7a5f2cb9649ap-16,-0x1.76b6711ce1cc6p-15},
+        {176,0x1.6f086bd3af625p-19,-0x1.b554cd3d2e9a5p-16},
+        {177,0x1.beb2344f9ae2cp-18,-0x1.e99d3ee20869p-18},
+        {164,0x1.fa7f398b1fe58p-19,0x1.001302e4ef611p-19},
+        {165,0x1.e1015635e6218p-18,0x1.c73bc83037f4cp-17},
+        {166,-0x1.2e3dc171b286fp-18,0x1.1f9433de7a644p-15},
+        {167,-0x1.650d0dea3da88p-15,0x1.815c2bcf25e74p-15},
+        {168,-0x1.94862137a0f8p-14,0x1.538f9db3a704ap-16},
+        {169,-0x1.0c80265643504p-13,-0x1.d28d467b2cb1ep-15},
+        {170,-0x1.8a2226568e595p-14,-0x1.458e00444f906p-13},
+        {171,0x1.09878a1b4fd84p-16,-0x1.ca0f7942f9e5cp-13},
+        {172,0x1.4969608704ebbp-13,-0x1.8ff1684afc55ap-13},
+        {173,0x1.08c04669ebebep-12,-0x1.1f8e81d53ee26p-14},
+        {174,0x1.00756a8dbeecep-12,0x1.783997695057cp-14},
+        {175,0x1.21e237d4c239bp-13,0x1.a559c9df4b7e8p-13},
+        {176,-0x1.93b1a3f049fa6p-19,0x1.c127d9b198c46p-13},
+        {177,-0x1.b2abed2c6001p-14,0x1.29a45edeee06fp-13},
+        {178,-0x1.09cf4bede5285p-13,0x1.6466e68c075f6p-15},
+        {179,-0x1.75ec87532c7b2p-14,-0x1.c398ac0c4f059p-16},
+        {180,-0x1.2b97a20f1ca4cp-15,-0x1.814bfb734a9edp-15},
+        {181,-0x1.7445f9737a1eap-20,-0x1.06bdb561d5642p-15},
+        {182,0x1.e496dbe34a92cp-18,-0x1.7803a7c1f152ap-17},
+        {183,0x1.917ecaa7a2464p-19,-0x1.4254d60215375p-20},
+        {169,0x1.879ca1124b67dp-18,0x1.4eb2a0bc4e116p-18},
+        {170,0x1.743bcf9afae2ep-18,0x1.5885e138b5f6ap-16},
+        {171,-0x1.db10e72523bb6p-17,0x1.5418dbdc00acap-15},
+        {172,-0x1.ec0158116739ap-15,0x1.6a897f3c1fecep-15},
+        {173,-0x1.cb6bda933fb4ap-14,0x1.03375b61672dep-18},
+        {174,-0x1.0a1d93748806ap-13,-0x1.510e3ce57bcd4p-14},
+        {175,-0x1.3bbf8cf955e9ap-14,-0x1.6ec53a231ca4p-13},
+        {176,0x1.6b360251714acp-15,-0x1.cfd9e10c99e8dp-13},
+        {177,0x1.7662bcd73bfd7p-13,-0x1.70a99c6e97897p-13},
+        {178,0x1.0ed55ad3734aap-12,-0x1.859707830d942p-15},
+        {179,0x1.f035f8364d7bp-13,0x1.bd6c9f1e8bf26p-14},
+        {180,0x1.089e854fdee9bp-13,0x1.b072296077fd3p-13},
+        {181,-0x1.6854bcacde162p-17,0x1.bc38cc4ce7941p-13},
+        {182,-0x1.baf35fe1ed94ep-14,0x1.231213d25e96cp-13},
+        {183,-0x1.09a6ab1574ep-13,0x1.60cece95e0734p-15},
+        {184,-0x1.7af290bf4b6fp-14,-0x1.b29638a934701p-16},
+        {185,-0x1.3fb8530435521p-15,-0x1.81f8406399449p-15},
+        {186,-0x1.984dbc646f307p-19,-0x1.1493bc4b59128p-15},
+        {187,0x1.e3ac45a833372p-18,-0x1.b29b9ce22014p-17},
+        {188,0x1.f4cda3cc46b02p-19,-0x1.f447d0f9db004p-20},
+        {174,0x1.a95fef2e20514p-18,0x1.a31daf95b63f6p-18},
+        {175,0x1.3fdc1e260d7f2p-18,0x1.775c9ad2ef893p-16},
+        {176,-0x1.10681006672a1p-16,0x1.5c0bc012279f6p-15},
+        {177,-0x1.faf46e9679ebap-15,0x1.6601824fabdb2p-15},
+        {178,-0x1.cc54c40312b12p-14,0x1.d6dfe0597089ep-19},
+        {179,-0x1.0ab06c46f426ap-13,-0x1.47b869899be1dp-14},
+        {180,-0x1.4e6ffb85a1ea8p-14,-0x1.660bf833b11d9p-13},
+        {181,0x1.1001d4eb1e032p-15,-0x1.ce7e5e2c3d33p-13},
+        {182,0x1.5aff00a8f1e6ep-13,-0x1.8499bc7c845a6p-13},
+        {183,0x1.0939a1280692ep-12,-0x1.19118d44198f3p-14},
+        {184,0x1.03502a85c5adep-12,0x1.5c4352e4d3dbp-14},
+        {185,0x1.3e17a46afca43p-13,0x1.96871978ebd5fp-13},
+        {186,0x1.2a081dd8b6d0bp-16,0x1.caadc9b444ee8p-13},
+        {187,-0x1.73b3ad5eab5e5p-14,0x1.52b0cb71214ep-13},
+        {188,-0x1.0c7da751f9b9ep-13,0x1.1bacf0edf3f7p-14},
+        {189,-0x1.b8bc5e8de3cc4p-14,-0x1.56bae5eca8d93p-17},
+        {190,-0x1.caf36f0568fa4p-15,-0x1.72fe4cad6d4d6p-15},
+        {191,-0x1.a8b9f1e8a8bb4p-17,-0x1.4db129d26d178p-15},
+        {192,0x1.7d905788ea89ep-18,-0x1.524b068ec29eep-16},
+        {193,0x1.8aaa007560968p-18,-0x1.55517deebf73ap-18},
+        {179,0x1.79de4296deaa1p-18,0x1.31e29c641bfd1p-18},
+        {180,0x1.a1f93ff46ee1cp-18,0x1.36e3867598fe3p-16},
+        {181,-0x1.392275e5b37c4p-17,0x1.3d6eee91bfad1p-15},
+        {182,-0x1.8f0b4ca3b2718p-15,0x1.7d88504e2c3cep-15},
+        {183,-0x1.97cf70034a6f9p-14,0x1.4574d527d3074p-16},
+        {184,-0x1.0b7ef8e454ec5p-13,-0x1.9de992058d0eap-15},
+        {185,-0x1.b4ad8d323e1e6p-14,-0x1.27eeb67e0aa4dp-13},
+        {186,-0x1.ec5aecbb8c436p-17,-0x1.b95caf9977863p-13},
+        {187,0x1.de893a4aaa00ap-14,-0x1.b9b7a39affd0fp-13},
+        {188,0x1.d7fd9fa98268cp-13,-0x1.06f9ee4727f24p-13},
+        {189,0x1.134f73f434b92p-12,0x1.fd0129e95687ep-17},
+        {190,0x1.b1f41aa497d5dp-13,0x1.38446db9ca17ep-13},
+        {191,0x1.6db1a55d5c672p-14,0x1.c87490814cff7p-13},
+        {192,-0x1.3b12685a927e7p-15,0x1.a4d42c523749ep-13},
+        {193,-0x1.dfb7991332b5ap-14,0x1.00eb046773c88p-13},
+        {194,-0x1.05a790c3b00ddp-13,0x1.0f5bda72532c4p-15},
+        {195,-0x1.6ed9af129ed46p-14,-0x1.d9dbd780e674dp-16},
+        {196,-0x1.400e02a499d26p-15,-0x1.81e4ae4772d05p-15},
+        {197,-0x1.22fc6895480a9p-18,-0x1.1e4ebb0ee01e8p-15},
+        {198,0x1.d70c211301a1cp-18,-0x1.f4b536371ff62p-17},
+        {199,0x1.3858b5949cde1p-18,-0x1.8c16f0c6fa7b4p-19},
+        {184,0x1.bab266305bd59p-19,0x1.85e33bee1eb9cp-20},
+        {185,0x1.e14959b68d15ap-18,0x1.5aa52ee1c7bc8p-17},
+        {186,0x1.ad858e159e177p-20,0x1.d10babf7ed453p-16},
+        {187,-0x1.8b454871fa6e4p-16,0x1.7130c196606c8p-15},
+        {188,-0x1.1d3e9e63fa798p-14,0x1.4e5b78b96b499p-15},
+        {189,-0x1.da73facd0663p-14,-0x1.2111808d9e35p-19},
+        {190,-0x1.09dd5973197cep-13,-0x1.53798ab71487ep-14},
+        {191,-0x1.5830bd95d86bbp-14,-0x1.612ace10f856cp-13},
+        {192,0x1.612281200df79p-16,-0x1.cbaaf6a4767bcp-13},
+        {193,0x1.355cf3c50b4ecp-13,-0x1.9b4872f2e344p-13},
+        {194,0x1.fb20a1583d393p-13,-0x1.9143ecb01b056p-14},
+        {195,0x1.0f155ba280424p-12,0x1.79b4b93c99602p-15},
+        {196,0x1.8d159471dd56ap-13,0x1.5d6557fc3b9cbp-13},
+        {197,0x1.1de8c43b20662p-14,0x1.ce1548cc9154cp-13},
+        {198,-0x1.9e2684736359cp-15,0x1.96f491be4d9c5p-13},
+        {199,-0x1.edc4d1c895e5ap-14,0x1.e130994b6b6c4p-14},
+        {200,-0x1.035ab87f931dp-13,0x1.d73cba3cf55bcp-16},
+        {201,-0x1.69df2efefff9ep-14,-0x1.e912417b3c457p-16},
+        {202,-0x1.42424bea4c7a4p-15,-0x1.81e0f4905a5d6p-15},
+        {203,-0x1.58f4c14113a38p-18,-0x1.23f44a889188dp-15},
+        {204,0x1.ca8f6561f5d7ep-18,-0x1.0d3f00be0bccp-16},
+        {205,0x1.580370431de0ep-18,-0x1.ea40c6d2dc6bp-19},
+        {190,0x1.b474be346388cp-18,0x1.c4cfdef7b6e84p-18},
+        {191,0x1.57cee17496abap-18,0x1.69e6362dc4153p-16},
+        {192,-0x1.9b8ac45281294p-17,0x1.4bd84e219a5b6p-15},
+        {193,-0x1.a1e3ff7945c3p-15,0x1.7ac45fdc16fe7p-15},
+        {194,-0x1.95ce271562b84p-14,0x1.4d4653b05e697p-16},
+        {195,-0x1.0a09455df88p-13,-0x1.6e11c34455f6p-15},
+        {196,-0x1.d025ad687c3ep-14,-0x1.1063d3d626d7ap-13},
+        {197,-0x1.25e61870f2c73p-15,-0x1.a766dfd0fa2b1p-13},
+        {198,0x1.5aecefc75ef87p-14,-0x1.ca0f3921c3dfp-13},
+        {199,0x1.9f1891df5352ep-13,-0x1.4c3b5e14b14e8p-13},
+        {200,0x1.109febc1d6718p-12,-0x1.35e4e4c30e47dp-15},
+        {201,0x1.f7544127bcd1fp-13,0x1.a0f380b32f3dep-14},
+        {202,0x1.350f6e51522edp-13,0x1.9b67900e3fd6ep-13},
+        {203,0x1.98aee9c84ac8ep-16,0x1.cc94849db2cd1p-13},
+        {204,-0x1.461cd8db72e63p-14,0x1.69db45e457b6ep-13},
+        {205,-0x1.0733e1ab7f55p-13,0x1.72c0016b012p-14},
+        {206,-0x1.e9d4d3fde766cp-14,0x1.394fc5009bd2cp-17},
+        {207,-0x1.39f6617b6e728p-14,-0x1.3275411b28a98p-15},
+        {208,-0x1.f54caa8f12e18p-16,-0x1.7c237acfa483ap-15},
+        {209,-0x1.9f4159b37dae3p-20,-0x1.080df75efab48p-15},
+        {210,0x1.e0d7a544f047cp-18,-0x1.c88802bd0d23p-17},
+        {211,0x1.30f383bfff3b8p-18,-0x1.77d34b14b9f3ap-19},
+        {195,0x1.0be5ae984e381p-18,0x1.1e4749e9767a2p-19},
+        {196,0x1.e540403ccd52p-18,0x1.819feb50ad3dp-17},
+        {197,0x1.46e50845f0eccp-20,0x1.d9a0139d18da2p-16},
+        {198,-0x1.797678a2c8abp-16,0x1.6ea63adee0146p-15},
+        {199,-0x1.0b8cdc285e876p-14,0x1.5c3e02a2ba4abp-15},
+        {200,-0x1.c452f8a0f43cap-14,0x1.a77fa7666a222p-18},
+        {201,-0x1.0c9fbc75b3e12p-13,-0x1.0a33cc339012ap-14},
+        {202,-0x1.a13f899dd1a84p-14,-0x1.360eab770b6a4p-13},
+        {203,-0x1.04937ef710ac3p-16,-0x1.b89ccda2727abp-13},
+        {204,0x1.ac1ab2f095842p-14,-0x1.c130a0bb4baf4p-13},
+        {205,0x1.b78be7dbe1d3p-13,-0x1.31a65cfbc3baep-13},
+        {206,0x1.1283cbcaa4d38p-12,-0x1.88852205b4bc2p-16},
+        {207,0x1.ee1b56d5067b3p-13,0x1.c471e518d971p-14},
+        {208,0x1.2b36d0b253adap-13,0x1.a083282e85018p-13},
+        {209,0x1.81ff00ce6e49ep-16,0x1.cc2b7be5dffc7p-13},
+        {210,-0x1.40515d52cdf5cp-14,0x1.6c7baa9a7a1ecp-13},
+        {211,-0x1.055ec5eeccc6p-13,0x1.83d1d4b4a4b8ep-14},
+        {212,-0x1.f2f3a7d9a7691p-14,0x1.e08903705289fp-17},
+        {213,-0x1.4ec0b797cea5ap-14,-0x1.1a049f172b71p-15},
+        {214,-0x1.26b72358c25dep-15,-0x1.80c4a0e6a8ebep-15},
+        {215,-0x1.3a0ca67a29e4cp-18,-0x1.20b1c1ff9a542p-15},
+        {216,0x1.c26fc0b843ba1p-18,-0x1.173a94ed875p-16},
+        {217,0x1.73fdd505be77ap-18,-0x1.2617712fb8d74p-18},
+        {200,0x1.572748eb51bd8p-19,0x1.d714031b2b852p-21},
+        {201,0x1.c0a67b3b9876p-18,0x1.efcd6176c38dep-18},
+        {202,0x1.5573d18346422p-18,0x1.6b35c941499d3p-16},
+        {203,-0x1.6d89bec1c3b3cp-17,0x1.4553438c88702p-15},
+        {204,-0x1.7a506eef3bfa3p-15,0x1.7f8d0d8e97a3ap-15},
+        {205,-0x1.77ac75da0b577p-14,0x1.bc7c472ad76b2p-16},
+        {206,-0x1.02c4bd9ec1626p-13,-0x1.c8995556618acp-16},
+        {207,-0x1.fa8230966ac7p-14,-0x1.bdd4210b8f2aep-14},
+        {208,-0x1.130c5cf362ba6p-14,-0x1.7f7658a432e26p-13},
+        {209,0x1.2b66afb90ae1ap-15,-0x1.ced7daa9a0718p-13},
+        {210,0x1.3e742bab9da1ap-13,-0x1.961b268727c11p-13},
+        {211,0x1.f5367d98f881dp-13,-0x1.a920820325086p-14},
+        {212,0x1.120d34eae9762p-12,0x1.c7c7e20127bc9p-16},
+        {213,0x1.b74b07eae33aep-13,0x1.31e39db08c956p-13},
+        {214,0x1.b8ed8a70f261bp-14,0x1.bf60c9e0c63ecp-13},
+        {215,-0x1.4d3c38d8b259ap-17,0x1.bc8cf350e2ae8p-13},
+        {216,-0x1.8d826feef8ea8p-14,0x1.4317897b7b668p-13},
+        {217,-0x1.0bc6ab4534622p-13,0x1.2ed2cb1a1d1dap-14},
+        {218,-0x1.d7d7483c62b1ep-14,0x1.2c38be6623eb4p-20},
+        {219,-0x1.2a83a8787cf8bp-14,-0x1.4217410699a46p-15},
+        {220,-0x1.e7461bb043da5p-16,-0x1.7af4e58f191f3p-15},
+        {221,-0x1.1fa2c8e1bb764p-19,-0x1.0d21026e8328p-15},
+        {222,0x1.d69243822667p-18,-0x1.f6685c9c2f783p-17},
+        {223,0x1.5d7ebfdbe62fcp-18,-0x1.fba6a59c9f6b5p-19},
+        {207,0x1.83a36311beb37p-18,0x1.454b4867e19bfp-18},
+        {208,0x1.c2665af8c734ap-18,0x1.173f820ba12cap-16},
+        {209,-0x1.dda1e9f94560cp-19,0x1.186b105850188p-15},
+        {210,-0x1.0224c4309d64cp-15,0x1.7d14a789a984cp-15},
+        {211,-0x1.2dc0d340f87bcp-14,0x1.3edb126abd9f1p-15},
+        {212,-0x1.d5f59b2fe36c6p-14,-0x1.8a8696a4e324ap-22},
+        {213,-0x1.0c3836be8776ap-13,-0x1.1ff002e3bd438p-14},
+        {214,-0x1.9f9011549ace6p-14,-0x1.371bed308c28cp-13},
+        {215,-0x1.5c8a2ee87ae54p-16,-0x1.b46de48467502p-13},
+        {216,0x1.763d901aa736ep-14,-0x1.c76c7567536d8p-13},
+        {217,0x1.98a9202ab4f48p-13,-0x1.52648cdaf2502p-13},
+        {218,0x1.0d3bb0d6bcaccp-12,-0x1.b9b648609a9bap-15},
+        {219,0x1.06b5a94465b0ep-12,0x1.363a7e1ed5976p-14},
+        {220,0x1.76bafa1169d82p-13,0x1.700cf8337d274p-13},
+        {221,0x1.22c17724195ccp-14,0x1.cdb1b22f65cfp-13},
+        {222,-0x1.39c06047ae0bfp-15,0x1.a4cb81e007bfep-13},
+        {223,-0x1.c3f77729d5388p-14,0x1.1b1fc21a4e634p-13},
+        {224,-0x1.0c4076625c231p-13,0x1.cf97fd3698f52p-15},
+        {225,-0x1.bd3625a396d86p-14,-0x1.22f75e556e9acp-17},
+        {226,-0x1.0dc4853dbe736p-14,-0x1.5a79630b7fbf8p-15},
+        {227,-0x1.a07558bd7148cp-16,-0x1.73bc9782f8f45p-15},
+        {228,-0x1.5c353bf06eb6cp-21,-0x1.ffa5386e9cbf4p-16},
+        {229,0x1.dde66100ff88p-18,-0x1.d8a7fc3d3c031p-17},
+        {230,0x1.5539059eaa62cp-18,-0x1.e06aaa7bd6ffcp-19},
+        {213,0x1.865cfe0804fep-18,0x1.4afbee2d0515p-18},
+        {214,0x1.c6397c4e66eadp-18,0x1.12b1e63ef7914p-16},
+        {215,-0x1.6f01bc61dfacep-19,0x1.11f0fbe94f19dp-15},
+        {216,-0x1.d87e04786e11cp-16,0x1.7998aff7b1be2p-15},
+        {217,-0x1.1ac83e3251d1ap-14,0x1.501800cb14a72p-15},
+        {218,-0x1.c37fa902214c8p-14,0x1.b6b76a9631bp-18},
+        {219,-0x1.0c531bd334126p-13,-0x1.d8ba11f93e9f4p-15},
+        {220,-0x1.c689bfbd7c852p-14,-0x1.18d29d342ff77p-13},
+        {221,-0x1.5a237ece3d561p-15,-0x1.a080dad3fb818p-13},
+        {222,0x1.00f5e63c8a43ep-14,-0x1.cf00553e04fdp-13},
+        {223,0x1.62510337682cep-13,-0x1.7f3a80ceb727fp-13},
+        {224,0x1.00906a7fdba22p-12,-0x1.758081b6fcb77p-14},
+        {225,0x1.112ae5b8169c6p-12,0x1.15e80ff349adcp-15},
+        {226,0x1.b9633b4580b3cp-13,0x1.2f4857e03ea03p-13},
+        {227,0x1.db389256c6822p-14,0x1.ba053b4de7b36p-13},
+        {228,0x1.00695f835b19p-18,0x1.c489dbc39131ap-13},
+        {229,-0x1.5a9a9f349852p-14,0x1.5fb4761e3611ep-13},
+        {230,-0x1.055a9d0e50fb1p-13,0x1.8318e2b40f727p-14},
+        {231,-0x1.fb80b1ab29559p-14,0x1.4b8eebf3aa677p-16},
+        {232,-0x1.6e1e11ab5af0bp-14,-0x1.dafc9cfbd2698p-16},
+        {233,-0x1.7c5fa49e902fap-15,-0x1.7f40da9ab3f8p-15},
+        {234,-0x1.a4eabab00a696p-17,-0x1.4cfa40faf522p-15},
+        {235,0x1.10e1dfd980d5p-18,-0x1.8ec2c7ca4e5d2p-16},
+        {236,0x1.dae0101e2d25cp-18,-0x1.3b9cfe12f1e4cp-17},
+        {237,0x1.e7843044eb81cp-19,-0x1.d757057d8d27cp-20},
+        {219,0x1.2c4ca5be28dp-18,0x1.6ab0a7ff69b23p-19},
+        {220,0x1.e52e7017ed57ep-18,0x1.7dff46950d53cp-17},
+        {221,0x1.6d61829af77eap-19,0x1.b545733f9eb88p-16},
+        {222,-0x1.017f308ab5892p-16,0x1.587f04a6d48abp-15},
+        {223,-0x1.96e0cec90ba4fp-15,0x1.7c1edae1b99cbp-15},
+        {224,-0x1.76c51a78e74e4p-14,0x1.bed3ec75ea6bp-16},
+        {225,-0x1.fd64e107abd44p-14,-0x1.620df3c1955fbp-16},
+        {226,-0x1.059b4815700b8p-13,-0x1.8083a6f3e8876p-14},
+        {227,-0x1.649fe903fe15ep-14,-0x1.5a79e2eb0c60ap-13},
+        {228,-0x1.85be72bc86f0cp-19,-0x1.c0d716c0b83bap-13},
+        {229,0x1.af58796ae85c1p-14,-0x1.c094a6ab56c79p-13},
+        {230,0x1.a4336023627f6p-13,-0x1.46bb15d2a4938p-13},
+        {231,0x1.0d6304df0b255p-12,-0x1.b3043f9306b9ap-15},
+        {232,0x1.08c6ef82a8b92p-12,0x1.1ca3981cb931dp-14},
+        {233,0x1.8bd6a6b636242p-13,0x1.5e2f38b68be16p-13},
+        {234,0x1.7134e5bc59314p-14,0x1.c7d5e79c8ed8ep-13},
+        {235,-0x1.0f55d687cf112p-16,0x1.b7f6e51b35578p-13},
+        {236,-0x1.86e1a06fc5a76p-14,0x1.470865408887p-13},
+        {237,-0x1.09961c70d3f89p-13,0x1.54c42d248e4cfp-14},
+        {238,-0x1.f03e4e226bb3p-14,0x1.b122a765799e9p-17},
+        {239,-0x1.5f9248d43fb2ep-14,-0x1.031a9449425f1p-15},
+        {240,-0x1.6a9b508953ed4p-15,-0x1.80918436c0e9dp-15},
+        {241,-0x1.904117c2c0fdbp-17,-0x1.4a2638dec4cd6p-15},
+        {242,0x1.0e60216160862p-18,-0x1.8fe7502b70f9ep-16},
+        {243,0x1.ddfd9ed9fd8cp-18,-0x1.485c1ef666ffdp-17},
+        {244,0x1.05f70346bb4p-18,-0x1.10b1eacf33e9cp-19},
+        {225,0x1.37b24eef8c9a8p-18,0x1.88b0a9a90c018p-19},
+        {226,0x1.e5736148506b3p-18,0x1.83d5d5beedc19p-17},
+        {227,0x1.7e7baa416f0f4p-19,0x1.b1dfb1c703ab2p-16},
+        {228,-0x1.e168a11160048p-17,0x1.548ce352ca9a6p-15},
+        {229,-0x1.8187bd2c6b24ap-15,0x1.7ea3b43ccec2p-15},
+        {230,-0x1.673a4ecfb737ep-14,0x1.efad9c40934dap-16},
+        {231,-0x1.f218da9f0adc6p-14,-0x1.d57ae1a101c05p-17},
+        {232,-0x1.09bc2144aef77p-13,-0x1.523631213517cp-14},
+        {233,-0x1.8ee62cb3bd98dp-14,-0x1.41f91b350a0fp-13},
+        {234,-0x1.6f94c3bb1768dp-16,-0x1.b35ce46756decp-13},
+        {235,0x1.49533dfb36cb8p-14,-0x1.cb31c57147639p-13},
+        {236,0x1.76609edacf574p-13,-0x1.702a739ca5742p-13},
+        {237,0x1.02c568015eaf2p-12,-0x1.5fbdeb4c6127ap-14},
+        {238,0x1.114e7abcab148p-12,0x1.0bcfc0bbdd466p-15},
+        {239,0x1.c3b9fb40fadc8p-13,0x1.22650a7428dc6p-13},
+        {240,0x1.08d3cc8b9a2a7p-13,0x1.aff0c9d23f17fp-13},
+        {241,0x1.7308ada7bc3a8p-16,0x1.cbb6186137cfbp-13},
+        {242,-0x1.1604d8ed33dbdp-14,0x1.7e1cae583cf29p-13},
+        {243,-0x1.ed6e0f844dbfcp-14,0x1.e0cbdf6278aa8p-14},
+        {244,-0x1.0979a296cc27cp-13,0x1.63696ef79c47ap-15},
+        {245,-0x1.aedc8d082755dp-14,-0x1.b64eee36e5a2cp-17},
+        {246,-0x1.0bc06c45d546p-14,-0x1.5bbe82f285088p-15},
+        {247,-0x1.c84a1aad7c4c2p-16,-0x1.77fb764dbf7d6p-15},
+        {248,-0x1.ab3a5707e4094p-19,-0x1.1572473d67c6ep-15},
+        {249,0x1.b36f32e434534p-18,-0x1.26ffff1139d8cp-16},
+        {250,0x1.a59c67d552ccep-18,-0x1.970cfb80a84d5p-18},
+        {232,0x1.1cc1bae8dd9a8p-18,0x1.43bc12df94f6cp-19},
+        {233,0x1.dfe87157515cep-18,0x1.515b2f711fd4p-17},
+        {234,0x1.20cda7613e61ap-18,0x1.86fd810314fbap-16},
+        {235,-0x1.4af5b7811927ep-17,0x1.3ff780df8e408p-15},
+        {236,-0x1.3d3f8652b8ee7p-15,0x1.8168a0c65ca78p-15},
+        {237,-0x1.3c897de68be83p-14,0x1.2f0ab966578cp-15},
+        {238,-0x1.d1ce73bf550c8p-14,0x1.41ef6fa8cbafbp-20},
+        {239,-0x1.0c56f3f7c6f1cp-13,-0x1.e597b5f8775bap-15},
+        {240,-0x1.d1789b0f90edcp-14,-0x1.0e9c3a055f8b2p-13},
+        {241,-0x1.c39c3a00e77dap-15,-0x1.90b321218a0b6p-13},
+        {242,0x1.2c8fb989dcd5cp-15,-0x1.cea644d1dde78p-13},
+        {243,0x1.1ed3bc7c40e9p-13,-0x1.a6468b2c54a6ap-13},
+        {244,0x1.ce569c97c2d86p-13,-0x1.14309c6e008eep-13},
+        {245,0x1.11f6b787c2b9fp-12,-0x1.c4601a3a26e7dp-16},
+        {246,0x1.02360e1352872p-12,0x1.65064657d9e2cp-14},
+        {247,0x1.79e380f4cb3c6p-13,0x1.6d4d4b1744c95p-13},
+        {248,0x1.5f52529e976f2p-14,0x1.c963a16f6475ap-13},
+        {249,-0x1.e785a5d439542p-17,0x1.b918f4e60fa19p-13},
+        {250,-0x1.74d545ce55154p-14,0x1.5184b6ad7e964p-13},
+        {251,-0x1.05ca3f0521cfap-13,0x1.7e2c2beb920b1p-14},
+        {252,-0x1.00b8b9bdfb692p-13,0x1.95604f55e9d24p-16},
+        {253,-0x1.881f9536bb711p-14,-0x1.811fbd108f2bp-16},
+        {254,-0x1.ccd8bcb9ecb26p-15,-0x1.71f3a14500d54p-15},
+        {255,-0x1.67375fae3dcc8p-16,-0x1.6baf4880be2bp-15},
+        {256,-0x1.7a6d63980061ep-21,-0x1.0040ecd8625bp-15},
+        {257,0x1.ce53b1d7e8362p-18,-0x1.081095e7a6f8ep-16},
+        {258,0x1.90668a309c73ep-18,-0x1.61000689d583p-18},
+        {239,0x1.675cae55d282ep-18,0x1.0dfde1d0aac5cp-18},
+        {240,0x1.e3595d1c6ce04p-18,0x1.b7298dbe92effp-17},
+        {241,0x1.209060cadd4b2p-19,0x1.c39d41964cad8p-16},
+        {242,-0x1.e8a02901a1772p-17,0x1.55554d339a62cp-15},
+        {243,-0x1.720e1c9666b28p-15,0x1.7fe29efff9602p-15},
+        {244,-0x1.5547b619404f4p-14,0x1.10e8bde568662p-15},
+        {245,-0x1.e037cabe0fcbdp-14,-0x1.4aba7fad52158p-18},
+        {246,-0x1.0c5e49c6d824bp-13,-0x1.0e3706d000b77p-14},
+        {247,-0x1.c693afe215f6cp-14,-0x1.187b28cbce6d2p-13},
+        {248,-0x1.aa7ee0c4dcee9p-15,-0x1.94a573a598224p-13},
+        {249,0x1.359e8afd2593ep-15,-0x1.cec0bbcef8304p-13},
+        {250,0x1.1b4420e9ea882p-13,-0x1.a7e08a4373cbp-13},
+        {251,0x1.c7eeb64bb0924p-13,-0x1.1cc51a0aaa734p-13},
+        {252,0x1.10b96a28a2ff6p-12,-0x1.282d293527998p-15},
+        {253,0x1.0679aadbf8a19p-12,0x1.37899b134ceb4p-14},
+        {254,0x1.90a3deeb8caf5p-13,0x1.59a404ce639b4p-13},
+        {255,0x1.a2ef5de4b04aap-14,0x1.c2153dbbc204cp-13},
+        {256,0x1.60e9e78ac8008p-19,0x1.c3c0b27a9978cp-13},
+        {257,-0x1.3e5240bfa3218p-14,0x1.6d06787cb7264p-13},
+        {258,-0x1.f6b965041f121p-14,0x1.c795098d31fdep-14},
+        {259,-0x1.08e9c54d61228p-13,0x1.56c9a08dec94fp-15},
+        {260,-0x1.b3d93389f854ap-14,-0x1.82e91c30a0c99p-17},
+        {261,-0x1.1b7d3a304b3aap-14,-0x1.4f2c3bbb6102p-15},
+        {262,-0x1.0d232f09462a7p-15,-0x1.7e330cfdaaaa4p-15},
+        {263,-0x1.d36accf2b1ac8p-18,-0x1.2f8f78e884c19p-15},
+        {264,0x1.57b56c5e02968p-18,-0x1.69b74defd4735p-16},
+        {265,0x1.d88475956ab8bp-18,-0x1.328e5661f196ep-17},
+        {266,0x1.0d22c80beff52p-18,-0x1.1faaa1783d769p-19},
+        {246,0x1.4ebd8ab9266e4p-18,0x1.caa1a92a33facp-19},
+        {247,0x1.e58a1ee320c63p-18,0x1.8407c4dc88a31p-17},
+        {248,0x1.ea52db052e4e6p-19,0x1.9b37b0a5694e4p-16},
+        {249,-0x1.5b6c30b507f42p-17,0x1.42685a8a6e8c4p-15},
+        {250,-0x1.33b613b838c88p-15,0x1.81056d2578cd2p-15},
+        {251,-0x1.2dbc30acb4a25p-14,0x1.3e5a2a5ad70bp-15},
+        {252,-0x1.bf0d516f7a544p-14,0x1.0a4fb906db3afp-17},
+        {253,-0x1.09fb00c99ec6dp-13,-0x1.747fcfc77c07ep-15},
+        {254,-0x1.f3c2b912805f3p-14,-0x1.cf9b760cdd1e4p-14},
+        {255,-0x1.3eaceee6f6939p-14,-0x1.6cce196de8ad2p-13},
+        {256,-0x1.4064a70198d42p-23,-0x1.c2385cd9cc114p-13},
+        {257,0x1.8a3b77abeaf88p-14,-0x1.c503ba71630acp-13},
+        {258,0x1.81aab1b0767dep-13,-0x1.66c4076f82834p-13},
+        {259,0x1.019bb0c6c9e61p-12,-0x1.6a61f2391ed32p-14},
+        {260,0x1.12c0ffe4b18a5p-12,0x1.413395e8dc5f4p-16},
+        {261,0x1.debf27d124789p-13,0x1.f76984d93df96p-14},
+        {262,0x1.430ee951ae73fp-13,0x1.9312f1a1435c6p-13},
+        {263,0x1.f5a0c59ce3b3ap-15,0x1.cef27a2570166p-13},
+        {264,-0x1.f952cfe3c2693p-16,0x1.abe012691cf5p-13},
+        {265,-0x1.904844dc600f5p-14,0x1.40e2d5a79df7dp-13},
+        {266,-0x1.07afb70e7e8c2p-13,0x1.6a5b8e2c5ab9cp-14},
+        {267,-0x1.004c8a3d12b94p-13,0x1.8c4361bb2cf7cp-16},
+        {268,-0x1.8f356e70004c1p-14,-0x1.656a6e9765ed8p-16},
+        {269,-0x1.edf2a77aff682p-15,-0x1.69220b09e0416p-15},
+        {270,-0x1.b45f17ff230e4p-16,-0x1.75c43934b5fbep-15},
+        {271,-0x1.0b21bd26ce737p-18,-0x1.1b6a554796292p-15},
+        {272,0x1.8c6a273a3b3d6p-18,-0x1.47852ca6dc308p-16},
+        {273,0x1.cb6f2cb042652p-18,-0x1.0e0370a0962e1p-17},
+        {274,0x1.eeda16e897316p-19,-0x1.e3e59aab31b1ep-20},
+        {252,0x1.8b64f23beb7fdp-19,0x1.3483a446289aep-20},
+        {253,0x1.a801e0df2165ep-18,0x1.9d13e401ff9d9p-18},
+        {254,0x1.c8baca188448ep-18,0x1.0f83dd37c594dp-16},
+        {255,-0x1.2462f7519ca92p-24,0x1.f41c206510192p-16},
+        {256,-0x1.2d14245d2a154p-16,0x1.61712a8d3c8fp-15},
+        {257,-0x1.8b058aaf17b6bp-15,0x1.7d5687309488cp-15},
+        {258,-0x1.5a00137c2c888p-14,0x1.0a56947b7ed26p-15},
+        {259,-0x1.dd7a7536c0038p-14,-0x1.f7d711bd0efdcp-19},
+        {260,-0x1.0c4d8e2c74815p-13,-0x1.f0885e938773cp-15},
+        {261,-0x1.da8a4d92e0674p-14,-0x1.056001897e8bep-13},
+        {262,-0x1.0da1ddfd95805p-14,-0x1.8120338a7a8e1p-13},
+        {263,0x1.d1b6efede4d08p-17,-0x1.c8bba2454bc4p-13},
+        {264,0x1.be97cad48a4fdp-14,-0x1.be2fb92e84dc1p-13},
+        {265,0x1.92af1fbf42d28p-13,-0x1.579dc60d5bb7cp-13},
+        {266,0x1.04cc4afc727f4p-12,-0x1.499f0a38b8eafp-14},
+        {267,0x1.1228d01b10c4bp-12,0x1.9efb799ab82dbp-16},
+        {268,0x1.db98e5e07bbf6p-13,0x1.008d2074bcd2ap-13},
+        {269,0x1.4311c3f932635p-13,0x1.9303a30979f2p-13},
+        {270,0x1.0567ce11484dcp-14,0x1.ce976e7f222b9p-13},
+        {271,-0x1.b205a8d920a46p-16,0x1.afc05e96c9464p-13},
+        {272,-0x1.7fc58e1b4783ep-14,0x1.4afff1a064f5cp-13},
+        {273,-0x1.048e9215771bfp-13,0x1.881a5f1bce486p-14},
+        {274,-0x1.04a22d6650101p-13,0x1.044f845e37f9bp-15},
+        {275,-0x1.a511c51d351a2p-14,-0x1.0859bfc885462p-16},
+        {276,-0x1.130fbe910cb4ap-14,-0x1.55e15e2d75346p-15},
+        {277,-0x1.0d9652c19fb35p-15,-0x1.7e25c20d1e654p-15},
+        {278,-0x1.0d55dbc1e0952p-17,-0x1.35d0a5aad97d6p-15},
+        {279,0x1.252c109c5b5ddp-18,-0x1.84b8800c2ed59p-16},
+        {280,0x1.e3eca8677eb18p-18,-0x1.6bf215b1469a9p-17},
+        {281,0x1.450c8fc0ab47ap-18,-0x1.ad5dfb3fa56c4p-19},
+        {260,0x1.a9ffe9763b9ep-19,0x1.65581ed2d28c7p-20},
+        {261,0x1.adb1b7280d5eap-18,0x1.ad8cdf63ac2a2p-18},
+        {262,0x1.c878a808d9d1p-18,0x1.0fd49d88e96f2p-16},
+        {263,0x1.27cbbebf4f652p-22,0x1.ed2b544296f5p-16},
+        {264,-0x1.1575027edd26cp-16,0x1.5c9ec92d606fcp-15},
+        {265,-0x1.71b8a46acb5e2p-15,0x1.7fb7dc3de00f3p-15},
+        {266,-0x1.47d6f37e50a66p-14,0x1.21923eace3e82p-15},
+        {267,-0x1.ccb6b85d4be62p-14,0x1.99a61e45db1p-19},
+        {268,-0x1.0acb989b4f074p-13,-0x1.9213d8a07cffp-15},
+        {269,-0x1.f37f2d3fd54bap-14,-0x1.cfda5a3125df8p-14},
+        {270,-0x1.4c5e56116abd6p-14,-0x1.664c282e1bdb2p-13},
+        {271,-0x1.48842581855dp-17,-0x1.bc3b22fb41492p-13},
+        {272,0x1.46cc89b6b6cfcp-14,-0x1.cb21df20ccb2p-13},
+        {273,0x1.5b11d3ea8e332p-13,-0x1.83d13a6eb129bp-13},
+        {274,0x1.e776e787d567ep-13,-0x1.da2f6f5877544p-14},
+        {275,0x1.12e2b823ae05cp-12,-0x1.1c7e83d0238dbp-16},
+        {276,0x1.03102cd995f2dp-12,0x1.5b6f95f8ef495p-14},
+        {277,0x1.909d9500631c3p-13,0x1.5974d2d8466fap-13},
+        {278,0x1.c56fb83a7366p-14,0x1.bd1ce08df4604p-13},
+        {279,0x1.30f9c9838e088p-16,0x1.ca3b639e5242cp-13},
+        {280,-0x1.ef34c7ea704dep-15,0x1.891c8b8c67f96p-13},
+        {281,-0x1.cb018ee33acc9p-14,0x1.1445711752accp-13},
+        {282,-0x1.0c0010b7c2e6ep-13,0x1.1d8ea6af78265p-14},
+        {283,-0x1.ee2f847f58c71p-14,0x1.924dc8b4eab27p-17},
+        {284,-0x1.7785948997bd2p-14,-0x1.bad3e100c2b22p-16},
+        {285,-0x1.cdc3848b8e4c8p-15,-0x1.71719288769cp-15},
+        {286,-0x1.9cf69aac24e64p-16,-0x1.72f3fc9216124p-15},
+        {287,-0x1.1198dca55d8ep-18,-0x1.1c100c9a58ce9p-15},
+        {288,0x1.77d0df63c8d7bp-18,-0x1.55c467eeac70ep-16},
+        {289,0x1.d8bdf12543e31p-18,-0x1.32d99101835c2p-17},
+        {290,0x1.232bd24d860c6p-18,-0x1.5255824a03439p-19},
+        {268,0x1.6362bd0b9007dp-18,0x1.06774375d2e48p-18},
+        {269,0x1.e5ac5cef16d2bp-18,0x1.85a75f72370c3p-17},
+        {270,0x1.1d892f795e53ap-18,0x1.8863fc7ed7bd5p-16},
+        {271,-0x1.e892e3dfe98d2p-18,0x1.315758bf4dcfp-15},
+        {272,-0x1.eaa42c0567d9fp-16,0x1.7abfbe4bbcc85p-15},
+        {273,-0x1.f71771494098fp-15,0x1.6627436f3bca6p-15},
+        {274,-0x1.87a35d1a2e71p-14,0x1.818a6720b8c8ap-16},
+        {275,-0x1.f5b40e3dd53cap-14,-0x1.12b7f2961f047p-16},
+        {276,-0x1.0b785d63af8a7p-13,-0x1.2d9ee01e80cdbp-14},
+        {277,-0x1.c5f7b83315c8fp-14,-0x1.18ac5f1c186e4p-13},
+        {278,-0x1.ebb6aa1f93024p-15,-0x1.89aa8f5e4ebf8p-13},
+        {279,0x1.11e405fef1b3fp-16,-0x1.c989d1490d0eap-13},
+        {280,0x1.b2d71b606da24p-14,-0x1.bfc043d38278fp-13},
+        {281,0x1.84bdc0a2e51aap-13,-0x1.63f28c20aefep-13},
+        {282,0x1.fd77463a2fa58p-13,-0x1.84397dc8c7a22p-14},
+        {283,0x1.137f80b9e62b6p-12,0x1.d60d792b5a334p-19},
+        {284,0x1.f74ae12ec844p-13,0x1.9e92555909047p-14},
+        {285,0x1.79e0e3e07230cp-13,0x1.6cfce54c308dfp-13},
+        {286,0x1.98c9c3fefb132p-14,0x1.c32606c27126ep-13},
+        {287,0x1.5e1bd8fe825e6p-17,0x1.c73b605a9f5cbp-13},
+        {288,-0x1.087e156b6b2a7p-14,0x1.82f0777ab7eb2p-13},
+        {289,-0x1.cfe3902d29b3dp-14,0x1.0faa6a0782302p-13},
+        {290,-0x1.0c014e581eb26p-13,0x1.1baabd5bb8aadp-14},
+        {291,-0x1.efeabf1fbc905p-14,0x1.b3b988e14248cp-17},
+        {292,-0x1.7e2e810215f56p-14,-0x1.a3bf706fbc493p-16},
+        {293,-0x1.e356e3494cee6p-15,-0x1.6be3086f90d62p-15},
+        {294,-0x1.cb0b608de0211p-16,-0x1.77f45e80ba958p-15},
+        {295,-0x1.9b497d03736a2p-18,-0x1.2a28a881bf3c8p-15},
+        {296,0x1.3c03bfe7d92d3p-18,-0x1.78ec5e9094d74p-16},
+        {297,0x1.e43dbfe8f2dcp-18,-0x1.6e5fab3458a37p-17},
+        {298,0x1.544f24860bec4p-18,-0x1.db2855d6c7f5ep-19},
+        {275,0x1.640dcaae474bp-19,0x1.f39d496643596p-21},
+        {276,0x1.87d735e91f15ap-18,0x1.4cbcaa1e6d7dcp-18},
+        {277,0x1.e318f8cd49f5p-18,0x1.b9fa2b6bd67e8p-17},
+        {278,0x1.c2ec04922bb2fp-19,0x1.a38ea23126ebcp-16},
+        {279,-0x1.2ac369268b4a8p-17,0x1.3aa1e6372a644p-15},
+        {280,-0x1.046673673acfp-15,0x1.7cdf72c2ae8e4p-15},
+        {281,-0x1.00c98ddbbcb8p-14,0x1.62bdc12af5804p-15},
+        {282,-0x1.88c9f5116358p-14,0x1.7ceb4a574ef5bp-16},
+        {283,-0x1.f41505ba70b27p-14,-0x1.0301bc8201058p-16},
+        {284,-0x1.0bd2eceed77f6p-13,-0x1.216cecd1d440ap-14},
+        {285,-0x1.d0945216bb2c6p-14,-0x1.0eea82bf66558p-13},
+        {286,-0x1.113bed2a922e8p-14,-0x1.7f90dc6c6774ap-13},
+        {287,0x1.62705e1d7f42fp-18,-0x1.c4d4f8a26a8c2p-13},
+        {288,0x1.77161a110051p-14,-0x1.c6daff45998e4p-13},
+        {289,0x1.66ef5f82b7fb4p-13,-0x1.7b646715941a4p-13},
+        {290,0x1.e90d4ca5b6164p-13,-0x1.d43c456aa18f4p-14},
+        {291,0x1.127ac4dffd617p-12,-0x1.5f728ab483ebp-16},
+        {292,0x1.068057cc1e9e8p-12,0x1.35a3e13d93208p-14},
+        {293,0x1.a6aa5fdab12b1p-13,0x1.4393b6b569ddap-13},
+        {294,0x1.0903968e8b84ap-13,0x1.af7c530c067p-13},
+        {295,0x1.58f5892e81236p-15,0x1.cef701e1a8e4ap-13},
+        {296,-0x1.367eec0f7eb78p-15,0x1.a4b5c68823c34p-13},
+        {297,-0x1.8bca8334d0db7p-14,0x1.437220756c9dcp-13},
+        {298,-0x1.039bd082ee245p-13,0x1.8ee7968aff7c9p-14},
+        {299,-0x1.07653a59b68d2p-13,0x1.38a7d7220dc65p-15},
+        {300,-0x1.bd9c295dfb1p-14,-0x1.1724c427088ep-17},
+        {301,-0x1.3cdfd307762e4p-14,-0x1.2e0df513c106dp-15},
+        {302,-0x1.6c7ecc754ac32p-15,-0x1.7ff3782e5021bp-15},
+        {303,-0x1.232319c78b6e4p-16,-0x1.5f586f5c49e3p-15},
+        {304,-0x1.ae77474fbfa38p-21,-0x1.00fd780f5ca54p-15},
+        {305,0x1.abdcacde77db4p-18,-0x1.2df33921fdb3p-16},
+        {306,0x1.cb100c9bd7e58p-18,-0x1.0ca0c565c7b2p-17},
+        {307,0x1.11f0c376554d2p-18,-0x1.293f739149051p-19},
+        {284,0x1.4fb6d4d715248p-18,0x1.cc2f1cb52648bp-19},
+        {285,0x1.e0ddc762db6b6p-18,0x1.550bacce3a11ap-17},
+        {286,0x1.6ef552d756a2dp-18,0x1.5b65e30797396p-16},
+        {287,-0x1.b374001fc77ecp-19,0x1.15acd606ce448p-15},
+        {288,-0x1.615e8d1fd1a23p-16,0x1.6a712d3ecee2fp-15},
+        {289,-0x1.8f4b4da1fc33p-15,0x1.7c8536da431d4p-15},
+        {290,-0x1.4b954adb15074p-14,0x1.1ca5ef9a4ad41p-15},
+        {291,-0x1.c623d3f10c344p-14,0x1.686ae60db6e0dp-18},
+        {292,-0x1.08583330f04c3p-13,-0x1.4e6cc05952f3p-15},
+        {293,-0x1.02f318192b157p-13,-0x1.93c7257f72a8p-14},
+        {294,-0x1.8d8e06915fbaep-14,-0x1.4240e0c5ad9f1p-13},
+        {295,-0x1.4d2d71e6e7b66p-15,-0x1.a1b7092a1c2d8p-13},
+        {296,0x1.28988d398680bp-15,-0x1.ce3b16f71d82bp-13},
+        {297,0x1.efadb4de80441p-14,-0x1.b5fb293ea9b2ep-13},
+        {298,0x1.9504afd31a828p-13,-0x1.551ee5218dc15p-13},
+        {299,0x1.00db5c29a93a9p-12,-0x1.702b2209cc5bap-14},
+        {300,0x1.1372696ddc15ep-12,0x1.9ffd8510ec196p-19},
+        {301,0x1.fc89855b45077p-13,0x1.87c68a7dbb94ep-14},
+        {302,0x1.8bc6cb6ce3afcp-13,0x1.5da092c4f555bp-13},
+        {303,0x1.d8eb10378db2p-14,0x1.b9e15b33705a8p-13},
+        {304,0x1.f6f8954a8ea71p-16,0x1.cd46c276b80fap-13},
+        {305,-0x1.71e1d2b4dcd6ep-15,0x1.9cb44c9a159p-13},
+        {306,-0x1.99177642a792p-14,0x1.3abc4ccd4d7c5p-13},
+        {307,-0x1.04ec1d6b15a38p-13,0x1.8368de2a24dfap-14},
+        {308,-0x1.0702ab948ccb8p-13,0x1.31a071f7ac548p-15},
+        {309,-0x1.bf0e775f3a5efp-14,-0x1.061c9cb2256b1p-17},
+        {310,-0x1.42bb6823341e2p-14,-0x1.27464686d9febp-15},
+        {311,-0x1.7ebea179177fp-15,-0x1.7e61da76cba6ep-15},
+        {312,-0x1.48aa2f7ce3dc2p-16,-0x1.66545edd650c2p-15},
+        {313,-0x1.41cb685d60127p-19,-0x1.0ee7a241ef678p-15},
+        {314,0x1.82ea649459a04p-18,-0x1.4e254cc490436p-16},
+        {315,0x1.dcdd1ca6ae3a3p-18,-0x1.41ce7dce0cb66p-17},
+        {316,0x1.420170e504bc8p-18,-0x1.a368d957dd4a3p-19},
+        {291,0x1.ce7f2ad622de7p-19,0x1.a399667aeb9e8p-20},
+        {292,0x1.a8a6ba1d67eb1p-18,0x1.9ddf1a46a7f0fp-18},
+        {293,0x1.da40096ceeed2p-18,0x1.e8eba6d3104c6p-17},
+        {294,0x1.6f8b676657bc2p-19,0x1.b4636cf36971dp-16},
+        {295,-0x1.387894a5fe616p-17,0x1.3cc416456203ap-15},
+        {296,-0x1.faed10fb68f9dp-16,0x1.7bd040a42de8cp-15},
+        {297,-0x1.ea3e381616e4ap-15,0x1.69b44ae6efa4p-15},
+        {298,-0x1.767363c04a10ep-14,0x1.bd49532fa71d2p-16},
+        {299,-0x1.e36ce6196ea22p-14,-0x1.bedb81a32421cp-18},
+        {300,-0x1.0bc2ca8162f6p-13,-0x1.ca6140887ef6cp-15},
+        {301,-0x1.f28acbca52937p-14,-0x1.d16f6588f1ee1p-14},
+        {302,-0x1.62eb1c0657438p-14,-0x1.5abae8f7af6e6p-13},
+        {303,-0x1.b64ef12607156p-16,-0x1.af3f6f501791p-13},
+        {304,0x1.9ef012dfb8312p-15,-0x1.cf36bd7d7091cp-13},
+        {305,0x1.10a3d4998a7ccp-13,-0x1.ac3018de87dccp-13},
+        {306,0x1.a532455c6e66ep-13,-0x1.44f5347a9471ep-13},
+        {307,0x1.043e731a306f8p-12,-0x1.4df7729d78a2cp-14},
+        {308,0x1.133b8889a58bap-12,0x1.3f412ad8c491ap-17},
+        {309,0x1.f8fa93c256195p-13,0x1.96cdddaf35956p-14},
+        {310,0x1.8957c8a665bacp-13,0x1.5fb8699938786p-13},
+        {311,0x1.dbf0d6ad1934cp-14,0x1.b953ecbf30952p-13},
+        {312,0x1.1315f4d4150b6p-15,0x1.cdc3985bd96dp-13},
+        {313,-0x1.504bc3c0d83d6p-15,0x1.a13f4d03b785fp-13},
+        {314,-0x1.89e39fb1c1df4p-14,0x1.447b8199acb96p-13},
+        {315,-0x1.01664650c1fd3p-13,0x1.9f1c121041ecp-14},
+        {316,-0x1.0989caca0b24p-13,0x1.6e18f2b142c47p-15},
+        {317,-0x1.d02086d758106p-14,-0x1.b65dbd9e43527p-20},
+        {318,-0x1.5becf46599319p-14,-0x1.070fe4723954bp-15},
+        {319,-0x1.b53a3ccde19bp-15,-0x1.76612b52dd804p-15},
+        {320,-0x1.a5d41aca57c6bp-16,-0x1.73cf5e31412d6p-15},
+        {321,-0x1.9713fc5df22acp-18,-0x1.29a51b53a4046p-15},
+        {322,0x1.1a58925a3f97cp-18,-0x1.89ce370cafc4dp-16},
+        {323,0x1.e535d311e6f11p-18,-0x1.a3c738628ab93p-17},
+        {324,0x1.861d61cf247d3p-18,-0x1.48a433332e4c6p-18},
+        {325,0x1.77e209a0045b2p-19,-0x1.1550a8804b3d2p-20},
+        {300,0x1.685902a0b18b5p-19,0x1.fd4dae5084f14p-21},
+        {301,0x1.7987be923c191p-18,0x1.2e8cf1bee1225p-18},
+        {302,0x1.e5c2031380ebap-18,0x1.84083b1036f1ap-17},
+        {303,0x1.4d92ae9e4db26p-18,0x1.6f314a5c07ef8p-16},
+        {304,-0x1.fe0033739cd86p-19,0x1.19d5dc7566025p-15},
+        {305,-0x1.5bef541778b07p-16,0x1.69777f77113e9p-15},
+        {306,-0x1.7da70912f4364p-15,0x1.7e5615e8fea24p-15},
+        {307,-0x1.3a99cdedf1f9ap-14,0x1.303635a3132fcp-15},
+        {308,-0x1.b20c914e9319p-14,0x1.8f04808bafd6ap-17},
+        {309,-0x1.029d8616f5a99p-13,-0x1.d1fb1d8747db7p-16},
+        {310,-0x1.09c8f228aee27p-13,-0x1.4b666002b098cp-14},
+        {311,-0x1.c4b006c6a3344p-14,-0x1.19675f01d7abap-13},
+        {312,-0x1.10a11da69213bp-14,-0x1.7f998c3fdd686p-13},
+        {313,-0x1.3c1dcdc584befp-20,-0x1.c145aca50d02ep-13},
+        {314,0x1.3b54d541d8503p-14,-0x1.cba326cd27e3p-13},
+        {315,0x1.3ea3c88d461fcp-13,-0x1.95317c1b44dc6p-13},
+        {316,0x1.c4396bf6df6p-13,-0x1.20e290bd3f6d2p-13},
+        {317,0x1.0ad4c2b229a37p-12,-0x1.f98157062a35ep-15},
+        {318,0x1.11b3adf38ebaap-12,0x1.c6809e9a3006ep-16},
+        {319,0x1.eacb9b5be4602p-13,0x1.cd57f06d3b572p-14},
+        {320,0x1.76b6e55caed7cp-13,0x1.6f38b035757cp-13},
+        {321,0x1.b9f3fc85328b1p-14,0x1.be830f50b86a7p-13},
+        {322,0x1.c9caf3374c8e9p-16,0x1.cc913b76dc7c4p-13},
+        {323,-0x1.6549b38d6fc57p-15,0x1.9e5670bea4866p-13},
+        {324,-0x1.8b37c52c4a975p-14,0x1.439029c98bcb9p-13},
+        {325,-0x1.009376881c122p-13,0x1.a495a724d5104p-14},
+        {326,-0x1.0a3f1e34d222cp-13,0x1.8586ae927dfc4p-15},
+        {327,-0x1.d829898df4e0ap-14,0x1.bc449ce3a11d2p-20},
+        {328,-0x1.6aa7a9f4f10dep-14,-0x1.e2b7fa0b14448p-16},
+        {329,-0x1.da43bed087b9p-15,-0x1.6df15e0d2f2f1p-15},
+        {330,-0x1.edca4a8d6f4e6p-16,-0x1.7ac3517325882p-15},
+        {331,-0x1.3853f7ce1c803p-17,-0x1.3cb270c02a7e2p-15},
+        {332,0x1.4e9e279d36ebap-19,-0x1.baa7e7be35564p-16},
+        {333,0x1.d43d8f6069406p-18,-0x1.fe47d0aaa584p-17},
+        {334,0x1.b63de48cc3dadp-18,-0x1.c77edbaf53282p-18},
+        {335,0x1.017912015a615p-18,-0x1.04c5882e3da0cp-19},
+        {309,0x1.28495c9d5251cp-18,0x1.5d6bed93291fap-19},
+        {310,0x1.ca1393d3116c9p-18,0x1.09c928241f21bp-17},
+        {311,0x1.c2dadbc35f5fcp-18,0x1.1686ed07515cap-16},
+        {312,0x1.adb490048f816p-20,0x1.d02c3e2521d6bp-16},
+        {313,-0x1.649a03b33ca99p-17,0x1.4373fa6ce2332p-15},
+        {314,-0x1.01c26e5a40b62p-15,0x1.7c47a35c9d364p-15},
+        {315,-0x1.e0a8ae2e2912ep-15,0x1.6c2b7350a827cp-15},
+        {316,-0x1.6a71ae1fb8c5cp-14,0x1.e3145a5e66188p-16},
+        {317,-0x1.d5794631ccf8p-14,-0x1.326492d19cc2cp-21},
+        {318,-0x1.09717fe7d26bp-13,-0x1.6ddd2b8a7a40cp-15},
+        {319,-0x1.0326714f84e88p-13,-0x1.9112a50d707d4p-14},
+        {320,-0x1.9d449130dea89p-14,-0x1.37a611eeb7958p-13},
+        {321,-0x1.aba7c59437bc5p-15,-0x1.93eff0dc99d58p-13},
+        {322,0x1.f19bd60eba872p-17,-0x1.c8b5f416c9b31p-13},
+        {323,0x1.7a7e9e6e7b39ep-14,-0x1.c645a4d6979eap-13},
+        {324,0x1.571d473bf0f3ap-13,-0x1.860cc591e0cf2p-13},
+        {325,0x1.d2d55584c3814p-13,-0x1.0ce63769e7995p-13},
+        {326,0x1.0d47bc5216c1p-12,-0x1.ab64a2de8699ep-15},
+        {327,0x1.10a5a63b53941p-12,0x1.1f1ff6b8aa4e9p-15},
+        {328,0x1.e5cd73fb436ecp-13,0x1.de81e96b9381ep-14},
+        {329,0x1.72e71d1c72c1p-13,0x1.722255715cdcbp-13},
+        {330,0x1.ba0a00ddf2e22p-14,0x1.be7066715fac4p-13},
+        {331,0x1.ed3fb8966677ap-16,0x1.ccfc15c8ac7c2p-13},
+        {332,-0x1.4841472eba6cbp-15,0x1.a22dd2f0d70cap-13},
+        {333,-0x1.7cdaa33146f26p-14,0x1.4c309fb8f60ffp-13},
+        {334,-0x1.f91c5a6e2a96p-14,0x1.be311fbcef136p-14},
+        {335,-0x1.0b871dbfd6286p-13,0x1.c069013503982p-15},
+        {336,-0x1.e64d3f7d48388p-14,0x1.1108cbb4b7facp-17},
+        {337,-0x1.81de57847059ep-14,-0x1.9519e537dbcb6p-16},
+        {338,-0x1.087790982cfep-14,-0x1.5d1fc727e6581p-15},
+        {339,-0x1.2a7fc197f7a86p-15,-0x1.8018c69ec3b94p-15},
+        {340,-0x1.d5fcb64525d64p-17,-0x1.52b45024095f5p-15},
+        {341,-0x1.cd72b4bb5a0ebp-23,-0x1.f6907197b8867p-16},
+        {342,0x1.9e9a78ddfc124p-18,-0x1.393bb18ee8b32p-16},
+        {343,0x1.db5159bc22024p-18,-0x1.3b09342293de7p-17},
+        {344,0x1.4e7f607adbd4ep-18,-0x1.c77bc876049f6p-19},
+        {318,0x1.394a69430f4b8p-18,0x1.89bf8c023654p-19},
+        {319,0x1.cff55bd4c9d4p-18,0x1.17ce85efc7156p-17},
+        {320,0x1.be3d9579db19dp-18,0x1.1bae2b0f3c43dp-16},
+        {321,0x1.a930b00756e3dp-20,0x1.d07fbd376e7fap-16},
+        {322,-0x1.56674f80fe058p-17,0x1.4148844338f3dp-15},
+        {323,-0x1.ede8443352244p-16,0x1.7aa5d21b1f5ap-15},
+        {324,-0x1.ccc75c13ae5ffp-15,0x1.7113fac2e787cp-15},
+        {325,-0x1.5d11edfb748c2p-14,0x1.05096f0bc1418p-15},
+        {326,-0x1.c88c84f1a9346p-14,0x1.265b8ee72572p-18},
+        {327,-0x1.067fd30f4d983p-13,-0x1.2ad165ca79047p-15},
+        {328,-0x1.07c6ec888e43cp-13,-0x1.64e6a6d69b246p-14},
+        {329,-0x1.bd14df32dd7f7p-14,-0x1.1fa61109d93aap-13},
+        {330,-0x1.1035f09b3d784p-14,-0x1.7f9f847796726p-13},
+        {331,-0x1.4eb99e89974d4p-18,-0x1.beea34ded31cep-13},
+        {332,0x1.17911ca6a065ep-14,-0x1.cd743f67c9eefp-13},
+        {333,0x1.257abe03e4394p-13,-0x1.a26aeb48ad9a9p-13},
+        {334,0x1.aabd23212bcd6p-13,-0x1.3ec8fe9296d0cp-13},
+        {335,0x1.02d013f180598p-12,-0x1.5bbe637379a38p-14},
+        {336,0x1.135743f46ec7fp-12,-0x1.cc174660eec8cp-20},
+        {337,0x1.041986ce3cd58p-12,0x1.4e6c7933dc7ap-14},
+        {338,0x1.af718ed626d5cp-13,0x1.399bd2d113c39p-13},
+        {339,0x1.2b86282940d64p-13,0x1.9f64bca0e51afp-13},
+        {340,0x1.24638ab5669a7p-14,0x1.ccd91895476abp-13},
+        {341,-0x1.290a6cab498d2p-19,0x1.c090153fcf25bp-13},
+        {342,-0x1.0747c06cdcde3p-14,0x1.82ff15cce635dp-13},
+        {343,-0x1.b7bc2fa5b4f87p-14,0x1.23fdb4600933ep-13},
+        {344,-0x1.06f6f4259a374p-13,0x1.6de647320d294p-14},
+        {345,-0x1.0748c711827d9p-13,0x1.3aa11d1697d82p-15},
+        {346,-0x1.cc540ecbcd27dp-14,-0x1.9111ad10f0f49p-19},
+        {347,-0x1.61e3ebde10c13p-14,-0x1.fc5242837c96ep-16},
+        {348,-0x1.d6563e6f29f2bp-15,-0x1.6ec22c57107e5p-15},
+        {349,-0x1.fdafefc885fp-16,-0x1.7bd0bf31bcbe4p-15},
+        {350,-0x1.6c0b4d7fda8e2p-17,-0x1.4480211c0d132p-15},
+        {351,0x1.4d60512163fdep-20,-0x1.d83a6b6418ba6p-16},
+        {352,0x1.b7a7d66e438e8p-18,-0x1.22935106dfca9p-16},
+        {353,0x1.d394d418f9376p-18,-0x1.219aaa20dcf68p-17},
+        {354,0x1.40f60bae24ba1p-18,-0x1.9f2ccdc5582bbp-19},
+        {327,0x1.cefdf4bac9ecp-19,0x1.a284a2c6f817cp-20},
+        {328,0x1.96f3c06d8a292p-18,0x1.6e4318b3301c4p-18},
+        {329,0x1.e59a2e65c0814p-18,0x1.9ebbc29bbeb0bp-17},
+        {330,0x1.4b6de982005eap-18,0x1.704174073ff28p-16},
+        {331,-0x1.7f0855078970fp-19,0x1.126bcf93e7c6ep-15},
+        {332,-0x1.255cc9d897f01p-16,0x1.5f7c32f8a97aep-15},
+        {333,-0x1.467aa7f76a839p-15,0x1.80bae69b2538bp-15},
+        {334,-0x1.11962d08b9652p-14,0x1.5620d071698a5p-15},
+        {335,-0x1.83eb1353a914p-14,0x1.8cf785d9d8c1ap-16},
+        {336,-0x1.e31c9a487e39p-14,-0x1.bfd3bf721c8p-18},
+        {337,-0x1.0aa45ab0eac5p-13,-0x1.990707bb6a572p-15},
+        {338,-0x1.019e38b26aaecp-13,-0x1.9c02e95ffd21p-14},
+        {339,-0x1.9e4981cb69d74p-14,-0x1.36c2b89456813p-13},
+        {340,-0x1.ca2549b94598ep-15,-0x1.8ee7b6dec77c9p-13},
+        {341,0x1.a070a559f2838p-18,-0x1.c4ec3c70886d4p-13},
+        {342,0x1.41b5d6b3738d2p-14,-0x1.cb06bbe833835p-13},
+        {343,0x1.34fa0470c5dacp-13,-0x1.9a5b182450ec8p-13},
+        {344,0x1.b375479117b6cp-13,-0x1.34f6676ff3ecep-13},
+        {345,0x1.0448f80fd0c0dp-12,-0x1.4c128993da03bp-14},
+        {346,0x1.13506457c1993p-12,-0x1.da6f2c8aff36p-24},
+        {347,0x1.045d9f0c21be7p-12,0x1.4b35cafaba146p-14},
+        {348,0x1.b3c12d6febf29p-13,0x1.349f39041b3b6p-13},
+        {349,0x1.355c70b6e7b5dp-13,0x1.9a25d61a2ce53p-13},
+        {350,0x1.4289ac05730e4p-14,0x1.caf81e989c662p-13},
+        {351,0x1.acba525a6de2p-18,0x1.c50274ea58dcdp-13},
+        {352,-0x1.c8ec5548996e2p-15,0x1.8f1b3f168c722p-13},
+        {353,-0x1.9de4bab3975e9p-14,0x1.370837590b2f7p-13},
+        {354,-0x1.0189e8f96822cp-13,0x1.9c9872abe898p-14},
+        {355,-0x1.0aab19ad56d4p-13,0x1.9a190616451a3p-15},
+        {356,-0x1.e352553a145e6p-14,0x1.c68cfe125b0d9p-18},
+        {357,-0x1.843736998953ep-14,-0x1.8be11fecf877fp-16},
+        {358,-0x1.11e708dceabeap-14,-0x1.55e1e21dc26d8p-15},
+        {359,-0x1.47097a0fe467cp-15,-0x1.80bb192bf264cp-15},
+        {360,-0x1.26320b2a32e1p-16,-0x1.5fa68271025cep-15},
+        {361,-0x1.8318517168814p-19,-0x1.12a97d5976f24p-15},
+        {362,0x1.4a8f589bd632ap-18,-0x1.70bcf96844716p-16},
+        {363,0x1.e5905f576536ap-18,-0x1.9f808f23befc2p-17},
+        {364,0x1.975ae90b583d8p-18,-0x1.6f3ee271acf31p-18},
+        {365,0x1.d00174c509145p-19,-0x1.a46008ec09126p-20},
+        {337,0x1.ccfd9aee69398p-19,0x1.9e50202ed5f61p-20},
+        {338,0x1.919c33ef50a92p-18,0x1.6146ddfc78dcap-18},
+        {339,0x1.e60ba58f083aap-18,0x1.8c3116a785026p-17},
+        {340,0x1.686525504e6ap-18,0x1.5f439d3c9d142p-16},
+        {341,-0x1.94d0aa13d466cp-20,0x1.0720445661b98p-15},
+        {342,-0x1.ee268c8736addp-17,0x1.556ed12f18d6ep-15},
+        {343,-0x1.2123e9e375547p-15,0x1.7f4946c927e21p-15},
+        {344,-0x1.f15b7b4132df6p-15,0x1.671ee85869102p-15},
+        {345,-0x1.6889b4f4d4202p-14,0x1.e7f067d6acd47p-16},
+        {346,-0x1.cc2bdad76a5bfp-14,0x1.8f84b6cc6ba52p-19},
+        {347,-0x1.061131b944bb3p-13,-0x1.2460971923d73p-15},
+        {348,-0x1.08f7fd50cec1dp-13,-0x1.548469c1291d2p-14},
+        {349,-0x1.cd1922204c2cp-14,-0x1.116aa7c62dc45p-13},
+        {350,-0x1.37b371a779bddp-14,-0x1.6f2bc00665a4cp-13},
+        {351,-0x1.65485648c02a7p-16,-0x1.b315519f493d8p-13},
+        {352,0x1.7120650101209p-15,-0x1.cec0afd5888ccp-13},
+        {353,0x1.dd05b279135f5p-14,-0x1.b8cfe1475c6eap-13},
+        {354,0x1.765bf8896b5d9p-13,-0x1.6f2c3af905081p-13},
+        {355,0x1.e04fcc663d549p-13,-0x1.eff18f04cc5c6p-14},
+        {356,0x1.0e449037712a5p-12,-0x1.83c2c6447ecbap-15},
+        {357,0x1.10eac67193f2ep-12,0x1.0af80fce1df0fp-15},
+        {358,0x1.ef64563e18248p-13,0x1.bb67cdbce3df9p-14},
+        {359,0x1.8cee47938511ep-13,0x1.5c14ff49db2p-13},
+        {360,0x1.093dca192bac6p-13,0x1.aeedf19cb16c7p-13},
+        {361,0x1.dda5a566dfb68p-15,0x1.ce987d1addf12p-13},
+        {362,-0x1.4a5e9be7f0184p-17,0x1.bba95dd9b9006p-13},
+        {363,-0x1.134dedd5820c3p-14,0x1.7e464589a53e8p-13},
+        {364,-0x1.b7509d4d0d128p-14,0x1.241c3b678b53cp-13},
+        {365,-0x1.058d9bc9b9a4fp-13,0x1.7aef648558ccep-14},
+        {366,-0x1.091e01280c133p-13,0x1.689d303d7a60dp-15},
+        {367,-0x1.db85c6c4981bp-14,0x1.b434e5ad39dfcp-19},
+        {368,-0x1.7cb988686c9cep-14,-0x1.a63de73a6d54ap-16},
+        {369,-0x1.0d79b7f5b7794p-14,-0x1.59245c14b07ecp-15},
+        {370,-0x1.45594a0377f88p-15,-0x1.80a4ec9ae1544p-15},
+        {371,-0x1.2cdc5fd539b46p-16,-0x1.60e545543261cp-15},
+        {372,-0x1.d16bcc88af6edp-19,-0x1.172b15a0d20acp-15},
+        {373,0x1.2f3a76c83c28dp-18,-0x1.7f343551c7fc2p-16},
+        {374,0x1.e2801aaf1fe62p-18,-0x1.bf835de99d25dp-17},
+        {375,0x1.ab58f3ee5ff1ep-18,-0x1.a46e8fc52aa5cp-18},
+        {376,0x1.0827eca521726p-18,-0x1.11c7bcc8fb61p-19},
+        {346,0x1.0685a391acefep-18,0x1.0e0424d38b5eep-19},
+        {347,0x1.a6c3a2a25c531p-18,0x1.970b898aa0878p-18},
+        {348,0x1.e48e69fa0797p-18,0x1.ae38554b92a1p-17},
+        {349,0x1.4b7d37649a37cp-18,0x1.702107e2aa4c8p-16},
+        {350,-0x1.2e6a2e112ae64p-19,0x1.0d74b19e606c5p-15},
+        {351,-0x1.0477f024bf648p-16,0x1.587174627e512p-15},
+        {352,-0x1.2552dbf5e04dfp-15,0x1.7f802ca8fb149p-15},
+        {353,-0x1.f0818ba61fad3p-15,0x1.6746faff30cc8p-15},
+        {354,-0x1.6548d6a6b6b2ap-14,0x1.f16b19e729ep-16},
+        {355,-0x1.c757dfd18ab7p-14,0x1.3d017aad71a92p-18},
+        {356,-0x1.0463c4c5123fdp-13,-0x1.07b463b527b7ap-15},
+        {357,-0x1.0a4731e81fbb2p-13,-0x1.3ed0f13ab81aap-14},
+        {358,-0x1.dab04874418d9p-14,-0x1.03fb41bc2a573p-13},
+        {359,-0x1.5457d08aff9a4p-14,-0x1.61acf01438974p-13},
+        {360,-0x1.0d436f28b856p-15,-0x1.a93cbecfe9a5bp-13},
+        {361,0x1.f2ac848ba199ap-16,-0x1.cccd3c3eabc04p-13},
+        {362,0x1.98d8ad8f9d41p-14,-0x1.c295a95a6850cp-13},
+        {363,0x1.55256d19d0a37p-13,-0x1.87082c311ae2fp-13},
+        {364,0x1.c61673fa4e5c6p-13,-0x1.1df013118a67ep-13},
+        {365,0x1.07accf962649ap-12,-0x1.247aed06e80ffp-14},
+        {366,0x1.132d43ace2c3bp-12,0x1.70e1e5dfde5a8p-18},
+        {367,0x1.03de771220c3p-12,0x1.4fb979d940541p-14},
+        {368,0x1.b7f8bbc2d033dp-13,0x1.2f7f6074d053p-13},
+        {369,0x1.428ab517c1b1ap-13,0x1.92902fa315ac9p-13},
+        {370,0x1.6fca2bdc5be72p-14,0x1.c715293384aa8p-13},
+        {371,0x1.54680c2cf052p-16,0x1.ca56774c0e56cp-13},
+        {372,-0x1.501542242e228p-15,0x1.a0e010667b356p-13},
+        {373,-0x1.6c4cfba3f2b84p-14,0x1.55377a9e438d7p-13},
+        {374,-0x1.e7abcdab73a86p-14,0x1.eb322e2c782d7p-14},
+        {375,-0x1.0b6d9ef85c92bp-13,0x1.227d3c175a38p-14},
+        {376,-0x1.011bdefc385dep-13,0x1.adff85aa6ae26p-16},
+        {377,-0x1.babcb382760e2p-14,-0x1.2f1baa314e61cp-17},
+        {378,-0x1.55cee4112fb0ep-14,-0x1.0e8850b2a02f2p-15},
+        {379,-0x1.d1a820ded8a2ap-15,-0x1.6f9e5bec91734p-15},
+        {380,-0x1.0aff3bb4bf7fep-15,-0x1.7d27c48260d3p-15},
+        {381,-0x1.bbc7134844971p-17,-0x1.4f3bc55d8a20bp-15},
+        {382,-0x1.cf91017bd17c5p-21,-0x1.0149ef292f7dep-15},
+        {383,0x1.734c804e0db8ap-18,-0x1.5857bc5557ed6p-16},
+        {384,0x1.e60950c11a854p-18,-0x1.882a093522abap-17},
+        {385,0x1.9346f9d758e0ap-18,-0x1.64fa0dbc00232p-18},
+        {386,0x1.da80480140282p-19,-0x1.b6d0ecde348d3p-20},
+        {357,0x1.c383c3e92da4p-19,0x1.8c2ec486e229ep-20},
+        {358,0x1.850cf3a66f8eep-18,0x1.44d67bc6c20adp-18},
+        {359,0x1.e3e634814b85p-18,0x1.672376b718a5p-17},
+        {360,0x1.985dd0508305ap-18,0x1.3e0dac71d0ee2p-16},
+        {361,0x1.b4af7553eed41p-21,0x1.e145cb9a6011ap-16},
+        {362,-0x1.4b9347cf1928ep-17,0x1.3f6defe403944p-15},
+        {363,-0x1.bc4cd004fabe9p-16,0x1.75da31ec0a516p-15},
+        {364,-0x1.94f850e575346p-15,0x1.7b13df2dc1926p-15},
+        {365,-0x1.32c535514723ep-14,0x1.37c2cf3df452ep-15},
+        {366,-0x1.995ba8d1f94e1p-14,0x1.3750865af1d68p-16},
+        {367,-0x1.eb99ac44b4c73p-14,-0x1.743fbe1fbb286p-17},
+        {368,-0x1.0acbb3be334f7p-13,-0x1.a612f3bdd5e4ep-15},
+        {369,-0x1.02e52d8ee6931p-13,-0x1.90ed967caac03p-14},
+        {370,-0x1.b0c8f880c1ea2p-14,-0x1.28feca0472d5ap-13},
+        {371,-0x1.146a7ef3212acp-14,-0x1.7daeb114a8353p-13},
+        {372,-0x1.cc405af7705e4p-17,-0x1.b8d1995ba9d5dp-13},
+        {373,0x1.98475fcbc896cp-15,-0x1.cec37c47d17ddp-13},
+        {374,0x1.e0261b7ab3023p-14,-0x1.b82429d3a1dc2p-13},
+        {375,0x1.70a2f08e82e37p-13,-0x1.737393d486ca2p-13},
+        {376,0x1.d74b94891b039p-13,-0x1.05bd18590ce2ap-13},
+        {377,0x1.0b328eba1c23ep-12,-0x1.e88eb1261b5cep-15},
+        {378,0x1.12ad82ad2dabap-12,0x1.fa74a89d862ep-17},
+        {379,0x1.010fd9fb64d38p-12,0x1.6b81d4fad768ep-14},
+        {380,0x1.b1860bd7efaa1p-13,0x1.36d8d5af1eaebp-13},
+        {381,0x1.3e6f644ead768p-13,0x1.94da3e724c8bap-13},
+        {382,0x1.6fee02693f281p-14,0x1.c6fd9289bf42ep-13},
+        {383,0x1.77aedc480563p-16,0x1.cae5707f7a907p-13},
+        {384,-0x1.32a07491dfe35p-15,0x1.a49b45e4645d5p-13},
+        {385,-0x1.5c7eaf112eb8cp-14,0x1.5d7946544c9bbp-13},
+        {386,-0x1.dc2f5fec213f1p-14,0x1.0243e676e1f24p-13},
+        {387,-0x1.0a0fe4b762822p-13,0x1.41b34993f9f2ap-14},
+        {388,-0x1.05464cb728ff3p-13,0x1.17b63721a1b2ep-15},
+        {389,-0x1.cdcdab4788648p-14,-0x1.328910e39c67cp-19},
+        {390,-0x1.70db0be032f91p-14,-0x1.cd3e77e8fa7eap-16},
+        {391,-0x1.0780d1e4a8b62p-14,-0x1.5d3e084cb5ddcp-15},
+        {392,-0x1.46049f49380cep-15,-0x1.807b2157fd4bfp-15},
+        {393,-0x1.3f00a984c73ccp-16,-0x1.642a9263ca39cp-15},
+        {394,-0x1.42db34e5ea312p-18,-0x1.20e6695deea2ap-15},
+        {395,0x1.dda75c2ed099cp-19,-0x1.9d55f348dbb17p-16},
+        {396,0x1.d2d2a16f1b864p-18,-0x1.0160def0108e1p-16},
+        {397,0x1.cb9e97c4eadb8p-18,-0x1.0c78a54bf65aep-17},
+        {398,0x1.45aa8613d9032p-18,-0x1.ab45d4c2beb9fp-19},
+        {367,0x1.e0acf0e273822p-19,0x1.c14f4d7d7a726p-20},
+        {368,0x1.8d58f0a0997d2p-18,0x1.56c51ca8a214fp-18},
+        {369,0x1.e4b57c1f5981p-18,0x1.6e5d9958d8fadp-17},
+        {370,0x1.97cfed4c030ffp-18,0x1.3e738c5cc303ap-16},
+        {371,0x1.0d46debf22a8p-20,0x1.dd1f9182ce1a1p-16},
+        {372,-0x1.341d8373dc8d6p-17,0x1.3bb11eb29b414p-15},
+        {373,-0x1.a2cb0b4ed718ep-16,0x1.72f154e376a6p-15},
+        {374,-0x1.7fe0264eba06cp-15,0x1.7d8291b656a53p-15},
+        {375,-0x1.248c279c5f83cp-14,0x1.458857107553cp-15},
+        {376,-0x1.89ad2eef992fcp-14,0x1.75ee31220d30ap-16},
+        {377,-0x1.de8e47a8f0ca1p-14,-0x1.3d7c157fd02e9p-18},
+        {378,-0x1.0868657a48d1cp-13,-0x1.59d3515b2baf2p-15},
+        {379,-0x1.07c7f4f10875ep-13,-0x1.61b1e4f2a1b2fp-14},
+        {380,-0x1.ceb17812f6ea6p-14,-0x1.0f8f037d586bap-13},
+        {381,-0x1.49d0c28f8e32ep-14,-0x1.669a051b1926ep-13},
+        {382,-0x1.0c45bf1aa4ddp-15,-0x1.a933c6777b3fap-13},
+        {383,0x1.b49aed773ddeap-16,-0x1.cbcf2f2f58891p-13},
+        {384,0x1.7835dd76d5306p-14,-0x1.c618d4900210dp-13},
+        {385,0x1.3ec33aaebcb28p-13,-0x1.9495b6920ebf2p-13},
+        {386,0x1.af071fd9c5e37p-13,-0x1.398ca28e184a4p-13},
+        {387,0x1.fef2bf3c22f4bp-13,-0x1.7a0a416b0470ep-14},
+        {388,0x1.1228065f07518p-12,-0x1.5e8aba439a62ep-16},
+        {389,0x1.0d2395919c806p-12,0x1.a8e61e255d9dep-15},
+        {390,0x1.e2262190a3bcep-13,0x1.e920c6bf5fe6p-14},
+        {391,0x1.832aec96b3058p-13,0x1.645f165f08692p-13},
+        {392,0x1.0959ed1348019p-13,0x1.aea8e58f0f6d8p-13},
+        {393,0x1.072f58104cb24p-14,0x1.cdbf6fd63131p-13},
+        {394,0x1.5eae7cdbe3cc1p-21,0x1.c1d3c87d0056cp-13},
+        {395,-0x1.be182f2952a7dp-15,0x1.90915701e1e2ep-13},
+        {396,-0x1.89b036915a9e8p-14,0x1.43dfde5f9165ep-13},
+        {397,-0x1.f21d0c8d22d5p-14,0x1.d020cd6b24668p-14},
+        {398,-0x1.0ba40880eb485p-13,0x1.13a065d3d2d59p-14},
+        {399,-0x1.008f4ead2764fp-13,0x1.a20b01a0cec84p-16},
+        {400,-0x1.be21a8a47e34ap-14,-0x1.0759bac6829f1p-17},
+        {401,-0x1.603bb538f0596p-14,-0x1.ff7c8a2c6eb28p-16},
+        {402,-0x1.f2edbbded1baap-15,-0x1.6651326758e1p-15},
+        {403,-0x1.325a49df4182p-15,-0x1.7fffd519a37fap-15},
+        {404,-0x1.288f9eb484cp-16,-0x1.5fe187a7eb858p-15},
+        {405,-0x1.1c7ea119b49cap-18,-0x1.1cc8d0b944d4ap-15},
+        {406,0x1.efff9f12e3cedp-19,-0x1.99400ee186f87p-16},
+        {407,0x1.d29174c6185f2p-18,-0x1.01c4fbe506206p-16},
+        {408,0x1.ce4bf2117f9e6p-18,-0x1.12b296fd8d4f4p-17},
+        {409,0x1.4f33c71349606p-18,-0x1.c76761091174ap-19},
+        {410,0x1.586c0b4e41706p-19,-0x1.cbc8e247d37b7p-21},
+        {378,0x1.4323169357906p-18,0x1.a330eca1420ep-19},
+        {379,0x1.c51f7882db398p-18,0x1.fbe305594b094p-18},
+        {380,0x1.dcaf68e761076p-18,0x1.df2e8fc4714dcp-17},
+        {381,0x1.2e5d61dea81c8p-18,0x1.7f6e0a7f40579p-16},
+        {382,-0x1.38ae09d94bf76p-19,0x1.0df602d23adc2p-15},
+        {383,-0x1.defecfcc7d9dp-17,0x1.5369ed45b1f94p-15},
+        {384,-0x1.07c19caf150fp-15,0x1.7c89cd1faeec8p-15},
+        {385,-0x1.bbdcc965662p-15,0x1.743091ecc1182p-15},
+        {386,-0x1.4163595c77bc2p-14,0x1.277a14a42a483p-15},
+        {387,-0x1.a1371dbb5e81bp-14,0x1.141edf38dc35p-16},
+        {388,-0x1.ed5cf48eb6919p-14,-0x1.97c0029e06d8ap-17},
+        {389,-0x1.0a7eb7dfd2bfap-13,-0x1.9d47328047c1ep-15},
+        {390,-0x1.049decfaaa16ep-13,-0x1.81784db1d0d9cp-14},
+        {391,-0x1.c012124db5679p-14,-0x1.1c76e7c64412cp-13},
+        {392,-0x1.36bab050c9334p-14,-0x1.6f43d46db0e22p-13},
+        {393,-0x1.cca318848342ap-16,-0x1.ad6da19c19f7ep-13},
+        {394,0x1.ef447a6c84e24p-16,-0x1.cc8b90dd5885cp-13},
+        {395,0x1.7fd120b4e2f37p-14,-0x1.c53a9700d4798p-13},
+        {396,0x1.3ec82630f6cc1p-13,-0x1.947d3c35e525ap-13},
+        {397,0x1.ac43d6b2d06bp-13,-0x1.3c7ecb56e685p-13},
+        {398,0x1.fb7ef24950b7ep-13,-0x1.891ed33d569d8p-14},
+        {399,0x1.11745bc8a1167p-12,-0x1.c28734a4deed1p-16},
+        {400,0x1.0ed6840375c8ap-12,0x1.673be525d25ecp-15},
+        {401,0x1.ec70a9ef1166ap-13,0x1.c522f1060f93cp-14},
+        {402,0x1.95381c92faf65p-13,0x1.54044eb5a0c9ap-13},
+        {403,0x1.227d6a599e26ep-13,0x1.a3685518785p-13},
+        {404,0x1.433bdfd907349p-14,0x1.ca925cfdf3258p-13},
+        {405,0x1.072daaebbb7a9p-16,0x1.c88fb17d4b65ep-13},
+        {406,-0x1.49cacaf784393p-15,0x1.a179e9468e7ccp-13},
+        {407,-0x1.5c02ee410ffa3p-14,0x1.5d8aa1882785ep-13},
+        {408,-0x1.d6b77ee3437f5p-14,0x1.07a055c202a0ap-13},
+        {409,-0x1.08926cdb14458p-13,0x1.56f7646bf2cbcp-14},
+        {410,-0x1.07f4d17a5c911p-13,0x1.5012a5a1d7282p-15},
+        {411,-0x1.de678e37382b1p-14,0x1.3bee3cf1c0b6bp-18},
+        {412,-0x1.8c32ca948c709p-14,-0x1.6bd31a105d6b6p-16},
+        {413,-0x1.2a2f86d5b0f71p-14,-0x1.40128c4eab3d6p-15},
+        {414,-0x1.8fc72ce0d721cp-15,-0x1.7b946a6284eb4p-15},
+        {415,-0x1.c5a8b41ae5a63p-16,-0x1.76a9f173090bp-15},
+        {416,-0x1.7269a01964a97p-17,-0x1.451d7b942983bp-15},
+        {417,-0x1.550405ebed6a4p-22,-0x1.f809dd37ed262p-16},
+        {418,0x1.6d0c59eaeafe6p-18,-0x1.5c2f4cff20a04p-16},
+        {419,0x1.e569f916e0945p-18,-0x1.a4b724069b454p-17},
+        {420,0x1.ad5dd6ca56694p-18,-0x1.a94a71c40efaep-18},
+        {421,0x1.1ea8586433a92p-18,-0x1.437e013938ca1p-19},
+        {389,0x1.3213209a1d14ep-18,0x1.73d8c47b44ddap-19},
+        {390,0x1.b78b26f4169fp-18,0x1.c93aed5f0474fp-18},
+        {391,0x1.e40b404964372p-18,0x1.b4521d5b4880ep-17},
+        {392,0x1.64a62c14a719cp-18,0x1.615295efedc14p-16},
+        {393,-0x1.8556a10f17f4cp-22,0x1.f8d244d70e2ecp-16},
+        {394,-0x1.67f85f214cb56p-17,0x1.438a0368978bcp-15},
+        {395,-0x1.b58946bfe4b74p-16,0x1.74eb5683af544p-15},
+        {396,-0x1.80982a0f42a1ap-15,0x1.7d3d6ad440376p-15},
+        {397,-0x1.1f1f9fa758dfcp-14,0x1.4a25a01167f5p-15},
+        {398,-0x1.7f22414634546p-14,0x1.9bd895adfe87ep-16},
+        {399,-0x1.d265a55d852dap-14,0x1.88cab826175e9p-22},
+        {400,-0x1.04bb979b354dap-13,-0x1.10ed72d23ca9ap-15},
+        {401,-0x1.0ad117a792482p-13,-0x1.2e24b1a4f423ep-14},
+        {402,-0x1.eb6f91e3d701p-14,-0x1.e0c7bcd5724eap-14},
+        {403,-0x1.84f78ed67b5cep-14,-0x1.4694983751714p-13},
+        {404,-0x1.c72d30e6d50e2p-15,-0x1.8eecbc091ab5bp-13},
+        {405,-0x1.0a8874388db5dp-18,-0x1.bf0aa07c55c5p-13},
+        {406,0x1.c5dc319dd1dd4p-15,-0x1.ce6e31eba4e16p-13},
+        {407,0x1.e06e8ec2c78aap-14,-0x1.b7dce879fcf31p-13},
+        {408,0x1.66fadeb9d4061p-13,-0x1.7a6063ea6154ep-13},
+        {409,0x1.c8ebf6d1f72b8p-13,-0x1.19afcf97ae86ap-13},
+        {410,0x1.0587fee37936p-12,-0x1.3bd7117b5b3f9p-14},
+        {411,0x1.12e907d35d5eap-12,-0x1.2af2b255ab6eep-17},
+        {412,0x1.0b0c1449c824dp-12,0x1.e9942ed6b02p-15},
+        {413,0x1.ddb58763c178cp-13,0x1.f6e5f5d1faff4p-14},
+        {414,0x1.83274d39d3214p-13,0x1.642f00008de04p-13},
+        {415,0x1.10a685f3fa712p-13,0x1.ab71cf706f50ap-13},
+        {416,0x1.256db4df4727cp-14,0x1.cc4e7f5b45afap-13},
+        {417,0x1.66e1f000c478ap-17,0x1.c684f09b5ff26p-13},
+        {418,-0x1.6113da79ea1fep-15,0x1.9e44b039f022p-13},
+        {419,-0x1.60220206991dp-14,0x1.5b51a5221c3abp-13},
+        {420,-0x1.d67e36f3d3ff8p-14,0x1.07b50e9956778p-13},
+        {421,-0x1.0817ea0038ffap-13,0x1.5c6c28264ea0ap-14},
+        {422,-0x1.08ac5051ed5b4p-13,0x1.636b02f984328p-15},
+        {423,-0x1.e42f9d40233b9p-14,0x1.f5887c530b2fap-18},
+        {424,-0x1.96ce0b90f4a9p-14,-0x1.40b47bed000e8p-16},
+        {425,-0x1.38b0ea084f9fp-14,-0x1.310f0433783a3p-15},
+        {426,-0x1.b0ba626e913a7p-15,-0x1.7643e6a6229e8p-15},
+        {427,-0x1.0307141e9b82ep-15,-0x1.7bdcab61f8402p-15},
+        {428,-0x1.defdedcd232a8p-17,-0x1.535a197a4db5ep-15},
+        {429,-0x1.5d0605767f513p-19,-0x1.10218357ab3d2p-15},
+        {430,0x1.1c5751ddd90ep-18,-0x1.884e25e42adacp-16},
+        {431,0x1.d6c4ae1bcd7f4p-18,-0x1.f5f193ab76f35p-17},
+        {432,0x1.cf0965589b427p-18,-0x1.1421fa0697333p-17},
+        {433,0x1.596e220ca07a6p-18,-0x1.e6c9bf91ca8dep-19},
+        {434,0x1.7f9911cf77447p-19,-0x1.1c078aff972d8p-20},
+        {400,0x1.797d314e8be8ap-19,0x1.1279011a1e996p-20},
+        {401,0x1.51ffa96b3b2dcp-18,0x1.cebd9ff756665p-19},
+        {402,0x1.c88fca8102762p-18,0x1.04d38c834daf8p-17},
+        {403,0x1.ddf8337c5e974p-18,0x1.d98a226a25d1ap-17},
+        {404,0x1.457940fc8216cp-18,0x1.732a853037631p-16},
+        {405,-0x1.28de0f22122fp-20,0x1.034b3533b58bcp-15},
+        {406,-0x1.82f0d2ca9129cp-17,0x1.475880e345276p-15},
+        {407,-0x1.bf1386f08c5ecp-16,0x1.75d7b0423ab96p-15},
+        {408,-0x1.80fc833f7bcb6p-15,0x1.7d178cba22e1ap-15},
+        {409,-0x1.1c6e49bc01271p-14,0x1.4c585036d15a8p-15},
+        {410,-0x1.79d107cbf875ap-14,0x1.adf151aa462a2p-16},
+        {411,-0x1.cc01f72b78f3ep-14,0x1.78dd10f34d6aap-19},
+        {412,-0x1.02749224b9ac4p-13,-0x1.db5bb9e90def4p-16},
+        {413,-0x1.0b735213bc0c7p-13,-0x1.14cfb542c4ba9p-14},
+        {414,-0x1.f6f8c785c4df8p-14,-0x1.c152f1960720ap-14},
+        {415,-0x1.9ec6debef09dap-14,-0x1.35ac34de8bf65p-13},
+        {416,-0x1.0e35e2c213355p-14,-0x1.7fbb89bdd9e9ap-13},
+        {417,-0x1.30dfb0cf97facp-16,-0x1.b52823c2b7b56p-13},
+        {418,0x1.32bbcf4cb61dp-15,-0x1.cd9cc5632ac38p-13},
+        {419,0x1.8f0591e343958p-14,-0x1.c35ef7cbe4a0ap-13},
+        {420,0x1.3ed2dd03a949dp-13,-0x1.9447d4428466ap-13},
+        {421,0x1.a6aaec2079cecp-13,-0x1.4249ef9fbdef6p-13},
+        {422,0x1.f432ad8992308p-13,-0x1.a6d3eff588352p-14},
+        {423,0x1.0f8cd8f36fc26p-12,-0x1.449511501601cp-15},
+        {424,0x1.115a25a7f407bp-12,0x1.c539cf2ca27e7p-16},
+        {425,0x1.fe9d7e7597626p-13,0x1.7a6112e235ce8p-14},
+        {426,0x1.b6c4be7ec5718p-13,0x1.305226a4967e8p-13},
+        {427,0x1.52e54dbfbdf25p-13,0x1.880a124dd978ap-13},
+        {428,0x1.baf9298370d21p-14,0x1.bda51f2010be1p-13},
+        {429,0x1.89a237cc5f1d4p-15,0x1.ce713f5b0e63bp-13},
+        {430,-0x1.29bd53847c9e7p-17,0x1.bbdf628cc515cp-13},
+        {431,-0x1.dd92ebff52198p-15,0x1.8b157b1eeae7bp-13},
+        {432,-0x1.88ec4d61b4248p-14,0x1.440781ee96f66p-13},
+        {433,-0x1.eb6790aae4d21p-14,0x1.e07ff914fda39p-14},
+        {434,-0x1.0a8dc23cd3396p-13,0x1.33159befb790cp-14},
+        {435,-0x1.05add73e768p-13,0x1.22da098dad96p-15},
+        {436,-0x1.d87843be61e15p-14,0x1.2641ae559fe22p-19},
+        {437,-0x1.89c20041e730cp-14,-0x1.744b75fcb2a29p-16},
+        {438,-0x1.2d62329783f04p-14,-0x1.3ca2dbddd23f8p-15},
+        {439,-0x1.a0be2b7a98116p-15,-0x1.78ea639195d4ep-15},
+        {440,-0x1.f45107f332185p-16,-0x1.7a8a395d39cc6p-15},
+        {441,-0x1.d260be7e38643p-17,-0x1.51c25a061cf2ep-15},
+        {442,-0x1.60e779585faf6p-19,-0x1.10510907f61e2p-15},
+        {443,0x1.11f58596126a2p-18,-0x1.8d328cf8808dcp-16},
+        {444,0x1.d1b24992a52d7p-18,-0x1.0315e17eef639p-16},
+        {445,0x1.d5afba387737bp-18,-0x1.260fa7df114cap-17},
+        {446,0x1.6b31e7c81748ep-18,-0x1.116eabae3eb3dp-18},
+        {447,0x1.aea62ac80c4f3p-19,-0x1.65d2e6a621a3p-20},
+        {413,0x1.0674c869d84c6p-18,0x1.0bcff9c518c7cp-19},
+        {414,0x1.900f147a1751ep-18,0x1.5bd53ad2d9c3p-18},
+        {415,0x1.e2125d61d1c07p-18,0x1.57faf22fd404p-17},
+        {416,0x1.ba764fe8a3174p-18,0x1.1f7bc98b23c4ep-16},
+        {417,0x1.a5902cf82c8b2p-19,0x1.a8d5b63d9590ep-16},
+        {418,-0x1.12a11ae875631p-18,0x1.1b83c945e0e55p-15},
+        {419,-0x1.06e203d67b45bp-16,0x1.58994a3724f26p-15},
+        {420,-0x1.08eb3fc07ecb4p-15,0x1.7c6a50363fc92p-15},
+        {421,-0x1.ac8a9b6184c1ap-15,0x1.76cb1dd5902f2p-15},
+        {422,-0x1.30afcdaf8bc56p-14,0x1.3924d89d4f8ccp-15},
+        {423,-0x1.8a1dd1d0c1e13p-14,0x1.726d051dfa89ap-16},
+        {424,-0x1.d6a58c973eedap-14,-0x1.8b21a221dfd26p-20},
+        {425,-0x1.04ae7bd40dc56p-13,-0x1.121030ac9804cp-15},
+        {426,-0x1.0b064f4696923p-13,-0x1.246494cdb0aeap-14},
+        {427,-0x1.f3092daf3281p-14,-0x1.cc19adb7c95d3p-14},
+        {428,-0x1.9aecf420df003p-14,-0x1.3831726c8c84ap-13},
+        {429,-0x1.0de87bd6beab7p-14,-0x1.7fbfb3a06b12ap-13},
+        {430,-0x1.49ae4cf00859p-16,-0x1.b3e4d32926ff8p-13},
+        {431,0x1.160495c2e717p-15,-0x1.cd004b99d11e5p-13},
+        {432,0x1.78c55647a3658p-14,-0x1.c5b7a75ed5a7ap-13},
+        {433,0x1.30fb0ff9f5bb8p-13,-0x1.9bcfaeda872a7p-13},
+        {434,0x1.985c9658ad10cp-13,-0x1.50a7cbfafda0fp-13},
+        {435,0x1.e86b4eabdb7cfp-13,-0x1.d28231aa4a6cap-14},
+        {436,0x1.0c8d843691b7ep-12,-0x1.b72d292c63f3bp-15},
+        {437,0x1.12b909ec59c9fp-12,0x1.73c27316f394ap-17},
+        {438,0x1.0615a6d84f6e6p-12,0x1.34770db104e55p-14},
+        {439,0x1.cfdfb77856e05p-13,0x1.0fd59df1580d6p-13},
+        {440,0x1.76b17d640b33cp-13,0x1.6e3a126b18a5ep-13},
+        {441,0x1.0984e7ffa3136p-13,0x1.ae3f2693ae9efp-13},
+        {442,0x1.25c89cad1f67cp-14,0x1.cc1f08e8c7125p-13},
+        {443,0x1.db8042d6374c6p-17,0x1.c7c11032c304ap-13},
+        {444,-0x1.2ffd8eb3c1d8p-15,0x1.a488caf6bd9fap-13},
+        {445,-0x1.4480236684934p-14,0x1.68b6cd625392dp-13},
+        {446,-0x1.bf96be424d061p-14,0x1.1c76bcdfb1b1ep-13},
+        {447,-0x1.0281d938b1bbap-13,0x1.91819e9b47eb9p-14},
+        {448,-0x1.0b5171d00ad6p-13,0x1.d8e51169d225ep-15},
+        {449,-0x1.fb81edceb83f7p-14,0x1.61af0dfbbcdacp-16},
+        {450,-0x1.be6352ed568b6p-14,-0x1.fee2051cb2a68p-18},
+        {451,-0x1.6bf17707eaf6p-14,-0x1.dadd45de5b999p-16},
+        {452,-0x1.10eaf07f82158p-14,-0x1.559d3cba2847bp-15},
+        {453,-0x1.71172d90852a2p-15,-0x1.7e6868ee5978dp-15},
+        {454,-0x1.ad95e29e8ff58p-16,-0x1.73e1326756ffep-15},
+        {455,-0x1.762ffbb6d8b72p-17,-0x1.457971cc59838p-15},
+        {456,-0x1.2a995b19f3ab6p-20,-0x1.034dba47a274p-15},
+        {457,0x1.3d04681aefd7fp-18,-0x1.77a4f7a74e4f4p-16},
+        {458,0x1.da65d7d2296a4p-18,-0x1.e8bf0d029eadp-17},
+        {459,0x1.cfdc1426e0422p-18,-0x1.15c017846bc84p-17},
+        {460,0x1.63a7d6cb3bffp-18,-0x1.03f17b1f34bd6p-18},
+        {461,0x1.a7b5107f47ebdp-19,-0x1.599d560ebcb7ep-20},
+        {423,0x1.682e0833c1c41p-19,0x1.f17fb2ac6a735p-21},
+        {424,0x1.413adb7912245p-18,0x1.9c0846a1e798cp-19},
+        {425,0x1.b921235045cd2p-18,0x1.cd8f51b6342acp-18},
+        {426,0x1.e5a812cc5f716p-18,0x1.a33b25b73531ep-17},
+        {427,0x1.86e18046d47fp-18,0x1.4acd3b5c92faap-16},
+        {428,0x1.7301cf4a64bfbp-20,0x1.d45cca221508fp-16},
+        {429,-0x1.cc786539ab878p-18,0x1.2e0e7618b993ap-15},
+        {430,-0x1.43b3d8ca828edp-16,0x1.649ab127efc4cp-15},
+        {431,-0x1.2bcfcdfcaa33ap-15,0x1.7f42da15c9212p-15},
+        {432,-0x1.d0342aa297a03p-15,0x1.6f291bd8a8422p-15},
+        {433,-0x1.40dd22db0436ep-14,0x1.276bb34a677f3p-15},
+        {434,-0x1.96d284117c2e4p-14,0x1.3f24ff7d93d4ap-16},
+        {435,-0x1.deafd8f02b81cp-14,-0x1.52043a025a298p-18},
+        {436,-0x1.063ce5fcf0de8p-13,-0x1.2fc1e2a10cacap-15},
+        {437,-0x1.0a85c0f5236fep-13,-0x1.30f20ead4bd24p-14},
+        {438,-0x1.efb8315371d0dp-14,-0x1.d4b73023be25cp-14},
+        {439,-0x1.97cacd29df305p-14,-0x1.3a33f1bf39b1ep-13},
+        {440,-0x1.0da6fd75739a2p-14,-0x1.7fc335bee2eep-13},
+        {441,-0x1.5d5eec7883d7ap-16,-0x1.b2dd6be2e3122p-13},
+        {442,0x1.fe5836a8f8c44p-16,-0x1.cc6b8d66dfa3ap-13},
+        {443,0x1.66f5d57195e6p-14,-0x1.c75f18cfc095p-13},
+        {444,0x1.25c42442a21dcp-13,-0x1.a17416ded6823p-13},
+        {445,0x1.8c82f439b28acp-13,-0x1.5ba3c439a502bp-13},
+        {446,0x1.de332ee88dd5ap-13,-0x1.f468603ef229cp-14},
+        {447,0x1.0985fd88ac6b7p-12,-0x1.08bd42b4c64bep-14},
+        {448,0x1.12f6a648dfd6ap-12,-0x1.cab86b25a7d9ep-20},
+        {449,0x1.0a7f34337c88cp-12,0x1.f6001edd5900bp-15},
+        {450,0x1.e1e761d7949fap-13,0x1.e863fc6173ad4p-14},
+        {451,0x1.919d85c5532d7p-13,0x1.56f5e46725061p-13},
+        {452,0x1.2bc9ebc9d4deep-13,0x1.9e6da36f54eaap-13},
+        {453,0x1.73bf15148b00fp-14,0x1.c626820fb7147p-13},
+        {454,0x1.180429f39313p-15,0x1.ccf866c77a539p-13},
+        {455,-0x1.311bc3fd3a968p-16,0x1.b4fbf6dfedf0bp-13},
+        {456,-0x1.04b8a995e5508p-14,0x1.831cf48a629f2p-13},
+        {457,-0x1.917dbac2f7dfp-14,0x1.3e5be084462d4p-13},
+        {458,-0x1.ec3b2f35dae0cp-14,0x1.ddb876677d922p-14},
+        {459,-0x1.0a2019717fe92p-13,0x1.39c4acb09f1aap-14},
+        {460,-0x1.070054a2bd633p-13,0x1.3f8f4c1a031bfp-15},
+        {461,-0x1.e1fb04a469027p-14,0x1.b91c6c24a1494p-18},
+        {462,-0x1.9b3c437be248ep-14,-0x1.2c65f3ac2e904p-16},
+        {463,-0x1.45be99fa35faap-14,-0x1.21af444aebed8p-15},
+        {464,-0x1.d9be4ad658232p-15,-0x1.6cc54046e53e4p-15},
+        {465,-0x1.343b9afefb7ffp-15,-0x1.7f9de5c41307ap-15},
+        {466,-0x1.51293f9f4f52cp-16,-0x1.66ed0aa169d44p-15},
+        {467,-0x1.f2d7d7470d78ep-18,-0x1.31848f0d0b26cp-15},
+        {468,0x1.15a3b7f20920fp-20,-0x1.dc0ceb58731f6p-16},
+        {469,0x1.7c5b587f06bfep-18,-0x1.520ce735df93cp-16},
+        {470,0x1.e4ac746f9fc86p-18,-0x1.af3ed5c651726p-17},
+        {471,0x1.be1380302aad6p-18,-0x1.df15610fa65c8p-18},
+        {472,0x1.48c87f0c2f27cp-18,-0x1.b1eb3182978d6p-19},
+        {473,0x1.774e726fcc436p-19,-0x1.0e3228369575ap-20},
+        {437,0x1.68d21b347b0b6p-19,0x1.f1f9e25bacdbp-21},
+        {438,0x1.3cf2c80a256c6p-18,0x1.8f7d10ee65d78p-19},
+        {439,0x1.b31ba86898411p-18,0x1.b9465d5baae3cp-18},
+        {440,0x1.e66e9735f9c08p-18,0x1.8e3eaa2e5c424p-17},
+        {441,0x1.9d636846dbdc2p-18,0x1.39c8dc1c48e02p-16},
+        {442,0x1.3ab3022be1f21p-19,0x1.bd8106eba375cp-16},
+        {443,-0x1.4b0afc38a09a3p-18,0x1.2164ea4797659p-15},
+        {444,-0x1.0e1f46f1e0a28p-16,0x1.5a095d912b2d5p-15},
+        {445,-0x1.050c8db09e88ap-15,0x1.7bc2f655aec28p-15},
+        {446,-0x1.9e1deec0ec4afp-15,0x1.78f8c38789eddp-15},
+        {447,-0x1.23da92d85f356p-14,0x1.454328e364c6ep-15},
+        {448,-0x1.791e5bf81af48p-14,0x1.aef7872dd3fap-16},
+        {449,-0x1.c51988df7535p-14,0x1.5d9ae66a2826p-18},
+        {450,-0x1.fd03415cd1538p-14,-0x1.7684df02599aep-16},
+        {451,-0x1.0b21ba4b031dap-13,-0x1.d2f7b95e9dd3ap-15},
+        {452,-0x1.03e95eb42e72cp-13,-0x1.84bbfc26b8466p-14},
+        {453,-0x1.cb93c8ab3dd1dp-14,-0x1.11981954513ddp-13},
+        {454,-0x1.5f75147f4806dp-14,-0x1.5b3ca7f8d2f32p-13},
+        {455,-0x1.8c5aed727d962p-15,-0x1.97bc6bee5c2fp-13},
+        {456,-0x1.dc24f8f358e58p-20,-0x1.bffe18979045p-13},
+        {457,0x1.a0edc852bab01p-15,-0x1.ce382a6b9cb9p-13},
+        {458,0x1.b1a4fa2da24f3p-14,-0x1.beb28bae7e848p-13},
+        {459,0x1.450d620f85f43p-13,-0x1.90553b46a5cep-13},
+        {460,0x1.a3c97ed5d95bcp-13,-0x1.44eec6f6b38aep-13},
+        {461,0x1.ecba7f4964254p-13,-0x1.c24c98b428b3bp-14},
+        {462,0x1.0caa01d461498p-12,-0x1.b05e9a6a93885p-15},
+        {463,0x1.12c2d43f3405fp-12,0x1.15c1d1618f83bp-17},
+        {464,0x1.08188b1d84284p-12,0x1.1aeb40d2d74cdp-14},
+        {465,0x1.db4aaa43c08a4p-13,0x1.fd32d97dc96a4p-14},
+        {466,0x1.8ba070460e5b2p-13,0x1.5c4dbf4d366cp-13},
+        {467,0x1.284ee65390d3ep-13,0x1.a014c0d7bf3c1p-13},
+        {468,0x1.73eb6a92191ap-14,0x1.c608e9ff9ad02p-13},
+        {469,0x1.271a639f962e4p-15,0x1.cd29cdef64c26p-13},
+        {470,-0x1.f72f940e3c15ep-17,0x1.b7524a7027c8bp-13},
+        {471,-0x1.e8cb56056de58p-15,0x1.88dc979555104p-13},
+        {472,-0x1.81d6bb2f72f1cp-14,0x1.480337a741a0ep-13},
+        {473,-0x1.e0e07ff61ffaap-14,0x1.f82bbba0b3ffep-14},
+        {474,-0x1.0813d76adfb2p-13,0x1.593be6c6e4b43p-14},
+        {475,-0x1.0978f59c881ccp-13,0x1.823bb0c9dfc4ap-15},
+        {476,-0x1.f0496b704ceb8p-14,0x1.d9b35d7549972p-17},
+        {477,-0x1.b1c71f8fadc1ap-14,-0x1.84012df9326bep-17},
+        {478,-0x1.6232a47e53df8p-14,-0x1.f77995e6a8938p-16},
+        {479,-0x1.0c28df7017b7cp-14,-0x1.58ee6d77627a2p-15},
+        {480,-0x1.71e957ee205f5p-15,-0x1.7e204145fdb32p-15},
+        {481,-0x1.bee7815138197p-16,-0x1.7591eac39dd1fp-15},
+        {482,-0x1.a8214cad657ap-17,-0x1.4c329b1d3f78ap-15},
+        {483,-0x1.576c9254dad9p-19,-0x1.0f9798a7d938ap-15},
+        {484,0x1.f1ec2450ccdd8p-19,-0x1.986a899d539cep-16},
+        {485,0x1.c1419b5cd241cp-18,-0x1.181e1c3df06cap-16},
+        {486,0x1.e2325e974f57ep-18,-0x1.57ea0e7bcddedp-17},
+        {487,0x1.970f8d67104afp-18,-0x1.6bc10cb2fb283p-18},
+        {488,0x1.178f1b7c12e78p-18,-0x1.30d9b56bf1604p-19},
+        {449,0x1.87348431d9b2ep-19,0x1.2472228265eccp-20},
+        {450,0x1.4871beb0238bbp-18,0x1.afee54471975ap-19},
+        {451,0x1.b886b4707b6e7p-18,0x1.cab64f7606b1ap-18},
+        {452,0x1.e663cb658b92ep-18,0x1.949814453771fp-17},
+        {453,0x1.9cbefd5a39fb7p-18,0x1.3a43135eed828p-16},
+        {454,0x1.4b1d852e44298p-19,0x1.ba5be852dd763p-16},
+        {455,-0x1.2cdf1ae5f8d9cp-18,0x1.1e2e76bc957d2p-15},
+        {456,-0x1.faf77682f0468p-17,0x1.564883ef36061p-15},
+        {457,-0x1.ed56a2e5f7a9ap-16,0x1.79a870c6778c7p-15},
+        {458,-0x1.8901a27f75e57p-15,0x1.7bbffec8f16a6p-15},
+        {459,-0x1.164ba766de43cp-14,0x1.50e2fe143b3f3p-15},
+        {460,-0x1.69d591d7a37a4p-14,0x1.e02690d347c56p-16},
+        {461,-0x1.b660c82535b9ap-14,0x1.52fe035331486p-17},
+        {462,-0x1.f215007d98a5ep-14,-0x1.ff37dc190b756p-17},
+        {463,-0x1.09832335fc70ep-13,-0x1.858ecb0e9bce7p-15},
+        {464,-0x1.083230be06086p-13,-0x1.56d05e02d280ep-14},
+        {465,-0x1.e3ae6f4693b05p-14,-0x1.f180988cfd58p-14},
+        {466,-0x1.89c21f60af196p-14,-0x1.4308dda9aa573p-13},
+        {467,-0x1.039f53214f584p-14,-0x1.83509a2d5470ep-13},
+        {468,-0x1.5affbebe05b8cp-16,-0x1.b2cc8281e596cp-13},
+        {469,0x1.cc40d60b85dcp-16,-0x1.cb97ef71acd0ep-13},
+        {470,0x1.4c5fb9333298ap-14,-0x1.c969044e56904p-13},
+        {471,0x1.129dcb0472bc4p-13,-0x1.aa225de8fcac5p-13},
+        {472,0x1.7656c48148246p-13,-0x1.6e2e23ebd1dep-13},
+        {473,0x1.c935693f9edc2p-13,-0x1.1894c95f4b562p-13},
+        {474,0x1.022058577219ep-12,-0x1.5d940a9323e5dp-14},
+        {475,0x1.113405962ec8cp-12,-0x1.c19e2df2abeabp-16},
+        {476,0x1.10870fd5e11e4p-12,0x1.0a20b45c7b9cbp-15},
+        {477,0x1.002883238d854p-12,0x1.70b775f4e2a0ep-14},
+        {478,0x1.c30706c753e9ep-13,0x1.20b43448e39f8p-13},
+        {479,0x1.6e7042e342ac8p-13,0x1.744fa1db57b07p-13},
+        {480,0x1.09a70664ddf99p-13,0x1.adeaf864d0ac8p-13},
+        {481,0x1.39c0e9e39e55p-14,0x1.cab5971b7c6aep-13},
+        {482,0x1.84a70a24f8486p-16,0x1.ca7e1351ca686p-13},
+        {483,-0x1.9ab3b0b6c8a04p-16,0x1.af95588fb95b2p-13},
+        {484,-0x1.10970354dd4a3p-14,0x1.7e6e54ecffa38p-13},
+        {485,-0x1.93217852f2c1ep-14,0x1.3d088254fe5cap-13},
+        {486,-0x1.e933c3d667298p-14,0x1.e4731975574ep-14},
+        {487,-0x1.09165c2ef2b7ap-13,0x1.49dabe495d88p-14},
+        {488,-0x1.08c04a68f6368p-13,0x1.6dcee59d8f823p-15},
+        {489,-0x1.eded9b67d650cp-14,0x1.aef4105a685c3p-17},
+        {490,-0x1.b0682d2a08404p-14,-0x1.90b9fb11a4dcap-17},
+        {491,-0x1.62e5fe8419b3fp-14,-0x1.f506fa86c1304p-16},
+        {492,-0x1.0f30cfc9273b8p-14,-0x1.5681a9f3c8428p-15},
+        {493,-0x1.7bc8e132cfb8dp-15,-0x1.7d2a194fb21ep-15},
+        {494,-0x1.d6caff73df008p-16,-0x1.77c6fbb5b649ap-15},
+        {495,-0x1.d7e38b30414dcp-17,-0x1.5229305016188p-15},
+        {496,-0x1.f812255d8314ap-19,-0x1.18de194185718p-15},
+        {497,0x1.84e2878a26941p-19,-0x1.af32be262431fp-16},
+        {498,0x1.a8fadf8384c57p-18,-0x1.2fffdeb33530ep-16},
+        {499,0x1.e65cdbd37c4c6p-18,-0x1.83b9293a324fp-17},
+        {500,0x1.b0e5282be299bp-18,-0x1.b1fb9cc5c3bc6p-18},
+        {501,0x1.3d717ee2a5b4ap-18,-0x1.906d35de95bb4p-19},
+        {502,0x1.711eae5e1a678p-19,-0x1.0416b097b361ep-20},
+        {462,0x1.fb54cff703b9ap-19,0x1.f027acb1bd2fdp-20},
+        {463,0x1.7b0a5ecb42961p-18,0x1.2deae859207cdp-18},
+        {464,0x1.d4936ace2779fp-18,0x1.21843d7c3f2f5p-17},
+        {465,0x1.dcfcb8c9d8dcap-18,0x1.de54a5ff350eap-17},
+        {466,0x1.621a739345ca2p-18,0x1.62869b7fd4a42p-16},
+        {467,0x1.9e177166ac6fap-21,0x1.e16c1589626a6p-16},
+        {468,-0x1.d3e397008c1e9p-18,0x1.2e8e08c53c755p-15},
+        {469,-0x1.31edf3d4bf2ffp-16,0x1.611f2498d7cbcp-15},
+        {470,-0x1.13fb5f84f26a6p-15,0x1.7d3af42c3862cp-15},
+        {471,-0x1.a6859005f6e57p-15,0x1.775e19bd2f21p-15},
+        {472,-0x1.23a34cfab0918p-14,0x1.4525414ffe12p-15},
+        {473,-0x1.7475a3d859deep-14,0x1.bdc05d2ba5706p-16},
+        {474,-0x1.bd7b84086c4f4p-14,0x1.043d470d2bf4cp-17},
+        {475,-0x1.f59544db6a844p-14,-0x1.24d6378f78ff6p-16},
+        {476,-0x1.09d639e4e9f82p-13,-0x1.93994cfae3a7ap-15},
+        {477,-0x1.07def7a0bfe1ap-13,-0x1.5a3338ec85306p-14},
+        {478,-0x1.e3e50b63531b5p-14,-0x1.f0a72223062b8p-14},
+        {479,-0x1.8d4635a053fb6p-14,-0x1.40b154d99aab1p-13},
+        {480,-0x1.0cb8d58d3b987p-14,-0x1.7fcfda659a126p-13},
+        {481,-0x1.9c57a61b5d958p-16,-0x1.af68b3c11fc41p-13},
+        {482,0x1.6b95c4affd5f4p-16,-0x1.c9f9682ad2b5ep-13},
+        {483,0x1.2d25d665a5e67p-14,-0x1.cb622ba08ecafp-13},
+        {484,0x1.009b2c1a22d86p-13,-0x1.b168c444cf269p-13},
+        {485,0x1.63c2b671462d2p-13,-0x1.7c0ed7e4792dep-13},
+        {486,0x1.b86c3e72a6dd6p-13,-0x1.2daf8f362f91bp-13},
+        {487,0x1.f7e2c41c34664p-13,-0x1.95bdd0b23bcfep-14},
+        {488,0x1.0e82150f21b0ap-12,-0x1.6831a4d856876p-15},
+        {489,0x1.1262f8673b146p-12,0x1.d0dce0854f1p-17},
+        {490,0x1.07424e1e120bp-12,0x1.24407d498bdc6p-14},
+        {491,0x1.dc1471d4b3984p-13,0x1.fa178ee083662p-14},
+        {492,0x1.9191949ab9ef4p-13,0x1.56a2076b409b9p-13},
+        {493,0x1.34f52319d1296p-13,0x1.994b371076fcfp-13},
+        {494,0x1.9af7b650cac92p-14,0x1.c17f91f83c5e4p-13},
+        {495,0x1.8bc029b6afeb8p-15,0x1.ce07e236718e4p-13},
+        {496,-0x1.8a38e737d6eecp-20,0x1.bfffa95f4a86ep-13},
+        {497,-0x1.7763fecdeff97p-15,0x1.9a9ad5bb62081p-13},
+        {498,-0x1.502e263a8b686p-14,0x1.62b7f3d75aa67p-13},
+        {499,-0x1.bcb92d1c5e28cp-14,0x1.1e4d78bca8278p-13},
+        {500,-0x1.fe6f6dc27f0a8p-14,0x1.a788cde84ad44p-14},
+        {501,-0x1.0b2ab26d6a1aap-13,0x1.12a7944980268p-14},
+        {502,-0x1.046cfd3b0852ap-13,0x1.11bd0f3a92d3ap-15},
+        {503,-0x1.dd09691c4a2a2p-14,0x1.2aedd2a308e6ep-18},
+        {504,-0x1.9b8e9a09e46c2p-14,-0x1.2951d734e662dp-16},
+        {505,-0x1.4da468f4bb286p-14,-0x1.176100595b5a6p-15},
+        {506,-0x1.f82ec15598e4cp-15,-0x1.63a496b140a42p-15},
+        {507,-0x1.5ce71a16fad74p-15,-0x1.7f284f06c7b53p-15},
+        {508,-0x1.a9c7a1b1d38f2p-16,-0x1.731e4cab0eca8p-15},
+        {509,-0x1.9d781d31ed8f8p-17,-0x1.4aa7603bc85e4p-15},
+        {510,-0x1.7549711eb30d2p-19,-0x1.11489f378a38ep-15},
+        {511,0x1.bf7b06f0670cap-19,-0x1.a329a629445dap-16},
+        {512,0x1.b15b8a9a7b518p-18,-0x1.28597f983c861p-16},
+        {513,0x1.e627bb214b5d4p-18,-0x1.7ca5dfd682b84p-17},
+        {514,0x1.b03dfd2ec9b84p-18,-0x1.af9aa2477028ep-18},
+        {515,0x1.4028bbc9a19f6p-18,-0x1.9791d7cc4915ep-19},
+        {516,0x1.7de2a13f9fdb5p-19,-0x1.15f0c5f77c99fp-20},
+        {475,0x1.b30f32c0f6f93p-19,0x1.69451602c9e68p-20},
+        {476,0x1.567dfb0efec9bp-18,0x1.d9e5d4d739c56p-19},
+        {477,0x1.bd2c11b958955p-18,0x1.da2837e614aeep-18},
+        {478,0x1.e680f298f81c8p-18,0x1.93cbf675d8d9fp-17},
+        {479,0x1.a55ede9461a8p-18,0x1.330b86cdf2447p-16},
+        {480,0x1.97fd42a4af11cp-19,0x1.ab374b6a7a44ep-16},
+        {481,-0x1.9a77111bac092p-19,0x1.136b9bbcc273cp-15},
+        {482,-0x1.a01d7aa478bf5p-17,0x1.4aefb2e1e71e8p-15},
+        {483,-0x1.a4803f5a96ab2p-16,0x1.726b6a2da2e3fp-15},
+        {484,-0x1.5599c9da44595p-15,0x1.7f4b40f8854a9p-15},
+        {485,-0x1.eb979b4b85b59p-15,0x1.674d7688f16eep-15},
+        {486,-0x1.44fa5f7098b0ap-14,0x1.21d76157ad98cp-15},
+        {487,-0x1.918d901c2a783p-14,0x1.52a18ce2def06p-16},
+        {488,-0x1.d38b31bc5ef1ep-14,-0x1.d38cbc8fef43ep-22},
+        {489,-0x1.013d33c6955b8p-13,-0x1.c2ae74c932a29p-16},
+        {490,-0x1.0b1dff3f0998p-13,-0x1.e683f75cc614p-15},
+        {491,-0x1.03fa6e68f1676p-13,-0x1.824d55928647ep-14},
+        {492,-0x1.d2f04f3dc4cfap-14,-0x1.0a1f2e7060366p-13},
+        {493,-0x1.755e9c171bb7ep-14,-0x1.4ef880d4f04acp-13},
+        {494,-0x1.e1acb6e7335dcp-15,-0x1.89cddb6cf8776p-13},
+        {495,-0x1.2a123e06771e1p-16,-0x1.b4f33fd68d1e4p-13},
+        {496,0x1.d400a8f54cb8dp-16,-0x1.cb86957a88776p-13},
+        {497,0x1.4242a6bf4093dp-14,-0x1.c9f67e87c1c88p-13},
+        {498,0x1.07e7668a2e494p-13,-0x1.ae6f5477fb154p-13},
+        {499,0x1.67a8e0b87fcd6p-13,-0x1.7920f8df7797p-13},
+        {500,0x1.b96f1fb6b6372p-13,-0x1.2c541aefd928p-13},
+        {501,0x1.f719ca11f81c7p-13,-0x1.9895979c8071dp-14},
+        {502,0x1.0df915a83eb83p-12,-0x1.7bb873c763552p-15},
+        {503,0x1.128f336cce3bcp-12,0x1.4afabe9407f65p-17},
+        {504,0x1.08f3e7f71741ep-12,0x1.0ddf7302ff56p-14},
+        {505,0x1.e3cc97731228ap-13,0x1.e0a3f1b2396bap-14},
+        {506,0x1.9e5ad77a49eb6p-13,0x1.4a1d33ae7fc14p-13},
+        {507,0x1.46d9198214dc8p-13,0x1.8ef26ff7aa982p-13},
+        {508,0x1.c78c107b4704cp-14,0x1.bb3c7e6f50788p-13},
+        {509,0x1.f0f5896970602p-15,0x1.cd70cdec04af2p-13},
+        {510,0x1.752f2d3912688p-17,0x1.c61bfb9c5335cp-13},
+        {511,-0x1.122c00a7c71e8p-15,0x1.a7ba84454536bp-13},
+        {512,-0x1.24337f707e1d2p-14,0x1.7663b470f9b79p-13},
+        {513,-0x1.9b479c2bd4f5ep-14,0x1.3751cb65d001cp-13},
+        {514,-0x1.ea6bddd1b4078p-14,0x1.e0ab4c92fa6f2p-14},
+        {515,-0x1.08a4ac8d2855cp-13,0x1.4e8bb1cf3f8f8p-14},
+        {516,-0x1.0964ef17a4306p-13,0x1.85e2e5491a624p-15},
+        {517,-0x1.f47e32aa96be2p-14,0x1.1ab5a3d598c6ep-16},
+        {518,-0x1.bdcfadb2bc34cp-14,-0x1.fe2c1a64ba536p-18},
+        {519,-0x1.7717dc6789eep-14,-0x1.b476c5d52ad5ep-16},
+        {520,-0x1.28b9ac03e002ap-14,-0x1.40315379b4a32p-15},
+        {521,-0x1.b4aa23152f91p-15,-0x1.74a739fbb4c94p-15},
+        {522,-0x1.24519d39d23cp-15,-0x1.7e6dc431c8ae4p-15},
+        {523,-0x1.52baa046ed15p-16,-0x1.66de859ef3abcp-15},
+        {524,-0x1.23b1bede5ee39p-17,-0x1.387ddf3e40368p-15},
+        {525,-0x1.1d4b3128ef98ep-21,-0x1.fb6314661375ap-16},
+        {526,0x1.2d7975d7088b2p-18,-0x1.7f5e70b9e1e09p-16},
+        {527,0x1.cbaccaafc5286p-18,-0x1.0b7739992a09p-16},
+        {528,0x1.e19699231ab71p-18,-0x1.53147fde77c4ap-17},
+        {529,0x1.9d7a7b5856f1bp-18,-0x1.7ac39da8df035p-18},
+        {530,0x1.2ad5bf03c32bcp-18,-0x1.5e1eb57ebcceep-19},
+        {531,0x1.5b3fb9a5fc4cep-19,-0x1.c99230d80a1c7p-21},
+        {489,0x1.a3742ee49a15ap-19,0x1.4ea8660911e2ep-20},
+        {490,0x1.4b5eff6144675p-18,0x1.b71529d02dc2cp-19},
+        {491,0x1.b319a4e544c82p-18,0x1.b7b9229da2219p-18},
+        {492,0x1.e5fc74391a468p-18,0x1.775312eb2d223p-17},
+        {493,0x1.bb39d92c16f93p-18,0x1.1e87395461fd2p-16},
+        {494,0x1.08954d997b4dcp-18,0x1.9111003789d4p-16},
+        {495,-0x1.5f85e5d84bfcdp-20,0x1.04c6427d86d24p-15},
+        {496,-0x1.40ae8b1771533p-17,0x1.3d1330e73b3d3p-15},
+        {497,-0x1.5f7c04f285b3ep-16,0x1.68dad8ccc1df5p-15},
+        {498,-0x1.28235e08aac28p-15,0x1.7e8c4617410fep-15},
+        {499,-0x1.b48575fde6d22p-15,0x1.748a772771ef4p-15},
+        {500,-0x1.2653129cb9bc8p-14,0x1.424a7e832c42dp-15},
+        {501,-0x1.72907590c3713p-14,0x1.c3043161a191cp-16},
+        {502,-0x1.b80acbb20fa7ap-14,0x1.3d0ee05419506p-17},
+        {503,-0x1.ef1ac486bdbbap-14,-0x1.cc730ccd32de6p-17},
+        {504,-0x1.0807ff458f7d8p-13,-0x1.5f7eadada7d71p-15},
+        {505,-0x1.09fb8dcf41312p-13,-0x1.356e9d7ac4398p-14},
+        {506,-0x1.f563c06068702p-14,-0x1.c2ddc4592019p-14},
+        {507,-0x1.b12831ae154dp-14,-0x1.27454e06ffcdap-13},
+        {508,-0x1.46e485db5d232p-14,-0x1.66f157aaeb72fp-13},
+        {509,-0x1.72b4a12ce34a3p-15,-0x1.9b11b433f9786p-13},
+        {510,-0x1.cee3814f55f14p-19,-0x1.bea920e929f14p-13},
+        {511,0x1.61e140daf370ep-15,-0x1.cd9a28e280c38p-13},
+        {512,0x1.79b3d979bf435p-14,-0x1.c5158e3b60336p-13},
+        {513,0x1.1f94dd5f962bdp-13,-0x1.a3ef17c9b0b35p-13},
+        {514,0x1.7a171d306c4e7p-13,-0x1.6acec1ce0d44bp-13},
+        {515,0x1.c61eec142581fp-13,-0x1.1c37c91b74993p-13},
+        {516,0x1.fe4649b0abd9p-13,-0x1.78c6b9c404b7ep-14},
+        {517,0x1.0f3ef744acca4p-12,-0x1.43c5d8e26809p-15},
+        {518,0x1.12358cbbd722ep-12,0x1.f8925e3df151ap-17},
+        {519,0x1.07cf3645580fap-12,0x1.1c19cb3e9d5bdp-14},
+        {520,0x1.e19e18d8aeab5p-13,0x1.e787e072dca45p-14},
+        {521,0x1.9dc2478dde733p-13,0x1.4a928e31de42ap-13},
+        {522,0x1.48e77cf723fccp-13,0x1.8d9543ded3c0cp-13},
+        {523,0x1.d1fe23f69272p-14,0x1.b980747e4ad52p-13},
+        {524,0x1.0912a15e61092p-14,0x1.ccd8bca9d4fc2p-13},
+        {525,0x1.1036f31faa0a6p-16,0x1.c7ff787b5e3b2p-13},
+        {526,-0x1.c482854a516d8p-16,0x1.ad139a1116a1ap-13},
+        {527,-0x1.0c86861cf3ceap-14,0x1.7fab840f255dcp-13},
+        {528,-0x1.86e1722f21daap-14,0x1.4470838bfab94p-13},
+        {529,-0x1.dc064848c0ac8p-14,0x1.00a756ee63e1bp-13},
+        {530,-0x1.057cce58333cep-13,0x1.736542cd3d518p-14},
+        {531,-0x1.0add84f974ea4p-13,0x1.d2707c87f802ep-15},
+        {532,-0x1.0067159879732p-13,0x1.ad7fb30655336p-16},
+        {533,-0x1.d29238df301p-14,0x1.96cd7d397fd84p-24},
+        {534,-0x1.927d59a2ed614p-14,-0x1.4e3e4d3f2cb4dp-16},
+        {535,-0x1.48522b4268484p-14,-0x1.1d98b2dc88b32p-15},
+        {536,-0x1.f6c9a72a23a9fp-15,-0x1.63c5da23078b8p-15},
+        {537,-0x1.6402bc7be00b9p-15,-0x1.7e95c681db296p-15},
+        {538,-0x1.c3ff7827aa6b1p-16,-0x1.75ba11544de12p-15},
+        {539,-0x1.dc63d7757fb5cp-17,-0x1.527bd5aae8fcp-15},
+        {540,-0x1.3231dec3af658p-18,-0x1.1e92461cb7562p-15},
+        {541,0x1.08ed1a4ba6915p-19,-0x1.c635f29bca8f2p-16},
+        {542,0x1.7f96dbd5ffb94p-18,-0x1.4f9924ef93c14p-16},
+        {543,0x1.e131d22e0af8cp-18,-0x1.c9caa933e63ccp-17},
+        {544,0x1.d262545df6f8p-18,-0x1.1add4fd60d648p-17},
+        {545,0x1.7d3a4061d5acp-18,-0x1.31a588da8b18ep-18},
+        {546,0x1.07b1581adf8fp-18,-0x1.0c0f38d6b753ep-19},
+        {504,0x1.b626d782dfbb2p-19,0x1.6cf3b3d1cc5adp-20},
+        {505,0x1.50cde07c73446p-18,0x1.c6f82a0fcb247p-19},
+        {506,0x1.b46d9bf8a39c3p-18,0x1.bb84e9d3279fdp-18},
+        {507,0x1.e5ddb6b5969aap-18,0x1.747b0e9c4b3bap-17},
+        {508,0x1.bfdce484f8cedp-18,0x1.198c150560ecp-16},
+        {509,0x1.1bce197b442p-18,0x1.87f018d9ee7b5p-16},
+        {510,-0x1.4b09329cc22cfp-21,0x1.fcc62027b18eep-16},
+        {511,-0x1.14d97b8437dcep-17,0x1.35e07b692a9dep-15},
+        {512,-0x1.3c246677d7452p-16,0x1.62c2a1416ba64p-15},
+        {513,-0x1.0ebf759d6e33ap-15,0x1.7c62d07613944p-15},
+        {514,-0x1.93637f1d9d078p-15,0x1.79e86636d9bfap-15},
+        {515,-0x1.128efb88fa038p-14,0x1.53397a10eae6cp-15},
+        {516,-0x1.5d1721f1f1098p-14,0x1.01fe9989e60b7p-15},
+        {517,-0x1.a3384247195fbp-14,0x1.053bee2313994p-16},
+        {518,-0x1.de17a87b9e9a9p-14,-0x1.577df6e07f9fdp-18},
+        {519,-0x1.034f50ab151ep-13,-0x1.028d6f368d57p-15},
+        {520,-0x1.0b0fea22c6f18p-13,-0x1.fbc25cf79c303p-15},
+        {521,-0x1.0383001e61f2dp-13,-0x1.84f6b7cc08474p-14},
+        {522,-0x1.d57a7b173e562p-14,-0x1.073a12bd95d88p-13},
+        {523,-0x1.7ff13ee985156p-14,-0x1.4884e6b7ed3d4p-13},
+        {524,-0x1.0789c693aec48p-14,-0x1.816e7d7aa9636p-13},
+        {525,-0x1.c0ddb8f6408fp-16,-0x1.ad2b02d6db31ap-13},
+        {526,0x1.fab66cfa86304p-17,-0x1.c77c307ec9561p-13},
+        {527,0x1.fc22031a7a599p-15,-0x1.cd17e4b4a217cp-13},
+        {528,0x1.c11e68d5b4dfp-14,-0x1.bbfedba14ff3cp-13},
+        {529,0x1.3e539b4ee2f1ap-13,-0x1.93ba43493cc5p-13},
+        {530,0x1.925f6e08d6c3ep-13,-0x1.5579138b687d6p-13},
+        {531,0x1.d72cc4ebf30aap-13,-0x1.04091c004445ap-13},
+        {532,0x1.040d79ac10f7ep-12,-0x1.4756907a2eaa7p-14},
+        {533,0x1.10e9241fc2157p-12,-0x1.ce326f1f500dcp-16},
+        {534,0x1.11467ec1a2acdp-12,0x1.9c0cc932ab8bp-16},
+        {535,0x1.051f15494b896p-12,0x1.3b88f9fd92db4p-14},
+        {536,0x1.da92e0b70c5eep-13,0x1.fdada075f1a33p-14},
+        {537,0x1.96cd54e6ee8e1p-13,0x1.5143e43d2bfbcp-13},
+        {538,0x1.437dbb763b7ap-13,0x1.90b778f64c63cp-13},
+        {539,0x1.cc3fa9b6c88a5p-14,0x1.ba4cd27754cdp-13},
+        {540,0x1.094d864599a68p-14,0x1.ccbc837e19cb3p-13},
+        {541,0x1.28127ba6ecc54p-16,0x1.c865841538e88p-13},
+        {542,-0x1.9ab6c9e8d7689p-16,0x1.af31dd2b3efa6p-13},
+        {543,-0x1.ff350129c8bcbp-15,0x1.845ac591b6f2ap-13},
+        {544,-0x1.79ec9ea4231fap-14,0x1.4c131f630d26ep-13},
+        {545,-0x1.d1870fb447ee2p-14,0x1.0b21846b3902ap-13},
+        {546,-0x1.02908ffd24f74p-13,0x1.8ce889cd59d28p-14},
+        {547,-0x1.0b10c9ed08d56p-13,0x1.05739b53d4222p-14},
+        {548,-0x1.04205d9befaecp-13,0x1.101b8d07c541ep-15},
+        {549,-0x1.e0fe733fda169p-14,0x1.b245051b99fdep-18},
+        {550,-0x1.a6fcafca6f95ep-14,-0x1.e76404b8ecc0ep-17},
+        {551,-0x1.6150b9c4fb494p-14,-0x1.f7d8f2ad60a65p-16},
+        {552,-0x1.16dcd940a41cap-14,-0x1.4fbf2a9ac7de4p-15},
+        {553,-0x1.9b83998704365p-15,-0x1.78bb7030a179cp-15},
+        {554,-0x1.15e73ba983e54p-15,-0x1.7d16e2dcf638bp-15},
+        {555,-0x1.47e272aee46a4p-16,-0x1.64d88f731c797p-15},
+        {556,-0x1.26a1763504146p-17,-0x1.38d4f0486bc6cp-15},
+        {557,-0x1.0690a0cb869dep-20,-0x1.01bb7bd70cfaap-15},
+        {558,0x1.0dbd19f3e8232p-18,-0x1.8e995c4b52dc8p-16},
+        {559,0x1.ba313564eeaa7p-18,-0x1.1f90d2eaa8732p-16},
+        {560,0x1.e66c1b53badfap-18,-0x1.7e719df56cdd6p-17},
+        {561,0x1.b8fad1353d27cp-18,-0x1.ca923c9ee47b8p-18},
+        {562,0x1.575049900f616p-18,-0x1.db58b4d7dd509p-19},
+        {563,0x1.c3c4beee40156p-19,-0x1.848a6b783529bp-20},
+        {520,0x1.d5b332e8fb3dp-19,0x1.a3f59b1978752p-20},
+        {521,0x1.5c3ccc1d40a36p-18,0x1.ea9ac2af75c0cp-19},
+        {522,0x1.b9f6cfcaa6683p-18,0x1.cd72a9a36f28ep-18},
+        {523,0x1.e654f75bc75e4p-18,0x1.7ae9488bdeff4p-17},
+        {524,0x1.bf421b426170ep-18,0x1.1a2e2127c14a8p-16},
+        {525,0x1.2198216880d7dp-18,0x1.850ab7b6bfa73p-16},
+        {526,-0x1.2aa89ed5eab2ep-22,0x1.f6364b6f988b4p-16},
+        {527,-0x1.f5a94f5a289aep-18,0x1.314f3ec255b29p-15},
+        {528,-0x1.24ba9509f0519p-16,0x1.5e398bc306aap-15},
+        {529,-0x1.f948dd1bf2e7ap-16,0x1.7a08b8833d724p-15},
+        {530,-0x1.7a64fb4ee35a8p-15,0x1.7ca813487819p-15},
+        {531,-0x1.02e7c0699bfc8p-14,0x1.5e89d34a28a28p-15},
+        {532,-0x1.4b3f5bf39335dp-14,0x1.198457907f265p-15},
+        {533,-0x1.90e9da87f3949p-14,0x1.53595841af82ep-16},
+        {534,-0x1.cdccd877e7c07p-14,0x1.c2cf84e4ede0bp-20},
+        {535,-0x1.fb74673049672p-14,-0x1.6d3c116c23a7fp-16},
+        {536,-0x1.09cde3b17addcp-13,-0x1.9dfcc0932989p-15},
+        {537,-0x1.0861059ba592ep-13,-0x1.4ee5b97cc6518p-14},
+        {538,-0x1.eebce91ed1abp-14,-0x1.d43a0cdbc8051p-14},
+        {539,-0x1.ab3b11f9e2b4p-14,-0x1.2b726c4500134p-13},
+        {540,-0x1.4627eabdfdcbbp-14,-0x1.67070c45c346ap-13},
+        {541,-0x1.83c9446d9569fp-15,-0x1.9861dc18867d8p-13},
+        {542,-0x1.1a70cda4d10a4p-17,-0x1.bb585a4b4d29p-13},
+        {543,0x1.1ce8a739f8854p-15,-0x1.cc69e2a5b0c9bp-13},
+        {544,0x1.4a57e52dda58ep-14,-0x1.c9124396d6e9cp-13},
+        {545,0x1.030264d570174p-13,-0x1.b00b817e688e2p-13},
+        {546,0x1.5b481b37df47fp-13,-0x1.8177fb338a926p-13},
+        {547,0x1.a8a56fce10152p-13,-0x1.3ef0267ff0e96p-13},
+        {548,0x1.e648fbb885268p-13,-0x1.d6e3554e73b6fp-14},
+        {549,0x1.0824077343059p-12,-0x1.1660f2d633d1p-14},
+        {550,0x1.11f7306aa80b4p-12,-0x1.1a6b0d82e009p-16},
+        {551,0x1.0ffad4644f0dbp-12,0x1.1a1f67f464f3ep-15},
+        {552,0x1.024ffbd8f9dc6p-12,0x1.58f5c0507a199p-14},
+        {553,0x1.d3b26062e0bf2p-13,0x1.09004f81a1e62p-13},
+        {554,0x1.90506d6327256p-13,0x1.573ceefcae4cfp-13},
+        {555,0x1.3ebbc96e7f04cp-13,0x1.935d8db89930ep-13},
+        {556,0x1.c7fc187e617ccp-14,0x1.bad820b6bf24ap-13},
+        {557,0x1.0b091d6b56de8p-14,0x1.cc90e22fa279ap-13},
+        {558,0x1.45ba73b035894p-16,0x1.c8e0e6e5bf0c5p-13},
+        {559,-0x1.6b5ec9744843ap-16,0x1.b17e80f99b284p-13},
+        {560,-0x1.e2a41acc842f4p-15,0x1.894a910a409dcp-13},
+        {561,-0x1.6b943bb774a26p-14,0x1.54084d8d3dc62p-13},
+        {562,-0x1.c5931d0a0e0d8p-14,0x1.1606d0f906afcp-13},
+        {563,-0x1.fdc354bae8954p-14,0x1.a7897f6782bd4p-14},
+        {564,-0x1.0a80cb7273277p-13,0x1.232cf6b074418p-14},
+        {565,-0x1.072516031cbb8p-13,0x1.4d5a99e732e02p-15},
+        {566,-0x1.ee4982fb679cp-14,0x1.c274e1caff9ecp-17},
+        {567,-0x1.bad2b68fe9facp-14,-0x1.1b7ece3da0b74p-17},
+        {568,-0x1.7a4a823b1186ap-14,-0x1.a7e4f4ebd747cp-16},
+        {569,-0x1.33152aa57cbdcp-14,-0x1.3536648330012p-15},
+        {570,-0x1.d628e0603080ap-15,-0x1.6caabd1a54e35p-15},
+        {571,-0x1.4e7ff2faad0a1p-15,-0x1.7f11b87196588p-15},
+        {572,-0x1.ad7c7982f308cp-16,-0x1.7324f01074002p-15},
+        {573,-0x1.cf383f4eaa0b4p-17,-0x1.50b75be3cdf3p-15},
+        {574,-0x1.3fc2d132eb12ep-18,-0x1.1fdc2cc612e44p-15},
+        {575,0x1.9b51b11f8a0aep-20,-0x1.d04e072b8f2b4p-16},
+        {576,0x1.65945f8f7ab24p-18,-0x1.602a5efe589aep-16},
+        {577,0x1.d7cb77400756fp-18,-0x1.f2a65b02f6913p-17},
+        {578,0x1.df0a9668d5fcp-18,-0x1.44f9d44e01cf9p-17},
+        {579,0x1.9e8ad68d9dad4p-18,-0x1.7c4faf36cdbbfp-18},
+        {580,0x1.373b62675bff2p-18,-0x1.7cd8995b82efap-19},
+        {581,0x1.8995dd8960338p-19,-0x1.24855af6b34b9p-20},
+        {532,0x1.5802b74c5c12ap-19,0x1.bbc5c9bccd104p-21},
+        {533,0x1.1b015c09ecf8p-18,0x1.35b07de0187cfp-19},
+        {534,0x1.8501c17196f6fp-18,0x1.409f36f4d7e76p-18},
+        {535,0x1.d1df837eb3f46p-18,0x1.18a26390cb7dp-17},
+        {536,0x1.e4222f74beb5fp-18,0x1.b6cdff9e8967bp-17},
+        {537,0x1.9b536843e4f35p-18,0x1.3b1ead198aa19p-16},
+        {538,0x1.ae7f1e545a88p-19,0x1.a646bf015fdaap-16},
+        {539,-0x1.0839b9a577aa6p-19,0x1.0a518e0e4d39ep-15},
+        {540,-0x1.452ad71ad02a8p-17,0x1.3d8ebc0c9b742p-15},
+        {541,-0x1.509ba57b6d004p-16,0x1.662923cce27f5p-15},
+        {542,-0x1.146ae2b6224fbp-15,0x1.7cbc808d0003bp-15},
+        {543,-0x1.922fd8982e166p-15,0x1.79cde85ede95cp-15},
+        {544,-0x1.0ddee043fabfcp-14,0x1.56843bf25fe94p-15},
+        {545,-0x1.547317a724c79p-14,0x1.0d6d88ef99e84p-15},
+        {546,-0x1.97c3d1d613bc8p-14,0x1.367d0e92940b9p-16},
+        {547,-0x1.d2139f2701a7ep-14,-0x1.102ac2a6d0c2p-24},
+        {548,-0x1.fd5fcda9b962ep-14,-0x1.864436b8af355p-16},
+        {549,-0x1.09ed932e8e956p-13,-0x1.a64efc3ab658p-15},
+        {550,-0x1.08390b8286c2p-13,-0x1.5031c9f8945c2p-14},
+        {551,-0x1.ef4c9628cfbecp-14,-0x1.d256111e4ffep-14},
+        {552,-0x1.ae4154b94e8c1p-14,-0x1.2907203d4b496p-13},
+        {553,-0x1.4d2e506d02f52p-14,-0x1.639133e6d6104p-13},
+        {554,-0x1.9c592f7eb47c3p-15,-0x1.949e5e1cf54e6p-13},
+        {555,-0x1.acbf79a9992e8p-17,-0x1.b845da4968d1cp-13},
+        {556,0x1.d864db48bca13p-16,-0x1.cb32524ab17c5p-13},
+        {557,0x1.2cacb29aba3eap-14,-0x1.caec3980565e4p-13},
+        {558,0x1.e4a5677274587p-14,-0x1.b6164ef8b4d12p-13},
+        {559,0x1.49f24571ec811p-13,-0x1.8c965b757846dp-13},
+        {560,0x1.982f6c22d74f1p-13,-0x1.4fa5d6e004b76p-13},
+        {561,0x1.d86b6c2705b0ep-13,-0x1.01c82f4cc9ad8p-13},
+        {562,0x1.036320a5fcff9p-12,-0x1.4d4d80813fca9p-14},
+        {563,0x1.1034c5ee361cfp-12,-0x1.0b53a6b4c94cdp-15},
+        {564,0x1.11e00753bb9c6p-12,0x1.23f8c9098f31ep-16},
+        {565,0x1.084a6cfd26a28p-12,0x1.13d06375c6f04p-14},
+        {566,0x1.e817609a5a752p-13,0x1.d03754e9a4d45p-14},
+        {567,0x1.acc419fa1e01fp-13,0x1.3a4f8d379541p-13},
+        {568,0x1.6233c423cfd48p-13,0x1.7c8e5108811e6p-13},
+        {569,0x1.0cd59335e0c16p-13,0x1.abf901b4ce4e3p-13},
+        {570,0x1.6334d8977794bp-14,0x1.c6f2ada69b2aap-13},
+        {571,0x1.5662080bc81a6p-15,0x1.cd31fd7f80383p-13},
+        {572,-0x1.2869807122445p-20,0x1.bfb831e265e48p-13},
+        {573,-0x1.47357c044bbep-15,0x1.a0af223eb435ep-13},
+        {574,-0x1.2ab39e6aa0867p-14,0x1.7332003d0e06cp-13},
+        {575,-0x1.94eb67c2791f2p-14,0x1.3b066207e7b28p-13},
+        {576,-0x1.df7d25ab442ep-14,0x1.f89882e5df0c3p-14},
+        {577,-0x1.04f30427bf5dep-13,0x1.76583caf0b742p-14},
+        {578,-0x1.0adf034afa735p-13,0x1.ee29037cf44bfp-15},
+        {579,-0x1.033499081e604p-13,0x1.0315030587117p-15},
+        {580,-0x1.e0ab2ef9b19c8p-14,0x1.b092a192fb659p-18},
+        {581,-0x1.aa285a35c6158p-14,-0x1.c65d1b71b3d74p-17},
+        {582,-0x1.68e105a966beap-14,-0x1.e03e9fc0830fcp-16},
+        {583,-0x1.22b2d3393efc6p-14,-0x1.4518b283aeb81p-15},
+        {584,-0x1.b9d56813368dp-15,-0x1.730b271996072p-15},
+        {585,-0x1.37df49ebf2a3fp-15,-0x1.7ed96d2a605bp-15},
+        {586,-0x1.8c2ce214d306ep-16,-0x1.6f076645ae2d2p-15},
+        {587,-0x1.a28d9d4d9965p-17,-0x1.4af46115263c8p-15},
+        {588,-0x1.0a850a8cc9d64p-18,-0x1.1a1d0c18c911ep-15},
+        {589,0x1.03515570dd878p-19,-0x1.c6eb9b7a103f6p-16},
+        {590,0x1.6fb6efa3dfebep-18,-0x1.59d425bbf1ab3p-16},
+        {591,0x1.d99ea188e9674p-18,-0x1.ec204f39e4fd4p-17},
+        {592,0x1.dec57fa78fc2ap-18,-0x1.436cde6dc6bdap-17},
+        {593,0x1.9fedf6b1355eap-18,-0x1.7f91b43b368b8p-18},
+        {594,0x1.3bbbd409ad4eep-18,-0x1.889ebc353b6fap-19},
+        {595,0x1.98276c668cc3p-19,-0x1.3a599eb741ceep-20},
+        {550,0x1.9316e070fa705p-19,0x1.3188cc48857bdp-20},
+        {551,0x1.357f24154c93ep-18,0x1.7719c430648e5p-19},
+        {552,0x1.9805de30f06d4p-18,0x1.6b34b98c4784p-18},
+        {553,0x1.da172d9ffc34ap-18,0x1.30dcc43b346c3p-17},
+        {554,0x1.e0544a40d94b9p-18,0x1.cf2b824033ba3p-17},
+        {555,0x1.8d2b16ca54ebfp-18,0x1.45cf6a53ffff7p-16},
+        {556,0x1.8764942947434p-19,0x1.ae1446fffbbcp-16},
+        {557,-0x1.29ea260bf082ap-19,0x1.0c59bdacf18a4p-15},
+        {558,-0x1.47019ce08bd36p-17,0x1.3dc0f4f532dfap-15},
+        {559,-0x1.4b6360e2b5151p-16,0x1.652af2da66142p-15},
+        {560,-0x1.0d71cbc29cbbcp-15,0x1.7be6d6e4cc7c6p-15},
+        {561,-0x1.85fa76cce48e8p-15,0x1.7b2b8f16aa1cfp-15},
+        {562,-0x1.0512a0bc812afp-14,0x1.5cb37e61e9b41p-15},
+        {563,-0x1.49603c1cd357p-14,0x1.1b63a84e832ap-15},
+        {564,-0x1.8b6bcce2093e8p-14,0x1.67df1dc465b5p-16},
+        {565,-0x1.c61751eab206ep-14,0x1.2b4d87a3247e7p-18},
+        {566,-0x1.f3f53880c1a8cp-14,-0x1.1c9e4194b367ep-16},
+        {567,-0x1.07d6dd99ca109p-13,-0x1.62537c935a5d2p-15},
+        {568,-0x1.0a36fbefe523ep-13,-0x1.27594e2fae855p-14},
+        {569,-0x1.fe57b68b675acp-14,-0x1.a4596e3959fp-14},
+        {570,-0x1.cae81158f610bp-14,-0x1.10d4e6ae26c21p-13},
+        {571,-0x1.794b48b7269e6p-14,-0x1.4c02a4d534176p-13},
+        {572,-0x1.0a951880399acp-14,-0x1.7fec40ad0a1aap-13},
+        {573,-0x1.03ad9b3e820acp-15,-0x1.a8e3f13e76bcbp-13},
+        {574,0x1.bf0fca2357c42p-18,-0x1.c39d7985b42d2p-13},
+        {575,0x1.901bcad5a951ap-15,-0x1.cd70c271507f6p-13},
+        {576,0x1.7a721ccc29579p-14,-0x1.c493c102c96b6p-13},
+        {577,0x1.1518df828638ep-13,-0x1.a8467fb2604c4p-13},
+        {578,0x1.670a4125e8298p-13,-0x1.78ed202b5b9c2p-13},
+        {579,0x1.ae99661af9df1p-13,-0x1.38151148668b8p-13},
+        {580,0x1.e7c8fb0ef2ae8p-13,-0x1.d0c8cc1b96c0ap-14},
+        {581,0x1.07acd27a44d6bp-12,-0x1.1ae81cf7589f6p-14},
+        {582,0x1.1182875dcf12cp-12,-0x1.5cbbfc7b7f6d2p-16},
+        {583,0x1.10d3d6b9b10ap-12,0x1.c350717efa14p-16},
+        {584,0x1.05aae33d2b27cp-12,0x1.334ac27bd3cf4p-14},
+        {585,0x1.e159f8aa11432p-13,0x1.e6bba18d9c968p-14},
+        {586,0x1.a61d67ab776e5p-13,0x1.41543472a7f65p-13},
+        {587,0x1.5cfb8402f32e5p-13,0x1.800c12ce540bp-13},
+        {588,0x1.0a051763890eap-13,0x1.ad01c920cffc9p-13},
+        {589,0x1.636f28f556862p-14,0x1.c6cdb5dbeeb9p-13},
+        {590,0x1.62ba3448453bp-15,0x1.cd3211a617a78p-13},
+        {591,0x1.aac6e5ccfc386p-20,0x1.c112f2e56c41bp-13},
+        {592,-0x1.297e496874f1ep-15,0x1.a459c9a247e58p-13},
+        {593,-0x1.1a612f9504d9ap-14,0x1.79c74af010f4p-13},
+        {594,-0x1.8579a0151b764p-14,0x1.44b81de4a537p-13},
+        {595,-0x1.d338aedccf37bp-14,0x1.08e18ae3badfep-13},
+        {596,-0x1.0165b2e426fd1p-13,0x1.9417bc22a8114p-14},
+        {597,-0x1.0aa06b6687235p-13,0x1.17a03245a7067p-14},
+        {598,-0x1.06a6e7a5950fap-13,0x1.4577f9823b6cp-15},
+        {599,-0x1.eef612f9aa915p-14,0x1.d4e8123c430d4p-17},
+        {600,-0x1.bf23f9124223cp-14,-0x1.cf5489c5a8e82p-18},
+        {601,-0x1.833831728cd0cp-14,-0x1.86e7727bb1d9cp-16},
+        {602,-0x1.409b73d63287ep-14,-0x1.25e364114f316p-15},
+        {603,-0x1.f8b5ecdfcf70cp-15,-0x1.627c3d281c4b8p-15},
+        {604,-0x1.75adcb36c21efp-15,-0x1.7ccef941b29bap-15},
+        {605,-0x1.fe1f9e5b730e4p-16,-0x1.7a267152ef17fp-15},
+        {606,-0x1.3378edb27806bp-16,-0x1.60e27412c1994p-15},
+        {607,-0x1.21d3dda290e78p-17,-0x1.37d14bf271eacp-15},
+        {608,-0x1.7f6ef89cd6e8cp-20,-0x1.059689b014aabp-15},
+        {609,0x1.ca6610e45a681p-19,-0x1.a055e9d1dc5bep-16},
+        {610,0x1.9decab65d98aep-18,-0x1.38fbe09e7b484p-16},
+        {611,0x1.e3e8bc376d10bp-18,-0x1.b8f24e051e4f5p-17},
+        {612,0x1.d454a00f90e35p-18,-0x1.1efaaa1b545b8p-17},
+        {613,0x1.8c9f7e45301ep-18,-0x1.50b0e439c860cp-18},
+        {614,0x1.27b38aa3c544ep-18,-0x1.53a47d0afd30ap-19},
+        {615,0x1.77daa0dc5dcecp-19,-0x1.08dcb964a57c8p-20},
+        {564,0x1.8050b07bea894p-19,0x1.147a01f4e194ep-20},
+        {565,0x1.293400612462bp-18,0x1.56e3d7cf0ee53p-19},
+        {566,0x1.8b8bca038072fp-18,0x1.4df553d1a0fdfp-18},
+        {567,0x1.d27e43797e524p-18,0x1.19a47729f2616p-17},
+        {568,0x1.e536d945f26e4p-18,0x1.adf1519c208a7p-17},
+        {569,0x1.a882e23fb9f42p-18,0x1.3013f3066de42p-16},
+        {570,0x1.013b2a01f4deep-18,0x1.93fe9b3c866eep-16},
+        {571,-0x1.46acae0a97facp-21,0x1.fc2ab8eaff2f5p-16},
+        {572,-0x1.e7c9f4a9cd5edp-18,0x1.2fde526fad55cp-15},
+        {573,-0x1.11201d3d3cedfp-16,0x1.59f32a7d01a67p-15},
+        {574,-0x1.cef4fb6040538p-16,0x1.7641fa9a5a92ep-15},
+        {575,-0x1.57902ce592cf2p-15,0x1.7e79d8e6797bcp-15},
+        {576,-0x1.d4c0f7d9bfd8ap-15,0x1.6c8dfe202f5aep-15},
+        {577,-0x1.2c8bd908efabcp-14,0x1.3b46c445c4ebp-15},
+        {578,-0x1.6e7428fe0dfbcp-14,0x1.cda97e1fd6396p-16},
+        {579,-0x1.ab954384f47e3p-14,0x1.b562edb109696p-17},
+        {580,-0x1.defed2fa65d42p-14,-0x1.8566a9e1d47c4p-18},
+        {581,-0x1.01d3addc222e2p-13,-0x1.e02307a084fb4p-16},
+        {582,-0x1.0a656c44b9634p-13,-0x1.cae5d8bf47bcep-15},
+        {583,-0x1.0726f67bf6b5ep-13,-0x1.5c48382d861b2p-14},
+        {584,-0x1.ed1db592ce402p-14,-0x1.d710e8f757bbcp-14},
+        {585,-0x1.af83f05b32ea6p-14,-0x1.27b7b249fc23ep-13},
+        {586,-0x1.5567a580455a3p-14,-0x1.5f3e88b1bbd0bp-13},
+        {587,-0x1.c0e744997dfc6p-15,-0x1.8e9c882383baap-13},
+        {588,-0x1.5077ada6c0809p-16,-0x1.b2808d8322a53p-13},
+        {589,0x1.29c96b4b74373p-16,-0x1.c805c2a2bf98ep-13},
+        {590,0x1.e940c1a00404ep-15,-0x1.ccec6776d7d4ep-13},
+        {591,0x1.a2b38757e1b7cp-14,-0x1.bfc9bbc9790bfp-13},
+        {592,0x1.2625054dbdc86p-13,-0x1.a02aea58c971ep-13},
+        {593,0x1.746e531d266cap-13,-0x1.6ea7bf5575f36p-13},
+        {594,0x1.b824dbe412ffp-13,-0x1.2ce32b0a49b7ap-13},
+        {595,0x1.edaec2727b069p-13,-0x1.baf1f8b6e13eep-14},
+        {596,0x1.09135167bcc0fp-12,-0x1.07b37d5a85827p-14},
+        {597,0x1.11c6dc0174bbep-12,-0x1.20b8d06f84968p-16},
+        {598,0x1.10775ba33f16ep-12,0x1.eadd2dc5e3774p-16},
+        {599,0x1.05375137ad82ep-12,0x1.37e086c4c834ap-14},
+        {600,0x1.e14a3d5ffba66p-13,0x1.e68c844c334c8p-14},
+        {601,0x1.a7c059f3f0372p-13,0x1.3f70331ab5e94p-13},
+        {602,0x1.60eab0fc6e6f5p-13,0x1.7d3082261b6f1p-13},
+        {603,0x1.10885bda4b36ap-13,0x1.aa295b765ec78p-13},
+        {604,0x1.757c35cad445cp-14,0x1.c4fc538e488p-13},
+        {605,0x1.8f45457a280d6p-15,0x1.cd57d09334949p-13},
+        {606,0x1.fc5e1c7784aa9p-18,0x1.c3f1ad5c9dd26p-13},
+        {607,-0x1.ea848889ab0bap-16,0x1.aa700c603d54cp-13},
+        {608,-0x1.014f58a70929ep-14,0x1.8342b0c0acfd8p-13},
+        {609,-0x1.6f89edf6c05cap-14,0x1.5170588df90bep-13},
+        {610,-0x1.c2513ccb61fcdp-14,0x1.185c64bfd3a4dp-13},
+        {611,-0x1.f87213496a65cp-14,0x1.b713138f1ee38p-14},
+        {612,-0x1.093aea981624p-13,0x1.3cbc90cb497f9p-14},
+        {613,-0x1.093a51c9c8cc3p-13,0x1.8fbe344632328p-15},
+        {614,-0x1.fbceed3704a07p-14,0x1.76a8ca396b3eap-16},
+        {615,-0x1.d2d574812fe38p-14,0x1.0a59b6790994ep-21},
+        {616,-0x1.9c67d1e4eb7b6p-14,-0x1.2116fc79e976cp-16},
+        {617,-0x1.5d91b5f76082cp-14,-0x1.00560206f1e84p-15},
+        {618,-0x1.1b2eb1bf43c96p-14,-0x1.4b5cb1af0871ap-15},
+        {619,-0x1.b33656f52d66cp-15,-0x1.740bd7a3c0bfep-15},
+        {620,-0x1.38ef0b584e94cp-15,-0x1.7e9e66e6035dcp-15},
+        {621,-0x1.9a022d3f04ce2p-16,-0x1.7091c950675efp-15},
+        {622,-0x1.cbf10b3fcd94fp-17,-0x1.501217e47f612p-15},
+        {623,-0x1.6473e87c268f4p-18,-0x1.236baaba7f1f6p-15},
+        {624,0x1.93cac727da716p-21,-0x1.e11a717856bccp-16},
+        {625,0x1.38750caed5aap-18,-0x1.79465708bbbd6p-16},
+        {626,0x1.c17f5145346c1p-18,-0x1.17a35114b5af9p-16},
+        {627,0x1.e6ddff4f576b1p-18,-0x1.843dd697ca6fp-17},
+        {628,0x1.c3fe9581335afp-18,-0x1.f10515ccd3c58p-18},
+        {629,0x1.73ab54ec81a7p-18,-0x1.1d68928b13eeap-18},
+        {630,0x1.0dc98bebe570cp-18,-0x1.16cd422115467p-19},
+        {579,0x1.a2a874f82394ap-19,0x1.48a1360b50822p-20},
+        {580,0x1.37b4062bae8aap-18,0x1.7bf105b1d23eap-19},
+        {581,0x1.9555b99970a61p-18,0x1.63ffaeb5d195cp-18},
+        {582,0x1.d691d89982332p-18,0x1.24e2c1b951b26p-17},
+        {583,0x1.e42af505c8ebep-18,0x1.b78a92f5952f8p-17},
+        {584,0x1.a4e9c9c602c72p-18,0x1.331f807f44f22p-16},
+        {585,0x1.ff87ef0b931e1p-19,0x1.94924e53f437ep-16},
+        {586,-0x1.0ca5bee3db4fp-21,0x1.fa04aa3b765ecp-16},
+        {587,-0x1.cfec024575c82p-18,0x1.2da542a80d51dp-15},
+        {588,-0x1.04f2d64d1665ep-16,0x1.573a365d686e4p-15},
+        {589,-0x1.bac14e2d68fep-16,0x1.742b8312e22cp-15},
+        {590,-0x1.48da2ea644d76p-15,0x1.7ea2c7fa39482p-15},
+        {591,-0x1.c157564f3bad6p-15,0x1.70fa913026d11p-15},
+        {592,-0x1.20c90e14a1f2cp-14,0x1.463cbb3cfc9a8p-15},
+        {593,-0x1.6158233cd8b65p-14,0x1.f547f9d4bab8p-16},
+        {594,-0x1.9e464be88835ap-14,0x1.182b67bec8488p-16},
+        {595,-0x1.d3120c9a00b37p-14,-0x1.5dd4413ae01b4p-21},
+        {596,-0x1.fb110ee7422d3p-14,-0x1.6f63610d6940ep-16},
+        {597,-0x1.08e09fa67bef4p-13,-0x1.85cb0531fe8cap-15},
+        {598,-0x1.098fbb53742d4p-13,-0x1.34414d2c5e66fp-14},
+        {599,-0x1.fbfd357086b7p-14,-0x1.ab30380813fbcp-14},
+        {600,-0x1.ca4e8ebe49edp-14,-0x1.1107f9cefc9d5p-13},
+        {601,-0x1.7d698ac6bb4cap-14,-0x1.49515c170d474p-13},
+        {602,-0x1.163108ec674ccp-14,-0x1.7b35b0b98506ep-13},
+        {603,-0x1.2e4cec29efaccp-15,-0x1.a38a74185654p-13},
+        {604,-0x1.17dbc3bd901c1p-20,-0x1.bf6f09cf2bc64p-13},
+        {605,0x1.394304c668ba3p-15,-0x1.cc80c393b5f44p-13},
+        {606,0x1.452fa19695608p-14,-0x1.c9091d7a28dc6p-13},
+        {607,0x1.edce89727b041p-14,-0x1.b4227f6ff24fap-13},
+        {608,0x1.474f704cbd732p-13,-0x1.8dd06c88c4a56p-13},
+        {609,0x1.8feafb07c3cc3p-13,-0x1.5708e7170436ap-13},
+        {610,0x1.cd1bfafbf4aa3p-13,-0x1.11ade374ccf1cp-13},
+        {611,0x1.fbc5fe1ece476p-13,-0x1.80eda9ba1ca2p-14},
+        {612,0x1.0cc064b5c31bdp-12,-0x1.9b2e5a8cf174ap-15},
+        {613,0x1.126007f3e8d9ep-12,-0x1.1262cff7ceadap-18},
+        {614,0x1.0e76968589656p-12,0x1.581b9814ba14dp-15},
+        {615,0x1.01387ad0a8868p-12,0x1.61a1a7503c924p-14},
+        {616,0x1.d6ace290f8757p-13,0x1.03d2db9bc144cp-13},
+        {617,0x1.9be418d3d4737p-13,0x1.4b8a4635b9383p-13},
+        {618,0x1.551606fe7e11p-13,0x1.851cb0afb84a6p-13},
+        {619,0x1.05cd615a05e65p-13,0x1.ae7f8e36d16e8p-13},
+        {620,0x1.63ce37214bf64p-14,0x1.c6915f594e694p-13},
+        {621,0x1.755624989a564p-15,0x1.cd2326e70add8p-13},
+        {622,0x1.7c803eee73e32p-18,0x1.c2f1d87c9a446p-13},
+        {623,-0x1.f805e9003a305p-16,0x1.a990b150b66a7p-13},
+        {624,-0x1.00f36da993456p-14,0x1.83468607fe4f4p-13},
+        {625,-0x1.6cb2b4e0ffb52p-14,0x1.52e0f9962d776p-13},
+        {626,-0x1.be736a16a7aa6p-14,0x1.1b813784f60ddp-13},
+        {627,-0x1.f508773ce33e8p-14,0x1.c0cc46fcaa5bbp-14},
+        {628,-0x1.086b6395711dap-13,0x1.496fe7e4e2138p-14},
+        {629,-0x1.09d7504e2ffdfp-13,0x1.ad6382ddae283p-15},
+        {630,-0x1.0047c66a995fp-13,0x1.b5efd0a449f3p-16},
+        {631,-0x1.db5c8fdf289d7p-14,0x1.1a4e049aa1cbcp-18},
+        {632,-0x1.a88752eac4aacp-14,-0x1.d195e7a447882p-17},
+        {633,-0x1.6cb9266b8a368p-14,-0x1.d2a5b8ea157c9p-16},
+        {634,-0x1.2c8072c89d631p-14,-0x1.3b1f5a274fe56p-15},
+        {635,-0x1.d810b505bc0ffp-15,-0x1.6b8d0169cfd86p-15},
+        {636,-0x1.5dbe2248dd585p-15,-0x1.7e1cc9be96987p-15},
+        {637,-0x1.df37841676dd4p-16,-0x1.7797605cf79f2p-15},
+        {638,-0x1.2310b62b6047p-16,-0x1.5d8c2f7ae216ap-15},
+        {639,-0x1.16a8bc5980b96p-17,-0x1.35d1a761cd2fp-15},
+        {640,-0x1.917abab9c988fp-20,-0x1.0610b0018e4c4p-15},
+        {641,0x1.aab7402854378p-19,-0x1.a6c68f79733c9p-16},
+        {642,0x1.8f5eca97275d5p-18,-0x1.4417d3a627416p-16},
+        {643,0x1.df2febae4b3ecp-18,-0x1.d52298143787p-17},
+        {644,0x1.dd8dea5d5d6a8p-18,-0x1.3d087f1a3ee33p-17},
+        {645,0x1.a3d43ab83306ep-18,-0x1.88a1a8286a2bap-18},
+        {646,0x1.49be49bb7f32bp-18,-0x1.aec0842558f2ap-19},
+        {647,0x1.c7613fd292de7p-19,-0x1.86b7bd8def27fp-20},
+        {600,0x1.9b971462e46cep-19,0x1.3c3e5007d25d2p-20},
+        {601,0x1.3071d5b779f9ep-18,0x1.68080e97feca8p-19},
+        {602,0x1.8c33fcc2a7e8ep-18,0x1.4e872fcf678a6p-18},
+        {603,0x1.cfcda6daf6468p-18,0x1.11fcf1c138fc5p-17},
+        {604,0x1.e6bee7f98026ap-18,0x1.9a782b75d4a61p-17},
+        {605,0x1.ba939a89d9e4bp-18,0x1.1efa05e5d958ap-16},
+        {606,0x1.349d897164ee4p-18,0x1.7b1572bcae3d8p-16},
+        {607,0x1.002454aa6b438p-20,0x1.dc8c0eb38f71p-16},
+        {608,-0x1.33d7e167521ffp-18,0x1.1e42e4cfcb6ccp-15},
+        {609,-0x1.989d5ab2ccaa6p-17,0x1.494531c0073f2p-15},
+        {610,-0x1.6e6d2f373bca4p-16,0x1.6a722d7dbdb1dp-15},
+        {611,-0x1.188ed4754fb8p-15,0x1.7c9763597fd4p-15},
+        {612,-0x1.87a3cef436dd3p-15,0x1.7a83c7b039ca6p-15},
+        {613,-0x1.0034d0942a8b8p-14,0x1.5f6dccad6ec26p-15},
+        {614,-0x1.3eb1f2b92d664p-14,0x1.275f8ac9d56f8p-15},
+        {615,-0x1.7be9b57739ef5p-14,0x1.9f41c4a0c8194p-16},
+        {616,-0x1.b4011646d5d84p-14,0x1.5c5b75b1fe3c8p-17},
+        {617,-0x1.e2d55dee6f026p-14,-0x1.05c14644b27d2p-17},
+        {618,-0x1.021d7563f281ep-13,-0x1.ee1912a9e08b2p-16},
+        {619,-0x1.0a21a737836c2p-13,-0x1.c4ac75f4d727cp-15},
+        {620,-0x1.07c30e1da883cp-13,-0x1.5195f9dec9496p-14},
+        {621,-0x1.f36736cfc3b15p-14,-0x1.c4c8cb649ebcep-14},
+        {622,-0x1.be553ebabe358p-14,-0x1.1b5c79c725dbfp-13},
+        {623,-0x1.6ffb039d406cap-14,-0x1.50dcf8c0eeea6p-13},
+        {624,-0x1.095f84d5a5932p-14,-0x1.7ffbe2aeb75fp-13},
+        {625,-0x1.19e23a845f5bcp-15,-0x1.a5e7359e2201ap-13},
+        {626,0x1.862a545f40a28p-22,-0x1.c011ee567d478p-13},
+        {627,0x1.3a071cd4782ep-15,-0x1.cc5f38e114072p-13},
+        {628,0x1.3f8484337e852p-14,-0x1.c948bbd4149ecp-13},
+        {629,0x1.e252bedb243e7p-14,-0x1.b5fd2451cb92cp-13},
+        {630,0x1.3f2f6ccf9d89fp-13,-0x1.92748d82b5aecp-13},
+        {631,0x1.865202d347f79p-13,-0x1.5f79056423cc2p-13},
+        {632,0x1.c34725606faadp-13,-0x1.1ea23e2eded1dp-13},
+        {633,0x1.f32e48e0612d8p-13,-0x1.a488c01c89e33p-14},
+        {634,0x1.09ddf5c33a39p-12,-0x1.f54b63b00a782p-15},
+        {635,0x1.11ae62d9594d6p-12,-0x1.19c72c34482b2p-16},
+        {636,0x1.10a711160855ap-12,0x1.c2ad8c434b9abp-16},
+        {637,0x1.06d4d62b9ecfap-12,0x1.232133df7f65p-14},
+        {638,0x1.e963e14cadb07p-13,0x1.c9a0a54d80607p-14},
+        {639,0x1.b63d3fb236f0ap-13,0x1.2ec1600d5b589p-13},
+        {640,0x1.76a73f17b36fap-13,0x1.6c92020bc1318p-13},
+        {641,0x1.2d9ef00db61p-13,0x1.9c177c6fb1487p-13},
+        {642,0x1.bcffb367c8508p-14,0x1.bbe89fa902b0ep-13},
+        {643,0x1.19a4552051f34p-14,0x1.cb6c07db83098p-13},
+        {644,0x1.e0bcbe196ca0cp-16,0x1.cad96a325d3b8p-13},
+        {645,-0x1.065b55b572be4p-17,0x1.bb2e32bf45c2p-13},
+        {646,-0x1.56fbf73dda72bp-15,0x1.9e1695cea3c76p-13},
+        {647,-0x1.2329cd89914f7p-14,0x1.75ccfd6611299p-13},
+        {648,-0x1.8453032ef205ep-14,0x1.44f257ffecb27p-13},
+        {649,-0x1.ccde35879ad09p-14,0x1.0e62358acff3ap-13},
+        {650,-0x1.fc16bef463a62p-14,0x1.aa0b9975a5f41p-14},
+        {651,-0x1.094f40ea35c5fp-13,0x1.3751e66fddc92p-14},
+        {652,-0x1.0924c33681049p-13,0x1.934f29d6be4c8p-15},
+        {653,-0x1.fde91b2d33512p-14,0x1.955b469a4a9d2p-16},
+        {654,-0x1.d90b1b47a9d8ap-14,0x1.b6c9a3e70e3aep-19},
+        {655,-0x1.a7b2929a8f4dap-14,-0x1.d7881b14bb081p-17},
+        {656,-0x1.6e0f1c0f464ebp-14,-0x1.cdaa7880dc96ep-16},
+        {657,-0x1.30381355817f9p-14,-0x1.371570b7328afp-15},
+        {658,-0x1.e3e01e1b6d18ap-15,-0x1.6824c97707b94p-15},
+        {659,-0x1.6ce84ec9a55bcp-15,-0x1.7d0def1fa0639p-15},
+        {660,-0x1.00b2cd1f0a1e2p-15,-0x1.7a0166900073dp-15},
+        {661,-0x1.45e5fdd62ef78p-16,-0x1.63ea33d64cc5ep-15},
+        {662,-0x1.5775376c9a33fp-17,-0x1.40026a3eebf0ap-15},
+        {663,-0x1.a3a8e6dc72afep-19,-0x1.136f88c2ea22bp-15},
+        {664,0x1.06d5bbd0b9019p-19,-0x1.c5da599636d24p-16},
+        {665,0x1.5cbbac51117cap-18,-0x1.6515ca353395cp-16},
+        {666,0x1.cbf71ab5092bfp-18,-0x1.0affe203a2d2p-16},
+        {667,0x1.e69176faf1e8cp-18,-0x1.7856b17b36f2dp-17},
+        {668,0x1.c3581751e9973p-18,-0x1.ed3be86375eeep-18},
+        {669,0x1.786ed4033b264p-18,-0x1.25ab8f6cf543dp-18},
+        {670,0x1.19aeb991e2c7dp-18,-0x1.30585507cc22ap-19},
+        {671,0x1.6ef6b6ad801dcp-19,-0x1.f3abcf8092d8ep-21},
+        {617,0x1.c038d5bdcf354p-19,0x1.78099c4ea9846p-20},
+        {618,0x1.3fd9f03ea66e5p-18,0x1.90deb034c39f3p-19},
+        {619,0x1.96cafc68c615p-18,0x1.6681b6a3e62dep-18},
+        {620,0x1.d497f3f10e57ap-18,0x1.1e513d4d5f2adp-17},
+        {621,0x1.e62355f78bfdep-18,0x1.a564094ff8d3cp-17},
+        {622,0x1.b6b22ec1fa9c5p-18,0x1.22d779493d504p-16},
+        {623,0x1.31743a7305dcdp-18,0x1.7c9e52ea8f35ap-16},
+        {624,0x1.0d5b64d79fa36p-20,0x1.db5ea5de7aad9p-16},
+        {625,-0x1.22fb77b580216p-18,0x1.1c6659f259b2ap-15},
+        {626,-0x1.858a8f863cff8p-17,0x1.4693c3c2d061cp-15},
+        {627,-0x1.5db8ffc91a43ap-16,0x1.67c6fb19d9aabp-15},
+        {628,-0x1.0be43356e3f74p-15,0x1.7b3c0f95e29fcp-15},
+        {629,-0x1.7647fc8a2a8e9p-15,0x1.7c281a4102f18p-15},
+        {630,-0x1.ea7f049b45998p-15,0x1.66111af0beac4p-15},
+        {631,-0x1.31d980c825376p-14,0x1.352bc4afc1439p-15},
+        {632,-0x1.6df1c84526f8p-14,0x1.cd715213c059cp-16},
+        {633,-0x1.a611b07be96e2p-14,0x1.e5667def1a9d2p-17},
+        {634,-0x1.d676a3f3ef2dcp-14,-0x1.2a7c420bcf1ffp-19},
+        {635,-0x1.fb46a84c72a3ep-14,-0x1.7652a2dd79b5ep-16},
+        {636,-0x1.086601cbc090ep-13,-0x1.7c1a7e598e8b7p-15},
+        {637,-0x1.09da2d4222f84p-13,-0x1.27c2def94f5dcp-14},
+        {638,-0x1.00a78dea0b409p-13,-0x1.96dd6bad8afep-14},
+        {639,-0x1.d7c6cff3a5513p-14,-0x1.0366774e2019p-13},
+        {640,-0x1.9650f85cad6bap-14,-0x1.393effc8aaa44p-13},
+        {641,-0x1.3d5094233fd82p-14,-0x1.6a4d46af0c848p-13},
+        {642,-0x1.9cd0331d48422p-15,-0x1.93e9b8480b81ep-13},
+        {643,-0x1.31e2d3fc1c0fcp-16,-0x1.b39730bc886c8p-13},
+        {644,0x1.11c8b4b3b288cp-16,-0x1.c729b19e20a0cp-13},
+        {645,0x1.be95623ab3102p-15,-0x1.ccea428a804abp-13},
+        {646,0x1.7e3a005a072b9p-14,-0x1.c3b58423ef315p-13},
+        {647,0x1.0d7432690654p-13,-0x1.ab12c1e6fb9fep-13},
+        {648,0x1.5767f84e8f06cp-13,-0x1.8341bf9108182p-13},
+        {649,0x1.99ca606e825fap-13,-0x1.4d3e1291d07cap-13},
+        {650,0x1.d1aeb374ddd6bp-13,-0x1.0ab78534ff2b4p-13},
+        {651,0x1.fc92f013a0124p-13,-0x1.7bff76f1d6c58p-14},
+        {652,0x1.0c41f1b669819p-12,-0x1.a7b82d5341fc3p-15},
+        {653,0x1.121cc26a34f7ep-12,-0x1.1bb25c9ff013ep-17},
+        {654,0x1.0f94dc5ca7cdp-12,0x1.1ca505336bfb4p-15},
+        {655,0x1.04c81eff06514p-12,0x1.3a8c6804dd3eap-14},
+        {656,0x1.e46b3f8efde11p-13,0x1.da8f9c7889cf1p-14},
+        {657,0x1.b16cc4533a522p-13,0x1.342b44fbe266ep-13},
+        {658,0x1.72e1f3a6fe105p-13,0x1.6f65ea5b853c5p-13},
+        {659,0x1.2b91ceb0a5abap-13,0x1.9d04d0cc40dd9p-13},
+        {660,0x1.bd2b159202caep-14,0x1.bbc332d4e0aacp-13},
+        {661,0x1.1e5a39db49ecap-14,0x1.cb1666df2ab5cp-13},
+        {662,0x1.024aebdb7d726p-15,0x1.cb2edc6619fcep-13},
+        {663,-0x1.45fcc3bcff022p-18,0x1.bcee5b9729407p-13},
+        {664,-0x1.399ff9bc5e6c4p-15,0x1.a1d4747140c13p-13},
+        {665,-0x1.13b31b744d63ep-14,0x1.7be2a9aa6cc76p-13},
+        {666,-0x1.75add2c1259b6p-14,0x1.4d7a6305dfa72p-13},
+        {667,-0x1.c09dbf886fe68p-14,0x1.193709c715dbfp-13},
+        {668,-0x1.f3a1fc8715bfep-14,0x1.c38db6b198bfcp-14},
+        {669,-0x1.0788346bba0f7p-13,0x1.5389f0d727ae6p-14},
+        {670,-0x1.0a2cb1575c14ap-13,0x1.ce5c0f0339f32p-15},
+        {671,-0x1.02ee64165db94p-13,0x1.054123beb34bap-15},
+        {672,-0x1.e6b3e7e745ce6p-14,0x1.49be8f4066edcp-17},
+        {673,-0x1.ba7495966ca5cp-14,-0x1.151055ae58d7ep-17},
+        {674,-0x1.84f1cdecf7164p-14,-0x1.7de860a6c2d07p-16},
+        {675,-0x1.49fe37145be72p-14,-0x1.199f99b5ea514p-15},
+        {676,-0x1.0d345fde4b38cp-14,-0x1.5603576850f3ap-15},
+        {677,-0x1.a38fe55ea039p-15,-0x1.765be846a8488p-15},
+        {678,-0x1.34c4664bf2104p-15,-0x1.7e14f620710dbp-15},
+        {679,-0x1.a42c892930a3ep-16,-0x1.716e6261ea586p-15},
+        {680,-0x1.f8fd0d24a05e4p-17,-0x1.551de57c210b4p-15},
+        {681,-0x1.d53f67f7dc3c1p-18,-0x1.2df41ab5080dfp-15},
+        {682,-0x1.e09b1a1c2eecfp-21,-0x1.008af6b3686f7p-15},
+        {683,0x1.c090cea702afap-19,-0x1.a204d0ca6fbcfp-16},
+        {684,0x1.8d1bdc360d6fap-18,-0x1.459cc3c2c5554p-16},
+        {685,0x1.dc3b8630333ep-18,-0x1.e25f94be59276p-17},
+        {686,0x1.e2019e6be3f46p-18,-0x1.50c44d3d91733p-17},
+        {687,0x1.b36548b59343p-18,-0x1.b4d61c92ed19bp-18},
+        {688,0x1.6451a22f1b699p-18,-0x1.00c79166e2362p-18},
+        {689,0x1.0655671725f83p-18,-0x1.052732b929439p-19},
+        {635,0x1.e8d12756de6c8p-19,0x1.c12dca69cafc2p-20},
+        {636,0x1.50c9e67bcc645p-18,0x1.c1b8364e56a7fp-19},
+        {637,0x1.a2596b0372903p-18,0x1.83273e55f5505p-18},
+        {638,0x1.d9a22836fb2c8p-18,0x1.2d513ff7f5936p-17},
+        {639,0x1.e4d73fdb7d296p-18,0x1.b3525618e8692p-17},
+        {640,0x1.b0e073f1579dep-18,0x1.285e772b2d62cp-16},
+        {641,0x1.2ab5a90c7f341p-18,0x1.7fef0377eb461p-16},
+        {642,0x1.03dde798f65edp-20,0x1.dc0232c44d462p-16},
+        {643,-0x1.1a54796f2711bp-18,0x1.1b64f66752c12p-15},
+        {644,-0x1.78016df20a45ap-17,0x1.4495d10d5031ap-15},
+        {645,-0x1.50883b704f9e2p-16,0x1.6584d4901050bp-15},
+        {646,-0x1.0152d34ed10cap-15,0x1.79d5b5541c088p-15},
+        {647,-0x1.6745f8c125cd3p-15,0x1.7d201b167d148p-15},
+        {648,-0x1.d7057bf522372p-15,0x1.6b3b095633fb8p-15},
+        {649,-0x1.2626b8f6c99d8p-14,0x1.408dd571093d2p-15},
+        {650,-0x1.60e4aa3250261p-14,0x1.f4c2c0a3015dbp-16},
+        {651,-0x1.98a28c9c0c94p-14,0x1.2e578e25ffb0bp-16},
+        {652,-0x1.c9f96fe29d1fcp-14,0x1.6d0a2fbd33db4p-19},
+        {653,-0x1.f1612a4ca20aep-14,-0x1.0a5f72d1b05cap-16},
+        {654,-0x1.05b15a6e6598ap-13,-0x1.399ed3ddd4952p-15},
+        {655,-0x1.0a672e1a1dcd9p-13,-0x1.00c803b6048c2p-14},
+        {656,-0x1.05793b4441bb4p-13,-0x1.6b3e0156ab71ep-14},
+        {657,-0x1.ebcf0b0ae04fp-14,-0x1.d83c0bbb11162p-14},
+        {658,-0x1.b642d13ef6a56p-14,-0x1.21a1f1669b7a7p-13},
+        {659,-0x1.6a2e2a81f3418p-14,-0x1.53c141960454bp-13},
+        {660,-0x1.0889341756281p-14,-0x1.800687ec14306p-13},
+        {661,-0x1.26d58c7017dd1p-15,-0x1.a411944661183p-13},
+        {662,-0x1.bfe33fe19f93cp-19,-0x1.bdb966ebe48cp-13},
+        {663,0x1.072454487fbaep-15,-0x1.cb2cd5c287c16p-13},
+        {664,0x1.1c4fab432fc91p-14,-0x1.cb0fd007ea3cap-13},
+        {665,0x1.b6a5f3e58c17ep-14,-0x1.bc934f84dda2ap-13},
+        {666,0x1.265509913bda6p-13,-0x1.9f864cf111937p-13},
+        {667,0x1.6c31cbb422fe4p-13,-0x1.745e730e1c014p-13},
+        {668,0x1.aa0cd3fd30e6ep-13,-0x1.3c37ca7a612a2p-13},
+        {669,0x1.dd4f5921d883ap-13,-0x1.f1964e0412c6fp-14},
+        {670,0x1.01e587a7861dbp-12,-0x1.58b76927c0f4bp-14},
+        {671,0x1.0debf31ee4dbfp-12,-0x1.66724e94f654p-15},
+        {672,0x1.12356aed31ea2p-12,-0x1.c7fc4401715bap-20},
+        {673,0x1.0e9227a2bd046p-12,0x1.4a79493784f66p-15},
+        {674,0x1.032ab5d78ca72p-12,0x1.4b81b2ff22d6ap-14},
+        {675,0x1.e0fb8621c588p-13,0x1.e5a10de313be8p-14},
+        {676,0x1.aeb2869f6ab7dp-13,0x1.3712689f1a1fcp-13},
+        {677,0x1.719eb96481e25p-13,0x1.703905c3b6dc6p-13},
+        {678,0x1.2c4f9288fd0d2p-13,0x1.9c7f5ab65e6f1p-13},
+        {679,0x1.c33a56e514eb4p-14,0x1.babbfe0a0f7p-13},
+        {680,0x1.29052a9f6e5cap-14,0x1.ca6b73aaa99p-13},
+        {681,0x1.1fdd147665299p-15,0x1.cbb1438e537a2p-13},
+        {682,-0x1.361fcf610c53cp-21,0x1.bf4fff095273cp-13},
+        {683,-0x1.1205cebadd0ccp-15,0x1.a698ef83fc8e8p-13},
+        {684,-0x1.ff358262b20eap-15,0x1.8354a9794f545p-13},
+        {685,-0x1.62f1b3e2256a8p-14,0x1.57a626c2fe69p-13},
+        {686,-0x1.b0d9841c941f8p-14,0x1.25ea54b3e2e96p-13},
+        {687,-0x1.e8428d38c0865p-14,0x1.e12c5233d00b6p-14},
+        {688,-0x1.049b08b01b0fcp-13,0x1.742aa69e7dc1bp-14},
+        {689,-0x1.0a60a958cc61cp-13,0x1.0956fa1c1938p-14},
+        {690,-0x1.0669c7d1d72e7p-13,0x1.4967353da986ap-15},
+        {691,-0x1.f411b76acd096p-14,0x1.26501eef6963ap-16},
+        {692,-0x1.cda32c4ba1498p-14,-0x1.5ff50fd605b4fp-20},
+        {693,-0x1.9cfb2af0dd3d6p-14,-0x1.1b6a27d4f6b46p-16},
+        {694,-0x1.65a26d4da90c6p-14,-0x1.e6a8f7232e614p-16},
+        {695,-0x1.2b04607ba74c4p-14,-0x1.3bd9da47529ccp-15},
+        {696,-0x1.e0859dea1b65ap-15,-0x1.68b340000f974p-15},
+        {697,-0x1.70247db57c84fp-15,-0x1.7c81c4134f956p-15},
+        {698,-0x1.0941094d4f6f2p-15,-0x1.7ace8cc6fc825p-15},
+        {699,-0x1.5e18f5089fc81p-16,-0x1.67b9d10cf3e18p-15},
+        {700,-0x1.8e18b5f0e175fp-17,-0x1.47a9a75a4f067p-15},
+        {701,-0x1.3c413ad625498p-18,-0x1.1efdfa0248f9ep-15},
+        {702,0x1.46d4703f69ebfp-21,-0x1.e39c4c91d9966p-16},
+        {703,0x1.1b76fc8577d74p-18,-0x1.87676a1f172b3p-16},
+        {704,0x1.a932d6dc7e65ep-18,-0x1.2f48b808a3a94p-16},
+        {705,0x1.e33718f9e97e2p-18,-0x1.bf709eeb27cbcp-17},
+        {706,0x1.dc79089201cd9p-18,-0x1.375db228dc60cp-17},
+        {707,0x1.a81da4ea240c8p-18,-0x1.92d7eae2b5dfep-18},
+        {708,0x1.5818567eab652p-18,-0x1.d88402bef63c1p-19},
+        {709,0x1.f82edee412868p-19,-0x1.df42b0c277f62p-20},
+        {653,0x1.5318698d5c898p-19,0x1.a3efe2bc514a2p-21},
+        {654,0x1.0288bde49f6c4p-18,0x1.f83201bd27d3fp-20},
+        {655,0x1.5b8234b347cfep-18,0x1.e2b3d58e1f59ap-19},
+        {656,0x1.a8bbd30a0b538p-18,0x1.940a8f623e773p-18},
+        {657,0x1.dbd2468574b6dp-18,0x1.34797a8c35931p-17},
+        {658,0x1.e45e66cb6ae12p-18,0x1.b795915833cb2p-17},
+        {659,0x1.b0e1ebc9ea6b2p-18,0x1.28519b9b605cap-16},
+        {660,0x1.2ff5b3c3b9367p-18,0x1.7d317505a5a94p-16},
+        {661,0x1.46ab11f6859e6p-20,0x1.d67630c22b0dbp-16},
+        {662,-0x1.eded48f17d808p-19,0x1.176f8dc7865fep-15},
+        {663,-0x1.5935b1851a522p-17,0x1.40008280838b4p-15},
+        {664,-0x1.38d272438040cp-16,0x1.6141b82883112p-15},
+        {665,-0x1.e142febfe03fdp-16,0x1.773be68723ab3p-15},
+        {666,-0x1.5165abd992e8ap-15,0x1.7de3c819323d4p-15},
+        {667,-0x1.bc16a05da2feap-15,0x1.715a01fe943dap-15},
+        {668,-0x1.1684182741285p-14,0x1.4e306ceeb29a1p-15},
+        {669,-0x1.4fca392eef374p-14,0x1.11b08e2d72b0ep-15},
+        {670,-0x1.8720b84c6591cp-14,0x1.743d317dcd10bp-16},
+        {671,-0x1.b97c41d1c649ep-14,0x1.1bd095c91d338p-17},
+        {672,-0x1.e3a6afaeda8b8p-14,-0x1.1bc8106cea3dap-17},
+        {673,-0x1.01346752d00f2p-13,-0x1.da6e6d1098a39p-16},
+        {674,-0x1.095c1ee4bd854p-13,-0x1.a7f686db6eef3p-15},
+        {675,-0x1.08f36b0be7208p-13,-0x1.38e8813fe0d5dp-14},
+        {676,-0x1.fdd0c0f6ef83fp-14,-0x1.a209a5abb86eap-14},
+        {677,-0x1.d5064b08ee519p-14,-0x1.05bc7e4316492p-13},
+        {678,-0x1.96ee990e7bb13p-14,-0x1.3876a6f0598e4p-13},
+        {679,-0x1.43e0af3693edfp-14,-0x1.66f57278f72bp-13},
+        {680,-0x1.ba616a6fe377p-15,-0x1.8efd56e1c93b4p-13},
+        {681,-0x1.94c0120e2960bp-16,-0x1.ae723c729a1cdp-13},
+        {682,0x1.07057e6437c3ap-17,-0x1.c3748f2d9867fp-13},
+        {683,0x1.61d9e8106e484p-15,-0x1.cc7c8b2dfe347p-13},
+        {684,0x1.4634eda832102p-14,-0x1.c87219a176751p-13},
+        {685,0x1.db80a36ec3568p-14,-0x1.b6bfba60d0b06p-13},
+        {686,0x1.35add3960057cp-13,-0x1.975f369e0cd68p-13},
+        {687,0x1.782aff3f59951p-13,-0x1.6adf300ef6758p-13},
+        {688,0x1.b2a360b3437c6p-13,-0x1.32610829a45abp-13},
+        {689,0x1.e2c65b10828eep-13,-0x1.df1e1bcd08b06p-14},
+        {690,0x1.03524f6ea2473p-12,-0x1.4916ad49ba614p-14},
+        {691,0x1.0e648b063d2fep-12,-0x1.4f60621f12321p-15},
+        {692,0x1.1225e94903ca4p-12,-0x1.d6131f44befep-24},
+        {693,0x1.0e6ef1d4a4024p-12,0x1.4d927e9ea55d8p-15},
+        {694,0x1.0366afcff2422p-12,0x1.483bd248597c4p-14},
+        {695,0x1.e30165361967p-13,0x1.de56c71cf554fp-14},
+        {696,0x1.b2ee50dadd337p-13,0x1.320a65b2db0c7p-13},
+        {697,0x1.7882d75471cbap-13,0x1.6a984210e5d6cp-13},
+        {698,0x1.360f212983bc5p-13,0x1.9729f4c9453c8p-13},
+        {699,0x1.dc4eb31cb8aap-14,0x1.b69d547a8149p-13},
+        {700,0x1.4706c65a77c6cp-14,0x1.c862ef1ea777fp-13},
+        {701,0x1.637623df506bap-15,0x1.cc802da91ba6cp-13},
+        {702,0x1.0d20751a3f716p-17,0x1.c389cf4c51817p-13},
+        {703,-0x1.91f66d10d9e7ep-16,0x1.ae974037613e2p-13},
+        {704,-0x1.b928d38a1d2c6p-15,0x1.8f2fb7dd45021p-13},
+        {705,-0x1.435e6b999c912p-14,0x1.673261e4cfee1p-13},
+        {706,-0x1.9688ec01da005p-14,0x1.38bb157447bd2p-13},
+        {707,-0x1.d4be5e5916ac2p-14,0x1.06054502bf09p-13},
+        {708,-0x1.fda66304d2887p-14,0x1.a29db6d609aa8p-14},
+        {709,-0x1.08ec4a7c984p-13,0x1.3979539e9d184p-14},
+        {710,-0x1.0961c8c3be118p-13,0x1.a9077be8c5454p-15},
+        {711,-0x1.014527a84efb2p-13,0x1.dc5e0050c4643p-16},
+        {712,-0x1.e3da53743670ap-14,0x1.1f28872bf96fcp-17},
+        {713,-0x1.b9bd9efa7e041p-14,-0x1.190052e1d8dabp-17},
+        {714,-0x1.876b470c8f56ep-14,-0x1.7321a56013014p-16},
+        {715,-0x1.50199172a0bf9p-14,-0x1.114947a41b698p-15},
+        {716,-0x1.16d42809642fap-14,-0x1.4dee06c7bfacp-15},
+        {717,-0x1.bcb110ec76948p-15,-0x1.71395318a718p-15},
+        {718,-0x1.51f4957a40e98p-15,-0x1.7de076401abb6p-15},
+        {719,-0x1.e240f1f9b1b46p-16,-0x1.7750c79a17554p-15},
+        {720,-0x1.39aaad3fc3d32p-16,-0x1.616934c98a954p-15},
+        {721,-0x1.5a94d3d303d17p-17,-0x1.4034f40dcf24ap-15},
+        {722,-0x1.f22240a5001eep-19,-0x1.17ab92353e1b6p-15},
+        {723,0x1.40b02aae6bb08p-20,-0x1.d6f3af5cb3432p-16},
+        {724,0x1.2f036a3b1ccd9p-18,-0x1.7dac35ba57f95p-16},
+        {725,0x1.b0678980cecp-18,-0x1.28c329ce20893p-16},
+        {726,0x1.e4444c4858d68p-18,-0x1.b85d177a3994dp-17},
+        {727,0x1.dbffc5a6fccdep-18,-0x1.351fe49af235cp-17},
+        {728,0x1.a918fd2f4ea1ep-18,-0x1.9510e381c6e4dp-18},
+        {729,0x1.5bf9564168a2ep-18,-0x1.e4368e8ce12acp-19},
+        {730,0x1.030776d044efp-18,-0x1.fa3c1e40a4866p-20},
+        {731,0x1.54084db4fb04ap-19,-0x1.a658843a55429p-21},
+    };
+
+    const BakedKernel BAKED_KERNELS[] = {
+        {44100,0x1.05a3d70a3d70ap+6,0x1.05ap+10,24,0x1.61e4f765fd8aep-8,32768,96,ROW_STARTS_0,ENTRIES_0},
+        {48000,0x1.05a3d70a3d70ap+6,0x1.05ap+10,24,0x1.61e4f765fd8aep-8,32768,96,ROW_STARTS_1,ENTRIES_1},
+        {2940,0x1.05a3d70a3d70ap+6,0x1.05ap+10,24,0x1.61e4f765fd8aep-8,2048,96,ROW_STARTS_2,ENTRIES_2},
+        {3000,0x1.05a3d70a3d70ap+6,0x1.05ap+10,24,0x1.61e4f765fd8aep-8,2048,96,ROW_STARTS_3,ENTRIES_3},
+    };
+
+    const int TOTAL_BAKED_KERNELS = 4;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+namespace constantq {
+    /**
+     * a kernel entry stored as plain data so it can be baked into the binary
+     */
+    struct BakedKernelEntry {
+        int fftIndex;
+        double real;
+        double imag;
+    };
+
+    /**
+     * a sparse kernel generated at build time (see tools/BakeKernels.cpp) for a common configuration
+     */
+    struct BakedKernel {
+        // the parameters the kernel was generated with
+        int fs;
+        double minFreq;
+        double maxFreq;
+        int bins;
+        double thresh;
+
+        // the fft size
+        int size;
+        // the number of bins in the kernel (as opposed to bins per octave)
+        int totalBins;
+        // the index into entries where each bin starts (totalBins + 1 items)
+        const int* rowStarts;
+        const BakedKernelEntry* entries;
+    };
+
+    // the kernels baked into the binary (defined in the generated BakedKernels.cpp)
+    extern const BakedKernel BAKED_KERNELS[];
+    extern const int TOTAL_BAKED_KERNELS;
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include <vector>
+#include <utility>
+#include "MemoryTracker.hpp"
+
+namespace constantq {
+    // the default number of released buffers retained for reuse
+    const size_t DEFAULT_POOLED_BUFFERS = 4;
+
+    /**
+     * retains released buffers so repeated analyses reuse memory instead of growing the heap
+     */
+    template<typename T, int CATEGORY>
+    class BufferPool {
+        public:
+            typedef std::vector<T, TrackedAllocator<T, CATEGORY> > Buffer;
+
+        private:
+            std::vector<Buffer> _free;
+            size_t _maxRetained;
+
+        public:
+            /**
+             * @param maxRetained   the maximum number of released buffers to retain
+             */
+            BufferPool(size_t maxRetained = DEFAULT_POOLED_BUFFERS) : _maxRetained(maxRetained) { }
+
+            /**
+             * @param size      the number of items required
+             * @returns         a buffer of the given size (contents unspecified),
+             *                  reusing the smallest retained buffer that fits if one exists
+             */
+            Buffer acquire(size_t size) {
+                int best = -1;
+                for (int i = 0; i < (int) _free.size(); i++) {
+                    auto capacity = _free[i].capacity();
+                    bool fits = capacity >= size;
+                    bool bestFits = best >= 0 && _free[best].capacity() >= size;
+
+                    // prefer the smallest buffer that fits otherwise the largest that does not
+                    if (best < 0 ||
+                        (fits && (!bestFits || capacity < _free[best].capacity())) ||
+                        (!fits && !bestFits && capacity > _free[best].capacity()))
+                        best = i;
+                }
+
+                Buffer toRet;
+                if (best >= 0) {
+                    toRet = std::move(_free[best]);
+                    _free.erase(_free.begin() + best);
+                }
+
+                toRet.resize(size);
+                return toRet;
+            }
+
+            /**
+             * returns a buffer for reuse (it is freed if the pool is full)
+             */
+            void release(Buffer&& buffer) {
+                if (_free.size() < _maxRetained)
+                    _free.push_back(std::move(buffer));
+            }
+
+            /**
+             * frees all retained buffers
+             */
+            void clear() {
+                _free.clear();
+            }
+
+            /**
+             * @returns the number of retained buffers
+             */
+            size_t retained() const { return _free.size(); }
+    };
+}
@@ -3,11 +3,13 @@
 #include <vector>
 #include <cmath>
 #include <iostream>
+#include <cassert>
 
 #include "ConstantQ.hpp"
 #include "KernelEntry.hpp"
 #include "SparseKernel.hpp"
 #include "MathUtil.hpp"
+#include "Profiler.hpp"
 
 
 using namespace std;
@@ -16,6 +18,8 @@ namespace constantq {
     SparseKernel ConstantQ::sparseKernel(
         int fs, double minFreq, double maxFreq, int bins, double thresh) {
 
+        ProfileTimer timer(STAGE_KERNEL_BUILD);
+
         double Q = 1. / (pow(2, 1./bins) - 1);
         double K = ceil(bins * log2(maxFreq / minFreq));
         double fftLen = floor(pow(2, MathUtil::nextPow2(ceil(ceil(Q * fs / minFreq)))));
@@ -24,10 +28,11 @@ namespace constantq {
         // holds values of intermediate processing             
         vector<complex<double> > tempKernel(fftLen, 0);
 
-        // the matrix to return as the information holder for the sparse kernel
-        vector<vector<KernelEntry> > retMatrix(K);
+        // the kernel entries for all bins stored contiguously with where each bin starts
+        KernelVector<KernelEntry> entries;
+        KernelVector<int> rowStarts(1, 0);
 
-        for (auto k = K; k >= 1; k--) {
+        for (double k = 1; k <= K; k++) {
             double len = ceil((Q * fs) / (minFreq * pow(2, ((k - 1) / bins))));
 
             auto hamming = MathUtil::hamming(len);
@@ -44,39 +49,47 @@ namespace constantq {
 
             int tempKernelSize = tempKernel.size();
             MathUtil::fft(tempKernel, tempKernelSize);
-            vector<KernelEntry> newItems;
             // create an entry only if item is over threshold
             for (auto j = 0; j < tempKernelSize; j++) {
                 if (abs(tempKernel[j]) > thresh) {
                     // apply conjugate & divide by fftlen
-                    newItems.push_back(KernelEntry(j, conj(tempKernel[j]) / fftLen));
+                    entries.push_back(KernelEntry(j, conj(tempKernel[j]) / fftLen));
                 }
             }
 
-            retMatrix[k - 1] = newItems;
+            rowStarts.push_back(entries.size());
         }
 
-        return SparseKernel(retMatrix, fftLen, K);
+        return SparseKernel(move(entries), move(rowStarts), fftLen, K);
     }
 
 
     void ConstantQ::constantQ(
         vector<complex<double> >& arr, 
         vector<complex<double> >& analyzed, 
-        SparseKernel sparKernel) {
+        const SparseKernel& sparKernel) {
 
         assert(arr.size() >= sparKernel.size());
         MathUtil::fft(arr, sparKernel.size());
+        applyKernel(&arr[0], &analyzed[0], sparKernel);
+    }
+
 
-        auto binSize = sparKernel.bins();
-        for (int b = 0; b < binSize; b ++) {
+    void ConstantQ::applyKernel(
+        const complex<double>* arr, 
+        complex<double>* analyzed, 
+        const SparseKernel& sparKernel,
+        int firstBin, int endBin) {
+
+        auto binSize = endBin < 0 ? sparKernel.bins() : endBin;
+        for (int b = firstBin; b < binSize; b ++) {
             complex<double> tot = 0;
 
-            auto sparKernelItem = sparKernel.matrix()[b];
-            auto sparKernelSize = sparKernelItem.size();
+            auto sparKernelItem = sparKernel.row(b);
+            auto sparKernelSize = sparKernel.rowSize(b);
 
             for (int e = 0; e < sparKernelSize; e++) {
-                auto entr = sparKernelItem[e];
+                auto& entr = sparKernelItem[e];
                 complex<double> multiplier = arr[entr.fftIndex()] * entr.multiplier();
                 tot += multiplier;
             }
@@ -84,4 +97,109 @@ namespace constantq {
             analyzed[b] = tot;
         }
     }
-}
\ No newline at end of file
+
+
+    void ConstantQ::applyKernel(
+        const complex<float>* arr, 
+        complex<float>* analyzed, 
+        const SparseKernel& sparKernel,
+        int firstBin, int endBin) {
+
+        auto binSize = endBin < 0 ? sparKernel.bins() : endBin;
+        for (int b = firstBin; b < binSize; b ++) {
+            complex<float> tot = 0;
+
+            auto sparKernelItem = sparKernel.row(b);
+            auto sparKernelSize = sparKernel.rowSize(b);
+
+            for (int e = 0; e < sparKernelSize; e++) {
+                auto& entr = sparKernelItem[e];
+                tot += arr[entr.fftIndex()] * complex<float>(entr.multiplier());
+            }
+
+            analyzed[b] = tot;
+        }
+    }
+
+
+    /**
+     * applies the kernel to a packed fft for each precision (see applyKernelPair)
+     * @param arr           the fft of the packed amplitude data
+     * @param first         the results for the real part
+     * @param second        the results for the imaginary part
+     * @param sparKernel    the sparse kernel to utilize
+     * @param firstBin      the first bin applied
+     * @param endBin        one past the last bin applied (-1 for the kernel's bins)
+     */
+    template <typename T>
+    void applyKernelPairInPlace(const complex<T>* arr, complex<T>* first, complex<T>* second, 
+        const SparseKernel& sparKernel, int firstBin, int endBin) {
+
+        // indices wrap so the mirror of index 0 is itself
+        int mask = sparKernel.size() - 1;
+        auto binSize = endBin < 0 ? sparKernel.bins() : endBin;
+        for (int b = firstBin; b < binSize; b ++) {
+            complex<T> sum = 0;
+            complex<T> difference = 0;
+
+            auto sparKernelItem = sparKernel.row(b);
+            auto sparKernelSize = sparKernel.rowSize(b);
+
+            // the halves are applied after accumulating so each entry costs two multiplies
+            for (int e = 0; e < sparKernelSize; e++) {
+                auto& entr = sparKernelItem[e];
+                int index = entr.fftIndex();
+                complex<T> value = arr[index];
+                complex<T> mirror = conj(arr[(-index) & mask]);
+                complex<T> multiplier(entr.multiplier());
+                sum += (value + mirror) * multiplier;
+                difference += (value - mirror) * multiplier;
+            }
+
+            first[b] = sum * (T) .5;
+            second[b] = complex<T>(difference.imag(), -difference.real()) * (T) .5;
+        }
+    }
+
+    void ConstantQ::applyKernelPair(
+        const complex<double>* arr, 
+        complex<double>* first, 
+        complex<double>* second, 
+        const SparseKernel& sparKernel,
+        int firstBin, int endBin) {
+
+        applyKernelPairInPlace(arr, first, second, sparKernel, firstBin, endBin);
+    }
+
+    void ConstantQ::applyKernelPair(
+        const complex<float>* arr, 
+        complex<float>* first, 
+        complex<float>* second, 
+        const SparseKernel& sparKernel,
+        int firstBin, int endBin) {
+
+        applyKernelPairInPlace(arr, first, second, sparKernel, firstBin, endBin);
+    }
+
+
+    void ConstantQ::directConstantQ(const double* data, int fs, double minFreq, double maxFreq, int bins, 
+        double* toRet) {
+
+        // the same windows as the temporal kernels of sparseKernel
+        double Q = 1. / (pow(2, 1./bins) - 1);
+        double K = ceil(bins * log2(maxFreq / minFreq));
+
+        for (double k = 1; k <= K; k++) {
+            double len = ceil((Q * fs) / (minFreq * pow(2, ((k - 1) / bins))));
+
+            auto hamming = MathUtil::hamming(len);
+            complex<double> tot = 0;
+            for (int j = 0; j < len; j++) {
+                double expMultiplier = 2. * M_PI * Q * j / len;
+                tot += data[j] * conj(hamming[j] / len * MathUtil::eulers(expMultiplier));
+            }
+
+            toRet[(int) k - 1] = abs(tot);
+        }
+    }
+}
@@ -33,6 +33,80 @@ namespace constantq {
             static void constantQ(
                 std::vector<std::complex<double> >& arr, 
                 std::vector<std::complex<double> >& analyzed, 
-                SparseKernel sparKernel);
+                const SparseKernel& sparKernel);
+
+            /**
+             * applies the sparse kernel to fft data (the second half of constantQ)
+             * @param arr           the fft of the amplitude data
+             * @param analyzed      the array that will contain results (must be sparKernel bin size)
+             * @param sparKernel    the sparse kernel to utilize
+             * @param firstBin      the first bin applied
+             * @param endBin        one past the last bin applied (-1 for the kernel's bins); only the bins applied 
+             *                      are written (at their index)
+             */
+            static void applyKernel(
+                const std::complex<double>* arr, 
+                std::complex<double>* analyzed, 
+                const SparseKernel& sparKernel,
+                int firstBin = 0, int endBin = -1);
+
+            /**
+             * applies the sparse kernel to single precision fft data accumulating in single precision
+             * @param arr           the fft of the amplitude data
+             * @param analyzed      the array that will contain results (must be sparKernel bin size)
+             * @param sparKernel    the sparse kernel to utilize
+             * @param firstBin      the first bin applied
+             * @param endBin        one past the last bin applied (-1 for the kernel's bins); only the bins applied 
+             *                      are written (at their index)
+             */
+            static void applyKernel(
+                const std::complex<float>* arr, 
+                std::complex<float>* analyzed, 
+                const SparseKernel& sparKernel,
+                int firstBin = 0, int endBin = -1);
+
+            /**
+             * applies the sparse kernel to the fft of two real signals packed as the real and imaginary parts 
+             * of one complex signal, separating each signal's spectrum at the kernel's fft indices by conjugate
+             * symmetry (X[k] = (Z[k] + conj(Z[n - k])) / 2 and Y[k] = (Z[k] - conj(Z[n - k])) / 2i)
+             * @param arr           the fft of the packed amplitude data
+             * @param first         the array that will contain results for the real part (must be sparKernel bin size)
+             * @param second        the array that will contain results for the imaginary part
+             * @param sparKernel    the sparse kernel to utilize
+             * @param firstBin      the first bin applied
+             * @param endBin        one past the last bin applied (-1 for the kernel's bins); only the bins applied 
+             *                      are written (at their index)
+             */
+            static void applyKernelPair(
+                const std::complex<double>* arr, 
+                std::complex<double>* first, 
+                std::complex<double>* second, 
+                const SparseKernel& sparKernel,
+                int firstBin = 0, int endBin = -1);
+
+            /**
+             * applyKernelPair for single precision fft data accumulating in single precision
+             */
+            static void applyKernelPair(
+                const std::complex<float>* arr, 
+                std::complex<float>* first, 
+                std::complex<float>* second, 
+                const SparseKernel& sparKernel,
+                int firstBin = 0, int endBin = -1);
+
+            /**
+             * directly evaluates the constant q transform of one frame in the time domain without an fft 
+             * or a threshold (a reference for measuring the accuracy of the sparse kernel analysis)
+             * 
+             * @param data      the pcm audio data starting at the frame (must have the longest window's items)
+             * @param fs        frames per second
+             * @param minFreq   the minimum frequency to use
+             * @param maxFreq   the maximum frequency to use
+             * @param bins      the number of bins per octave
+             * @param toRet     the array to hold the magnitude of each bin
+             *                  (must have as many items as the sparse kernel has bins)
+             */
+            static void directConstantQ(const double* data, int fs, double minFreq, double maxFreq, int bins,
+                double* toRet);
     };
 }
\ No newline at end of file
@@ -0,0 +1,238 @@
+#include <vector>
+#include <memory>
+#include <new>
+#include "ConstantQApi.h"
+#include "ConstantQSession.hpp"
+#include "FingerprintIndex.hpp"
+
+using namespace std;
+using namespace constantq;
+
+struct CqSession {
+    unique_ptr<ConstantQSession> session;
+
+    // single precision audio converted for cqAnalyzeFloat
+    vector<double> converted;
+};
+
+struct CqIndex {
+    FingerprintIndex index;
+};
+
+namespace {
+    /**
+     * @returns whether the analysis arguments are within the data and session
+     */
+    bool validAnalysis(const CqSession* session, const void* data, int dataSize, int startFrame, 
+        int frameInterval, int totalAnalyses, const double* toRet) {
+
+        if (!session || !data || !toRet || startFrame < 0 || frameInterval <= 0 || totalAnalyses < 0)
+            return false;
+
+        return totalAnalyses <= cqFrameCount(session, dataSize, startFrame, frameInterval);
+    }
+}
+
+extern "C" {
+    int cqApiVersion(void) { return CQ_API_VERSION; }
+
+    CqSession* cqCreateSession(int fs, double minFreq, double maxFreq, int bins, double thresh,
+        int outputs, int decimate, int accuracy) {
+
+        if (fs <= 0 || minFreq <= 0 || maxFreq <= minFreq || maxFreq > fs / 2. || bins <= 0 || thresh < 0)
+            return nullptr;
+
+        int allOutputs = OUTPUT_BINS | OUTPUT_NOTES | OUTPUT_CHROMA | OUTPUT_ONSETS | OUTPUT_SKIPPED;
+        if (outputs <= 0 || (outputs & ~allOutputs) || accuracy < ACCURACY_EXACT || accuracy > ACCURACY_FIXED)
+            return nullptr;
+
+        try {
+            unique_ptr<CqSession> toRet(new CqSession());
+            toRet->session.reset(new ConstantQSession(fs, minFreq, maxFreq, bins, thresh, outputs, 
+                decimate != 0, accuracy));
+            return toRet.release();
+        }
+        catch (const bad_alloc&) {
+            return nullptr;
+        }
+    }
+
+    void cqDestroySession(CqSession* session) { delete session; }
+
+    int cqBins(const CqSession* session) { return session ? session->session->bins() : CQ_ERROR; }
+
+    int cqSize(const CqSession* session) { return session ? session->session->size() : CQ_ERROR; }
+
+    int cqFrameSize(const CqSession* session) { return session ? session->session->frameSize() : CQ_ERROR; }
+
+    int cqFrameCount(const CqSession* session, int dataSize, int startFrame, int frameInterval) {
+        if (!session || startFrame < 0 || frameInterval <= 0)
+            return CQ_ERROR;
+
+        int available = dataSize - startFrame - session->session->size();
+        return available < 0 ? 0 : available / frameInterval + 1;
+    }
+
+    int cqChromaOffset(const CqSession* session) {
+        int offset = session ? session->session->chromaOffset() : -1;
+        return offset < 0 ? CQ_ERROR : offset;
+    }
+
+    int cqBinForFrequency(const CqSession* session, double frequency) {
+        if (!session || !(frequency > 0))
+            return CQ_ERROR;
+
+        return session->session->binForFrequency(frequency);
+    }
+
+    int cqAnalyze(CqSession* session, const double* data, int dataSize, int startFrame, int frameInterval,
+        int totalAnalyses, double* toRet) {
+
+        if (!validAnalysis(session, data, dataSize, startFrame, frameInterval, totalAnalyses, toRet))
+            return CQ_ERROR;
+
+        if (totalAnalyses == 0)
+            return 0;
+
+        return session->session->analyzeInto(data, dataSize, startFrame, frameInterval, totalAnalyses, toRet);
+    }
+
+    int cqAnalyzeFloat(CqSession* session, const float* data, int dataSize, int startFrame, int frameInterval,
+        int totalAnalyses, double* toRet) {
+
+        if (!validAnalysis(session, data, dataSize, startFrame, frameInterval, totalAnalyses, toRet))
+            return CQ_ERROR;
+
+        if (totalAnalyses == 0)
+            return 0;
+
+        // only the span of the analysis is converted
+        int spanSize = session->session->size() + frameInterval * (totalAnalyses - 1);
+        try {
+            session->converted.assign(data + startFrame, data + startFrame + spanSize);
+        }
+        catch (const bad_alloc&) {
+            return CQ_ERROR;
+        }
+
+        return session->session->analyzeInto(&session->converted[0], spanSize, 0, frameInterval, 
+            totalAnalyses, toRet);
+    }
+
+    int cqAnalyzeInt16(CqSession* session, const int16_t* data, int dataSize, int startFrame, int frameInterval,
+        int totalAnalyses, double* toRet) {
+
+        if (!validAnalysis(session, data, dataSize, startFrame, frameInterval, totalAnalyses, toRet))
+            return CQ_ERROR;
+
+        if (totalAnalyses == 0)
+            return 0;
+
+        try {
+            return session->session->analyzeInt16Into(data, dataSize, startFrame, frameInterval, totalAnalyses, 
+                toRet);
+        }
+        catch (const bad_alloc&) {
+            return CQ_ERROR;
+        }
+    }
+
+    int cqAnalyzeStereo(CqSession* session, const double* left, const double* right, int dataSize, int startFrame,
+        int frameInterval, int totalAnalyses, double* toRet) {
+
+        if (!right || !validAnalysis(session, left, dataSize, startFrame, frameInterval, totalAnalyses, toRet))
+            return CQ_ERROR;
+
+        if (totalAnalyses == 0)
+            return 0;
+
+        return session->session->analyzeStereoInto(left, right, dataSize, startFrame, frameInterval, 
+            totalAnalyses, toRet);
+    }
+
+    int cqAnalyzeRegion(CqSession* session, const double* data, int dataSize, int startFrame, int frameInterval,
+        int totalAnalyses, int firstBin, int endBin, double* toRet) {
+
+        if (!validAnalysis(session, data, dataSize, startFrame, frameInterval, totalAnalyses, toRet))
+            return CQ_ERROR;
+
+        if (firstBin < 0 || endBin <= firstBin || endBin > session->session->bins())
+            return CQ_ERROR;
+
+        if (totalAnalyses == 0)
+            return 0;
+
+        return session->session->analyzeRegionInto(data, dataSize, startFrame, frameInterval, totalAnalyses,
+            firstBin, endBin, toRet);
+    }
+
+    CqIndex* cqCreateIndex(void) { return new (nothrow) CqIndex(); }
+
+    CqIndex* cqLoadIndex(const char* path) {
+        if (!path)
+            return nullptr;
+
+        try {
+            unique_ptr<CqIndex> toRet(new CqIndex());
+            return toRet->index.load(path) ? toRet.release() : nullptr;
+        }
+        catch (const bad_alloc&) {
+            return nullptr;
+        }
+    }
+
+    void cqDestroyIndex(CqIndex* index) { delete index; }
+
+    int cqSaveIndex(CqIndex* index, const char* path) {
+        if (!index || !path)
+            return CQ_ERROR;
+
+        try {
+            return index->index.save(path) ? 0 : CQ_ERROR;
+        }
+        catch (const bad_alloc&) {
+            return CQ_ERROR;
+        }
+    }
+
+    int cqIndexAddTrack(CqIndex* index, int track, const double* chroma, int totalFrames, int stride) {
+        if (!index || (!chroma && totalFrames > 0) || totalFrames < 0 || stride < CHROMA_SIZE)
+            return CQ_ERROR;
+
+        try {
+            return index->index.addTrack(track, chroma, totalFrames, stride);
+        }
+        catch (const bad_alloc&) {
+            // the track is left out rather than partially indexed
+            index->index.removeTrack(track);
+            return CQ_ERROR;
+        }
+    }
+
+    int cqIndexRemoveTrack(CqIndex* index, int track) {
+        return index ? (index->index.removeTrack(track) ? 1 : 0) : CQ_ERROR;
+    }
+
+    int cqIndexTracks(const CqIndex* index) { return index ? index->index.totalTracks() : CQ_ERROR; }
+
+    int cqIndexQuery(const CqIndex* index, const double* chroma, int totalFrames, int stride, int k,
+        int* tracks, double* scores) {
+
+        if (!index || (!chroma && totalFrames > 0) || totalFrames < 0 || stride < CHROMA_SIZE || k < 0 ||
+                (k > 0 && (!tracks || !scores)))
+            return CQ_ERROR;
+
+        try {
+            auto found = index->index.query(chroma, totalFrames, stride, k);
+            for (int i = 0; i < found.size(); i++) {
+                tracks[i] = found[i].track;
+                scores[i] = found[i].score;
+            }
+
+            return found.size();
+        }
+        catch (const bad_alloc&) {
+            return CQ_ERROR;
+        }
+    }
+}
@@ -0,0 +1,231 @@
+#pragma once
+
+/**
+ * stable C interface to ConstantQSession for native callers (such as the python bindings in python/)
+ *
+ * sessions are opaque handles; frames are written to caller provided buffers laid out as
+ * [analysis][frame item] where the frame items are determined by the CQ_OUTPUT_ flags
+ * (see ConstantQSession.hpp). functions do not throw; errors are returned as CQ_ERROR or null.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// incremented when functions are added or their behavior changes
+#define CQ_API_VERSION 8
+
+// returned by functions on invalid arguments
+#define CQ_ERROR -1
+
+// the OUTPUT_ flags of ConstantQSession.hpp
+#define CQ_OUTPUT_BINS 1
+#define CQ_OUTPUT_NOTES 2
+#define CQ_OUTPUT_CHROMA 4
+#define CQ_OUTPUT_ONSETS 8
+#define CQ_OUTPUT_SKIP_SILENT 16
+#define CQ_OUTPUT_SKIP_REPEATED 32
+
+// the FRAME_ values of FrameGate.hpp (the skipped item of each frame with either skip flag)
+#define CQ_FRAME_ANALYZED 0
+#define CQ_FRAME_SILENT 1
+#define CQ_FRAME_REPEATED 2
+
+// the ACCURACY_ tiers of ConstantQSession.hpp
+#define CQ_ACCURACY_EXACT 0
+#define CQ_ACCURACY_FAST 1
+#define CQ_ACCURACY_DISPLAY 2
+#define CQ_ACCURACY_POWER 3
+#define CQ_ACCURACY_FIXED 4
+
+typedef struct CqSession CqSession;
+
+typedef struct CqIndex CqIndex;
+
+/**
+ * @returns the CQ_API_VERSION the library was built with
+ */
+int cqApiVersion(void);
+
+/**
+ * @param fs        the frames per second (44100 for 44.1 kHz)
+ * @param minFreq   minimum frequency for analysis (in Hz)
+ * @param maxFreq   maximum frequency for analysis (in Hz)
+ * @param bins      bins per octave
+ * @param thresh    the sparse kernel threshold
+ * @param outputs   the CQ_OUTPUT_ flags determining what is produced per frame
+ * @param decimate  non zero to decimate the audio to the lowest adequate rate before analysis
+ * @param accuracy  the CQ_ACCURACY_ tier
+ * @returns         the session to release with cqDestroySession or null if the arguments are invalid
+ */
+CqSession* cqCreateSession(int fs, double minFreq, double maxFreq, int bins, double thresh,
+    int outputs, int decimate, int accuracy);
+
+/**
+ * releases the session (null is ignored)
+ */
+void cqDestroySession(CqSession* session);
+
+/**
+ * @returns the number of constant q bins
+ */
+int cqBins(const CqSession* session);
+
+/**
+ * @returns the number of audio samples analyzed per frame
+ */
+int cqSize(const CqSession* session);
+
+/**
+ * @returns the number of items produced per analyzed frame
+ */
+int cqFrameSize(const CqSession* session);
+
+/**
+ * @param session       the session
+ * @param dataSize      the number of audio samples
+ * @param startFrame    the first sample analyzed
+ * @param frameInterval the samples between frames
+ * @returns             the number of frames the audio holds (0 if it is shorter than a frame)
+ */
+int cqFrameCount(const CqSession* session, int dataSize, int startFrame, int frameInterval);
+
+/**
+ * @returns the index of the chroma within each frame (CQ_ERROR without CQ_OUTPUT_CHROMA)
+ */
+int cqChromaOffset(const CqSession* session);
+
+/**
+ * @param session   the session
+ * @param frequency the frequency (in Hz)
+ * @returns         the bin nearest the frequency (clamped to the bins) or CQ_ERROR if the arguments are invalid
+ */
+int cqBinForFrequency(const CqSession* session, double frequency);
+
+/**
+ * analyzes mono audio into a caller provided buffer
+ * @param session       the session
+ * @param data          the pcm audio data
+ * @param dataSize      the number of items in data
+ * @param startFrame    the first sample analyzed
+ * @param frameInterval the samples between frames
+ * @param totalAnalyses the number of frames (at most cqFrameCount)
+ * @param toRet         the buffer to hold results (must have room for totalAnalyses * cqFrameSize items)
+ * @returns             the number of frames analyzed or CQ_ERROR if the arguments are invalid
+ */
+int cqAnalyze(CqSession* session, const double* data, int dataSize, int startFrame, int frameInterval,
+    int totalAnalyses, double* toRet);
+
+/**
+ * cqAnalyze for single precision audio (converted to double precision in a buffer held by the session)
+ */
+int cqAnalyzeFloat(CqSession* session, const float* data, int dataSize, int startFrame, int frameInterval,
+    int totalAnalyses, double* toRet);
+
+/**
+ * cqAnalyze for 16 bit pcm audio (read as sample / 32767); sessions with CQ_ACCURACY_FIXED load the samples
+ * straight into their fixed point fft, others convert the span to double precision in a buffer held by the session
+ */
+int cqAnalyzeInt16(CqSession* session, const int16_t* data, int dataSize, int startFrame, int frameInterval,
+    int totalAnalyses, double* toRet);
+
+/**
+ * analyzes the two channels of stereo audio separately with one fft per frame for both channels
+ * @param session       the session
+ * @param left          the pcm audio data of the left channel
+ * @param right         the pcm audio data of the right channel
+ * @param dataSize      the number of items in each channel
+ * @param startFrame    the first sample analyzed
+ * @param frameInterval the samples between frames
+ * @param totalAnalyses the number of frames (at most cqFrameCount)
+ * @param toRet         the buffer to hold results where each analysis is the left channel's frame followed by
+ *                      the right channel's (must have room for totalAnalyses * 2 * cqFrameSize items)
+ * @returns             the number of analyses or CQ_ERROR if the arguments are invalid
+ */
+int cqAnalyzeStereo(CqSession* session, const double* left, const double* right, int dataSize, int startFrame,
+    int frameInterval, int totalAnalyses, double* toRet);
+
+/**
+ * analyzes only the bins [firstBin, endBin) of mono audio (such as a zoomed view of a pitch range) at a 
+ * cost proportional to the bins analyzed; only bins are produced whatever the session's CQ_OUTPUT_ flags
+ * @param session       the session
+ * @param data          the pcm audio data
+ * @param dataSize      the number of items in data
+ * @param startFrame    the first sample analyzed
+ * @param frameInterval the samples between frames
+ * @param totalAnalyses the number of frames (at most cqFrameCount)
+ * @param firstBin      the first bin analyzed
+ * @param endBin        one past the last bin analyzed (at most cqBins)
+ * @param toRet         the buffer to hold results (must have room for totalAnalyses * (endBin - firstBin) items)
+ * @returns             the number of frames analyzed or CQ_ERROR if the arguments are invalid
+ */
+int cqAnalyzeRegion(CqSession* session, const double* data, int dataSize, int startFrame, int frameInterval,
+    int totalAnalyses, int firstBin, int endBin, double* toRet);
+
+/**
+ * @returns an empty fingerprint index of chroma frames for similarity search across tracks
+ *          (see FingerprintIndex.hpp) to release with cqDestroyIndex or null if out of memory
+ */
+CqIndex* cqCreateIndex(void);
+
+/**
+ * @param path  the file written by cqSaveIndex
+ * @returns     the index to release with cqDestroyIndex or null if the file does not hold an index
+ */
+CqIndex* cqLoadIndex(const char* path);
+
+/**
+ * releases the index (null is ignored)
+ */
+void cqDestroyIndex(CqIndex* index);
+
+/**
+ * writes the index to a file; saving again to the file last saved or loaded appends only the tracks added
+ * or removed since (see FingerprintIndex::save)
+ * @param index the index
+ * @param path  the file to write
+ * @returns     0 or CQ_ERROR if the file could not be written
+ */
+int cqSaveIndex(CqIndex* index, const char* path);
+
+/**
+ * indexes the chroma frames of a track (replacing any track with the same id)
+ * @param index         the index
+ * @param track         the track id
+ * @param chroma        the chroma of the first frame (such as frames analyzed with CQ_OUTPUT_CHROMA
+ *                      offset by cqChromaOffset)
+ * @param totalFrames   the number of frames
+ * @param stride        the items from one frame's chroma to the next (at least 12; cqFrameSize for frames)
+ * @returns             the number of frames indexed (those not silent) or CQ_ERROR if the arguments are invalid
+ */
+int cqIndexAddTrack(CqIndex* index, int track, const double* chroma, int totalFrames, int stride);
+
+/**
+ * @returns 1 if the track was removed, 0 if it was not indexed or CQ_ERROR if the index is null
+ */
+int cqIndexRemoveTrack(CqIndex* index, int track);
+
+/**
+ * @returns the number of tracks indexed
+ */
+int cqIndexTracks(const CqIndex* index);
+
+/**
+ * finds the indexed tracks most similar to chroma frames (such as all or an excerpt of another track)
+ * @param index         the index
+ * @param chroma        see cqIndexAddTrack
+ * @param totalFrames   the number of frames
+ * @param stride        see cqIndexAddTrack
+ * @param k             the most tracks returned
+ * @param tracks        the buffer to hold the ids of the tracks found from the most similar (k items)
+ * @param scores        the buffer to hold the share of the frames matched for each track (0 to 1; k items)
+ * @returns             the number of tracks found or CQ_ERROR if the arguments are invalid
+ */
+int cqIndexQuery(const CqIndex* index, const double* chroma, int totalFrames, int stride, int k,
+    int* tracks, double* scores);
+
+#ifdef __cplusplus
+}
+#endif
@@ -3,7 +3,18 @@
 #include <emscripten.h>
 #include <string>
 #include <cmath>
+#include <map>
+#include <deque>
+#include <memory>
+#include <cstdint>
 #include "WorkerArgs.hpp"
+#include "Profiler.hpp"
+#include "BufferPool.hpp"
+#include "StreamingAnalyzer.hpp"
+#include "FramePyramid.hpp"
+#include "AudioWindow.hpp"
+#include "TileRenderer.hpp"
+#include "OnsetDetector.hpp"
 
 using namespace std;
 
@@ -16,87 +27,705 @@ extern "C" {
     const int STATUS_SPARSE_KERNEL_COMPLETE = 1; 
     // will also return the number of constant q samples in most recent iteration
     const int STATUS_CONSTANTQ_ITEM = 2; 
+    // will also return the estimated tempo (in beats per minute) of the whole recording, once
+    // before the last STATUS_CONSTANTQ_ITEM (only for OUTPUT_ONSETS and if the tempo was determined)
+    const int STATUS_TEMPO = 3;
+    // for streamed analyses, the slice has been analyzed and the next can be pushed (returns the slice index)
+    const int STATUS_STREAM_READY = 4;
+    // for streamed analyses, the stream is not a supported wav file (returns the slice index)
+    const int STATUS_STREAM_ERROR = 5;
+    // for analyses with audio still to push, more audio can be pushed with pushAudio 
+    // (returns the most samples to push)
+    const int STATUS_AUDIO_READY = 6;
 
+    // incremented when the bindings below change so the app can tell whether the wasm it loads was built
+    // from this source (see ConstantQDataUtil.WASM_API_VERSION; wasm built before this has no apiVersion)
+    const int WASM_API_VERSION = 1;
 
-    // data to use on the callback when sparse kernel is determined
-    struct OnSparseKernelArgs {
+    // job priorities (higher priorities are dispatched first)
+    const int PRIORITY_BACKGROUND = 0;
+    const int PRIORITY_VISIBLE = 10;
+
+    // chunks posted to workers at any one time across all jobs
+    // (a posted chunk cannot be recalled, so this bounds the work a cancellation or a
+    // higher priority job has to wait on)
+    const int MAX_IN_FLIGHT_CHUNKS = 4;
+
+    // workers used by a single analysis (more could not be kept busy with MAX_IN_FLIGHT_CHUNKS)
+    const int MAX_JOB_WORKERS = MAX_IN_FLIGHT_CHUNKS;
+
+    // workers kept after their jobs end so later analyses skip instantiating a worker (and, with the same
+    // settings, building the kernel); idle workers are terminated after WORKER_IDLE_TIMEOUT_MS
+    const int MAX_IDLE_WORKERS = MAX_JOB_WORKERS;
+    const int WORKER_IDLE_TIMEOUT_MS = 30000;
+
+    // the shares of a job's memory budget, one of which is the audio of a chunk 
+    // (the rest hold the audio of the chunks in flight, the chunk being filled and the posted message)
+    const int BUDGET_CHUNK_SHARES = MAX_IN_FLIGHT_CHUNKS + 2;
+
+    // chunk messages reused between chunks so the heap does not grow with each analysis
+    constantq::BufferPool<char, constantq::MEMORY_MESSAGE> messagePool;
+
+    // a chunk's audio before it is quantized for SAMPLE_FORMAT_INT16 messages
+    constantq::ScratchVector<double> quantizeBuffer;
+
+    // the most recent memory report from a worker
+    constantq::MemoryReport lastWorkerMemory = constantq::MemoryReport();
+
+    // a chunk of constant q samples waiting to be posted to a worker
+    struct PendingChunk {
+        int chunk;
+        int sampleStart;
+        int totalSamples;
+        int primeFrames;
+    };
+
+    // the state of a call to evaluate held until it completes or is cancelled
+    // (callbacks receive the job id and look the job up, so a cancelled job's late responses are dropped)
+    struct Job {
+        int id;
+        int priority;
         int frameInterval;
         int workerNumber;
-        worker_handle worker;
-        int audioDataSize;
-        double* audioDataPtr;
+        int outputs;
+
+        // constant q frames per second (for OUTPUT_ONSETS)
+        double frameRate;
+
+        // for OUTPUT_ONSETS, the spectral flux of each frame returned so far; workers only see their own
+        // chunks so onsets, tempo and beats are determined from all of it once the job completes
+        vector<double> flux;
+
+        // the job's workers; the first builds the kernel and the rest load it from the first
+        // (chunk c is analyzed by workers[c % workers.size()])
+        vector<worker_handle> workers;
+
+        // the settings the workers' sessions are created with
+        SparseKernelWorkerArgs sessionArgs;
+
+        // the sparse kernel size once the worker's session is initialized (0 before)
+        int sparseKernelSize;
+
+        // whether the first worker is building the kernel
+        bool kernelPending;
+
+        // samples not yet returned by a worker (for streamed analyses, -1 until the total is known)
+        int remainingSamples;
+
+        // for streamed analyses, the settings sent with each slice
+        StreamSliceHeaderArgs streamArgs;
+
+        // for streamed analyses, the index of the next slice, the index of the final slice 
+        // (-1 until it is pushed) and frames returned before the total was known
+        int nextSlice;
+        int finalSlice;
+        int unreportedSamples;
+
+        // chunks posted to the worker and not yet returned
+        int inFlight;
+
+        // for streamed analyses, slices posted to the worker and not yet returned
+        int inFlightSlices;
+
+        // the audio pushed and still needed by chunks not yet analyzed (accounted as MEMORY_AUDIO)
+        constantq::AudioWindow audio;
+
+        // the samples in the recording
+        int totalAudio;
+
+        // the bytes of audio the job may hold at once (0 for no limit)
+        double memoryBudget;
+
+        // the most audio samples to hold at once (determined with the kernel size)
+        int audioLimit;
+
+        // whether more audio has been requested with STATUS_AUDIO_READY and not yet pushed
+        bool audioRequested;
+
+        // the number of constant q samples, the samples per chunk and the first sample and index 
+        // of the next chunk to queue (determined with the kernel size)
+        int totalSamples;
+        int chunkSamples;
+        int nextChunkSample;
+        int nextChunk;
+
+        // the first audio sample of each chunk in flight keyed by chunk index
+        map<int, int> inFlightAudio;
+
+        deque<PendingChunk> pending;
         StatusUpdate statusUpdate;
         DataUpdate dataUpdate;
     };
 
-    // data to use on the callback when constant q is determined
-    struct OnConstantQArgs {
-        StatusUpdate statusUpdate;
-        DataUpdate dataUpdate;       
+    map<int, unique_ptr<Job>> jobs;
+    int nextJobId = 1;
+    int inFlightChunks = 0;
+
+    // the frames of each job as a pyramid for overviews, built as chunks complete and kept
+    // after the job completes until released with releasePyramid
+    map<int, unique_ptr<constantq::FramePyramid>> pyramids;
+
+    // the spectrogram tiles of each job they are enabled for, rendered as chunks complete and released
+    // with the job's pyramid (the renderer is created with the job's first frames once the bins are known)
+    struct JobTiles {
+        constantq::TileSettings settings;
+        int binsPerOctave;
+        unique_ptr<constantq::TileRenderer> renderer;
     };
 
-    void onConstantQ(char* data, int size, void* arg) {
+    map<int, JobTiles> tiles;
+
+    // a worker kept for reuse and when it became idle (emscripten_get_now milliseconds)
+    struct IdleWorker {
+        worker_handle worker;
+        double idleSince;
+    };
+
+    // idle workers with the most recently used last
+    deque<IdleWorker> idleWorkers;
+
+    // whether trimIdleWorkers is scheduled
+    bool trimScheduled = false;
+
+    void onConstantQ(char* data, int size, void* arg);
+
+    /**
+     * renders every frame added to the pyramid into the tiles
+     * @param renderer  the job's tile renderer
+     * @param pyramid   the job's pyramid
+     */
+    void renderPyramid(constantq::TileRenderer& renderer, const constantq::FramePyramid& pyramid) {
+        int totalFrames = pyramid.totalFrames();
+        int frame = 0;
+        while (frame < totalFrames) {
+            if (!pyramid.added(frame)) {
+                frame++;
+                continue;
+            }
+
+            // frames are stored contiguously so each run of added frames is rendered at once
+            int end = frame + 1;
+            while (end < totalFrames && pyramid.added(end))
+                end++;
+
+            renderer.addFrames(frame, pyramid.frame(frame), end - frame);
+            frame = end;
+        }
+    }
+
+    /**
+     * @returns an idle worker (the most recently used) or, if there are none, a new worker
+     */
+    worker_handle acquireWorker() {
+        if (idleWorkers.empty())
+            return emscripten_create_worker("./assets/wasm/worker.js");
+
+        worker_handle worker = idleWorkers.back().worker;
+        idleWorkers.pop_back();
+        return worker;
+    }
+
+    /**
+     * terminates workers idle for WORKER_IDLE_TIMEOUT_MS, rescheduling itself while any remain
+     */
+    void trimIdleWorkers(void* arg) {
+        trimScheduled = false;
+        double now = emscripten_get_now();
+        while (!idleWorkers.empty() && now - idleWorkers.front().idleSince >= WORKER_IDLE_TIMEOUT_MS) {
+            emscripten_destroy_worker(idleWorkers.front().worker);
+            idleWorkers.pop_front();
+        }
+
+        if (!idleWorkers.empty()) {
+            trimScheduled = true;
+            int remaining = (int) ceil(WORKER_IDLE_TIMEOUT_MS - (now - idleWorkers.front().idleSince));
+            emscripten_async_call(trimIdleWorkers, nullptr, remaining);
+        }
+    }
+
+    /**
+     * keeps a job's worker for reuse, releasing the job's session on it, or terminates it if it is still 
+     * working for the job (so a cancelled job's work is abandoned) or enough workers are idle
+     * @param worker    the worker
+     * @param session   the job's session id on the worker
+     * @param busy      whether the worker has work for the job in progress
+     */
+    void retireWorker(worker_handle worker, int session, bool busy) {
+        if (busy || idleWorkers.size() >= MAX_IDLE_WORKERS) {
+            emscripten_destroy_worker(worker);
+            return;
+        }
+
+        // the session (or stream) is released before the worker handles the next job's messages
+        ReleaseSessionArgs args;
+        args.session = session;
+        emscripten_call_worker(worker, "releaseSession", (char*) &args, sizeof(ReleaseSessionArgs), nullptr, nullptr);
+
+        idleWorkers.push_back({ worker, emscripten_get_now() });
+        if (!trimScheduled) {
+            trimScheduled = true;
+            emscripten_async_call(trimIdleWorkers, nullptr, WORKER_IDLE_TIMEOUT_MS);
+        }
+    }
+
+    /**
+     * @param jobId     the job id
+     * @returns         the job or nullptr if it has completed or been cancelled
+     */
+    Job* findJob(int jobId) {
+        auto found = jobs.find(jobId);
+        return found == jobs.end() ? nullptr : found->second.get();
+    }
+
+    /**
+     * removes the job, freeing its buffers and retiring its workers (those with work in progress are 
+     * terminated along with the work)
+     * @param jobId     the job id
+     */
+    void releaseJob(int jobId) {
+        Job* job = findJob(jobId);
+        if (!job)
+            return;
+
+        inFlightChunks -= job->inFlight;
+
+        // chunk c is in progress on workers[c % workers.size()]
+        vector<bool> busy(job->workers.size(), false);
+        for (auto& entry : job->inFlightAudio)
+            busy[entry.first % job->workers.size()] = true;
+
+        busy[0] = busy[0] || job->kernelPending || job->inFlightSlices > 0;
+        for (int w = 0; w < job->workers.size(); w++)
+            retireWorker(job->workers[w], jobId, busy[w]);
+
+        jobs.erase(jobId);
+    }
+
+    /**
+     * @param job       the job
+     * @param chunk     the chunk index
+     * @returns         the worker that analyzes the chunk
+     */
+    worker_handle chunkWorker(Job* job, int chunk) {
+        return job->workers[chunk % job->workers.size()];
+    }
+
+    /**
+     * @returns the job with pending chunks and the highest priority (earliest job on ties) or nullptr
+     */
+    Job* nextScheduledJob() {
+        Job* toRet = nullptr;
+        for (auto& entry : jobs) {
+            Job* job = entry.second.get();
+            if (job->pending.empty() || job->sparseKernelSize <= 0)
+                continue;
+
+            if (!toRet || job->priority > toRet->priority)
+                toRet = job;
+        }
+
+        return toRet;
+    }
+
+    /**
+     * @param job       the job
+     * @param chunk     the chunk
+     * @returns         the first audio sample the chunk analyzes
+     */
+    int chunkAudioStart(Job* job, const PendingChunk& chunk) {
+        return (chunk.sampleStart - chunk.primeFrames) * job->frameInterval;
+    }
+
+    /**
+     * queues the job's chunks whose audio has been pushed
+     * @param job       the job (whose kernel size is known)
+     */
+    void queueChunks(Job* job) {
+        while (job->nextChunkSample < job->totalSamples) {
+            int sampleStart = job->nextChunkSample;
+            int totalSamples = min(job->chunkSamples, job->totalSamples - sampleStart);
+            int audioEnd = (sampleStart + totalSamples - 1) * job->frameInterval + job->sparseKernelSize;
+            if (audioEnd > job->audio.end())
+                return;
+
+            // spectral flux for the first sample requires the preceding frame
+            int primeFrames = ((job->outputs & constantq::OUTPUT_ONSETS) && sampleStart > 0) ? 1 : 0;
+
+            job->pending.push_back({ job->nextChunk++, sampleStart, totalSamples, primeFrames });
+            job->nextChunkSample += totalSamples;
+        }
+    }
+
+    /**
+     * releases the job's audio preceding the first chunk not yet analyzed
+     * @param job       the job
+     */
+    void releaseAudio(Job* job) {
+        // the next chunk to queue may need the preceding frame to prime spectral flux
+        int needed = max(0, job->nextChunkSample - 1) * job->frameInterval;
+        if (!job->pending.empty())
+            needed = min(needed, chunkAudioStart(job, job->pending.front()));
+
+        for (auto& entry : job->inFlightAudio)
+            needed = min(needed, entry.second);
+
+        job->audio.releaseBefore(needed);
+    }
+
+    /**
+     * requests more audio with STATUS_AUDIO_READY if the job has room for it within its budget
+     * @param job       the job (whose kernel size is known)
+     */
+    void requestAudio(Job* job) {
+        int remaining = job->totalAudio - job->audio.end();
+        if (remaining <= 0 || job->audioRequested)
+            return;
+
+        int room = job->audioLimit - (job->audio.end() - job->audio.start());
+        if (room < min(remaining, constantq::DEFAULT_AUDIO_BLOCK_SAMPLES))
+            return;
+
+        job->audioRequested = true;
+        job->statusUpdate(STATUS_AUDIO_READY, min(room, remaining));
+    }
+
+    /**
+     * posts the chunk's audio to the job's worker
+     * @param job       the job
+     * @param chunk     the chunk to post
+     */
+    void postChunk(Job* job, const PendingChunk& chunk) {
+        ConstantQHeaderArgs theseArgs;
+        theseArgs.frameInterval = job->frameInterval;
+        theseArgs.startFrame = 0;
+        theseArgs.sampleStart = chunk.sampleStart;
+        theseArgs.totalSamples = chunk.totalSamples;
+        theseArgs.primeFrames = chunk.primeFrames;
+        theseArgs.chunk = chunk.chunk;
+        theseArgs.session = job->id;
+        theseArgs.sampleFormat = job->sessionArgs.accuracy == constantq::ACCURACY_FIXED ? 
+            SAMPLE_FORMAT_INT16 : SAMPLE_FORMAT_DOUBLE;
+        bool int16 = theseArgs.sampleFormat == SAMPLE_FORMAT_INT16;
+
+        auto audioSampleSize = ((chunk.primeFrames + chunk.totalSamples - 1) * job->frameInterval) + 
+            job->sparseKernelSize;
+
+        auto totalObjSize = sizeof(ConstantQHeaderArgs) + 
+            (int16 ? sizeof(int16_t) : sizeof(double)) * audioSampleSize;
+        auto thisData = messagePool.acquire(totalObjSize);
+
+        #ifdef DEBUG
+        EM_ASM({
+            console.log('post chunk: job', $0,
+                        'sampleStart', $1, 
+                        'totalSamples',  $2,
+                        'audioSampleSize', $3);
+        }, job->id, chunk.sampleStart, chunk.totalSamples, audioSampleSize);
+        #endif
+
+        {
+            constantq::ProfileTimer timer(constantq::STAGE_SERIALIZATION);
+            std::memcpy(
+                &thisData[0], 
+                &theseArgs, 
+                sizeof(ConstantQHeaderArgs));
+
+            char* audioData = &thisData[0] + sizeof(ConstantQHeaderArgs);
+            if (int16) {
+                quantizeBuffer.resize(audioSampleSize);
+                job->audio.copy(chunkAudioStart(job, chunk), audioSampleSize, &quantizeBuffer[0]);
+
+                int16_t* pcm = (int16_t*) audioData;
+                for (int i = 0; i < audioSampleSize; i++)
+                    pcm[i] = constantq::pcm16(quantizeBuffer[i]);
+            }
+            else {
+                job->audio.copy(chunkAudioStart(job, chunk), audioSampleSize, (double*) audioData);
+            }
+
+            constantq::Profiler::instance().addBytesCopied(totalObjSize);
+        }
+
+        job->inFlight++;
+        job->inFlightAudio[chunk.chunk] = chunkAudioStart(job, chunk);
+        inFlightChunks++;
+
+        emscripten_call_worker(chunkWorker(job, chunk.chunk), "sessionAnalyze", 
+            (char*) &thisData[0], totalObjSize, 
+            onConstantQ, (void*) (intptr_t) job->id);
+
+        // the message is copied when posted so the buffer can be reused immediately
+        messagePool.release(move(thisData));
+    }
+
+    /**
+     * posts pending chunks in priority order while there is room in flight
+     */
+    void schedule() {
+        while (inFlightChunks < MAX_IN_FLIGHT_CHUNKS) {
+            Job* job = nextScheduledJob();
+            if (!job)
+                return;
+
+            PendingChunk chunk = job->pending.front();
+            job->pending.pop_front();
+            postChunk(job, chunk);
+        }
+    }
+
+    /**
+     * records the response's profile and reports its frames through the job's data update
+     * @param job       the job
+     * @param data      the response (ConstantQReturnHeaderArgs followed by the frames)
+     * @param size      the size of the response
+     */
+    void reportFrames(Job* job, char* data, int size) {
         ConstantQReturnHeaderArgs* retHeaderArgs = (ConstantQReturnHeaderArgs*) data;
         int totalSamples = retHeaderArgs->totalSamples;
         int bins = retHeaderArgs->bins;
         int sampleStart = retHeaderArgs->sampleStart;
-        
-        OnConstantQArgs* onConstantQArgs = (OnConstantQArgs*) arg;
-        StatusUpdate statusUpdate = onConstantQArgs->statusUpdate;
-        DataUpdate dataUpdate = onConstantQArgs->dataUpdate;
+        int frameSize = retHeaderArgs->frameSize;
+        DataUpdate dataUpdate = job->dataUpdate;
 
         int audioArrSize = (size - sizeof(ConstantQReturnHeaderArgs)) / sizeof(double);
-        assert(audioArrSize >= bins * totalSamples);
+        assert(audioArrSize >= frameSize * totalSamples);
+
+        auto& profiler = constantq::Profiler::instance();
+        profiler.addChunk(chunkWorker(job, retHeaderArgs->chunk), retHeaderArgs->chunk, retHeaderArgs->profile);
+        lastWorkerMemory = retHeaderArgs->memory;
 
-        double* analyzedPtr = (double*) (data + sizeof(ConstantQReturnHeaderArgs));
-        vector<double> analyzed(analyzedPtr, analyzedPtr + audioArrSize);
+        constantq::ProfileTimer timer(constantq::STAGE_SERIALIZATION);
+
+        // frames are read in place from the response
+        double* analyzed = (double*) (data + sizeof(ConstantQReturnHeaderArgs));
         
         #ifdef DEBUG
         EM_ASM({
             console.log('constantq: totalSamples', $0, 
                         'bins',  $1,
                         'sampleStart', $2,
-                        'audioSize', $3);
-        }, totalSamples, bins, sampleStart, audioArrSize);
+                        'audioSize', $3,
+                        'frameSize', $4);
+        }, totalSamples, bins, sampleStart, audioArrSize, frameSize);
         #endif
 
+        // onset and beat items are reported once the flux of the whole recording is known (see reportOnsets)
+        if (job->outputs & constantq::OUTPUT_ONSETS) {
+            int fluxItem = frameSize - constantq::ONSETS_SIZE;
+            if (job->flux.size() < sampleStart + totalSamples)
+                job->flux.resize(sampleStart + totalSamples);
+
+            for (int i = 0; i < totalSamples; i++) {
+                double* frame = analyzed + i * frameSize;
+                job->flux[sampleStart + i] = frame[fluxItem];
+                frame[fluxItem + 1] = 0;
+                frame[fluxItem + 2] = 0;
+            }
+        }
+
         for (int i = 0; i < totalSamples; i++) {
-            for (int b = 0; b < bins; b++) {
-                double value = analyzed[i * bins + b];
+            for (int b = 0; b < frameSize; b++) {
+                double value = analyzed[i * frameSize + b];
                 dataUpdate(sampleStart + i,b,value);
             }
         }
 
-        statusUpdate(STATUS_CONSTANTQ_ITEM, totalSamples);
+        auto& pyramid = pyramids[job->id];
+        if (!pyramid)
+            pyramid.reset(new constantq::FramePyramid(frameSize));
+
+        pyramid->addFrames(sampleStart, analyzed, totalSamples);
+
+        auto jobTiles = tiles.find(job->id);
+        if (jobTiles != tiles.end() && totalSamples > 0) {
+            auto& renderer = jobTiles->second.renderer;
+            if (renderer) {
+                renderer->addFrames(sampleStart, analyzed, totalSamples);
+            }
+            else {
+                renderer.reset(new constantq::TileRenderer(bins, jobTiles->second.binsPerOctave, frameSize, 
+                    jobTiles->second.settings));
+                renderPyramid(*renderer, *pyramid);
+            }
+        }
+    }
+
+    /**
+     * reports the onsets and beats of a completed job through its data update and its tempo with
+     * STATUS_TEMPO, determined from the flux of all its frames (the pyramid keeps the frames without them)
+     * @param job       the job
+     * @param frameSize the items per frame
+     */
+    void reportOnsets(Job* job, int frameSize) {
+        if (!(job->outputs & constantq::OUTPUT_ONSETS) || job->flux.empty() || frameSize <= 0)
+            return;
+
+        constantq::OnsetDetector detector(job->frameRate);
+        detector.setFlux(move(job->flux));
+        job->flux.clear();
+
+        int fluxItem = frameSize - constantq::ONSETS_SIZE;
+        for (auto onset : detector.onsets())
+            job->dataUpdate(onset, fluxItem + 1, 1);
+
+        for (auto beat : detector.beats())
+            job->dataUpdate(beat, fluxItem + 2, 1);
+
+        double tempo = detector.tempo();
+        if (tempo > 0)
+            job->statusUpdate(STATUS_TEMPO, (int) round(tempo));
+    }
+
+    void onConstantQ(char* data, int size, void* arg) {
+        ConstantQReturnHeaderArgs* retHeaderArgs = (ConstantQReturnHeaderArgs*) data;
+        int totalSamples = retHeaderArgs->totalSamples;
+        
+        int jobId = (int) (intptr_t) arg;
+        Job* job = findJob(jobId);
+
+        // the job was cancelled after this chunk was posted
+        if (!job) {
+            schedule();
+            return;
+        }
+
+        job->inFlight--;
+        job->inFlightAudio.erase(retHeaderArgs->chunk);
+        inFlightChunks--;
+        job->remainingSamples -= totalSamples;
+        releaseAudio(job);
+
+        StatusUpdate statusUpdate = job->statusUpdate;
+        reportFrames(job, data, size);
+
+        bool complete = job->remainingSamples <= 0;
+
+        if (complete)
+            reportOnsets(job, retHeaderArgs->frameSize);
+
+        // status updates may cancel the job (releasing its callbacks)
+        if (findJob(jobId))
+            statusUpdate(STATUS_CONSTANTQ_ITEM, totalSamples);
+
+        if (complete)
+            releaseJob(jobId);
+        else if (findJob(jobId))
+            requestAudio(job);
+
+        schedule();
+    }
+
+    void onStreamSlice(char* data, int size, void* arg) {
+        ConstantQReturnHeaderArgs* retHeaderArgs = (ConstantQReturnHeaderArgs*) data;
+        int slice = retHeaderArgs->chunk;
+
+        int jobId = (int) (intptr_t) arg;
+        Job* job = findJob(jobId);
+
+        // the job was cancelled after this slice was posted
+        if (!job)
+            return;
+
+        job->inFlightSlices--;
+        StatusUpdate statusUpdate = job->statusUpdate;
+        if (retHeaderArgs->totalFrames == STREAM_INVALID) {
+            statusUpdate(STATUS_STREAM_ERROR, slice);
+            releaseJob(jobId);
+            pyramids.erase(jobId);
+            tiles.erase(jobId);
+            return;
+        }
+
+        reportFrames(job, data, size);
+        job->unreportedSamples += retHeaderArgs->totalSamples;
+
+        bool final = slice == job->finalSlice;
+        bool totalKnown = job->remainingSamples >= 0;
+
+        // progress is reported once the total is known from the stream's header (or its end)
+        if (!totalKnown && retHeaderArgs->totalFrames >= 0) {
+            job->remainingSamples = retHeaderArgs->totalFrames;
+            statusUpdate(STATUS_SPARSE_KERNEL_COMPLETE, retHeaderArgs->totalFrames);
+        }
+
+        // status updates may cancel the job (releasing its callbacks)
+        if (final && findJob(jobId))
+            reportOnsets(job, retHeaderArgs->frameSize);
+
+        if (findJob(jobId) && job->remainingSamples >= 0 && (job->unreportedSamples > 0 || final)) {
+            int unreported = job->unreportedSamples;
+            job->unreportedSamples = 0;
+            statusUpdate(STATUS_CONSTANTQ_ITEM, unreported);
+        }
+
+        if (final)
+            releaseJob(jobId);
+        else if (findJob(jobId))
+            statusUpdate(STATUS_STREAM_READY, slice);
+    }
+
+
+    /**
+     * creates the rest of the job's workers, posting the kernel built by the first worker to each
+     * so that only one worker builds it
+     * @param job           the job
+     * @param kernel        the serialized kernel
+     * @param kernelBytes   the size of the serialized kernel
+     * @param totalWorkers  the number of workers the job should have
+     */
+    void addWorkers(Job* job, const char* kernel, int kernelBytes, int totalWorkers) {
+        if (job->workers.size() >= totalWorkers || kernelBytes <= 0)
+            return;
+
+        auto totalObjSize = sizeof(SparseKernelWorkerArgs) + kernelBytes;
+        auto thisData = messagePool.acquire(totalObjSize);
+
+        {
+            constantq::ProfileTimer timer(constantq::STAGE_SERIALIZATION);
+            SparseKernelWorkerArgs theseArgs = job->sessionArgs;
+            theseArgs.shareKernel = 0;
+            std::memcpy(&thisData[0], &theseArgs, sizeof(SparseKernelWorkerArgs));
+            std::memcpy(&thisData[0] + sizeof(SparseKernelWorkerArgs), kernel, kernelBytes);
+        }
+
+        // messages to a worker are handled in order, so chunks can be posted without waiting for the session
+        while (job->workers.size() < totalWorkers) {
+            worker_handle worker = acquireWorker();
+            job->workers.push_back(worker);
+            emscripten_call_worker(worker, "loadSession", (char*) &thisData[0], totalObjSize, nullptr, nullptr);
+            constantq::Profiler::instance().addBytesCopied(totalObjSize);
+        }
+
+        messagePool.release(move(thisData));
     }
 
     void onSparseKernel(char* data, int sz, void* arg) {
-        assert(sz == sizeof(SparseKernelReturnArgs));
+        assert(sz >= sizeof(SparseKernelReturnArgs));
         SparseKernelReturnArgs* retArgs = (SparseKernelReturnArgs*) data;
         int sparseKernelSize = retArgs->size;
         int bins = retArgs->bins;
         
-        OnSparseKernelArgs* args = (OnSparseKernelArgs*)arg;
+        int jobId = (int) (intptr_t) arg;
+        Job* job = findJob(jobId);
 
-        int frameInterval = args->frameInterval;
-        int workerNumber = args->workerNumber;
-        worker_handle worker = args->worker;
-        int doubleSize = args->audioDataSize;
-        double* audioArrPtr = args->audioDataPtr;
-        StatusUpdate statusUpdate = args->statusUpdate;
-        DataUpdate dataUpdate = args->dataUpdate;
+        // the job was cancelled while the kernel was being determined
+        if (!job)
+            return;
 
-        vector<double> audioData(audioArrPtr, audioArrPtr + doubleSize);
+        job->kernelPending = false;
 
-        // total number of constantq samplings
-        int sampleNum = floor((audioData.size() - sparseKernelSize) / frameInterval);
+        int frameInterval = job->frameInterval;
+        int workerNumber = job->workerNumber;
+        int doubleSize = job->totalAudio;
 
-        statusUpdate(STATUS_SPARSE_KERNEL_COMPLETE, sampleNum);
+        auto& profiler = constantq::Profiler::instance();
+        profiler.addChunk(job->workers[0], -1, retArgs->profile);
+        lastWorkerMemory = retArgs->memory;
+
+        // total number of constantq samplings
+        int sampleNum = floor((doubleSize - sparseKernelSize) / frameInterval);
 
         #ifdef DEBUG
-        for (int i = 0; i < min(100, (int)audioData.size()); i+= 10)
-            EM_ASM({ console.log("sparse kernel audio data at ",$0, $1)}, i, audioData[i]);
-        
         EM_ASM({
             console.log('sparsekernel: sparseKernelSize', $0, 
                         'bins',  $1,
@@ -104,102 +733,156 @@ extern "C" {
                         'workerNumber', $3,
                         'sampleNum', $4,
                         'audioData size', $5);
-        }, sparseKernelSize, bins, frameInterval, workerNumber, sampleNum, audioData.size());
+        }, sparseKernelSize, bins, frameInterval, workerNumber, sampleNum, doubleSize);
         #endif
 
-        OnConstantQArgs onConstantQArgs;
-        onConstantQArgs.dataUpdate = dataUpdate;
-        onConstantQArgs.statusUpdate = statusUpdate;
+        // audio shorter than the kernel has no frames, so no chunks are queued and the job completes now
+        if (sampleNum <= 0) {
+            job->statusUpdate(STATUS_SPARSE_KERNEL_COMPLETE, 0);
 
-        // the last ending frame
-        int startSample = 0;
-        for (int w = 0; w < workerNumber; w++) {
-            int endingSample = ceil(((((double)w) + 1) / workerNumber) * sampleNum);
+            // status updates may cancel the job (releasing its callbacks)
+            if (findJob(jobId))
+                job->statusUpdate(STATUS_CONSTANTQ_ITEM, 0);
 
-            int totalSamples = endingSample - startSample; 
-            if (totalSamples < 1)
-                continue;
+            releaseJob(jobId);
+            schedule();
+            return;
+        }
 
-            ConstantQHeaderArgs theseArgs;
-            theseArgs.frameInterval = frameInterval;
-            theseArgs.startFrame = 0;
-            theseArgs.sampleStart = startSample;
-            theseArgs.totalSamples = totalSamples;
+        // without a budget the samples are split into workerNumber chunks, otherwise chunks are sized so 
+        // their audio is a share of the budget and the audio held is limited to the rest of the budget
+        // (audio is released in whole blocks, so budgets too small for two chunks and two blocks are exceeded
+        // rather than stalling)
+        if (job->memoryBudget > 0) {
+            job->chunkSamples = constantq::AudioWindow::framesForBudget(
+                job->memoryBudget / BUDGET_CHUNK_SHARES, sparseKernelSize, frameInterval);
+            int chunkAudio = (job->chunkSamples - 1) * frameInterval + sparseKernelSize;
+            job->audioLimit = max((int) (job->memoryBudget / sizeof(double)) - chunkAudio, 
+                2 * (chunkAudio + constantq::DEFAULT_AUDIO_BLOCK_SAMPLES));
+        }
+        else {
+            job->chunkSamples = max(1, (int) ceil(((double) sampleNum) / workerNumber));
+            job->audioLimit = job->totalAudio;
+        }
 
-            auto audioSampleSize = ((totalSamples - 1) * frameInterval) + sparseKernelSize;
+        job->totalSamples = sampleNum;
+        job->sparseKernelSize = sparseKernelSize;
+        job->remainingSamples = sampleNum;
+        queueChunks(job);
 
-            auto totalObjSize = sizeof(ConstantQHeaderArgs) + sizeof(double) * audioSampleSize;
-            vector<char> thisData(totalObjSize);
+        int totalChunks = (int) ceil(((double) sampleNum) / job->chunkSamples);
+        addWorkers(job, data + sizeof(SparseKernelReturnArgs), retArgs->kernelBytes, 
+            min(totalChunks, MAX_JOB_WORKERS));
 
-            #ifdef DEBUG
-            EM_ASM({
-                console.log('sparsekernel loop: sampleStart', $0, 
-                            'totalSamples',  $1,
-                            'audioSampleSize', $2);
-            }, startSample, totalSamples, audioSampleSize);
+        job->statusUpdate(STATUS_SPARSE_KERNEL_COMPLETE, sampleNum);
 
-            for (int i = startSample * frameInterval; i < min(100, (int)audioData.size()); i+= 10)
-                EM_ASM({ console.log("sparse kernel loop audio data at", $0, $1)}, i, audioData[i]);
-            #endif
+        // status updates may cancel the job
+        if (findJob(jobId))
+            requestAudio(job);
 
-            std::memcpy(
-                &thisData[0], 
-                &theseArgs, 
-                sizeof(ConstantQHeaderArgs));
+        if (findJob(jobId))
+            schedule();
+    }
 
-            std::memcpy(
-                &thisData[0] + sizeof(ConstantQHeaderArgs), 
-                &audioData[startSample * frameInterval], 
-                sizeof(double) * audioSampleSize);
 
-            emscripten_call_worker(worker, "sessionAnalyze", 
-                (char*) &thisData[0], totalObjSize, 
-                onConstantQ, (void*) &onConstantQArgs);
+    /**
+     * creates a job with its worker
+     * @param priority          the job priority
+     * @param outputs           the OUTPUT_ flags
+     * @param statusUpdatePtr   the status update function pointer as a string
+     * @param dataUpdatePtr     the data update function pointer as a string
+     * @returns                 the job (owned by jobs)
+     */
+    Job* createJob(int priority, int outputs, const string& statusUpdatePtr, const string& dataUpdatePtr) {
+        int statusUpdateInt = atoi(&statusUpdatePtr[0]);
+        int dataUpdateInt = atoi(&dataUpdatePtr[0]);
 
-            startSample = endingSample;
-        }
-    }
+        int jobId = nextJobId++;
+        unique_ptr<Job> job(new Job());
+        job->id = jobId;
+        job->priority = priority;
+        job->frameInterval = 0;
+        job->workerNumber = 0;
+        job->outputs = outputs;
+        job->frameRate = 0;
+        job->sparseKernelSize = 0;
+        job->kernelPending = false;
+        job->remainingSamples = 0;
+        job->inFlight = 0;
+        job->inFlightSlices = 0;
+        job->nextSlice = 0;
+        job->finalSlice = -1;
+        job->unreportedSamples = 0;
+        job->totalAudio = 0;
+        job->memoryBudget = 0;
+        job->audioLimit = 0;
+        job->audioRequested = false;
+        job->totalSamples = 0;
+        job->chunkSamples = 0;
+        job->nextChunkSample = 0;
+        job->nextChunk = 0;
+        job->statusUpdate = reinterpret_cast<StatusUpdate>(statusUpdateInt);
+        job->dataUpdate = reinterpret_cast<DataUpdate>(dataUpdateInt);
+        job->workers.push_back(acquireWorker());
 
+        Job* toRet = job.get();
+        jobs[jobId] = move(job);
+        return toRet;
+    }
 
     // int fs, double minFreq, double maxFreq, int bins, double thresh
-    // data
-    // number of workers
+    // outputs (OUTPUT_ flags in ConstantQSession.hpp; frame items are reported through dataUpdate)
+    // decimate (whether to decimate the audio to the lowest adequate rate for maxFreq before analysis)
+    // accuracy (ACCURACY_ tier in ConstantQSession.hpp)
+    // data (the first of the audio; the rest is pushed with pushAudio after STATUS_AUDIO_READY updates)
+    // totalSamples (the length of all of the audio)
+    // memoryBudget (bytes of audio to hold for the job sizing its chunks, or 0 to split into workerNumber chunks)
+    // number of chunks (analyzed by up to MAX_JOB_WORKERS workers that share one kernel build)
     // message updates callbacks, 
-    void evaluate(
-        int fs, double minFreq, double maxFreq, int bins, double thresh,
-        int frameInterval, int workerNumber, vector<double> data, 
-        string statusUpdatePtr, string dataUpdatePtr) {
-        
-        int statusUpdateInt = atoi(&statusUpdatePtr[0]);
-        StatusUpdate statusUpdate = reinterpret_cast<StatusUpdate>(statusUpdateInt);
-        int dataUpdateInt = atoi(&dataUpdatePtr[0]);
-        DataUpdate dataUpdate = reinterpret_cast<DataUpdate>(dataUpdateInt);
-
-        statusUpdate(STATUS_START_SPARSE_KERNEL, 0);
+    // priority (PRIORITY_ constants; higher priority jobs have their chunks dispatched first)
+    // returns the job id to use with cancelJob and setJobPriority
+    int evaluate(
+        int fs, double minFreq, double maxFreq, int bins, double thresh, int outputs, bool decimate,
+        int accuracy, int frameInterval, int workerNumber, vector<double> data, int totalSamples,
+        double memoryBudget, string statusUpdatePtr, string dataUpdatePtr, int priority) {
 
         #ifdef DEBUG
         for (int i = 0; i < min(100, (int)data.size()); i+= 10)
             EM_ASM({ console.log("sparse kernel audio data at", $0, $1)}, i, data[i]);
         #endif
 
-        worker_handle worker = emscripten_create_worker("./assets/wasm/worker.js");
+        Job* job = createJob(priority, outputs, statusUpdatePtr, dataUpdatePtr);
+        int jobId = job->id;
+        job->frameInterval = frameInterval;
+        job->frameRate = (double) fs / frameInterval;
+        job->workerNumber = workerNumber;
+        StatusUpdate statusUpdate = job->statusUpdate;
+
+        job->totalAudio = max(totalSamples, (int) data.size());
+        job->memoryBudget = memoryBudget;
+        if (!data.empty())
+            job->audio.append(&data[0], data.size());
+
+        worker_handle worker = job->workers[0];
+
+        statusUpdate(STATUS_START_SPARSE_KERNEL, 0);
+
+        // status updates may cancel the job
+        if (!findJob(jobId))
+            return jobId;
 
-        // initialize sparse Kernel
-        SparseKernelWorkerArgs sparseKernelArgs;
+        // initialize sparse Kernel on the first worker (which shares it with the job's other workers)
+        SparseKernelWorkerArgs& sparseKernelArgs = job->sessionArgs;
+        sparseKernelArgs.session = jobId;
         sparseKernelArgs.fs = fs;
         sparseKernelArgs.minFreq = minFreq;
         sparseKernelArgs.maxFreq = maxFreq;
         sparseKernelArgs.bins = bins;
         sparseKernelArgs.thresh = thresh;
-
-        OnSparseKernelArgs args;
-        args.frameInterval = frameInterval;
-        args.worker = worker;
-        args.workerNumber = workerNumber;
-        args.audioDataSize = data.size();
-        args.audioDataPtr = &data[0];
-        args.statusUpdate = statusUpdate;
-        args.dataUpdate = dataUpdate;
+        sparseKernelArgs.outputs = outputs;
+        sparseKernelArgs.decimate = decimate ? 1 : 0;
+        sparseKernelArgs.accuracy = accuracy;
+        sparseKernelArgs.shareKernel = workerNumber > 1 ? 1 : 0;
 
         #ifdef DEBUG
         EM_ASM({
@@ -210,13 +893,393 @@ extern "C" {
                         'thresh',  $4,
                         'frameInterval',  $5,
                         'workerNumber', $6,
-                        'audioData size', $7);
-        }, fs, minFreq, maxFreq, bins, thresh, frameInterval, workerNumber, data.size());
+                        'priority', $7);
+        }, fs, minFreq, maxFreq, bins, thresh, frameInterval, workerNumber, priority);
         #endif
 
+        job->kernelPending = true;
         emscripten_call_worker(worker, "initializeSession", 
             (char*) &sparseKernelArgs, sizeof(SparseKernelWorkerArgs), 
-            onSparseKernel, (void*)&args);
+            onSparseKernel, (void*) (intptr_t) jobId);
+
+        return jobId;
+    }
+
+    /**
+     * starts an analysis of a wav file pushed in slices with pushStream so the file is never held in memory
+     * (a STATUS_STREAM_READY update is made when the next slice can be pushed)
+     * @param minFreq           minimum frequency for analysis (in Hz)
+     * @param maxFreq           maximum frequency for analysis (in Hz)
+     * @param bins              bins per octave
+     * @param thresh            the sparse kernel threshold
+     * @param outputs           the OUTPUT_ flags determining what is produced per frame
+     * @param decimate          whether to decimate the audio to the lowest adequate rate before analysis
+     * @param accuracy          the ACCURACY_ tier
+     * @param framesPerSecond   constant q frames per second (STATUS_STREAM_ERROR is reported if not positive;
+     *                          rates above the stream's sample rate analyze every sample)
+     * @param statusUpdatePtr   the status update function pointer as a string
+     * @param dataUpdatePtr     the data update function pointer as a string
+     * @returns                 the job id to use with pushStream and cancelJob
+     */
+    int evaluateStream(double minFreq, double maxFreq, int bins, double thresh, int outputs,
+        bool decimate, int accuracy, double framesPerSecond, string statusUpdatePtr, string dataUpdatePtr) {
+
+        Job* job = createJob(PRIORITY_VISIBLE, outputs, statusUpdatePtr, dataUpdatePtr);
+        int jobId = job->id;
+        job->remainingSamples = -1;
+        job->frameRate = framesPerSecond;
+
+        // no frame interval follows from frames per second that are not positive
+        if (!(framesPerSecond > 0)) {
+            job->statusUpdate(STATUS_STREAM_ERROR, 0);
+            releaseJob(jobId);
+            return jobId;
+        }
+
+        StreamSliceHeaderArgs& streamArgs = job->streamArgs;
+        streamArgs.session = jobId;
+        streamArgs.outputs = outputs;
+        streamArgs.bins = bins;
+        streamArgs.windowFrames = constantq::DEFAULT_STREAM_WINDOW_FRAMES;
+        streamArgs.decimate = decimate ? 1 : 0;
+        streamArgs.accuracy = accuracy;
+        streamArgs.minFreq = minFreq;
+        streamArgs.maxFreq = maxFreq;
+        streamArgs.thresh = thresh;
+        streamArgs.framesPerSecond = framesPerSecond;
+
+        job->statusUpdate(STATUS_START_SPARSE_KERNEL, 0);
+        return jobId;
+    }
+
+    /**
+     * appends audio to a job started with evaluate after a STATUS_AUDIO_READY update
+     * (queueing the chunks it completes)
+     * @param jobId     the id returned by evaluate
+     * @param samples   the samples following those already pushed (at most the number in the update)
+     * @returns         whether the job was still running
+     */
+    bool pushAudio(int jobId, vector<double> samples) {
+        Job* job = findJob(jobId);
+        if (!job)
+            return false;
+
+        if (!samples.empty())
+            job->audio.append(&samples[0], samples.size());
+        job->audioRequested = false;
+
+        // chunks are queued once the kernel size is known
+        if (job->sparseKernelSize <= 0)
+            return true;
+
+        queueChunks(job);
+        requestAudio(job);
+
+        // status updates may cancel the job
+        if (findJob(jobId))
+            schedule();
+
+        return true;
+    }
+
+    /**
+     * posts the next slice of a streamed wav file to the job's worker
+     * @param jobId     the id returned by evaluateStream
+     * @param bytes     the bytes of the slice
+     * @param final     whether this is the last slice of the file
+     * @returns         whether the job was still running
+     */
+    bool pushStream(int jobId, string bytes, bool final) {
+        Job* job = findJob(jobId);
+        if (!job || job->finalSlice >= 0)
+            return false;
+
+        StreamSliceHeaderArgs theseArgs = job->streamArgs;
+        theseArgs.slice = job->nextSlice++;
+        theseArgs.final = final ? 1 : 0;
+        if (final)
+            job->finalSlice = theseArgs.slice;
+
+        auto totalObjSize = sizeof(StreamSliceHeaderArgs) + bytes.size();
+        auto thisData = messagePool.acquire(totalObjSize);
+
+        {
+            constantq::ProfileTimer timer(constantq::STAGE_SERIALIZATION);
+            std::memcpy(&thisData[0], &theseArgs, sizeof(StreamSliceHeaderArgs));
+            if (!bytes.empty())
+                std::memcpy(&thisData[0] + sizeof(StreamSliceHeaderArgs), &bytes[0], bytes.size());
+
+            constantq::Profiler::instance().addBytesCopied(totalObjSize);
+        }
+
+        job->inFlightSlices++;
+        emscripten_call_worker(job->workers[0], "streamAnalyze", 
+            (char*) &thisData[0], totalObjSize, 
+            onStreamSlice, (void*) (intptr_t) jobId);
+
+        // the message is copied when posted so the buffer can be reused immediately
+        messagePool.release(move(thisData));
+        return true;
+    }
+
+    /**
+     * cancels the job: pending chunks are dropped, the chunk in progress is abandoned with its worker 
+     * (the job's other workers are kept for reuse)
+     * and the job's buffers (including its pyramid) are freed. no further updates are made for the job.
+     * @param jobId     the id returned by evaluate
+     * @returns         whether the job was still running
+     */
+    bool cancelJob(int jobId) {
+        if (!findJob(jobId))
+            return false;
+
+        releaseJob(jobId);
+        pyramids.erase(jobId);
+        tiles.erase(jobId);
+        schedule();
+        return true;
+    }
+
+    /**
+     * cancels every job (without further updates) and terminates every worker including idle ones
+     * (workers are created again as later analyses need them)
+     * @returns         the number of jobs cancelled
+     */
+    int shutdownWorkers() {
+        int cancelled = jobs.size();
+        while (!jobs.empty()) {
+            // as with cancelJob, the pyramids and tiles of cancelled jobs are released with them
+            // (those of completed jobs are kept until releasePyramid)
+            int jobId = jobs.begin()->first;
+            releaseJob(jobId);
+            pyramids.erase(jobId);
+            tiles.erase(jobId);
+        }
+
+        for (auto& idle : idleWorkers)
+            emscripten_destroy_worker(idle.worker);
+
+        idleWorkers.clear();
+        return cancelled;
+    }
+
+    /**
+     * reduces the frames of a job (complete or in progress) for display over a number of pixels
+     * using the pyramid level appropriate for the span, so the cost is proportional to the pixels
+     * @param jobId         the id returned by evaluate or evaluateStream
+     * @param startFrame    the first frame of the span
+     * @param endFrame      one past the last frame of the span
+     * @param pixels        the number of pixels
+     * @param reduction     the REDUCE_ constant in FramePyramid.hpp
+     * @returns             pixels frames laid out one after another (empty if the job has no frames)
+     */
+    vector<double> queryPyramid(int jobId, int startFrame, int endFrame, int pixels, int reduction) {
+        auto found = pyramids.find(jobId);
+        if (found == pyramids.end())
+            return vector<double>();
+
+        return found->second->query(startFrame, endFrame, pixels, reduction);
+    }
+
+    /**
+     * frees the pyramid (and any tiles) of a completed job
+     * @param jobId     the id returned by evaluate or evaluateStream
+     * @returns         whether the job had a pyramid
+     */
+    bool releasePyramid(int jobId) {
+        tiles.erase(jobId);
+        return pyramids.erase(jobId) > 0;
+    }
+
+    /**
+     * renders the frames of a running job to rgba tiles as its chunks complete (see TileRenderer.hpp)
+     * so a spectrogram can be drawn to a canvas without per cell work in javascript
+     * @param jobId             the id returned by evaluate or evaluateStream (the job must output bins)
+     * @param rowsPerSemitone   pixel rows per semitone
+     * @param reference         the magnitude drawn with the last color of the colormap
+     * @param floorDb           the decibels relative to the reference drawn with the first color
+     * @param colormap          the COLORMAP_ constant in TileRenderer.hpp
+     * @returns                 whether tiles are rendered for the job
+     */
+    bool enableTiles(int jobId, int rowsPerSemitone, double reference, double floorDb, int colormap) {
+        Job* job = findJob(jobId);
+        if (!job || !(job->outputs & constantq::OUTPUT_BINS) || rowsPerSemitone <= 0 || reference <= 0 || floorDb >= 0)
+            return false;
+
+        // streamed analyses create their sessions with the slice settings
+        bool streamed = job->streamArgs.session == jobId;
+        int accuracy = streamed ? job->streamArgs.accuracy : job->sessionArgs.accuracy;
+
+        JobTiles& jobTiles = tiles[jobId];
+        jobTiles.settings = { rowsPerSemitone, reference, floorDb, colormap, accuracy == constantq::ACCURACY_POWER };
+        jobTiles.binsPerOctave = streamed ? job->streamArgs.bins : job->sessionArgs.bins;
+        jobTiles.renderer.reset();
+        return true;
+    }
+
+    /**
+     * @param jobId     the id returned by evaluate or evaluateStream
+     * @returns         the pixel rows of the job's tiles (0 until its first frames are rendered)
+     */
+    int tileRows(int jobId) {
+        auto found = tiles.find(jobId);
+        return found != tiles.end() && found->second.renderer ? found->second.renderer->rows() : 0;
+    }
+
+    /**
+     * @param jobId     the id returned by evaluate or evaluateStream
+     * @returns         one more than the index of the last tile with frames
+     */
+    int totalTiles(int jobId) {
+        auto found = tiles.find(jobId);
+        return found != tiles.end() && found->second.renderer ? found->second.renderer->totalTiles() : 0;
+    }
+
+    /**
+     * @param jobId     the id returned by evaluate or evaluateStream
+     * @param index     the tile (covering frames [index * TILE_COLUMNS, (index + 1) * TILE_COLUMNS))
+     * @returns         the number of times frames have been rendered into the tile (0 if none have)
+     */
+    int tileVersion(int jobId, int index) {
+        auto found = tiles.find(jobId);
+        return found != tiles.end() && found->second.renderer ? found->second.renderer->tileVersion(index) : 0;
+    }
+
+    /**
+     * @param jobId     the id returned by evaluate or evaluateStream
+     * @param index     the tile
+     * @returns         a view of the tile's rgba pixels in wasm memory (tileRows by TILE_COLUMNS; empty if the
+     *                  tile has no frames) that is valid until memory grows, so it should be copied to an 
+     *                  ImageData immediately
+     */
+    emscripten::val tilePixels(int jobId, int index) {
+        static const constantq::ResultVector<uint8_t> empty;
+        auto found = tiles.find(jobId);
+        auto& pixels = found != tiles.end() && found->second.renderer ? found->second.renderer->tile(index) : empty;
+        return emscripten::val(emscripten::typed_memory_view(pixels.size(), pixels.data()));
+    }
+
+    /**
+     * renders a span of a job's frames reduced to one column per pixel with the pyramid (for overviews)
+     * @param jobId         the id returned by evaluate or evaluateStream (tiles must be enabled)
+     * @param startFrame    the first frame of the span
+     * @param endFrame      one past the last frame of the span
+     * @param pixels        the number of columns
+     * @returns             a view of the rgba pixels (tileRows by pixels; empty if the job has no tiles) 
+     *                      valid until the next call
+     */
+    emscripten::val renderRange(int jobId, int startFrame, int endFrame, int pixels) {
+        auto found = tiles.find(jobId);
+        auto pyramid = pyramids.find(jobId);
+        if (found == tiles.end() || !found->second.renderer || pyramid == pyramids.end() || pixels <= 0)
+            return emscripten::val(emscripten::typed_memory_view(0, (const uint8_t*) nullptr));
+
+        auto frames = pyramid->second->query(startFrame, endFrame, pixels, constantq::REDUCE_MAX);
+        auto& rendered = found->second.renderer->renderRange(frames.data(), pixels);
+        return emscripten::val(emscripten::typed_memory_view(rendered.size(), rendered.data()));
+    }
+
+    /**
+     * changes the log scaling of a job's tiles and renders every frame again (each tile's version changes)
+     * @param jobId         the id returned by evaluate or evaluateStream
+     * @param reference     the magnitude drawn with the last color of the colormap
+     * @param floorDb       the decibels relative to the reference drawn with the first color
+     * @returns             whether the job has tiles
+     */
+    bool setTileScale(int jobId, double reference, double floorDb) {
+        auto found = tiles.find(jobId);
+        if (found == tiles.end() || reference <= 0 || floorDb >= 0)
+            return false;
+
+        auto& jobTiles = found->second;
+        jobTiles.settings.reference = reference;
+        jobTiles.settings.floorDb = floorDb;
+
+        auto pyramid = pyramids.find(jobId);
+        if (jobTiles.renderer && pyramid != pyramids.end()) {
+            jobTiles.renderer->setScale(reference, floorDb);
+            renderPyramid(*jobTiles.renderer, *pyramid->second);
+        }
+
+        return true;
+    }
+
+    /**
+     * changes the priority of a job so that, for instance, the currently visible track pre-empts
+     * background analyses (chunks already in flight are unaffected)
+     * @param jobId     the id returned by evaluate
+     * @param priority  the new priority
+     * @returns         whether the job was still running
+     */
+    bool setJobPriority(int jobId, int priority) {
+        Job* job = findJob(jobId);
+        if (!job)
+            return false;
+
+        job->priority = priority;
+        return true;
+    }
+
+    /**
+     * @returns the profile totals as [seconds for each stage..., bytes copied, frames processed]
+     * with stages ordered per the STAGE_ constants in Profiler.hpp
+     */
+    vector<double> profileSummary() {
+        auto& totals = constantq::Profiler::instance().totals();
+        vector<double> toRet(totals.stageSeconds, totals.stageSeconds + constantq::TOTAL_STAGES);
+        toRet.push_back(totals.bytesCopied);
+        toRet.push_back(totals.framesProcessed);
+        return toRet;
+    }
+
+    /**
+     * @returns the profile as chrome trace event json
+     */
+    string profileTrace() {
+        return constantq::Profiler::instance().toChromeTrace();
+    }
+
+    /**
+     * @param report    the memory report
+     * @returns         the report as [current bytes for each category..., peak bytes for each category...,
+     *                  total current bytes, total peak bytes] with categories ordered per the
+     *                  MEMORY_ constants in MemoryTracker.hpp
+     */
+    vector<double> memoryReportVector(const constantq::MemoryReport& report) {
+        vector<double> toRet(report.current, report.current + constantq::TOTAL_MEMORY_CATEGORIES);
+        toRet.insert(toRet.end(), report.peak, report.peak + constantq::TOTAL_MEMORY_CATEGORIES);
+        toRet.push_back(report.totalCurrent);
+        toRet.push_back(report.totalPeak);
+        return toRet;
+    }
+
+    /**
+     * @returns the memory report for the orchestrator (see memoryReportVector)
+     */
+    vector<double> memoryReport() {
+        return memoryReportVector(constantq::MemoryTracker::instance().report());
+    }
+
+    /**
+     * @returns the most recent memory report received from a worker (see memoryReportVector)
+     */
+    vector<double> workerMemoryReport() {
+        return memoryReportVector(lastWorkerMemory);
+    }
+
+    void resetProfile() {
+        constantq::Profiler::instance().reset();
+    }
+
+    void setProfileEnabled(bool enabled) {
+        constantq::Profiler::instance().setEnabled(enabled);
+    }
+
+    /**
+     * @returns the WASM_API_VERSION the bindings were built with
+     */
+    int apiVersion() {
+        return WASM_API_VERSION;
     }
 
     EMSCRIPTEN_BINDINGS(stl_wrappers) {
@@ -224,6 +1287,28 @@ extern "C" {
     }
 
     EMSCRIPTEN_BINDINGS(ConstantQOrchestrator) {
+        emscripten::function("apiVersion", &apiVersion);
         emscripten::function("evaluate", &evaluate);
+        emscripten::function("evaluateStream", &evaluateStream);
+        emscripten::function("pushStream", &pushStream);
+        emscripten::function("pushAudio", &pushAudio);
+        emscripten::function("cancelJob", &cancelJob);
+        emscripten::function("shutdownWorkers", &shutdownWorkers);
+        emscripten::function("setJobPriority", &setJobPriority);
+        emscripten::function("queryPyramid", &queryPyramid);
+        emscripten::function("releasePyramid", &releasePyramid);
+        emscripten::function("enableTiles", &enableTiles);
+        emscripten::function("tileRows", &tileRows);
+        emscripten::function("totalTiles", &totalTiles);
+        emscripten::function("tileVersion", &tileVersion);
+        emscripten::function("tilePixels", &tilePixels);
+        emscripten::function("renderRange", &renderRange);
+        emscripten::function("setTileScale", &setTileScale);
+        emscripten::function("profileSummary", &profileSummary);
+        emscripten::function("profileTrace", &profileTrace);
+        emscripten::function("resetProfile", &resetProfile);
+        emscripten::function("memoryReport", &memoryReport);
+        emscripten::function("workerMemoryReport", &workerMemoryReport);
+        emscripten::function("setProfileEnabled", &setProfileEnabled);
     }
 }
\ No newline at end of file
@@ -2,94 +2,719 @@
 #include "ConstantQ.hpp"
 #include "SparseKernel.hpp"
 #include "ConstantQSession.hpp"
+#include "Profiler.hpp"
+#include "KernelCache.hpp"
 #include <cmath>
+#include <cassert>
 //#include <emscripten/bind.h>
 
 using namespace std;
 
 namespace constantq {
-    ConstantQSession::ConstantQSession(int fs, double minFreq, double maxFreq, 
-                                        int bins, double thresh) : 
-        _cachedKernel(ConstantQ::sparseKernel(fs,minFreq,maxFreq,bins,thresh)) { }
+    // semitones in an octave
+    const int SEMITONES = 12;
 
-    int ConstantQSession::bins() { return _cachedKernel.bins(); }
+    // reference pitch (A4) used to determine the pitch class of the minimum frequency
+    const double A4_FREQ = 440.;
 
-    int ConstantQSession::size() { return _cachedKernel.size(); }
+    // pitch class of A where 0 is C
+    const int A_PITCH_CLASS = 9;
 
-    vector<double> ConstantQSession::analyzeSnapshot(vector<double> data, 
-                                        vector<complex<double> > bufferInput,
-                                        vector<complex<double> > bufferOutput, 
-                                        int startIndex, int len) {
+    // the decimated nyquist frequency must be at least this multiple of the maximum frequency
+    const double DECIMATION_NYQUIST_MARGIN = 1.25;
 
-        vector<double> toRet(_cachedKernel.bins());
+    // the decimation filter is flat up to this multiple of the maximum frequency (covering the top bin's bandwidth)
+    const double DECIMATION_PASS_MARGIN = 1.1;
+
+    // fixed point audio is 16 bit pcm shifted up to leave the fft headroom below FIXED_STAGE_LIMIT
+    const int FIXED_PCM_SHIFT = 13;
+    const double FIXED_INPUT_UNIT = PCM16_FULL_SCALE * (1 << FIXED_PCM_SHIFT);
+
+    /**
+     * @param sample    the audio sample
+     * @returns         the sample quantized as 16 bit pcm in the fixed point fft's input scale
+     */
+    int32_t fixedSample(double sample) {
+        return ((int32_t) pcm16(sample)) * (1 << FIXED_PCM_SHIFT);
+    }
+
+    /**
+     * @param sample    the 16 bit pcm sample
+     * @returns         the sample in the fixed point fft's input scale (clipped to full scale as fixedSample)
+     */
+    int32_t fixedSample(int16_t sample) {
+        return max((int32_t) sample, (int32_t) -PCM16_FULL_SCALE) * (1 << FIXED_PCM_SHIFT);
+    }
+
+    // alpha max plus beta min coefficients minimizing the largest error of approximate magnitudes (within 4%)
+    const double MAGNITUDE_ALPHA = .96043387;
+    const double MAGNITUDE_BETA = .39782473;
+
+    int ConstantQSession::decimationFactor(int fs, double maxFreq) {
+        int maxFactor = (int) floor(fs / (2 * DECIMATION_NYQUIST_MARGIN * maxFreq));
+
+        // the factor must divide fs so the kernel can be built at an integral rate
+        for (int factor = maxFactor; factor > 1; factor--) {
+            if (fs % factor == 0)
+                return factor;
+        }
+
+        return 1;
+    }
+
+    int ConstantQSession::kernelRate(int fs, double maxFreq, bool decimate) {
+        return decimate ? fs / decimationFactor(fs, maxFreq) : fs;
+    }
+
+    ConstantQSession::ConstantQSession(int fs, double minFreq, double maxFreq,
+                                        int bins, double thresh, int outputs, bool decimate, int accuracy) :
+        _fs(fs), _outputs(outputs), _accuracy(accuracy), _onsetDetector(fs), _onsetDetectorRight(fs),
+        _decimator(decimate ? decimationFactor(fs, maxFreq) : 1, DECIMATION_PASS_MARGIN * maxFreq / fs),
+        _minFreq(minFreq), _binsPerOctave(bins), _inRegion(false) {
+
+        _kernel = KernelCache::instance().kernel(kernelRate(fs, maxFreq, decimate), minFreq, maxFreq, bins, thresh);
+        _fftSize = _kernel->size();
+        _totalBins = _kernel->bins();
+        if (accuracy == ACCURACY_EXACT || accuracy == ACCURACY_FIXED) {
+            if (accuracy == ACCURACY_EXACT)
+                _bufferInput = ScratchVector<complex<double> >(_fftSize);
+            else
+                _bufferInputFixed = ScratchVector<FixedComplex>(_fftSize);
+
+            _bufferOutput = ScratchVector<complex<double> >(_totalBins);
+            _bufferOutputPair = ScratchVector<complex<double> >(_totalBins);
+        }
+        else {
+            _bufferInputFloat = ScratchVector<complex<float> >(_fftSize);
+            _bufferOutputFloat = ScratchVector<complex<float> >(_totalBins);
+            _bufferOutputPairFloat = ScratchVector<complex<float> >(_totalBins);
+        }
+
+        _magnitudes = ScratchVector<double>(_totalBins);
+        _gate = FrameGate(_fftSize, (outputs & OUTPUT_SKIP_SILENT) != 0, (outputs & OUTPUT_SKIP_REPEATED) != 0);
+
+        // only the outputs of the fft the kernel reads are computed
+        _allBins = binRange(0, _totalBins);
+        _region = BinRange { 0, 0, FftPruning(), FftPruning() };
+
+        // the fixed point kernel replaces the kernel, which is released (and freed if no other session uses it)
+        if (accuracy == ACCURACY_FIXED) {
+            _fixedKernel.reset(new FixedKernel(*_kernel));
+            _kernel.reset();
+        }
+
+        // the pitch class of the first bin
+        int minSemitone = (int) round(SEMITONES * log2(minFreq / A4_FREQ));
+        int minChroma = ((minSemitone + A_PITCH_CLASS) % SEMITONES + SEMITONES) % SEMITONES;
+
+        // map each bin to its semitone and pitch class so frames can be folded in one pass
+        int totalBins = _totalBins;
+        _binNote = vector<int>(totalBins);
+        _binChroma = vector<int>(totalBins);
+        for (int b = 0; b < totalBins; b++) {
+            _binNote[b] = (b * SEMITONES) / bins;
+            _binChroma[b] = (minChroma + _binNote[b]) % SEMITONES;
+        }
+
+        _notes = totalBins > 0 ? _binNote[totalBins - 1] + 1 : 0;
+    }
+
+    int ConstantQSession::bins() { return _totalBins; }
+
+    int ConstantQSession::size() { return _fftSize * _decimator.factor(); }
+
+    int ConstantQSession::fftSize() { return _fftSize; }
+
+    int ConstantQSession::decimation() { return _decimator.factor(); }
+
+    int ConstantQSession::outputs() { return _outputs; }
+
+    int ConstantQSession::accuracy() { return _accuracy; }
+
+    int ConstantQSession::binForFrequency(double frequency) {
+        int bin = (int) round(_binsPerOctave * log2(frequency / _minFreq));
+        return max(0, min(bins() - 1, bin));
+    }
+
+    ConstantQSession::BinRange ConstantQSession::binRange(int first, int end) const {
+        int fftSize = _fftSize;
+        vector<int> fftIndices;
+        if (_kernel) {
+            for (int b = first; b < end; b++) {
+                auto row = _kernel->row(b);
+                for (int e = 0; e < _kernel->rowSize(b); e++)
+                    fftIndices.push_back(row[e].fftIndex());
+            }
+        }
+        else {
+            fftIndices = _fixedKernel->fftIndices(first, end);
+        }
+
+        BinRange toRet { first, end, FftPruning(), FftPruning() };
+        toRet.pruning = MathUtil::fftPruning(fftSize, fftIndices);
+
+        int kernelIndices = fftIndices.size();
+        for (int i = 0; i < kernelIndices; i++)
+            fftIndices.push_back((fftSize - fftIndices[i]) & (fftSize - 1));
+
+        toRet.pairPruning = MathUtil::fftPruning(fftSize, fftIndices);
+        return toRet;
+    }
+
+    const ConstantQSession::BinRange& ConstantQSession::activeBins() const { return _inRegion ? _region : _allBins; }
+
+    const SparseKernel& ConstantQSession::kernel() const { 
+        assert(_kernel);
+        return *_kernel; 
+    }
+
+    bool ConstantQSession::hasKernel() const { return _kernel != nullptr; }
+
+    int ConstantQSession::notes() { return _notes; }
+
+    int ConstantQSession::chromaOffset() {
+        if (!(_outputs & OUTPUT_CHROMA))
+            return -1;
+
+        return ((_outputs & OUTPUT_BINS) ? bins() : 0) + ((_outputs & OUTPUT_NOTES) ? _notes : 0);
+    }
+
+    int ConstantQSession::frameSize() {
+        return ((_outputs & OUTPUT_BINS) ? bins() : 0) +
+            ((_outputs & OUTPUT_NOTES) ? _notes : 0) +
+            ((_outputs & OUTPUT_CHROMA) ? CHROMA_SIZE : 0) +
+            ((_outputs & OUTPUT_SKIPPED) ? 1 : 0) +
+            ((_outputs & OUTPUT_ONSETS) ? ONSETS_SIZE : 0);
+    }
+
+    bool ConstantQSession::pairsFrames() { return _accuracy != ACCURACY_EXACT; }
+
+    const OnsetDetector& ConstantQSession::onsetDetector() const { return _onsetDetector; }
+
+    const OnsetDetector& ConstantQSession::onsetDetectorRight() const { return _onsetDetectorRight; }
+
+    void ConstantQSession::analyzeSnapshot(const double* data, int dataSize,
+                                        int startIndex, int len, double* toRet) {
 
         // verify that length to parse from data is the sparse kernel's size
-        assert(len >= _cachedKernel.size());
+        assert(len >= _fftSize);
         assert(startIndex >= 0);
-        assert(startIndex + len <= data.size());
+        assert(startIndex + len <= dataSize);
+
+        auto& profiler = Profiler::instance();
 
-        for (int i = 0; i < len; i++)
-            bufferInput[i] = data[startIndex + i];
+        bool exact = _accuracy == ACCURACY_EXACT;
+        bool fixed = _accuracy == ACCURACY_FIXED;
+        {
+            ProfileTimer timer(STAGE_INGESTION_COPY);
+            if (exact) {
+                for (int i = 0; i < len; i++)
+                    _bufferInput[i] = data[startIndex + i];
+            }
+            else if (fixed) {
+                for (int i = 0; i < len; i++)
+                    _bufferInputFixed[i] = { fixedSample(data[startIndex + i]), 0 };
+            }
+            else {
+                for (int i = 0; i < len; i++)
+                    _bufferInputFloat[i] = (float) data[startIndex + i];
+            }
 
-        ConstantQ::constantQ(bufferInput, bufferOutput, _cachedKernel);
-        for (int i = 0; i < bufferOutput.size(); i++) {
-            toRet[i] = (double) (abs(bufferOutput[i]));
+            profiler.addBytesCopied(sizeof(double) * len);
         }
 
-        return toRet;
+        transformSnapshot(toRet, _onsetDetector);
+    }
+
+    void ConstantQSession::transformSnapshot(double* toRet, OnsetDetector& onsets) {
+        bool exact = _accuracy == ACCURACY_EXACT;
+        bool fixed = _accuracy == ACCURACY_FIXED;
+        auto& range = activeBins();
+        int exponent = 0;
+        {
+            ProfileTimer timer(STAGE_FFT);
+            if (exact)
+                MathUtil::fft(&_bufferInput[0], _fftSize, range.pruning);
+            else if (fixed)
+                exponent = MathUtil::fft(&_bufferInputFixed[0], _fftSize, range.pruning);
+            else
+                MathUtil::fft(&_bufferInputFloat[0], _fftSize, range.pruning);
+        }
+
+        {
+            ProfileTimer timer(STAGE_KERNEL_APPLY);
+            if (exact) {
+                ConstantQ::applyKernel(&_bufferInput[0], &_bufferOutput[0], *_kernel, range.first, range.end);
+            }
+            else if (fixed) {
+                _fixedKernel->apply(&_bufferInputFixed[0], ldexp(1 / FIXED_INPUT_UNIT, exponent), &_bufferOutput[0],
+                    range.first, range.end);
+            }
+            else {
+                ConstantQ::applyKernel(&_bufferInputFloat[0], &_bufferOutputFloat[0], *_kernel, 
+                    range.first, range.end);
+            }
+        }
+
+        writeFrame(toRet, onsets);
+    }
+
+    void ConstantQSession::analyzeSnapshotPair(const double* first, const double* second, int dataSize,
+                                        int firstIndex, int secondIndex, int len, double* firstRet, double* secondRet,
+                                        OnsetDetector& firstOnsets, OnsetDetector& secondOnsets) {
+
+        assert(len >= _fftSize);
+        assert(firstIndex >= 0 && secondIndex >= 0);
+        assert(firstIndex + len <= dataSize && secondIndex + len <= dataSize);
+
+        auto& profiler = Profiler::instance();
+
+        // the second frame is the imaginary part of the fft input
+        bool exact = _accuracy == ACCURACY_EXACT;
+        bool fixed = _accuracy == ACCURACY_FIXED;
+        {
+            ProfileTimer timer(STAGE_INGESTION_COPY);
+            if (exact) {
+                for (int i = 0; i < len; i++)
+                    _bufferInput[i] = complex<double>(first[firstIndex + i], second[secondIndex + i]);
+            }
+            else if (fixed) {
+                for (int i = 0; i < len; i++)
+                    _bufferInputFixed[i] = { fixedSample(first[firstIndex + i]), fixedSample(second[secondIndex + i]) };
+            }
+            else {
+                for (int i = 0; i < len; i++)
+                    _bufferInputFloat[i] = complex<float>(first[firstIndex + i], second[secondIndex + i]);
+            }
+
+            profiler.addBytesCopied(2 * sizeof(double) * len);
+        }
+
+        transformSnapshotPair(firstRet, secondRet, firstOnsets, secondOnsets);
+    }
+
+    void ConstantQSession::transformSnapshotPair(double* firstRet, double* secondRet, 
+                                        OnsetDetector& firstOnsets, OnsetDetector& secondOnsets) {
+        bool exact = _accuracy == ACCURACY_EXACT;
+        bool fixed = _accuracy == ACCURACY_FIXED;
+        auto& range = activeBins();
+        int exponent = 0;
+        {
+            ProfileTimer timer(STAGE_FFT);
+            if (exact)
+                MathUtil::fft(&_bufferInput[0], _fftSize, range.pairPruning);
+            else if (fixed)
+                exponent = MathUtil::fft(&_bufferInputFixed[0], _fftSize, range.pairPruning);
+            else
+                MathUtil::fft(&_bufferInputFloat[0], _fftSize, range.pairPruning);
+        }
+
+        {
+            ProfileTimer timer(STAGE_KERNEL_APPLY);
+            if (exact) {
+                ConstantQ::applyKernelPair(&_bufferInput[0], &_bufferOutput[0], &_bufferOutputPair[0], *_kernel,
+                    range.first, range.end);
+            }
+            else if (fixed) {
+                _fixedKernel->applyPair(&_bufferInputFixed[0], ldexp(1 / FIXED_INPUT_UNIT, exponent), 
+                    &_bufferOutput[0], &_bufferOutputPair[0], range.first, range.end);
+            }
+            else {
+                ConstantQ::applyKernelPair(&_bufferInputFloat[0], &_bufferOutputFloat[0], 
+                    &_bufferOutputPairFloat[0], *_kernel, range.first, range.end);
+            }
+        }
+
+        writeFrame(firstRet, firstOnsets);
+
+        // the second frame's results are written from the output buffers so they trade places
+        _bufferOutput.swap(_bufferOutputPair);
+        _bufferOutputFloat.swap(_bufferOutputPairFloat);
+        writeFrame(secondRet, secondOnsets);
     }
 
-    vector<vector<double> > ConstantQSession::analyze(vector<double> data, 
+    void ConstantQSession::writeSkippedFrame(double* toRet, OnsetDetector& onsets, int skipped) {
+        // a repeated frame is written from the output buffers as they are left by the last analyzed frame
+        if (skipped == FRAME_SILENT) {
+            fill(_bufferOutput.begin(), _bufferOutput.end(), 0.);
+            fill(_bufferOutputFloat.begin(), _bufferOutputFloat.end(), 0.f);
+        }
+
+        writeFrame(toRet, onsets, skipped);
+    }
+
+    void ConstantQSession::writeFrame(double* toRet, OnsetDetector& onsets, int skipped) {
+        auto& profiler = Profiler::instance();
+
+        ProfileTimer timer(STAGE_POST_PROCESS);
+        int totalBins = _totalBins;
+        bool power = _accuracy == ACCURACY_POWER;
+
+        // a region's frames are only its bins
+        if (_inRegion) {
+            if (toRet) {
+                profiler.addFrames(1);
+                for (int b = _region.first; b < _region.end; b++)
+                    toRet[b - _region.first] = binValue(b);
+            }
+
+            return;
+        }
+
+        // a priming frame only establishes the previous frame for spectral flux
+        if (!toRet) {
+            for (int i = 0; i < totalBins; i++)
+                _magnitudes[i] = power ? sqrt(binValue(i)) : binValue(i);
+
+            onsets.prime(&_magnitudes[0], totalBins);
+            return;
+        }
+
+        profiler.addFrames(1);
+
+        // determine where each output lives within the frame
+        double* binsOut = (_outputs & OUTPUT_BINS) ? toRet : nullptr;
+        double* notesOut = (_outputs & OUTPUT_NOTES) ?
+            toRet + ((_outputs & OUTPUT_BINS) ? bins() : 0) : nullptr;
+        double* chromaOut = (_outputs & OUTPUT_CHROMA) ? toRet + chromaOffset() : nullptr;
+        double* onsetsOut = (_outputs & OUTPUT_ONSETS) ?
+            toRet + frameSize() - ONSETS_SIZE : nullptr;
+        double* skippedOut = (_outputs & OUTPUT_SKIPPED) ?
+            toRet + frameSize() - ((_outputs & OUTPUT_ONSETS) ? ONSETS_SIZE : 0) - 1 : nullptr;
+
+        if (skippedOut)
+            *skippedOut = skipped;
+
+        if (notesOut)
+            fill(notesOut, notesOut + _notes, 0.);
+
+        if (chromaOut)
+            fill(chromaOut, chromaOut + CHROMA_SIZE, 0.);
+
+        for (int i = 0; i < totalBins; i++) {
+            double value = binValue(i);
+            _magnitudes[i] = value;
+
+            if (binsOut)
+                binsOut[i] = value;
+
+            if (notesOut)
+                notesOut[_binNote[i]] += value;
+
+            if (chromaOut)
+                chromaOut[_binChroma[i]] += value;
+        }
+
+        // onset and beat flags are determined once all flux for the analysis is known
+        // (spectral flux is always determined from magnitudes)
+        if (onsetsOut) {
+            if (power) {
+                for (int i = 0; i < totalBins; i++)
+                    _magnitudes[i] = sqrt(_magnitudes[i]);
+            }
+
+            onsetsOut[0] = onsets.addFrame(&_magnitudes[0], totalBins);
+            onsetsOut[1] = 0;
+            onsetsOut[2] = 0;
+        }
+    }
+
+    double ConstantQSession::binValue(int bin) const {
+        switch (_accuracy) {
+            case ACCURACY_EXACT: 
+            case ACCURACY_FIXED: 
+                return abs(_bufferOutput[bin]);
+            case ACCURACY_DISPLAY: {
+                double re = abs(_bufferOutputFloat[bin].real());
+                double im = abs(_bufferOutputFloat[bin].imag());
+                return MAGNITUDE_ALPHA * max(re, im) + MAGNITUDE_BETA * min(re, im);
+            }
+            case ACCURACY_POWER: 
+                return norm(_bufferOutputFloat[bin]);
+            default: 
+                return sqrt(norm(_bufferOutputFloat[bin]));
+        }
+    }
+
+    vector<vector<double> > ConstantQSession::analyze(const vector<double>& data,
                         int startFrame, int frameInterval, int totalAnalyses) {
-        
+
         assert(startFrame >= 0);
         assert(data.size() >= startFrame + frameInterval * totalAnalyses);
 
-        // buffers to minimize memory allocation and deallocation
-        vector<complex<double> > bufferInput(_cachedKernel.size());
-        vector<complex<double> > bufferOutput(_cachedKernel.bins());
+        auto single = analyzeToSingle(data, startFrame, frameInterval, totalAnalyses);
 
         // the vector of vectors to return
         vector<vector<double> > toRet(totalAnalyses);
 
-        auto kernelLen = _cachedKernel.size();
+        auto thisFrameSize = frameSize();
         for (int i = 0; i < totalAnalyses; i++) {
-            toRet[i] = analyzeSnapshot(data, bufferInput, bufferOutput, 
-                                        startFrame + frameInterval * i, kernelLen);
+            toRet[i] = vector<double>(
+                single.begin() + thisFrameSize * i,
+                single.begin() + thisFrameSize * (i + 1));
         }
-            
+
         return toRet;
     }
 
 
 
-    vector<double> ConstantQSession::analyzeToSingle(vector<double> data, 
-                        int startFrame, int frameInterval, int totalAnalyses) {
-        
+    vector<double> ConstantQSession::analyzeToSingle(const vector<double>& data,
+                        int startFrame, int frameInterval, int totalAnalyses, int primeFrames) {
+
+        vector<double> toRet(totalAnalyses * frameSize());
+        analyzeInto(&data[0], data.size(), startFrame, frameInterval, totalAnalyses, &toRet[0], primeFrames);
+        return toRet;
+    }
+
+    const double* ConstantQSession::analysisSource(const double* data, int dataSize, int startFrame, int spanSize,
+                        ScratchVector<double>& decimated, int& sourceSize) {
+
+        int factor = _decimator.factor();
+        if (factor <= 1) {
+            sourceSize = dataSize;
+            return data;
+        }
+
+        ProfileTimer timer(STAGE_DECIMATION);
+        decimated.resize(spanSize / factor);
+        sourceSize = _decimator.decimate(data + startFrame, spanSize, &decimated[0]);
+        return &decimated[0];
+    }
+
+    void ConstantQSession::markOnsets(double* toRet, int stride, const OnsetDetector& onsets) {
+        ProfileTimer timer(STAGE_POST_PROCESS);
+        auto onsetOffset = frameSize() - ONSETS_SIZE;
+        for (auto onset : onsets.onsets())
+            toRet[stride * onset + onsetOffset + 1] = 1;
+
+        for (auto beat : onsets.beats())
+            toRet[stride * beat + onsetOffset + 2] = 1;
+    }
+
+    int ConstantQSession::analyzeInto(const double* data, int dataSize,
+                        int startFrame, int frameInterval, int totalAnalyses, double* toRet, int primeFrames,
+                        const atomic<bool>* cancelled) {
+
         assert(startFrame >= 0);
+        assert(primeFrames >= 0);
 
-        auto kernelLen = _cachedKernel.size();
+        auto kernelLen = _fftSize;
+        int frameSpan = size();
+        int spanSize = frameSpan + frameInterval * (primeFrames + totalAnalyses - 1);
 
-        assert(data.size() >= startFrame + kernelLen + frameInterval * (totalAnalyses - 1));
+        assert(dataSize >= startFrame + spanSize);
 
+        _onsetDetector = OnsetDetector(((double) _fs) / frameInterval);
 
-        // buffers to minimize memory allocation and deallocation
-        vector<complex<double> > bufferInput(kernelLen);
-        vector<complex<double> > bufferOutput(_cachedKernel.bins());
+        auto thisFrameSize = frameSize();
 
-        // the vector of vectors to return
-        vector<double> toRet(totalAnalyses * _cachedKernel.bins());
+        // frames are analyzed from the audio or, if decimating, from the decimated audio 
+        // spanning all frames starting at startFrame
+        int sourceSize = 0;
+        const double* source = analysisSource(data, dataSize, startFrame, spanSize, _decimated, sourceSize);
+        int sourceStart = source == data ? startFrame : 0;
+        int factor = _decimator.factor();
 
-        for (int i = 0; i < totalAnalyses; i++) {
-            auto thisSnapshot = analyzeSnapshot(data, bufferInput, bufferOutput, 
-                                        startFrame + frameInterval * i, kernelLen);
-            memcpy(
-                &toRet[0] + _cachedKernel.bins() * i,
-                &thisSnapshot[0], 
-                sizeof(double) * _cachedKernel.bins());
-        }
-            
-        return toRet;
+        auto frameStart = [&](int i) { return sourceStart + (frameInterval * i) / factor; };
+
+        // priming frames only establish spectral flux
+        auto frameOut = [&](int i) { return i < primeFrames ? nullptr : toRet + thisFrameSize * (i - primeFrames); };
+
+        // cancellation is only observed between frames so no frame is left partially written
+        auto isCancelled = [cancelled]() { return cancelled && cancelled->load(memory_order_relaxed); };
+
+        // frames are classified in order so each is compared with the last analyzed frame before it
+        int totalFrames = primeFrames + totalAnalyses;
+        _gate.reset(source);
+        auto frameSkipped = [&](int i) { return i < totalFrames ? _gate.classify(frameStart(i)) : FRAME_ANALYZED; };
+
+        // consecutive analyzed frames share an fft when pairing (a frame between skipped frames is analyzed alone)
+        bool pair = pairsFrames();
+        int frame = 0;
+        int skipped = frameSkipped(0);
+        while (frame < totalFrames && !isCancelled()) {
+            int nextSkipped = frameSkipped(frame + 1);
+            if (skipped != FRAME_ANALYZED) {
+                writeSkippedFrame(frameOut(frame), _onsetDetector, skipped);
+                frame++;
+                skipped = nextSkipped;
+            }
+            else if (pair && frame + 1 < totalFrames && nextSkipped == FRAME_ANALYZED) {
+                analyzeSnapshotPair(source, source, sourceSize, frameStart(frame), frameStart(frame + 1), kernelLen,
+                                    frameOut(frame), frameOut(frame + 1), _onsetDetector, _onsetDetector);
+                frame += 2;
+                skipped = frameSkipped(frame);
+            }
+            else {
+                analyzeSnapshot(source, sourceSize, frameStart(frame), kernelLen, frameOut(frame));
+                frame++;
+                skipped = nextSkipped;
+            }
+        }
+
+        int analyzed = max(0, frame - primeFrames);
+
+        if (_outputs & OUTPUT_ONSETS)
+            markOnsets(toRet, thisFrameSize, _onsetDetector);
+
+        return analyzed;
     }
-}
 
+    bool ConstantQSession::loadsInt16() const {
+        return _accuracy == ACCURACY_FIXED && _decimator.factor() == 1 && !(_outputs & OUTPUT_SKIPPED);
+    }
+
+    int ConstantQSession::analyzeInt16Into(const int16_t* data, int dataSize,
+                        int startFrame, int frameInterval, int totalAnalyses, double* toRet, int primeFrames,
+                        const atomic<bool>* cancelled) {
+
+        assert(startFrame >= 0);
+        assert(primeFrames >= 0);
+
+        int spanSize = size() + frameInterval * (primeFrames + totalAnalyses - 1);
+        assert(dataSize >= startFrame + spanSize);
+
+        // decimation and frame skipping read double precision audio, as do the floating point tiers
+        if (!loadsInt16()) {
+            {
+                ProfileTimer timer(STAGE_INGESTION_COPY);
+                _converted.resize(spanSize);
+                for (int i = 0; i < spanSize; i++)
+                    _converted[i] = data[startFrame + i] / PCM16_FULL_SCALE;
+            }
+
+            return analyzeInto(&_converted[0], spanSize, 0, frameInterval, totalAnalyses, toRet, primeFrames, 
+                cancelled);
+        }
+
+        _onsetDetector = OnsetDetector(((double) _fs) / frameInterval);
+
+        auto& profiler = Profiler::instance();
+        auto thisFrameSize = frameSize();
+        auto frameData = [&](int i) { return data + startFrame + frameInterval * i; };
+        auto frameOut = [&](int i) { return i < primeFrames ? nullptr : toRet + thisFrameSize * (i - primeFrames); };
+        auto isCancelled = [cancelled]() { return cancelled && cancelled->load(memory_order_relaxed); };
+
+        // consecutive frames share an fft as the real and imaginary parts of its input
+        int totalFrames = primeFrames + totalAnalyses;
+        int frame = 0;
+        while (frame < totalFrames && !isCancelled()) {
+            bool pair = frame + 1 < totalFrames;
+            {
+                ProfileTimer timer(STAGE_INGESTION_COPY);
+                const int16_t* first = frameData(frame);
+                const int16_t* second = pair ? frameData(frame + 1) : nullptr;
+                for (int i = 0; i < _fftSize; i++)
+                    _bufferInputFixed[i] = { fixedSample(first[i]), second ? fixedSample(second[i]) : 0 };
+
+                profiler.addBytesCopied((pair ? 2 : 1) * sizeof(int16_t) * _fftSize);
+            }
+
+            if (pair) {
+                transformSnapshotPair(frameOut(frame), frameOut(frame + 1), _onsetDetector, _onsetDetector);
+                frame += 2;
+            }
+            else {
+                transformSnapshot(frameOut(frame), _onsetDetector);
+                frame++;
+            }
+        }
+
+        if (_outputs & OUTPUT_ONSETS)
+            markOnsets(toRet, thisFrameSize, _onsetDetector);
+
+        return max(0, frame - primeFrames);
+    }
+
+    int ConstantQSession::analyzeStereoInto(const double* left, const double* right, int dataSize,
+                        int startFrame, int frameInterval, int totalAnalyses, double* toRet, int primeFrames,
+                        const atomic<bool>* cancelled) {
+
+        assert(startFrame >= 0);
+        assert(primeFrames >= 0);
+
+        auto kernelLen = _fftSize;
+        int spanSize = size() + frameInterval * (primeFrames + totalAnalyses - 1);
+
+        assert(dataSize >= startFrame + spanSize);
+
+        _onsetDetector = OnsetDetector(((double) _fs) / frameInterval);
+        _onsetDetectorRight = OnsetDetector(((double) _fs) / frameInterval);
+
+        auto thisFrameSize = frameSize();
+        int stride = 2 * thisFrameSize;
+
+        // each channel is decimated separately (both to the same size)
+        int sourceSize = 0;
+        const double* leftSource = analysisSource(left, dataSize, startFrame, spanSize, _decimated, sourceSize);
+        const double* rightSource = analysisSource(right, dataSize, startFrame, spanSize, _decimatedRight, sourceSize);
+        int sourceStart = leftSource == left ? startFrame : 0;
+        int factor = _decimator.factor();
+
+        auto isCancelled = [cancelled]() { return cancelled && cancelled->load(memory_order_relaxed); };
+
+        int totalFrames = primeFrames + totalAnalyses;
+        int frame = 0;
+        for (; frame < totalFrames && !isCancelled(); frame++) {
+            int frameStart = sourceStart + (frameInterval * frame) / factor;
+            double* leftOut = frame < primeFrames ? nullptr : toRet + stride * (frame - primeFrames);
+            analyzeSnapshotPair(leftSource, rightSource, sourceSize, frameStart, frameStart, kernelLen,
+                                leftOut, leftOut ? leftOut + thisFrameSize : nullptr, 
+                                _onsetDetector, _onsetDetectorRight);
+        }
+
+        if (_outputs & OUTPUT_ONSETS) {
+            markOnsets(toRet, stride, _onsetDetector);
+            markOnsets(toRet + thisFrameSize, stride, _onsetDetectorRight);
+        }
+
+        return max(0, frame - primeFrames);
+    }
+
+    int ConstantQSession::analyzeRegionInto(const double* data, int dataSize,
+                        int startFrame, int frameInterval, int totalAnalyses, int firstBin, int endBin, double* toRet,
+                        const atomic<bool>* cancelled) {
+
+        assert(startFrame >= 0);
+        assert(firstBin >= 0 && firstBin < endBin && endBin <= bins());
+
+        auto kernelLen = _fftSize;
+        int spanSize = size() + frameInterval * (totalAnalyses - 1);
+
+        assert(dataSize >= startFrame + spanSize);
+
+        // the pruning is kept so the next analysis of the same region (such as while scrolling) reuses it
+        if (_region.first != firstBin || _region.end != endBin)
+            _region = binRange(firstBin, endBin);
+
+        _inRegion = true;
+
+        int sourceSize = 0;
+        const double* source = analysisSource(data, dataSize, startFrame, spanSize, _decimated, sourceSize);
+        int sourceStart = source == data ? startFrame : 0;
+        int factor = _decimator.factor();
+        int regionSize = endBin - firstBin;
+
+        auto frameStart = [&](int i) { return sourceStart + (frameInterval * i) / factor; };
+        auto isCancelled = [cancelled]() { return cancelled && cancelled->load(memory_order_relaxed); };
+
+        bool pair = pairsFrames();
+        int frame = 0;
+        while (frame < totalAnalyses && !isCancelled()) {
+            if (pair && frame + 1 < totalAnalyses) {
+                analyzeSnapshotPair(source, source, sourceSize, frameStart(frame), frameStart(frame + 1), kernelLen,
+                                    toRet + regionSize * frame, toRet + regionSize * (frame + 1),
+                                    _onsetDetector, _onsetDetector);
+                frame += 2;
+            }
+            else {
+                analyzeSnapshot(source, sourceSize, frameStart(frame), kernelLen, toRet + regionSize * frame);
+                frame++;
+            }
+        }
+
+        _inRegion = false;
+        return frame;
+    }
+}
@@ -1,25 +1,268 @@
 #pragma once
+#include <vector>
+#include <complex>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <algorithm>
+#include <cmath>
 #include "SparseKernel.hpp"
+#include "OnsetDetector.hpp"
+#include "MemoryTracker.hpp"
+#include "PolyphaseDecimator.hpp"
+#include "MathUtil.hpp"
+#include "FixedKernel.hpp"
+#include "FrameGate.hpp"
 
 namespace constantq {
+    // flags determining what a session produces for each analyzed frame
+    // frames are laid out as [bins][notes][chroma][skipped][onsets] including only the flagged outputs
+
+    // the magnitude of each constant q bin
+    const int OUTPUT_BINS = 1;
+    // the magnitude of each semitone (bins within the same semitone are summed)
+    const int OUTPUT_NOTES = 2;
+    // the 12 pitch classes (starting at C) with all octaves folded together
+    const int OUTPUT_CHROMA = 4;
+    // the log spectral flux followed by onset and beat flags (1 if present, 0 otherwise)
+    const int OUTPUT_ONSETS = 8;
+    // frames whose audio is below SILENCE_RMS are output as zeros rather than analyzed
+    const int OUTPUT_SKIP_SILENT = 16;
+    // frames whose audio has nearly the energy and zero crossings of the last analyzed frame repeat it 
+    // rather than being analyzed (approximate: a change in pitch at the same loudness can be missed)
+    const int OUTPUT_SKIP_REPEATED = 32;
+    // with either skip flag each frame includes its FRAME_ value (see FrameGate.hpp) as a skipped item
+    // (stereo analysis analyzes every frame)
+    const int OUTPUT_SKIPPED = OUTPUT_SKIP_SILENT | OUTPUT_SKIP_REPEATED;
+
+    // accuracy tiers trading exactness for speed; the error bounds (relative to the largest bin of a direct
+    // time domain analysis, see AccuracyHarness and tools/AccuracyReport.cpp) are for the default range 
+    // at 44.1 kHz without decimation (decimating raises the max error of each tier to within 5%)
+    // tiers other than ACCURACY_EXACT also analyze consecutive frames in pairs sharing one fft 
+    // (about twice as fast without changing the bounds)
+
+    // double precision throughout with exact magnitudes for archival and research use
+    // (max error .9%, rms .22% due to the kernel threshold)
+    const int ACCURACY_EXACT = 0;
+    // single precision fft and kernel accumulation (max error .9%, rms .22%)
+    const int ACCURACY_FAST = 1;
+    // single precision with approximate magnitudes for display (max error 4%, rms .6%)
+    const int ACCURACY_DISPLAY = 2;
+    // single precision producing squared magnitudes without a square root (all outputs are power; 
+    // max error .6%, rms .07% relative to the largest squared magnitude)
+    const int ACCURACY_POWER = 3;
+    // integer arithmetic for clients with slow floating point: audio quantized to 16 bit pcm (clipped beyond
+    // full scale at 1), a block floating point fft of 32 bit values with Q30 twiddles and a kernel of Q15 
+    // multipliers scaled per row (max error .9%, rms .22%; slower than ACCURACY_FAST with fast floating point)
+    const int ACCURACY_FIXED = 4;
+
+    // the number of pitch classes in a chromagram
+    const int CHROMA_SIZE = 12;
+
+    // the 16 bit pcm value of full scale audio (1); 16 bit audio is analyzed as sample / PCM16_FULL_SCALE
+    const double PCM16_FULL_SCALE = 32767.;
+
+    /**
+     * @param sample    the audio sample
+     * @returns         the sample quantized as 16 bit pcm (clipped beyond full scale)
+     */
+    inline int16_t pcm16(double sample) {
+        return (int16_t) std::max(-PCM16_FULL_SCALE, std::min(PCM16_FULL_SCALE, std::round(sample * PCM16_FULL_SCALE)));
+    }
+
+    // the number of items for onset output (flux, onset, beat)
+    const int ONSETS_SIZE = 3;
+
     class ConstantQSession {
         private:
-            static ConstantQSession curSession;
-            SparseKernel _cachedKernel;
+            /**
+             * bins the kernel is applied to with the fft butterflies needed for the fft indices their rows 
+             * read and, when two frames share an fft, for those indices and their mirrors (n - index) as well
+             */
+            struct BinRange {
+                int first;
+                int end;
+                FftPruning pruning;
+                FftPruning pairPruning;
+            };
+
+            // the kernel (shared with other sessions with identical kernel parameters); not held with
+            // ACCURACY_FIXED, which only needs _fixedKernel, so the kernel is freed if no other session uses it
+            std::shared_ptr<const SparseKernel> _kernel;
+
+            // the fft size and number of bins of the kernel
+            int _fftSize;
+            int _totalBins;
+
+            // the frames per second of the audio
+            int _fs;
+
+            // the OUTPUT_ flags for what this session produces per frame
+            int _outputs;
+
+            // the ACCURACY_ tier
+            int _accuracy;
+
+            // the number of semitones covered by the bins
+            int _notes;
+
+            // the semitone (relative to the minimum frequency) for each bin
+            std::vector<int> _binNote;
+
+            // the pitch class (0 is C) for each bin
+            std::vector<int> _binChroma;
+
+            // onset detection state for the most recent analysis
+            OnsetDetector _onsetDetector;
+
+            // onset detection state for the right channel of the most recent stereo analysis
+            OnsetDetector _onsetDetectorRight;
+
+            // decides which frames are skipped for the OUTPUT_SKIP_ flags
+            FrameGate _gate;
+
+            // reduces the audio to the lowest adequate rate before analysis (factor of 1 if not decimating)
+            PolyphaseDecimator _decimator;
+
+            // the minimum frequency and bins per octave the session was created with
+            double _minFreq;
+            int _binsPerOctave;
+
+            // every bin and the bins of the most recent region analysis
+            BinRange _allBins;
+            BinRange _region;
+
+            // whether a region is being analyzed (frames are then only the region's bins)
+            bool _inRegion;
+
+            // buffers reused by every analysis of this session to minimize memory allocation and deallocation
+            // the buffer to use for input from the ConstantQ algorithm
+            ScratchVector<std::complex<double> > _bufferInput;
+            // the buffer to use for output from the ConstantQ algorithm
+            ScratchVector<std::complex<double> > _bufferOutput;
+            // the buffer to use for output for the imaginary part when two frames share an fft
+            ScratchVector<std::complex<double> > _bufferOutputPair;
+            // single precision buffers used instead for tiers other than ACCURACY_EXACT
+            ScratchVector<std::complex<float> > _bufferInputFloat;
+            ScratchVector<std::complex<float> > _bufferOutputFloat;
+            ScratchVector<std::complex<float> > _bufferOutputPairFloat;
+            // the fixed point fft buffer used instead for ACCURACY_FIXED (which outputs to the double buffers)
+            ScratchVector<FixedComplex> _bufferInputFixed;
+
+            // the kernel with fixed point multipliers for ACCURACY_FIXED
+            std::unique_ptr<FixedKernel> _fixedKernel;
+
+            // the buffer to hold the magnitude of each bin
+            ScratchVector<double> _magnitudes;
+            // the buffers to hold decimated audio (the second for the right channel of stereo analysis)
+            ScratchVector<double> _decimated;
+            ScratchVector<double> _decimatedRight;
+            // 16 bit audio converted for analyzeInt16Into when it cannot be loaded into the fixed point fft
+            ScratchVector<double> _converted;
 
             /**
              * analyzes pcm audio data utilizing constant q algorithm
-             * @param data          the pcm audio data in a two dimensional array of format [channel][sample frame]
-             * @param bufferInput   the buffer to use for input from the ConstantQ algorithm
-             * @param bufferOutput  the buffer to use for output from the ConstantQ algorithm
+             * @param data          the pcm audio data
+             * @param dataSize      the number of items in data
              * @param startIndex    the starting sample frame in the data array
              * @param len           the number of sample frames to analyze (should be equivalent to sparse kernel size)
-             * @return              the vector of size 'bins' of the constant q sized data
+             * @param toRet         where the frame will be written (must have room for frameSize items)
+             *                      or nullptr if the frame only primes onset detection
+             */
+            void analyzeSnapshot(const double* data, int dataSize,
+                                    int startIndex, int len, double* toRet);
+
+            /**
+             * analyzes two frames with one fft by packing the second as the imaginary part of the first
+             * @param first         the pcm audio data for the first frame
+             * @param second        the pcm audio data for the second frame
+             * @param dataSize      the number of items in first and second
+             * @param firstIndex    the starting sample frame of the first frame
+             * @param secondIndex   the starting sample frame of the second frame
+             * @param len           the number of sample frames to analyze (should be equivalent to sparse kernel size)
+             * @param firstRet      where the first frame will be written or nullptr if it only primes onset detection
+             * @param secondRet     where the second frame will be written or nullptr if it only primes onset detection
+             * @param firstOnsets   the onset detection for the first frame
+             * @param secondOnsets  the onset detection for the second frame (may be firstOnsets if it follows it)
              */
-            std::vector<double> analyzeSnapshot(std::vector<double> data, 
-                                    std::vector<std::complex<double> > bufferInput,
-                                    std::vector<std::complex<double> > bufferOutput,
-                                    int startIndex, int len);
+            void analyzeSnapshotPair(const double* first, const double* second, int dataSize,
+                                    int firstIndex, int secondIndex, int len, double* firstRet, double* secondRet,
+                                    OnsetDetector& firstOnsets, OnsetDetector& secondOnsets);
+
+            /**
+             * transforms the frame loaded into the input buffer for this session's tier and writes its outputs
+             * @param toRet         where the frame will be written or nullptr if it only primes onset detection
+             * @param onsets        the onset detection for the frame
+             */
+            void transformSnapshot(double* toRet, OnsetDetector& onsets);
+
+            /**
+             * transforms the two frames loaded into the input buffer as its real and imaginary parts
+             * and writes their outputs (see analyzeSnapshotPair)
+             */
+            void transformSnapshotPair(double* firstRet, double* secondRet, 
+                                    OnsetDetector& firstOnsets, OnsetDetector& secondOnsets);
+
+            /**
+             * @returns whether analyzeInt16Into loads 16 bit audio straight into the fixed point fft
+             *          (ACCURACY_FIXED without decimation or frame skipping, which read the audio as doubles)
+             */
+            bool loadsInt16() const;
+
+            /**
+             * writes the outputs for the most recent snapshot
+             * @param toRet         where the frame will be written or nullptr if it only primes onset detection
+             * @param onsets        the onset detection for the frame
+             * @param skipped       the FRAME_ value for how the frame was produced
+             */
+            void writeFrame(double* toRet, OnsetDetector& onsets, int skipped = FRAME_ANALYZED);
+
+            /**
+             * writes a frame that is not analyzed: zeros for silence or the most recent snapshot again
+             * @param toRet         where the frame will be written or nullptr if it only primes onset detection
+             * @param onsets        the onset detection for the frame
+             * @param skipped       FRAME_SILENT or FRAME_REPEATED
+             */
+            void writeSkippedFrame(double* toRet, OnsetDetector& onsets, int skipped);
+
+            /**
+             * @param data          the pcm audio data
+             * @param dataSize      the number of items in data
+             * @param startFrame    the starting sample frame in the data array
+             * @param spanSize      the number of sample frames spanned by the analysis
+             * @param decimated     the buffer for decimated audio
+             * @param sourceSize    set to the number of items in the returned data
+             * @returns             the audio to analyze: the data or, if decimating, the decimated span 
+             *                      (starting at startFrame)
+             */
+            const double* analysisSource(const double* data, int dataSize, int startFrame, int spanSize,
+                                    ScratchVector<double>& decimated, int& sourceSize);
+
+            /**
+             * flags the onsets and beats of the analysis in its frames
+             * @param toRet         the frames of the analysis
+             * @param stride        the items between the start of consecutive frames
+             * @param onsets        the onset detection of the analysis
+             */
+            void markOnsets(double* toRet, int stride, const OnsetDetector& onsets);
+
+            /**
+             * @param bin   the bin
+             * @returns     the output value of the bin in the most recent snapshot for this session's tier
+             */
+            double binValue(int bin) const;
+
+            /**
+             * @param first     the first bin
+             * @param end       one past the last bin
+             * @returns         the bins with the fft butterflies their kernel rows need
+             */
+            BinRange binRange(int first, int end) const;
+
+            /**
+             * @returns the bins analyzed by snapshots (the region while analyzing one)
+             */
+            const BinRange& activeBins() const;
 
         public:
             /**
@@ -28,35 +271,191 @@ namespace constantq {
              * @param maxFreq   maximum frequency for  analysis (in Hz)
              * @param bins      bins per octave
              * @param thresh    minimum threshold to be encapsulated for determining bin amplitude in final analysis
+             * @param outputs   the OUTPUT_ flags determining what is produced per frame
+             * @param decimate  whether to decimate the audio to the lowest adequate rate for maxFreq
+             *                  (see decimationFactor) and build the kernel at that rate
+             * @param accuracy  the ACCURACY_ tier
              */
-            ConstantQSession(int fs, double minFreq, double maxFreq, int bins, double thresh);
+            ConstantQSession(int fs, double minFreq, double maxFreq, int bins, double thresh,
+                                int outputs = OUTPUT_BINS, bool decimate = false, int accuracy = ACCURACY_EXACT);
+
+            /**
+             * @param fs        the frames per second of the audio
+             * @param maxFreq   the maximum frequency for analysis
+             * @returns         the largest factor that divides fs and leaves a nyquist frequency with 
+             *                  room for an anti-aliasing filter above maxFreq (1 if none)
+             */
+            static int decimationFactor(int fs, double maxFreq);
+
+            /**
+             * @param fs        the frames per second of the audio
+             * @param maxFreq   the maximum frequency for analysis
+             * @param decimate  whether the session decimates
+             * @returns         the frames per second the session's kernel is built for
+             */
+            static int kernelRate(int fs, double maxFreq, bool decimate);
 
             int bins();
-            
+
+            /**
+             * @returns the number of audio samples analyzed per frame (the fft size times the decimation factor)
+             */
             int size();
 
             /**
-             * threaded analysis using sparse kernel 
-             * @param data          the pcm audio data 
+             * @returns the size of the fft used per frame
+             */
+            int fftSize();
+
+            /**
+             * @returns the decimation factor (1 if not decimating)
+             */
+            int decimation();
+
+            int outputs();
+
+            /**
+             * @returns the ACCURACY_ tier
+             */
+            int accuracy();
+
+            /**
+             * @param frequency the frequency (in Hz)
+             * @returns         the bin nearest the frequency (clamped to the bins) for region analysis of a 
+             *                  pitch range
+             */
+            int binForFrequency(double frequency);
+
+            /**
+             * @returns the sparse kernel used by this session (not held with ACCURACY_FIXED; see hasKernel)
+             */
+            const SparseKernel& kernel() const;
+
+            /**
+             * @returns whether the session holds its sparse kernel (all tiers but ACCURACY_FIXED)
+             */
+            bool hasKernel() const;
+
+            /**
+             * @returns the number of semitones in the note activation output
+             */
+            int notes();
+
+            /**
+             * @returns the index of the chroma within each frame or -1 without OUTPUT_CHROMA
+             */
+            int chromaOffset();
+
+            /**
+             * @returns the number of items produced per analyzed frame for this session's outputs
+             */
+            int frameSize();
+
+            /**
+             * @returns whether consecutive frames are analyzed in pairs sharing one fft
+             *          (all tiers but ACCURACY_EXACT)
+             */
+            bool pairsFrames();
+
+            /**
+             * @returns the onset detection state (flux, tempo, beats) of the most recent analysis
+             *          (the left channel of a stereo analysis)
+             */
+            const OnsetDetector& onsetDetector() const;
+
+            /**
+             * @returns the onset detection state of the right channel of the most recent stereo analysis
+             */
+            const OnsetDetector& onsetDetectorRight() const;
+
+            /**
+             * threaded analysis using sparse kernel
+             * @param data          the pcm audio data
              * @param startFrame    the starting sample frame in the data array
              * @param frameInterval number of frames between analysis
              * @param totalAnalyses number of samples to make
-             * @return              the vector of vectors of form [sample number][bin number]
+             * @return              the vector of vectors of form [sample number][frame item]
              */
             std::vector<std::vector<double> > analyze(
-                                        std::vector<double> data, 
-                                        int startFrame, int frameInterval, int totalAnalyses); 
+                                        const std::vector<double>& data,
+                                        int startFrame, int frameInterval, int totalAnalyses);
+
+
+            /**
+             * analyzes to a single vector where item i = frame item + analysis * frame size
+             * @param data          the pcm audio data
+             * @param startFrame    the starting sample frame in the data array
+             * @param frameInterval number of frames between analysis
+             * @param totalAnalyses number of samples to make
+             * @param primeFrames   number of frames analyzed before the returned frames only to establish
+             *                      spectral flux (the first returned frame is at startFrame + frameInterval * primeFrames)
+             * @return              the vector of all frames one after another
+             */
+            std::vector<double> analyzeToSingle(const std::vector<double>& data,
+                    int startFrame, int frameInterval, int totalAnalyses, int primeFrames = 0);
+
+            /**
+             * analyzes into a caller provided buffer where item i = frame item + analysis * frame size
+             * @param data          the pcm audio data
+             * @param dataSize      the number of items in data
+             * @param startFrame    the starting sample frame in the data array
+             * @param frameInterval number of frames between analysis
+             * @param totalAnalyses number of samples to make
+             * @param toRet         the buffer to hold results (must have room for totalAnalyses * frameSize items)
+             * @param primeFrames   number of frames analyzed before the returned frames only to establish spectral flux
+             * @param cancelled     if provided, checked between frames and analysis stops once it is set
+             * @returns             the number of frames analyzed into toRet (less than totalAnalyses if cancelled)
+             */
+            int analyzeInto(const double* data, int dataSize,
+                    int startFrame, int frameInterval, int totalAnalyses, double* toRet, int primeFrames = 0,
+                    const std::atomic<bool>* cancelled = nullptr);
+
+            /**
+             * analyzeInto for 16 bit pcm audio (read as sample / PCM16_FULL_SCALE); with ACCURACY_FIXED the
+             * samples are loaded straight into the fixed point fft (see loadsInt16), otherwise the span is
+             * converted to double precision in a buffer held by the session
+             */
+            int analyzeInt16Into(const int16_t* data, int dataSize,
+                    int startFrame, int frameInterval, int totalAnalyses, double* toRet, int primeFrames = 0,
+                    const std::atomic<bool>* cancelled = nullptr);
 
+            /**
+             * analyzes two channels separately with one fft per frame for both channels into a caller provided 
+             * buffer where each analysis is the left channel's frame followed by the right channel's frame
+             * @param left          the pcm audio data of the left channel
+             * @param right         the pcm audio data of the right channel
+             * @param dataSize      the number of items in each channel
+             * @param startFrame    the starting sample frame in the data arrays
+             * @param frameInterval number of frames between analysis
+             * @param totalAnalyses number of samples to make
+             * @param toRet         the buffer to hold results (must have room for totalAnalyses * 2 * frameSize items)
+             * @param primeFrames   number of frames analyzed before the returned frames only to establish spectral flux
+             * @param cancelled     if provided, checked between frames and analysis stops once it is set
+             * @returns             the number of analyses written into toRet (less than totalAnalyses if cancelled)
+             */
+            int analyzeStereoInto(const double* left, const double* right, int dataSize,
+                    int startFrame, int frameInterval, int totalAnalyses, double* toRet, int primeFrames = 0,
+                    const std::atomic<bool>* cancelled = nullptr);
 
             /**
-             * analyzes to a single vector where item i = bin + analysis * total bins 
-             * @param data          the pcm audio data 
+             * analyzes a region of interest: frames from startFrame (at any interval, such as one denser than 
+             * a full analysis for a zoomed view) for only the bins [firstBin, endBin), applying only their 
+             * kernel rows to ffts computing only the outputs those rows read, so the cost is proportional 
+             * to the region rather than the full range. only bins are produced (no other outputs or skipping).
+             * @param data          the pcm audio data
+             * @param dataSize      the number of items in data
              * @param startFrame    the starting sample frame in the data array
              * @param frameInterval number of frames between analysis
              * @param totalAnalyses number of samples to make
-             * @return              the vector of vectors of form [sample number][bin number]
+             * @param firstBin      the first bin analyzed
+             * @param endBin        one past the last bin analyzed
+             * @param toRet         the buffer to hold results where item i = bin - firstBin + analysis * 
+             *                      (endBin - firstBin) (must have room for totalAnalyses * (endBin - firstBin) items)
+             * @param cancelled     if provided, checked between frames and analysis stops once it is set
+             * @returns             the number of frames analyzed into toRet (less than totalAnalyses if cancelled)
              */
-            std::vector<double> analyzeToSingle(std::vector<double> data, 
-                    int startFrame, int frameInterval, int totalAnalyses);
+            int analyzeRegionInto(const double* data, int dataSize,
+                    int startFrame, int frameInterval, int totalAnalyses, int firstBin, int endBin, double* toRet,
+                    const std::atomic<bool>* cancelled = nullptr);
     };
 }
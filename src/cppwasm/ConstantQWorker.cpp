@@ -1,31 +1,89 @@
 #include "ConstantQSession.hpp"
+#include "SessionRegistry.hpp"
+#include "KernelCache.hpp"
+#include "StreamingAnalyzer.hpp"
+#include <map>
+#include <memory>
 #include <emscripten/emscripten.h>
-#include <optional>
 #include "WorkerArgs.hpp"
+#include "Profiler.hpp"
+#include "BufferPool.hpp"
 
 using namespace std;
+using namespace constantq;
 
 extern "C" {
-    optional<constantq::ConstantQSession> curSession = nullopt;
+    // the sessions on this worker keyed by session id
+    SessionRegistry sessions;
+
+    // the streamed analyses on this worker keyed by session id
+    map<int, unique_ptr<StreamingAnalyzer> > streams;
+
+    // response buffers reused between chunks so the heap does not grow with each analysis
+    BufferPool<char, MEMORY_MESSAGE> responsePool;
+
+    // the kernel of the most recent session, held after the session is released so a worker reused for 
+    // an analysis with the same settings does not rebuild it (not held for ACCURACY_FIXED sessions, which 
+    // only keep their fixed point kernel)
+    shared_ptr<const SparseKernel> warmKernel;
+
+    // audio is read in place from the message so it must be aligned after the header
+    static_assert(sizeof(ConstantQHeaderArgs) % sizeof(double) == 0, "audio data must be aligned");
+    static_assert(sizeof(ConstantQReturnHeaderArgs) % sizeof(double) == 0, "frame data must be aligned");
+
+    /**
+     * responds with the session's sizes, optionally followed by its serialized kernel
+     * @param session       the session
+     * @param shared        the kernel to serialize for other workers or nullptr if not shared
+     */
+    void respondSession(ConstantQSession& session, const SparseKernel* shared) {
+        auto kernel = shared ? shared->serialize() : vector<char>();
+
+        SparseKernelReturnArgs retArgs;
+        retArgs.size = session.size();
+        retArgs.bins = session.bins();
+        retArgs.frameSize = session.frameSize();
+        retArgs.kernelBytes = kernel.size();
+        retArgs.profile = Profiler::instance().endChunk();
+        retArgs.memory = MemoryTracker::instance().report();
+
+        int retObjSize = sizeof(SparseKernelReturnArgs) + kernel.size();
+        auto retData = responsePool.acquire(retObjSize);
+        std::memcpy(&retData[0], &retArgs, sizeof(SparseKernelReturnArgs));
+        if (!kernel.empty())
+            std::memcpy(&retData[0] + sizeof(SparseKernelReturnArgs), &kernel[0], kernel.size());
+
+        emscripten_worker_respond(&retData[0], retObjSize);
+        responsePool.release(move(retData));
+    }
 
     /**
-     * initialize static-level singleton instance of ConstantQSession
-     * @param data      the data as args to the constant q session (fs,minFreq,maxFreq,bins,thresh)
-     * @param size      should be sizeof(double) * 5
+     * initialize a ConstantQSession in the registry (replacing any session with the same id)
+     * @param data      the data as args to the constant q session 
+     *                  (session,fs,minFreq,maxFreq,bins,thresh,outputs,decimate,accuracy,shareKernel)
+     * @param size      should be sizeof(SparseKernelWorkerArgs)
+     * @return          SparseKernelReturnArgs followed by the serialized kernel if shareKernel is set
      */
     void initializeSession(char* charData, int size) {
         assert(size == sizeof(SparseKernelWorkerArgs));
         SparseKernelWorkerArgs* args = (SparseKernelWorkerArgs*)charData;
+        int sessionId = args->session;
         int fs = args->fs;
         double minFreq = args->minFreq;
         double maxFreq = args->maxFreq;
         int bins = args->bins;
         double thresh = args->thresh;
+        int outputs = args->outputs;
+        bool decimate = args->decimate != 0;
+        int accuracy = args->accuracy;
 
-        curSession = constantq::ConstantQSession(fs,minFreq,maxFreq,bins,thresh);
-        SparseKernelReturnArgs retArgs;
-        retArgs.size = curSession.value().size();
-        retArgs.bins = curSession.value().bins();
+        Profiler::instance().beginChunk();
+
+        // the kernel is held until it is shared even if the session only keeps its fixed point kernel
+        auto kernel = KernelCache::instance().kernel(
+            ConstantQSession::kernelRate(fs, maxFreq, decimate), minFreq, maxFreq, bins, thresh);
+        auto& session = sessions.create(sessionId,fs,minFreq,maxFreq,bins,thresh,outputs,decimate,accuracy);
+        warmKernel = session.hasKernel() ? kernel : nullptr;
 
         #ifdef DEBUG
         EM_ASM({
@@ -36,35 +94,74 @@ extern "C" {
                         'thresh',  $4,
                         'bins',  $5,
                         'size', $6);
-        }, fs, minFreq, maxFreq, bins, thresh, retArgs.bins, retArgs.size);
+        }, fs, minFreq, maxFreq, bins, thresh, session.bins(), session.size());
         #endif
 
-        emscripten_worker_respond((char*) &retArgs, sizeof(SparseKernelReturnArgs));
+        respondSession(session, args->shareKernel != 0 ? kernel.get() : nullptr);
+    }
+
+    /**
+     * initializes a ConstantQSession in the registry with a kernel serialized by another worker's
+     * initializeSession (so the kernel is deserialized rather than built)
+     * @param data      SparseKernelWorkerArgs followed by the serialized kernel
+     * @param size      the size of the data
+     */
+    void loadSession(char* charData, int size) {
+        assert(size > sizeof(SparseKernelWorkerArgs));
+        SparseKernelWorkerArgs* args = (SparseKernelWorkerArgs*)charData;
+        bool decimate = args->decimate != 0;
+
+        // the kernel is held until the session takes it from the cache
+        auto kernel = KernelCache::instance().add(
+            ConstantQSession::kernelRate(args->fs, args->maxFreq, decimate), args->minFreq, args->maxFreq, 
+            args->bins, args->thresh,
+            SparseKernel::deserialize(charData + sizeof(SparseKernelWorkerArgs), size - sizeof(SparseKernelWorkerArgs)));
+
+        auto& session = sessions.create(args->session, args->fs, args->minFreq, args->maxFreq, args->bins, 
+            args->thresh, args->outputs, decimate, args->accuracy);
+        warmKernel = session.hasKernel() ? kernel : nullptr;
     }
 
     /**
-     * threaded analysis using sparse kernel using established singleton 
-     * instance of ConstantQSession
+     * releases a session or stream and its buffers when the worker is kept for another job
+     * (its kernel is freed if no other session uses it and it is not the most recent kernel)
+     * @param data      the ReleaseSessionArgs
+     * @param size      should be sizeof(ReleaseSessionArgs)
+     */
+    void releaseSession(char* charData, int size) {
+        assert(size == sizeof(ReleaseSessionArgs));
+        ReleaseSessionArgs* args = (ReleaseSessionArgs*)charData;
+        sessions.release(args->session);
+        streams.erase(args->session);
+    }
+
+    /**
+     * threaded analysis using sparse kernel using the session in the registry 
+     * identified by the header
      * 
      * @param data          the pcm audio data 
      * @param startFrame    the starting sample frame in the data array
      * @param frameInterval number of frames between analysis
      * @param totalAnalyses number of samples to make
-     * @return              the vector of vectors of form [sample number][bin number]
+     * @return              the frames of form [sample number][frame item] preceded by ConstantQReturnHeaderArgs
      */
     void sessionAnalyze(char* charData, int size) {
-        assert(curSession.has_value());
         assert(size > sizeof(ConstantQHeaderArgs));
         ConstantQHeaderArgs* args = (ConstantQHeaderArgs*)charData;
+        ConstantQSession* session = sessions.find(args->session);
+        assert(session);
 
         int startFrame = args->startFrame;
         int frameInterval = args->frameInterval;
         int totalSamples = args->totalSamples;
         int sampleStart = args->sampleStart;
-        double* audioDataPtr = (double*) (charData + sizeof(ConstantQHeaderArgs));
+        int primeFrames = args->primeFrames;
+        int chunk = args->chunk;
+        bool int16 = args->sampleFormat == SAMPLE_FORMAT_INT16;
+        char* audioDataPtr = charData + sizeof(ConstantQHeaderArgs);
 
-        int arrSize = (size - sizeof(ConstantQHeaderArgs)) / sizeof(double);
-        int totLen = startFrame + frameInterval * (totalSamples - 1) + curSession.value().size();
+        int arrSize = (size - sizeof(ConstantQHeaderArgs)) / (int16 ? sizeof(int16_t) : sizeof(double));
+        int totLen = startFrame + frameInterval * (primeFrames + totalSamples - 1) + session->size();
 
         #ifdef DEBUG
         EM_ASM({
@@ -77,37 +174,114 @@ extern "C" {
                         'bins', $6,
                         'sparse kernel size', $7);
         }, startFrame, frameInterval, totalSamples, sampleStart, arrSize, 
-            totLen, curSession.value().bins(), curSession.value().size());
+            totLen, session->bins(), session->size());
 
         #endif
 
         assert(arrSize >= totLen);
 
-        vector<double> audioData(audioDataPtr, audioDataPtr + arrSize);
+        auto& profiler = Profiler::instance();
+        profiler.beginChunk();
 
         #ifdef DEBUG
-        for (int i = 0; i < min(100, (int)audioData.size()); i+=10)
-            EM_ASM({ console.log('audio item', $0, $1); }, i, audioData[i]);
+        for (int i = 0; i < min(100, arrSize); i+=10)
+            EM_ASM({ console.log('audio item', $0, $1); }, i, 
+                int16 ? ((int16_t*) audioDataPtr)[i] / PCM16_FULL_SCALE : ((double*) audioDataPtr)[i]);
         #endif
 
-        auto evaluated = curSession.value().analyzeToSingle(audioData,startFrame,frameInterval,totalSamples);
+        // frames are analyzed straight from the message into the response after its header
+        int evaluatedSize = totalSamples * session->frameSize();
+        int retObjSize = sizeof(ConstantQReturnHeaderArgs) + evaluatedSize * sizeof(double);
+        auto retData = responsePool.acquire(retObjSize);
+        double* evaluated = (double*) (&retData[0] + sizeof(ConstantQReturnHeaderArgs));
+
+        if (int16) {
+            session->analyzeInt16Into((const int16_t*) audioDataPtr, arrSize, startFrame, frameInterval, 
+                totalSamples, evaluated, primeFrames);
+        }
+        else {
+            session->analyzeInto((const double*) audioDataPtr, arrSize, startFrame, frameInterval, 
+                totalSamples, evaluated, primeFrames);
+        }
 
         #ifdef DEBUG
-        for (int i = 0; i < 10; i++)
+        for (int i = 0; i < min(10, evaluatedSize); i++)
             EM_ASM({ console.log('evaluated item ', $0); }, evaluated[i]);
         #endif
 
         ConstantQReturnHeaderArgs retArgs;
-        retArgs.bins = curSession.value().bins();
+        retArgs.bins = session->bins();
         retArgs.sampleStart = sampleStart;
         retArgs.totalSamples = totalSamples;
+        retArgs.frameSize = session->frameSize();
+        retArgs.chunk = chunk;
+        retArgs.totalFrames = STREAM_FRAMES_UNKNOWN;
+
+        retArgs.memory = MemoryTracker::instance().report();
+        retArgs.profile = profiler.endChunk();
+        std::memcpy(&retData[0], &retArgs, sizeof(ConstantQReturnHeaderArgs));
+
+        // the response is copied when posted so the buffer can be reused immediately
+        emscripten_worker_respond(&retData[0], retObjSize);
+        responsePool.release(move(retData));
+    }
+
+    /**
+     * analyzes a slice of a streamed wav file responding with the frames completed by the slice
+     * (the stream is created with its first slice and released after its last)
+     * 
+     * @param data      StreamSliceHeaderArgs followed by the slice's bytes
+     * @param size      the size of the data
+     * @return          the completed frames of form [sample number][frame item] preceded by 
+     *                  ConstantQReturnHeaderArgs
+     */
+    void streamAnalyze(char* charData, int size) {
+        assert(size >= sizeof(StreamSliceHeaderArgs));
+        StreamSliceHeaderArgs* args = (StreamSliceHeaderArgs*)charData;
+        int sessionId = args->session;
+
+        auto& profiler = Profiler::instance();
+        profiler.beginChunk();
+
+        auto& stream = streams[sessionId];
+        if (!stream) {
+            StreamSettings settings = { args->minFreq, args->maxFreq, args->bins, args->thresh,
+                args->outputs, args->decimate != 0, args->accuracy, args->framesPerSecond, args->windowFrames };
+            stream.reset(new StreamingAnalyzer(settings));
+        }
+
+        bool valid = stream->push(charData + sizeof(StreamSliceHeaderArgs), size - sizeof(StreamSliceHeaderArgs));
+        if (valid && args->final)
+            stream->finish();
+
+        ConstantQSession* session = stream->session();
+        int frameSize = session ? session->frameSize() : 0;
+        int totalSamples = stream->outputFrames();
+
+        int evaluatedSize = totalSamples * frameSize;
+        int retObjSize = sizeof(ConstantQReturnHeaderArgs) + evaluatedSize * sizeof(double);
+        auto retData = responsePool.acquire(retObjSize);
+        if (evaluatedSize > 0)
+            std::memcpy(&retData[0] + sizeof(ConstantQReturnHeaderArgs), stream->output(), 
+                evaluatedSize * sizeof(double));
+
+        ConstantQReturnHeaderArgs retArgs;
+        retArgs.bins = session ? session->bins() : 0;
+        retArgs.sampleStart = stream->outputStart();
+        retArgs.totalSamples = totalSamples;
+        retArgs.frameSize = frameSize;
+        retArgs.chunk = args->slice;
+        retArgs.totalFrames = valid ? stream->totalFrames() : STREAM_INVALID;
 
-        int retObjSize = sizeof(ConstantQReturnHeaderArgs) + evaluated.size() * sizeof(double);
-        vector<char> retData(retObjSize);
+        stream->consumeOutput();
+        if (!valid || args->final)
+            streams.erase(sessionId);
 
+        retArgs.memory = MemoryTracker::instance().report();
+        retArgs.profile = profiler.endChunk();
         std::memcpy(&retData[0], &retArgs, sizeof(ConstantQReturnHeaderArgs));
-        std::memcpy(&retData[0] + sizeof(ConstantQReturnHeaderArgs), &evaluated[0], sizeof(double) * evaluated.size());
 
         emscripten_worker_respond(&retData[0], retObjSize);
+        responsePool.release(move(retData));
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,382 @@
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include "FingerprintIndex.hpp"
+#include "ConstantQSession.hpp"
+
+using namespace std;
+
+namespace constantq {
+    // identifies a serialized index ('CQFI') and its layout
+    const int SERIALIZED_INDEX_MAGIC = 0x49465143;
+    const int SERIALIZED_INDEX_VERSION = 2;
+
+    // the frames of a track record removing the track
+    const int SERIALIZED_TRACK_REMOVED = -1;
+
+    // the log is rewritten by save once it holds more than this many times the bytes of the tracks it leaves
+    const int SERIALIZED_LOG_GROWTH = 2;
+
+    /**
+     * precedes the track records of a serialized index
+     */
+    struct SerializedIndexHeader {
+        int magic;
+        int version;
+    };
+
+    /**
+     * precedes the fingerprints of each track record in a serialized index; records are applied in order so a
+     * later record for a track replaces an earlier one
+     */
+    struct SerializedTrackHeader {
+        int track;
+        // the fingerprints following the header or SERIALIZED_TRACK_REMOVED
+        int frames;
+    };
+
+    FingerprintIndex::FingerprintIndex() : _totalFingerprints(0), _logBytes(0) { }
+
+    vector<uint32_t> FingerprintIndex::fingerprints(const double* chroma, int totalFrames, int stride) {
+        vector<uint32_t> toRet(totalFrames);
+
+        // each pitch class's share of the previous frame's chroma (none after a silent frame)
+        double previous[CHROMA_SIZE];
+        bool hasPrevious = false;
+        for (int f = 0; f < totalFrames; f++) {
+            const double* frame = chroma + (size_t) stride * f;
+            double sum = 0;
+            for (int c = 0; c < CHROMA_SIZE; c++)
+                sum += frame[c];
+
+            if (sum < FINGERPRINT_SILENCE) {
+                toRet[f] = FINGERPRINT_SILENT;
+                hasPrevious = false;
+                continue;
+            }
+
+            uint32_t fingerprint = 0;
+            for (int c = 0; c < CHROMA_SIZE; c++) {
+                if (frame[c] > frame[(c + 1) % CHROMA_SIZE])
+                    fingerprint |= 1u << c;
+
+                double share = frame[c] / sum;
+                if (hasPrevious && share - previous[c] > FINGERPRINT_RISE)
+                    fingerprint |= 1u << (CHROMA_SIZE + c);
+
+                previous[c] = share;
+            }
+
+            toRet[f] = fingerprint;
+            hasPrevious = true;
+        }
+
+        return toRet;
+    }
+
+    uint64_t FingerprintIndex::pairKey(const vector<uint32_t>& fingerprints, int frame) {
+        int paired = frame + FINGERPRINT_PAIR_FRAMES;
+        if (paired >= fingerprints.size() || fingerprints[frame] == FINGERPRINT_SILENT || 
+                fingerprints[paired] == FINGERPRINT_SILENT)
+            return 0;
+
+        // the top bit distinguishes a pair of empty fingerprints from no pair
+        return (1ull << 63) | ((uint64_t) fingerprints[frame] << FINGERPRINT_BITS) | fingerprints[paired];
+    }
+
+    void FingerprintIndex::post(int track, const vector<uint32_t>& fingerprints) {
+        for (int f = 0; f < fingerprints.size(); f++) {
+            if (fingerprints[f] == FINGERPRINT_SILENT)
+                continue;
+
+            _totalFingerprints++;
+            uint64_t key = pairKey(fingerprints, f);
+            if (key != 0)
+                _postings[key].push_back({ track, f });
+        }
+    }
+
+    int FingerprintIndex::addTrack(int track, const double* chroma, int totalFrames, int stride) {
+        removeTrack(track);
+        _unsaved.insert(track);
+
+        auto& trackFingerprints = _tracks[track];
+        trackFingerprints = fingerprints(chroma, totalFrames, stride);
+
+        int before = _totalFingerprints;
+        post(track, trackFingerprints);
+        return _totalFingerprints - before;
+    }
+
+    bool FingerprintIndex::removeTrack(int track) {
+        auto found = _tracks.find(track);
+        if (found == _tracks.end())
+            return false;
+
+        // each posting list holding the track is filtered once
+        auto& fingerprints = found->second;
+        vector<uint64_t> keys;
+        for (int f = 0; f < fingerprints.size(); f++) {
+            if (fingerprints[f] != FINGERPRINT_SILENT)
+                _totalFingerprints--;
+
+            uint64_t key = pairKey(fingerprints, f);
+            if (key != 0)
+                keys.push_back(key);
+        }
+
+        sort(keys.begin(), keys.end());
+        keys.erase(unique(keys.begin(), keys.end()), keys.end());
+        for (auto key : keys) {
+            auto postings = _postings.find(key);
+            if (postings == _postings.end())
+                continue;
+
+            auto& list = postings->second;
+            list.erase(remove_if(list.begin(), list.end(), [track](const Posting& p) { return p.track == track; }),
+                list.end());
+            if (list.empty())
+                _postings.erase(postings);
+        }
+
+        _tracks.erase(found);
+        _unsaved.insert(track);
+        return true;
+    }
+
+    double FingerprintIndex::score(int track, const vector<uint32_t>& query, int offset) const {
+        auto& trackFingerprints = _tracks.at(track);
+        int trackFrames = trackFingerprints.size();
+
+        // frames beyond the track or silent in it count as unmatched
+        int matched = 0;
+        int total = 0;
+        for (int q = 0; q < query.size(); q++) {
+            if (query[q] == FINGERPRINT_SILENT)
+                continue;
+
+            total++;
+            int f = q + offset;
+            if (f < 0 || f >= trackFrames || trackFingerprints[f] == FINGERPRINT_SILENT)
+                continue;
+
+            if (bitset<32>(query[q] ^ trackFingerprints[f]).count() <= FINGERPRINT_MATCH_DISTANCE)
+                matched++;
+        }
+
+        return total > 0 ? (double) matched / total : 0;
+    }
+
+    vector<SimilarTrack> FingerprintIndex::query(const double* chroma, int totalFrames, int stride, int k) const {
+        // no more tracks are found than are indexed (so large k does not overflow the candidates)
+        k = max(0, min(k, totalTracks()));
+        auto queryFingerprints = fingerprints(chroma, totalFrames, stride);
+        int common = max(FINGERPRINT_MIN_COMMON, (int) (FINGERPRINT_COMMON_SHARE * _totalFingerprints));
+
+        // votes for each track and alignment (the track frame aligned with the first query frame)
+        map<pair<int, int>, int> votes;
+        for (int q = 0; q < totalFrames; q++) {
+            uint64_t key = pairKey(queryFingerprints, q);
+            if (key == 0)
+                continue;
+
+            // the pair itself and each pair one bit away
+            for (int bit = -1; bit < 2 * FINGERPRINT_BITS; bit++) {
+                auto found = _postings.find(bit < 0 ? key : key ^ (1ull << bit));
+                if (found == _postings.end() || found->second.size() > common)
+                    continue;
+
+                for (auto& posting : found->second)
+                    votes[{ posting.track, posting.frame - q }]++;
+            }
+        }
+
+        // the alignment with the most votes for each track
+        map<int, pair<int, int> > best;
+        for (auto& vote : votes) {
+            auto& trackBest = best[vote.first.first];
+            if (vote.second > trackBest.first)
+                trackBest = { vote.second, vote.first.second };
+        }
+
+        vector<pair<int, int> > candidates;
+        for (auto& trackBest : best)
+            candidates.push_back({ trackBest.second.first, trackBest.first });
+
+        sort(candidates.begin(), candidates.end(), greater<pair<int, int> >());
+        candidates.resize(min((int) candidates.size(), k * FINGERPRINT_CANDIDATES));
+
+        vector<SimilarTrack> toRet;
+        for (auto& candidate : candidates) {
+            int offset = best[candidate.second].second;
+            toRet.push_back({ candidate.second, score(candidate.second, queryFingerprints, offset), offset });
+        }
+
+        sort(toRet.begin(), toRet.end(), [](const SimilarTrack& a, const SimilarTrack& b) {
+            return a.score > b.score || (a.score == b.score && a.track < b.track);
+        });
+        toRet.resize(min((int) toRet.size(), max(k, 0)));
+        return toRet;
+    }
+
+    int FingerprintIndex::totalTracks() const { return _tracks.size(); }
+
+    int FingerprintIndex::totalFingerprints() const { return _totalFingerprints; }
+
+    size_t FingerprintIndex::recordSize(int track) const {
+        auto found = _tracks.find(track);
+        return sizeof(SerializedTrackHeader) + (found != _tracks.end() ? sizeof(uint32_t) * found->second.size() : 0);
+    }
+
+    char* FingerprintIndex::writeRecord(int track, char* position) const {
+        auto found = _tracks.find(track);
+        SerializedTrackHeader trackHeader = { track, 
+            found != _tracks.end() ? (int) found->second.size() : SERIALIZED_TRACK_REMOVED };
+        memcpy(position, &trackHeader, sizeof(SerializedTrackHeader));
+        position += sizeof(SerializedTrackHeader);
+
+        if (trackHeader.frames > 0)
+            memcpy(position, found->second.data(), sizeof(uint32_t) * trackHeader.frames);
+
+        return position + sizeof(uint32_t) * max(trackHeader.frames, 0);
+    }
+
+    vector<char> FingerprintIndex::serialize() const {
+        size_t size = sizeof(SerializedIndexHeader);
+        for (auto& track : _tracks)
+            size += recordSize(track.first);
+
+        vector<char> toRet(size);
+        SerializedIndexHeader header = { SERIALIZED_INDEX_MAGIC, SERIALIZED_INDEX_VERSION };
+        memcpy(&toRet[0], &header, sizeof(SerializedIndexHeader));
+
+        char* position = &toRet[0] + sizeof(SerializedIndexHeader);
+        for (auto& track : _tracks)
+            position = writeRecord(track.first, position);
+
+        return toRet;
+    }
+
+    bool FingerprintIndex::deserialize(const char* data, int size) {
+        // items are copied out rather than read in place as the bytes may not be aligned
+        SerializedIndexHeader header;
+        if (!data || size < (int) sizeof(SerializedIndexHeader))
+            return false;
+
+        memcpy(&header, data, sizeof(SerializedIndexHeader));
+        if (header.magic != SERIALIZED_INDEX_MAGIC || header.version != SERIALIZED_INDEX_VERSION)
+            return false;
+
+        // the records are applied before posting so tracks replaced or removed later in the log are not posted
+        map<int, vector<uint32_t> > tracks;
+        const char* position = data + sizeof(SerializedIndexHeader);
+        const char* end = data + size;
+        while (position < end) {
+            SerializedTrackHeader trackHeader;
+            if (end - position < (ptrdiff_t) sizeof(SerializedTrackHeader))
+                return false;
+
+            memcpy(&trackHeader, position, sizeof(SerializedTrackHeader));
+            position += sizeof(SerializedTrackHeader);
+            if (trackHeader.frames == SERIALIZED_TRACK_REMOVED) {
+                tracks.erase(trackHeader.track);
+                continue;
+            }
+
+            if (trackHeader.frames < 0 || (size_t) (end - position) / sizeof(uint32_t) < (size_t) trackHeader.frames)
+                return false;
+
+            auto& fingerprints = tracks[trackHeader.track];
+            fingerprints.resize(trackHeader.frames);
+            if (trackHeader.frames > 0)
+                memcpy(fingerprints.data(), position, sizeof(uint32_t) * trackHeader.frames);
+
+            position += sizeof(uint32_t) * trackHeader.frames;
+        }
+
+        _tracks = move(tracks);
+        _postings.clear();
+        _totalFingerprints = 0;
+        for (auto& track : _tracks)
+            post(track.first, track.second);
+
+        _unsaved.clear();
+        _logPath.clear();
+        return true;
+    }
+
+    bool FingerprintIndex::save(const string& path) {
+        size_t compacted = sizeof(SerializedIndexHeader);
+        for (auto& track : _tracks)
+            compacted += recordSize(track.first);
+
+        size_t appended = 0;
+        for (auto track : _unsaved)
+            appended += recordSize(track);
+
+        // the records of tracks changed since the log was last written or read are appended if the file is
+        // still as it was then; otherwise (or once the log holds mostly replaced tracks) it is rewritten
+        if (path == _logPath && _logBytes + appended <= SERIALIZED_LOG_GROWTH * compacted) {
+            FILE* file = fopen(path.c_str(), "r+b");
+            if (file && fseek(file, 0, SEEK_END) == 0 && ftell(file) == _logBytes) {
+                vector<char> data(appended);
+                char* position = data.data();
+                for (auto track : _unsaved)
+                    position = writeRecord(track, position);
+
+                bool written = fwrite(data.data(), 1, data.size(), file) == data.size();
+                written = fclose(file) == 0 && written;
+
+                // a partial record is overwritten by rewriting the log on the next save
+                _logPath = written ? path : string();
+                if (written) {
+                    _logBytes += appended;
+                    _unsaved.clear();
+                }
+
+                return written;
+            }
+
+            if (file)
+                fclose(file);
+        }
+
+        auto data = serialize();
+        FILE* file = fopen(path.c_str(), "wb");
+        if (!file)
+            return false;
+
+        bool written = fwrite(data.data(), 1, data.size(), file) == data.size();
+        written = fclose(file) == 0 && written;
+        _logPath = written ? path : string();
+        _logBytes = data.size();
+        if (written)
+            _unsaved.clear();
+
+        return written;
+    }
+
+    bool FingerprintIndex::load(const string& path) {
+        FILE* file = fopen(path.c_str(), "rb");
+        if (!file)
+            return false;
+
+        vector<char> data;
+        char buffer[1 << 16];
+        size_t read;
+        while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+            data.insert(data.end(), buffer, buffer + read);
+
+        bool failed = ferror(file) != 0;
+        fclose(file);
+        if (failed || !deserialize(data.data(), data.size()))
+            return false;
+
+        // later saves to the file append to it
+        _logPath = path;
+        _logBytes = data.size();
+        return true;
+    }
+}
@@ -0,0 +1,192 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace constantq {
+    // the bits of a frame's fingerprint: 12 for the chroma's shape (whether each pitch class is louder than
+    // the next) and 12 for its change (whether each pitch class rose by FINGERPRINT_RISE since the last frame)
+    const int FINGERPRINT_BITS = 24;
+
+    // the fingerprint of a frame too quiet to fingerprint (not indexed and not matched)
+    const uint32_t FINGERPRINT_SILENT = 0xffffffff;
+
+    // the chroma sum below which a frame is silent
+    const double FINGERPRINT_SILENCE = 1e-4;
+
+    // the rise in a pitch class's share of the chroma setting its change bit
+    const double FINGERPRINT_RISE = .05;
+
+    // frames are posted in pairs of fingerprints this many frames apart, as one frame's fingerprint is shared 
+    // by too many frames of other tracks to discriminate them
+    const int FINGERPRINT_PAIR_FRAMES = 4;
+
+    // posting lists holding more than this share of all fingerprints (and at least FINGERPRINT_MIN_COMMON)
+    // are too common to discriminate tracks and are skipped by queries
+    const double FINGERPRINT_COMMON_SHARE = .01;
+    const int FINGERPRINT_MIN_COMMON = 256;
+
+    // the most bits a frame's fingerprint may differ from the aligned frame of a track to match it
+    const int FINGERPRINT_MATCH_DISTANCE = 3;
+
+    // the tracks scored in full per result requested
+    const int FINGERPRINT_CANDIDATES = 4;
+
+    /**
+     * a track matched by FingerprintIndex::query
+     */
+    struct SimilarTrack {
+        int track;
+        // the share of the query's frames (those not silent) matched at the best alignment (0 to 1)
+        double score;
+        // the track frame aligned with the first query frame (negative if the query starts before the track)
+        int offset;
+    };
+
+    /**
+     * an index of tracks by the binary fingerprints of their chroma frames (see ConstantQSession OUTPUT_CHROMA)
+     * to find similar or duplicate recordings. each frame is posted under its fingerprint paired with that of
+     * the frame FINGERPRINT_PAIR_FRAMES later so a query looks up each of its pairs and those one bit away, 
+     * voting for a track and alignment with each posting found; only the tracks with the most votes are 
+     * scored in full, so the cost of a query follows its length and the postings sharing its pairs rather 
+     * than the number of tracks.
+     * tracks are added as they are analyzed and the index is saved as a log of the fingerprints of each track
+     * added or removed, so saving to the file last saved or loaded only appends the tracks changed since
+     * (loading applies the log and posts the tracks left in it once).
+     */
+    class FingerprintIndex {
+        private:
+            // the frame of a track with a fingerprint
+            struct Posting {
+                int track;
+                int frame;
+            };
+
+            // the fingerprints of each track by track id
+            std::map<int, std::vector<uint32_t> > _tracks;
+
+            // the frames with each pair of fingerprints (see pairKey)
+            std::unordered_map<uint64_t, std::vector<Posting> > _postings;
+
+            int _totalFingerprints;
+
+            // the tracks added or removed since the index was last saved or loaded
+            std::set<int> _unsaved;
+
+            // the file the index was last saved to or loaded from and its size then (empty if neither or if
+            // the index was replaced by deserialize since)
+            std::string _logPath;
+            long _logBytes;
+
+            /**
+             * @param fingerprints  the fingerprints of a track or query
+             * @param frame         the first frame of the pair
+             * @returns             the key of the frame's pair or 0 if either frame is silent or past the end
+             */
+            static uint64_t pairKey(const std::vector<uint32_t>& fingerprints, int frame);
+
+            /**
+             * posts the fingerprints of a track
+             */
+            void post(int track, const std::vector<uint32_t>& fingerprints);
+
+            /**
+             * @param track         the track
+             * @param query         the query's fingerprints
+             * @param offset        the track frame aligned with the first query frame
+             * @returns             the score of the track at the alignment (see SimilarTrack)
+             */
+            double score(int track, const std::vector<uint32_t>& query, int offset) const;
+
+            /**
+             * @param track         the track
+             * @returns             the bytes of the track's record in a serialized index (see writeRecord)
+             */
+            size_t recordSize(int track) const;
+
+            /**
+             * writes the record of a track's fingerprints or, if it is not indexed, of its removal
+             * @param track         the track
+             * @param position      where to write the record (recordSize bytes)
+             * @returns             the position after the record
+             */
+            char* writeRecord(int track, char* position) const;
+
+        public:
+            FingerprintIndex();
+
+            /**
+             * @param chroma        the chroma of the first frame (CHROMA_SIZE items)
+             * @param totalFrames   the number of frames
+             * @param stride        the items from one frame's chroma to the next (frameSize for frames of
+             *                      ConstantQSession with chroma at its chromaOffset)
+             * @returns             the fingerprint of each frame (FINGERPRINT_SILENT for silent frames)
+             */
+            static std::vector<uint32_t> fingerprints(const double* chroma, int totalFrames, int stride);
+
+            /**
+             * indexes a track (replacing any track with the same id)
+             * @param track         the track id
+             * @param chroma        see fingerprints
+             * @param totalFrames   the number of frames
+             * @param stride        see fingerprints
+             * @returns             the number of frames indexed (those not silent)
+             */
+            int addTrack(int track, const double* chroma, int totalFrames, int stride);
+
+            /**
+             * @param track         the track id
+             * @returns             whether the track was indexed
+             */
+            bool removeTrack(int track);
+
+            /**
+             * finds the tracks most similar to chroma frames (such as all or an excerpt of another track)
+             * @param chroma        see fingerprints
+             * @param totalFrames   the number of frames
+             * @param stride        see fingerprints
+             * @param k             the most tracks returned
+             * @returns             the tracks matched ordered from the most similar
+             */
+            std::vector<SimilarTrack> query(const double* chroma, int totalFrames, int stride, int k) const;
+
+            int totalTracks() const;
+
+            /**
+             * @returns the number of frames indexed for all tracks
+             */
+            int totalFingerprints() const;
+
+            /**
+             * @returns the fingerprints of each track as bytes to be restored by deserialize (a log with one 
+             *          record per track)
+             */
+            std::vector<char> serialize() const;
+
+            /**
+             * replaces the index with one serialized by serialize
+             * @param data      the bytes from serialize
+             * @param size      the number of bytes
+             * @returns         whether the bytes were a serialized index (the index is unchanged otherwise)
+             */
+            bool deserialize(const char* data, int size);
+
+            /**
+             * writes the index to a file, appending the tracks changed since if the file is the one last saved
+             * or loaded and is unchanged since (the file is rewritten once it is mostly replaced tracks)
+             * @param path      the file to write
+             * @returns         whether the index was written
+             */
+            bool save(const std::string& path);
+
+            /**
+             * replaces the index with one written by save
+             * @param path      the file to read
+             * @returns         whether the file held an index (the index is unchanged otherwise)
+             */
+            bool load(const std::string& path);
+    };
+}
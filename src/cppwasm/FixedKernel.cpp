@@ -0,0 +1,101 @@
+#include <complex>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "FixedKernel.hpp"
+
+using namespace std;
+
+namespace constantq {
+    FixedKernel::FixedKernel(const SparseKernel& kernel) : _rowStarts(1, 0) {
+        _size = kernel.size();
+        _bins = kernel.bins();
+
+        double fixedOne = (double) (1 << FIXED_KERNEL_BITS);
+        for (int b = 0; b < _bins; b++) {
+            auto row = kernel.row(b);
+            int rowSize = kernel.rowSize(b);
+
+            double largest = 0;
+            for (int e = 0; e < rowSize; e++) {
+                auto multiplier = row[e].multiplier();
+                largest = max(largest, max(abs(multiplier.real()), abs(multiplier.imag())));
+            }
+
+            // the largest component maps to the largest Q15 value
+            double rowScale = largest > 0 ? largest / (fixedOne - 1) : 1;
+            _rowScales.push_back(rowScale);
+            for (int e = 0; e < rowSize; e++) {
+                auto multiplier = row[e].multiplier() / rowScale;
+                _entries.push_back({ row[e].fftIndex(), 
+                    (int16_t) lround(multiplier.real()), (int16_t) lround(multiplier.imag()) });
+            }
+
+            _rowStarts.push_back(_entries.size());
+        }
+    }
+
+    int FixedKernel::size() const { return _size; }
+
+    int FixedKernel::bins() const { return _bins; }
+
+    vector<int> FixedKernel::fftIndices(int firstBin, int endBin) const {
+        vector<int> toRet;
+        for (int e = _rowStarts[firstBin]; e < _rowStarts[endBin]; e++)
+            toRet.push_back(_entries[e].fftIndex);
+
+        return toRet;
+    }
+
+    void FixedKernel::apply(const FixedComplex* arr, double scale, complex<double>* analyzed,
+        int firstBin, int endBin) const {
+
+        int totalBins = endBin < 0 ? _bins : endBin;
+        for (int b = firstBin; b < totalBins; b++) {
+            int64_t real = 0;
+            int64_t imag = 0;
+            for (int e = _rowStarts[b]; e < _rowStarts[b + 1]; e++) {
+                auto& entry = _entries[e];
+                auto& value = arr[entry.fftIndex];
+                real += (int64_t) value.real * entry.real - (int64_t) value.imag * entry.imag;
+                imag += (int64_t) value.real * entry.imag + (int64_t) value.imag * entry.real;
+            }
+
+            analyzed[b] = complex<double>((double) real, (double) imag) * (scale * _rowScales[b]);
+        }
+    }
+
+    void FixedKernel::applyPair(const FixedComplex* arr, double scale, 
+        complex<double>* first, complex<double>* second, int firstBin, int endBin) const {
+
+        int mask = _size - 1;
+        int totalBins = endBin < 0 ? _bins : endBin;
+        for (int b = firstBin; b < totalBins; b++) {
+            int64_t sumReal = 0;
+            int64_t sumImag = 0;
+            int64_t differenceReal = 0;
+            int64_t differenceImag = 0;
+            for (int e = _rowStarts[b]; e < _rowStarts[b + 1]; e++) {
+                auto& entry = _entries[e];
+                auto& value = arr[entry.fftIndex];
+                auto& mirror = arr[(-entry.fftIndex) & mask];
+
+                // the value plus and minus the conjugate of its mirror
+                int64_t plusReal = (int64_t) value.real + mirror.real;
+                int64_t plusImag = (int64_t) value.imag - mirror.imag;
+                int64_t minusReal = (int64_t) value.real - mirror.real;
+                int64_t minusImag = (int64_t) value.imag + mirror.imag;
+
+                sumReal += plusReal * entry.real - plusImag * entry.imag;
+                sumImag += plusReal * entry.imag + plusImag * entry.real;
+                differenceReal += minusReal * entry.real - minusImag * entry.imag;
+                differenceImag += minusReal * entry.imag + minusImag * entry.real;
+            }
+
+            // halves as in ConstantQ::applyKernelPair with the difference divided by i
+            double rowScale = .5 * scale * _rowScales[b];
+            first[b] = complex<double>((double) sumReal, (double) sumImag) * rowScale;
+            second[b] = complex<double>((double) differenceImag, (double) -differenceReal) * rowScale;
+        }
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <complex>
+#include <vector>
+#include <cstdint>
+#include "SparseKernel.hpp"
+#include "MathUtil.hpp"
+#include "MemoryTracker.hpp"
+
+namespace constantq {
+    // the fraction bits of fixed point kernel multipliers relative to their row's scale (Q15)
+    const int FIXED_KERNEL_BITS = 15;
+
+    /**
+     * a kernel entry with a Q15 multiplier (8 bytes rather than the 24 of a KernelEntry)
+     */
+    struct FixedKernelEntry {
+        int32_t fftIndex;
+        int16_t real;
+        int16_t imag;
+    };
+
+    /**
+     * a sparse kernel with fixed point multipliers applied to the fixed point fft with integer arithmetic
+     * (each row is scaled so its largest multiplier component uses the full Q15 range)
+     */
+    class FixedKernel {
+        private:
+            // the entries for bin b are from _rowStarts[b] up to _rowStarts[b + 1]
+            KernelVector<FixedKernelEntry> _entries;
+            KernelVector<int> _rowStarts;
+
+            // the multiplier represented by an entry component of 1 for each row
+            KernelVector<double> _rowScales;
+
+            int _size;
+            int _bins;
+
+        public:
+            /**
+             * @param kernel    the kernel to convert
+             */
+            FixedKernel(const SparseKernel& kernel);
+
+            int size() const;
+            int bins() const;
+
+            /**
+             * @param firstBin  the first bin
+             * @param endBin    one past the last bin
+             * @returns         the fft index of each entry of the bins' rows
+             */
+            std::vector<int> fftIndices(int firstBin, int endBin) const;
+
+            /**
+             * applies the kernel to a fixed point fft accumulating each bin in 64 bit integers
+             * @param arr       the fixed point fft
+             * @param scale     the value of 1 in the fft (including its block exponent)
+             * @param analyzed  the array that will contain results (must be bins in size)
+             * @param firstBin  the first bin applied
+             * @param endBin    one past the last bin applied (-1 for every bin)
+             */
+            void apply(const FixedComplex* arr, double scale, std::complex<double>* analyzed,
+                int firstBin = 0, int endBin = -1) const;
+
+            /**
+             * applies the kernel to the fixed point fft of two real signals packed as real and imaginary parts
+             * (see ConstantQ::applyKernelPair)
+             * @param arr       the fixed point fft of the packed signals
+             * @param scale     the value of 1 in the fft (including its block exponent)
+             * @param first     the results for the real part (must be bins in size)
+             * @param second    the results for the imaginary part (must be bins in size)
+             * @param firstBin  the first bin applied
+             * @param endBin    one past the last bin applied (-1 for every bin)
+             */
+            void applyPair(const FixedComplex* arr, double scale, 
+                std::complex<double>* first, std::complex<double>* second, int firstBin = 0, int endBin = -1) const;
+    };
+}
@@ -0,0 +1,85 @@
+#include <cmath>
+#include <cassert>
+#include "FrameGate.hpp"
+
+using namespace std;
+
+namespace constantq {
+    FrameGate::FrameGate(int windowSize, bool skipSilent, bool skipRepeated) 
+        : _windowSize(windowSize), _skipSilent(skipSilent), _skipRepeated(skipRepeated) {
+        reset(nullptr);
+    }
+
+    void FrameGate::reset(const double* source) {
+        _source = source;
+        _start = -1;
+        _energy = 0;
+        _crossings = 0;
+        _hasReference = false;
+        _referenceEnergy = 0;
+        _referenceCrossings = 0;
+        _repeats = 0;
+    }
+
+    int FrameGate::crossing(int index) const {
+        return (_source[index - 1] < 0) != (_source[index] < 0) ? 1 : 0;
+    }
+
+    void FrameGate::advance(int start) {
+        assert(start >= _start);
+
+        // windows that do not overlap are summed anew
+        if (_start < 0 || start - _start >= _windowSize) {
+            _energy = 0;
+            _crossings = 0;
+            for (int i = start; i < start + _windowSize; i++) {
+                _energy += _source[i] * _source[i];
+                if (i > start)
+                    _crossings += crossing(i);
+            }
+        }
+        else {
+            for (int i = _start; i < start; i++) {
+                _energy -= _source[i] * _source[i];
+                _crossings -= crossing(i + 1);
+            }
+
+            for (int i = _start + _windowSize; i < start + _windowSize; i++) {
+                _energy += _source[i] * _source[i];
+                _crossings += crossing(i);
+            }
+
+            // the running sum can drift slightly below zero after loud audio
+            _energy = max(0., _energy);
+        }
+
+        _start = start;
+    }
+
+    int FrameGate::classify(int start) {
+        if (!_skipSilent && !_skipRepeated)
+            return FRAME_ANALYZED;
+
+        advance(start);
+
+        // audio following silence is analyzed rather than repeating a frame from before the silence
+        if (_skipSilent && _energy < SILENCE_RMS * SILENCE_RMS * _windowSize) {
+            _hasReference = false;
+            return FRAME_SILENT;
+        }
+
+        if (_skipRepeated && _hasReference && _repeats < MAX_REPEATED_FRAMES &&
+            abs(_energy - _referenceEnergy) <= REPEAT_TOLERANCE * _referenceEnergy &&
+            abs(_crossings - _referenceCrossings) <= REPEAT_TOLERANCE * _referenceCrossings) {
+
+            _repeats++;
+            return FRAME_REPEATED;
+        }
+
+        _hasReference = true;
+        _referenceEnergy = _energy;
+        _referenceCrossings = _crossings;
+        _repeats = 0;
+        return FRAME_ANALYZED;
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+namespace constantq {
+    // how a frame was produced (the item a session adds to each frame when skipping frames)
+    const int FRAME_ANALYZED = 0;
+    // not analyzed as the audio was silent (all other items are 0)
+    const int FRAME_SILENT = 1;
+    // not analyzed as the audio was nearly unchanged (the items of the last analyzed frame are repeated)
+    const int FRAME_REPEATED = 2;
+
+    // the rms amplitude below which audio is silent (-60 dBFS)
+    const double SILENCE_RMS = .001;
+
+    // the relative change in energy and zero crossings within which audio is unchanged
+    const double REPEAT_TOLERANCE = .02;
+
+    // the most consecutive frames repeating an analyzed frame (so a slow change is not missed entirely)
+    const int MAX_REPEATED_FRAMES = 4;
+
+    /**
+     * decides which frames of an analysis need not be analyzed from the energy and zero crossings of each 
+     * frame's audio (kept for a window sliding along the audio so each hop's samples are only read once)
+     */
+    class FrameGate {
+        private:
+            // the samples in a frame
+            int _windowSize;
+
+            bool _skipSilent;
+            bool _skipRepeated;
+
+            // the audio of the analysis
+            const double* _source;
+
+            // the first sample of the current window (-1 before the first frame)
+            int _start;
+
+            // the sum of squares and the number of zero crossings within the current window
+            double _energy;
+            int _crossings;
+
+            // the energy and zero crossings of the last analyzed frame (if one can be repeated)
+            bool _hasReference;
+            double _referenceEnergy;
+            int _referenceCrossings;
+
+            // the frames that have repeated the last analyzed frame
+            int _repeats;
+
+            /**
+             * @param index     the index of a sample after the first
+             * @returns         1 if the sign changes from the previous sample to the sample, otherwise 0
+             */
+            int crossing(int index) const;
+
+            /**
+             * moves the window to start at the sample
+             * @param start     the first sample of the window (at or after the current window's)
+             */
+            void advance(int start);
+
+        public:
+            /**
+             * @param windowSize    the samples in a frame
+             * @param skipSilent    whether silent frames are skipped
+             * @param skipRepeated  whether frames nearly unchanged from the last analyzed frame are skipped
+             */
+            FrameGate(int windowSize = 0, bool skipSilent = false, bool skipRepeated = false);
+
+            /**
+             * starts an analysis (no frame can be repeated until one is analyzed)
+             * @param source    the audio of the analysis
+             */
+            void reset(const double* source);
+
+            /**
+             * @param start     the first sample of the frame (frames must be classified in order)
+             * @returns         the FRAME_ value for how the frame is to be produced
+             */
+            int classify(int start);
+    };
+}
@@ -0,0 +1,173 @@
+#include <vector>
+#include <algorithm>
+#include "FramePyramid.hpp"
+
+using namespace std;
+
+namespace constantq {
+    FramePyramid::FramePyramid(int frameSize) : _frameSize(frameSize), _totalFrames(0) { }
+
+    void FramePyramid::addLevel() {
+        int level = _levels.size() + 1;
+        int items = ((_totalFrames - 1) >> level) + 1;
+        Level next;
+        next.max = ResultVector<double>(items * _frameSize, 0);
+        next.mean = ResultVector<double>(items * _frameSize, 0);
+        next.counts = ResultVector<int>(items, 0);
+
+        // each item is the combination of two items of the level below
+        for (int i = 0; i < items; i++) {
+            for (int child = 2 * i; child < 2 * i + 2; child++) {
+                const double* childMax;
+                const double* childMean;
+                int childCount;
+                if (level == 1) {
+                    if (child >= _totalFrames || !_added[child])
+                        continue;
+
+                    childMax = childMean = &_frames[child * _frameSize];
+                    childCount = 1;
+                }
+                else {
+                    auto& below = _levels[level - 2];
+                    if (child >= below.counts.size() || below.counts[child] == 0)
+                        continue;
+
+                    childMax = &below.max[child * _frameSize];
+                    childMean = &below.mean[child * _frameSize];
+                    childCount = below.counts[child];
+                }
+
+                int count = next.counts[i] + childCount;
+                for (int b = 0; b < _frameSize; b++) {
+                    double& max = next.max[i * _frameSize + b];
+                    double& mean = next.mean[i * _frameSize + b];
+                    max = next.counts[i] == 0 ? childMax[b] : std::max(max, childMax[b]);
+                    mean += (childMean[b] - mean) * childCount / count;
+                }
+
+                next.counts[i] = count;
+            }
+        }
+
+        _levels.push_back(move(next));
+    }
+
+    void FramePyramid::addToLevels(int index, const double* frame) {
+        for (int l = 1; l <= _levels.size(); l++) {
+            auto& level = _levels[l - 1];
+            int item = index >> l;
+            if (item >= level.counts.size()) {
+                level.max.resize((item + 1) * _frameSize, 0);
+                level.mean.resize((item + 1) * _frameSize, 0);
+                level.counts.resize(item + 1, 0);
+            }
+
+            int count = ++level.counts[item];
+            double* max = &level.max[item * _frameSize];
+            double* mean = &level.mean[item * _frameSize];
+            for (int b = 0; b < _frameSize; b++) {
+                max[b] = count == 1 ? frame[b] : std::max(max[b], frame[b]);
+                mean[b] += (frame[b] - mean[b]) / count;
+            }
+        }
+    }
+
+    void FramePyramid::addFrames(int start, const double* frames, int count) {
+        if (count <= 0)
+            return;
+
+        int end = start + count;
+        if (end > _totalFrames) {
+            _totalFrames = end;
+            _frames.resize(end * _frameSize, 0);
+            _added.resize(end, 0);
+        }
+
+        for (int f = start; f < end; f++) {
+            if (_added[f])
+                continue;
+
+            const double* frame = frames + (f - start) * _frameSize;
+            copy(frame, frame + _frameSize, &_frames[f * _frameSize]);
+            _added[f] = 1;
+            addToLevels(f, frame);
+        }
+
+        // levels are added until the top level is a single item
+        while ((_totalFrames - 1) >> _levels.size() > 0)
+            addLevel();
+    }
+
+    int FramePyramid::frameSize() const { return _frameSize; }
+
+    int FramePyramid::totalFrames() const { return _totalFrames; }
+
+    bool FramePyramid::added(int index) const { return index >= 0 && index < _totalFrames && _added[index]; }
+
+    const double* FramePyramid::frame(int index) const { return &_frames[index * _frameSize]; }
+
+    int FramePyramid::levels() const { return _levels.size() + 1; }
+
+    int FramePyramid::levelFor(int frames, int pixels) const {
+        int level = 0;
+        while (level + 1 < levels() && ((long long) pixels << (level + 1)) <= frames)
+            level++;
+
+        return level;
+    }
+
+    vector<double> FramePyramid::query(int startFrame, int endFrame, int pixels, int reduction) const {
+        vector<double> toRet(pixels * _frameSize, 0);
+        startFrame = max(0, startFrame);
+        endFrame = min(endFrame, _totalFrames);
+        if (pixels <= 0 || endFrame <= startFrame)
+            return toRet;
+
+        int level = levelFor(endFrame - startFrame, pixels);
+        int totalItems = level == 0 ? _totalFrames : _levels[level - 1].counts.size();
+
+        for (int p = 0; p < pixels; p++) {
+            // the items starting within the pixel (or, where pixels are narrower than items, the item under it)
+            long long pixelStart = startFrame + (long long) (endFrame - startFrame) * p / pixels;
+            long long pixelEnd = startFrame + (long long) (endFrame - startFrame) * (p + 1) / pixels;
+            int firstItem = (int) (pixelStart >> level);
+            int lastItem = max(firstItem, (int) ((pixelEnd - 1) >> level));
+            lastItem = min(lastItem, totalItems - 1);
+
+            double* pixel = &toRet[p * _frameSize];
+            int pixelCount = 0;
+            for (int i = firstItem; i <= lastItem; i++) {
+                const double* values;
+                int count;
+                if (level == 0) {
+                    if (!_added[i])
+                        continue;
+
+                    values = &_frames[i * _frameSize];
+                    count = 1;
+                }
+                else {
+                    auto& thisLevel = _levels[level - 1];
+                    count = thisLevel.counts[i];
+                    if (count == 0)
+                        continue;
+
+                    values = reduction == REDUCE_MAX ? &thisLevel.max[i * _frameSize] : &thisLevel.mean[i * _frameSize];
+                }
+
+                int total = pixelCount + count;
+                for (int b = 0; b < _frameSize; b++) {
+                    if (reduction == REDUCE_MAX)
+                        pixel[b] = pixelCount == 0 ? values[b] : max(pixel[b], values[b]);
+                    else
+                        pixel[b] += (values[b] - pixel[b]) * count / total;
+                }
+
+                pixelCount = total;
+            }
+        }
+
+        return toRet;
+    }
+}
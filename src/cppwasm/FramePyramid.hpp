@@ -0,0 +1,110 @@
+#pragma once
+#include <vector>
+#include "MemoryTracker.hpp"
+
+namespace constantq {
+    // the reductions of frames held by each level of a FramePyramid
+    const int REDUCE_MAX = 0;
+    const int REDUCE_MEAN = 1;
+
+    /**
+     * a time axis pyramid of analyzed frames where each level holds the max and mean of pairs of items 
+     * of the level below, so views of a long span cost time proportional to the pixels drawn rather than 
+     * the frames spanned. frames can be added in any order (i.e. as chunks complete).
+     */
+    class FramePyramid {
+        private:
+            /**
+             * a level above the frames where item i covers frames [i * 2^level, (i + 1) * 2^level)
+             * with the values of each item stored contiguously
+             */
+            struct Level {
+                ResultVector<double> max;
+                ResultVector<double> mean;
+                // the frames added within each item
+                ResultVector<int> counts;
+            };
+
+            int _frameSize;
+
+            // one more than the index of the last frame added
+            int _totalFrames;
+
+            // the frames (level 0) stored contiguously; frames not yet added are 0
+            ResultVector<double> _frames;
+
+            // whether each frame has been added
+            ResultVector<char> _added;
+
+            // _levels[l - 1] is level l
+            std::vector<Level> _levels;
+
+            /**
+             * creates the next level from the current top level
+             */
+            void addLevel();
+
+            /**
+             * includes a frame in each level above the frames
+             * @param index     the frame index
+             * @param frame     the frame's items
+             */
+            void addToLevels(int index, const double* frame);
+
+        public:
+            /**
+             * @param frameSize     the number of items per frame
+             */
+            FramePyramid(int frameSize);
+
+            /**
+             * adds analyzed frames (frames already added are ignored)
+             * @param start     the index of the first frame
+             * @param frames    the frames laid out one after another
+             * @param count     the number of frames
+             */
+            void addFrames(int start, const double* frames, int count);
+
+            int frameSize() const;
+
+            /**
+             * @returns one more than the index of the last frame added
+             */
+            int totalFrames() const;
+
+            /**
+             * @param index     the frame index
+             * @returns         whether the frame has been added
+             */
+            bool added(int index) const;
+
+            /**
+             * @param index     the index of a frame that has been added
+             * @returns         the frame's items
+             */
+            const double* frame(int index) const;
+
+            /**
+             * @returns the number of levels including the frames
+             */
+            int levels() const;
+
+            /**
+             * @param frames    the frames spanned
+             * @param pixels    the pixels the span is drawn over
+             * @returns         the highest level with at most one item per pixel
+             */
+            int levelFor(int frames, int pixels) const;
+
+            /**
+             * reduces the frames under each pixel using the level appropriate for the span 
+             * (items at the edge of a pixel are included with the pixel they start in)
+             * @param startFrame    the first frame of the span
+             * @param endFrame      one past the last frame of the span
+             * @param pixels        the number of pixels
+             * @param reduction     the REDUCE_ constant
+             * @returns             pixels frames laid out one after another (0 where no frames have been added)
+             */
+            std::vector<double> query(int startFrame, int endFrame, int pixels, int reduction) const;
+    };
+}
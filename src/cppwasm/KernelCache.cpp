@@ -0,0 +1,134 @@
+#include <exception>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include "ConstantQ.hpp"
+#include "KernelCache.hpp"
+#include "BakedKernels.hpp"
+#include "Profiler.hpp"
+
+using namespace std;
+
+namespace constantq {
+    bool KernelKey::operator<(const KernelKey& other) const {
+        return tie(fs, minFreq, maxFreq, bins, thresh) < 
+            tie(other.fs, other.minFreq, other.maxFreq, other.bins, other.thresh);
+    }
+
+    KernelCache::KernelCache() { }
+
+    const BakedKernel* KernelCache::findBaked(int fs, double minFreq, double maxFreq, int bins, double thresh) {
+        for (int i = 0; i < TOTAL_BAKED_KERNELS; i++) {
+            auto& baked = BAKED_KERNELS[i];
+            if (baked.fs == fs && baked.minFreq == minFreq && baked.maxFreq == maxFreq && 
+                baked.bins == bins && baked.thresh == thresh)
+                return &baked;
+        }
+
+        return nullptr;
+    }
+
+    SparseKernel KernelCache::fromBaked(const BakedKernel& baked) {
+        ProfileTimer timer(STAGE_KERNEL_BUILD);
+
+        int totalEntries = baked.rowStarts[baked.totalBins];
+        KernelVector<KernelEntry> entries;
+        entries.reserve(totalEntries);
+        for (int e = 0; e < totalEntries; e++) {
+            auto& entry = baked.entries[e];
+            entries.push_back(KernelEntry(entry.fftIndex, complex<double>(entry.real, entry.imag)));
+        }
+
+        KernelVector<int> rowStarts(baked.rowStarts, baked.rowStarts + baked.totalBins + 1);
+        return SparseKernel(move(entries), move(rowStarts), baked.size, baked.totalBins);
+    }
+
+    KernelCache& KernelCache::instance() {
+        static KernelCache cache;
+        return cache;
+    }
+
+    shared_ptr<const SparseKernel> KernelCache::kernel(int fs, double minFreq, double maxFreq, 
+                                                        int bins, double thresh) {
+        KernelKey key = { fs, minFreq, maxFreq, bins, thresh };
+        promise<shared_ptr<const SparseKernel> > building;
+        {
+            unique_lock<mutex> lock(_mutex);
+            auto existing = _kernels[key].lock();
+            if (existing)
+                return existing;
+
+            auto pending = _building.find(key);
+            if (pending != _building.end()) {
+                auto built = pending->second;
+                lock.unlock();
+                return built.get();
+            }
+
+            _building[key] = building.get_future().share();
+        }
+
+        // kernels baked at build time are used when available, otherwise the kernel is built
+        shared_ptr<const SparseKernel> created;
+        try {
+            auto baked = findBaked(fs, minFreq, maxFreq, bins, thresh);
+            created = baked ?
+                make_shared<const SparseKernel>(fromBaked(*baked)) :
+                make_shared<const SparseKernel>(ConstantQ::sparseKernel(fs, minFreq, maxFreq, bins, thresh));
+        }
+        catch (...) {
+            {
+                lock_guard<mutex> lock(_mutex);
+                _building.erase(key);
+            }
+
+            building.set_exception(current_exception());
+            throw;
+        }
+
+        {
+            // a kernel added from elsewhere while this one was built is used in its place
+            lock_guard<mutex> lock(_mutex);
+            auto added = _kernels[key].lock();
+            if (added)
+                created = added;
+            else
+                _kernels[key] = created;
+
+            _building.erase(key);
+        }
+
+        building.set_value(created);
+        return created;
+    }
+
+    shared_ptr<const SparseKernel> KernelCache::add(int fs, double minFreq, double maxFreq, 
+                                                        int bins, double thresh, SparseKernel kernel) {
+        KernelKey key = { fs, minFreq, maxFreq, bins, thresh };
+        lock_guard<mutex> lock(_mutex);
+        auto existing = _kernels[key].lock();
+        if (existing)
+            return existing;
+
+        auto added = make_shared<const SparseKernel>(move(kernel));
+        _kernels[key] = added;
+        return added;
+    }
+
+    int KernelCache::size() {
+        lock_guard<mutex> lock(_mutex);
+        int toRet = 0;
+        for (auto it = _kernels.begin(); it != _kernels.end(); ) {
+            if (it->second.expired())
+                it = _kernels.erase(it);
+            else {
+                toRet++;
+                it++;
+            }
+        }
+
+        return toRet;
+    }
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include "SparseKernel.hpp"
+#include "BakedKernels.hpp"
+
+namespace constantq {
+    /**
+     * the parameters that determine a sparse kernel
+     */
+    struct KernelKey {
+        int fs;
+        double minFreq;
+        double maxFreq;
+        int bins;
+        double thresh;
+
+        bool operator<(const KernelKey& other) const;
+    };
+
+    /**
+     * shares sparse kernels between sessions with identical parameters
+     * kernels are held weakly so a kernel is freed once no session uses it
+     * each wasm instance (orchestrator and each worker) has its own instance; natively it is shared by
+     * sessions on every thread
+     */
+    class KernelCache {
+        private:
+            std::map<KernelKey, std::weak_ptr<const SparseKernel> > _kernels;
+
+            // the kernels being built by kernel(); threads needing one wait for it rather than building it
+            // again (removed once the kernel is in _kernels so only the sessions using it hold it)
+            std::map<KernelKey, std::shared_future<std::shared_ptr<const SparseKernel> > > _building;
+
+            // guards _kernels and _building (kernels are built without it so other parameters are not blocked)
+            std::mutex _mutex;
+
+            KernelCache();
+
+        public:
+            /**
+             * @returns the kernel baked at build time for these parameters or nullptr if there is none
+             */
+            static const BakedKernel* findBaked(int fs, double minFreq, double maxFreq, int bins, double thresh);
+
+            /**
+             * @returns the sparse kernel for the baked kernel
+             */
+            static SparseKernel fromBaked(const BakedKernel& baked);
+
+            /**
+             * @returns the kernel cache for this wasm instance
+             */
+            static KernelCache& instance();
+
+            /**
+             * @param fs        the frames per second (44100 for 44.1 kHz)
+             * @param minFreq   minimum frequency for  analysis (in Hz)
+             * @param maxFreq   maximum frequency for  analysis (in Hz)
+             * @param bins      bins per octave
+             * @param thresh    minimum threshold to be encapsulated for determining bin amplitude
+             * @returns         the kernel in use for these parameters or a newly created one
+             *                  (from the baked kernels if available, otherwise built)
+             */
+            std::shared_ptr<const SparseKernel> kernel(int fs, double minFreq, double maxFreq, int bins, double thresh);
+
+            /**
+             * shares a kernel built elsewhere (i.e. by another worker) with sessions created with these parameters
+             * @param fs        the frames per second the kernel was built for
+             * @param minFreq   minimum frequency for  analysis (in Hz)
+             * @param maxFreq   maximum frequency for  analysis (in Hz)
+             * @param bins      bins per octave
+             * @param thresh    minimum threshold to be encapsulated for determining bin amplitude
+             * @param kernel    the kernel
+             * @returns         the kernel already in use for these parameters or else the provided kernel
+             *                  (which is only kept while it is held)
+             */
+            std::shared_ptr<const SparseKernel> add(int fs, double minFreq, double maxFreq, int bins, double thresh,
+                                                        SparseKernel kernel);
+
+            /**
+             * @returns the number of kernels currently in use
+             */
+            int size();
+    };
+}
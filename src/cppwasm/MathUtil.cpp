@@ -3,6 +3,11 @@
 #include <vector>
 #include <cmath>
 #include <string>
+#include <map>
+#include <mutex>
+#include <cassert>
+#include <cstdlib>
+#include <algorithm>
 #include "MathUtil.hpp"
 
 using namespace std;
@@ -48,26 +53,41 @@ namespace constantq {
      */
     void MathUtil::fft(vector<complex<double> >& x, int n) {
         assert(x.size() >= n);
+        fft(&x[0], n);
+    }
 
-        // verify n is a power of 2
-        assert((ceil(log2(n)) == floor(log2(n))));
-
+    /**
+     * the in place fft shared by each precision
+     * @param x             the complex number array in which to perform fft
+     * @param n             the length of the array to perform fft (must be a power of 2)
+     * @param bitReversed   the bit reversed index for each index
+     * @param twiddles      e^(-2 pi i k / n) for k in [0, n/2)
+     * @param pruning       if provided, the butterflies computed for each stage (otherwise all are computed)
+     */
+    template <typename T>
+    void fftInPlace(complex<T>* x, int n, const vector<int>& bitReversed, const vector<complex<T> >& twiddles,
+        const FftPruning* pruning = nullptr) {
         // bit reversal permutation
-        int shift = 1 + leadingZeros(n);
         for (int k = 0; k < n; k++) {
-            int j = reverse(k) >> shift;
+            int j = bitReversed[k];
             if (j > k) {
-                complex<double> temp = x[j];
+                complex<T> temp = x[j];
                 x[j] = x[k];
                 x[k] = temp;
             }
         }
 
-        // butterfly updates
-        for (int L = 2; L <= n; L = L+L) {
-            for (int k = 0; k < L/2; k++) {
-                double kth = -2 * k * M_PI / L;
-                auto w = complex<double>(cos(kth), sin(kth));
+        // butterfly updates (the twiddle for k in a span of L is e^(-2 pi i k / L) = twiddles[k * n / L])
+        int stage = 0;
+        for (int L = 2; L <= n; L = L+L, stage++) {
+            int twiddleStride = n / L;
+            const vector<int>* stageButterflies = pruning && stage < pruning->butterflies.size() && 
+                !pruning->butterflies[stage].empty() ? &pruning->butterflies[stage] : nullptr;
+
+            int totalButterflies = stageButterflies ? stageButterflies->size() : L/2;
+            for (int b = 0; b < totalButterflies; b++) {
+                int k = stageButterflies ? (*stageButterflies)[b] : b;
+                auto w = twiddles[k * twiddleStride];
                 for (int j = 0; j < n/L; j++) {
                     auto tao = w * (x[j*L + k + L/2]);
                     x[j*L + k + L/2] = x[j*L + k] - tao;
@@ -77,6 +97,148 @@ namespace constantq {
         }
     }
 
+    /**
+     * compute the FFT of the first n items of x in place
+     * @param x     the complex number array in which to perform fft
+     * @param n     the length of the array to perform fft (must be a power of 2)
+     */
+    void MathUtil::fft(complex<double>* x, int n) {
+        auto& tables = fftTables(n);
+        fftInPlace(x, n, tables.bitReversed, tables.twiddles);
+    }
+
+    void MathUtil::fft(complex<float>* x, int n) {
+        auto& tables = fftTables(n);
+        fftInPlace(x, n, tables.bitReversed, tables.twiddlesFloat);
+    }
+
+    void MathUtil::fft(complex<double>* x, int n, const FftPruning& pruning) {
+        auto& tables = fftTables(n);
+        fftInPlace(x, n, tables.bitReversed, tables.twiddles, &pruning);
+    }
+
+    void MathUtil::fft(complex<float>* x, int n, const FftPruning& pruning) {
+        auto& tables = fftTables(n);
+        fftInPlace(x, n, tables.bitReversed, tables.twiddlesFloat, &pruning);
+    }
+
+    int MathUtil::fft(FixedComplex* x, int n, const FftPruning& pruning) {
+        auto& tables = fftTables(n);
+        auto& twiddles = tables.twiddlesFixed;
+
+        // bit reversal permutation finding the largest component for the first stage's scaling
+        int32_t peak = 0;
+        for (int k = 0; k < n; k++) {
+            int j = tables.bitReversed[k];
+            if (j > k) {
+                FixedComplex temp = x[j];
+                x[j] = x[k];
+                x[k] = temp;
+            }
+
+            peak = max(peak, max(abs(x[k].real), abs(x[k].imag)));
+        }
+
+        const int64_t rounding = ((int64_t) 1) << (FIXED_TWIDDLE_BITS - 1);
+        int exponent = 0;
+        int stage = 0;
+        for (int L = 2; L <= n; L = L+L, stage++) {
+            // the stage's inputs are shifted as they are read so no separate scaling pass is needed
+            int shift = 0;
+            while ((peak >> shift) >= FIXED_STAGE_LIMIT)
+                shift++;
+
+            exponent += shift;
+            peak = 0;
+
+            int twiddleStride = n / L;
+            const vector<int>* stageButterflies = stage < pruning.butterflies.size() && 
+                !pruning.butterflies[stage].empty() ? &pruning.butterflies[stage] : nullptr;
+
+            int totalButterflies = stageButterflies ? stageButterflies->size() : L/2;
+            for (int b = 0; b < totalButterflies; b++) {
+                int k = stageButterflies ? (*stageButterflies)[b] : b;
+                const FixedComplex& w = twiddles[k * twiddleStride];
+                for (int j = 0; j < n/L; j++) {
+                    FixedComplex& lo = x[j*L + k];
+                    FixedComplex& hi = x[j*L + k + L/2];
+                    int32_t loReal = lo.real >> shift;
+                    int32_t loImag = lo.imag >> shift;
+                    int64_t hiReal = hi.real >> shift;
+                    int64_t hiImag = hi.imag >> shift;
+
+                    int32_t taoReal = (int32_t) ((w.real * hiReal - w.imag * hiImag + rounding) >> FIXED_TWIDDLE_BITS);
+                    int32_t taoImag = (int32_t) ((w.real * hiImag + w.imag * hiReal + rounding) >> FIXED_TWIDDLE_BITS);
+
+                    hi.real = loReal - taoReal;
+                    hi.imag = loImag - taoImag;
+                    lo.real = loReal + taoReal;
+                    lo.imag = loImag + taoImag;
+                    peak = max(peak, max(max(abs(lo.real), abs(lo.imag)), max(abs(hi.real), abs(hi.imag))));
+                }
+            }
+        }
+
+        return exponent;
+    }
+
+    FftPruning MathUtil::fftPruning(int n, const vector<int>& outputs) {
+        FftPruning pruning;
+        for (int L = 2; L <= n; L = L+L) {
+            vector<bool> needed(L/2, false);
+            for (auto output : outputs)
+                needed[output % (L/2)] = true;
+
+            vector<int> stageButterflies;
+            for (int k = 0; k < L/2; k++) {
+                if (needed[k])
+                    stageButterflies.push_back(k);
+            }
+
+            // stages needing every butterfly are computed in full
+            if (stageButterflies.size() == L/2)
+                stageButterflies.clear();
+
+            pruning.butterflies.push_back(stageButterflies);
+        }
+
+        return pruning;
+    }
+
+    const FftTables& MathUtil::fftTables(int n) {
+        // tables are kept per size as an analysis uses the same fft size for every frame
+        // (sessions on other threads may share them; map entries stay in place as others are added)
+        static map<int, FftTables> cache;
+        static mutex cacheMutex;
+        lock_guard<mutex> lock(cacheMutex);
+
+        auto found = cache.find(n);
+        if (found != cache.end())
+            return found->second;
+
+        // verify n is a power of 2
+        assert((ceil(log2(n)) == floor(log2(n))));
+
+        FftTables& tables = cache[n];
+        tables.bitReversed = vector<int>(n);
+        int shift = 1 + leadingZeros(n);
+        for (int k = 0; k < n; k++)
+            tables.bitReversed[k] = reverse(k) >> shift;
+
+        tables.twiddles = vector<complex<double> >(n / 2);
+        tables.twiddlesFloat = vector<complex<float> >(n / 2);
+        tables.twiddlesFixed = vector<FixedComplex>(n / 2);
+        double fixedScale = (double) (((int64_t) 1) << FIXED_TWIDDLE_BITS);
+        for (int k = 0; k < n / 2; k++) {
+            double kth = -2 * k * M_PI / n;
+            tables.twiddles[k] = complex<double>(cos(kth), sin(kth));
+            tables.twiddlesFloat[k] = complex<float>(tables.twiddles[k]);
+            tables.twiddlesFixed[k] = { (int32_t) lround(cos(kth) * fixedScale), (int32_t) lround(sin(kth) * fixedScale) };
+        }
+
+        return tables;
+    }
+
     /**
      * gets the log base 2 of number (rounded up)
      * based on http://doc.ml.tu-berlin.de/bbci/material/publications/Bla_constQ.pdf
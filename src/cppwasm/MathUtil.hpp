@@ -2,8 +2,47 @@
 #include <complex>
 #include <vector>
 #include <string>
+#include <cstdint>
 
 namespace constantq {
+    // the fraction bits of fixed point twiddles (so 1 is 2^FIXED_TWIDDLE_BITS)
+    const int FIXED_TWIDDLE_BITS = 30;
+
+    // fixed point fft data is scaled down before a stage whenever a component reaches this limit
+    // (a butterfly grows a component by at most 1 + sqrt(2), so stages cannot overflow 32 bits)
+    const int32_t FIXED_STAGE_LIMIT = 1 << 29;
+
+    /**
+     * a complex number of 32 bit integers for the fixed point fft
+     */
+    struct FixedComplex {
+        int32_t real;
+        int32_t imag;
+    };
+
+    /**
+     * precomputed tables for an fft of a given size
+     */
+    struct FftTables {
+        // the bit reversed index for each index
+        std::vector<int> bitReversed;
+        // e^(-2 pi i k / n) for k in [0, n/2)
+        std::vector<std::complex<double> > twiddles;
+        // the twiddles in single precision for reduced accuracy analysis
+        std::vector<std::complex<float> > twiddlesFloat;
+        // the twiddles in fixed point with FIXED_TWIDDLE_BITS fraction bits
+        std::vector<FixedComplex> twiddlesFixed;
+    };
+
+    /**
+     * the butterflies of an fft needed for a subset of its outputs (an output pruned fft)
+     */
+    struct FftPruning {
+        // the butterfly offsets (k in [0, L/2)) computed at each stage of span L = 2^(stage + 1)
+        // (empty for stages computed in full)
+        std::vector<std::vector<int> > butterflies;
+    };
+
     /**
      * Math utilities for DSP and Constant Q algorithm
      */
@@ -12,6 +51,48 @@ namespace constantq {
             static unsigned int leadingZeros(unsigned int x);
             static unsigned int reverse(unsigned int num);
             static void fft(std::vector<std::complex<double> >& x, int n);
+            static void fft(std::complex<double>* x, int n);
+
+            /**
+             * single precision fft of the first n items of x in place (for reduced accuracy analysis)
+             * @param x     the complex number array in which to perform fft
+             * @param n     the length of the array to perform fft (must be a power of 2)
+             */
+            static void fft(std::complex<float>* x, int n);
+
+            /**
+             * fft of the first n items of x in place computing only the outputs the pruning was created for
+             * (other outputs are left with partial results)
+             * @param x         the complex number array in which to perform fft
+             * @param n         the length of the array to perform fft (must be a power of 2)
+             * @param pruning   the pruning created with fftPruning for n
+             */
+            static void fft(std::complex<double>* x, int n, const FftPruning& pruning);
+            static void fft(std::complex<float>* x, int n, const FftPruning& pruning);
+
+            /**
+             * fixed point fft of the first n items of x in place with block floating point scaling: the data 
+             * shares one exponent that is raised (shifting the data right) before any stage that could overflow
+             * @param x         the fixed point data (components should be below FIXED_STAGE_LIMIT)
+             * @param n         the length of the array to perform fft (must be a power of 2)
+             * @param pruning   the pruning created with fftPruning for n
+             * @returns         the block exponent (the fft is x times 2^exponent)
+             */
+            static int fft(FixedComplex* x, int n, const FftPruning& pruning);
+
+            /**
+             * @param n         the fft size (must be a power of 2)
+             * @param outputs   the indices of the outputs needed
+             * @returns         the butterflies needed for the outputs (an output at index s needs the butterfly 
+             *                  at s mod L/2 of each stage of span L)
+             */
+            static FftPruning fftPruning(int n, const std::vector<int>& outputs);
+
+            /**
+             * @param n     the fft size (must be a power of 2)
+             * @returns     the tables for an fft of size n (created on first use and kept for reuse by all threads)
+             */
+            static const FftTables& fftTables(int n);
             static int nextPow2(double num);
             static std::vector<std::complex<double> > hamming(int len);
             static std::complex<double> eulers(double num);
@@ -0,0 +1,64 @@
+#include <algorithm>
+#include "MemoryTracker.hpp"
+
+using namespace std;
+
+namespace constantq {
+    // the index of the counters for all categories
+    const int MEMORY_TOTAL = TOTAL_MEMORY_CATEGORIES;
+
+    MemoryTracker::MemoryTracker() {
+        for (int c = 0; c <= MEMORY_TOTAL; c++) {
+            _current[c] = 0;
+            _peak[c] = 0;
+        }
+    }
+
+    MemoryTracker& MemoryTracker::instance() {
+        static MemoryTracker tracker;
+        return tracker;
+    }
+
+    const char* MemoryTracker::categoryName(int category) {
+        switch (category) {
+            case MEMORY_KERNEL: return "kernel";
+            case MEMORY_SCRATCH: return "scratch";
+            case MEMORY_MESSAGE: return "message";
+            case MEMORY_AUDIO: return "audio";
+            case MEMORY_RESULTS: return "results";
+            default: return "unknown";
+        }
+    }
+
+    void MemoryTracker::raisePeak(atomic<long long>& peak, long long value) {
+        long long previous = peak.load(memory_order_relaxed);
+        while (previous < value && !peak.compare_exchange_weak(previous, value, memory_order_relaxed)) { }
+    }
+
+    void MemoryTracker::allocated(int category, size_t bytes) {
+        raisePeak(_peak[category], _current[category].fetch_add(bytes, memory_order_relaxed) + bytes);
+        raisePeak(_peak[MEMORY_TOTAL], _current[MEMORY_TOTAL].fetch_add(bytes, memory_order_relaxed) + bytes);
+    }
+
+    void MemoryTracker::released(int category, size_t bytes) {
+        _current[category].fetch_sub(bytes, memory_order_relaxed);
+        _current[MEMORY_TOTAL].fetch_sub(bytes, memory_order_relaxed);
+    }
+
+    void MemoryTracker::resetPeak() {
+        for (int c = 0; c <= MEMORY_TOTAL; c++)
+            _peak[c] = _current[c].load(memory_order_relaxed);
+    }
+
+    MemoryReport MemoryTracker::report() const {
+        MemoryReport toRet;
+        for (int c = 0; c < TOTAL_MEMORY_CATEGORIES; c++) {
+            toRet.current[c] = _current[c].load(memory_order_relaxed);
+            toRet.peak[c] = _peak[c].load(memory_order_relaxed);
+        }
+
+        toRet.totalCurrent = _current[MEMORY_TOTAL].load(memory_order_relaxed);
+        toRet.totalPeak = _peak[MEMORY_TOTAL].load(memory_order_relaxed);
+        return toRet;
+    }
+}
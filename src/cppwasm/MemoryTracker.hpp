@@ -0,0 +1,123 @@
+#pragma once
+#include <vector>
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace constantq {
+    // categories of memory accounted for by the MemoryTracker
+    const int MEMORY_KERNEL = 0;
+    const int MEMORY_SCRATCH = 1;
+    const int MEMORY_MESSAGE = 2;
+    const int MEMORY_AUDIO = 3;
+    const int MEMORY_RESULTS = 4;
+    const int TOTAL_MEMORY_CATEGORIES = 5;
+
+    /**
+     * plain snapshot of memory use so it can be copied into worker messages
+     */
+    struct MemoryReport {
+        // bytes currently allocated per category
+        double current[TOTAL_MEMORY_CATEGORIES];
+        // the most bytes allocated at once per category
+        double peak[TOTAL_MEMORY_CATEGORIES];
+        // bytes currently allocated for all categories
+        double totalCurrent;
+        // the most bytes allocated at once for all categories
+        double totalPeak;
+    };
+
+    /**
+     * accounts for memory allocated through TrackedAllocator
+     * each wasm instance (orchestrator and each worker) has its own instance; natively it is shared by every
+     * thread (memory may be released on a different thread than it was allocated, such as a shared kernel)
+     * so the counters are atomic
+     */
+    class MemoryTracker {
+        private:
+            // bytes currently allocated and the most allocated at once, per category and then for all
+            std::atomic<long long> _current[TOTAL_MEMORY_CATEGORIES + 1];
+            std::atomic<long long> _peak[TOTAL_MEMORY_CATEGORIES + 1];
+
+            /**
+             * raises the peak to the value if it is higher
+             */
+            static void raisePeak(std::atomic<long long>& peak, long long value);
+
+            MemoryTracker();
+
+        public:
+            /**
+             * @returns the memory tracker for this wasm instance
+             */
+            static MemoryTracker& instance();
+
+            /**
+             * @returns the name of the category for display
+             */
+            static const char* categoryName(int category);
+
+            void allocated(int category, size_t bytes);
+
+            void released(int category, size_t bytes);
+
+            /**
+             * resets peaks to the current allocation
+             */
+            void resetPeak();
+
+            /**
+             * @returns a snapshot of the counters
+             */
+            MemoryReport report() const;
+    };
+
+    /**
+     * std allocator that records allocations in the MemoryTracker under CATEGORY
+     */
+    template<typename T, int CATEGORY>
+    class TrackedAllocator {
+        public:
+            typedef T value_type;
+
+            template<typename U>
+            struct rebind { typedef TrackedAllocator<U, CATEGORY> other; };
+
+            TrackedAllocator() noexcept { }
+
+            template<typename U>
+            TrackedAllocator(const TrackedAllocator<U, CATEGORY>&) noexcept { }
+
+            T* allocate(size_t n) {
+                MemoryTracker::instance().allocated(CATEGORY, n * sizeof(T));
+                return static_cast<T*>(::operator new(n * sizeof(T)));
+            }
+
+            void deallocate(T* ptr, size_t n) noexcept {
+                MemoryTracker::instance().released(CATEGORY, n * sizeof(T));
+                ::operator delete(ptr);
+            }
+    };
+
+    template<typename T, typename U, int CATEGORY>
+    bool operator==(const TrackedAllocator<T, CATEGORY>&, const TrackedAllocator<U, CATEGORY>&) { return true; }
+
+    template<typename T, typename U, int CATEGORY>
+    bool operator!=(const TrackedAllocator<T, CATEGORY>&, const TrackedAllocator<U, CATEGORY>&) { return false; }
+
+    // vectors accounted for under each category
+    template<typename T>
+    using KernelVector = std::vector<T, TrackedAllocator<T, MEMORY_KERNEL> >;
+
+    template<typename T>
+    using ScratchVector = std::vector<T, TrackedAllocator<T, MEMORY_SCRATCH> >;
+
+    template<typename T>
+    using MessageVector = std::vector<T, TrackedAllocator<T, MEMORY_MESSAGE> >;
+
+    template<typename T>
+    using AudioVector = std::vector<T, TrackedAllocator<T, MEMORY_AUDIO> >;
+
+    template<typename T>
+    using ResultVector = std::vector<T, TrackedAllocator<T, MEMORY_RESULTS> >;
+}
@@ -0,0 +1,201 @@
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <cassert>
+#include "OnsetDetector.hpp"
+
+using namespace std;
+
+namespace constantq {
+    // multiplier applied before log compression of magnitudes
+    const double LOG_COMPRESSION = 100.;
+
+    // the half width in seconds of the window in which an onset must be the maximum
+    const double PEAK_WINDOW_SECONDS = .05;
+
+    // seconds before a frame used to determine the adaptive threshold
+    const double MEAN_WINDOW_SECONDS = .15;
+
+    // the amount (in standard deviations of the flux) an onset must exceed the local mean
+    const double ONSET_DELTA = .3;
+
+    // the range of tempos considered
+    const double MIN_BPM = 40.;
+    const double MAX_BPM = 240.;
+
+    // tempo that is preferred and the width (in octaves) of that preference
+    // to resolve half/double tempo ambiguity
+    const double PREFERRED_BPM = 120.;
+    const double PREFERRED_BPM_OCTAVES = 1.;
+
+    OnsetDetector::OnsetDetector(double frameRate) : _frameRate(frameRate), _hasPrev(false) { }
+
+    void OnsetDetector::reset() {
+        _hasPrev = false;
+        _flux.clear();
+    }
+
+    void OnsetDetector::compress(const double* bins, int size, vector<double>& toRet) {
+        toRet.resize(size);
+        for (int b = 0; b < size; b++)
+            toRet[b] = log1p(LOG_COMPRESSION * bins[b]);
+    }
+
+    void OnsetDetector::prime(const double* bins, int size) {
+        compress(bins, size, _prevLog);
+        _hasPrev = true;
+    }
+
+    double OnsetDetector::addFrame(const double* bins, int size) {
+        double flux = 0;
+        if (_hasPrev) {
+            assert(_prevLog.size() == size);
+            for (int b = 0; b < size; b++) {
+                double compressed = log1p(LOG_COMPRESSION * bins[b]);
+                flux += max(0., compressed - _prevLog[b]);
+                _prevLog[b] = compressed;
+            }
+        }
+        else {
+            prime(bins, size);
+        }
+
+        _flux.push_back(flux);
+        return flux;
+    }
+
+    const vector<double>& OnsetDetector::flux() const { return _flux; }
+
+    void OnsetDetector::setFlux(vector<double> flux) {
+        _flux = move(flux);
+        _hasPrev = false;
+    }
+
+    vector<int> OnsetDetector::onsets() const {
+        vector<int> toRet;
+        int len = _flux.size();
+        if (len == 0)
+            return toRet;
+
+        int peakWindow = max(1, (int) round(PEAK_WINDOW_SECONDS * _frameRate));
+        int meanWindow = max(peakWindow, (int) round(MEAN_WINDOW_SECONDS * _frameRate));
+
+        // standard deviation of the flux to scale the threshold
+        double mean = 0;
+        for (auto f : _flux)
+            mean += f;
+        mean /= len;
+
+        double variance = 0;
+        for (auto f : _flux)
+            variance += (f - mean) * (f - mean);
+        double stdDev = sqrt(variance / len);
+
+        if (stdDev <= 0)
+            return toRet;
+
+        int lastOnset = -peakWindow - 1;
+        for (int n = 0; n < len; n++) {
+            int peakStart = max(0, n - peakWindow);
+            int peakEnd = min(len - 1, n + peakWindow);
+            bool isPeak = true;
+            for (int i = peakStart; i <= peakEnd && isPeak; i++)
+                isPeak = _flux[i] <= _flux[n];
+
+            if (!isPeak)
+                continue;
+
+            int meanStart = max(0, n - meanWindow);
+            double localMean = 0;
+            for (int i = meanStart; i <= peakEnd; i++)
+                localMean += _flux[i];
+            localMean /= (peakEnd - meanStart + 1);
+
+            if (_flux[n] >= localMean + ONSET_DELTA * stdDev && n - lastOnset > peakWindow) {
+                toRet.push_back(n);
+                lastOnset = n;
+            }
+        }
+
+        return toRet;
+    }
+
+    double OnsetDetector::tempo() const {
+        int len = _flux.size();
+        int minLag = max(1, (int) floor(_frameRate * 60. / MAX_BPM));
+        int maxLag = (int) ceil(_frameRate * 60. / MIN_BPM);
+        if (len < 2 * maxLag || maxLag <= minLag)
+            return 0;
+
+        double mean = 0;
+        for (auto f : _flux)
+            mean += f;
+        mean /= len;
+
+        // weighted autocorrelation of the mean removed flux for each lag (with one lag of padding each side)
+        vector<double> weighted(maxLag + 2, 0);
+        for (int lag = minLag - 1; lag <= maxLag + 1; lag++) {
+            if (lag < 1)
+                continue;
+
+            double corr = 0;
+            for (int n = lag; n < len; n++)
+                corr += (_flux[n] - mean) * (_flux[n - lag] - mean);
+            corr /= (len - lag);
+
+            double octaves = log2((_frameRate * 60. / lag) / PREFERRED_BPM) / PREFERRED_BPM_OCTAVES;
+            weighted[lag] = corr * exp(-.5 * octaves * octaves);
+        }
+
+        int bestLag = -1;
+        for (int lag = minLag; lag <= maxLag; lag++) {
+            if (bestLag < 0 || weighted[lag] > weighted[bestLag])
+                bestLag = lag;
+        }
+
+        if (weighted[bestLag] <= 0)
+            return 0;
+
+        // parabolic interpolation around the peak for resolution finer than a frame
+        double lagEstimate = bestLag;
+        if (bestLag > 1) {
+            double prev = weighted[bestLag - 1];
+            double cur = weighted[bestLag];
+            double next = weighted[bestLag + 1];
+            double denom = prev - 2 * cur + next;
+            if (denom < 0)
+                lagEstimate += .5 * (prev - next) / denom;
+        }
+
+        return _frameRate * 60. / lagEstimate;
+    }
+
+    vector<int> OnsetDetector::beats() const {
+        vector<int> toRet;
+        double bpm = tempo();
+        if (bpm <= 0)
+            return toRet;
+
+        int len = _flux.size();
+        double period = _frameRate * 60. / bpm;
+
+        // the phase whose beat grid accumulates the most flux
+        int bestPhase = 0;
+        double bestScore = -1;
+        for (int phase = 0; phase < (int) ceil(period); phase++) {
+            double score = 0;
+            for (double pos = phase; round(pos) < len; pos += period)
+                score += _flux[(int) round(pos)];
+
+            if (score > bestScore) {
+                bestScore = score;
+                bestPhase = phase;
+            }
+        }
+
+        for (double pos = bestPhase; round(pos) < len; pos += period)
+            toRet.push_back((int) round(pos));
+
+        return toRet;
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include <vector>
+
+namespace constantq {
+    /**
+     * determines onsets, tempo and beats from the log spectral flux of constant q frames
+     * onset picking based on https://www.eecs.qmul.ac.uk/~simond/pub/2006/dafx.pdf
+     * tempo and beat estimation based on https://www.ee.columbia.edu/~dpwe/pubs/Ellis07-beattrack.pdf
+     */
+    class OnsetDetector {
+        private:
+            // constant q frames per second
+            double _frameRate;
+
+            // the log compressed magnitudes of the previous frame
+            std::vector<double> _prevLog;
+
+            // whether or not _prevLog holds a frame
+            bool _hasPrev;
+
+            // the spectral flux for each added frame
+            std::vector<double> _flux;
+
+            /**
+             * log compresses the frame into the provided buffer
+             * @param bins      the magnitude of each bin
+             * @param size      the number of bins
+             * @param toRet     the buffer to hold the compressed values
+             */
+            static void compress(const double* bins, int size, std::vector<double>& toRet);
+
+        public:
+            /**
+             * @param frameRate     constant q frames per second
+             */
+            OnsetDetector(double frameRate);
+
+            /**
+             * clears all frame and flux history
+             */
+            void reset();
+
+            /**
+             * sets the previous frame for flux determination without recording a flux value
+             * (used when the preceding frame was analyzed by another chunk)
+             * @param bins      the magnitude of each bin
+             * @param size      the number of bins
+             */
+            void prime(const double* bins, int size);
+
+            /**
+             * records the half-wave rectified log spectral flux between this frame and the previous frame
+             * @param bins      the magnitude of each bin
+             * @param size      the number of bins
+             * @returns         the spectral flux for this frame
+             */
+            double addFrame(const double* bins, int size);
+
+            /**
+             * @returns the spectral flux for each added frame
+             */
+            const std::vector<double>& flux() const;
+
+            /**
+             * replaces the flux history with flux determined elsewhere (such as by the chunks of an
+             * analysis split between workers) so onsets, tempo and beats span all of it
+             * @param flux      the spectral flux for each frame
+             */
+            void setFlux(std::vector<double> flux);
+
+            /**
+             * picks onsets as local maxima of the flux over an adaptive threshold
+             * @returns the frame indices of onsets
+             */
+            std::vector<int> onsets() const;
+
+            /**
+             * estimates tempo from the autocorrelation of the flux
+             * @returns the tempo in beats per minute (0 if it cannot be determined)
+             */
+            double tempo() const;
+
+            /**
+             * determines the beat grid for the estimated tempo that best aligns with the flux
+             * @returns the frame indices of beats
+             */
+            std::vector<int> beats() const;
+    };
+}
@@ -0,0 +1,70 @@
+#include <vector>
+#include <cmath>
+#include <cassert>
+#include "PolyphaseDecimator.hpp"
+
+using namespace std;
+
+namespace constantq {
+    // the transition width of a blackman window filter is approximately this over the number of taps
+    const double BLACKMAN_TRANSITION = 5.5;
+
+    PolyphaseDecimator::PolyphaseDecimator(int factor, double passFreq) : _factor(factor) {
+        assert(factor >= 1);
+
+        if (factor == 1) {
+            _taps = vector<double>(1, 1.);
+            return;
+        }
+
+        // the cutoff is the output nyquist so everything that would alias onto the pass band
+        // (above 1 / factor - passFreq) is in the stop band
+        double cutoff = .5 / factor;
+        double transition = 1. / factor - 2 * passFreq;
+        assert(transition > 0);
+
+        int total = (int) ceil(BLACKMAN_TRANSITION / transition);
+        total += (total % 2 == 0) ? 1 : 0;
+
+        _taps = vector<double>(total);
+        int center = total / 2;
+        double sum = 0;
+        for (int i = 0; i < total; i++) {
+            double n = i - center;
+            double sinc = (n == 0) ? 2 * cutoff : sin(2 * M_PI * cutoff * n) / (M_PI * n);
+            double window = .42 - .5 * cos(2 * M_PI * i / (total - 1)) + .08 * cos(4 * M_PI * i / (total - 1));
+            _taps[i] = sinc * window;
+            sum += _taps[i];
+        }
+
+        // unity gain at dc
+        for (auto& tap : _taps)
+            tap /= sum;
+    }
+
+    int PolyphaseDecimator::factor() const { return _factor; }
+
+    int PolyphaseDecimator::taps() const { return _taps.size(); }
+
+    int PolyphaseDecimator::decimate(const double* input, int inputSize, double* output) const {
+        int outputSize = inputSize / _factor;
+        int total = _taps.size();
+        int center = total / 2;
+
+        for (int m = 0; m < outputSize; m++) {
+            // only the input samples contributing to retained outputs are filtered
+            int inputCenter = m * _factor;
+            int first = max(0, inputCenter + center - (inputSize - 1));
+            int last = min(total, inputCenter + center + 1);
+
+            const double* x = input + inputCenter + center;
+            double tot = 0;
+            for (int k = first; k < last; k++)
+                tot += _taps[k] * x[-k];
+
+            output[m] = tot;
+        }
+
+        return outputSize;
+    }
+}
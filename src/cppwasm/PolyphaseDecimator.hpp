@@ -0,0 +1,40 @@
+#pragma once
+#include <vector>
+
+namespace constantq {
+    /**
+     * anti-aliased decimation by an integer factor using a windowed sinc low pass filter
+     * where only the retained output samples are computed
+     */
+    class PolyphaseDecimator {
+        private:
+            // the decimation factor
+            int _factor;
+
+            // the filter taps (odd length and symmetric so the filter delay is _taps.size() / 2)
+            std::vector<double> _taps;
+
+        public:
+            /**
+             * @param factor        the decimation factor
+             * @param passFreq      the highest frequency (as a fraction of the input rate) to preserve
+             */
+            PolyphaseDecimator(int factor, double passFreq);
+
+            int factor() const;
+
+            /**
+             * @returns the number of filter taps
+             */
+            int taps() const;
+
+            /**
+             * decimates the input (samples outside the input are treated as silence)
+             * @param input         the input samples
+             * @param inputSize     the number of input samples
+             * @param output        where inputSize / factor decimated samples will be written
+             * @returns             the number of decimated samples
+             */
+            int decimate(const double* input, int inputSize, double* output) const;
+    };
+}
@@ -0,0 +1,197 @@
+#include <vector>
+#include <string>
+#include <sstream>
+#include <chrono>
+#include "Profiler.hpp"
+
+using namespace std;
+
+namespace constantq {
+    // bounds memory used by trace events for long sessions
+    const size_t MAX_PROFILE_EVENTS = 100000;
+
+    // chrome trace timestamps are in microseconds
+    const double MICROSECONDS = 1000000.;
+
+    Profiler::Profiler() : _enabled(true), _epoch(now()) {
+        clear(_totals);
+        clear(_chunk);
+    }
+
+    Profiler& Profiler::instance() {
+        thread_local Profiler profiler;
+        return profiler;
+    }
+
+    double Profiler::now() {
+        return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    string Profiler::stageName(int stage) {
+        switch (stage) {
+            case STAGE_KERNEL_BUILD: return "kernel build";
+            case STAGE_INGESTION_COPY: return "ingestion copy";
+            case STAGE_FFT: return "fft";
+            case STAGE_KERNEL_APPLY: return "kernel apply";
+            case STAGE_POST_PROCESS: return "post process";
+            case STAGE_SERIALIZATION: return "serialization";
+            case STAGE_DECIMATION: return "decimation";
+            default: return "chunk";
+        }
+    }
+
+    void Profiler::clear(ProfileSummary& summary) {
+        for (int s = 0; s < TOTAL_STAGES; s++) {
+            summary.stageSeconds[s] = 0;
+            summary.stageCalls[s] = 0;
+        }
+
+        summary.bytesCopied = 0;
+        summary.framesProcessed = 0;
+    }
+
+    void Profiler::add(ProfileSummary& summary, const ProfileSummary& toAdd) {
+        for (int s = 0; s < TOTAL_STAGES; s++) {
+            summary.stageSeconds[s] += toAdd.stageSeconds[s];
+            summary.stageCalls[s] += toAdd.stageCalls[s];
+        }
+
+        summary.bytesCopied += toAdd.bytesCopied;
+        summary.framesProcessed += toAdd.framesProcessed;
+    }
+
+    bool Profiler::enabled() const { return _enabled; }
+
+    void Profiler::setEnabled(bool enabled) { _enabled = enabled; }
+
+    void Profiler::reset() {
+        clear(_totals);
+        clear(_chunk);
+        _events.clear();
+        _epoch = now();
+    }
+
+    void Profiler::addTime(int stage, double seconds) {
+        _totals.stageSeconds[stage] += seconds;
+        _totals.stageCalls[stage]++;
+        _chunk.stageSeconds[stage] += seconds;
+        _chunk.stageCalls[stage]++;
+    }
+
+    void Profiler::addBytesCopied(double bytes) {
+        if (!_enabled)
+            return;
+
+        _totals.bytesCopied += bytes;
+        _chunk.bytesCopied += bytes;
+    }
+
+    void Profiler::addFrames(int frames) {
+        if (!_enabled)
+            return;
+
+        _totals.framesProcessed += frames;
+        _chunk.framesProcessed += frames;
+    }
+
+    void Profiler::beginChunk() { clear(_chunk); }
+
+    ProfileSummary Profiler::endChunk() const { return _chunk; }
+
+    void Profiler::addEvent(const ProfileEvent& evt) {
+        if (_enabled && _events.size() < MAX_PROFILE_EVENTS)
+            _events.push_back(evt);
+    }
+
+    void Profiler::addChunk(int worker, int chunk, const ProfileSummary& summary) {
+        if (!_enabled)
+            return;
+
+        double total = 0;
+        for (int s = 0; s < TOTAL_STAGES; s++)
+            total += summary.stageSeconds[s];
+
+        // the worker's clock is not shared, so the chunk is placed as ending when it was received
+        // with its stages (aggregated across frames) laid end to end
+        double start = now() - _epoch - total;
+        add(_totals, summary);
+        addEvent({ -1, worker, chunk, start, total, summary.bytesCopied, summary.framesProcessed });
+
+        double stageStart = start;
+        for (int s = 0; s < TOTAL_STAGES; s++) {
+            if (summary.stageCalls[s] == 0)
+                continue;
+
+            addEvent({ s, worker, chunk, stageStart, summary.stageSeconds[s], 0, 0 });
+            stageStart += summary.stageSeconds[s];
+        }
+    }
+
+    const ProfileSummary& Profiler::totals() const { return _totals; }
+
+    ProfileSummary Profiler::workerTotals(int worker) const {
+        ProfileSummary toRet;
+        clear(toRet);
+
+        for (auto& evt : _events) {
+            if (evt.worker != worker)
+                continue;
+
+            if (evt.stage < 0) {
+                toRet.bytesCopied += evt.bytesCopied;
+                toRet.framesProcessed += evt.framesProcessed;
+            }
+            else {
+                toRet.stageSeconds[evt.stage] += evt.seconds;
+                toRet.stageCalls[evt.stage]++;
+            }
+        }
+
+        return toRet;
+    }
+
+    const vector<ProfileEvent>& Profiler::events() const { return _events; }
+
+    string Profiler::toChromeTrace() const {
+        ostringstream stringStream;
+        stringStream << "{\"traceEvents\":[";
+
+        bool first = true;
+        for (auto& evt : _events) {
+            if (!first)
+                stringStream << ",";
+            first = false;
+
+            // the orchestrator is process 0 and workers are numbered from 1
+            stringStream << "{\"name\":\"" << stageName(evt.stage) << "\""
+                << ",\"cat\":\"constantq\",\"ph\":\"X\""
+                << ",\"ts\":" << evt.start * MICROSECONDS
+                << ",\"dur\":" << evt.seconds * MICROSECONDS
+                << ",\"pid\":" << evt.worker + 1
+                << ",\"tid\":" << evt.chunk + 1
+                << ",\"args\":{\"chunk\":" << evt.chunk
+                << ",\"bytesCopied\":" << evt.bytesCopied
+                << ",\"framesProcessed\":" << evt.framesProcessed << "}}";
+        }
+
+        stringStream << "],\"otherData\":{";
+        for (int s = 0; s < TOTAL_STAGES; s++) {
+            stringStream << "\"" << stageName(s) << " seconds\":" << _totals.stageSeconds[s]
+                << ",\"" << stageName(s) << " calls\":" << _totals.stageCalls[s] << ",";
+        }
+
+        stringStream << "\"bytesCopied\":" << _totals.bytesCopied
+            << ",\"framesProcessed\":" << _totals.framesProcessed << "}}";
+
+        return stringStream.str();
+    }
+
+    ProfileTimer::ProfileTimer(int stage) : _stage(stage),
+        _start(Profiler::instance().enabled() ? Profiler::now() : 0) { }
+
+    ProfileTimer::~ProfileTimer() {
+        auto& profiler = Profiler::instance();
+        if (profiler.enabled())
+            profiler.addTime(_stage, Profiler::now() - _start);
+    }
+}
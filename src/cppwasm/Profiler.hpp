@@ -0,0 +1,166 @@
+#pragma once
+#include <vector>
+#include <string>
+
+namespace constantq {
+    // the stages of analysis timed by the profiler
+    const int STAGE_KERNEL_BUILD = 0;
+    const int STAGE_INGESTION_COPY = 1;
+    const int STAGE_FFT = 2;
+    const int STAGE_KERNEL_APPLY = 3;
+    const int STAGE_POST_PROCESS = 4;
+    const int STAGE_SERIALIZATION = 5;
+    const int STAGE_DECIMATION = 6;
+    const int TOTAL_STAGES = 7;
+
+    // identifies the orchestrator (as opposed to a worker) in profile records
+    const int PROFILE_ORCHESTRATOR = -1;
+
+    /**
+     * plain summary of timings and counters so it can be copied into worker messages
+     */
+    struct ProfileSummary {
+        double stageSeconds[TOTAL_STAGES];
+        long long stageCalls[TOTAL_STAGES];
+        double bytesCopied;
+        int framesProcessed;
+    };
+
+    /**
+     * a completed span of time to be displayed in a trace
+     */
+    struct ProfileEvent {
+        // the stage (or -1 for an entire chunk)
+        int stage;
+        // the worker that did the work (PROFILE_ORCHESTRATOR for the orchestrator)
+        int worker;
+        // the chunk of the analysis or -1 if not pertaining to a chunk
+        int chunk;
+        // start time in seconds relative to the profiler epoch
+        double start;
+        // duration in seconds
+        double seconds;
+        // counters gathered during the span
+        double bytesCopied;
+        int framesProcessed;
+    };
+
+    /**
+     * low overhead stage timers and counters for the analysis hot path
+     * each wasm instance (orchestrator and each worker) has its own instance; natively each thread has its
+     * own so sessions on different threads are timed without locking
+     */
+    class Profiler {
+        private:
+            bool _enabled;
+
+            // the time all event start times are relative to
+            double _epoch;
+
+            // totals since creation or last reset
+            ProfileSummary _totals;
+
+            // totals since the current chunk began
+            ProfileSummary _chunk;
+
+            // recorded spans for trace export (bounded by MAX_PROFILE_EVENTS)
+            std::vector<ProfileEvent> _events;
+
+            Profiler();
+
+            static void clear(ProfileSummary& summary);
+
+            static void add(ProfileSummary& summary, const ProfileSummary& toAdd);
+
+        public:
+            /**
+             * @returns the profiler for this wasm instance (or native thread)
+             */
+            static Profiler& instance();
+
+            /**
+             * @returns a monotonic time in seconds
+             */
+            static double now();
+
+            /**
+             * @returns the name of the stage for display
+             */
+            static std::string stageName(int stage);
+
+            bool enabled() const;
+
+            void setEnabled(bool enabled);
+
+            /**
+             * clears all totals and events
+             */
+            void reset();
+
+            /**
+             * records time spent in a stage
+             * @param stage     the STAGE_ constant
+             * @param seconds   the time spent
+             */
+            void addTime(int stage, double seconds);
+
+            void addBytesCopied(double bytes);
+
+            void addFrames(int frames);
+
+            /**
+             * starts accumulating a new chunk summary
+             */
+            void beginChunk();
+
+            /**
+             * @returns the summary accumulated since beginChunk
+             */
+            ProfileSummary endChunk() const;
+
+            /**
+             * records a span for trace export
+             */
+            void addEvent(const ProfileEvent& evt);
+
+            /**
+             * records a chunk processed elsewhere (i.e. a worker) as trace events ending at the current time
+             * and adds its summary to the totals
+             * @param worker    the worker that processed the chunk
+             * @param chunk     the chunk index
+             * @param summary   the summary from that worker's profiler
+             */
+            void addChunk(int worker, int chunk, const ProfileSummary& summary);
+
+            /**
+             * @returns the totals since creation or last reset
+             */
+            const ProfileSummary& totals() const;
+
+            /**
+             * @returns the totals for all recorded events of the given worker
+             */
+            ProfileSummary workerTotals(int worker) const;
+
+            const std::vector<ProfileEvent>& events() const;
+
+            /**
+             * @returns the events and totals in the chrome trace event json format
+             * (viewable in chrome://tracing or https://ui.perfetto.dev)
+             */
+            std::string toChromeTrace() const;
+    };
+
+    /**
+     * times the enclosing scope as the given stage
+     */
+    class ProfileTimer {
+        private:
+            int _stage;
+            double _start;
+
+        public:
+            ProfileTimer(int stage);
+            ~ProfileTimer();
+    };
+}
@@ -0,0 +1,28 @@
+#include <map>
+#include <memory>
+#include "SessionRegistry.hpp"
+
+using namespace std;
+
+namespace constantq {
+    ConstantQSession& SessionRegistry::create(int id, int fs, double minFreq, double maxFreq, 
+                                                int bins, double thresh, int outputs, bool decimate, 
+                                                int accuracy) {
+        // the previous session is released first so its kernel can be reused or freed
+        _sessions.erase(id);
+        auto& session = _sessions[id];
+        session.reset(new ConstantQSession(fs, minFreq, maxFreq, bins, thresh, outputs, decimate, accuracy));
+        return *session;
+    }
+
+    ConstantQSession* SessionRegistry::find(int id) {
+        auto found = _sessions.find(id);
+        return found == _sessions.end() ? nullptr : found->second.get();
+    }
+
+    bool SessionRegistry::release(int id) {
+        return _sessions.erase(id) > 0;
+    }
+
+    int SessionRegistry::size() const { return _sessions.size(); }
+}
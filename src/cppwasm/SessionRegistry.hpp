@@ -0,0 +1,51 @@
+#pragma once
+#include <map>
+#include <memory>
+#include "ConstantQSession.hpp"
+
+namespace constantq {
+    /**
+     * the sessions of a worker keyed by session id so analyses with different settings
+     * can be interleaved on the same worker (sessions with identical kernel parameters share a kernel)
+     */
+    class SessionRegistry {
+        private:
+            std::map<int, std::unique_ptr<ConstantQSession> > _sessions;
+
+        public:
+            /**
+             * creates a session replacing any existing session with the same id
+             * @param id        the session id
+             * @param fs        the frames per second (44100 for 44.1 kHz)
+             * @param minFreq   minimum frequency for  analysis (in Hz)
+             * @param maxFreq   maximum frequency for  analysis (in Hz)
+             * @param bins      bins per octave
+             * @param thresh    minimum threshold to be encapsulated for determining bin amplitude
+             * @param outputs   the OUTPUT_ flags determining what is produced per frame
+             * @param decimate  whether to decimate the audio to the lowest adequate rate
+             * @param accuracy  the ACCURACY_ tier
+             * @returns         the created session
+             */
+            ConstantQSession& create(int id, int fs, double minFreq, double maxFreq, int bins, double thresh,
+                                        int outputs = OUTPUT_BINS, bool decimate = false, 
+                                        int accuracy = ACCURACY_EXACT);
+
+            /**
+             * @param id    the session id
+             * @returns     the session or nullptr if there is no session with that id
+             */
+            ConstantQSession* find(int id);
+
+            /**
+             * removes the session freeing its buffers (and its kernel if no other session uses it)
+             * @param id    the session id
+             * @returns     whether there was a session with that id
+             */
+            bool release(int id);
+
+            /**
+             * @returns the number of sessions
+             */
+            int size() const;
+    };
+}
@@ -1,6 +1,8 @@
 #include <vector> 
 #include <string>
 #include <stdio.h>
+#include <cassert>
+#include <cstring>
 #include "KernelEntry.hpp"
 #include "SparseKernel.hpp"
 
@@ -8,33 +10,101 @@ using namespace std;
 
 
 namespace constantq {
-    vector<vector<KernelEntry> > SparseKernel::matrix() const { return _matrix; }
-    int SparseKernel::size() { return _size; }
-    int SparseKernel::bins() { return _bins; }
+    vector<vector<KernelEntry> > SparseKernel::matrix() const {
+        vector<vector<KernelEntry> > toRet(_bins);
+        for (int b = 0; b < _bins; b++)
+            toRet[b] = vector<KernelEntry>(row(b), row(b) + rowSize(b));
+
+        return toRet;
+    }
+
+    const KernelEntry* SparseKernel::row(int bin) const { return _entries.data() + _rowStarts[bin]; }
+    int SparseKernel::rowSize(int bin) const { return _rowStarts[bin + 1] - _rowStarts[bin]; }
+    int SparseKernel::size() const { return _size; }
+    int SparseKernel::bins() const { return _bins; }
 
 
-    SparseKernel::SparseKernel(vector<vector<KernelEntry> > matrix, int size, int bins) : _matrix(matrix) {
+    SparseKernel::SparseKernel(const vector<vector<KernelEntry> >& matrix, int size, int bins) : _rowStarts(1, 0) {
         _size = size;
         _bins = bins;
+
+        for (auto& thisRow : matrix) {
+            _entries.insert(_entries.end(), thisRow.begin(), thisRow.end());
+            _rowStarts.push_back(_entries.size());
+        }
+    }
+
+    SparseKernel::SparseKernel(KernelVector<KernelEntry> entries, KernelVector<int> rowStarts, int size, int bins) :
+        _entries(move(entries)), _rowStarts(move(rowStarts)) {
+        assert(_rowStarts.size() == bins + 1);
+        _size = size;
+        _bins = bins;
+    }
+
+    vector<char> SparseKernel::serialize() const {
+        SerializedKernelHeader header = { _size, _bins, (int) _entries.size(), 0 };
+        int rowStartsSize = sizeof(int) * _rowStarts.size();
+        vector<char> toRet(sizeof(SerializedKernelHeader) + rowStartsSize + 
+            sizeof(SerializedKernelEntry) * _entries.size());
+
+        char* position = &toRet[0];
+        memcpy(position, &header, sizeof(SerializedKernelHeader));
+        position += sizeof(SerializedKernelHeader);
+        memcpy(position, _rowStarts.data(), rowStartsSize);
+        position += rowStartsSize;
+
+        for (auto& entry : _entries) {
+            SerializedKernelEntry serialized = { entry.fftIndex(), entry.multiplier().real(), entry.multiplier().imag() };
+            memcpy(position, &serialized, sizeof(SerializedKernelEntry));
+            position += sizeof(SerializedKernelEntry);
+        }
+
+        return toRet;
+    }
+
+    SparseKernel SparseKernel::deserialize(const char* data, int size) {
+        // items are copied out rather than read in place as the bytes may not be aligned
+        SerializedKernelHeader header;
+        assert(size >= sizeof(SerializedKernelHeader));
+        memcpy(&header, data, sizeof(SerializedKernelHeader));
+        const char* position = data + sizeof(SerializedKernelHeader);
+
+        assert(size == sizeof(SerializedKernelHeader) + sizeof(int) * (header.bins + 1) + 
+            sizeof(SerializedKernelEntry) * header.totalEntries);
+
+        KernelVector<int> rowStarts(header.bins + 1);
+        memcpy(rowStarts.data(), position, sizeof(int) * rowStarts.size());
+        position += sizeof(int) * rowStarts.size();
+
+        KernelVector<KernelEntry> entries;
+        entries.reserve(header.totalEntries);
+        for (int e = 0; e < header.totalEntries; e++) {
+            SerializedKernelEntry serialized;
+            memcpy(&serialized, position, sizeof(SerializedKernelEntry));
+            position += sizeof(SerializedKernelEntry);
+            entries.push_back(KernelEntry(serialized.fftIndex, complex<double>(serialized.real, serialized.imag)));
+        }
+
+        return SparseKernel(move(entries), move(rowStarts), header.size, header.bins);
     }
 
     string SparseKernel::toString() {
         ostringstream stringStream;
         stringStream << "Complex { size: " << _size << ", bins: " << _bins << " matrix: [";
         
-        for(size_t r = 0; r < _matrix.size(); ++r)
+        for(int r = 0; r < _bins; ++r)
         {
             if (r != 0)
                 stringStream << ",";
 
             stringStream << "  [";
 
-            auto row = _matrix[r];
-            for (size_t e = 0; e < row.size(); ++e) {
+            auto thisRow = row(r);
+            for (int e = 0; e < rowSize(r); ++e) {
                 if (e != 0)
                     stringStream << ", ";
 
-                auto entry = row[e];
+                auto entry = thisRow[e];
                 stringStream << entry.toString();
             }
             
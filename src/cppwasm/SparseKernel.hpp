@@ -2,17 +2,39 @@
 #include <vector> 
 #include <string>
 #include "KernelEntry.hpp"
+#include "MemoryTracker.hpp"
 
 namespace constantq {
+    /**
+     * precedes the row starts and entries of a serialized sparse kernel
+     */
+    struct SerializedKernelHeader {
+        int size;
+        int bins;
+        int totalEntries;
+        int reserved;       // unused; keeps the header a multiple of 8 bytes
+    };
+
+    /**
+     * a kernel entry stored as plain data in a serialized sparse kernel
+     */
+    struct SerializedKernelEntry {
+        int fftIndex;
+        double real;
+        double imag;
+    };
+
     /**
      * represents the sparse kernel to apply to the fft in order to determine pitch data
      * taken from http://doc.ml.tu-berlin.de/bbci/material/publications/Bla_constQ.pdf
      */
     class SparseKernel {
-        // the 2-d array of kernel entry information
-        // 1st index represents the bin
-        // the nested array are the lists of kernel entries to apply to the fft
-        std::vector<std::vector<KernelEntry> > _matrix;
+        // the kernel entries for all bins stored contiguously
+        // entries for bin b are from _rowStarts[b] up to _rowStarts[b + 1]
+        KernelVector<KernelEntry> _entries;
+
+        // the index into _entries where each bin starts (bins + 1 items)
+        KernelVector<int> _rowStarts;
 
         // the size of the fft to use for this sparse kernel to properly apply
         int _size;
@@ -21,17 +43,57 @@ namespace constantq {
         int _bins;
 
         public:
+            /**
+             * @returns the 2-d array of kernel entry information where the
+             *          1st index represents the bin and the nested array are 
+             *          the lists of kernel entries to apply to the fft
+             */
+            std::vector<std::vector<KernelEntry> > matrix() const;
+
+            /**
+             * @param bin   the bin
+             * @returns     the first kernel entry for the bin
+             */
+            const KernelEntry* row(int bin) const;
+
+            /**
+             * @param bin   the bin
+             * @returns     the number of kernel entries for the bin
+             */
+            int rowSize(int bin) const;
+
+            int size() const;
+            int bins() const;
+
             /**
              * creates a sparse kernel
              * @param matrix    the 2-d array of kernel entry information
              * @param size      the size of the fft to use for this parse kernel
              * @param bins      the number of bins
              */
-            std::vector<std::vector<KernelEntry> > matrix() const;
-            int size();
-            int bins();
+            SparseKernel(const std::vector<std::vector<KernelEntry> >& matrix, int size, int bins);
 
-            SparseKernel(std::vector<std::vector<KernelEntry> > matrix, int size, int bins);
+            /**
+             * creates a sparse kernel from contiguous storage
+             * @param entries   the kernel entries for all bins
+             * @param rowStarts the index into entries where each bin starts (bins + 1 items)
+             * @param size      the size of the fft to use for this parse kernel
+             * @param bins      the number of bins
+             */
+            SparseKernel(KernelVector<KernelEntry> entries, KernelVector<int> rowStarts, int size, int bins);
+
+            /**
+             * @returns the kernel as plain bytes (a SerializedKernelHeader followed by the bins + 1 row starts 
+             *          and the entries) so it can be posted to a worker instead of being built there
+             */
+            std::vector<char> serialize() const;
+
+            /**
+             * @param data  the bytes from serialize
+             * @param size  the number of bytes
+             * @returns     the sparse kernel
+             */
+            static SparseKernel deserialize(const char* data, int size);
 
             /**
              * a string representation of this sparse kernel
@@ -39,4 +101,4 @@ namespace constantq {
             std::string toString();
     };
         
-}
\ No newline at end of file
+}
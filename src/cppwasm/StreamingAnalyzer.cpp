@@ -0,0 +1,165 @@
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <cassert>
+#include <unistd.h>
+#include "StreamingAnalyzer.hpp"
+
+using namespace std;
+
+namespace constantq {
+    StreamingAnalyzer::StreamingAnalyzer(const StreamSettings& settings) : _settings(settings),
+        _frameInterval(0), _bufferFrame(0), _framesAnalyzed(0), _outputStart(0), _finished(false) { 
+        
+        assert(settings.framesPerSecond > 0);
+        assert(settings.windowFrames > 0);
+    }
+
+    ConstantQSession* StreamingAnalyzer::session() { return _session.get(); }
+
+    const OnsetDetector* StreamingAnalyzer::onsetDetector() const { return _onsetDetector.get(); }
+
+    bool StreamingAnalyzer::valid() const { return !_reader.failed(); }
+
+    const double* StreamingAnalyzer::output() const { return _output.data(); }
+
+    int StreamingAnalyzer::outputFrames() {
+        return _session ? _output.size() / _session->frameSize() : 0;
+    }
+
+    int StreamingAnalyzer::outputStart() const { return _outputStart; }
+
+    void StreamingAnalyzer::consumeOutput() {
+        _outputStart = _framesAnalyzed;
+        _output.clear();
+    }
+
+    int StreamingAnalyzer::totalFrames() {
+        if (_finished)
+            return _framesAnalyzed;
+
+        if (!_session || _reader.totalSamples() < 0)
+            return -1;
+
+        long long extra = _reader.totalSamples() - _session->size();
+        return extra < 0 ? 0 : (int) (extra / _frameInterval + 1);
+    }
+
+    int StreamingAnalyzer::availableFrames() {
+        int kernelLen = _session->size();
+        int size = _samples.size();
+        if (size < kernelLen)
+            return 0;
+
+        // frames from the start of the buffer less those already analyzed
+        int buffered = (size - kernelLen) / _frameInterval + 1;
+        return max(0, buffered - (_framesAnalyzed - _bufferFrame));
+    }
+
+    void StreamingAnalyzer::analyzeWindow(int frames) {
+        // the buffer starts with the last analyzed frame so it can prime spectral flux
+        int lead = _framesAnalyzed - _bufferFrame;
+        int primeFrames = (_session->outputs() & OUTPUT_ONSETS) ? lead : 0;
+        int startFrame = (lead - primeFrames) * _frameInterval;
+
+        int frameSize = _session->frameSize();
+        int outputOffset = _output.size();
+        _output.resize(outputOffset + frames * frameSize);
+
+        _session->analyzeInto(&_samples[0], _samples.size(), startFrame, _frameInterval, frames,
+            &_output[outputOffset], primeFrames);
+
+        // onsets and beats picked within the window are replaced by those of the whole stream in finish
+        if (_session->outputs() & OUTPUT_ONSETS) {
+            int fluxItem = frameSize - ONSETS_SIZE;
+            for (int f = 0; f < frames; f++) {
+                double* frame = &_output[outputOffset + f * frameSize];
+                _flux.push_back(frame[fluxItem]);
+                frame[fluxItem + 1] = 0;
+                frame[fluxItem + 2] = 0;
+            }
+        }
+
+        _framesAnalyzed += frames;
+
+        // samples before the last analyzed frame are no longer needed
+        int dropFrames = _framesAnalyzed - 1 - _bufferFrame;
+        _samples.erase(_samples.begin(), _samples.begin() + dropFrames * _frameInterval);
+        _bufferFrame += dropFrames;
+    }
+
+    bool StreamingAnalyzer::push(const char* bytes, int size) {
+        assert(!_finished);
+
+        if (!_reader.push(bytes, size, _samples))
+            return false;
+
+        if (!_reader.headerRead())
+            return true;
+
+        if (!_session) {
+            // more frames per second than the sample rate analyze every sample
+            _frameInterval = max(1, (int) (_reader.fs() / _settings.framesPerSecond));
+            _session.reset(new ConstantQSession(_reader.fs(), _settings.minFreq, _settings.maxFreq,
+                _settings.bins, _settings.thresh, _settings.outputs, _settings.decimate, _settings.accuracy));
+        }
+
+        while (availableFrames() >= _settings.windowFrames)
+            analyzeWindow(_settings.windowFrames);
+
+        return true;
+    }
+
+    void StreamingAnalyzer::finish() {
+        if (_session) {
+            int remaining = availableFrames();
+            if (remaining > 0)
+                analyzeWindow(remaining);
+
+            if (_session->outputs() & OUTPUT_ONSETS) {
+                _onsetDetector.reset(new OnsetDetector((double) _reader.fs() / _frameInterval));
+                _onsetDetector->setFlux(move(_flux));
+                _flux = vector<double>();
+            }
+        }
+
+        _finished = true;
+        _samples = AudioVector<double>();
+    }
+
+    int StreamingAnalyzer::analyzeDescriptor(int fd, const StreamSettings& settings,
+                const function<void(int, const double*, int)>& onFrames, 
+                const function<void(const OnsetDetector&)>& onOnsets, int readBytes) {
+
+        StreamingAnalyzer analyzer(settings);
+        vector<char> buffer(readBytes);
+
+        auto flush = [&]() {
+            if (analyzer.outputFrames() > 0)
+                onFrames(analyzer.outputStart(), analyzer.output(), analyzer.outputFrames());
+
+            analyzer.consumeOutput();
+        };
+
+        while (true) {
+            auto bytesRead = read(fd, &buffer[0], readBytes);
+            if (bytesRead <= 0)
+                break;
+
+            if (!analyzer.push(&buffer[0], bytesRead))
+                return -1;
+
+            flush();
+        }
+
+        if (!analyzer.session())
+            return -1;
+
+        analyzer.finish();
+        flush();
+        if (onOnsets && analyzer.onsetDetector())
+            onOnsets(*analyzer.onsetDetector());
+
+        return analyzer.totalFrames();
+    }
+}
@@ -0,0 +1,155 @@
+#pragma once
+#include <memory>
+#include <functional>
+#include "ConstantQSession.hpp"
+#include "OnsetDetector.hpp"
+#include "WavReader.hpp"
+#include "MemoryTracker.hpp"
+
+namespace constantq {
+    // the default number of frames analyzed at once by a StreamingAnalyzer
+    const int DEFAULT_STREAM_WINDOW_FRAMES = 64;
+
+    // the default number of bytes read at once from a file descriptor
+    const int DEFAULT_STREAM_READ_BYTES = 1 << 16;
+
+    /**
+     * the settings for a streamed analysis (the sample rate is determined by the stream)
+     */
+    struct StreamSettings {
+        double minFreq;
+        double maxFreq;
+        int bins;
+        double thresh;
+        // the OUTPUT_ flags determining what is produced per frame
+        int outputs;
+        // whether to decimate the audio to the lowest adequate rate
+        bool decimate;
+        // the ACCURACY_ tier
+        int accuracy;
+        // constant q frames per second (greater than 0; at most one frame per sample)
+        double framesPerSecond;
+        // frames analyzed at once (windows overlap by the kernel size)
+        int windowFrames;
+    };
+
+    /**
+     * analyzes a wav file as it is pushed so that memory is bounded by the kernel size, 
+     * the window and the output not yet consumed rather than the length of the file
+     * (and, with OUTPUT_ONSETS, the flux of each frame: onsets and beats span the whole stream so their
+     * items are 0 in the output and they are determined by finish; see onsetDetector)
+     */
+    class StreamingAnalyzer {
+        private:
+            StreamSettings _settings;
+            WavReader _reader;
+
+            // created once the stream's sample rate is known
+            std::unique_ptr<ConstantQSession> _session;
+
+            int _frameInterval;
+
+            // decoded samples not yet needed; _samples[0] is the first sample of frame _bufferFrame
+            AudioVector<double> _samples;
+            int _bufferFrame;
+
+            // frames analyzed so far
+            int _framesAnalyzed;
+
+            // analyzed frames not yet consumed starting at frame _outputStart
+            ScratchVector<double> _output;
+            int _outputStart;
+
+            bool _finished;
+
+            // the flux of every frame analyzed with OUTPUT_ONSETS
+            std::vector<double> _flux;
+
+            // the onsets, tempo and beats of the whole stream once finished with OUTPUT_ONSETS
+            std::unique_ptr<OnsetDetector> _onsetDetector;
+
+            /**
+             * @returns the number of frames not yet analyzed whose samples are all available
+             */
+            int availableFrames();
+
+            /**
+             * analyzes the next frames appending them to the output and drops samples no longer needed
+             * @param frames    the number of frames
+             */
+            void analyzeWindow(int frames);
+
+        public:
+            StreamingAnalyzer(const StreamSettings& settings);
+
+            /**
+             * decodes the bytes and analyzes all complete windows
+             * @param bytes     the next bytes of the wav file
+             * @param size      the number of bytes
+             * @returns         false if the stream is not a supported wav
+             */
+            bool push(const char* bytes, int size);
+
+            /**
+             * analyzes all remaining complete frames (no more bytes are expected) and with OUTPUT_ONSETS
+             * determines the onsets, tempo and beats from the flux of every frame
+             */
+            void finish();
+
+            /**
+             * @returns the onsets, tempo and beats of the whole stream once finished with OUTPUT_ONSETS 
+             *          (frame indices are of the whole stream) or nullptr
+             */
+            const OnsetDetector* onsetDetector() const;
+
+            /**
+             * @returns the session once the sample rate is known or nullptr
+             */
+            ConstantQSession* session();
+
+            /**
+             * @returns the total frames for the stream or -1 if not yet known
+             */
+            int totalFrames();
+
+            /**
+             * @returns whether the stream is a supported wav
+             */
+            bool valid() const;
+
+            /**
+             * @returns the frames analyzed and not yet consumed laid out per ConstantQSession::analyzeToSingle
+             */
+            const double* output() const;
+
+            /**
+             * @returns the number of frames analyzed and not yet consumed
+             */
+            int outputFrames();
+
+            /**
+             * @returns the frame index of the first frame in the output
+             */
+            int outputStart() const;
+
+            /**
+             * discards the output once it has been read
+             */
+            void consumeOutput();
+
+            /**
+             * analyzes a wav file read from a file descriptor
+             * @param fd            the file descriptor
+             * @param settings      the analysis settings
+             * @param onFrames      called with (first frame index, frames, frame count) as frames are analyzed
+             * @param onOnsets      called with the onsets, tempo and beats of the whole file once it is analyzed
+             *                      with OUTPUT_ONSETS (the onset and beat items of the frames are 0)
+             * @param readBytes     the bytes read at once
+             * @returns             the total frames analyzed or -1 if the file is not a supported wav
+             */
+            static int analyzeDescriptor(int fd, const StreamSettings& settings,
+                const std::function<void(int, const double*, int)>& onFrames,
+                const std::function<void(const OnsetDetector&)>& onOnsets = nullptr,
+                int readBytes = DEFAULT_STREAM_READ_BYTES);
+    };
+}
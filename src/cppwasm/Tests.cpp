@@ -4,12 +4,29 @@
 #include "KernelEntry.hpp"
 #include "MathUtil.hpp"
 #include "SparseKernel.hpp"
+#include "Profiler.hpp"
+#include "MemoryTracker.hpp"
+#include "BufferPool.hpp"
+#include "KernelCache.hpp"
+#include "SessionRegistry.hpp"
+#include "StreamingAnalyzer.hpp"
+#include "PolyphaseDecimator.hpp"
+#include "AccuracyHarness.hpp"
+#include "FramePyramid.hpp"
+#include "AudioWindow.hpp"
+#include "FrameGate.hpp"
+#include "TileRenderer.hpp"
+#include "FingerprintIndex.hpp"
+#include "ConstantQApi.h"
 
 #include <string>
 #include <optional>
 #include <iostream>
 #include <cmath>
 #include <map>
+#include <cstdio>
+#include <unistd.h>
+#include <thread>
 
 using namespace std;
 using namespace constantq;
@@ -120,12 +137,39 @@ void fftTests() {
     verifyFFT(size, 8);
 }
 
+void prunedFftTests() {
+    string suiteName = "pruned FFT test";
+    int size = 4096;
+
+    // the band the reference kernel reads
+    vector<int> outputs;
+    for (int i = 46; i < 100; i++)
+        outputs.push_back(i);
+
+    auto pruning = MathUtil::fftPruning(size, outputs);
+    test(pruning.butterflies[0].empty() && pruning.butterflies.back().size() == outputs.size(), 
+        suiteName, "stages");
+
+    auto full = generateSin(size, 64);
+    insertSin(full, size, 3, 71);
+    auto pruned = full;
+    MathUtil::fft(full, size);
+    MathUtil::fft(&pruned[0], size, pruning);
+
+    double error = 0;
+    for (auto output : outputs)
+        error = max(error, abs(full[output] - pruned[output]));
+
+    test(error < EPSILON, suiteName, "outputs");
+}
+
 void MathUtilTests() {
     leadingZerosTest();
     reverseTests();
     nextPow2Tests();
     hammingWindowTest();
     fftTests();
+    prunedFftTests();
 }
 
 
@@ -235,12 +279,1212 @@ void ConstantQTests() {
 }
 
 
+vector<double> generateChord(int size, int fs) {
+    vector<complex<double> > buff(size);
+    insertSin(buff, fs, .3, C5);
+    insertSin(buff, fs, .3, E5);
+    insertSin(buff, fs, .3, G5);
+
+    vector<double> toRet(size);
+    for (int i = 0; i < size; i++)
+        toRet[i] = buff[i].real();
+
+    return toRet;
+}
+
+void SessionOutputTests() {
+    string suiteName = "session output tests";
+    ConstantQSession session(44100, C5, 1046.5, 24, .0054, OUTPUT_BINS | OUTPUT_NOTES | OUTPUT_CHROMA);
+    test(session.notes() == 12, suiteName, "notes");
+    test(session.frameSize() == 24 + 12 + CHROMA_SIZE, suiteName, "frameSize");
+
+    auto data = generateChord(session.size(), 44100);
+    auto frame = session.analyzeToSingle(data, 0, session.size(), 1);
+
+    // notes are the summed bins within each semitone
+    for (int n = 0; n < 12; n++)
+        test(suiteName, "note " + to_string(n), frame[2 * n] + frame[2 * n + 1], frame[24 + n], EPSILON);
+
+    // C, E and G should be the pitch classes with the most energy
+    double* chroma = &frame[24 + 12];
+    double minChord = min(chroma[0], min(chroma[4], chroma[7]));
+    for (int c = 0; c < CHROMA_SIZE; c++) {
+        if (c != 0 && c != 4 && c != 7)
+            test(chroma[c] < minChord, suiteName, "chroma " + to_string(c));
+    }
+
+    ConstantQSession chromaSession(44100, C5, 1046.5, 24, .0054, OUTPUT_CHROMA);
+    auto chromaFrame = chromaSession.analyzeToSingle(data, 0, session.size(), 1);
+    test(chromaFrame.size() == CHROMA_SIZE, suiteName, "chroma only size");
+    for (int c = 0; c < CHROMA_SIZE; c++)
+        test(suiteName, "chroma only " + to_string(c), chroma[c], chromaFrame[c], EPSILON);
+}
+
+void CancellationTests() {
+    string suiteName = "cancellation tests";
+    ConstantQSession session(44100, C5, 1046.5, 24, .0054);
+    auto data = generateChord(session.size() * 4, 44100);
+    vector<double> frames(4 * session.frameSize(), -1);
+
+    atomic<bool> cancelled(false);
+    int analyzed = session.analyzeInto(&data[0], data.size(), 0, session.size(), 4, &frames[0], 0, &cancelled);
+    test(analyzed == 4, suiteName, "not cancelled");
+
+    cancelled = true;
+    fill(frames.begin(), frames.end(), -1);
+    analyzed = session.analyzeInto(&data[0], data.size(), 0, session.size(), 4, &frames[0], 0, &cancelled);
+    test(analyzed == 0, suiteName, "cancelled");
+    test(frames[0] == -1, suiteName, "cancelled frames untouched");
+}
+
+void OnsetTests() {
+    string suiteName = "onset tests";
+    int fs = 44100;
+    // 20 constant q frames per second
+    int frameInterval = fs / 20;
+    // a short C5 burst every half second (120 bpm)
+    int beatInterval = fs / 2;
+    int burstLen = fs / 20;
+
+    ConstantQSession session(fs, C5, 1046.5, 24, .0054, OUTPUT_ONSETS);
+    test(session.frameSize() == ONSETS_SIZE, suiteName, "frameSize");
+
+    int totalAnalyses = 200;
+    vector<double> data(frameInterval * (totalAnalyses - 1) + session.size(), 0);
+    for (int start = beatInterval / 4; start + burstLen < data.size(); start += beatInterval) {
+        for (int i = 0; i < burstLen; i++)
+            data[start + i] = .3 * sin(M_PI * i * 2 * C5 / fs);
+    }
+
+    auto frames = session.analyzeToSingle(data, 0, frameInterval, totalAnalyses);
+    test(suiteName, "tempo", 120, session.onsetDetector().tempo(), 3);
+    double trackTempo = session.onsetDetector().tempo();
+    auto trackBeats = session.onsetDetector().beats();
+
+    int onsets = 0;
+    int beats = 0;
+    for (int i = 0; i < totalAnalyses; i++) {
+        onsets += (int) frames[i * ONSETS_SIZE + 1];
+        beats += (int) frames[i * ONSETS_SIZE + 2];
+    }
+
+    int expectedBursts = (data.size() - beatInterval / 4) / beatInterval;
+    test(suiteName, "onsets", expectedBursts, onsets, 1.5);
+    test(suiteName, "beats", expectedBursts, beats, 1.5);
+
+    // priming with the preceding frame should yield the same flux as a continuous analysis
+    auto primed = session.analyzeToSingle(data, frameInterval * 99, frameInterval, 100, 1);
+    for (int i = 0; i < 100; i += 10)
+        test(suiteName, "primed flux " + to_string(i), frames[(100 + i) * ONSETS_SIZE], primed[i * ONSETS_SIZE], EPSILON);
+
+    // the flux of chunks analyzed separately (as by the orchestrator's workers) determines the same
+    // tempo and beats as the whole track
+    auto first = session.analyzeToSingle(data, 0, frameInterval, 100);
+    vector<double> chunkedFlux;
+    for (int i = 0; i < 100; i++)
+        chunkedFlux.push_back(first[i * ONSETS_SIZE]);
+    for (int i = 0; i < 100; i++)
+        chunkedFlux.push_back(primed[i * ONSETS_SIZE]);
+
+    OnsetDetector chunked(20);
+    chunked.setFlux(chunkedFlux);
+    test(suiteName, "chunked tempo", trackTempo, chunked.tempo(), EPSILON);
+    test(chunked.beats() == trackBeats, suiteName, "chunked beats");
+}
+void ProfilerTests() {
+    string suiteName = "profiler tests";
+    auto& profiler = Profiler::instance();
+    profiler.reset();
+
+    ConstantQSession session(44100, C5, 1046.5, 24, .0054);
+    test(profiler.totals().stageCalls[STAGE_KERNEL_BUILD] == 1, suiteName, "kernel build");
+
+    profiler.beginChunk();
+    auto data = generateChord(session.size() * 4, 44100);
+    session.analyzeToSingle(data, 0, session.size(), 4);
+    auto chunk = profiler.endChunk();
+
+    test(chunk.framesProcessed == 4, suiteName, "frames");
+    test(chunk.stageCalls[STAGE_FFT] == 4, suiteName, "fft calls");
+    test(chunk.stageCalls[STAGE_KERNEL_APPLY] == 4, suiteName, "kernel apply calls");
+    test(chunk.bytesCopied == 4 * sizeof(double) * session.size(), suiteName, "bytes copied");
+
+    profiler.addChunk(3, 0, chunk);
+    auto workerTotals = profiler.workerTotals(3);
+    test(workerTotals.framesProcessed == 4, suiteName, "worker frames");
+    test(suiteName, "worker fft seconds", chunk.stageSeconds[STAGE_FFT], workerTotals.stageSeconds[STAGE_FFT], EPSILON);
+    test(profiler.totals().framesProcessed == 8, suiteName, "totals include chunks");
+
+    auto trace = profiler.toChromeTrace();
+    test(trace.find("\"traceEvents\":[{") == 1, suiteName, "trace events");
+    test(trace.find("\"name\":\"fft\"") != string::npos, suiteName, "trace fft");
+
+    profiler.reset();
+    test(profiler.events().empty() && profiler.totals().framesProcessed == 0, suiteName, "reset");
+}
+void MemoryTests() {
+    string suiteName = "memory tests";
+    auto& tracker = MemoryTracker::instance();
+    double kernelBefore = tracker.report().current[MEMORY_KERNEL];
+
+    {
+        ConstantQSession session(44100, C5, 1046.5, 24, .0054);
+        test(tracker.report().current[MEMORY_KERNEL] > kernelBefore, suiteName, "kernel accounted");
+        test(tracker.report().current[MEMORY_SCRATCH] > 0, suiteName, "scratch accounted");
+
+        // repeated analyses reuse the session's scratch memory
+        auto data = generateChord(session.size() * 4, 44100);
+        session.analyzeToSingle(data, 0, session.size(), 4);
+        tracker.resetPeak();
+        double scratchBefore = tracker.report().current[MEMORY_SCRATCH];
+        for (int i = 0; i < 3; i++)
+            session.analyzeToSingle(data, 0, session.size(), 4);
+
+        test(tracker.report().current[MEMORY_SCRATCH] == scratchBefore, suiteName, "scratch flat");
+        test(tracker.report().peak[MEMORY_SCRATCH] == scratchBefore, suiteName, "scratch peak flat");
+    }
+
+    test(tracker.report().current[MEMORY_KERNEL] == kernelBefore, suiteName, "kernel released");
+
+    BufferPool<char, MEMORY_MESSAGE> pool(2);
+    auto buffer = pool.acquire(1000);
+    char* firstPtr = &buffer[0];
+    pool.release(move(buffer));
+    test(pool.retained() == 1, suiteName, "pool retains");
+
+    double messageBefore = tracker.report().current[MEMORY_MESSAGE];
+    auto reused = pool.acquire(500);
+    test(&reused[0] == firstPtr && reused.size() == 500, suiteName, "pool reuses");
+    test(tracker.report().current[MEMORY_MESSAGE] == messageBefore, suiteName, "pool no allocation");
+}
+
+void SessionRegistryTests() {
+    string suiteName = "session registry tests";
+    SessionRegistry registry;
+    auto& cache = KernelCache::instance();
+    int kernelsBefore = cache.size();
+
+    auto& preview = registry.create(1, 44100, C5, 1046.5, 12, .0054);
+    auto& full = registry.create(2, 44100, C5, 1046.5, 24, .0054, OUTPUT_BINS | OUTPUT_CHROMA);
+    auto& fullCopy = registry.create(3, 44100, C5, 1046.5, 24, .0054);
+    test(registry.size() == 3, suiteName, "size");
+    test(cache.size() == kernelsBefore + 2, suiteName, "kernels shared");
+    test(&full.kernel() == &fullCopy.kernel(), suiteName, "identical kernel");
+    test(&preview.kernel() != &full.kernel(), suiteName, "distinct kernel");
+
+    // interleaved analyses do not affect one another
+    auto data = generateChord(full.size() * 2, 44100);
+    auto fullFrame = full.analyzeToSingle(data, 0, full.size(), 1);
+    preview.analyzeToSingle(data, 0, preview.size(), 1);
+    auto fullAgain = registry.find(2)->analyzeToSingle(data, 0, full.size(), 1);
+    test(fullFrame == fullAgain, suiteName, "interleaved");
+
+    test(registry.find(4) == nullptr, suiteName, "missing");
+    test(registry.release(1) && !registry.release(1), suiteName, "release");
+    test(cache.size() == kernelsBefore + 1, suiteName, "kernel freed");
+}
+
+void BakedKernelTests() {
+    string suiteName = "baked kernel tests";
+    test(KernelCache::findBaked(44100, 65.41, 1046.5, 24, .0054) != nullptr, suiteName, "default found");
+    test(KernelCache::findBaked(44100, 65.41, 1046.5, 48, .0054) == nullptr, suiteName, "other not found");
+
+    // baked kernels match those built at runtime
+    for (int i = 0; i < TOTAL_BAKED_KERNELS; i++) {
+        auto& baked = BAKED_KERNELS[i];
+        auto fromBaked = KernelCache::fromBaked(baked);
+        auto built = ConstantQ::sparseKernel(baked.fs, baked.minFreq, baked.maxFreq, baked.bins, baked.thresh);
+        string name = "kernel " + to_string(baked.fs);
+        test(fromBaked.size() == built.size() && fromBaked.bins() == built.bins(), suiteName, name + " dimensions");
+
+        bool matches = true;
+        for (int b = 0; b < built.bins() && matches; b++) {
+            matches = fromBaked.rowSize(b) == built.rowSize(b);
+            for (int e = 0; e < built.rowSize(b) && matches; e++) {
+                matches = fromBaked.row(b)[e].fftIndex() == built.row(b)[e].fftIndex() &&
+                    abs(fromBaked.row(b)[e].multiplier() - built.row(b)[e].multiplier()) < EPSILON;
+            }
+        }
+
+        test(matches, suiteName, name + " entries");
+    }
+}
+
+void KernelSharingTests() {
+    string suiteName = "kernel sharing tests";
+
+    // a kernel not baked into the binary so it would otherwise be built
+    int fs = 22050;
+    auto built = ConstantQ::sparseKernel(fs, C5, 1046.5, 24, .0054);
+    auto serialized = built.serialize();
+    auto loaded = SparseKernel::deserialize(&serialized[0], serialized.size());
+    test(loaded.size() == built.size() && loaded.bins() == built.bins(), suiteName, "dimensions");
+    test(loaded.matrix().size() == built.matrix().size() && loaded.toString() == built.toString(), 
+        suiteName, "entries");
+
+    // a session with the shared kernel's parameters uses it rather than building its own
+    auto& profiler = Profiler::instance();
+    profiler.reset();
+    auto kernel = KernelCache::instance().add(fs, C5, 1046.5, 24, .0054, move(loaded));
+    ConstantQSession session(fs, C5, 1046.5, 24, .0054);
+    test(&session.kernel() == kernel.get(), suiteName, "session uses kernel");
+    test(profiler.totals().stageCalls[STAGE_KERNEL_BUILD] == 0, suiteName, "not built");
+
+    // a kernel already in use is kept
+    auto other = KernelCache::instance().add(fs, C5, 1046.5, 24, .0054, built);
+    test(other == kernel, suiteName, "existing kept");
+
+    // decimated sessions share the kernel of the decimated rate
+    test(ConstantQSession::kernelRate(44100, 1046.5, true) == 2940, suiteName, "decimated rate");
+    test(ConstantQSession::kernelRate(44100, 1046.5, false) == 44100, suiteName, "rate");
+}
+
+void appendLE(vector<char>& bytes, unsigned int value, int size) {
+    for (int i = 0; i < size; i++)
+        bytes.push_back((char) ((value >> (8 * i)) & 0xFF));
+}
+
+/**
+ * encodes the samples as a 16 bit stereo wav (with each channel half of the sample) 
+ * @param decoded   the mono samples (sum of channels) as decoded from the wav
+ */
+vector<char> encodeWav(const vector<double>& samples, int fs, vector<double>& decoded) {
+    vector<char> toRet;
+    int dataSize = samples.size() * 4;
+    toRet.insert(toRet.end(), {'R','I','F','F'});
+    appendLE(toRet, 4 + 8 + 16 + 8 + 4 + 8 + dataSize, 4);
+    toRet.insert(toRet.end(), {'W','A','V','E','f','m','t',' '});
+    appendLE(toRet, 16, 4);
+    appendLE(toRet, WAV_FORMAT_PCM, 2);
+    appendLE(toRet, 2, 2);
+    appendLE(toRet, fs, 4);
+    appendLE(toRet, fs * 4, 4);
+    appendLE(toRet, 4, 2);
+    appendLE(toRet, 16, 2);
+
+    // a chunk to be skipped
+    toRet.insert(toRet.end(), {'L','I','S','T'});
+    appendLE(toRet, 4, 4);
+    toRet.insert(toRet.end(), {'I','N','F','O'});
+
+    toRet.insert(toRet.end(), {'d','a','t','a'});
+    appendLE(toRet, dataSize, 4);
+
+    decoded = vector<double>(samples.size());
+    for (int i = 0; i < samples.size(); i++) {
+        short channel = (short) round(samples[i] / 2 * 32767);
+        appendLE(toRet, (unsigned short) channel, 2);
+        appendLE(toRet, (unsigned short) channel, 2);
+        decoded[i] = 2 * channel / 32768.;
+    }
+
+    return toRet;
+}
+
+void StreamingTests() {
+    string suiteName = "streaming tests";
+    int fs = 44100;
+    int outputs = OUTPUT_BINS | OUTPUT_ONSETS;
+    ConstantQSession session(fs, C5, 1046.5, 24, .0054, outputs);
+    StreamSettings settings = { C5, 1046.5, 24, .0054, outputs, false, ACCURACY_EXACT, 2. * fs / session.size(), 3 };
+    int frameInterval = (int) (fs / settings.framesPerSecond);
+
+    vector<double> decoded;
+    auto wav = encodeWav(generateChord(session.size() * 6, fs), fs, decoded);
+    int expectedFrames = (decoded.size() - session.size()) / frameInterval + 1;
+    auto expected = session.analyzeToSingle(decoded, 0, frameInterval, expectedFrames);
+
+    // pushed in uneven slices
+    StreamingAnalyzer analyzer(settings);
+    vector<double> streamed;
+    int sliceSize = 1001;
+    for (int i = 0; i < wav.size(); i += sliceSize) {
+        analyzer.push(&wav[i], min(sliceSize, (int) wav.size() - i));
+        if (analyzer.outputFrames() > 0)
+            test(analyzer.outputStart() * session.frameSize() == streamed.size(), suiteName, "output start");
+
+        streamed.insert(streamed.end(), analyzer.output(), analyzer.output() + analyzer.outputFrames() * session.frameSize());
+        analyzer.consumeOutput();
+    }
+
+    test(analyzer.totalFrames() == expectedFrames, suiteName, "total frames from header");
+    analyzer.finish();
+    streamed.insert(streamed.end(), analyzer.output(), analyzer.output() + analyzer.outputFrames() * session.frameSize());
+    test(streamed.size() == expected.size(), suiteName, "frame count");
+
+    // bins and flux match analysis of the whole track (onset flags are determined by finish)
+    bool matches = streamed.size() == expected.size();
+    for (int i = 0; i < expected.size() && matches; i++) {
+        int item = i % session.frameSize();
+        if (item <= session.bins())
+            matches = abs(streamed[i] - expected[i]) < EPSILON;
+    }
+
+    test(matches, suiteName, "frames match");
+
+    // read from a file descriptor
+    FILE* file = tmpfile();
+    fwrite(&wav[0], 1, wav.size(), file);
+    fflush(file);
+    lseek(fileno(file), 0, SEEK_SET);
+    int framesReceived = 0;
+    int totalFrames = StreamingAnalyzer::analyzeDescriptor(fileno(file), settings, 
+        [&](int start, const double* frames, int count) {
+            if (start == framesReceived && abs(frames[0] - expected[start * session.frameSize()]) < EPSILON)
+                framesReceived += count;
+        }, nullptr, 777);
+    fclose(file);
+    test(totalFrames == expectedFrames && framesReceived == expectedFrames, suiteName, "descriptor");
+
+    StreamingAnalyzer invalid(settings);
+    const char notWav[] = "RIFF\0\0\0\0AVI LIST";
+    test(!invalid.push(notWav, sizeof(notWav)) && !invalid.valid(), suiteName, "invalid");
+
+    // more frames per second than the sample rate analyze every sample
+    StreamSettings everySample = settings;
+    everySample.framesPerSecond = 2. * fs;
+    vector<double> shortDecoded;
+    auto shortWav = encodeWav(generateChord(session.size() + 10, fs), fs, shortDecoded);
+    StreamingAnalyzer dense(everySample);
+    test(dense.push(&shortWav[0], shortWav.size()), suiteName, "dense push");
+    dense.finish();
+    test(dense.totalFrames() == shortDecoded.size() - session.size() + 1, suiteName, "dense frames");
+
+    // onsets, tempo and beats span the whole stream rather than each window (a burst every half second)
+    ConstantQSession onsetSession(fs, C5, 1046.5, 24, .0054, OUTPUT_ONSETS);
+    StreamSettings onsetSettings = { C5, 1046.5, 24, .0054, OUTPUT_ONSETS, false, ACCURACY_EXACT, 20, 
+        DEFAULT_STREAM_WINDOW_FRAMES };
+    int onsetInterval = fs / 20;
+    vector<double> clicks(fs * 10, 0);
+    for (int start = fs / 8; start + fs / 20 < clicks.size(); start += fs / 2) {
+        for (int i = 0; i < fs / 20; i++)
+            clicks[start + i] = .3 * sin(M_PI * i * 2 * C5 / fs);
+    }
+
+    vector<double> clicksDecoded;
+    auto clicksWav = encodeWav(clicks, fs, clicksDecoded);
+    int clickFrames = (clicksDecoded.size() - onsetSession.size()) / onsetInterval + 1;
+    onsetSession.analyzeToSingle(clicksDecoded, 0, onsetInterval, clickFrames);
+    auto& whole = onsetSession.onsetDetector();
+
+    FILE* clicksFile = tmpfile();
+    fwrite(&clicksWav[0], 1, clicksWav.size(), clicksFile);
+    fflush(clicksFile);
+    lseek(fileno(clicksFile), 0, SEEK_SET);
+    bool flagsCleared = true;
+    vector<int> streamedOnsets;
+    vector<int> streamedBeats;
+    double streamedTempo = 0;
+    StreamingAnalyzer::analyzeDescriptor(fileno(clicksFile), onsetSettings, 
+        [&](int start, const double* frames, int count) {
+            for (int f = 0; f < count; f++)
+                flagsCleared = flagsCleared && frames[f * ONSETS_SIZE + 1] == 0 && frames[f * ONSETS_SIZE + 2] == 0;
+        },
+        [&](const OnsetDetector& detector) {
+            streamedOnsets = detector.onsets();
+            streamedBeats = detector.beats();
+            streamedTempo = detector.tempo();
+        });
+    fclose(clicksFile);
+
+    test(flagsCleared, suiteName, "window onsets cleared");
+    test(!whole.onsets().empty() && streamedOnsets == whole.onsets(), suiteName, "stream onsets");
+    test(!whole.beats().empty() && streamedBeats == whole.beats(), suiteName, "stream beats");
+    test(suiteName, "stream tempo", whole.tempo(), streamedTempo, .0001);
+}
+
+double rms(const vector<double>& samples, int start, int end) {
+    double tot = 0;
+    for (int i = start; i < end; i++)
+        tot += samples[i] * samples[i];
+
+    return sqrt(tot / (end - start));
+}
+
+void DecimationTests() {
+    string suiteName = "decimation tests";
+    test(ConstantQSession::decimationFactor(44100, 1046.5) == 15, suiteName, "factor 44100");
+    test(ConstantQSession::decimationFactor(48000, 1046.5) == 16, suiteName, "factor 48000");
+    test(ConstantQSession::decimationFactor(44100, 20000) == 1, suiteName, "factor none");
+
+    int fs = 44100;
+    PolyphaseDecimator decimator(15, 1.1 * 1046.5 / fs);
+    int size = fs;
+    vector<double> decimated(size / 15);
+
+    // tones within the pass band are preserved and those that would alias are removed
+    for (double freq : { 0., 1000., 2500., 10000. }) {
+        vector<double> tone(size);
+        for (int i = 0; i < size; i++)
+            tone[i] = cos(2 * M_PI * freq * i / fs);
+
+        decimator.decimate(&tone[0], size, &decimated[0]);
+        int margin = decimator.taps() / 15 + 1;
+        double level = rms(decimated, margin, decimated.size() - margin) / rms(tone, 0, size);
+        if (freq <= 1000)
+            test(suiteName, "pass " + to_string((int) freq), 1, level, .01);
+        else
+            test(level < .001, suiteName, "stop " + to_string((int) freq));
+    }
+
+    ConstantQSession session(fs, C5, 1046.5, 24, .0054);
+    ConstantQSession decimatedSession(fs, C5, 1046.5, 24, .0054, OUTPUT_BINS, true);
+    test(decimatedSession.decimation() == 15, suiteName, "session factor");
+    test(decimatedSession.fftSize() < session.fftSize() / 8, suiteName, "smaller fft");
+
+    // the same bins at a fraction of the fft size
+    // (window lengths are rounded to whole samples at the lower rate, shifting the skirts of each bin slightly)
+    int frameInterval = fs / 16;
+    int span = max(session.size(), decimatedSession.size());
+    auto data = generateChord(span + frameInterval * 3, fs);
+    auto full = session.analyzeToSingle(data, 0, frameInterval, 4);
+    auto reduced = decimatedSession.analyzeToSingle(data, 0, frameInterval, 4);
+    double peak = *max_element(full.begin(), full.end());
+    double maxError = 0;
+    for (int i = 0; i < full.size(); i++)
+        maxError = max(maxError, abs(full[i] - reduced[i]));
+
+    test(maxError < .15 * peak, suiteName, "bins match");
+
+    // the bins of C, E and G
+    for (int bin : { 0, 8, 14 }) {
+        for (int f = 0; f < 4; f++)
+            test(suiteName, "chord bin " + to_string(bin), full[f * 24 + bin], reduced[f * 24 + bin], .05 * peak);
+    }
+}
+
+void AccuracyTests() {
+    string suiteName = "accuracy tests";
+
+    // single precision fft of a sine
+    int size = 1024;
+    auto sine = generateSin(size, 64);
+    vector<complex<float> > sineFloat(sine.begin(), sine.end());
+    MathUtil::fft(sine, size);
+    MathUtil::fft(&sineFloat[0], size);
+    double fftError = 0;
+    for (int i = 0; i < size; i++)
+        fftError = max(fftError, abs(sine[i] - complex<double>(sineFloat[i])));
+
+    test(fftError < .001, suiteName, "float fft");
+
+    // the direct analysis of a tone peaks at the tone's bin
+    int fs = 44100;
+    ConstantQSession session(fs, C5, 1046.5, 24, .0054);
+    vector<double> tone(session.size());
+    for (int i = 0; i < tone.size(); i++)
+        tone[i] = sin(2 * M_PI * E5 * i / fs);
+
+    vector<double> direct(session.bins());
+    ConstantQ::directConstantQ(&tone[0], fs, C5, 1046.5, 24, &direct[0]);
+    test(max_element(direct.begin(), direct.end()) - direct.begin() == 8, suiteName, "direct peak");
+
+    // the bounds documented with each tier
+    auto exact = AccuracyHarness::measure(fs, 65.41, 1046.5, 24, .0054, ACCURACY_EXACT, false, 4);
+    test(exact.maxError < .01 && exact.rmsError < .0025, suiteName, "exact");
+
+    auto fast = AccuracyHarness::measure(fs, 65.41, 1046.5, 24, .0054, ACCURACY_FAST, false, 4);
+    test(fast.maxError < .01 && fast.rmsError < .0025, suiteName, "fast");
+
+    auto display = AccuracyHarness::measure(fs, 65.41, 1046.5, 24, .0054, ACCURACY_DISPLAY, false, 4);
+    test(display.maxError < .04 && display.rmsError < .006, suiteName, "display");
+
+    auto power = AccuracyHarness::measure(fs, 65.41, 1046.5, 24, .0054, ACCURACY_POWER, false, 4);
+    test(power.maxError < .006 && power.rmsError < .0008, suiteName, "power");
+
+    auto decimated = AccuracyHarness::measure(fs, 65.41, 1046.5, 24, .0054, ACCURACY_FAST, true, 4);
+    test(decimated.maxError < .05, suiteName, "decimated");
+
+    // spectral flux is determined from magnitudes regardless of tier
+    int outputs = OUTPUT_BINS | OUTPUT_ONSETS;
+    ConstantQSession exactOnsets(fs, C5, 1046.5, 24, .0054, outputs);
+    ConstantQSession powerOnsets(fs, C5, 1046.5, 24, .0054, outputs, false, ACCURACY_POWER);
+    int frameInterval = fs / 16;
+    auto data = generateChord(exactOnsets.size() + frameInterval * 3, fs);
+    auto exactFrames = exactOnsets.analyzeToSingle(data, 0, frameInterval, 4);
+    auto powerFrames = powerOnsets.analyzeToSingle(data, 0, frameInterval, 4);
+    int frameSize = exactOnsets.frameSize();
+    bool fluxMatches = true;
+    for (int f = 0; f < 4; f++) {
+        fluxMatches = fluxMatches && abs(exactFrames[f * frameSize + 24] - powerFrames[f * frameSize + 24]) < .001;
+        test(suiteName, "power bin", exactFrames[f * frameSize + 8] * exactFrames[f * frameSize + 8],
+            powerFrames[f * frameSize + 8], .001);
+    }
+
+    test(fluxMatches, suiteName, "power flux");
+}
+
+void PyramidTests() {
+    string suiteName = "pyramid tests";
+    int frameSize = 2;
+    int totalFrames = 100;
+    vector<double> frames(totalFrames * frameSize);
+    for (int f = 0; f < totalFrames; f++) {
+        frames[f * frameSize] = f;
+        frames[f * frameSize + 1] = (f % 7) * .5;
+    }
+
+    // frames added out of order as chunks would complete
+    FramePyramid pyramid(frameSize);
+    pyramid.addFrames(60, &frames[60 * frameSize], 40);
+    pyramid.addFrames(0, &frames[0], 30);
+    test(pyramid.query(32, 48, 1, REDUCE_MAX)[0] == 0, suiteName, "missing frames");
+    pyramid.addFrames(30, &frames[30 * frameSize], 30);
+    test(pyramid.totalFrames() == totalFrames && pyramid.levels() == 8, suiteName, "levels");
+
+    test(pyramid.levelFor(100, 100) == 0, suiteName, "level for frames");
+    test(pyramid.levelFor(100, 25) == 2, suiteName, "level for span");
+    test(pyramid.levelFor(100, 1) == 6, suiteName, "level for overview");
+
+    // the whole track as a single pixel
+    auto overviewMax = pyramid.query(0, totalFrames, 1, REDUCE_MAX);
+    auto overviewMean = pyramid.query(0, totalFrames, 1, REDUCE_MEAN);
+    test(suiteName, "overview max", 99, overviewMax[0], EPSILON);
+    test(suiteName, "overview max 2", 3, overviewMax[1], EPSILON);
+    test(suiteName, "overview mean", 49.5, overviewMean[0], EPSILON);
 
+    // each pixel reduces the frames it starts
+    auto spanMax = pyramid.query(8, 40, 4, REDUCE_MAX);
+    auto spanMean = pyramid.query(8, 40, 4, REDUCE_MEAN);
+    bool matches = true;
+    for (int p = 0; p < 4; p++) {
+        matches = matches && spanMax[p * frameSize] == 8 + 8 * p + 7 && 
+            equal(spanMean[p * frameSize], 8 + 8 * p + 3.5, EPSILON);
+    }
+
+    test(matches, suiteName, "span");
+
+    // pixels narrower than frames repeat the frame under them
+    auto zoomed = pyramid.query(10, 12, 4, REDUCE_MAX);
+    test(zoomed[0] == 10 && zoomed[2] == 10 && zoomed[4] == 11 && zoomed[6] == 11, suiteName, "zoomed");
+
+    // frames already added are ignored
+    vector<double> replacement(frameSize, 1000);
+    pyramid.addFrames(5, &replacement[0], 1);
+    test(pyramid.query(0, totalFrames, 1, REDUCE_MAX)[0] == 99, suiteName, "duplicate ignored");
+}
+
+void AudioWindowTests() {
+    string suiteName = "audio window tests";
+    int blockSamples = 16;
+    vector<double> audio(100);
+    for (int i = 0; i < audio.size(); i++)
+        audio[i] = i;
+
+    // appended in pieces that do not line up with blocks
+    AudioWindow window(blockSamples);
+    window.append(&audio[0], 10);
+    window.append(&audio[10], 50);
+    test(window.start() == 0 && window.end() == 60, suiteName, "append");
+
+    vector<double> copied(30);
+    window.copy(5, 30, &copied[0]);
+    test(copied[0] == 5 && copied[11] == 16 && copied[29] == 34, suiteName, "copy across blocks");
+
+    // only blocks entirely before the sample are released
+    window.releaseBefore(40);
+    test(window.start() == 32, suiteName, "release");
+    test(window.bytes() == 2 * blockSamples * sizeof(double), suiteName, "bytes");
+
+    window.append(&audio[60], 40);
+    vector<double> released(50);
+    window.copy(50, 50, &released[0]);
+    test(released[0] == 50 && released[29] == 79 && released[49] == 99, suiteName, "copy after release");
+
+    window.releaseBefore(100);
+    test(window.start() == 96 && window.end() == 100, suiteName, "partial block retained");
+
+    // 1000 samples of 8 byte audio hold a 200 sample kernel and 8 more frames 100 samples apart
+    test(AudioWindow::framesForBudget(8000, 200, 100) == 9, suiteName, "frames for budget");
+    test(AudioWindow::framesForBudget(800, 200, 100) == 1, suiteName, "frames for small budget");
+}
+
+void PairedFftTests() {
+    string suiteName = "paired fft tests";
+    int fs = 44100;
+    int frameInterval = fs / 16;
+    int outputs = OUTPUT_BINS | OUTPUT_ONSETS;
+
+    // consecutive frames paired in one fft match frames analyzed alone (including the unpaired last frame)
+    ConstantQSession single(fs, C5, 1046.5, 24, .0054, outputs);
+    ConstantQSession paired(fs, C5, 1046.5, 24, .0054, outputs, false, ACCURACY_FAST);
+    test(!single.pairsFrames() && paired.pairsFrames(), suiteName, "pairs frames");
+
+    auto chord = generateChord(single.size() + frameInterval * 6, fs);
+    auto singleFrames = single.analyzeToSingle(chord, 0, frameInterval, 5, 1);
+    auto pairedFrames = paired.analyzeToSingle(chord, 0, frameInterval, 5, 1);
+    double pairedError = 0;
+    for (int i = 0; i < singleFrames.size(); i++)
+        pairedError = max(pairedError, abs(singleFrames[i] - pairedFrames[i]));
+
+    test(pairedError < .001, suiteName, "paired frames");
+
+    // each channel of a stereo analysis matches the channel analyzed alone
+    auto left = generateChord(single.size() + frameInterval * 3, fs);
+    vector<double> right(left.size());
+    for (int i = 0; i < right.size(); i++)
+        right[i] = sin(2 * M_PI * E5 * i / fs);
+
+    auto leftFrames = single.analyzeToSingle(left, 0, frameInterval, 4);
+    auto rightFrames = single.analyzeToSingle(right, 0, frameInterval, 4);
+    int frameSize = single.frameSize();
+    vector<double> stereo(2 * frameSize * 4);
+    int analyzed = single.analyzeStereoInto(&left[0], &right[0], left.size(), 0, frameInterval, 4, &stereo[0]);
+    test(analyzed == 4, suiteName, "stereo analyzed");
+
+    double leftError = 0;
+    double rightError = 0;
+    for (int f = 0; f < 4; f++) {
+        for (int i = 0; i < frameSize; i++) {
+            leftError = max(leftError, abs(leftFrames[f * frameSize + i] - stereo[2 * f * frameSize + i]));
+            rightError = max(rightError, abs(rightFrames[f * frameSize + i] - stereo[(2 * f + 1) * frameSize + i]));
+        }
+    }
+
+    test(leftError < EPSILON, suiteName, "stereo left");
+    test(rightError < EPSILON, suiteName, "stereo right");
+
+    // decimated channels are separated the same way
+    ConstantQSession decimated(fs, C5, 1046.5, 24, .0054, OUTPUT_BINS, true);
+    auto decimatedRight = decimated.analyzeToSingle(right, 0, frameInterval, 2);
+    vector<double> decimatedStereo(2 * decimated.frameSize() * 2);
+    decimated.analyzeStereoInto(&left[0], &right[0], left.size(), 0, frameInterval, 2, &decimatedStereo[0]);
+    test(suiteName, "decimated stereo right", decimatedRight[8], decimatedStereo[decimated.frameSize() + 8], EPSILON);
+}
+
+void FixedPointTests() {
+    string suiteName = "fixed point tests";
+
+    // the block floating point fft of a sine quantized as 16 bit pcm matches the double fft
+    int size = 1024;
+    auto sine = generateSin(size, 64);
+    vector<FixedComplex> sineFixed(size);
+    for (int i = 0; i < size; i++)
+        sineFixed[i] = { (int32_t) lround(sine[i].real() / 10 * 32767) * (1 << 13), 0 };
+
+    MathUtil::fft(sine, size);
+    int exponent = MathUtil::fft(&sineFixed[0], size, FftPruning());
+    test(exponent > 0, suiteName, "fft scaled");
+
+    double peak = 0;
+    double fftError = 0;
+    for (int i = 0; i < size; i++) {
+        complex<double> fixedValue(sineFixed[i].real, sineFixed[i].imag);
+        fixedValue *= ldexp(10 / (32767. * (1 << 13)), exponent);
+        peak = max(peak, abs(sine[i]));
+        fftError = max(fftError, abs(sine[i] - fixedValue));
+    }
+
+    test(fftError / peak < .001, suiteName, "fixed fft");
+
+    // fixed point frames (paired and alone) match the exact tier
+    int fs = 44100;
+    int frameInterval = fs / 16;
+    ConstantQSession exact(fs, C5, 1046.5, 24, .0054);
+    ConstantQSession fixed(fs, C5, 1046.5, 24, .0054, OUTPUT_BINS, false, ACCURACY_FIXED);
+    auto chord = generateChord(exact.size() + frameInterval * 3, fs);
+    auto exactFrames = exact.analyzeToSingle(chord, 0, frameInterval, 3);
+    auto fixedFrames = fixed.analyzeToSingle(chord, 0, frameInterval, 3);
+    double largest = *max_element(exactFrames.begin(), exactFrames.end());
+    double frameError = 0;
+    for (int i = 0; i < exactFrames.size(); i++)
+        frameError = max(frameError, abs(exactFrames[i] - fixedFrames[i]));
+
+    test(frameError / largest < .001, suiteName, "fixed frames");
+
+    // audio beyond full scale is clipped rather than overflowing
+    vector<double> loud(chord.size());
+    for (int i = 0; i < loud.size(); i++)
+        loud[i] = chord[i] * 100;
+
+    auto loudFrames = fixed.analyzeToSingle(loud, 0, frameInterval, 1);
+    test(all_of(loudFrames.begin(), loudFrames.end(), [](double value) { return isfinite(value) && value >= 0; }),
+        suiteName, "clipped");
+
+    // 16 bit audio loaded straight into the fixed point fft matches the same samples as doubles, as does 
+    // 16 bit audio converted for the other tiers and for decimated fixed point sessions
+    vector<int16_t> pcm(chord.size());
+    vector<double> quantized(chord.size());
+    for (int i = 0; i < chord.size(); i++) {
+        pcm[i] = pcm16(chord[i]);
+        quantized[i] = pcm[i] / PCM16_FULL_SCALE;
+    }
+
+    ConstantQSession fixedDecimated(fs, C5, 1046.5, 24, .0054, OUTPUT_BINS, true, ACCURACY_FIXED);
+    for (auto session : { &fixed, &exact, &fixedDecimated }) {
+        auto expected = session->analyzeToSingle(quantized, 0, frameInterval, 3);
+        vector<double> received(expected.size());
+        session->analyzeInt16Into(&pcm[0], pcm.size(), 0, frameInterval, 3, &received[0]);
+        test(equal(expected.begin(), expected.end(), received.begin()), suiteName, 
+            session == &fixed ? "int16 fixed" : session == &exact ? "int16 exact" : "int16 decimated");
+    }
+
+    // fixed point sessions hold only the fixed point kernel
+    auto& tracker = MemoryTracker::instance();
+    double kernelBefore = tracker.report().current[MEMORY_KERNEL];
+    {
+        ConstantQSession fixedOnly(fs, 65.41, 1046.5, 24, .0054, OUTPUT_BINS, false, ACCURACY_FIXED);
+        double fixedKernel = tracker.report().current[MEMORY_KERNEL] - kernelBefore;
+        ConstantQSession exactOnly(fs, 65.41, 1046.5, 24, .0054);
+        double exactKernel = tracker.report().current[MEMORY_KERNEL] - kernelBefore - fixedKernel;
+        test(!fixedOnly.hasKernel() && exact.hasKernel() && fixedKernel < exactKernel, suiteName, 
+            "float kernel released");
+    }
+
+    // the bound documented with the tier
+    auto report = AccuracyHarness::measure(fs, 65.41, 1046.5, 24, .0054, ACCURACY_FIXED, false, 4);
+    test(report.maxError < .01 && report.rmsError < .0025, suiteName, "fixed bound");
+}
+
+void FrameSkipTests() {
+    string suiteName = "frame skip tests";
+
+    // silence is skipped, audio after silence is analyzed and steady audio repeats the analyzed frame
+    int fs = 44100;
+    int window = 1000;
+    int hop = 300;
+    vector<double> audio(2 * window + hop * (MAX_REPEATED_FRAMES + 2), 0);
+    for (int i = window + hop; i < audio.size(); i++)
+        audio[i] = .5 * sin(2 * M_PI * 441 * i / fs);
+
+    FrameGate gate(window, true, true);
+    gate.reset(&audio[0]);
+    test(gate.classify(0) == FRAME_SILENT, suiteName, "gate silent");
+    test(gate.classify(window + hop) == FRAME_ANALYZED, suiteName, "gate after silence");
+
+    int repeated = 0;
+    for (int f = 2; f <= MAX_REPEATED_FRAMES + 2; f++)
+        repeated += gate.classify(window + hop * f) == FRAME_REPEATED ? 1 : 0;
+
+    test(repeated == MAX_REPEATED_FRAMES, suiteName, "gate repeated");
+
+    FrameGate silentOnly(window, true, false);
+    silentOnly.reset(&audio[0]);
+    silentOnly.classify(window + hop);
+    test(silentOnly.classify(window + hop * 2) == FRAME_ANALYZED, suiteName, "gate repeats only if flagged");
+
+    // a session skipping silence matches the frames it analyzes and outputs zeros otherwise
+    int frameInterval = fs / 16;
+    ConstantQSession full(fs, C5, 1046.5, 24, .0054, OUTPUT_BINS, false, ACCURACY_FAST);
+    ConstantQSession skipping(fs, C5, 1046.5, 24, .0054, OUTPUT_BINS | OUTPUT_SKIP_SILENT, false, ACCURACY_FAST);
+    test(skipping.frameSize() == full.frameSize() + 1, suiteName, "skipped item");
+
+    int frames = 9;
+    auto chord = generateChord(full.size() + frameInterval * (frames - 1), fs);
+    int silentFrames = 3;
+    fill(chord.begin(), chord.begin() + full.size() + frameInterval * (silentFrames - 1), 0.);
+
+    auto fullFrames = full.analyzeToSingle(chord, 0, frameInterval, frames);
+    auto skippedFrames = skipping.analyzeToSingle(chord, 0, frameInterval, frames);
+    int bins = full.bins();
+    bool silentZero = true;
+    bool flagged = true;
+    double analyzedError = 0;
+    for (int f = 0; f < frames; f++) {
+        bool silent = f < silentFrames;
+        flagged = flagged && skippedFrames[f * (bins + 1) + bins] == (silent ? FRAME_SILENT : FRAME_ANALYZED);
+        for (int b = 0; b < bins; b++) {
+            double value = skippedFrames[f * (bins + 1) + b];
+            if (silent)
+                silentZero = silentZero && value == 0;
+            else
+                analyzedError = max(analyzedError, abs(value - fullFrames[f * bins + b]));
+        }
+    }
+
+    test(flagged, suiteName, "silent flagged");
+    test(silentZero, suiteName, "silent zero");
+    test(analyzedError < .001, suiteName, "analyzed frames");
+
+    // steady audio repeats analyzed frames in place of analyzing (close to the analysis for a steady chord)
+    ConstantQSession repeating(fs, C5, 1046.5, 24, .0054, OUTPUT_BINS | OUTPUT_SKIPPED);
+    ConstantQSession exact(fs, C5, 1046.5, 24, .0054);
+    auto steady = generateChord(exact.size() + frameInterval * (frames - 1), fs);
+    auto exactFrames = exact.analyzeToSingle(steady, 0, frameInterval, frames);
+    auto repeatedFrames = repeating.analyzeToSingle(steady, 0, frameInterval, frames);
+    double largest = *max_element(exactFrames.begin(), exactFrames.end());
+    int totalRepeated = 0;
+    double repeatedError = 0;
+    for (int f = 0; f < frames; f++) {
+        totalRepeated += repeatedFrames[f * (bins + 1) + bins] == FRAME_REPEATED ? 1 : 0;
+        for (int b = 0; b < bins; b++)
+            repeatedError = max(repeatedError, abs(repeatedFrames[f * (bins + 1) + b] - exactFrames[f * bins + b]));
+    }
+
+    test(totalRepeated > 0 && totalRepeated < frames, suiteName, "repeated frames");
+    test(repeatedError / largest < .05, suiteName, "repeated error");
+}
+
+void TileRendererTests() {
+    string suiteName = "tile renderer tests";
+
+    // a semitone per row at 24 bins per octave draws the larger of the bins around each semitone
+    int bins = 48;
+    int frameSize = bins + 1;
+    TileSettings settings = { 1, 1, -60, COLORMAP_GRAY, false };
+    TileRenderer renderer(bins, 24, frameSize, settings);
+    test(renderer.rows() == 24, suiteName, "rows");
+
+    vector<double> frame(frameSize, 0);
+    frame[10] = 1;
+    frame[21] = pow(10, -30. / 20);
+    frame[bins] = 1;
+    auto& column = renderer.renderRange(&frame[0], 1);
+    auto pixel = [&](const ResultVector<uint8_t>& pixels, int width, int row, int column, int channel) {
+        return (int) pixels[((renderer.rows() - 1 - row) * width + column) * TILE_PIXEL_BYTES + channel];
+    };
+
+    test(pixel(column, 1, 5, 0, 0) == 255 && pixel(column, 1, 5, 0, 3) == 255, suiteName, "reference");
+    test(pixel(column, 1, 0, 0, 0) == 0, suiteName, "floor");
+    test(suiteName, "log scaled", 128, pixel(column, 1, 11, 0, 0), 1);
+    test(pixel(column, 1, 10, 0, 0) == 128 && pixel(column, 1, 12, 0, 0) == 0, suiteName, "shared bins");
+
+    // rows between bins interpolate
+    TileRenderer fine(bins, 24, frameSize, { 4, 1, -60, COLORMAP_GRAY, false });
+    test(fine.rows() == 95, suiteName, "fine rows");
+    frame = vector<double>(frameSize, 0);
+    frame[0] = 1;
+    frame[1] = 1;
+    auto& fineColumn = fine.renderRange(&frame[0], 1);
+    test(fineColumn[((fine.rows() - 2) * TILE_PIXEL_BYTES)] == 255, suiteName, "interpolated");
+
+    // squared magnitudes are scaled as power
+    TileRenderer power(bins, 24, frameSize, { 1, .5, -60, COLORMAP_GRAY, true });
+    frame[0] = .25;
+    test(power.renderRange(&frame[0], 1)[(power.rows() - 1) * TILE_PIXEL_BYTES] == 255, suiteName, "power");
+
+    // frames are rendered into the tiles covering them
+    vector<double> frames(2 * frameSize, 0);
+    frames[10] = 1;
+    frames[frameSize + 10] = 1;
+    renderer.addFrames(TILE_COLUMNS + 44, &frames[0], 2);
+    test(renderer.totalTiles() == 2 && renderer.tile(0).empty(), suiteName, "tiles");
+    test(renderer.tile(1).size() == renderer.rows() * TILE_COLUMNS * TILE_PIXEL_BYTES, suiteName, "tile size");
+    test(pixel(renderer.tile(1), TILE_COLUMNS, 5, 45, 0) == 255 && pixel(renderer.tile(1), TILE_COLUMNS, 5, 43, 3) == 0,
+        suiteName, "tile columns");
+
+    renderer.addFrames(TILE_COLUMNS - 1, &frames[0], 2);
+    test(renderer.tileVersion(0) == 1 && renderer.tileVersion(1) == 2, suiteName, "tile versions");
+
+    // the colormap runs from its first to its last color
+    TileRenderer viridis(bins, 24, frameSize, { 1, 1, -60, COLORMAP_VIRIDIS, false });
+    frame = vector<double>(frameSize, 0);
+    frame[0] = 1;
+    auto& colored = viridis.renderRange(&frame[0], 1);
+    int top = (viridis.rows() - 1) * TILE_PIXEL_BYTES;
+    test(colored[top] == 253 && colored[top + 1] == 231 && colored[top + 2] == 37, suiteName, "colormap last");
+    test(colored[0] == 68 && colored[1] == 1 && colored[2] == 84, suiteName, "colormap first");
+}
+
+void RegionTests() {
+    string suiteName = "region tests";
+    int fs = 44100;
+    int frameInterval = fs / 16;
+
+    ConstantQSession exactSession(fs, C5, 1046.5, 24, .0054);
+    test(exactSession.binForFrequency(C5) == 0 && exactSession.binForFrequency(C5 * pow(2, .5)) == 12 &&
+        exactSession.binForFrequency(10) == 0 && exactSession.binForFrequency(fs) == exactSession.bins() - 1,
+        suiteName, "bin for frequency");
+
+    // region frames match the same bins of full frames for each tier (paired, alone and decimated) 
+    // including at an interval denser than the full analysis (fixed point rounds differently as its block 
+    // scaling follows only the fft outputs computed)
+    auto data = generateChord(exactSession.size() + frameInterval * 4, fs);
+    int firstBin = 10;
+    int endBin = 20;
+    int regionSize = endBin - firstBin;
+    for (auto accuracy : { ACCURACY_EXACT, ACCURACY_FAST, ACCURACY_FIXED }) {
+        for (auto decimate : { false, true }) {
+            ConstantQSession session(fs, C5, 1046.5, 24, .0054, OUTPUT_BINS, decimate, accuracy);
+            for (auto interval : { frameInterval, frameInterval / 4 }) {
+                int total = interval == frameInterval ? 5 : 3;
+                auto full = session.analyzeToSingle(data, 0, interval, total);
+                vector<double> region(total * regionSize);
+                int analyzed = session.analyzeRegionInto(&data[0], data.size(), 0, interval, total, 
+                    firstBin, endBin, &region[0]);
+
+                double largest = *max_element(full.begin(), full.end());
+                double error = 0;
+                for (int i = 0; i < total; i++)
+                    for (int b = firstBin; b < endBin; b++)
+                        error = max(error, abs(full[i * session.bins() + b] - region[i * regionSize + b - firstBin]));
+
+                double tolerance = accuracy == ACCURACY_FIXED ? .001 : 1e-9;
+                test(analyzed == total && error / largest < tolerance, suiteName, "region accuracy " + 
+                    to_string(accuracy) + (decimate ? " decimated" : "") + " interval " + to_string(interval));
+            }
+        }
+    }
+
+    // full analysis is unchanged after a region analysis
+    auto before = exactSession.analyzeToSingle(data, 0, frameInterval, 2);
+    vector<double> region(2 * regionSize);
+    exactSession.analyzeRegionInto(&data[0], data.size(), 0, frameInterval, 2, firstBin, endBin, &region[0]);
+    auto after = exactSession.analyzeToSingle(data, 0, frameInterval, 2);
+    test(equal(before.begin(), before.end(), after.begin()), suiteName, "full after region");
+}
+
+/**
+ * a melody of two random notes at a time changing every few frames
+ * @param seed          selects the melody
+ * @param size          the number of samples
+ * @param fs            the frames per second
+ * @param noteSize      the samples per note
+ */
+vector<double> generateMelody(unsigned seed, int size, int fs, int noteSize) {
+    vector<double> toRet(size);
+    for (int start = 0; start < size; start += noteSize) {
+        for (int voice = 0; voice < 2; voice++) {
+            seed = seed * 1103515245 + 12345;
+            double freq = 130.81 * pow(2, ((seed >> 16) % 36) / 12.);
+            for (int i = start; i < min(size, start + noteSize); i++)
+                toRet[i] += .3 * sin(M_PI * i * 2 * freq / fs);
+        }
+    }
+
+    return toRet;
+}
+
+void FingerprintTests() {
+    string suiteName = "fingerprint tests";
+
+    // shape and change bits of hand made chroma
+    vector<double> chroma(3 * CHROMA_SIZE, 0);
+    chroma[CHROMA_SIZE] = 1;
+    chroma[2 * CHROMA_SIZE] = 1;
+    chroma[2 * CHROMA_SIZE + 4] = 1;
+    auto fingerprints = FingerprintIndex::fingerprints(&chroma[0], 3, CHROMA_SIZE);
+    test(fingerprints[0] == FINGERPRINT_SILENT, suiteName, "silent");
+    test(fingerprints[1] == 1, suiteName, "shape");
+    test(fingerprints[2] == (1u | (1u << 4) | (1u << (CHROMA_SIZE + 4))), suiteName, "change");
+
+    // index chroma of tracks analyzed by a session
+    int fs = 11025;
+    int frameInterval = fs / 8;
+    ConstantQSession session(fs, 65.41, 1046.5, 12, .0054, OUTPUT_BINS | OUTPUT_CHROMA);
+    int frameSize = session.frameSize();
+    int totalFrames = 120;
+    int size = session.size() + frameInterval * (totalFrames - 1);
+    FingerprintIndex index;
+    vector<vector<double> > tracks;
+    for (int t = 0; t < 8; t++) {
+        tracks.push_back(generateMelody(t + 1, size, fs, frameInterval * 3));
+        auto frames = session.analyzeToSingle(tracks.back(), 0, frameInterval, totalFrames);
+        index.addTrack(t, &frames[session.chromaOffset()], totalFrames, frameSize);
+    }
+
+    test(index.totalTracks() == 8 && index.totalFingerprints() == 8 * totalFrames, suiteName, "indexed");
+
+    // a noisy excerpt is found at its offset
+    int excerptStart = 30;
+    int excerptFrames = 40;
+    auto excerpt = tracks[5];
+    for (int i = 0; i < excerpt.size(); i++)
+        excerpt[i] += .01 * sin(i * .37) * sin(i * 1.3);
+
+    auto excerptChroma = session.analyzeToSingle(excerpt, excerptStart * frameInterval, frameInterval, excerptFrames);
+    auto found = index.query(&excerptChroma[session.chromaOffset()], excerptFrames, frameSize, 3);
+    test(!found.empty() && found[0].track == 5 && found[0].offset == excerptStart && found[0].score > .9 &&
+        (found.size() < 2 || found[1].score < .5), suiteName, "excerpt found");
+
+    // a melody not indexed matches poorly
+    auto other = generateMelody(100, size, fs, frameInterval * 3);
+    auto otherChroma = session.analyzeToSingle(other, 0, frameInterval, totalFrames);
+    auto otherFound = index.query(&otherChroma[session.chromaOffset()], totalFrames, frameSize, 1);
+    test(otherFound.empty() || otherFound[0].score < .5, suiteName, "unknown");
+
+    // saved and loaded
+    char path[] = "/tmp/fingerprintsXXXXXX";
+    int descriptor = mkstemp(path);
+    close(descriptor);
+    FingerprintIndex loaded;
+    test(index.save(path) && loaded.load(path) && loaded.totalTracks() == 8 &&
+        loaded.totalFingerprints() == index.totalFingerprints(), suiteName, "save load");
+
+    auto loadedFound = loaded.query(&excerptChroma[session.chromaOffset()], excerptFrames, frameSize, 3);
+    test(loadedFound.size() == found.size() && loadedFound[0].track == 5 && loadedFound[0].score == found[0].score, 
+        suiteName, "loaded query");
+
+    auto bytes = index.serialize();
+    test(!loaded.deserialize(&bytes[0], bytes.size() - 1) && loaded.totalTracks() == 8, suiteName, "truncated");
+
+    // removed incrementally
+    test(index.removeTrack(5) && !index.removeTrack(5) && index.totalFingerprints() == 7 * totalFrames, 
+        suiteName, "removed");
+    auto removedFound = index.query(&excerptChroma[session.chromaOffset()], excerptFrames, frameSize, 3);
+    test(removedFound.empty() || removedFound[0].track != 5, suiteName, "removed query");
+
+    // saving again appends the removal rather than rewriting the tracks
+    auto fileSize = [](const char* path) {
+        FILE* file = fopen(path, "rb");
+        fseek(file, 0, SEEK_END);
+        long toRet = ftell(file);
+        fclose(file);
+        return toRet;
+    };
+
+    long savedSize = fileSize(path);
+    test(index.save(path) && fileSize(path) > savedSize && fileSize(path) - savedSize < 64, suiteName, 
+        "save appends");
+    FingerprintIndex appended;
+    test(appended.load(path) && appended.totalTracks() == 7 && 
+        appended.totalFingerprints() == index.totalFingerprints(), suiteName, "appended load");
+    unlink(path);
+
+    // results are bounded by the tracks indexed however many are requested
+    auto allFound = index.query(&excerptChroma[session.chromaOffset()], excerptFrames, frameSize, 1 << 30);
+    test(allFound.size() <= 7, suiteName, "large k");
+}
+
+void ApiTests() {
+    string suiteName = "api tests";
+    int fs = 44100;
+    int frameInterval = fs / 16;
+    test(cqCreateSession(fs, 1046.5, C5, 24, .0054, CQ_OUTPUT_BINS, 0, CQ_ACCURACY_EXACT) == nullptr, 
+        suiteName, "invalid range");
+    test(cqCreateSession(fs, C5, 1046.5, 24, .0054, 0, 0, CQ_ACCURACY_EXACT) == nullptr, suiteName, "no outputs");
+
+    CqSession* session = cqCreateSession(fs, C5, 1046.5, 24, .0054, CQ_OUTPUT_BINS, 0, CQ_ACCURACY_EXACT);
+    ConstantQSession reference(fs, C5, 1046.5, 24, .0054);
+    test(session && cqBins(session) == reference.bins() && cqSize(session) == reference.size() && 
+        cqFrameSize(session) == reference.frameSize(), suiteName, "sizes");
+
+    auto data = generateChord(reference.size() + frameInterval * 3 + 10, fs);
+    test(cqFrameCount(session, data.size(), 0, frameInterval) == 4, suiteName, "frame count");
+    test(cqFrameCount(session, reference.size() - 1, 0, frameInterval) == 0, suiteName, "frame count short");
+
+    auto expected = reference.analyzeToSingle(data, 0, frameInterval, 4);
+    vector<double> frames(expected.size());
+    test(cqAnalyze(session, &data[0], data.size(), 0, frameInterval, 4, &frames[0]) == 4, suiteName, "analyzed");
+    test(equal(expected.begin(), expected.end(), frames.begin()), suiteName, "analyze");
+
+    vector<float> dataFloat(data.begin(), data.end());
+    vector<double> framesFloat(expected.size());
+    cqAnalyzeFloat(session, &dataFloat[0], dataFloat.size(), 0, frameInterval, 4, &framesFloat[0]);
+    test(suiteName, "analyze float", expected[8], framesFloat[8], .0001);
+
+    vector<int16_t> dataInt16(data.size());
+    for (int i = 0; i < data.size(); i++)
+        dataInt16[i] = pcm16(data[i]);
+
+    vector<double> framesInt16(expected.size());
+    cqAnalyzeInt16(session, &dataInt16[0], dataInt16.size(), 0, frameInterval, 4, &framesInt16[0]);
+    test(suiteName, "analyze int16", expected[8], framesInt16[8], .001);
+
+    test(cqAnalyze(session, &data[0], data.size(), 0, frameInterval, 5, &frames[0]) == CQ_ERROR, 
+        suiteName, "frames past audio");
+
+    // the chord in the left channel and silence in the right
+    vector<double> silence(data.size(), 0);
+    vector<double> stereo(2 * expected.size());
+    int frameSize = cqFrameSize(session);
+    test(cqAnalyzeStereo(session, &data[0], &silence[0], data.size(), 0, frameInterval, 4, &stereo[0]) == 4 &&
+        abs(stereo[2 * frameSize + 8] - expected[frameSize + 8]) < EPSILON && abs(stereo[frameSize + 8]) < EPSILON, 
+        suiteName, "analyze stereo");
+    test(cqAnalyzeStereo(session, &data[0], nullptr, data.size(), 0, frameInterval, 4, &stereo[0]) == CQ_ERROR, 
+        suiteName, "stereo without right");
+
+    vector<double> region(4 * 10);
+    test(cqAnalyzeRegion(session, &data[0], data.size(), 0, frameInterval, 4, 5, 15, &region[0]) == 4 &&
+        region[10 + 3] == expected[reference.bins() + 8], suiteName, "analyze region");
+    test(cqAnalyzeRegion(session, &data[0], data.size(), 0, frameInterval, 4, 5, cqBins(session) + 1, 
+        &region[0]) == CQ_ERROR, suiteName, "region past bins");
+    test(cqBinForFrequency(session, C5 * pow(2, .5)) == 12, suiteName, "bin for frequency");
+
+    CqSession* chromaSession = cqCreateSession(fs, C5, 1046.5, 24, .0054, CQ_OUTPUT_BINS | CQ_OUTPUT_CHROMA, 0, 
+        CQ_ACCURACY_EXACT);
+    test(cqChromaOffset(session) == CQ_ERROR && cqChromaOffset(chromaSession) == cqBins(chromaSession), 
+        suiteName, "chroma offset");
+    vector<double> chromaFrames(12 * cqFrameSize(chromaSession));
+    cqAnalyze(chromaSession, &data[0], data.size(), 0, frameInterval / 4, 12, &chromaFrames[0]);
+
+    CqIndex* index = cqCreateIndex();
+    const double* chroma = &chromaFrames[cqChromaOffset(chromaSession)];
+    int tracks[2];
+    double scores[2];
+    test(cqIndexAddTrack(index, 7, chroma, 12, cqFrameSize(chromaSession)) == 12 && cqIndexTracks(index) == 1 &&
+        cqIndexQuery(index, chroma, 12, cqFrameSize(chromaSession), 2, tracks, scores) == 1 && tracks[0] == 7 && 
+        scores[0] == 1, suiteName, "index");
+    test(cqIndexAddTrack(index, 8, chroma, 12, 11) == CQ_ERROR && cqLoadIndex("/nonexistent/index") == nullptr, 
+        suiteName, "index invalid");
+    test(cqIndexRemoveTrack(index, 7) == 1 && cqIndexTracks(index) == 0, suiteName, "index remove");
+    cqDestroyIndex(index);
+    cqDestroySession(chromaSession);
+
+    cqDestroySession(session);
+}
+
+void ThreadTests() {
+    string suiteName = "thread tests";
+    int fs = 32000;
+    int frameInterval = fs / 16;
+    auto data = generateChord(frameInterval * 40, fs);
+    double kernelBefore = MemoryTracker::instance().report().current[MEMORY_KERNEL];
+
+    // sessions created and analyzing on separate threads share one kernel and the fft tables
+    const int totalThreads = 4;
+    vector<vector<double> > frames(totalThreads);
+    vector<thread> threads;
+    for (int t = 0; t < totalThreads; t++) {
+        threads.push_back(thread([&, t]() {
+            ConstantQSession session(fs, C5, 1046.5, 24, .0054, OUTPUT_BINS | OUTPUT_ONSETS);
+            int totalAnalyses = (data.size() - session.size()) / frameInterval + 1;
+            frames[t] = session.analyzeToSingle(data, 0, frameInterval, totalAnalyses);
+        }));
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    bool matches = true;
+    for (int t = 1; t < totalThreads; t++)
+        matches = matches && frames[t] == frames[0];
+
+    test(!frames[0].empty() && matches, suiteName, "frames match");
+    test(suiteName, "kernel released", kernelBefore, MemoryTracker::instance().report().current[MEMORY_KERNEL], 
+        EPSILON);
+
+    // threads needing a kernel being built wait for it while kernels of other parameters are built alongside
+    vector<shared_ptr<const SparseKernel> > kernels(totalThreads);
+    threads.clear();
+    for (int t = 0; t < totalThreads; t++) {
+        threads.push_back(thread([&, t]() {
+            kernels[t] = KernelCache::instance().kernel(fs, C5, t % 2 ? 1046.5 : 880., 24, .0054);
+        }));
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    test(kernels[0] && kernels[0] == kernels[2] && kernels[1] && kernels[1] == kernels[3] && 
+        kernels[0] != kernels[1], suiteName, "kernel built once per parameters");
+}
 
 int main() {
     MathUtilTests();
     sparseKernelTests();
     ConstantQTests();
+    SessionOutputTests();
+    CancellationTests();
+    OnsetTests();
+    ProfilerTests();
+    MemoryTests();
+    SessionRegistryTests();
+    BakedKernelTests();
+    KernelSharingTests();
+    StreamingTests();
+    DecimationTests();
+    AccuracyTests();
+    PyramidTests();
+    AudioWindowTests();
+    PairedFftTests();
+    FixedPointTests();
+    FrameSkipTests();
+    TileRendererTests();
+    RegionTests();
+    FingerprintTests();
+    ApiTests();
+    ThreadTests();
     return 0;
 }
 
@@ -0,0 +1,164 @@
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <cassert>
+#include "TileRenderer.hpp"
+
+using namespace std;
+
+namespace constantq {
+    const int SEMITONES = 12;
+
+    // a color of a colormap at a position from 0 (the floor) to 1 (the reference)
+    struct ColormapStop {
+        double position;
+        uint8_t red;
+        uint8_t green;
+        uint8_t blue;
+    };
+
+    const vector<ColormapStop> GRAY_STOPS = { { 0, 0, 0, 0 }, { 1, 255, 255, 255 } };
+
+    const vector<ColormapStop> HEAT_STOPS = { 
+        { 0, 0, 0, 0 }, { .4, 200, 30, 0 }, { .7, 255, 170, 0 }, { 1, 255, 255, 255 } };
+
+    const vector<ColormapStop> VIRIDIS_STOPS = { 
+        { 0, 68, 1, 84 }, { .25, 59, 82, 139 }, { .5, 33, 145, 140 }, { .75, 94, 201, 98 }, { 1, 253, 231, 37 } };
+
+    TileRenderer::TileRenderer(int bins, int binsPerOctave, int frameSize, const TileSettings& settings) :
+        _bins(bins), _frameSize(frameSize), _settings(settings) {
+
+        assert(bins > 0 && bins <= frameSize);
+        assert(settings.rowsPerSemitone > 0);
+
+        // row r is centered r / rowsPerSemitone semitones above the first bin and covers the bins 
+        // within half a row of its center (interpolating between bins when none are)
+        double binsPerRow = (double) binsPerOctave / (SEMITONES * settings.rowsPerSemitone);
+        int totalRows = (int) floor((bins - 1) / binsPerRow + 1e-9) + 1;
+        for (int r = 0; r < totalRows; r++) {
+            double center = r * binsPerRow;
+            int first = max(0, (int) ceil(center - binsPerRow / 2 - 1e-9));
+            int last = min(bins - 1, (int) floor(center + binsPerRow / 2 + 1e-9));
+            if (first <= last) {
+                _rows.push_back({ first, last, -1 });
+            }
+            else {
+                int below = min(bins - 1, (int) floor(center));
+                _rows.push_back({ below, min(bins - 1, below + 1), center - below });
+            }
+        }
+
+        buildColormap(settings.colormap);
+    }
+
+    void TileRenderer::buildColormap(int colormap) {
+        auto& stops = colormap == COLORMAP_HEAT ? HEAT_STOPS : 
+            colormap == COLORMAP_VIRIDIS ? VIRIDIS_STOPS : GRAY_STOPS;
+
+        _lut = vector<uint8_t>(COLORMAP_SIZE * TILE_PIXEL_BYTES);
+        int stop = 0;
+        for (int i = 0; i < COLORMAP_SIZE; i++) {
+            double position = (double) i / (COLORMAP_SIZE - 1);
+            while (stop + 2 < stops.size() && stops[stop + 1].position < position)
+                stop++;
+
+            auto& from = stops[stop];
+            auto& to = stops[stop + 1];
+            double t = min(1., max(0., (position - from.position) / (to.position - from.position)));
+            uint8_t* color = &_lut[i * TILE_PIXEL_BYTES];
+            color[0] = (uint8_t) lround(from.red + (to.red - from.red) * t);
+            color[1] = (uint8_t) lround(from.green + (to.green - from.green) * t);
+            color[2] = (uint8_t) lround(from.blue + (to.blue - from.blue) * t);
+            color[3] = 255;
+        }
+    }
+
+    int TileRenderer::rows() const { return _rows.size(); }
+
+    void TileRenderer::setScale(double reference, double floorDb) {
+        _settings.reference = reference;
+        _settings.floorDb = floorDb;
+    }
+
+    int TileRenderer::level(double value) const {
+        if (value <= 0)
+            return 0;
+
+        // squared magnitudes are compared with the squared reference
+        double decibels = _settings.power ? 
+            10 * log10(value / (_settings.reference * _settings.reference)) :
+            20 * log10(value / _settings.reference);
+
+        double scaled = (decibels - _settings.floorDb) / -_settings.floorDb;
+        return max(0, min(COLORMAP_SIZE - 1, (int) lround(scaled * (COLORMAP_SIZE - 1))));
+    }
+
+    void TileRenderer::renderColumns(const double* frames, int count, uint8_t* pixels, int width, 
+        int firstColumn) const {
+
+        int totalRows = _rows.size();
+        for (int c = 0; c < count; c++) {
+            const double* frame = frames + c * _frameSize;
+            for (int r = 0; r < totalRows; r++) {
+                auto& source = _rows[r];
+                double value;
+                if (source.fraction < 0) {
+                    value = frame[source.first];
+                    for (int b = source.first + 1; b <= source.last; b++)
+                        value = max(value, frame[b]);
+                }
+                else {
+                    value = frame[source.first] + (frame[source.last] - frame[source.first]) * source.fraction;
+                }
+
+                // the highest pitch is the top row
+                const uint8_t* color = &_lut[level(value) * TILE_PIXEL_BYTES];
+                uint8_t* pixel = pixels + ((totalRows - 1 - r) * width + firstColumn + c) * TILE_PIXEL_BYTES;
+                copy(color, color + TILE_PIXEL_BYTES, pixel);
+            }
+        }
+    }
+
+    void TileRenderer::addFrames(int start, const double* frames, int count) {
+        while (count > 0) {
+            int index = start / TILE_COLUMNS;
+            int column = start % TILE_COLUMNS;
+            int toRender = min(count, TILE_COLUMNS - column);
+
+            if (index >= _tiles.size()) {
+                _tiles.resize(index + 1);
+                _versions.resize(index + 1, 0);
+            }
+
+            auto& tile = _tiles[index];
+            if (tile.empty())
+                tile = ResultVector<uint8_t>(_rows.size() * TILE_COLUMNS * TILE_PIXEL_BYTES, 0);
+
+            renderColumns(frames, toRender, &tile[0], TILE_COLUMNS, column);
+            _versions[index]++;
+
+            start += toRender;
+            frames += toRender * _frameSize;
+            count -= toRender;
+        }
+    }
+
+    int TileRenderer::totalTiles() const { return _tiles.size(); }
+
+    const ResultVector<uint8_t>& TileRenderer::tile(int index) const {
+        static const ResultVector<uint8_t> empty;
+        return index >= 0 && index < _tiles.size() ? _tiles[index] : empty;
+    }
+
+    int TileRenderer::tileVersion(int index) const {
+        return index >= 0 && index < _versions.size() ? _versions[index] : 0;
+    }
+
+    const ResultVector<uint8_t>& TileRenderer::renderRange(const double* frames, int count) {
+        _range.assign(_rows.size() * count * TILE_PIXEL_BYTES, 0);
+        if (count > 0)
+            renderColumns(frames, count, &_range[0], count, 0);
+
+        return _range;
+    }
+}
@@ -0,0 +1,151 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include "MemoryTracker.hpp"
+
+namespace constantq {
+    // colormaps for rendering tiles (from the floor to the reference)
+    const int COLORMAP_GRAY = 0;
+    // black through red and yellow to white
+    const int COLORMAP_HEAT = 1;
+    // dark blue through green to yellow
+    const int COLORMAP_VIRIDIS = 2;
+
+    // frames (columns) per tile
+    const int TILE_COLUMNS = 256;
+
+    // bytes per pixel (rgba)
+    const int TILE_PIXEL_BYTES = 4;
+
+    // colors in a colormap's lookup table
+    const int COLORMAP_SIZE = 256;
+
+    struct TileSettings {
+        // rows drawn per semitone (rows are aligned to semitones above the minimum frequency)
+        int rowsPerSemitone;
+
+        // the magnitude drawn with the last color (a full scale sine analyzes to about .27)
+        double reference;
+
+        // the decibels relative to the reference drawn with the first color (quieter bins are clamped to it)
+        double floorDb;
+
+        // the COLORMAP_ constant
+        int colormap;
+
+        // whether frames hold squared magnitudes (ACCURACY_POWER)
+        bool power;
+    };
+
+    /**
+     * renders constant q frames to rgba pixels that can be drawn to a canvas as they are 
+     * (rows from the highest pitch at the top, one column per frame) with log scaling through a colormap.
+     * frames are rendered into tiles of TILE_COLUMNS frames as they are added (in any order).
+     */
+    class TileRenderer {
+        private:
+            // the bins (or, for rows between bins, the two bins interpolated) drawn in a row
+            struct RowSource {
+                int first;
+                int last;
+                // the weight of last when interpolating (-1 when drawing the largest of first through last)
+                double fraction;
+            };
+
+            int _bins;
+            int _frameSize;
+            TileSettings _settings;
+
+            // rows from the lowest pitch
+            std::vector<RowSource> _rows;
+
+            // rgba for each level from the floor to the reference
+            std::vector<uint8_t> _lut;
+
+            // the tiles (empty until a frame is added within them) and the number of renders of each
+            std::vector<ResultVector<uint8_t> > _tiles;
+            std::vector<int> _versions;
+
+            // the pixels of the most recent renderRange
+            ResultVector<uint8_t> _range;
+
+            /**
+             * fills the lookup table for the colormap by interpolating between its colors
+             * @param colormap  the COLORMAP_ constant
+             */
+            void buildColormap(int colormap);
+
+            /**
+             * @param value     the value of a bin
+             * @returns         the lookup table level for the value
+             */
+            int level(double value) const;
+
+        public:
+            /**
+             * @param bins          the number of bins in each frame
+             * @param binsPerOctave the bins per octave of the analysis
+             * @param frameSize     the items per frame (bins are the first items)
+             * @param settings      how frames are drawn
+             */
+            TileRenderer(int bins, int binsPerOctave, int frameSize, const TileSettings& settings);
+
+            /**
+             * @returns the pixel rows of tiles
+             */
+            int rows() const;
+
+            /**
+             * changes the log scaling (tiles already rendered keep the previous scaling until their frames 
+             * are added again)
+             * @param reference     the magnitude drawn with the last color
+             * @param floorDb       the decibels relative to the reference drawn with the first color
+             */
+            void setScale(double reference, double floorDb);
+
+            /**
+             * renders frames into columns of an image
+             * @param frames        the frames laid out one after another
+             * @param count         the number of frames
+             * @param pixels        the rgba pixels of an image with rows() rows
+             * @param width         the columns of the image
+             * @param firstColumn   the column of the first frame
+             */
+            void renderColumns(const double* frames, int count, uint8_t* pixels, int width, int firstColumn) const;
+
+            /**
+             * renders frames into the tiles covering them (frames rendered before are replaced)
+             * @param start     the index of the first frame
+             * @param frames    the frames laid out one after another
+             * @param count     the number of frames
+             */
+            void addFrames(int start, const double* frames, int count);
+
+            /**
+             * @returns one more than the index of the last tile with frames
+             */
+            int totalTiles() const;
+
+            /**
+             * @param index     the tile (covering frames [index * TILE_COLUMNS, (index + 1) * TILE_COLUMNS))
+             * @returns         the rgba pixels of the tile (rows() by TILE_COLUMNS; transparent where no 
+             *                  frames have been added and empty if none have)
+             */
+            const ResultVector<uint8_t>& tile(int index) const;
+
+            /**
+             * @param index     the tile
+             * @returns         the number of times frames have been rendered into the tile (so unchanged 
+             *                  tiles need not be drawn again)
+             */
+            int tileVersion(int index) const;
+
+            /**
+             * renders frames (such as a FramePyramid query) to an image with a column per frame
+             * @param frames    the frames laid out one after another
+             * @param count     the number of frames
+             * @returns         the rgba pixels (rows() by count, valid until the next call)
+             */
+            const ResultVector<uint8_t>& renderRange(const double* frames, int count);
+    };
+}
@@ -0,0 +1,199 @@
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include "WavReader.hpp"
+
+using namespace std;
+
+namespace constantq {
+    // the riff header is "RIFF", size, "WAVE"
+    const int RIFF_HEADER_SIZE = 12;
+
+    // chunks are an id and size followed by the chunk data
+    const int CHUNK_HEADER_SIZE = 8;
+
+    // the fmt chunk without extension
+    const int FMT_SIZE = 16;
+
+    // the extensible fmt chunk holds the actual format at the start of the sub format guid
+    const int FMT_EXTENSIBLE_SIZE = 40;
+    const int FMT_SUB_FORMAT_OFFSET = 24;
+
+    // data chunk sizes that writers use when the size is not known in advance
+    const uint32_t UNKNOWN_DATA_SIZE = 0xFFFFFFFF;
+
+    static uint32_t readUint32(const char* ptr) {
+        const unsigned char* bytes = (const unsigned char*) ptr;
+        return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((uint32_t) bytes[3] << 24);
+    }
+
+    static uint16_t readUint16(const char* ptr) {
+        const unsigned char* bytes = (const unsigned char*) ptr;
+        return bytes[0] | (bytes[1] << 8);
+    }
+
+    WavReader::WavReader() : _headerRead(false), _failed(false), _format(0), _channels(0), _fs(0),
+        _bitsPerSample(0), _blockAlign(0), _dataRemaining(-1), _totalSamples(-1) { }
+
+    bool WavReader::headerRead() const { return _headerRead; }
+
+    bool WavReader::failed() const { return _failed; }
+
+    int WavReader::fs() const { return _fs; }
+
+    int WavReader::channels() const { return _channels; }
+
+    long long WavReader::totalSamples() const { return _totalSamples; }
+
+    int WavReader::readHeader() {
+        int available = _pending.size();
+        const char* data = _pending.data();
+
+        if (available < RIFF_HEADER_SIZE)
+            return 0;
+
+        if (memcmp(data, "RIFF", 4) != 0 || memcmp(data + 8, "WAVE", 4) != 0) {
+            _failed = true;
+            return 0;
+        }
+
+        int pos = RIFF_HEADER_SIZE;
+        bool fmtRead = false;
+        while (pos + CHUNK_HEADER_SIZE <= available) {
+            const char* chunk = data + pos;
+            uint32_t chunkSize = readUint32(chunk + 4);
+
+            if (memcmp(chunk, "data", 4) == 0) {
+                if (!fmtRead) {
+                    _failed = true;
+                    return 0;
+                }
+
+                if (chunkSize != 0 && chunkSize != UNKNOWN_DATA_SIZE) {
+                    _dataRemaining = chunkSize;
+                    _totalSamples = chunkSize / _blockAlign;
+                }
+
+                _headerRead = true;
+                return pos + CHUNK_HEADER_SIZE;
+            }
+
+            // chunks are padded to an even size
+            long long paddedSize = chunkSize + (chunkSize & 1);
+
+            // wait for the rest of the chunk if it is needed
+            if (memcmp(chunk, "fmt ", 4) == 0) {
+                if (pos + CHUNK_HEADER_SIZE + paddedSize > available)
+                    return 0;
+
+                const char* fmt = chunk + CHUNK_HEADER_SIZE;
+                if (chunkSize < FMT_SIZE) {
+                    _failed = true;
+                    return 0;
+                }
+
+                _format = readUint16(fmt);
+                _channels = readUint16(fmt + 2);
+                _fs = readUint32(fmt + 4);
+                _blockAlign = readUint16(fmt + 12);
+                _bitsPerSample = readUint16(fmt + 14);
+
+                if (_format == WAV_FORMAT_EXTENSIBLE && chunkSize >= FMT_EXTENSIBLE_SIZE)
+                    _format = readUint16(fmt + FMT_SUB_FORMAT_OFFSET);
+
+                bool supported = _channels > 0 && _fs > 0 && 
+                    _blockAlign == _channels * (_bitsPerSample / 8) &&
+                    ((_format == WAV_FORMAT_PCM && (_bitsPerSample == 8 || _bitsPerSample == 16 || 
+                        _bitsPerSample == 24 || _bitsPerSample == 32)) ||
+                    (_format == WAV_FORMAT_FLOAT && (_bitsPerSample == 32 || _bitsPerSample == 64)));
+
+                if (!supported) {
+                    _failed = true;
+                    return 0;
+                }
+
+                fmtRead = true;
+            }
+            else if (pos + CHUNK_HEADER_SIZE + paddedSize > available) {
+                return 0;
+            }
+
+            pos += CHUNK_HEADER_SIZE + paddedSize;
+        }
+
+        return 0;
+    }
+
+    double WavReader::sample(const char* ptr) const {
+        if (_format == WAV_FORMAT_FLOAT) {
+            if (_bitsPerSample == 32) {
+                float value;
+                memcpy(&value, ptr, sizeof(float));
+                return value;
+            }
+
+            double value;
+            memcpy(&value, ptr, sizeof(double));
+            return value;
+        }
+
+        const unsigned char* bytes = (const unsigned char*) ptr;
+        switch (_bitsPerSample) {
+            case 8: return (bytes[0] - 128) / 128.;
+            case 16: return ((int16_t) readUint16(ptr)) / 32768.;
+            case 24: {
+                int32_t value = (bytes[0] << 8) | (bytes[1] << 16) | ((uint32_t) bytes[2] << 24);
+                return (value >> 8) / 8388608.;
+            }
+            default: return ((int32_t) readUint32(ptr)) / 2147483648.;
+        }
+    }
+
+    bool WavReader::push(const char* bytes, int size, AudioVector<double>& samples) {
+        if (_failed)
+            return false;
+
+        _pending.insert(_pending.end(), bytes, bytes + size);
+
+        int pos = 0;
+        if (!_headerRead) {
+            pos = readHeader();
+            if (_failed)
+                return false;
+
+            if (!_headerRead)
+                return true;
+        }
+
+        // only bytes that belong to the data chunk are decoded
+        long long available = _pending.size() - pos;
+        if (_dataRemaining >= 0)
+            available = min(available, _dataRemaining);
+
+        int bytesPerSample = _bitsPerSample / 8;
+        long long frames = available / _blockAlign;
+        samples.reserve(samples.size() + frames);
+        for (long long f = 0; f < frames; f++) {
+            const char* frame = _pending.data() + pos + f * _blockAlign;
+            double total = 0;
+            for (int c = 0; c < _channels; c++)
+                total += sample(frame + c * bytesPerSample);
+
+            samples.push_back(total);
+        }
+
+        long long consumed = frames * _blockAlign;
+        if (_dataRemaining >= 0) {
+            _dataRemaining -= consumed;
+
+            // anything after the data chunk is not needed
+            if (_dataRemaining == 0) {
+                _pending.clear();
+                return true;
+            }
+        }
+
+        _pending.erase(_pending.begin(), _pending.begin() + pos + consumed);
+        return true;
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <vector>
+#include "MemoryTracker.hpp"
+
+namespace constantq {
+    // wav sample formats supported by WavReader
+    const int WAV_FORMAT_PCM = 1;
+    const int WAV_FORMAT_FLOAT = 3;
+    const int WAV_FORMAT_EXTENSIBLE = 0xFFFE;
+
+    /**
+     * incrementally decodes a wav file pushed in arbitrarily sized pieces into mono samples
+     * (channels are summed) so the file never has to be held in memory
+     * supports 8, 16, 24 and 32 bit integer pcm and 32 and 64 bit float
+     */
+    class WavReader {
+        private:
+            // bytes received but not yet consumed (header bytes or a partial sample frame)
+            std::vector<char> _pending;
+
+            bool _headerRead;
+            bool _failed;
+
+            int _format;
+            int _channels;
+            int _fs;
+            int _bitsPerSample;
+            int _blockAlign;
+
+            // bytes of sample data remaining in the data chunk (-1 if the writer did not specify a size)
+            long long _dataRemaining;
+
+            // total sample frames in the data chunk (-1 if not specified)
+            long long _totalSamples;
+
+            /**
+             * reads chunks until the data chunk is found
+             * @returns the number of pending bytes consumed
+             */
+            int readHeader();
+
+            /**
+             * @returns the sample at ptr normalized to [-1, 1]
+             */
+            double sample(const char* ptr) const;
+
+        public:
+            WavReader();
+
+            /**
+             * decodes the bytes appending complete mono samples to samples
+             * @param bytes     the next bytes of the file
+             * @param size      the number of bytes
+             * @param samples   where decoded samples are appended
+             * @returns         false if the file is not a supported wav
+             */
+            bool push(const char* bytes, int size, AudioVector<double>& samples);
+
+            bool headerRead() const;
+
+            /**
+             * @returns whether the file was determined to not be a supported wav
+             */
+            bool failed() const;
+
+            int fs() const;
+
+            int channels() const;
+
+            /**
+             * @returns the total samples (per channel) in the file or -1 if unknown
+             */
+            long long totalSamples() const;
+    };
+}
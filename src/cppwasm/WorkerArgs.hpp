@@ -1,31 +1,84 @@
 #pragma once
+#include "Profiler.hpp"
+#include "MemoryTracker.hpp"
 
 // for communicating to ConstantQWorker to get sparse kernel
+// (for loadSession, the serialized kernel follows these args)
 struct SparseKernelWorkerArgs {
+    int session;        // the id of the session to create on the worker
     int fs;
     double minFreq;
     double maxFreq;
     int bins;
     double thresh;
+    int outputs;        // the constantq::OUTPUT_ flags for what is produced per frame
+    int decimate;       // 1 to decimate the audio to the lowest adequate rate before analysis
+    int accuracy;       // the constantq::ACCURACY_ tier
+    int shareKernel;    // 1 to return the serialized kernel so other workers can load it instead of building it
 };
 
-// for returning from creating the sparsekernel
+// for returning from creating the sparsekernel; if requested, the serialized kernel follows
 struct SparseKernelReturnArgs {
     int size;
     int bins;
+    int frameSize;      // the number of items produced per analyzed frame
+    int kernelBytes;    // the size of the serialized kernel following these args (0 if not shared)
+    constantq::ProfileSummary profile;  // timings and counters for creating the session
+    constantq::MemoryReport memory;     // the worker's memory use after creating the session
 };
 
+// sampleFormat values in ConstantQHeaderArgs for the audio following the header
+const int SAMPLE_FORMAT_DOUBLE = 0;
+// 16 bit pcm (for ACCURACY_FIXED sessions, which quantize the audio to 16 bits and load it straight into 
+// their fixed point fft; a quarter of the bytes of doubles)
+const int SAMPLE_FORMAT_INT16 = 1;
+
 // args sent to constant q analysis; this header precedes the pertinent audio data to process
 struct ConstantQHeaderArgs {
     int startFrame;     // the starting frame (typically 0)
     int frameInterval;  // frames between sampling
     int totalSamples;   // the total number of constant q samples to gather (spaced at frame interval)
     int sampleStart;    // the index for this sample start in return array
+    int primeFrames;    // frames preceding startFrame's first sample only used to establish spectral flux
+    int chunk;          // the index of this chunk of the analysis
+    int session;        // the id of the worker session to analyze with
+    int sampleFormat;   // the SAMPLE_FORMAT_ of the audio (also keeps the header a multiple of 8 bytes
+                        // so the audio that follows is aligned)
+};
+
+// args to release a session on a worker
+struct ReleaseSessionArgs {
+    int session;
+};
+
+// args sent with each slice of a streamed wav file; this header precedes the slice's bytes
+struct StreamSliceHeaderArgs {
+    int session;        // the id of the stream on the worker (the stream is created with the first slice)
+    int slice;          // the index of this slice
+    int final;          // 1 if this is the last slice of the file
+    int outputs;        // the constantq::OUTPUT_ flags for what is produced per frame
+    int bins;
+    int windowFrames;   // frames analyzed at once
+    int decimate;       // 1 to decimate the audio to the lowest adequate rate before analysis
+    int accuracy;       // the constantq::ACCURACY_ tier
+    double minFreq;
+    double maxFreq;
+    double thresh;
+    double framesPerSecond;
 };
 
+// totalFrames values in ConstantQReturnHeaderArgs for streamed analyses
+const int STREAM_FRAMES_UNKNOWN = -1;
+const int STREAM_INVALID = -2;
+
 // args to return from constant q
 struct ConstantQReturnHeaderArgs {
     int bins;
     int totalSamples;
     int sampleStart;
+    int frameSize;      // the number of items per sample (layout determined by the session outputs)
+    int chunk;          // the index of this chunk of the analysis
+    int totalFrames;    // for streamed analyses, the total frames once known (or STREAM_ value)
+    constantq::ProfileSummary profile;  // timings and counters for analyzing this chunk
+    constantq::MemoryReport memory;     // the worker's memory use while analyzing this chunk
 };
\ No newline at end of file
@@ -0,0 +1,635 @@
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <pythread.h>
+#include <climits>
+#include "../ConstantQApi.h"
+
+/**
+ * the python extension around the C interface; audio and results are passed through the buffer protocol 
+ * so numpy arrays are read and written in place (see constantq/__init__.py for the numpy wrapper)
+ */
+
+// sessions and indexes are used without the GIL so each object's lock serializes the threads sharing it
+// (they would otherwise share its scratch memory); the lock is held to replace the object in init as well
+
+typedef struct {
+    PyObject_HEAD
+    CqSession* session;
+    PyThread_type_lock lock;
+} SessionObject;
+
+typedef struct {
+    PyObject_HEAD
+    CqIndex* index;
+    PyThread_type_lock lock;
+} IndexObject;
+
+/**
+ * acquires an object's lock, waiting without the GIL so the thread holding the lock can finish
+ * @param lock      the lock (released by the caller with PyThread_release_lock)
+ */
+static void acquireLock(PyThread_type_lock lock) {
+    if (PyThread_acquire_lock(lock, NOWAIT_LOCK))
+        return;
+
+    Py_BEGIN_ALLOW_THREADS
+    PyThread_acquire_lock(lock, WAIT_LOCK);
+    Py_END_ALLOW_THREADS
+}
+
+/**
+ * @param view      the buffer
+ * @param items     set to the number of items in the buffer
+ * @returns         whether the number of items fits the int sizes of ConstantQApi.h (otherwise a python 
+ *                  error is set)
+ */
+static bool checkItems(const Py_buffer* view, int* items) {
+    Py_ssize_t total = view->len / view->itemsize;
+    if (total > INT_MAX) {
+        PyErr_SetString(PyExc_ValueError, "buffers hold at most 2**31 - 1 items");
+        return false;
+    }
+
+    *items = (int) total;
+    return true;
+}
+
+// the formats of audio buffers (struct module codes)
+const char FORMAT_DOUBLE = 'd';
+const char FORMAT_FLOAT = 'f';
+const char FORMAT_INT16 = 'h';
+
+/**
+ * acquires a one dimensional contiguous buffer of doubles, floats or 16 bit pcm
+ * @param obj       the object exporting the buffer
+ * @param view      the view to fill (released by the caller with PyBuffer_Release on success)
+ * @param writable  whether the buffer will be written (only doubles are accepted)
+ * @param format    set to the format of the items (FORMAT_DOUBLE, FORMAT_FLOAT or FORMAT_INT16)
+ * @returns         whether the buffer was acquired (otherwise a python error is set)
+ */
+static bool acquireBuffer(PyObject* obj, Py_buffer* view, bool writable, char* format) {
+    int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | (writable ? PyBUF_WRITABLE : 0);
+    if (PyObject_GetBuffer(obj, view, flags) != 0)
+        return false;
+
+    const char* code = view->format ? view->format : "B";
+    if (code[0] == '@' || code[0] == '=' || code[0] == '<')
+        code++;
+
+    *format = code[1] == '\0' ? code[0] : '\0';
+    if (!writable && view->ndim != 1)
+        PyErr_SetString(PyExc_ValueError, "audio must be one dimensional");
+    else if (writable && *format != FORMAT_DOUBLE)
+        PyErr_SetString(PyExc_TypeError, "results must be float64");
+    else if (*format != FORMAT_DOUBLE && *format != FORMAT_FLOAT && *format != FORMAT_INT16)
+        PyErr_SetString(PyExc_TypeError, "audio must be int16, float32 or float64");
+    else
+        return true;
+
+    PyBuffer_Release(view);
+    return false;
+}
+
+static int Session_init(SessionObject* self, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = { "fs", "min_freq", "max_freq", "bins", "thresh", "outputs", "decimate", 
+        "accuracy", nullptr };
+
+    int fs;
+    double minFreq, maxFreq;
+    int bins = 24;
+    double thresh = .0054;
+    int outputs = CQ_OUTPUT_BINS;
+    int decimate = 0;
+    int accuracy = CQ_ACCURACY_EXACT;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "idd|idipi", (char**) keywords, 
+            &fs, &minFreq, &maxFreq, &bins, &thresh, &outputs, &decimate, &accuracy))
+        return -1;
+
+    // the session is replaced once no other thread is analyzing with it
+    acquireLock(self->lock);
+    CqSession* session;
+    Py_BEGIN_ALLOW_THREADS
+    session = cqCreateSession(fs, minFreq, maxFreq, bins, thresh, outputs, decimate, accuracy);
+    Py_END_ALLOW_THREADS
+
+    cqDestroySession(self->session);
+    self->session = session;
+    PyThread_release_lock(self->lock);
+
+    if (!self->session) {
+        PyErr_SetString(PyExc_ValueError, "invalid session parameters");
+        return -1;
+    }
+
+    return 0;
+}
+
+static PyObject* Session_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    SessionObject* self = (SessionObject*) PyType_GenericNew(type, args, kwargs);
+    if (self && !(self->lock = PyThread_allocate_lock())) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+
+    return (PyObject*) self;
+}
+
+static void Session_dealloc(SessionObject* self) {
+    cqDestroySession(self->session);
+    if (self->lock)
+        PyThread_free_lock(self->lock);
+
+    Py_TYPE(self)->tp_free((PyObject*) self);
+}
+
+static bool checkSession(SessionObject* self) {
+    if (!self->session)
+        PyErr_SetString(PyExc_RuntimeError, "session is not initialized");
+
+    return self->session != nullptr;
+}
+
+static PyObject* Session_getBins(SessionObject* self, void*) {
+    return checkSession(self) ? PyLong_FromLong(cqBins(self->session)) : nullptr;
+}
+
+static PyObject* Session_getSize(SessionObject* self, void*) {
+    return checkSession(self) ? PyLong_FromLong(cqSize(self->session)) : nullptr;
+}
+
+static PyObject* Session_getFrameSize(SessionObject* self, void*) {
+    return checkSession(self) ? PyLong_FromLong(cqFrameSize(self->session)) : nullptr;
+}
+
+static PyObject* Session_getChromaOffset(SessionObject* self, void*) {
+    if (!checkSession(self))
+        return nullptr;
+
+    int offset = cqChromaOffset(self->session);
+    return PyLong_FromLong(offset == CQ_ERROR ? -1 : offset);
+}
+
+static PyObject* Session_frameCount(SessionObject* self, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = { "samples", "frame_interval", "start", nullptr };
+    Py_ssize_t samples;
+    int frameInterval;
+    int start = 0;
+    if (!checkSession(self) || 
+            !PyArg_ParseTupleAndKeywords(args, kwargs, "ni|i", (char**) keywords, &samples, &frameInterval, &start))
+        return nullptr;
+
+    if (samples > INT_MAX) {
+        PyErr_SetString(PyExc_ValueError, "buffers hold at most 2**31 - 1 items");
+        return nullptr;
+    }
+
+    int frames = cqFrameCount(self->session, (int) samples, start, frameInterval);
+    if (frames == CQ_ERROR) {
+        PyErr_SetString(PyExc_ValueError, "invalid start or frame interval");
+        return nullptr;
+    }
+
+    return PyLong_FromLong(frames);
+}
+
+static PyObject* Session_analyzeInto(SessionObject* self, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = { "audio", "out", "frame_interval", "start", "frames", nullptr };
+    PyObject* audioObj;
+    PyObject* outObj;
+    int frameInterval;
+    int start = 0;
+    int frames = -1;
+    if (!checkSession(self) || !PyArg_ParseTupleAndKeywords(args, kwargs, "OOi|ii", (char**) keywords, 
+            &audioObj, &outObj, &frameInterval, &start, &frames))
+        return nullptr;
+
+    Py_buffer audio;
+    Py_buffer out;
+    char format = '\0';
+    char outFormat = '\0';
+    if (!acquireBuffer(audioObj, &audio, false, &format))
+        return nullptr;
+
+    if (!acquireBuffer(outObj, &out, true, &outFormat)) {
+        PyBuffer_Release(&audio);
+        return nullptr;
+    }
+
+    int samples = 0;
+    if (!checkItems(&audio, &samples)) {
+        PyBuffer_Release(&audio);
+        PyBuffer_Release(&out);
+        return nullptr;
+    }
+
+    acquireLock(self->lock);
+    if (frames < 0)
+        frames = cqFrameCount(self->session, samples, start, frameInterval);
+
+    int analyzed = CQ_ERROR;
+    if (frames >= 0 && (Py_ssize_t) frames * cqFrameSize(self->session) <= out.len / out.itemsize) {
+        // the GIL is released during analysis so sessions on other threads can run concurrently
+        Py_BEGIN_ALLOW_THREADS
+        if (format == FORMAT_FLOAT)
+            analyzed = cqAnalyzeFloat(self->session, (const float*) audio.buf, samples, start, frameInterval, 
+                frames, (double*) out.buf);
+        else if (format == FORMAT_INT16)
+            analyzed = cqAnalyzeInt16(self->session, (const int16_t*) audio.buf, samples, start, frameInterval, 
+                frames, (double*) out.buf);
+        else
+            analyzed = cqAnalyze(self->session, (const double*) audio.buf, samples, start, frameInterval, frames, 
+                (double*) out.buf);
+        Py_END_ALLOW_THREADS
+    }
+
+    PyThread_release_lock(self->lock);
+    PyBuffer_Release(&audio);
+    PyBuffer_Release(&out);
+
+    if (analyzed == CQ_ERROR) {
+        PyErr_SetString(PyExc_ValueError, "frames exceed the audio or results buffer");
+        return nullptr;
+    }
+
+    return PyLong_FromLong(analyzed);
+}
+
+static PyObject* Session_analyzeStereoInto(SessionObject* self, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = { "left", "right", "out", "frame_interval", "start", "frames", nullptr };
+    PyObject* leftObj;
+    PyObject* rightObj;
+    PyObject* outObj;
+    int frameInterval;
+    int start = 0;
+    int frames = -1;
+    if (!checkSession(self) || !PyArg_ParseTupleAndKeywords(args, kwargs, "OOOi|ii", (char**) keywords, 
+            &leftObj, &rightObj, &outObj, &frameInterval, &start, &frames))
+        return nullptr;
+
+    Py_buffer left;
+    Py_buffer right;
+    Py_buffer out;
+    char leftFormat = '\0';
+    char rightFormat = '\0';
+    char outFormat = '\0';
+    if (!acquireBuffer(leftObj, &left, false, &leftFormat))
+        return nullptr;
+
+    if (!acquireBuffer(rightObj, &right, false, &rightFormat)) {
+        PyBuffer_Release(&left);
+        return nullptr;
+    }
+
+    if (!acquireBuffer(outObj, &out, true, &outFormat)) {
+        PyBuffer_Release(&left);
+        PyBuffer_Release(&right);
+        return nullptr;
+    }
+
+    int samples = 0;
+    if (!checkItems(&left, &samples)) {
+        PyBuffer_Release(&left);
+        PyBuffer_Release(&right);
+        PyBuffer_Release(&out);
+        return nullptr;
+    }
+
+    int analyzed = CQ_ERROR;
+    const char* error = "frames exceed the audio or results buffer";
+    if (leftFormat != FORMAT_DOUBLE || rightFormat != FORMAT_DOUBLE)
+        error = "stereo audio must be float64";
+    else if (right.len != left.len)
+        error = "channels must have the same length";
+    else {
+        acquireLock(self->lock);
+        if (frames < 0)
+            frames = cqFrameCount(self->session, samples, start, frameInterval);
+
+        if (frames >= 0 && (Py_ssize_t) frames * 2 * cqFrameSize(self->session) <= out.len / out.itemsize) {
+            Py_BEGIN_ALLOW_THREADS
+            analyzed = cqAnalyzeStereo(self->session, (const double*) left.buf, (const double*) right.buf, 
+                samples, start, frameInterval, frames, (double*) out.buf);
+            Py_END_ALLOW_THREADS
+        }
+
+        PyThread_release_lock(self->lock);
+    }
+
+    PyBuffer_Release(&left);
+    PyBuffer_Release(&right);
+    PyBuffer_Release(&out);
+
+    if (analyzed == CQ_ERROR) {
+        PyErr_SetString(PyExc_ValueError, error);
+        return nullptr;
+    }
+
+    return PyLong_FromLong(analyzed);
+}
+
+static PyGetSetDef Session_getset[] = {
+    { "bins", (getter) Session_getBins, nullptr, "the number of constant q bins", nullptr },
+    { "size", (getter) Session_getSize, nullptr, "the number of audio samples analyzed per frame", nullptr },
+    { "frame_size", (getter) Session_getFrameSize, nullptr, "the number of items produced per frame", nullptr },
+    { "chroma_offset", (getter) Session_getChromaOffset, nullptr, 
+        "the index of the chroma within each frame (-1 without OUTPUT_CHROMA)", nullptr },
+    { nullptr }
+};
+
+static PyMethodDef Session_methods[] = {
+    { "frame_count", (PyCFunction) Session_frameCount, METH_VARARGS | METH_KEYWORDS, 
+        "frame_count(samples, frame_interval, start=0): the number of frames audio of the length holds" },
+    { "analyze_into", (PyCFunction) Session_analyzeInto, METH_VARARGS | METH_KEYWORDS, 
+        "analyze_into(audio, out, frame_interval, start=0, frames=-1): analyzes float32 or float64 audio into "
+        "a float64 buffer of frames * frame_size items returning the number of frames (all that fit if -1)" },
+    { "analyze_stereo_into", (PyCFunction) Session_analyzeStereoInto, METH_VARARGS | METH_KEYWORDS, 
+        "analyze_stereo_into(left, right, out, frame_interval, start=0, frames=-1): analyzes float64 channels "
+        "of the same length into a float64 buffer of frames * 2 * frame_size items (each frame's left channel "
+        "followed by its right) returning the number of frames (all that fit if -1)" },
+    { nullptr }
+};
+
+static PyTypeObject SessionType = {
+    PyVarObject_HEAD_INIT(nullptr, 0)
+};
+
+static int Index_init(IndexObject* self, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = { "path", nullptr };
+    const char* path = nullptr;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|z", (char**) keywords, &path))
+        return -1;
+
+    acquireLock(self->lock);
+    CqIndex* index;
+    Py_BEGIN_ALLOW_THREADS
+    index = path ? cqLoadIndex(path) : cqCreateIndex();
+    Py_END_ALLOW_THREADS
+
+    cqDestroyIndex(self->index);
+    self->index = index;
+    PyThread_release_lock(self->lock);
+
+    if (!self->index) {
+        PyErr_SetString(path ? PyExc_OSError : PyExc_MemoryError, 
+            path ? "the file does not hold an index" : "out of memory");
+        return -1;
+    }
+
+    return 0;
+}
+
+static PyObject* Index_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    IndexObject* self = (IndexObject*) PyType_GenericNew(type, args, kwargs);
+    if (self && !(self->lock = PyThread_allocate_lock())) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+
+    return (PyObject*) self;
+}
+
+static void Index_dealloc(IndexObject* self) {
+    cqDestroyIndex(self->index);
+    if (self->lock)
+        PyThread_free_lock(self->lock);
+
+    Py_TYPE(self)->tp_free((PyObject*) self);
+}
+
+static bool checkIndex(IndexObject* self) {
+    if (!self->index)
+        PyErr_SetString(PyExc_RuntimeError, "index is not initialized");
+
+    return self->index != nullptr;
+}
+
+/**
+ * acquires chroma frames as a one dimensional float64 buffer
+ * @param obj       the object exporting the buffer
+ * @param view      the view to fill (released by the caller with PyBuffer_Release on success)
+ * @param stride    the items from one frame's chroma to the next
+ * @param frames    set to the number of frames in the buffer
+ * @returns         whether the buffer was acquired (otherwise a python error is set)
+ */
+static bool acquireChroma(PyObject* obj, Py_buffer* view, int stride, int* frames) {
+    char format = '\0';
+    if (!acquireBuffer(obj, view, false, &format))
+        return false;
+
+    Py_ssize_t items = view->len / view->itemsize;
+    if (format != FORMAT_DOUBLE || stride < 12 || items % stride != 0) {
+        PyErr_SetString(PyExc_ValueError, "chroma must be float64 frames of stride items");
+        PyBuffer_Release(view);
+        return false;
+    }
+
+    if (items / stride > INT_MAX) {
+        PyErr_SetString(PyExc_ValueError, "chroma holds at most 2**31 - 1 frames");
+        PyBuffer_Release(view);
+        return false;
+    }
+
+    *frames = (int) (items / stride);
+    return true;
+}
+
+static PyObject* Index_addTrack(IndexObject* self, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = { "track", "chroma", "stride", nullptr };
+    int track;
+    PyObject* chromaObj;
+    int stride = 12;
+    if (!checkIndex(self) || 
+            !PyArg_ParseTupleAndKeywords(args, kwargs, "iO|i", (char**) keywords, &track, &chromaObj, &stride))
+        return nullptr;
+
+    Py_buffer chroma;
+    int frames = 0;
+    if (!acquireChroma(chromaObj, &chroma, stride, &frames))
+        return nullptr;
+
+    int indexed;
+    acquireLock(self->lock);
+    Py_BEGIN_ALLOW_THREADS
+    indexed = cqIndexAddTrack(self->index, track, (const double*) chroma.buf, frames, stride);
+    Py_END_ALLOW_THREADS
+    PyThread_release_lock(self->lock);
+    PyBuffer_Release(&chroma);
+
+    if (indexed == CQ_ERROR)
+        return PyErr_NoMemory();
+
+    return PyLong_FromLong(indexed);
+}
+
+static PyObject* Index_removeTrack(IndexObject* self, PyObject* args) {
+    int track;
+    if (!checkIndex(self) || !PyArg_ParseTuple(args, "i", &track))
+        return nullptr;
+
+    acquireLock(self->lock);
+    bool removed = cqIndexRemoveTrack(self->index, track) == 1;
+    PyThread_release_lock(self->lock);
+    return PyBool_FromLong(removed);
+}
+
+static PyObject* Index_query(IndexObject* self, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = { "chroma", "k", "stride", nullptr };
+    PyObject* chromaObj;
+    int k = 10;
+    int stride = 12;
+    if (!checkIndex(self) || 
+            !PyArg_ParseTupleAndKeywords(args, kwargs, "O|ii", (char**) keywords, &chromaObj, &k, &stride))
+        return nullptr;
+
+    if (k < 0) {
+        PyErr_SetString(PyExc_ValueError, "k must not be negative");
+        return nullptr;
+    }
+
+    Py_buffer chroma;
+    int frames = 0;
+    if (!acquireChroma(chromaObj, &chroma, stride, &frames))
+        return nullptr;
+
+    // no more tracks are found than are indexed (so the buffers are not sized by a large k)
+    acquireLock(self->lock);
+    int indexed = cqIndexTracks(self->index);
+    if (k > indexed)
+        k = indexed;
+
+    int* tracks = (int*) PyMem_Malloc(sizeof(int) * (k + 1));
+    double* scores = (double*) PyMem_Malloc(sizeof(double) * (k + 1));
+    int found = CQ_ERROR;
+    if (tracks && scores) {
+        Py_BEGIN_ALLOW_THREADS
+        found = cqIndexQuery(self->index, (const double*) chroma.buf, frames, stride, k, tracks, scores);
+        Py_END_ALLOW_THREADS
+    }
+
+    PyThread_release_lock(self->lock);
+
+    PyBuffer_Release(&chroma);
+    PyObject* toRet = found == CQ_ERROR ? PyErr_NoMemory() : PyList_New(found);
+    for (int i = 0; toRet && i < found; i++)
+        PyList_SET_ITEM(toRet, i, Py_BuildValue("(id)", tracks[i], scores[i]));
+
+    PyMem_Free(tracks);
+    PyMem_Free(scores);
+    return toRet;
+}
+
+static PyObject* Index_save(IndexObject* self, PyObject* args) {
+    const char* path;
+    if (!checkIndex(self) || !PyArg_ParseTuple(args, "s", &path))
+        return nullptr;
+
+    int saved;
+    acquireLock(self->lock);
+    Py_BEGIN_ALLOW_THREADS
+    saved = cqSaveIndex(self->index, path);
+    Py_END_ALLOW_THREADS
+    PyThread_release_lock(self->lock);
+
+    if (saved == CQ_ERROR)
+        return PyErr_SetFromErrnoWithFilename(PyExc_OSError, path);
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* Index_getTracks(IndexObject* self, void*) {
+    if (!checkIndex(self))
+        return nullptr;
+
+    acquireLock(self->lock);
+    int tracks = cqIndexTracks(self->index);
+    PyThread_release_lock(self->lock);
+    return PyLong_FromLong(tracks);
+}
+
+static PyGetSetDef Index_getset[] = {
+    { "tracks", (getter) Index_getTracks, nullptr, "the number of tracks indexed", nullptr },
+    { nullptr }
+};
+
+static PyMethodDef Index_methods[] = {
+    { "add_track", (PyCFunction) Index_addTrack, METH_VARARGS | METH_KEYWORDS, 
+        "add_track(track, chroma, stride=12): indexes float64 chroma frames (replacing any track with the id) "
+        "returning the number of frames indexed" },
+    { "remove_track", (PyCFunction) Index_removeTrack, METH_VARARGS, 
+        "remove_track(track): removes a track returning whether it was indexed" },
+    { "query", (PyCFunction) Index_query, METH_VARARGS | METH_KEYWORDS, 
+        "query(chroma, k=10, stride=12): the (track, score) of the k most similar tracks from the most similar" },
+    { "save", (PyCFunction) Index_save, METH_VARARGS, 
+        "save(path): writes the index to a file (appending the tracks changed since if it was last saved or loaded)" },
+    { nullptr }
+};
+
+static PyTypeObject IndexType = {
+    PyVarObject_HEAD_INIT(nullptr, 0)
+};
+
+static PyModuleDef constantqModule = {
+    PyModuleDef_HEAD_INIT, "_constantq", 
+    "constant q analysis sessions and chroma fingerprint indexes over the ConstantQApi.h interface", -1
+};
+
+PyMODINIT_FUNC PyInit__constantq(void) {
+    SessionType.tp_name = "constantq._constantq.Session";
+    SessionType.tp_doc = "Session(fs, min_freq, max_freq, bins=24, thresh=.0054, outputs=1, decimate=False, accuracy=0)";
+    SessionType.tp_basicsize = sizeof(SessionObject);
+    SessionType.tp_flags = Py_TPFLAGS_DEFAULT;
+    SessionType.tp_new = Session_new;
+    SessionType.tp_init = (initproc) Session_init;
+    SessionType.tp_dealloc = (destructor) Session_dealloc;
+    SessionType.tp_methods = Session_methods;
+    SessionType.tp_getset = Session_getset;
+    if (PyType_Ready(&SessionType) < 0)
+        return nullptr;
+
+    IndexType.tp_name = "constantq._constantq.Index";
+    IndexType.tp_doc = "Index(path=None): a chroma fingerprint index of tracks (loaded from path if given)";
+    IndexType.tp_basicsize = sizeof(IndexObject);
+    IndexType.tp_flags = Py_TPFLAGS_DEFAULT;
+    IndexType.tp_new = Index_new;
+    IndexType.tp_init = (initproc) Index_init;
+    IndexType.tp_dealloc = (destructor) Index_dealloc;
+    IndexType.tp_methods = Index_methods;
+    IndexType.tp_getset = Index_getset;
+    if (PyType_Ready(&IndexType) < 0)
+        return nullptr;
+
+    PyObject* module = PyModule_Create(&constantqModule);
+    if (!module)
+        return nullptr;
+
+    Py_INCREF(&SessionType);
+    if (PyModule_AddObject(module, "Session", (PyObject*) &SessionType) < 0) {
+        Py_DECREF(&SessionType);
+        Py_DECREF(module);
+        return nullptr;
+    }
+
+    Py_INCREF(&IndexType);
+    if (PyModule_AddObject(module, "Index", (PyObject*) &IndexType) < 0) {
+        Py_DECREF(&IndexType);
+        Py_DECREF(module);
+        return nullptr;
+    }
+
+    PyModule_AddIntConstant(module, "API_VERSION", cqApiVersion());
+    PyModule_AddIntConstant(module, "OUTPUT_BINS", CQ_OUTPUT_BINS);
+    PyModule_AddIntConstant(module, "OUTPUT_NOTES", CQ_OUTPUT_NOTES);
+    PyModule_AddIntConstant(module, "OUTPUT_CHROMA", CQ_OUTPUT_CHROMA);
+    PyModule_AddIntConstant(module, "OUTPUT_ONSETS", CQ_OUTPUT_ONSETS);
+    PyModule_AddIntConstant(module, "OUTPUT_SKIP_SILENT", CQ_OUTPUT_SKIP_SILENT);
+    PyModule_AddIntConstant(module, "OUTPUT_SKIP_REPEATED", CQ_OUTPUT_SKIP_REPEATED);
+    PyModule_AddIntConstant(module, "FRAME_ANALYZED", CQ_FRAME_ANALYZED);
+    PyModule_AddIntConstant(module, "FRAME_SILENT", CQ_FRAME_SILENT);
+    PyModule_AddIntConstant(module, "FRAME_REPEATED", CQ_FRAME_REPEATED);
+    PyModule_AddIntConstant(module, "ACCURACY_EXACT", CQ_ACCURACY_EXACT);
+    PyModule_AddIntConstant(module, "ACCURACY_FAST", CQ_ACCURACY_FAST);
+    PyModule_AddIntConstant(module, "ACCURACY_DISPLAY", CQ_ACCURACY_DISPLAY);
+    PyModule_AddIntConstant(module, "ACCURACY_POWER", CQ_ACCURACY_POWER);
+    PyModule_AddIntConstant(module, "ACCURACY_FIXED", CQ_ACCURACY_FIXED);
+    return module;
+}
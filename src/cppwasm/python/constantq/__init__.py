@@ -0,0 +1,130 @@
+"""
+constant q analysis of numpy audio with the ConstantQJs C++ sessions (see ConstantQApi.h)
+
+audio is read in place from int16, float32 or float64 arrays and results are written in place to float64
+arrays, so analyzing does not copy the audio (float32 and int16 audio is converted a span at a time by the
+session; int16 audio is read as sample / 32767 and loaded straight into the fft of ACCURACY_FIXED sessions)
+
+    session = constantq.Session(44100, 65.41, 1046.5)
+    frames = session.analyze(audio, frame_interval=44100 // 16)   # shape (frames, session.frame_size)
+
+tracks are indexed by the fingerprints of their chroma to find similar or duplicate recordings
+
+    index = constantq.Index()
+    index.add_track(track_id, session.chroma(frames))   # session created with OUTPUT_CHROMA
+    index.query(session.chroma(other_frames), k=5)      # [(track_id, score), ...]
+"""
+import numpy as np
+
+from ._constantq import (API_VERSION, OUTPUT_BINS, OUTPUT_NOTES, OUTPUT_CHROMA, OUTPUT_ONSETS,
+                         OUTPUT_SKIP_SILENT, OUTPUT_SKIP_REPEATED, FRAME_ANALYZED, FRAME_SILENT, FRAME_REPEATED,
+                         ACCURACY_EXACT, ACCURACY_FAST, ACCURACY_DISPLAY, ACCURACY_POWER,
+                         ACCURACY_FIXED)
+from . import _constantq
+
+
+class Session(_constantq.Session):
+    """
+    a constant q analysis session (the kernel is built once and reused for every analysis)
+
+    Session(fs, min_freq, max_freq, bins=24, thresh=.0054, outputs=OUTPUT_BINS, decimate=False,
+            accuracy=ACCURACY_EXACT)
+
+    frames are exact by default (as with the C API) so archived or exported results match; the faster tiers
+    suit display only (see ConstantQSession.hpp for their error bounds)
+
+    sessions on different threads run concurrently; threads sharing a session take turns (each call waits for
+    the session's other calls to finish)
+    """
+
+    def analyze(self, audio, frame_interval, start=0, frames=None, out=None):
+        """
+        :param audio:           one dimensional int16, float32 or float64 audio (other types are converted)
+        :param frame_interval:  the samples between frames
+        :param start:           the first sample analyzed
+        :param frames:          the number of frames (all that fit if None)
+        :param out:             a C contiguous float64 array of at least frames * frame_size items to reuse
+        :returns:               the frames as a (frames, frame_size) view of out (or of a new array)
+        """
+        audio = np.ascontiguousarray(audio)
+        if audio.dtype not in (np.int16, np.float32, np.float64):
+            audio = audio.astype(np.float64)
+
+        if frames is None:
+            frames = self.frame_count(audio.shape[0], frame_interval, start)
+
+        if out is None:
+            out = np.empty((frames, self.frame_size), dtype=np.float64)
+
+        analyzed = self.analyze_into(audio, out, frame_interval, start, frames)
+        return out.reshape(-1)[:analyzed * self.frame_size].reshape(analyzed, self.frame_size)
+
+    def analyze_stereo(self, left, right, frame_interval, start=0, frames=None, out=None):
+        """
+        analyzes each channel separately with one fft per frame for both channels
+
+        :param left:            the one dimensional left channel (converted to float64 if needed)
+        :param right:           the right channel of the same length
+        :param frame_interval:  the samples between frames
+        :param start:           the first sample analyzed
+        :param frames:          the number of frames (all that fit if None)
+        :param out:             a C contiguous float64 array of at least frames * 2 * frame_size items to reuse
+        :returns:               the frames as a (frames, 2, frame_size) view of out (or of a new array)
+                                where [:, 0] is the left channel and [:, 1] the right
+        """
+        left = np.ascontiguousarray(left, dtype=np.float64)
+        right = np.ascontiguousarray(right, dtype=np.float64)
+
+        if frames is None:
+            frames = self.frame_count(left.shape[0], frame_interval, start)
+
+        if out is None:
+            out = np.empty((frames, 2, self.frame_size), dtype=np.float64)
+
+        analyzed = self.analyze_stereo_into(left, right, out, frame_interval, start, frames)
+        return out.reshape(-1)[:analyzed * 2 * self.frame_size].reshape(analyzed, 2, self.frame_size)
+
+    def chroma(self, frames):
+        """
+        :param frames:  frames from analyze of a session with OUTPUT_CHROMA
+        :returns:       the chroma of each frame as a (frames, 12) view of frames
+        """
+        if self.chroma_offset < 0:
+            raise ValueError('the session does not output chroma')
+
+        return frames[:, self.chroma_offset:self.chroma_offset + 12]
+
+
+class Index(_constantq.Index):
+    """
+    an index of tracks by the fingerprints of their chroma frames to find similar or duplicate recordings
+    (see FingerprintIndex.hpp); tracks are added as they are analyzed and the index is saved to a file
+    (saving again to the file last saved or loaded appends only the tracks added or removed since)
+
+    Index(path=None)    # loaded from path if given
+    """
+
+    def add_track(self, track, chroma):
+        """
+        :param track:   the track id (replacing any track with the id)
+        :param chroma:  the (frames, 12) chroma of the track
+        :returns:       the number of frames indexed (those not silent)
+        """
+        return super().add_track(track, _chroma_frames(chroma))
+
+    def query(self, chroma, k=10):
+        """
+        :param chroma:  the (frames, 12) chroma of all or an excerpt of a recording
+        :param k:       the most tracks returned
+        :returns:       the (track, score) of the most similar tracks from the most similar where score is the
+                        share of the frames matched (0 to 1)
+        """
+        return super().query(_chroma_frames(chroma), k)
+
+
+def _chroma_frames(chroma):
+    chroma = np.ascontiguousarray(chroma, dtype=np.float64)
+    if chroma.ndim != 2 or chroma.shape[1] != 12:
+        raise ValueError('chroma must have shape (frames, 12)')
+
+    return chroma.reshape(-1)
@@ -0,0 +1,32 @@
+"""
+builds the constantq python extension from the C++ sources in the parent directory
+
+usage: pip install ./src/cppwasm/python (or python setup.py build_ext --inplace from this directory)
+"""
+import glob
+import os
+from setuptools import setup, Extension
+
+here = os.path.dirname(os.path.abspath(__file__))
+cpp_dir = os.path.dirname(here)
+
+# the library sources (everything but the tests and the wasm entry points)
+wasm_only = {'Tests.cpp', 'ConstantQOrchestrator.cpp', 'ConstantQWorker.cpp'}
+library_sources = sorted(
+    os.path.relpath(path, here) for path in glob.glob(os.path.join(cpp_dir, '*.cpp'))
+    if os.path.basename(path) not in wasm_only)
+
+setup(
+    name='constantq',
+    version='1.0.0',
+    description='constant q analysis with the ConstantQJs sparse kernel implementation',
+    packages=['constantq'],
+    install_requires=['numpy'],
+    ext_modules=[
+        Extension(
+            'constantq._constantq',
+            sources=['_constantq.cpp'] + library_sources,
+            include_dirs=[cpp_dir],
+            language='c++',
+            extra_compile_args=['-std=c++17', '-O2'])
+    ])
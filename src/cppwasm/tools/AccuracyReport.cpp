@@ -0,0 +1,40 @@
+#include <cstdio>
+#include "../AccuracyHarness.hpp"
+#include "../ConstantQSession.hpp"
+#include "../Profiler.hpp"
+
+using namespace std;
+using namespace constantq;
+
+/**
+ * prints the error of each accuracy tier against the direct time domain constant q transform
+ * and the time spent per frame for the default range (the bounds documented with the ACCURACY_ constants)
+ * 
+ * usage: AccuracyReport
+ */
+
+const char* TIER_NAMES[] = { "exact", "fast", "display", "power", "fixed" };
+
+// frames analyzed when timing each tier
+const int TIMED_FRAMES = 200;
+
+int main() {
+    printf("%-8s %-9s %12s %12s %14s\n", "tier", "decimate", "max error", "rms error", "ms per frame");
+    for (int decimate = 0; decimate <= 1; decimate++) {
+        for (int accuracy = ACCURACY_EXACT; accuracy <= ACCURACY_FIXED; accuracy++) {
+            auto report = AccuracyHarness::measure(44100, 65.41, 1046.5, 24, .0054, accuracy, decimate != 0);
+
+            ConstantQSession session(44100, 65.41, 1046.5, 24, .0054, OUTPUT_BINS, decimate != 0, accuracy);
+            int frameInterval = 44100 / 16;
+            auto data = AccuracyHarness::testSignal(session.size() + frameInterval * TIMED_FRAMES, 44100);
+            double start = Profiler::now();
+            session.analyzeToSingle(data, 0, frameInterval, TIMED_FRAMES);
+            double msPerFrame = (Profiler::now() - start) * 1000 / TIMED_FRAMES;
+
+            printf("%-8s %-9s %12.6f %12.6f %14.4f\n", TIER_NAMES[accuracy], decimate ? "yes" : "no", 
+                report.maxError, report.rmsError, msPerFrame);
+        }
+    }
+
+    return 0;
+}
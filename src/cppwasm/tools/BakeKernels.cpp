@@ -0,0 +1,78 @@
+#include <cstdio>
+#include <vector>
+#include "../ConstantQ.hpp"
+#include "../SparseKernel.hpp"
+
+using namespace std;
+using namespace constantq;
+
+/**
+ * generates BakedKernels.cpp holding sparse kernels for common configurations so workers 
+ * can skip building them at runtime (see buildWasm.js)
+ * 
+ * usage: BakeKernels > BakedKernels.cpp
+ */
+
+// the configurations to bake (the defaults in ConstantQ.ts at common sample rates and
+// the rates those are decimated to; see ConstantQSession::decimationFactor)
+struct BakeConfig {
+    int fs;
+    double minFreq;
+    double maxFreq;
+    int bins;
+    double thresh;
+};
+
+const BakeConfig CONFIGS[] = {
+    { 44100, 65.41, 1046.5, 24, .0054 },
+    { 48000, 65.41, 1046.5, 24, .0054 },
+    { 2940, 65.41, 1046.5, 24, .0054 },
+    { 3000, 65.41, 1046.5, 24, .0054 }
+};
+
+int main() {
+    int totalConfigs = sizeof(CONFIGS) / sizeof(BakeConfig);
+
+    printf("// generated by tools/BakeKernels.cpp; do not edit\n");
+    printf("#include \"BakedKernels.hpp\"\n\n");
+    printf("namespace constantq {\n");
+
+    for (int c = 0; c < totalConfigs; c++) {
+        auto& config = CONFIGS[c];
+        auto kernel = ConstantQ::sparseKernel(config.fs, config.minFreq, config.maxFreq, config.bins, config.thresh);
+
+        printf("    const int ROW_STARTS_%d[] = {", c);
+        int total = 0;
+        for (int b = 0; b <= kernel.bins(); b++) {
+            printf("%s%d", b == 0 ? "" : ",", total);
+            if (b < kernel.bins())
+                total += kernel.rowSize(b);
+        }
+        printf("};\n\n");
+
+        // hex floats so values are reproduced exactly
+        printf("    const BakedKernelEntry ENTRIES_%d[] = {\n", c);
+        for (int b = 0; b < kernel.bins(); b++) {
+            auto row = kernel.row(b);
+            for (int e = 0; e < kernel.rowSize(b); e++) {
+                auto multiplier = row[e].multiplier();
+                printf("        {%d,%a,%a},\n", row[e].fftIndex(), multiplier.real(), multiplier.imag());
+            }
+        }
+        printf("    };\n\n");
+    }
+
+    printf("    const BakedKernel BAKED_KERNELS[] = {\n");
+    for (int c = 0; c < totalConfigs; c++) {
+        auto& config = CONFIGS[c];
+        auto kernel = ConstantQ::sparseKernel(config.fs, config.minFreq, config.maxFreq, config.bins, config.thresh);
+        printf("        {%d,%a,%a,%d,%a,%d,%d,ROW_STARTS_%d,ENTRIES_%d},\n",
+            config.fs, config.minFreq, config.maxFreq, config.bins, config.thresh, 
+            kernel.size(), kernel.bins(), c, c);
+    }
+    printf("    };\n\n");
+
+    printf("    const int TOTAL_BAKED_KERNELS = %d;\n", totalConfigs);
+    printf("}\n");
+    return 0;
+}